@@ -0,0 +1,71 @@
+#pragma once
+
+/*
+ * Sparse linear assignment for GNN association.
+ *
+ * Rows are tracks, columns clusters; only gated pairs are stored.  Every row
+ * also has a private "unassigned" column of cost missCost, so the solver
+ * minimises
+ *
+ *     sum(cost of assigned pairs) + missCost * (number of unassigned rows)
+ *
+ * with each cluster used at most once.  A pair is only worth taking if its
+ * cost is below missCost.
+ *
+ * The solver is the shortest-augmenting-path phase of Jonker-Volgenant: rows
+ * are inserted one at a time, each by a Dijkstra search over reduced costs
+ * (c - u_row - v_col) restricted to the stored pairs.  The duals keep reduced
+ * costs non-negative, so the result is optimal.  Cost is
+ * O(rows * E log E) for E stored pairs instead of O(n^3) over a padded dense
+ * matrix, and scratch storage is reused across calls.
+ */
+
+#include <vector>
+
+namespace cuas {
+
+// Gated costs in compressed-row form: row r's candidates are
+// col/cost[rowStart[r] .. rowStart[r + 1]).
+struct SparseCostMatrix {
+    int numCols = 0;
+    std::vector<int>    rowStart{0};
+    std::vector<int>    col;
+    std::vector<double> cost;
+
+    void reset(int cols) {
+        numCols = cols;
+        rowStart.assign(1, 0);
+        col.clear();
+        cost.clear();
+    }
+    void add(int c, double v) { col.push_back(c); cost.push_back(v); }
+    void endRow()             { rowStart.push_back(static_cast<int>(col.size())); }
+    int  numRows() const      { return static_cast<int>(rowStart.size()) - 1; }
+};
+
+class SparseAssignmentSolver {
+public:
+    // rowToCol[r] = assigned column of row r, or -1.
+    void solve(const SparseCostMatrix& C, double missCost, std::vector<int>& rowToCol);
+    // As above with a miss cost per row (rowMissCost[r]).
+    void solve(const SparseCostMatrix& C, const std::vector<double>& rowMissCost,
+               std::vector<int>& rowToCol);
+
+private:
+    struct HeapEntry {
+        double dist;
+        int    col;
+        bool operator>(const HeapEntry& o) const { return dist > o.dist; }
+    };
+
+    std::vector<double> u_, v_;            // row / column duals
+    std::vector<int>    rowCol_, colRow_;  // current matching
+    std::vector<double> shortest_;         // per-search column distances
+    std::vector<int>    pathRow_;
+    std::vector<char>   scanned_;
+    std::vector<int>    touched_, scannedRows_;
+    std::vector<HeapEntry> heap_;
+    std::vector<double> missCost_;
+};
+
+} // namespace cuas
@@ -3,7 +3,9 @@
 #include "common/types.h"
 #include "common/config.h"
 #include "prediction/imm_filter.h"
-#include "track_management/track.h"
+#include "association/cluster_index.h"
+#include "common/worker_pool.h"
+#include <atomic>
 #include <vector>
 #include <memory>
 
@@ -21,32 +23,142 @@ struct AssociationOutput {
     std::vector<int> unmatchedClusters;
 };
 
+// Associators see each track only through its gating statistics for the
+// dwell: tracks[i] is the InnovationStats of track i, and AssociationResult
+// indices refer to positions in that vector.
 class IAssociator {
 public:
     virtual ~IAssociator() = default;
-    virtual AssociationOutput associate(
-        const std::vector<Track>& tracks,
-        const std::vector<Cluster>& clusters,
-        const IMMFilter& imm,
-        const MeasMatrix& R) = 0;
+    // Replaces `out`, reusing its capacity.
+    virtual void associate(const std::vector<InnovationStats>& tracks,
+                           const std::vector<Cluster>& clusters,
+                           AssociationOutput& out) = 0;
     virtual std::string name() const = 0;
+
+    AssociationOutput associate(const std::vector<InnovationStats>& tracks,
+                                const std::vector<Cluster>& clusters) {
+        AssociationOutput out;
+        associate(tracks, clusters, out);
+        return out;
+    }
+
+    // Fast path for a gated component of one track and one cluster at
+    // squared Mahalanobis distance d2 (already within the gate): true if this
+    // associator would match the pair, with the distance it would report.
+    virtual bool associateSingle(const InnovationStats& track, double d2,
+                                 double& distance) const = 0;
+
+    // Per-dwell context for stateful associators: the id and measurement
+    // noise R of each track, in the order of associate()'s tracks.
+    virtual void setDwellContext(const std::vector<uint32_t>& /*trackIds*/,
+                                 const std::vector<MeasMatrix>& /*R*/) {}
+
+    // False for associators whose result depends on more than one component
+    // at a time (e.g. state carried across dwells by track id); the engine
+    // then hands them the whole dwell.
+    virtual bool decomposable() const { return true; }
 };
 
+/*
+ * AssociationEngine — runs the configured associator on each dwell.
+ *
+ * With AssociationConfig::decompose set, the dwell is gated once (fanned
+ * out over the worker pool), the gated track-cluster graph is split into
+ * connected components (union-find over gated pairs) and
+ * each component is associated on its own: tracks and clusters with no
+ * gated partner go straight to the unmatched lists, one-track/one-cluster
+ * components take IAssociator::associateSingle(), and the rest are solved by
+ * per-thread associator instances across the worker pool, largest first.
+ * No associator couples pairs outside one component, so the result is the
+ * whole-dwell result; matches are reported in track order and the
+ * unmatched lists ascending.
+ */
 class AssociationEngine {
 public:
     explicit AssociationEngine(const AssociationConfig& cfg);
 
+    // Rebuilds the associators for `cfg` (any MHT hypothesis tree restarts
+    // from the current tracks).  A load-shedding fallback request stays in
+    // force.  Not thread safe against process().
+    void reconfigure(const AssociationConfig& cfg);
+
+    // `workers` may be null: components are then solved on the caller.
+    // `out` is replaced, reusing its capacity; with decompose set, a
+    // steady dwell size then allocates nothing.
+    void process(const std::vector<InnovationStats>& tracks,
+                 const std::vector<Cluster>& clusters,
+                 AssociationOutput& out, WorkerPool* workers = nullptr);
     AssociationOutput process(
-        const std::vector<Track>& tracks,
+        const std::vector<InnovationStats>& tracks,
         const std::vector<Cluster>& clusters,
-        const IMMFilter& imm,
-        const MeasMatrix& R);
+        WorkerPool* workers = nullptr);
+
+    // Forwarded to the associators before each process(); see
+    // IAssociator::setDwellContext().
+    void setDwellContext(const std::vector<uint32_t>& trackIds,
+                         const std::vector<MeasMatrix>& R);
+
+    // The d^2 gate the active associator pairs tracks and clusters within.
+    double gate() const;
+
+    // A pair settled before process() (track-aided clustering): true if
+    // the active associator would match `track` to a cluster at d^2 `d2`
+    // were they a component of their own, with the distance it would
+    // report.  Always false outside gate() or for an associator that is not
+    // decomposable.
+    bool associateSingle(const InnovationStats& track, double d2, double& distance) const;
 
     std::string activeMethod() const;
 
+    // Load shedding: route JPDA and MHT through a GNN associator while set.
+    // No effect for the other methods.
+    void setFallbackToGNN(bool on) { useFallback_.store(on); }
+
 private:
+    std::unique_ptr<IAssociator> makeAssociator(bool fallback) const;
+    bool usingFallback() const { return fallback_ && useFallback_.load(); }
+    // The dwell gate: pairs_, ascending by track then cluster.
+    void gatePairs(const std::vector<InnovationStats>& tracks,
+                   const std::vector<Cluster>& clusters, double gate, WorkerPool* workers);
+    void decomposed(const std::vector<InnovationStats>& tracks,
+                    const std::vector<Cluster>& clusters,
+                    bool fallback, WorkerPool* workers, AssociationOutput& out);
+    int findRoot(int n);
+
     std::unique_ptr<IAssociator> associator_;
+    std::unique_ptr<IAssociator> fallback_;
+    std::atomic<bool>            useFallback_{false};
     AssociationConfig config_;
+
+    // One per pool thread: its own associators (they keep scratch) and
+    // sub-problem buffers.
+    struct Lane {
+        std::unique_ptr<IAssociator> associator;
+        std::unique_ptr<IAssociator> fallback;
+        std::vector<InnovationStats> tracks;
+        std::vector<Cluster>         clusters;   // positions only, no detectionIndices
+    };
+
+    // Decomposition scratch, reused across dwells.
+    struct GatedPair { int track, cluster; double d2; };
+    struct ChunkPairs {
+        std::vector<int>       near;
+        std::vector<GatedPair> pairs;
+    };
+    ClusterIndex            index_;
+    std::vector<ChunkPairs> chunkPairs_;
+    std::vector<GatedPair>  pairs_;
+    std::vector<int>       parent_;
+    std::vector<int>       componentOf_;
+    // Members of component k: tracks trackList_[trackStart_[k] ..
+    // trackStart_[k + 1]), likewise for clusters.
+    std::vector<int>       trackStart_, trackList_, clusterStart_, clusterList_;
+    std::vector<int>       order_;      // multi-pair components, largest first
+    std::vector<AssociationOutput> results_;   // per order_ entry; matches in dwell indices
+    std::vector<AssociationResult> matched_;
+    std::vector<int>       trackMatch_;
+    std::vector<char>      clusterMatched_;
+    std::vector<Lane>      lanes_;
 };
 
 } // namespace cuas
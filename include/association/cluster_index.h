@@ -0,0 +1,67 @@
+#pragma once
+
+/*
+ * ClusterIndex — per-dwell spatial pre-gate for the associators.
+ *
+ * A uniform grid over Cluster::cartesian, rebuilt every dwell.  A track's
+ * gate {z : (z - zPred)^T S^-1 (z - zPred) <= gate} lies inside the box
+ * zPred +/- sqrt(gate * S_kk) (the ellipsoid's exact axis-aligned bounding
+ * box), so only clusters in the grid cells that box overlaps need a
+ * Mahalanobis distance.  Candidates are returned in ascending cluster index,
+ * i.e. in the order the all-pairs loops visited them, so every associator's
+ * result is unchanged.
+ *
+ * The cell size is the median gate box width of the dwell's tracks.  Below
+ * MIN_INDEXED_CLUSTERS clusters the index is not built and every cluster is
+ * a candidate.  Track-aided clustering indexes the dwell's detection
+ * positions the same way.
+ */
+
+#include "common/types.h"
+#include "prediction/imm_filter.h"
+#include <cstdint>
+#include <vector>
+
+namespace cuas {
+
+class ClusterIndex {
+public:
+    static constexpr size_t MIN_INDEXED_CLUSTERS = 32;
+
+    // `gate` is the associator's Mahalanobis gate (d^2).
+    void build(const std::vector<InnovationStats>& tracks,
+               const std::vector<Cluster>& clusters, double gate);
+    // Over bare positions; candidates() then returns indices into `points`.
+    void build(const std::vector<InnovationStats>& tracks,
+               const std::vector<CartesianPos>& points, double gate);
+
+    // Indices of the clusters inside `inn`'s gate box, ascending.
+    void candidates(const InnovationStats& inn, std::vector<int>& out) const;
+
+private:
+    void    buildIndex(const std::vector<InnovationStats>& tracks, double gate);
+    const CartesianPos& position(size_t c) const {
+        return clusters_ ? (*clusters_)[c].cartesian : (*points_)[c];
+    }
+    int64_t cellOf(double v) const;
+    size_t  bucketOf(int64_t ix, int64_t iy, int64_t iz) const;
+
+    // Exactly one of clusters_ and points_ is set, size_ long.
+    const std::vector<Cluster>*      clusters_ = nullptr;
+    const std::vector<CartesianPos>* points_   = nullptr;
+    size_t size_     = 0;
+    double gate_     = 0.0;
+    double cellSize_ = 0.0;
+    bool   indexed_  = false;
+
+    // Clusters grouped by hash bucket of their cell: bucket b holds
+    // items_[bucketStart_[b] .. bucketStart_[b + 1]).  Cells that share a
+    // bucket are told apart by the box test in candidates().
+    size_t                bucketMask_ = 0;
+    std::vector<uint32_t> bucketStart_;
+    std::vector<int>      items_;
+    std::vector<size_t>   clusterBucket_;   // build scratch
+    std::vector<double>   widths_;          // build scratch
+};
+
+} // namespace cuas
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "association_engine.h"
+#include "assignment.h"
+#include "cluster_index.h"
 
 namespace cuas {
 
@@ -8,22 +10,38 @@ class GNNAssociator : public IAssociator {
 public:
     explicit GNNAssociator(const GNNConfig& cfg, double gatingThreshold);
 
-    AssociationOutput associate(
-        const std::vector<Track>& tracks,
-        const std::vector<Cluster>& clusters,
-        const IMMFilter& imm,
-        const MeasMatrix& R) override;
+    using IAssociator::associate;
+    void associate(const std::vector<InnovationStats>& tracks,
+                   const std::vector<Cluster>& clusters,
+                   AssociationOutput& out) override;
 
     std::string name() const override { return "GNN"; }
+    bool associateSingle(const InnovationStats& track, double d2,
+                         double& distance) const override;
 
 private:
-    // Auction-based or Hungarian assignment
-    std::vector<int> hungarianAssignment(
-        const std::vector<std::vector<double>>& costMatrix,
-        int numTracks, int numClusters) const;
+    // GNNSolver::Greedy: row/column reduction and greedy passes on the
+    // padded dense copy of dense_.
+    void greedyAssignment(int numTracks, int numClusters, std::vector<int>& assignment);
+
+    // GNNSolver::JonkerVolgenant: gated pairs only; fills assignment and cost.
+    void optimalAssignment(const std::vector<InnovationStats>& tracks,
+                           const std::vector<Cluster>& clusters,
+                           std::vector<int>& assignment, std::vector<double>& cost);
 
     GNNConfig config_;
     double gatingThreshold_;
+
+    ClusterIndex           index_;    // rebuilt each dwell
+    std::vector<int>       near_;     // index_ candidates of one track
+    SparseCostMatrix       sparse_;   // reused across dwells
+    SparseAssignmentSolver solver_;
+
+    // Per-dwell scratch, reused.  dense_ is the greedy solver's row-major
+    // numTracks x numClusters cost matrix, reduced_ its padded square copy.
+    std::vector<double>    dense_, reduced_, cost_;
+    std::vector<int>       assignment_;
+    std::vector<char>      colUsed_, clusterMatched_;
 };
 
 } // namespace cuas
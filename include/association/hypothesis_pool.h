@@ -0,0 +1,45 @@
+#pragma once
+
+/*
+ * FixedPool — fixed-capacity object pool for the MHT hypothesis tree.
+ *
+ * All storage is allocated by the constructor; acquire() and release() only
+ * move indices on a free list, so branching and pruning never reach the
+ * heap.  acquire() returns -1 once the pool is exhausted, which the caller
+ * treats as its node budget.
+ */
+
+#include <cstddef>
+#include <vector>
+
+namespace cuas {
+
+template <typename T>
+class FixedPool {
+public:
+    explicit FixedPool(size_t capacity) : items_(capacity) {
+        free_.reserve(capacity);
+        for (size_t i = capacity; i > 0; --i) free_.push_back(static_cast<int>(i - 1));
+    }
+
+    int acquire() {
+        if (free_.empty()) return -1;
+        int i = free_.back();
+        free_.pop_back();
+        items_[i] = T{};
+        return i;
+    }
+    void release(int i) { free_.push_back(i); }
+
+    T&       operator[](int i)       { return items_[i]; }
+    const T& operator[](int i) const { return items_[i]; }
+
+    size_t capacity() const { return items_.size(); }
+    size_t inUse()    const { return items_.size() - free_.size(); }
+
+private:
+    std::vector<T>   items_;
+    std::vector<int> free_;
+};
+
+} // namespace cuas
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "association_engine.h"
+#include "cluster_index.h"
 #include <vector>
 
 namespace cuas {
@@ -9,13 +10,14 @@ class JPDAAssociator : public IAssociator {
 public:
     explicit JPDAAssociator(const JPDAConfig& cfg, double gatingThreshold);
 
-    AssociationOutput associate(
-        const std::vector<Track>& tracks,
-        const std::vector<Cluster>& clusters,
-        const IMMFilter& imm,
-        const MeasMatrix& R) override;
+    using IAssociator::associate;
+    void associate(const std::vector<InnovationStats>& tracks,
+                   const std::vector<Cluster>& clusters,
+                   AssociationOutput& out) override;
 
     std::string name() const override { return "JPDA"; }
+    bool associateSingle(const InnovationStats& track, double d2,
+                         double& distance) const override;
 
     struct JPDAWeights {
         int trackIndex;
@@ -23,15 +25,38 @@ public:
         double betaZero; // probability of no detection
     };
 
+    // Exact JPDA betas for each component of tracks sharing gated
+    // measurements, by joint-event enumeration; components whose event count
+    // bound exceeds JPDAConfig::maxHypotheses (and lone tracks) get the
+    // per-track approximation.
     std::vector<JPDAWeights> computeWeights(
-        const std::vector<Track>& tracks,
-        const std::vector<Cluster>& clusters,
-        const IMMFilter& imm,
-        const MeasMatrix& R) const;
+        const std::vector<InnovationStats>& tracks,
+        const std::vector<Cluster>& clusters) const;
 
 private:
+    void marginalWeights(const std::vector<std::pair<int, double>>& gatedMeas,
+                         JPDAWeights& w) const;
+    bool exactWeights(const int* members, size_t n, size_t numClusters) const;
+    // computeWeights() into weights_[0 .. tracks.size()).
+    void fillWeights(const std::vector<InnovationStats>& tracks,
+                     const std::vector<Cluster>& clusters) const;
+
     JPDAConfig config_;
     double gatingThreshold_;
+
+    // Pre-gate scratch for computeWeights(), rebuilt on every call.
+    mutable ClusterIndex     index_;
+    mutable std::vector<int> near_;
+
+    // Weight scratch, reused across dwells.  The nested lists are kept at
+    // their high-water count so their capacity survives smaller dwells.
+    mutable std::vector<JPDAWeights> weights_;
+    mutable std::vector<std::vector<std::pair<int, double>>> gated_, options_;
+    mutable std::vector<std::vector<double>> acc_;
+    mutable std::vector<int>    parent_, firstTrack_, start_, members_;
+    mutable std::vector<size_t> choice_;
+    mutable std::vector<char>   used_;
+    std::vector<char>           matchedCluster_;
 };
 
 } // namespace cuas
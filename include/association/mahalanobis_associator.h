@@ -1,6 +1,7 @@
 #pragma once
 
 #include "association_engine.h"
+#include "cluster_index.h"
 
 namespace cuas {
 
@@ -8,17 +9,30 @@ class MahalanobisAssociator : public IAssociator {
 public:
     explicit MahalanobisAssociator(const MahalanobisConfig& cfg, double gatingThreshold);
 
-    AssociationOutput associate(
-        const std::vector<Track>& tracks,
-        const std::vector<Cluster>& clusters,
-        const IMMFilter& imm,
-        const MeasMatrix& R) override;
+    using IAssociator::associate;
+    void associate(const std::vector<InnovationStats>& tracks,
+                   const std::vector<Cluster>& clusters,
+                   AssociationOutput& out) override;
 
     std::string name() const override { return "Mahalanobis"; }
+    bool associateSingle(const InnovationStats& track, double d2,
+                         double& distance) const override;
 
 private:
     MahalanobisConfig config_;
     double gatingThreshold_;
+
+    struct Candidate {
+        int trackIdx, clusterIdx;
+        double distance;
+    };
+
+    ClusterIndex     index_;   // rebuilt each dwell
+    std::vector<int> near_;
+
+    // Per-dwell scratch, reused.
+    std::vector<Candidate> candidates_;
+    std::vector<char>      matchedTrack_, matchedCluster_;
 };
 
 } // namespace cuas
@@ -0,0 +1,130 @@
+#pragma once
+
+/*
+ * MHTAssociator — track-oriented multi-hypothesis association with a bounded
+ * hypothesis tree.
+ *
+ * The tracker commits one association per dwell (TrackManager updates every
+ * filter with it), so a hypothesis here is an alternative association
+ * history relative to the committed one.  It is carried as a per-track
+ * position offset: the difference between where the track would be had the
+ * hypothesis' measurements been used and where the committed filter put it,
+ * propagated through the position gain W = I - R S^-1.  Each dwell:
+ *
+ *   1. every leaf gates the clusters around its own shifted predictions
+ *      (zPred + offset) and builds its sparse cost matrix (d^2, miss at
+ *      MHTConfig::missCost);
+ *   2. the matrix is split into connected components, Murty's k-best runs
+ *      per component and the kBest cheapest joint assignments are combined
+ *      from the per-component lists;
+ *   3. the children are ranked by cumulative cost; the best one is reported
+ *      (and so committed), the others keep their offsets from it;
+ *   4. N-scan pruning drops children whose ancestor nScan dwells back is not
+ *      the best child's, duplicates (same offsets) are merged and at most
+ *      maxHypotheses leaves survive.
+ *
+ * Tree nodes come from a FixedPool of nodeBudget nodes and each leaf's
+ * offsets from a double-buffered arena of offsetBudget entries, both sized
+ * at construction; when either runs out the remaining children are
+ * dropped.  Per-dwell work is bounded by maxHypotheses * kBest Murty
+ * expansions over the gated pairs.
+ *
+ * The associator keys its state by track id and needs the dwell's R, both
+ * given through setDwellContext(); it is stateful and so not decomposable.
+ */
+
+#include "association_engine.h"
+#include "assignment.h"
+#include "cluster_index.h"
+#include "hypothesis_pool.h"
+#include "murty.h"
+#include <cstdint>
+#include <vector>
+
+namespace cuas {
+
+class MHTAssociator : public IAssociator {
+public:
+    MHTAssociator(const MHTConfig& cfg, double gatingThreshold);
+
+    using IAssociator::associate;
+    void associate(const std::vector<InnovationStats>& tracks,
+                   const std::vector<Cluster>& clusters,
+                   AssociationOutput& out) override;
+
+    std::string name() const override { return "MHT"; }
+
+    bool associateSingle(const InnovationStats& track, double d2,
+                         double& distance) const override;
+
+    void setDwellContext(const std::vector<uint32_t>& trackIds,
+                         const std::vector<MeasMatrix>& R) override;
+    bool decomposable() const override { return false; }
+
+    size_t liveNodes()  const { return nodes_.inUse(); }
+    size_t numLeaves()  const { return leaves_.size(); }
+
+private:
+    struct Node {
+        int parent = -1;
+        int refs   = 0;    // children plus one while a leaf
+    };
+    struct TrackOffset {
+        uint32_t   trackId;
+        MeasVector delta;
+    };
+    struct Leaf {
+        int    node;
+        double cost;       // cumulative, relative to the best leaf
+        int    first, count;   // offsets_[buffer][first .. first + count)
+    };
+    struct Child {
+        int    leaf;       // parent index into leaves_
+        double cost;
+        int    assign;     // childAssign_/childDist_ offset, one per track
+    };
+    // A joint pick of one ranked assignment per component.
+    struct Combo {
+        double cost;
+        int    last;       // component last advanced
+        int    picks;      // picks_ offset, one per component
+    };
+
+    void expandLeaf(int leaf, const std::vector<InnovationStats>& tracks,
+                    const std::vector<Cluster>& clusters);
+    void releaseNode(int node);
+    int  ancestor(int node, int steps) const;
+
+    MHTConfig config_;
+    double    gatingThreshold_;
+
+    // Dwell context.
+    std::vector<uint32_t> trackIds_;
+    std::vector<MeasMatrix> R_;             // per track
+
+    FixedPool<Node>          nodes_;
+    std::vector<Leaf>        leaves_, nextLeaves_;
+    std::vector<TrackOffset> offsets_[2];   // leaves_ use offsets_[cur_]
+    int                      cur_ = 0;
+
+    // Per-dwell scratch, reused.
+    ClusterIndex          index_;
+    std::vector<int>      near_;
+    std::vector<std::pair<uint32_t, int>> idToIndex_;
+    std::vector<MeasVector> delta_;         // current leaf's offsets, dense
+    std::vector<MeasMatrix> gain_;          // W per track
+    std::vector<Child>    children_;
+    std::vector<int>      childAssign_;
+    std::vector<double>   childDist_;
+    std::vector<int>      parent_, firstRow_, colLocal_, compRows_, compStart_;
+    SparseCostMatrix      leafCost_, compCost_;
+    KBestAssignmentSolver murty_;
+    std::vector<std::vector<RankedAssignment>> compBest_;
+    std::vector<int>      order_;
+    std::vector<TrackOffset> candidate_;
+    std::vector<char>     clusterMatched_;
+    std::vector<int>      fill_, localCols_, picks_, heap_;
+    std::vector<Combo>    combos_;
+};
+
+} // namespace cuas
@@ -0,0 +1,59 @@
+#pragma once
+
+/*
+ * k-best assignment (Murty, 1968) over a SparseCostMatrix.
+ *
+ * Same problem as SparseAssignmentSolver: each row takes one stored pair or
+ * its private miss at missCost, each column at most once.  The best
+ * assignment is found first; the remaining solution space is then split
+ * into disjoint subproblems, each forcing the rows before some row r to the
+ * parent's choice and excluding the parent's choice for r, and every
+ * subproblem is solved with SparseAssignmentSolver.  The cheapest open
+ * subproblem is the next-best assignment.  Up to k assignments cost at most
+ * k * rows solves, each on the sparse gated pairs.
+ */
+
+#include "assignment.h"
+#include <vector>
+
+namespace cuas {
+
+struct RankedAssignment {
+    double           cost = 0.0;   // sum of pair costs + missCost per unassigned row
+    std::vector<int> rowToCol;     // column of each row, or -1
+};
+
+class KBestAssignmentSolver {
+public:
+    // Fills out with up to k assignments in non-decreasing cost; fewer if the
+    // problem has fewer feasible assignments.
+    void solve(const SparseCostMatrix& C, double missCost, int k,
+               std::vector<RankedAssignment>& out);
+
+private:
+    // A subproblem's constraints are constraints_[first .. first + count).
+    struct Constraint { int row, col; bool forced; };   // col -1 = the row's miss
+    struct Node {
+        double cost;
+        int    first, count;
+        int    solution;   // offset of its rowToCol in solutions_
+    };
+
+    // Solves C under node constraints; false if infeasible.
+    bool solveNode(const SparseCostMatrix& C, double missCost, int first, int count,
+                   double& cost, std::vector<int>& rowToCol);
+
+    SparseAssignmentSolver  solver_;
+    SparseCostMatrix        sub_;
+    std::vector<double>     subMiss_;
+    std::vector<int>        forcedCol_, colForcedBy_;
+    std::vector<char>       missExcluded_;
+    std::vector<Constraint> constraints_;
+    std::vector<Node>       nodes_;
+    std::vector<int>        open_;        // heap of node indices, cheapest first
+    std::vector<int>        solutions_;   // every node's rowToCol, back to back
+    std::vector<int>        sol_, forcedSoFar_;
+    std::vector<char>       forced_;
+};
+
+} // namespace cuas
@@ -2,6 +2,8 @@
 
 #include "common/types.h"
 #include "common/config.h"
+#include "prediction/imm_filter.h"
+#include "association/cluster_index.h"
 #include <vector>
 #include <memory>
 
@@ -10,21 +12,92 @@ namespace cuas {
 class IClusterer {
 public:
     virtual ~IClusterer() = default;
-    virtual std::vector<Cluster> cluster(const std::vector<Detection>& dets) = 0;
+    // Replaces `out` with the clusters of `dets`, reusing its slots.
+    virtual void cluster(const std::vector<Detection>& dets, std::vector<Cluster>& out) = 0;
     virtual std::string name() const = 0;
+    // Whether a and b are close enough for this clusterer to put them in
+    // one cluster: neighbours, or within the gate.  Never true of two
+    // detections further than linkRange() apart in range.
+    virtual bool   linked(const Detection& a, const Detection& b) const = 0;
+    virtual double linkRange() const = 0;
+
+protected:
+    // Slot i of `out`, appended if needed.  Slots keep their
+    // detectionIndices capacity from earlier dwells.
+    Cluster& clusterSlot(std::vector<Cluster>& out, size_t i);
+    // Drops the slots from n on, parking their index buffers for later
+    // dwells instead of freeing them.
+    void trimClusters(std::vector<Cluster>& out, size_t n);
+    // Fills `c` from dets[indices[0 .. count)]: the member list plus the
+    // strength-weighted (linear power) centroid shared by every clusterer.
+    void buildCluster(const std::vector<Detection>& dets, const int* indices,
+                      size_t count, uint32_t id, Cluster& c);
+
+private:
+    std::vector<std::vector<uint32_t>> spareIndices_;
+    std::vector<double>                linStrength_;   // buildCluster scratch
 };
 
+// The serial clusterer for cfg.method.
+std::unique_ptr<IClusterer> makeClusterer(const ClusterConfig& cfg);
+
 class ClusterEngine {
 public:
     explicit ClusterEngine(const ClusterConfig& cfg);
 
+    // Switches to `cfg` from the next dwell on; cluster IDs carry on.
+    void reconfigure(const ClusterConfig& cfg);
+
+    // Fills `out`, reusing its capacity: once the dwell sizes have been
+    // seen, clustering allocates nothing.
+    void process(const std::vector<Detection>& dets, std::vector<Cluster>& out);
     std::vector<Cluster> process(const std::vector<Detection>& dets);
+
+    // Track-aided clustering, with the dwell's tracks already predicted:
+    // `gates` holds each track's gating statistics and `aiding` marks the
+    // tracks that claim detections.  A detection inside (d^2 <= gate) one
+    // aiding track's gate and no other's is that track's, unless the track
+    // shares another detection of its gate with an aiding track.  Each
+    // track's claimed detections are clustered on their own; if they form
+    // one cluster inside the gate and no other detection is linked to them,
+    // it goes to `aided`, with the track's index in `owner`.  Every other
+    // detection is clustered blind into `out`.  `out` and `aided` together
+    // hold the clusters process() would, with other clusterIds and order.
+    void processAided(const std::vector<Detection>& dets,
+                      const std::vector<InnovationStats>& gates,
+                      const std::vector<uint8_t>& aiding, double gate,
+                      std::vector<Cluster>& out, std::vector<Cluster>& aided,
+                      std::vector<int>& owner);
+
     std::string activeMethod() const;
 
 private:
+    // Clusters dets[indices[0 .. count)] with `clusterer` into `out`, the
+    // members mapped back to `dets` indices.
+    void clusterGroup(IClusterer& clusterer, const std::vector<Detection>& dets,
+                      const uint32_t* indices, size_t count, std::vector<Cluster>& out);
+    // processAided: whether no detection outside `track`'s claims
+    // dets[indices[0 .. count)] is linked to one of them.
+    bool isolated(const std::vector<Detection>& dets, int track,
+                  const uint32_t* indices, size_t count) const;
+
     std::unique_ptr<IClusterer> clusterer_;
+    std::unique_ptr<IClusterer> local_;   // processAided: one track's detections, serial
     ClusterConfig config_;
     uint32_t nextClusterId_ = 1;
+
+    // processAided scratch, reused per dwell.
+    ClusterIndex               index_;
+    std::vector<CartesianPos>  positions_;
+    std::vector<int>           claim_;      // per detection: track, -1 none, -2 shared
+    std::vector<uint8_t>       shared_;     // per track
+    std::vector<int>           near_;
+    std::vector<uint32_t>      blind_;      // detection indices
+    std::vector<uint32_t>      byTrack_;    // claimed detection indices, by track
+    std::vector<uint32_t>      trackStart_; // byTrack_ offsets, one past each track
+    std::vector<uint32_t>      byRange_;    // detection indices, ascending range
+    std::vector<Detection>     group_;      // clusterGroup's detections
+    std::vector<Cluster>       localOut_;
 };
 
 } // namespace cuas
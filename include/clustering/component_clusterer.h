@@ -0,0 +1,37 @@
+#pragma once
+
+#include "cluster_engine.h"
+#include <vector>
+
+namespace cuas {
+
+// Connected components of the gate graph: two detections are linked when
+// their range/azimuth/elevation offsets, each scaled by its gate, lie inside
+// the unit sphere (DBSCAN's neighbourhood), and a cluster is everything
+// reachable through such links.  Detections are sorted by range once and a
+// window of rangeGateSize is swept, merging linked pairs with union-find, so
+// the result does not depend on visiting order.  Same clusters, in the same
+// order, as DBSCAN with minPoints = 1 and epsilon = the gates.
+class ComponentClusterer : public IClusterer {
+public:
+    explicit ComponentClusterer(const ConnectedComponentsConfig& cfg);
+
+    void cluster(const std::vector<Detection>& dets, std::vector<Cluster>& out) override;
+    std::string name() const override { return "ConnectedComponents"; }
+    bool   linked(const Detection& a, const Detection& b) const override { return inGate(a, b); }
+    double linkRange() const override { return config_.rangeGateSize; }
+
+private:
+    bool inGate(const Detection& a, const Detection& b) const;
+    int  find(int i);
+    void unite(int a, int b);
+
+    ConnectedComponentsConfig config_;
+
+    // Per-dwell scratch, reused.  Cluster k's detections are
+    // members_[start_[k] .. start_[k + 1]).
+    std::vector<int>     sortedIdx_, parent_, labels_, start_, members_;
+    std::vector<uint8_t> rank_;
+};
+
+} // namespace cuas
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "cluster_engine.h"
+#include <array>
+#include <cstdint>
 #include <vector>
 
 namespace cuas {
@@ -9,17 +11,35 @@ class DBScanClusterer : public IClusterer {
 public:
     explicit DBScanClusterer(const DBScanConfig& cfg);
 
-    std::vector<Cluster> cluster(const std::vector<Detection>& dets) override;
+    void cluster(const std::vector<Detection>& dets, std::vector<Cluster>& out) override;
     std::string name() const override { return "DBSCAN"; }
+    bool   linked(const Detection& a, const Detection& b) const override { return distanceSq(a, b) <= 1.0; }
+    double linkRange() const override { return config_.epsilonRange; }
 
 private:
+    // Neighbour grid over (range, azimuth, elevation) scaled by epsilon, so
+    // a cell is one epsilon on each axis and every neighbour of a point lies
+    // in the 3x3x3 cells around its own.  Rebuilt once per dwell.
+    void buildGrid(const std::vector<Detection>& dets);
+    size_t bucketOf(int64_t ir, int64_t ia, int64_t ie) const;
     void rangeQuery(const std::vector<Detection>& dets, int idx,
                     std::vector<int>& neighbors) const;
-    double distance(const Detection& a, const Detection& b) const;
-    Cluster buildCluster(const std::vector<Detection>& dets,
-                         const std::vector<int>& indices, uint32_t id) const;
+    double distanceSq(const Detection& a, const Detection& b) const;
 
     DBScanConfig config_;
+
+    // Per-dwell scratch, reused.  Cluster k's detections are
+    // members_[start_[k] .. start_[k + 1]).
+    std::vector<int> labels_, neighbors_, seeds_, qNeighbors_;
+    std::vector<int> start_, members_;
+
+    // Detections grouped by hash bucket of their cell: bucket b holds
+    // gridItems_[bucketStart_[b] .. bucketStart_[b + 1]).  Cells sharing a
+    // bucket are told apart by cell_.
+    size_t                              bucketMask_ = 0;
+    std::vector<std::array<int64_t, 3>> cell_;
+    std::vector<uint32_t>               bucketStart_, bucketFill_;
+    std::vector<int>                    gridItems_;
 };
 
 } // namespace cuas
@@ -8,15 +8,19 @@ class RangeClusterer : public IClusterer {
 public:
     explicit RangeClusterer(const RangeBasedConfig& cfg);
 
-    std::vector<Cluster> cluster(const std::vector<Detection>& dets) override;
+    void cluster(const std::vector<Detection>& dets, std::vector<Cluster>& out) override;
     std::string name() const override { return "RangeBased"; }
+    bool   linked(const Detection& a, const Detection& b) const override { return inGate(a, b); }
+    double linkRange() const override { return config_.rangeGateSize; }
 
 private:
     bool inGate(const Detection& a, const Detection& b) const;
-    Cluster buildCluster(const std::vector<Detection>& dets,
-                         const std::vector<int>& indices, uint32_t id) const;
 
     RangeBasedConfig config_;
+
+    // Per-dwell scratch, reused.
+    std::vector<int>  sortedIdx_, group_;
+    std::vector<char> assigned_;
 };
 
 } // namespace cuas
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "cluster_engine.h"
+#include "common/worker_pool.h"
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cuas {
+
+// Clusters a dwell as ClusterConfig::sectors azimuth slices on a WorkerPool
+// and gives exactly the serial clusterer's output: the same clusters, members,
+// centroids and order, so ClusterEngine hands out the same clusterIds.
+//
+// DBSCAN and ConnectedComponents are defined by their gate graph, so slices
+// hold equal numbers of detections.  Each slice finds the neighbour pairs of
+// its own detections, looking one epsilon into the slices beside it, and
+// unites its core points.  A serial seam pass unites the core pairs that
+// cross a border and numbers the result as DBSCAN does: clusters by lowest
+// core index, a border point in the first cluster with a core neighbour, then
+// noise as singletons.
+//
+// RangeBased and RangeStrength gate greedily from range-ordered seeds, so a
+// cluster straddling a border would depend on the detections beyond it.
+// Their slices are cut only at azimuth gaps wider than the azimuth gate, which
+// no cluster can cross; each slice runs its own serial clusterer and the seam
+// pass orders the clusters by seed.  A dwell with too few such gaps uses
+// fewer slices.
+class SectorClusterer : public IClusterer {
+public:
+    explicit SectorClusterer(const ClusterConfig& cfg);
+
+    void cluster(const std::vector<Detection>& dets, std::vector<Cluster>& out) override;
+    std::string name() const override;
+    bool   linked(const Detection& a, const Detection& b) const override { return serial_[0]->linked(a, b); }
+    double linkRange() const override { return serial_[0]->linkRange(); }
+
+private:
+    struct Sector {
+        size_t begin = 0, end = 0;              // owned azOrder_ positions
+
+        // Gate-graph scratch: owned detections plus the halo, range order;
+        // neighbour pairs with an owned end; core pairs into a later slice.
+        std::vector<int>                 window;
+        std::vector<std::pair<int, int>> pairs, seams;
+
+        // Greedy scratch: the slice's detections in index order, their
+        // dwell indices, and the slice clusterer's output.
+        std::vector<Detection> dets;
+        std::vector<uint32_t>  index;
+        std::vector<Cluster>   clusters;
+    };
+
+    void sortByAzimuth(const std::vector<Detection>& dets);
+    void clusterGraph(const std::vector<Detection>& dets, std::vector<Cluster>& out);
+    void clusterSlices(const std::vector<Detection>& dets, std::vector<Cluster>& out);
+
+    void   findPairs(const std::vector<Detection>& dets, int s);
+    double distanceSq(const Detection& a, const Detection& b) const;
+    int    find(int i);
+    void   unite(int a, int b);
+
+    int  numSectors_;
+    bool greedy_;
+    double epsRange_ = 1.0, epsAzimuth_ = 1.0, epsElevation_ = 1.0;
+    int    minPoints_ = 1;
+    double azimuthGate_ = 0.0;   // greedy methods
+
+    // serial_[0] clusters small dwells; greedy methods use one per slice.
+    std::vector<std::unique_ptr<IClusterer>> serial_;
+    std::vector<Sector> sectors_;
+    WorkerPool          pool_;
+
+    // Per-dwell scratch, reused.  Cluster k's detections are
+    // members_[start_[k] .. start_[k + 1]).
+    std::vector<int>     azOrder_, sectorOf_, count_, parent_, labels_;
+    std::vector<int>     cuts_, start_, members_;
+    std::vector<uint8_t> core_, rank_;
+    std::vector<std::pair<int, int>> order_;   // (slice, cluster) by seed
+};
+
+} // namespace cuas
@@ -0,0 +1,63 @@
+#pragma once
+
+/*
+ * Heap allocation accounting per pipeline stage (instrumentation builds).
+ *
+ * Configured with -DCUAS_ALLOC_STATS=ON, alloc_stats.cpp replaces the global
+ * operator new, so every heap allocation in the process is counted, with
+ * the bytes requested, against the stage its thread is in.  StageTimer marks
+ * that stage, so the scopes are the latency histograms' own; with nested
+ * scopes the innermost stage is charged, and allocations outside any stage
+ * are not counted.  The counters are relaxed atomics and the current stage
+ * a thread_local, so the accounting itself never allocates or locks.
+ *
+ * Frees are not counted: the steady state we check for is zero allocations
+ * per dwell, and a free without a matching allocation cannot happen there.
+ *
+ * Without the option the functions are inline no-ops, allocCounts() reads
+ * zero and ALLOC_STATS_ENABLED is false.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cuas {
+
+constexpr size_t   ALLOC_MAX_STAGES = 32;
+constexpr uint32_t ALLOC_NO_STAGE   = 0xFFFFFFFFu;
+
+struct AllocCounts {
+    uint64_t count = 0;   // allocations since start
+    uint64_t bytes = 0;   // bytes they requested
+};
+
+#ifdef CUAS_ALLOC_STATS
+constexpr bool ALLOC_STATS_ENABLED = true;
+
+// Sets the calling thread's stage (an index below ALLOC_MAX_STAGES, or
+// ALLOC_NO_STAGE) and returns the previous one.
+uint32_t exchangeAllocStage(uint32_t stage);
+
+AllocCounts allocCounts(uint32_t stage);
+#else
+constexpr bool ALLOC_STATS_ENABLED = false;
+
+inline uint32_t    exchangeAllocStage(uint32_t) { return ALLOC_NO_STAGE; }
+inline AllocCounts allocCounts(uint32_t)        { return {}; }
+#endif
+
+// Charges the calling thread's allocations to `stage` for the scope's
+// lifetime, then restores the enclosing stage.
+class AllocStageScope {
+public:
+    explicit AllocStageScope(uint32_t stage) : prev_(exchangeAllocStage(stage)) {}
+    ~AllocStageScope() { exchangeAllocStage(prev_); }
+
+    AllocStageScope(const AllocStageScope&)            = delete;
+    AllocStageScope& operator=(const AllocStageScope&) = delete;
+
+private:
+    uint32_t prev_;
+};
+
+} // namespace cuas
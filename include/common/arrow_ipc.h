@@ -0,0 +1,101 @@
+#pragma once
+
+/*
+ * ArrowFileWriter — streams a table to an Arrow IPC file (Feather v2).
+ *
+ * The file is the Arrow columnar format that pyarrow.feather, pandas
+ * (read_feather) and polars load directly into typed columns.  Rows are
+ * appended one at a time and written out as a record batch every
+ * `batchRows` rows, so memory stays bounded however long the table; close()
+ * writes the footer that indexes the batches.
+ *
+ * Columns are unsigned 32/64-bit integers, doubles, or dictionary-encoded
+ * strings: the dictionary is fixed when the file is opened (an enum's
+ * names) and rows carry the code; a code outside the dictionary is null.
+ * Batches are uncompressed and little-endian.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace cuas {
+
+enum class ArrowType : uint8_t {
+    UInt32,
+    UInt64,
+    Float64,
+    Dictionary,     // int8 codes into ArrowColumn::dictionary
+};
+
+struct ArrowColumn {
+    std::string              name;
+    ArrowType                type = ArrowType::Float64;
+    std::vector<std::string> dictionary;    // Dictionary columns only
+};
+
+// One cell: an integer for UInt32, UInt64 and Dictionary columns, a double
+// for Float64 (each is converted if given the other).
+struct ArrowValue {
+    ArrowValue(uint32_t v) : u(v) {}
+    ArrowValue(uint64_t v) : u(v) {}
+    ArrowValue(double v)   : d(v), isDouble(true) {}
+
+    uint64_t u        = 0;
+    double   d        = 0.0;
+    bool     isDouble = false;
+};
+
+class ArrowFileWriter {
+public:
+    ArrowFileWriter() = default;
+    ~ArrowFileWriter();
+
+    ArrowFileWriter(const ArrowFileWriter&)            = delete;
+    ArrowFileWriter& operator=(const ArrowFileWriter&) = delete;
+
+    // Writes the schema and dictionaries.  Dictionaries hold at most 127 values.
+    bool open(const std::string& path, std::vector<ArrowColumn> columns,
+              size_t batchRows = 65536);
+    bool isOpen() const { return out_.is_open(); }
+
+    // Appends one row; `values` are in column order.
+    void append(std::initializer_list<ArrowValue> values);
+
+    // Writes the last batch and the footer.  False if any write failed.
+    bool close();
+
+    uint64_t rows() const { return rows_; }
+
+private:
+    struct Block {
+        int64_t offset;
+        int32_t metaDataLength;
+        int32_t pad;
+        int64_t bodyLength;
+    };
+    struct Column {
+        ArrowColumn          def;
+        std::vector<uint8_t> values;
+        std::vector<uint8_t> validity;      // Dictionary columns only
+        int64_t              nulls = 0;
+    };
+
+    void writeBatch();
+    void writeMessage(const std::vector<uint8_t>& meta, const std::vector<uint8_t>& body,
+                      std::vector<Block>* blocks);
+
+    std::ofstream       out_;
+    std::vector<Column> columns_;
+    size_t              batchRows_ = 0;
+    size_t              batchFill_ = 0;
+    uint64_t            rows_      = 0;
+    int64_t             pos_       = 0;
+    std::vector<Block>  dictionaryBlocks_;
+    std::vector<Block>  batchBlocks_;
+};
+
+} // namespace cuas
@@ -5,25 +5,113 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <map>
 
 namespace cuas {
 
+// Thread placement and memory residency, applied by TrackerPipeline::start.
+// Every setting is best-effort: a failure is logged and the tracker runs on.
+struct RealtimeConfig {
+    std::vector<int> pipelineCpus;     // pipeline threads take these round-robin; empty = unpinned
+    std::vector<int> ddsCpus;          // Fast DDS event/sender/receive threads (Fast DDS >= 2.12)
+    bool   schedFifo       = false;    // SCHED_FIFO for pipeline threads
+    int    schedPriority   = 50;       // 1..99
+    bool   lockMemory      = false;    // mlockall current + future mappings
+    int    prefaultHeapMB  = 0;        // heap touched and kept resident after mlockall
+};
+
+// Periodic TrackManager checkpoint for warm restart
+// (track_management/track_checkpoint.h).  On startup the newest image is
+// reloaded unless it is older than maxAgeMs at the first dwell.
+struct CheckpointConfig {
+    bool   enabled      = false;
+    std::string directory = "./checkpoint";
+    int    periodDwells = 10;
+    int    maxAgeMs     = 5000;
+};
+
 struct SystemConfig {
     int    cyclePeriodMs       = 100;
-    int    maxDetectionsPerDwell = 256;
-    int    maxTracks           = 200;
+    int    maxDetectionsPerDwell = 256;  // highest SNR kept; <= 0 = unlimited
+    int    maxTracks           = 200;  // initiation stops here; <= 0 = unlimited
     std::string logDirectory   = "./logs";
     bool   logEnabled          = true;
+    int    logRingKB           = 4096; // binary/text log record ring, per TrackManager
+    int    logBlockKB          = 1024; // v2 .bin LZ4 block size; 0 = v1 plain records
+    int    logIndexRecords     = 1000; // .idx sidecar granularity; 0 = no sidecar
+    CombinedTextMode combinedText = CombinedTextMode::Live;
+    int    logSegmentMB        = 0;    // new .bin segment past this size; 0 = one file
+    int    logSegmentSeconds   = 0;    // ... or after this long; 0 = never
+    int    logPreallocateMB    = 64;   // file space reserved ahead of the writes; 0 = none
+    LogSyncMode logSync        = LogSyncMode::None;
+    int    logSyncMs           = 1000; // logSync periodic/direct interval
     int    logLevel            = 3;
+    bool   consoleAsync        = true; // LOG_* lines written by a background thread
+    int    workerThreads       = 1;    // per-track IMM fan-out; 0 = all cores
+    RealtimeConfig realtime;
+    CheckpointConfig checkpoint;
+};
+
+// QoS of the DataWriters and DataReaders of one profile (by default the
+// topic name) in common/dds_participant.h.
+struct DdsQosProfile {
+    bool   reliable        = true;    // false = best effort
+    int    historyDepth    = 1;       // KEEP_LAST depth; 0 = KEEP_ALL
+    int    maxSamples      = 0;       // resource limits; 0 = Fast DDS default
+    int    maxInstances    = 0;
+    int    maxSamplesPerInstance = 0;
+    bool   preallocate     = false;   // allocate the whole history up front
+    bool   dataSharing     = false;   // data sharing even if DdsConfig::dataSharing is off
+};
+
+// Built-in profiles: debug topics best effort keep-last 1, tracks reliable.
+std::map<std::string, DdsQosProfile> defaultDdsQosProfiles();
+
+struct DdsConfig {
+    bool   sharedMemory    = true;    // SHM transport for same-host peers (UDPv4 always)
+    int    shmSegmentKB    = 0;       // SHM segment per participant; 0 = Fast DDS default
+    bool   dataSharing     = false;   // data-sharing delivery to same-host readers
+    // Also publish/subscribe the plain SPDetectionFrame / TrackTableFrame
+    // topics through loans: no serialization between same-host peers.
+    bool   zeroCopy        = false;
+    std::map<std::string, DdsQosProfile> qos = defaultDdsQosProfiles();
+
+    // The named profile; unknown names get DdsQosProfile defaults.
+    DdsQosProfile profile(const std::string& name) const {
+        auto it = qos.find(name);
+        return it != qos.end() ? it->second : DdsQosProfile();
+    }
+};
+
+// Raw UDP ingest (network.ingest "udp"), receiver/udp_detection_receiver.h.
+struct UdpIngestConfig {
+    int      batch    = 32;    // datagrams per recvmmsg() call
+    int      threads  = 1;     // receive threads; > 1 share the port via SO_REUSEPORT
+    uint32_t sensorId = 0;     // stamped on every dwell; the datagrams carry none
 };
 
 struct NetworkConfig {
-    std::string receiverIp     = "0.0.0.0";
-    int    receiverPort        = 50000;
+    IngestBackend ingest       = IngestBackend::Dds;
+    std::string receiverIp     = "0.0.0.0";      // UDP ingest bind address
+    int    receiverPort        = 50000;          // UDP ingest port
     std::string senderIp       = "127.0.0.1";
     int    senderPort          = 50001;
-    int    receiveBufferSize   = 65536;
+    int    receiveBufferSize   = 8 << 20;        // UDP ingest SO_RCVBUF, bytes
     int    sendBufferSize      = 65536;
+    UdpIngestConfig udp;
+    DdsConfig dds;
+};
+
+// Learned clutter map (preprocessing/clutter_map.h).  Cells tile the
+// preprocessing window, with elevation capped at maxElevation.
+struct ClutterMapConfig {
+    bool   enabled       = false;
+    double rangeCell     = 50.0;   // m
+    double azimuthCell   = 0.01;   // rad
+    double elevationCell = 0.02;   // rad
+    double maxElevation  = 0.1;    // rad; clutter is mapped below this only
+    double alpha         = 0.05;   // per-dwell weight of the hit average
+    double threshold     = 0.5;    // average at which a cell is suppressed
 };
 
 struct PreprocessConfig {
@@ -39,6 +127,7 @@ struct PreprocessConfig {
     double maxRCS       = 20.0;
     double minStrength  = -100.0;
     double maxStrength  = 0.0;
+    ClutterMapConfig clutterMap;
 };
 
 struct DBScanConfig {
@@ -61,17 +150,42 @@ struct RangeStrengthConfig {
     double strengthGateSize  = 6.0;
 };
 
+// Gates of the connected-components clusterer; together they scale the
+// ellipsoid two linked detections must lie within.
+struct ConnectedComponentsConfig {
+    double rangeGateSize     = 50.0;
+    double azimuthGateSize   = 0.02;
+    double elevationGateSize = 0.02;
+};
+
 struct ClusterConfig {
     ClusterMethod method = ClusterMethod::DBSCAN;
     DBScanConfig dbscan;
     RangeBasedConfig rangeBased;
     RangeStrengthConfig rangeStrength;
+    ConnectedComponentsConfig connectedComponents;
+    // Azimuth sectors clustered in parallel (clustering/sector_clusterer.h),
+    // one thread each; 1 clusters the whole dwell on the calling thread.
+    int sectors = 1;
+    // Track-aided clustering (ClusterEngine::processAided): predict first,
+    // cluster the detections in each confirmed track's gate on their own and
+    // only the rest blind.  Serial pipeline only.
+    bool trackAided = false;
 };
 
 struct IMMConfig {
     int numModels = 5;
     std::array<double, IMM_NUM_MODELS> initialModeProbabilities = {0.4, 0.15, 0.15, 0.15, 0.15};
     std::array<std::array<double, IMM_NUM_MODELS>, IMM_NUM_MODELS> transitionMatrix;
+    IMMPrecision precision = IMMPrecision::Double;   // "double" | "float"
+    CovarianceUpdate covarianceUpdate = CovarianceUpdate::Joseph;   // "joseph" | "bierman"
+    // Model pruning: a model whose mode probability falls below pruneFloor
+    // is frozen (probability 0, not mixed, predicted or updated) until its
+    // Markov prior reaches reactivatePrior or every active model's
+    // innovation d^2 exceeds reactivateGate.  pruneFloor = 0 disables it.
+    double pruneFloor      = 0.0;
+    double reactivatePrior = 0.1;
+    double reactivateGate  = 11.34;   // chi-square, 3 dof, 99%
 };
 
 struct CVConfig {
@@ -102,21 +216,45 @@ struct MahalanobisConfig {
 };
 
 struct GNNConfig {
-    double costThreshold = 16.0;
+    double costThreshold = 16.0;   // also the cost of leaving a track unassigned
+    GNNSolver solver     = GNNSolver::JonkerVolgenant;   // "jv" | "greedy"
 };
 
 struct JPDAConfig {
     double gateSize             = 16.0;
     double clutterDensity       = 1e-6;
     double detectionProbability = 0.9;
+    double maxHypotheses        = 10000;  // joint-event budget per component; over it, per-track weights
+};
+
+struct MHTConfig {
+    int    kBest         = 3;      // assignments expanded per hypothesis per dwell
+    int    nScan         = 3;      // dwells after which branches must share the best's ancestor
+    int    maxHypotheses = 8;      // leaves kept per dwell
+    int    nodeBudget    = 256;    // hypothesis tree node pool
+    int    offsetBudget  = 4096;   // per-track position offsets across the leaves
+    double missCost      = 16.0;   // cost of a track taking no measurement
+};
+
+// Sensor accuracy behind the measurement noise R.  Each track's R is this
+// spherical error converted to Cartesian at the track's predicted position,
+// for its gate and its update, so cross-range noise grows with the track's
+// own range and lies across the line of sight.
+struct MeasurementNoiseConfig {
+    double rangeSigma         = 10.0;    // m
+    double angleSigma         = 0.005;   // rad, azimuth and elevation
+    double minCrossRangeSigma = 0.0;     // m, floor on r * angleSigma (0 = none)
 };
 
 struct AssociationConfig {
     AssociationMethod method = AssociationMethod::GNN;
     double gatingThreshold  = 16.0;
+    bool   decompose        = true;   // solve gated connected components separately
+    MeasurementNoiseConfig measurementNoise;
     MahalanobisConfig mahalanobis;
     GNNConfig gnn;
     JPDAConfig jpda;
+    MHTConfig mht;
 };
 
 struct InitiationConfig {
@@ -148,20 +286,99 @@ struct InitialCovarianceConfig {
     double accelerationStd = 5.0;
 };
 
+// Lazy prediction: a tentative or coasting track that has missed
+// afterMisses dwells in a row skips the IMM predict.  It reports a CV
+// extrapolation of its last estimate instead, and owes the predicts until
+// a cluster falls inside that extrapolation's gate, widened for a target
+// accelerating at up to maxAccel.
+struct LazyPredictionConfig {
+    bool   enabled     = false;
+    int    afterMisses = 1;
+    double maxAccel    = 20.0;    // m/s^2
+};
+
 struct TrackManagementConfig {
     InitiationConfig       initiation;
     MaintenanceConfig      maintenance;
     DeletionConfig         deletion;
     InitialCovarianceConfig initialCovariance;
+    LazyPredictionConfig   lazyPrediction;
 };
 
+// Track output.  By default every dwell publishes the whole TrackTable.
+// With deltaPublish, tracks go out instead as keyed "TrackUpdate" instances:
+// a track is re-sent when it moves more than deltaPositionM, its velocity
+// changes by more than deltaVelocityMps, or its status or classification
+// changes, and every track is re-sent each updateRateMs.
 struct DisplayConfig {
-    int  updateRateMs     = 200;
+    int  updateRateMs     = 200;     // full refresh period (deltaPublish)
     bool sendDeletedTracks = true;
+    bool asyncPublish      = false;  // DDS writes on a TrackSender thread
+    bool   deltaPublish     = false;
+    double deltaPositionM   = 10.0;  // m, from the last sample sent
+    double deltaVelocityMps = 2.0;   // m/s, from the last sample sent
+    int    rawDetectionEvery = 1;    // forward every Nth dwell on SPDetectionDisplay; 0 = none
+};
+
+// Overload controller: degrade in steps when dwells overrun cyclePeriodMs
+// or the ingest ring backs up, recover with hysteresis.
+//   1 — stop ClusterTable / PredictedTable / AssocTable debug topics
+//   2 — stop combined_track_flow.dat text logging
+//   3 — JPDA falls back to GNN
+//   4 — preprocessing SNR floor raised to degradedMinSNR
+struct LoadShedConfig {
+    bool   enabled            = false;
+    int    maxLevel           = 4;
+    double overrunRatio       = 1.0;   // overloaded if cycle > ratio * period
+    double recoverRatio       = 0.6;   // healthy if cycle < ratio * period
+    int    queueDepthHigh     = 4;     // overloaded if ingest depth >= this
+    int    degradeAfterDwells = 3;     // consecutive overloaded dwells per step down
+    int    recoverAfterDwells = 50;    // consecutive healthy dwells per step up
+    double degradedMinSNR     = 14.0;  // dB, level 4
+};
+
+struct PipelineConfig {
+    bool pipelined       = false;  // run stage groups on dedicated threads
+    int  stageQueueDepth = 4;      // dwells buffered between stage groups
+    int  ingestQueueCapacity = 32; // DDS → pipeline ring (rounded up to 2^n)
+    OverloadPolicy overloadPolicy = OverloadPolicy::DropOldest;
+    int  catchUpThreshold = 0;     // queued dwells that start catch-up; 0 = off
+    LoadShedConfig loadShed;
+
+    // Radar faces hosted by this process, one TrackManager lane each, keyed
+    // by SPDetectionMessage::sensorId.  Empty = one lane that accepts every
+    // dwell regardless of sensorId (single-face sites).
+    std::vector<uint32_t> sensorIds;
+};
+
+// Distributed mode (track_management/sector_map.h, pipeline/sector_handover.h):
+// several tracker nodes split the coverage into azimuth/range sectors.  A
+// node tracks only detections within overlapM of its own sector, hands a
+// track with its full IMM state to the sector's owner once the track is
+// handoverM outside its own, and drops whichever of two tracks on one
+// target within dedupGateM has fewer hits.  Its dwells are selected with a
+// DDS content filter on pipeline.sensorIds.
+struct SectorConfig {
+    uint32_t nodeId    = 0;
+    double   azMinDeg  = -180.0;   // clockwise from azMinDeg to azMaxDeg; may wrap
+    double   azMaxDeg  = 180.0;
+    double   minRange  = 0.0;      // m
+    double   maxRange  = 1.0e9;    // m
+};
+
+struct DistributedConfig {
+    bool     enabled    = false;
+    uint32_t nodeId     = 0;       // this process; selects the track ID block
+    std::vector<SectorConfig> sectors;   // every node's, this one's included
+    double   overlapM   = 300.0;   // detections kept this far outside the sector
+    double   handoverM  = 150.0;   // tracks handed over this far outside it
+    double   dedupGateM = 50.0;    // same target if closer than this
+    bool     contentFilter = true; // DDS-side sensorId / toNode filters
 };
 
 struct TrackerConfig {
     SystemConfig          system;
+    PipelineConfig        pipeline;
     NetworkConfig         network;
     PreprocessConfig      preprocessing;
     ClusterConfig         clustering;
@@ -169,10 +386,16 @@ struct TrackerConfig {
     AssociationConfig     association;
     TrackManagementConfig trackManagement;
     DisplayConfig         display;
+    DistributedConfig     distributed;
 };
 
 TrackerConfig loadConfig(const std::string& filepath);
 
+/** Sanity checks on the tuning sections a hot reload swaps in (see
+ *  TrackManager::reconfigure) and, at startup, on the sensor and node IDs
+ *  track IDs are numbered from; empty if usable, else the first problem. */
+std::string validateConfig(const TrackerConfig& cfg);
+
 /** Build a multi-line string describing algorithms and models used (for run headers). */
 std::string getRunInfoString(const TrackerConfig& cfg);
 
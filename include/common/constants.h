@@ -32,6 +32,9 @@ static constexpr uint32_t MSG_ID_TRACK_TABLE     = CounterUAS::MSG_ID_TRACK_TABL
 static constexpr uint32_t MSG_ID_CLUSTER_TABLE   = CounterUAS::MSG_ID_CLUSTER_TABLE;
 static constexpr uint32_t MSG_ID_ASSOC_TABLE     = CounterUAS::MSG_ID_ASSOC_TABLE;
 static constexpr uint32_t MSG_ID_PREDICTED_TABLE = CounterUAS::MSG_ID_PREDICTED_TABLE;
+static constexpr uint32_t MSG_ID_PIPELINE_STATS  = CounterUAS::MSG_ID_PIPELINE_STATS;
+static constexpr uint32_t MSG_ID_TRACKER_HEALTH  = CounterUAS::MSG_ID_TRACKER_HEALTH;
+static constexpr uint32_t MSG_ID_TRACK_HANDOVER  = CounterUAS::MSG_ID_TRACK_HANDOVER;
 
 // Static asserts: if IDL values ever change these will catch it at build time.
 static_assert(MSG_ID_SP_DETECTION    == 0x0001u, "IDL MSG_ID_SP_DETECTION mismatch");
@@ -40,20 +43,50 @@ static_assert(MSG_ID_TRACK_TABLE     == 0x0003u, "IDL MSG_ID_TRACK_TABLE mismatc
 static_assert(MSG_ID_CLUSTER_TABLE   == 0x0010u, "IDL MSG_ID_CLUSTER_TABLE mismatch");
 static_assert(MSG_ID_ASSOC_TABLE     == 0x0011u, "IDL MSG_ID_ASSOC_TABLE mismatch");
 static_assert(MSG_ID_PREDICTED_TABLE == 0x0012u, "IDL MSG_ID_PREDICTED_TABLE mismatch");
+static_assert(MSG_ID_PIPELINE_STATS  == 0x0020u, "IDL MSG_ID_PIPELINE_STATS mismatch");
+static_assert(MSG_ID_TRACKER_HEALTH  == 0x0021u, "IDL MSG_ID_TRACKER_HEALTH mismatch");
+static_assert(MSG_ID_TRACK_HANDOVER  == 0x0030u, "IDL MSG_ID_TRACK_HANDOVER mismatch");
 
 // ---------------------------------------------------------------------------
-// Capacity limits (not wire-protocol, no IDL counterpart)
+// Capacity limits; also the capacities of the zero-copy frame types
 // ---------------------------------------------------------------------------
 static constexpr int MAX_DETECTIONS_PER_DWELL = 256;
 static constexpr int MAX_TRACKS               = 200;
+static_assert(CounterUAS::FRAME_MAX_DETECTIONS == MAX_DETECTIONS_PER_DWELL,
+              "IDL FRAME_MAX_DETECTIONS mismatch");
+static_assert(CounterUAS::FRAME_MAX_TRACKS == MAX_TRACKS, "IDL FRAME_MAX_TRACKS mismatch");
 static constexpr int IMM_NUM_MODELS           = 5;
 
+// Track IDs are allocated in per-sensor blocks so that faces sharing one
+// process never hand out the same ID: sensor N starts at N * block + 1.
+static constexpr uint32_t TRACK_ID_BLOCK_PER_SENSOR = 100000;
+// In distributed mode each node gets a block of sensor blocks on top, so a
+// track handed to another node keeps an ID no node will ever reissue.
+// Node 0 keeps the single-node IDs.
+static constexpr uint32_t TRACK_ID_SENSORS_PER_NODE = 100;
+static constexpr uint32_t TRACK_ID_BLOCK_PER_NODE   = TRACK_ID_SENSORS_PER_NODE * TRACK_ID_BLOCK_PER_SENSOR;
+// The last node whose whole block fits in a uint32_t ID.
+static constexpr uint32_t TRACK_ID_MAX_NODE         = UINT32_MAX / TRACK_ID_BLOCK_PER_NODE - 1;
+
 // DDS topic names — must match the topic names used in publisher and subscriber
 // create calls (dds_participant.h).
 static constexpr const char* TOPIC_SP_DETECTION    = "SPDetection";
 static constexpr const char* TOPIC_TRACK_TABLE     = "TrackTable";
+static constexpr const char* TOPIC_TRACK_UPDATE    = "TrackUpdate";
 static constexpr const char* TOPIC_CLUSTER_TABLE   = "ClusterTable";
 static constexpr const char* TOPIC_ASSOC_TABLE     = "AssocTable";
 static constexpr const char* TOPIC_PREDICTED_TABLE = "PredictedTable";
+static constexpr const char* TOPIC_PIPELINE_STATS  = "PipelineStats";
+static constexpr const char* TOPIC_TRACKER_HEALTH  = "TrackerHealth";
+// Raw dwells forwarded for display (display.rawDetectionEvery); kept off the
+// input topic so the tracker never hears its own forward.
+static constexpr const char* TOPIC_SP_DETECTION_DISPLAY = "SPDetectionDisplay";
+// Plain fixed-size variants for loans / data sharing (network.dds.zeroCopy).
+static constexpr const char* TOPIC_SP_DETECTION_FRAME = "SPDetectionFrame";
+static constexpr const char* TOPIC_TRACK_TABLE_FRAME  = "TrackTableFrame";
+// Distributed mode: node-to-node track handover, and the track picture the
+// track_aggregator merges from every node's TrackTable.
+static constexpr const char* TOPIC_TRACK_HANDOVER         = "TrackHandover";
+static constexpr const char* TOPIC_AGGREGATED_TRACK_TABLE = "AggregatedTrackTable";
 
 } // namespace cuas
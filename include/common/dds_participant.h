@@ -9,9 +9,20 @@
  *   CuasDdsParticipant  – RAII wrapper around a DomainParticipant plus its
  *                          Publisher and Subscriber.  Owns all DDS entities.
  *
- *   makeWriter<T>()     – create a strongly-typed DataWriter for topic T.
+ *   makeWriter<T>()     – create a strongly-typed DataWriter for topic T
+ *                          with an optional DataWriterListener.
  *   makeReader<T>()     – create a strongly-typed DataReader for topic T
  *                          with an optional DataReaderListener.
+ *   makeFilteredReader<T>() – as makeReader<T>(), through a content filter.
+ *
+ * Writers and readers take their QoS from DdsConfig::profile(): the topic
+ * name's profile unless another profile is named.  A topic used by several
+ * entities of one participant is created once and shared.
+ *
+ *   loanSample<T>()     – borrow a sample from a writer's pool, fill it in
+ *                          place and write() it: no copy, and for the plain
+ *                          frame types over data sharing no serialization.
+ *   takeLoaned<T>()     – take samples as loans and visit them in place.
  *
  * Usage (producer side):
  *
@@ -32,7 +43,9 @@
 
 #include "messages.h"
 #include "messagesPubSubTypes.h"
+#include "common/config.h"
 
+#include <fastdds/dds/core/LoanableSequence.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/publisher/Publisher.hpp>
@@ -41,22 +54,28 @@
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 namespace cuas {
 
 // ---------------------------------------------------------------------------
 // Trait: maps a generated IDL struct type to its PubSubType class.
-// Specialisations for all five topics are defined below.
+// Specialisations for all topics are defined below.
 // ---------------------------------------------------------------------------
 template <typename T>
 struct DdsPubSubType;
 
 template<> struct DdsPubSubType<CounterUAS::SPDetectionMessage> {
     using type = CounterUAS::SPDetectionMessagePubSubType; };
+template<> struct DdsPubSubType<CounterUAS::TrackUpdateMessage> {
+    using type = CounterUAS::TrackUpdateMessagePubSubType; };
 template<> struct DdsPubSubType<CounterUAS::TrackTableMessage> {
     using type = CounterUAS::TrackTableMessagePubSubType; };
 template<> struct DdsPubSubType<CounterUAS::ClusterTableMessage> {
@@ -65,65 +84,162 @@ template<> struct DdsPubSubType<CounterUAS::AssocTableMessage> {
     using type = CounterUAS::AssocTableMessagePubSubType; };
 template<> struct DdsPubSubType<CounterUAS::PredictedTableMessage> {
     using type = CounterUAS::PredictedTableMessagePubSubType; };
+template<> struct DdsPubSubType<CounterUAS::PipelineStatsMessage> {
+    using type = CounterUAS::PipelineStatsMessagePubSubType; };
+template<> struct DdsPubSubType<CounterUAS::TrackerHealthMessage> {
+    using type = CounterUAS::TrackerHealthMessagePubSubType; };
+template<> struct DdsPubSubType<CounterUAS::SPDetectionFrame> {
+    using type = CounterUAS::SPDetectionFramePubSubType; };
+template<> struct DdsPubSubType<CounterUAS::TrackTableFrame> {
+    using type = CounterUAS::TrackTableFramePubSubType; };
+template<> struct DdsPubSubType<CounterUAS::TrackHandoverMessage> {
+    using type = CounterUAS::TrackHandoverMessagePubSubType; };
+
+// Borrows a sample from `writer`'s history pool.  Fill it in place, then
+// writer->write() it (which returns the loan) or writer->discard_loan() it.
+// nullptr when the writer cannot loan: the type is not plain, or every
+// pooled sample is still in use.
+template <typename T>
+T* loanSample(eprosima::fastdds::dds::DataWriter* writer) {
+    void* sample = nullptr;
+    if (writer->loan_sample(sample) != eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK)
+        return nullptr;
+    return static_cast<T*>(sample);
+}
+
+// Takes every available sample of `reader` as a loan and calls
+// fn(const T&, const SampleInfo&) on each valid one before returning the
+// loans.  For plain types over data sharing the sample is read straight
+// from the writer's shared memory.  Returns the number of valid samples.
+template <typename T, typename Fn>
+size_t takeLoaned(eprosima::fastdds::dds::DataReader* reader, Fn&& fn) {
+    eprosima::fastdds::dds::LoanableSequence<T>  data;
+    eprosima::fastdds::dds::SampleInfoSeq        infos;
+    size_t valid = 0;
+    while (reader->take(data, infos) == eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK) {
+        for (eprosima::fastdds::dds::LoanableCollection::size_type i = 0; i < infos.length(); ++i) {
+            if (!infos[i].valid_data) continue;
+            fn(data[i], infos[i]);
+            ++valid;
+        }
+        reader->return_loan(data, infos);
+    }
+    return valid;
+}
 
 // ---------------------------------------------------------------------------
 // CuasDdsParticipant
 // ---------------------------------------------------------------------------
 class CuasDdsParticipant {
 public:
-    explicit CuasDdsParticipant(uint8_t domainId = 0);
+    // `threadAffinityMask` (bit n = CPU n, 0 = unpinned) is applied to the
+    // threads Fast DDS creates for this participant: timed events, the
+    // built-in flow-controller sender, discovery and the UDP/SHM receive
+    // threads.  Needs Fast DDS 2.12+; older versions log a warning.
+    // `dds` picks the transports (SHM + UDPv4, or UDPv4 alone), data sharing
+    // and the per-topic QoS profiles.
+    explicit CuasDdsParticipant(uint8_t domainId = 0, uint64_t threadAffinityMask = 0,
+                                const DdsConfig& dds = DdsConfig());
     ~CuasDdsParticipant();
 
+    const DdsConfig& config() const { return dds_; }
+
     CuasDdsParticipant(const CuasDdsParticipant&)            = delete;
     CuasDdsParticipant& operator=(const CuasDdsParticipant&) = delete;
 
-    // Register type + create topic + create DataWriter.
+    // Register type + find or create topic + create DataWriter (optional
+    // listener).  An empty `qosProfile` means the topic's own profile.
     template <typename T>
-    eprosima::fastdds::dds::DataWriter* makeWriter(const std::string& topicName) {
-        using PST = typename DdsPubSubType<T>::type;
-        eprosima::fastdds::dds::TypeSupport ts(new PST());
-        ts.register_type(participant_);
-
-        auto* topic = participant_->create_topic(
-            topicName, ts->getName(),
-            eprosima::fastdds::dds::TOPIC_QOS_DEFAULT);
-        if (!topic)
-            throw std::runtime_error("DDS: create_topic failed for " + topicName);
-
+    eprosima::fastdds::dds::DataWriter* makeWriter(
+            const std::string& topicName,
+            const std::string& qosProfile = std::string(),
+            eprosima::fastdds::dds::DataWriterListener* listener = nullptr) {
+        auto* topic = topicFor<T>(topicName);
         auto* writer = publisher_->create_datawriter(
-            topic, eprosima::fastdds::dds::DATAWRITER_QOS_DEFAULT);
+            topic, writerQos(qosProfile.empty() ? topicName : qosProfile), listener);
         if (!writer)
             throw std::runtime_error("DDS: create_datawriter failed for " + topicName);
         return writer;
     }
 
-    // Register type + create topic + create DataReader (optional listener).
+    // Register type + find or create topic + create DataReader (optional
+    // listener).  An empty `qosProfile` means the topic's own profile.
     template <typename T>
     eprosima::fastdds::dds::DataReader* makeReader(
             const std::string& topicName,
-            eprosima::fastdds::dds::DataReaderListener* listener = nullptr) {
+            eprosima::fastdds::dds::DataReaderListener* listener = nullptr,
+            const std::string& qosProfile = std::string()) {
+        auto* topic = topicFor<T>(topicName);
+        auto* reader = subscriber_->create_datareader(
+            topic, readerQos(qosProfile.empty() ? topicName : qosProfile), listener);
+        if (!reader)
+            throw std::runtime_error("DDS: create_datareader failed for " + topicName);
+        return reader;
+    }
+
+    // As makeReader, but through a ContentFilteredTopic with the default
+    // DDS-SQL filter: only samples matching `expression` (e.g.
+    // "sensorId = %0 OR sensorId = %1") reach the reader, and writers that
+    // filter on their side do not even send the rest.  The filter needs the
+    // type's TypeObject (fastddsgen -typeobject); if it cannot be created the
+    // reader takes the whole topic, so callers must still check what they
+    // get.  `filtered`, if given, says which happened.
+    template <typename T>
+    eprosima::fastdds::dds::DataReader* makeFilteredReader(
+            const std::string& topicName,
+            const std::string& expression,
+            const std::vector<std::string>& parameters,
+            eprosima::fastdds::dds::DataReaderListener* listener = nullptr,
+            bool* filtered = nullptr) {
+        auto* topic = topicFor<T>(topicName);
+        eprosima::fastdds::dds::TopicDescription* source = topic;
+        if (!expression.empty()) {
+            if (auto* cft = filteredTopic(topic, expression, parameters)) source = cft;
+        }
+        if (filtered) *filtered = source != topic;
+        auto* reader = subscriber_->create_datareader(source, readerQos(topicName), listener);
+        if (!reader)
+            throw std::runtime_error("DDS: create_datareader failed for " + topicName);
+        return reader;
+    }
+
+private:
+    // One ContentFilteredTopic per call, named after the topic; nullptr
+    // (logged) if the filter is rejected.
+    eprosima::fastdds::dds::ContentFilteredTopic* filteredTopic(
+            eprosima::fastdds::dds::Topic* topic, const std::string& expression,
+            const std::vector<std::string>& parameters);
+
+    // create_topic fails for a name this participant already has, so a
+    // second writer or reader of a topic reuses the first one's Topic.
+    template <typename T>
+    eprosima::fastdds::dds::Topic* topicFor(const std::string& topicName) {
         using PST = typename DdsPubSubType<T>::type;
         eprosima::fastdds::dds::TypeSupport ts(new PST());
         ts.register_type(participant_);
 
+        if (auto* existing = participant_->lookup_topicdescription(topicName)) {
+            auto* topic = dynamic_cast<eprosima::fastdds::dds::Topic*>(existing);
+            if (!topic || topic->get_type_name() != ts->getName())
+                throw std::runtime_error("DDS: topic " + topicName + " exists with another type");
+            return topic;
+        }
         auto* topic = participant_->create_topic(
             topicName, ts->getName(),
             eprosima::fastdds::dds::TOPIC_QOS_DEFAULT);
         if (!topic)
             throw std::runtime_error("DDS: create_topic failed for " + topicName);
-
-        eprosima::fastdds::dds::DataReaderQos qos =
-            eprosima::fastdds::dds::DATAREADER_QOS_DEFAULT;
-        auto* reader = subscriber_->create_datareader(topic, qos, listener);
-        if (!reader)
-            throw std::runtime_error("DDS: create_datareader failed for " + topicName);
-        return reader;
+        return topic;
     }
 
-private:
+    eprosima::fastdds::dds::DataWriterQos writerQos(const std::string& profile) const;
+    eprosima::fastdds::dds::DataReaderQos readerQos(const std::string& profile) const;
+
+    DdsConfig                                  dds_;
     eprosima::fastdds::dds::DomainParticipant* participant_ = nullptr;
     eprosima::fastdds::dds::Publisher*         publisher_   = nullptr;
     eprosima::fastdds::dds::Subscriber*        subscriber_  = nullptr;
+    int                                        numFiltered_ = 0;   // ContentFilteredTopic names
 };
 
 } // namespace cuas
@@ -0,0 +1,230 @@
+#pragma once
+
+/*
+ * Always-on stage latency instrumentation.
+ *
+ * LatencyHistogram is an HDR-style log-linear histogram over nanoseconds:
+ * each power of two is split into 16 linear sub-buckets, so any reported
+ * percentile is within ~6% of the true value from 1 ns up to ~18 minutes.
+ * record() is a handful of relaxed atomic ops and never locks, so stages on
+ * different pipeline threads can feed histograms while another thread reads
+ * them.
+ *
+ * StageTimings holds one histogram per PipelineStage; StageTimer is the RAII
+ * probe placed around a stage.  A null StageTimings* turns the probe into a
+ * no-op, so components work unchanged when nobody collects timings.  The
+ * probe also marks the stage for heap allocation accounting (alloc_stats.h),
+ * which only CUAS_ALLOC_STATS builds do, and opens a profiler zone named
+ * after the stage (profiling.h), which only CUAS_PROFILING builds do.
+ */
+
+#include "common/alloc_stats.h"
+#include "common/profiling.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace cuas {
+
+// Stages timed across TrackManager, BinaryLogger and TrackSender.  Values are
+// published as StageLatency::stageId on the TrackerHealth topic.
+enum class PipelineStage : uint32_t {
+    Preprocess = 0,
+    Cluster,
+    Predict,
+    Associate,
+    Maintain,           // TrackManager's fused maintain/delete/classify pass
+    Delete,             // no longer recorded (folded into Maintain);
+    Classify,           //   kept so later stageIds stay stable
+    BinaryLog,
+    SendRawDetections,
+    SendClusterTable,
+    SendPredictedTable,
+    SendAssocTable,
+    SendTrackTable,
+    Dwell,              // whole processDwell / end-to-end in pipelined mode
+    Checkpoint,
+    Count
+};
+
+inline const char* pipelineStageName(PipelineStage s) {
+    switch (s) {
+        case PipelineStage::Preprocess:         return "preprocess";
+        case PipelineStage::Cluster:            return "cluster";
+        case PipelineStage::Predict:            return "predict";
+        case PipelineStage::Associate:          return "associate";
+        case PipelineStage::Maintain:           return "maintain";
+        case PipelineStage::Delete:             return "delete";
+        case PipelineStage::Classify:           return "classify";
+        case PipelineStage::BinaryLog:          return "binary_log";
+        case PipelineStage::SendRawDetections:  return "send_raw_detections";
+        case PipelineStage::SendClusterTable:   return "send_cluster_table";
+        case PipelineStage::SendPredictedTable: return "send_predicted_table";
+        case PipelineStage::SendAssocTable:     return "send_assoc_table";
+        case PipelineStage::SendTrackTable:     return "send_track_table";
+        case PipelineStage::Dwell:              return "dwell";
+        case PipelineStage::Checkpoint:         return "checkpoint";
+        case PipelineStage::Count:              break;
+    }
+    return "unknown";
+}
+
+struct LatencySummary {
+    uint64_t count  = 0;
+    double   p50Us  = 0.0;
+    double   p99Us  = 0.0;
+    double   p999Us = 0.0;
+    double   maxUs  = 0.0;
+};
+
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BITS    = 4;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BITS;
+    static constexpr int MAX_SHIFT   = 40 - SUB_BITS;          // 2^40 ns ceiling
+    static constexpr int NUM_BUCKETS = (MAX_SHIFT + 2) * SUB_BUCKETS;
+
+    LatencyHistogram() = default;
+    LatencyHistogram(const LatencyHistogram&)            = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void record(uint64_t ns) {
+        buckets_[bucketIndex(ns)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        uint64_t m = max_.load(std::memory_order_relaxed);
+        while (ns > m && !max_.compare_exchange_weak(m, ns, std::memory_order_relaxed)) {}
+    }
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+    // Value (ns) at quantile q in [0,1]; reported as the bucket's upper edge.
+    uint64_t valueAtQuantile(double q) const {
+        uint64_t total = count();
+        if (total == 0) return 0;
+        uint64_t target = static_cast<uint64_t>(q * static_cast<double>(total) + 0.5);
+        if (target < 1) target = 1;
+
+        uint64_t seen = 0;
+        for (int i = 0; i < NUM_BUCKETS; ++i) {
+            seen += buckets_[i].load(std::memory_order_relaxed);
+            if (seen >= target) {
+                uint64_t v = bucketUpper(i);
+                uint64_t m = max_.load(std::memory_order_relaxed);
+                return v < m ? v : m;
+            }
+        }
+        return max_.load(std::memory_order_relaxed);
+    }
+
+    LatencySummary summary() const {
+        LatencySummary s;
+        s.count  = count();
+        s.p50Us  = valueAtQuantile(0.50)  / 1000.0;
+        s.p99Us  = valueAtQuantile(0.99)  / 1000.0;
+        s.p999Us = valueAtQuantile(0.999) / 1000.0;
+        s.maxUs  = max_.load(std::memory_order_relaxed) / 1000.0;
+        return s;
+    }
+
+private:
+    static int bucketIndex(uint64_t v) {
+        if (v < static_cast<uint64_t>(SUB_BUCKETS)) return static_cast<int>(v);
+        int msb = highestBit(v);
+        int shift = msb - SUB_BITS;
+        if (shift > MAX_SHIFT) return NUM_BUCKETS - 1;
+        return shift * SUB_BUCKETS + static_cast<int>(v >> shift);
+    }
+
+    static int highestBit(uint64_t v) {
+#ifdef _MSC_VER
+        unsigned long idx;
+        _BitScanReverse64(&idx, v);
+        return static_cast<int>(idx);
+#else
+        return 63 - __builtin_clzll(v);
+#endif
+    }
+
+    static uint64_t bucketUpper(int idx) {
+        if (idx < SUB_BUCKETS) return static_cast<uint64_t>(idx);
+        int shift = idx / SUB_BUCKETS - 1;
+        uint64_t mant = static_cast<uint64_t>(idx % SUB_BUCKETS + SUB_BUCKETS);
+        return ((mant + 1) << shift) - 1;
+    }
+
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+static_assert(static_cast<size_t>(PipelineStage::Count) <= ALLOC_MAX_STAGES,
+              "ALLOC_MAX_STAGES too small for PipelineStage");
+
+inline AllocCounts stageAllocCounts(PipelineStage s) {
+    return allocCounts(static_cast<uint32_t>(s));
+}
+
+class StageTimings {
+public:
+    static constexpr size_t NUM_STAGES = static_cast<size_t>(PipelineStage::Count);
+
+    LatencyHistogram&       operator[](PipelineStage s)       { return stages_[static_cast<size_t>(s)]; }
+    const LatencyHistogram& operator[](PipelineStage s) const { return stages_[static_cast<size_t>(s)]; }
+
+private:
+    std::array<LatencyHistogram, NUM_STAGES> stages_;
+};
+
+#ifdef CUAS_PROFILING
+// StageTimer's zone for each stage, named as its histogram.
+inline const ProfileSite& stageProfileSite(PipelineStage s) {
+    using Sites = std::array<ProfileSite, static_cast<size_t>(PipelineStage::Count)>;
+    static const Sites sites = [] {
+        Sites all{};
+        for (size_t i = 0; i < all.size(); ++i)
+            all[i] = CUAS_PROFILE_SITE(pipelineStageName(static_cast<PipelineStage>(i)));
+        return all;
+    }();
+    return sites[static_cast<size_t>(s)];
+}
+#endif
+
+class StageTimer {
+public:
+    StageTimer(StageTimings* timings, PipelineStage stage)
+        : hist_(timings ? &(*timings)[stage] : nullptr),
+          alloc_(static_cast<uint32_t>(stage))
+#ifdef CUAS_PROFILING
+        , zone_(stageProfileSite(stage))
+#endif
+    {
+        if (hist_) start_ = std::chrono::steady_clock::now();
+    }
+    ~StageTimer() {
+        if (hist_) {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - start_).count();
+            hist_->record(ns > 0 ? static_cast<uint64_t>(ns) : 0);
+        }
+    }
+
+    StageTimer(const StageTimer&)            = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+private:
+    LatencyHistogram*                     hist_;
+    std::chrono::steady_clock::time_point start_;
+    AllocStageScope                       alloc_;
+#ifdef CUAS_PROFILING
+    ProfileZone                           zone_;
+#endif
+};
+
+} // namespace cuas
@@ -0,0 +1,76 @@
+#pragma once
+
+/*
+ * LogFile — append-only output file for BinaryLogger's writer thread.
+ *
+ * write() buffers and flush() hands the buffer to the OS, always at the
+ * file position the bytes belong to.  A failed write (disk full, I/O
+ * error) drops those bytes and returns false but keeps the position, so
+ * the file stays usable: once space is freed, writing resumes where it
+ * would have been and the lost stretch reads back as zeros, which the
+ * SOM/EOM framing skips.
+ *
+ * With `preallocate` > 0, space is reserved that far ahead of the write
+ * position (fallocate with KEEP_SIZE, so the visible size is only what was
+ * written): the file system allocates extents in a few large steps rather
+ * than on every write.  close() releases what is left of the reservation.
+ *
+ * LogSyncMode::Periodic makes sync() an fdatasync().  Direct opens the file
+ * O_DIRECT and writes whole aligned blocks, the partial last block padded
+ * with zeros and rewritten as it fills; close() trims the padding.  Where
+ * the platform lacks these (fallocate and O_DIRECT are Linux-only; Windows
+ * uses write-through for Direct) the file degrades to plain writes.
+ */
+
+#include "types.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace cuas {
+
+class LogFile {
+public:
+    LogFile() = default;
+    ~LogFile();
+
+    LogFile(const LogFile&)            = delete;
+    LogFile& operator=(const LogFile&) = delete;
+
+    bool open(const std::string& path, LogSyncMode sync = LogSyncMode::None,
+              uint64_t preallocate = 0);
+    bool isOpen() const { return open_; }
+
+    bool write(const void* data, size_t n);
+    bool flush();
+    // Flushes, then makes the data durable (Periodic and Direct; no-op for None).
+    bool sync();
+    void close();
+
+    // Bytes written so far, including any still buffered.
+    uint64_t size() const { return bufStart_ + bufLen_; }
+    // Bytes dropped by failed writes, over every file this object opened.
+    uint64_t lostBytes() const { return lostBytes_; }
+
+private:
+    bool writeAt(const uint8_t* data, size_t n, uint64_t at);
+    void reserve(uint64_t upTo);
+
+#ifdef _WIN32
+    void* handle_ = nullptr;
+#else
+    int   fd_     = -1;
+#endif
+    bool        open_   = false;
+    bool        direct_ = false;     // aligned O_DIRECT writes
+    LogSyncMode sync_   = LogSyncMode::None;
+
+    uint8_t* buf_      = nullptr;    // ALIGN-aligned, CAPACITY bytes
+    size_t   bufLen_   = 0;
+    uint64_t bufStart_ = 0;          // file offset of buf_[0]
+    uint64_t preallocate_ = 0;
+    uint64_t reserved_    = 0;       // reserved up to here
+    uint64_t lostBytes_   = 0;
+};
+
+} // namespace cuas
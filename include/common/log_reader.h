@@ -0,0 +1,135 @@
+#pragma once
+
+/*
+ * LogReader — sequential reader for v1 and v2 .bin logs.
+ *
+ * The file is memory-mapped and records are handed out as views: next()
+ * fills a LogPayload pointing into the mapping (or, for v2, into the
+ * unpacked block), so reading a record copies nothing but its header.
+ * Framing is validated in place, and resync after damage is a memchr scan
+ * for the SOM sentinel.
+ *
+ * next() returns plain records in file order whichever container wrote
+ * them: v2 Block records are checked and unpacked transparently and the
+ * BlockIndex record is consumed.  A damaged record or block is skipped by
+ * resyncing to the next SOM and counted in corrupted().
+ *
+ * seekDwell()/seekTime() jump through the v2 block index, or else the .idx
+ * sidecar, to a point at or before the requested dwell or time; setRange()
+ * seeks the same way and then limits next() to the requested dwells.
+ *
+ * split() and setByteRange() divide a file into record-aligned chunks that
+ * separate readers can work through in parallel.
+ */
+
+#include "types.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cuas {
+
+// A record's payload bytes; valid until the next LogReader::next() call.
+class LogPayload {
+public:
+    LogPayload() = default;
+    LogPayload(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    const uint8_t* data()  const { return data_; }
+    size_t         size()  const { return size_; }
+    const uint8_t* begin() const { return data_; }
+    const uint8_t* end()   const { return data_ + size_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t         size_ = 0;
+};
+
+class LogReader {
+public:
+    LogReader() = default;
+    ~LogReader();
+
+    LogReader(const LogReader&)            = delete;
+    LogReader& operator=(const LogReader&) = delete;
+
+    bool open(const std::string& path);
+    bool isOpen() const { return open_; }
+
+    // The next plain record; false at end of file.
+    bool next(LogRecordHeader& hdr, LogPayload& payload);
+
+    // 2 once a v2 block or index has been seen, else 1.
+    int version() const { return version_; }
+    // Records (v1) or blocks (v2) skipped as damaged.
+    uint64_t corrupted() const { return corrupted_; }
+
+    // v2 block index, loaded by open(); empty for v1 or a file cut short.
+    const std::vector<LogBlockIndexEntry>& index() const { return index_; }
+    // The .idx sidecar next to the file, loaded by open(); empty if none.
+    const std::vector<LogSidecarEntry>& sidecar() const { return sidecar_; }
+
+    // Position at or before the first record of `dwell` / time `ts`.  False
+    // (position unchanged) without an index, or past the last v2 block.
+    bool seekDwell(uint32_t dwell) { return seek(dwell, 0); }
+    bool seekTime(Timestamp ts)    { return seek(0, ts); }
+
+    // From here on next() returns only records of dwells in
+    // [fromDwell, toDwell] that start at or after `fromTime`, then stops.
+    // The RunInfo record is returned if it is read.
+    void setRange(uint32_t fromDwell, uint32_t toDwell = UINT32_MAX, Timestamp fromTime = 0);
+
+    // Splits the file into at most `n` chunks for parallel reading: returns
+    // 0, the inner boundaries, and the file size.  An inner boundary is a
+    // valid raw detection record (v1) or block (v2), so a reader started
+    // there knows its dwell from the first record it reads.
+    std::vector<uint64_t> split(size_t n) const;
+    // Positions at `begin`; next() then stops before any record starting at
+    // or after `end`.
+    void setByteRange(uint64_t begin, uint64_t end);
+
+    // Dwell of the latest raw detection read, or of the current v2 block.
+    uint32_t dwell() const { return dwell_; }
+
+private:
+    bool map(const std::string& path);
+    void unmap();
+    bool nextRecord(LogRecordHeader& hdr, LogPayload& payload);
+    bool readRecord(LogRecordHeader& hdr, LogPayload& payload);
+    bool resync(uint64_t from);
+    uint64_t findSom(uint64_t from) const;
+    bool framed(uint64_t at, LogRecordHeader& hdr) const;
+    bool unpackBlock(const LogPayload& payload);
+    void loadIndex();
+    void loadSidecar(const std::string& path);
+    bool seek(uint32_t dwell, Timestamp ts);
+    bool seekOffset(uint64_t offset);
+
+    const uint8_t* base_ = nullptr;    // null for an empty file
+    uint64_t       size_ = 0;
+    uint64_t       pos_  = 0;
+    uint64_t       end_  = 0;      // records must start before this
+    bool           open_ = false;
+#ifdef _WIN32
+    void* mapping_ = nullptr;
+#endif
+
+    uint32_t dwell_     = 0;
+    int      version_   = 1;
+    uint64_t corrupted_ = 0;
+    std::vector<LogBlockIndexEntry> index_;
+    std::vector<LogSidecarEntry>    sidecar_;
+
+    // setRange() filter; `inRange_` once the first dwell of the range is read.
+    bool      ranged_    = false;
+    bool      inRange_   = false;
+    uint32_t  fromDwell_ = 0, toDwell_ = UINT32_MAX;
+    Timestamp fromTime_  = 0;
+
+    // Current v2 block, unpacked, and the read position in it.
+    std::vector<uint8_t> block_;
+    size_t               blockPos_ = 0;
+};
+
+} // namespace cuas
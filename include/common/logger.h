@@ -1,28 +1,97 @@
 #pragma once
 
 #include "types.h"
+#include "latency_histogram.h"
+#include "log_file.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
 #include <string>
 #include <fstream>
 #include <mutex>
 #include <memory>
+#include <thread>
 #include <vector>
 
 namespace cuas {
 
+// BinaryLogger::open() settings.
+struct LogOptions {
+    size_t           ringBytes    = size_t(4) << 20;   // rounded up to a power of two
+    CombinedTextMode combinedText = CombinedTextMode::Live;
+    size_t           blockBytes   = 0;   // v2 LZ4 block size; 0 writes a v1 file
+    uint32_t         indexEvery   = 0;   // .idx sidecar entry every N records; 0 = none
+    uint64_t         segmentBytes = 0;   // start a new segment past this size; 0 = never
+    std::chrono::seconds segmentAge{0};  // ... or after this long; 0 = never
+    uint64_t         preallocateBytes = 0;   // file space reserved ahead of the writes
+    LogSyncMode      sync         = LogSyncMode::None;
+    std::chrono::milliseconds syncInterval{1000};   // Periodic and Direct
+};
+
+/*
+ * BinaryLogger — binary .bin log plus the combined_track_flow.dat text log.
+ *
+ * The log* calls never touch a file.  Each record is serialized straight
+ * into a pre-allocated ring shared by every producing thread (clusterDwell,
+ * trackDwell and the sender lanes), and a writer thread drains the ring in
+ * large batches.  Space is claimed with one CAS and a record is published
+ * by a release store of its sequence word, so producers never lock, wait
+ * or allocate.  When the ring is full the record is dropped and counted
+ * (droppedRecords()); a stalled disk costs log records, not dwell time.
+ *
+ * With LogOptions::blockBytes > 0 the .bin is a v2 container (see LogBlockHeader in
+ * types.h): the writer thread packs records into LZ4 blocks of about that
+ * size, sealed at the size limit, after BLOCK_MAX_AGE or on close(), and
+ * close() appends the block index.  LogReader reads either version.
+ *
+ * With LogOptions::indexEvery > 0 a .idx sidecar (LogSidecarEntry[]) is
+ * written next to the .bin as it grows: a v1 entry at the first raw
+ * detection record after every indexEvery records, a v2 entry per block.
+ * Unlike the block index it survives a crash.
+ *
+ * With LogOptions::segmentBytes or segmentAge the run is split into
+ * segments: <stem>.bin, <stem>_001.bin, ... each with its own .idx and
+ * combined_track_flow.dat, each starting with the RunInfo record (and
+ * .dat header) and on a raw detection record, so every segment reads on
+ * its own.  The files are LogFiles: preallocated ahead of the writes and
+ * synced per LogOptions::sync.  A failed write (disk full) drops that data,
+ * warns once and carries on; nothing waits on the disk but the writer.
+ *
+ * The log* calls must not race open() or close().
+ */
 class BinaryLogger {
 public:
     BinaryLogger();
     ~BinaryLogger();
 
-    /** If runInfo non-empty, writes it as first record to .bin and at top of combined_track_flow.dat */
+    /** If runInfo non-empty, writes it as first record to .bin and at top of combined_track_flow.dat.
+     *  With CombinedTextMode::Offline no combined_track_flow.dat is created. */
     bool open(const std::string& directory, const std::string& prefix,
-              const std::string& runInfo = std::string());
+              const std::string& runInfo = std::string(),
+              const LogOptions& options = LogOptions());
+    // Writes out every record already logged, then closes the files.
     void close();
     bool isOpen() const;
 
+    // Records (binary and text) dropped because the ring was full.
+    uint64_t droppedRecords() const { return droppedRecords_.load(std::memory_order_relaxed); }
+    uint64_t droppedBytes()   const { return droppedBytes_.load(std::memory_order_relaxed); }
+    // Bytes lost to failed file writes (disk full); call after close().
+    uint64_t lostBytes() const;
+
+    // Optional: every log* call is timed into PipelineStage::BinaryLog.
+    void setStageTimings(StageTimings* timings) { timings_ = timings; }
+
+    // combined_track_flow.dat text output can be switched off at run time
+    // (load shedding); the binary .bin log is unaffected.
+    void setCombinedTextEnabled(bool on) { combinedEnabled_.store(on); }
+
     void logRawDetections(Timestamp ts, const SPDetectionMessage& msg);
     void logPreprocessed(Timestamp ts, const std::vector<Detection>& dets);
-    void logClustered(Timestamp ts, const std::vector<Cluster>& clusters);
+    // One record for the dwell: `clusters`, then any track-aided ones.
+    void logClustered(Timestamp ts, const std::vector<Cluster>& clusters,
+                      const std::vector<Cluster>& aided = {});
     void logPredicted(Timestamp ts, uint32_t trackId, const StateVector& state);
     void logAssociated(Timestamp ts, uint32_t trackId, uint32_t clusterId, double distance);
     void logTrackInitiated(Timestamp ts, uint32_t trackId, const StateVector& state);
@@ -45,22 +114,127 @@ public:
     // Returns false if the end of file is reached without finding a sentinel.
     static bool resyncToNextRecord(std::ifstream& in);
 
-    // Returns the full path of the currently open (or last opened) .bin file.
+    // Returns the full path of the currently open (or last opened) .bin file:
+    // the latest segment.
     std::string getLogPath() const;
+    // Segments started so far in this run, the first included.
+    uint32_t segments() const { return segment_.load(std::memory_order_relaxed) + 1; }
+
+    // FNV-1a over a v2 block's unpacked records (LogBlockHeader::checksum).
+    static uint32_t blockChecksum(const uint8_t* data, size_t n);
 
 private:
+    // The ring is a power-of-two array of CHUNK-byte chunks.  An entry is an
+    // EntryHeader plus its bytes, starting on a chunk boundary and wrapping
+    // past the end of the array if need be; seq_[c] == c + 1 (c the
+    // unwrapped chunk number) publishes the entry starting at chunk c.
+    static constexpr size_t CHUNK = 64;
+    struct Entry {
+        uint64_t chunk;     // first chunk, unwrapped
+        uint64_t cursor;    // next byte to write, unwrapped
+    };
+    enum EntryKind : uint32_t { ENTRY_BINARY = 0, ENTRY_TEXT = 1 };
+
+    bool reserve(EntryKind kind, size_t bytes, Entry& e);
+    void put(Entry& e, const void* data, size_t n);
+    void commit(const Entry& e);
+    void get(uint64_t cursor, void* out, size_t n) const;
+    // Appends published entries to the batches until `limit` bytes.  True
+    // if it stopped at a raw detection record that should open a new segment.
+    bool drain(std::vector<uint8_t>& binary, std::string& text, size_t limit);
+    void writerLoop();
+    bool openSegment();
+    void closeSegment();
+    void rotateSegment();
+    void checkWrites();
+    void writeBinary(const std::vector<uint8_t>& binary);
+    void writeSidecar(uint32_t dwell, Timestamp ts, uint64_t offset);
+
+    // v2 container; writer thread only.
+    void packRecords(const std::vector<uint8_t>& binary);
+    void sealBlock();
+    void writeBlockIndex();
+
+    // Reserves a whole record and writes its header; the caller puts
+    // exactly `size` payload bytes, then calls endRecord().
+    bool beginRecord(LogRecordType type, Timestamp ts, uint32_t size, Entry& e);
+    void endRecord(Entry& e);
     void writeRecord(LogRecordType type, Timestamp ts, const void* data, uint32_t size);
-    void writeRecord(LogRecordType type, Timestamp ts, const std::vector<uint8_t>& data);
-    void writeCombinedLine(const char* step, Timestamp ts, const std::string& payload);
+    void writeCombinedLine(const char* step, Timestamp ts, const char* text, size_t n);
+    bool combinedTextActive() const {
+        return combinedEnabled_.load(std::memory_order_relaxed) && combinedOpen_;
+    }
 
-    std::ofstream file_;
-    std::ofstream combinedDat_;
-    std::mutex    mutex_;
-    bool          open_ = false;
+    LogFile       file_;            // writer thread only while open
+    LogFile       combinedDat_;     // writer thread only while open
+    std::ofstream sidecar_;         // .idx, writer thread only while open
+    std::mutex    mutex_;           // open / close
+    std::atomic<bool> open_{false};
+    bool          combinedOpen_ = false;
     uint32_t      currentDwell_ = 0;
+    mutable std::mutex pathMutex_;  // logPath_ changes on rotation
     std::string   logPath_;
+
+    // Segments; writer thread only while open.
+    LogOptions    options_;
+    std::string   runInfo_;
+    std::string   stem_;            // first segment's path without ".bin"
+    std::atomic<uint32_t> segment_{0};
+    uint64_t      segmentHeader_ = 0;  // RunInfo bytes at the segment's start
+    std::chrono::steady_clock::time_point segmentStarted_, lastSync_;
+    uint64_t      lostBase_     = 0;   // LogFile::lostBytes() at open()
+    uint64_t      lostReported_ = 0;
+    bool          writeFailing_ = false;
+    StageTimings* timings_ = nullptr;
+    std::atomic<bool> combinedEnabled_{true};
+
+    std::unique_ptr<uint8_t[]>               ring_;
+    std::unique_ptr<std::atomic<uint64_t>[]> seq_;
+    uint64_t chunkMask_ = 0;
+    uint64_t byteMask_  = 0;
+    alignas(64) std::atomic<uint64_t> head_{0};   // next free chunk
+    alignas(64) std::atomic<uint64_t> tail_{0};   // first chunk not yet drained
+    std::atomic<uint64_t> droppedRecords_{0};
+    std::atomic<uint64_t> droppedBytes_{0};
+
+    size_t                          blockBytes_ = 0;     // 0 = v1
+    std::vector<uint8_t>            block_, packed_;     // scratch
+    LogBlockHeader                  blockMeta_;
+    std::chrono::steady_clock::time_point blockStarted_;
+    std::vector<LogBlockIndexEntry> blockIndex_;
+    uint64_t                        fileOffset_    = 0;
+    uint32_t                        lastDwellSeen_ = 0;
+    uint32_t                        indexEvery_    = 0;
+    uint32_t                        sinceIndexed_  = 0;   // records since the last .idx entry
+
+    std::thread             writer_;
+    std::mutex              wakeMutex_;
+    std::condition_variable wake_;
+    bool                    stop_ = false;          // under wakeMutex_
+    std::atomic<bool>       wakeRequested_{false};
 };
 
+/*
+ * ConsoleLogger — the LOG_* macros.
+ *
+ * A message costs nothing unless its level is on.  Levels above
+ * CUAS_LOG_COMPILE_LEVEL (0 = ERROR .. 4 = TRACE, set by the CMake cache
+ * variable CUAS_LOG_LEVEL) compile to nothing; the rest test the runtime
+ * level, one relaxed load, before the arguments are evaluated.
+ *
+ * Enabled messages are written to stderr under a mutex, or, after
+ * setAsync(true), formatted on the calling thread into a fixed ring of
+ * line slots and written by a background thread: producers claim a slot
+ * with one CAS and never lock, wait or allocate.  A full ring drops INFO
+ * and lower lines, counted in droppedLines(); ERROR and WARN lines are then
+ * written synchronously.  Output is flushed when async mode is turned off
+ * and at exit.
+ */
+
+#ifndef CUAS_LOG_COMPILE_LEVEL
+#define CUAS_LOG_COMPILE_LEVEL 4
+#endif
+
 class ConsoleLogger {
 public:
 #ifdef _WIN32
@@ -75,7 +249,21 @@ public:
     static ConsoleLogger& instance();
 
     void setLevel(Level lvl);
-    Level level() const { return level_; }
+    Level level() const { return static_cast<Level>(level_.load(std::memory_order_relaxed)); }
+
+    // Whether a level-L message would be written; false at compile time
+    // above CUAS_LOG_COMPILE_LEVEL.
+    template <int L>
+    static bool enabled() {
+        if constexpr (L > CUAS_LOG_COMPILE_LEVEL) return false;
+        else return L <= level_.load(std::memory_order_relaxed);
+    }
+
+    // Starts (or stops, after writing out what is queued) the background
+    // writer.  Not for concurrent use with itself.
+    void setAsync(bool on);
+    bool async() const { return async_.load(std::memory_order_relaxed); }
+    uint64_t droppedLines() const { return dropped_.load(std::memory_order_relaxed); }
 
     void error(const char* module, const char* fmt, ...);
     void warn(const char* module, const char* fmt, ...);
@@ -86,15 +274,53 @@ public:
 private:
     ConsoleLogger() = default;
     void log(Level lvl, const char* module, const char* fmt, va_list args);
+    // "[time] [LEVEL] [module] message\n" into buf; returns its length.
+    static size_t format(char* buf, size_t size, Level lvl, const char* module,
+                         const char* fmt, va_list args);
+    static size_t formatLine(char* buf, size_t size, Level lvl, const char* module,
+                             const char* fmt, ...);
+
+    // Async ring: NUM_SLOTS slots of one line each.  Slot i is free for the
+    // producer claiming position p when seq == p, published when seq ==
+    // p + 1 (a bounded MPSC queue after Vyukov).
+    static constexpr size_t SLOT_BYTES = 1024;
+    static constexpr size_t NUM_SLOTS  = 1024;
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> seq{0};
+        uint32_t              len = 0;
+        char                  text[SLOT_BYTES - 16];
+    };
+    // False if the ring is full.
+    bool enqueue(Level lvl, const char* module, const char* fmt, va_list args);
+    size_t drain(std::string& out);   // writer side
+    void writerLoop();
+
+    static inline std::atomic<int> level_{INFO};
+    std::mutex mutex_;                // synchronous writes, setAsync
 
-    Level level_ = Level::INFO;
-    std::mutex mutex_;
+    std::atomic<bool>       async_{false};
+    std::unique_ptr<Slot[]> slots_;
+    alignas(64) std::atomic<uint64_t> head_{0};   // next position to claim
+    alignas(64) uint64_t              tail_ = 0;  // next to write; writer only
+    std::atomic<uint64_t>   dropped_{0};
+    uint64_t                droppedReported_ = 0;   // writer only
+
+    std::thread             writer_;
+    std::mutex              wakeMutex_;
+    std::condition_variable wake_;
+    bool                    stop_ = false;      // under wakeMutex_
 };
 
-#define LOG_ERROR(mod, ...) cuas::ConsoleLogger::instance().error(mod, __VA_ARGS__)
-#define LOG_WARN(mod, ...)  cuas::ConsoleLogger::instance().warn(mod, __VA_ARGS__)
-#define LOG_INFO(mod, ...)  cuas::ConsoleLogger::instance().info(mod, __VA_ARGS__)
-#define LOG_DEBUG(mod, ...) cuas::ConsoleLogger::instance().debug(mod, __VA_ARGS__)
-#define LOG_TRACE(mod, ...) cuas::ConsoleLogger::instance().trace(mod, __VA_ARGS__)
+#define CUAS_LOG_AT(lvl, fn, mod, ...)                                \
+    do {                                                              \
+        if (cuas::ConsoleLogger::enabled<lvl>())                      \
+            cuas::ConsoleLogger::instance().fn(mod, __VA_ARGS__);     \
+    } while (0)
+
+#define LOG_ERROR(mod, ...) CUAS_LOG_AT(0, error, mod, __VA_ARGS__)
+#define LOG_WARN(mod, ...)  CUAS_LOG_AT(1, warn,  mod, __VA_ARGS__)
+#define LOG_INFO(mod, ...)  CUAS_LOG_AT(2, info,  mod, __VA_ARGS__)
+#define LOG_DEBUG(mod, ...) CUAS_LOG_AT(3, debug, mod, __VA_ARGS__)
+#define LOG_TRACE(mod, ...) CUAS_LOG_AT(4, trace, mod, __VA_ARGS__)
 
 } // namespace cuas
@@ -0,0 +1,29 @@
+#pragma once
+
+/*
+ * LZ4 block format — compressor and bounds-checked decompressor.
+ *
+ * Output is a plain LZ4 block (no frame), so any LZ4 implementation can
+ * read it given the unpacked size.  The compressor is the single-pass
+ * greedy matcher of LZ4's fast mode; it is used for the v2 binary log,
+ * whose records are dominated by repeated detection layouts and doubles
+ * that differ in their low bytes.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cuas {
+
+// Worst-case compressed size of `n` bytes.
+constexpr size_t lz4CompressBound(size_t n) { return n + n / 255 + 16; }
+
+// Compresses `n` bytes into `dst` (at least lz4CompressBound(n) bytes);
+// returns the compressed size.
+size_t lz4Compress(const uint8_t* src, size_t n, uint8_t* dst);
+
+// Decompresses `n` bytes of `src` into exactly `outBytes` bytes of `dst`.
+// False if `src` is not a well-formed block of that unpacked size.
+bool lz4Decompress(const uint8_t* src, size_t n, uint8_t* dst, size_t outBytes);
+
+} // namespace cuas
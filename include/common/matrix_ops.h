@@ -4,6 +4,20 @@
 #include <cmath>
 #include <algorithm>
 
+// Marks a function to be compiled once per x86-64 ISA level (AVX-512, AVX2,
+// baseline) with the widest one the CPU supports picked at load time.  Used
+// by the dense kernels in matrix_ops.cpp and the batched IMM in
+// imm_batch.cpp; both files are built without FMA contraction so every
+// clone returns the same bits.  The preprocessor's detection gate uses it
+// too (comparisons only, so contraction does not arise).
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+    #define CUAS_MATH_DISPATCH 1
+    #define CUAS_MATH_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+    #define CUAS_MATH_DISPATCH 0
+    #define CUAS_MATH_KERNEL
+#endif
+
 namespace cuas { namespace mat {
 
 // ---------------------------------------------------------------------------
@@ -54,38 +68,96 @@ inline StateMatrix scaleMat(const StateMatrix& A, double s) {
     return R;
 }
 
-inline StateMatrix multiply(const StateMatrix& A, const StateMatrix& B) {
-    StateMatrix R = matZero();
+// Dense kernels below are defined in matrix_ops.cpp, built per ISA with
+// runtime selection (AVX-512 / AVX2 / baseline; NEON on AArch64).
+StateMatrix multiply(const StateMatrix& A, const StateMatrix& B);
+StateVector multiplyMV(const StateMatrix& A, const StateVector& v);
+
+inline StateMatrix transpose(const StateMatrix& A) {
+    StateMatrix R;
     for (int i = 0; i < STATE_DIM; ++i)
-        for (int k = 0; k < STATE_DIM; ++k)
-            if (std::abs(A[i][k]) > 1e-15)
-                for (int j = 0; j < STATE_DIM; ++j)
-                    R[i][j] += A[i][k] * B[k][j];
+        for (int j = 0; j < STATE_DIM; ++j)
+            R[i][j] = A[j][i];
     return R;
 }
 
-inline StateVector multiplyMV(const StateMatrix& A, const StateVector& v) {
+StateMatrix outerProduct(const StateVector& a, const StateVector& b);
+
+// acc += w * (P + d d^T): one IMM mixing / merging term in a single pass,
+// without the outer-product, sum and scale temporaries.  Only the packed
+// upper triangle is touched (45 terms instead of 81).
+void accumulateMoment(SymStateMatrix& acc, double w, const SymStateMatrix& P,
+                      const StateVector& d);
+
+// Name of the instruction set the dense kernels run on ("avx2", "neon", ...).
+const char* kernelIsa();
+
+// ---------------------------------------------------------------------------
+// Axis-block kernels
+// ---------------------------------------------------------------------------
+// When F only couples states of the same axis (CV, CA, CTR at zero turn
+// rate) it is diag(F_x, F_y, F_z), and the off-block terms the dense kernels
+// multiply are all zero.  Skipping them makes F*x 27 multiplies instead of
+// 81 and F*P*F^T 486 instead of 1458.  P itself may be dense (IMM mixing
+// and CTR couple the axes); only F has to be block-diagonal.  Terms are
+// summed in the same order as multiply(), so results match bit for bit.
+//
+// The propagation kernels take and return packed covariances: F*P is formed
+// in full, but only the upper triangle of F*P*F^T is computed (the lower
+// triangle is the same numbers).
+
+inline StateVector multiplyMVAxisBlocks(const StateMatrix& F, const StateVector& x) {
     StateVector r;
-    r.fill(0.0);
-    for (int i = 0; i < STATE_DIM; ++i)
-        for (int j = 0; j < STATE_DIM; ++j)
-            r[i] += A[i][j] * v[j];
+    for (int b = 0; b < STATE_DIM; b += AXIS_DIM)
+        for (int i = b; i < b + AXIS_DIM; ++i) {
+            double s = 0.0;
+            for (int k = b; k < b + AXIS_DIM; ++k) s += F[i][k] * x[k];
+            r[i] = s;
+        }
     return r;
 }
 
-inline StateMatrix transpose(const StateMatrix& A) {
-    StateMatrix R;
+// F * P * F^T + Q for block-diagonal F.
+inline SymStateMatrix propagateAxisBlocks(const StateMatrix& F, const SymStateMatrix& P,
+                                          const StateMatrix& Q) {
+    // FP = F * P: row i of block b only reads rows of block b of P.
+    StateMatrix FP;
+    for (int b = 0; b < STATE_DIM; b += AXIS_DIM)
+        for (int i = b; i < b + AXIS_DIM; ++i)
+            for (int j = 0; j < STATE_DIM; ++j) {
+                double s = 0.0;
+                for (int k = b; k < b + AXIS_DIM; ++k) s += F[i][k] * P(k, j);
+                FP[i][j] = s;
+            }
+    // R = FP * F^T: column j of block c only reads columns of block c of FP.
+    SymStateMatrix R;
     for (int i = 0; i < STATE_DIM; ++i)
-        for (int j = 0; j < STATE_DIM; ++j)
-            R[i][j] = A[j][i];
+        for (int j = i; j < STATE_DIM; ++j) {
+            int c = j - j % AXIS_DIM;
+            double s = 0.0;
+            for (int k = c; k < c + AXIS_DIM; ++k) s += FP[i][k] * F[j][k];
+            R(i, j) = s + Q[i][j];
+        }
     return R;
 }
 
-inline StateMatrix outerProduct(const StateVector& a, const StateVector& b) {
-    StateMatrix R;
+// F * P * F^T + Q for arbitrary F.
+inline SymStateMatrix propagateDense(const StateMatrix& F, const SymStateMatrix& P,
+                                     const StateMatrix& Q) {
+    StateMatrix FP;
     for (int i = 0; i < STATE_DIM; ++i)
-        for (int j = 0; j < STATE_DIM; ++j)
-            R[i][j] = a[i] * b[j];
+        for (int j = 0; j < STATE_DIM; ++j) {
+            double s = 0.0;
+            for (int k = 0; k < STATE_DIM; ++k) s += F[i][k] * P(k, j);
+            FP[i][j] = s;
+        }
+    SymStateMatrix R;
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = i; j < STATE_DIM; ++j) {
+            double s = 0.0;
+            for (int k = 0; k < STATE_DIM; ++k) s += FP[i][k] * F[j][k];
+            R(i, j) = s + Q[i][j];
+        }
     return R;
 }
 
@@ -224,22 +296,213 @@ inline StateMatrix kh(const std::array<std::array<double, MEAS_DIM>, STATE_DIM>&
 }
 
 // K * R * K^T  where K is (STATE_DIM x MEAS_DIM), R is (MEAS_DIM x MEAS_DIM).
-// Returns (STATE_DIM x STATE_DIM).  Required by the Joseph-form covariance update.
-inline StateMatrix krkt(const std::array<std::array<double, MEAS_DIM>, STATE_DIM>& K,
-                        const MeasMatrix& R) {
-    // Step 1: KR = K * R  (STATE_DIM x MEAS_DIM)
-    std::array<std::array<double, MEAS_DIM>, STATE_DIM> KR{};
-    for (int i = 0; i < STATE_DIM; ++i)
-        for (int j = 0; j < MEAS_DIM; ++j)
-            for (int k = 0; k < MEAS_DIM; ++k)
-                KR[i][j] += K[i][k] * R[k][j];
-    // Step 2: (KR) * K^T  (STATE_DIM x STATE_DIM)
-    StateMatrix result = matZero();
-    for (int i = 0; i < STATE_DIM; ++i)
-        for (int j = 0; j < STATE_DIM; ++j)
-            for (int k = 0; k < MEAS_DIM; ++k)
-                result[i][j] += KR[i][k] * K[j][k]; // K^T[k][j] = K[j][k]
-    return result;
+// Returns the packed (STATE_DIM x STATE_DIM) result.  Required by the
+// Joseph-form covariance update; defined in matrix_ops.cpp.
+SymStateMatrix krkt(const StateMeasMatrix& K, const MeasMatrix& R);
+
+// ---------------------------------------------------------------------------
+// UD factorisation
+// ---------------------------------------------------------------------------
+// P = U D U^T with U unit upper triangular (packed upper triangle, diagonal
+// slots hold 1) and D diagonal.  Used by the Bierman measurement update: a
+// covariance rebuilt from factors with positive D is positive semi-definite
+// whatever the rounding.
+struct UDFactors {
+    std::array<double, SYM_DIM> U{};
+    StateVector D{};
+
+    double& u(int i, int j)       { return U[symIndex(i, j)]; }    // i <= j
+    double  u(int i, int j) const { return U[symIndex(i, j)]; }
+};
+
+// Factors P; false if P is not positive definite.  Defined in matrix_ops.cpp.
+bool udFactor(const SymStateMatrix& P, UDFactors& f);
+
+// U D U^T.  Defined in matrix_ops.cpp.
+SymStateMatrix udCompose(const UDFactors& f);
+
+// ---------------------------------------------------------------------------
+// Selection measurement model
+// ---------------------------------------------------------------------------
+// z = H x where row m of H is the unit vector selecting state Idx[m].  H is
+// never formed: H*x and H*P*H^T are gathers, P*H^T is a column slice, and
+// the Joseph update applies I-KH as two rank-MEAS_DIM corrections, so KH is
+// never built either.
+template<int... Idx>
+struct SelectionMeasurement {
+    static_assert(sizeof...(Idx) == MEAS_DIM, "one state index per measured component");
+    static constexpr std::array<int, MEAS_DIM> index{{Idx...}};
+
+    // Dense H, for diagnostics and reference computations only.
+    static MeasStateMatrix matrix() {
+        MeasStateMatrix H{};
+        for (int m = 0; m < MEAS_DIM; ++m) H[m][index[m]] = 1.0;
+        return H;
+    }
+
+    // H * x
+    static MeasVector predict(const StateVector& x) {
+        MeasVector z;
+        for (int m = 0; m < MEAS_DIM; ++m) z[m] = x[index[m]];
+        return z;
+    }
+
+    // H * P * H^T
+    static MeasMatrix hpht(const SymStateMatrix& P) {
+        MeasMatrix R;
+        for (int a = 0; a < MEAS_DIM; ++a)
+            for (int b = 0; b < MEAS_DIM; ++b)
+                R[a][b] = P(index[a], index[b]);
+        return R;
+    }
+
+    // P * H^T
+    static StateMeasMatrix pht(const SymStateMatrix& P) {
+        StateMeasMatrix R;
+        for (int i = 0; i < STATE_DIM; ++i)
+            for (int m = 0; m < MEAS_DIM; ++m)
+                R[i][m] = P(i, index[m]);
+        return R;
+    }
+
+    // Joseph form P = (I-KH) P (I-KH)^T + K R K^T:
+    //   A = (I-KH) P             = P - K * (selected rows of P)
+    //   P = A (I-KH)^T + K R K^T = A - (selected columns of A) * K^T + K R K^T
+    // A is not symmetric and is formed in full; of the result only the upper
+    // triangle is computed, 378 multiplies for the two corrections versus
+    // 1458 for the dense products.
+    static SymStateMatrix josephUpdate(const SymStateMatrix& P, const StateMeasMatrix& K,
+                                       const MeasMatrix& R) {
+        StateMatrix A;
+        for (int i = 0; i < STATE_DIM; ++i)
+            for (int j = 0; j < STATE_DIM; ++j) {
+                double s = P(i, j);
+                for (int m = 0; m < MEAS_DIM; ++m) s -= K[i][m] * P(index[m], j);
+                A[i][j] = s;
+            }
+
+        SymStateMatrix out = krkt(K, R);
+        for (int i = 0; i < STATE_DIM; ++i)
+            for (int j = i; j < STATE_DIM; ++j) {
+                double s = A[i][j];
+                for (int m = 0; m < MEAS_DIM; ++m) s -= A[i][index[m]] * K[j][m];
+                out(i, j) = s + out(i, j);
+            }
+        return out;
+    }
+
+    // Bierman update of x and P on the UD factors of P, replacing the gain,
+    // state correction and Joseph form.  z is whitened by the Cholesky factor
+    // of R (R = L L^T, z' = L^-1 z, H' = L^-1 H), so its components are
+    // processed as three independent unit-variance scalar updates.  Each
+    // step scales D by a ratio of positive innovation variances, so D stays
+    // positive and P positive semi-definite.  Returns false, leaving x and P
+    // untouched, if P or R is not positive definite.
+    static bool biermanUpdate(StateVector& x, SymStateMatrix& P, const MeasVector& z,
+                              const MeasMatrix& R) {
+        // L^-1 (lower triangular) from the Cholesky factor of R.
+        if (!(R[0][0] > 0.0)) return false;
+        double l00 = std::sqrt(R[0][0]);
+        double l10 = R[1][0] / l00, l20 = R[2][0] / l00;
+        double d1 = R[1][1] - l10 * l10;
+        if (!(d1 > 0.0)) return false;
+        double l11 = std::sqrt(d1);
+        double l21 = (R[2][1] - l20 * l10) / l11;
+        double d2 = R[2][2] - l20 * l20 - l21 * l21;
+        if (!(d2 > 0.0)) return false;
+        double l22 = std::sqrt(d2);
+        MeasMatrix Linv{};
+        Linv[0][0] = 1.0 / l00;
+        Linv[1][1] = 1.0 / l11;
+        Linv[2][2] = 1.0 / l22;
+        Linv[1][0] = -l10 * Linv[0][0] * Linv[1][1];
+        Linv[2][1] = -l21 * Linv[1][1] * Linv[2][2];
+        Linv[2][0] = -(l20 * Linv[0][0] + l21 * Linv[1][0]) * Linv[2][2];
+
+        UDFactors f;
+        if (!udFactor(P, f)) return false;
+
+        for (int k = 0; k < MEAS_DIM; ++k) {
+            // Scalar measurement z'_k = h^T x + unit noise, h = Linv[k] on index[].
+            double zk = 0.0, hx = 0.0;
+            for (int m = 0; m <= k; ++m) {
+                zk += Linv[k][m] * z[m];
+                hx += Linv[k][m] * x[index[m]];
+            }
+
+            // fv = U^T h, v = D fv.
+            StateVector fv{}, v, b{};
+            for (int j = 0; j < STATE_DIM; ++j) {
+                double s = 0.0;
+                for (int m = 0; m <= k; ++m)
+                    if (index[m] <= j) s += Linv[k][m] * f.u(index[m], j);
+                fv[j] = s;
+                v[j]  = f.D[j] * s;
+            }
+
+            double alpha = 1.0;
+            for (int j = 0; j < STATE_DIM; ++j) {
+                double alphaPrev = alpha;
+                alpha += fv[j] * v[j];
+                double lambda = -fv[j] / alphaPrev;
+                f.D[j] *= alphaPrev / alpha;
+                for (int i = 0; i < j; ++i) {
+                    double uij = f.u(i, j);
+                    f.u(i, j) = uij + b[i] * lambda;
+                    b[i] += uij * v[j];
+                }
+                b[j] = v[j];
+            }
+
+            double scale = (zk - hx) / alpha;    // gain is b / alpha
+            for (int i = 0; i < STATE_DIM; ++i) x[i] += b[i] * scale;
+        }
+
+        P = udCompose(f);
+        return true;
+    }
+};
+
+// The tracker measures Cartesian position: state [x, vx, ax, y, vy, ay, z, vz, az].
+using PositionMeasurement = SelectionMeasurement<0, AXIS_DIM, 2 * AXIS_DIM>;
+
+// ---------------------------------------------------------------------------
+// Innovation covariance inverse
+// ---------------------------------------------------------------------------
+// Closed-form Cholesky S = L L^T of a symmetric positive-definite 3x3 (only
+// the lower triangle of S is read).  Gives S^-1 = L^-T L^-1 and
+// log|S| = 2 * sum(log L_ii) in one pass, ~40 flops and three square roots.
+// Returns false if S is not positive definite.
+inline bool invertSPD3(const MeasMatrix& S, MeasMatrix& Sinv, double& logDet) {
+    if (!(S[0][0] > 0.0)) return false;
+    double l00 = std::sqrt(S[0][0]);
+    double l10 = S[1][0] / l00;
+    double l20 = S[2][0] / l00;
+
+    double d1 = S[1][1] - l10 * l10;
+    if (!(d1 > 0.0)) return false;
+    double l11 = std::sqrt(d1);
+    double l21 = (S[2][1] - l20 * l10) / l11;
+
+    double d2 = S[2][2] - l20 * l20 - l21 * l21;
+    if (!(d2 > 0.0)) return false;
+    double l22 = std::sqrt(d2);
+
+    logDet = 2.0 * (std::log(l00) + std::log(l11) + std::log(l22));
+
+    // M = L^-1 (lower triangular), then S^-1 = M^T M.
+    double m00 = 1.0 / l00, m11 = 1.0 / l11, m22 = 1.0 / l22;
+    double m10 = -l10 * m00 * m11;
+    double m21 = -l21 * m11 * m22;
+    double m20 = -(l20 * m00 + l21 * m10) * m22;
+
+    Sinv[0][0] = m00 * m00 + m10 * m10 + m20 * m20;
+    Sinv[0][1] = Sinv[1][0] = m10 * m11 + m20 * m21;
+    Sinv[0][2] = Sinv[2][0] = m20 * m22;
+    Sinv[1][1] = m11 * m11 + m21 * m21;
+    Sinv[1][2] = Sinv[2][1] = m21 * m22;
+    Sinv[2][2] = m22 * m22;
+    return true;
 }
 
 // Mahalanobis distance: innov^T * Sinv * innov
@@ -273,4 +536,26 @@ inline MeasMatrix measAddMat(const MeasMatrix& A, const MeasMatrix& B) {
     return R;
 }
 
+// Covariance of a spherical measurement at (r, az, el) with independent
+// errors of standard deviation sigmaR, sigmaAz, sigmaEl, converted to the
+// Cartesian frame of sphericalToCartesian: J diag(sr^2, sa^2, se^2) J^T.
+// J's columns are the range unit vector and the azimuth and elevation unit
+// vectors scaled by r cos(el) and r, so R is the sum of three rank-one terms.
+inline MeasMatrix sphericalNoise(double r, double az, double el,
+                                 double sigmaR, double sigmaAz, double sigmaEl) {
+    const double ca = std::cos(az), sa = std::sin(az);
+    const double ce = std::cos(el), se = std::sin(el);
+    const MeasVector uR  = {ce * ca, ce * sa, se};
+    const MeasVector uAz = {-sa, ca, 0.0};
+    const MeasVector uEl = {-se * ca, -se * sa, ce};
+    const double vR  = sigmaR * sigmaR;
+    const double vAz = (r * ce * sigmaAz) * (r * ce * sigmaAz);
+    const double vEl = (r * sigmaEl) * (r * sigmaEl);
+    MeasMatrix R;
+    for (int i = 0; i < MEAS_DIM; ++i)
+        for (int j = 0; j < MEAS_DIM; ++j)
+            R[i][j] = vR * uR[i] * uR[j] + vAz * uAz[i] * uAz[j] + vEl * uEl[i] * uEl[j];
+    return R;
+}
+
 }} // namespace cuas::mat
@@ -0,0 +1,111 @@
+#pragma once
+
+/*
+ * Profiler zones (instrumentation builds).
+ *
+ * Configured with -DCUAS_PROFILING=TRACY or SDT, the CUAS_PROFILE_* macros
+ * put scoped zones on each thread's timeline, so one dwell can be followed
+ * from the receive callback through the pipeline stages, the sender writes
+ * and the log writer:
+ *
+ *   TRACY  zones, thread names and lock waits go to the Tracy client linked
+ *          in (Tracy's CMake package); the Tracy profiler connects to the
+ *          running tracker.
+ *   SDT    each zone is a pair of USDT probes, cuas:zone_begin and
+ *          cuas:zone_end, with the zone name as argument, for perf,
+ *          bpftrace or LTTng (needs <sys/sdt.h>).  An unattached probe is a
+ *          nop.  Thread names are the OS thread names the tools report.
+ *
+ * StageTimer opens a zone per stage, named as in the stage histograms, so
+ * every timed stage is also a zone.  Without the option (OFF) every macro
+ * compiles to nothing, CUAS_PROFILE_LOCK to the plain lock(), and
+ * PROFILING_ENABLED is false.
+ *
+ * Zone names must outlive the program: string literals.
+ */
+
+#if defined(CUAS_PROFILING_TRACY)
+#include <tracy/Tracy.hpp>
+#elif defined(CUAS_PROFILING_SDT)
+#include <sys/sdt.h>
+#include <pthread.h>
+#include <cstring>
+#endif
+
+namespace cuas {
+
+#define CUAS_PROFILE_CAT2(a, b) a##b
+#define CUAS_PROFILE_CAT(a, b)  CUAS_PROFILE_CAT2(a, b)
+#define CUAS_PROFILE_ID(name)   CUAS_PROFILE_CAT(name, __LINE__)
+
+#ifdef CUAS_PROFILING
+constexpr bool PROFILING_ENABLED = true;
+
+#if defined(CUAS_PROFILING_TRACY)
+// A zone's static description; Tracy keeps a pointer to it.
+using ProfileSite = tracy::SourceLocationData;
+#define CUAS_PROFILE_SITE(name) ::cuas::ProfileSite{ name, __func__, __FILE__, __LINE__, 0 }
+
+class ProfileZone {
+public:
+    explicit ProfileZone(const ProfileSite& site) : zone_(&site) {}
+
+private:
+    tracy::ScopedZone zone_;
+};
+
+inline void setProfileThreadName(const char* name) { tracy::SetThreadName(name); }
+#else
+struct ProfileSite { const char* name; };
+#define CUAS_PROFILE_SITE(name) ::cuas::ProfileSite{ name }
+
+class ProfileZone {
+public:
+    explicit ProfileZone(const ProfileSite& site) : name_(site.name) {
+        DTRACE_PROBE1(cuas, zone_begin, name_);
+    }
+    ~ProfileZone() { DTRACE_PROBE1(cuas, zone_end, name_); }
+
+    ProfileZone(const ProfileZone&)            = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name_;
+};
+
+// Linux keeps 15 characters of a thread name.
+inline void setProfileThreadName(const char* name) {
+    char buf[16];
+    std::strncpy(buf, name, sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = '\0';
+    pthread_setname_np(pthread_self(), buf);
+}
+#endif
+
+// A zone from here to the end of the enclosing scope.
+#define CUAS_PROFILE_ZONE(name)                                                    \
+    static constexpr ::cuas::ProfileSite CUAS_PROFILE_ID(cuasProfileSite_) =       \
+        CUAS_PROFILE_SITE(name);                                                   \
+    ::cuas::ProfileZone CUAS_PROFILE_ID(cuasProfileZone_)(CUAS_PROFILE_ID(cuasProfileSite_))
+
+// Names the calling thread on the timeline (copied).
+#define CUAS_PROFILE_THREAD(name) ::cuas::setProfileThreadName(name)
+
+// Locks `m`; when it is contended, the wait is a zone named `name`.  The
+// caller adopts the lock (std::adopt_lock).
+#define CUAS_PROFILE_LOCK(m, name)          \
+    do {                                    \
+        if (!(m).try_lock()) {              \
+            CUAS_PROFILE_ZONE(name);        \
+            (m).lock();                     \
+        }                                   \
+    } while (0)
+#else
+constexpr bool PROFILING_ENABLED = false;
+
+#define CUAS_PROFILE_ZONE(name)    ((void)0)
+#define CUAS_PROFILE_THREAD(name)  ((void)0)
+#define CUAS_PROFILE_LOCK(m, name) (m).lock()
+#endif
+
+} // namespace cuas
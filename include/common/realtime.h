@@ -0,0 +1,40 @@
+#pragma once
+
+/*
+ * Real-time placement helpers — CPU affinity, SCHED_FIFO and memory locking.
+ *
+ * Thin wrappers over the platform calls so TrackerPipeline can apply the
+ * system.realtime settings to the threads it owns.  Each call reports its
+ * own failure in the log (usually missing CAP_SYS_NICE / CAP_IPC_LOCK or an
+ * RLIMIT_MEMLOCK that is too small) and returns false, so the tracker keeps
+ * running with whatever subset could be applied.
+ *
+ * Windows maps SCHED_FIFO to THREAD_PRIORITY_TIME_CRITICAL; memory locking
+ * is Linux/POSIX only.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cuas {
+
+// Pins `t` to a single CPU.
+bool setThreadAffinity(std::thread& t, int cpu, const std::string& name);
+
+// Moves `t` to SCHED_FIFO at `priority` (1..99).
+bool setThreadRealtime(std::thread& t, int priority, const std::string& name);
+
+// mlockall(MCL_CURRENT | MCL_FUTURE) so no page of the process is ever
+// paged out or demand-faulted later: thread stacks and heap arenas created
+// afterwards are faulted in when mapped.  `prefaultHeapBytes` of heap is
+// then touched and handed back to malloc, which is told never to trim or
+// mmap, so dwell-sized allocations reuse resident pages.
+bool lockProcessMemory(size_t prefaultHeapBytes);
+
+// Bitmask of `cpus` (< 64) for Fast DDS ThreadSettings::affinity.
+uint64_t cpuMask(const std::vector<int>& cpus);
+
+} // namespace cuas
@@ -21,6 +21,7 @@
 
 #include "messages.h"   // IDL-generated: CounterUAS namespace
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -89,7 +90,9 @@ enum class LogRecordType : uint32_t {
     TrackUpdated   = 6,
     TrackDeleted   = 7,
     TrackSent      = 8,
-    RunInfo        = 9
+    RunInfo        = 9,
+    Block          = 10,
+    BlockIndex     = 11
 };
 
 static_assert(static_cast<uint32_t>(LogRecordType::RawDetection)   == CounterUAS::LOG_RAW_DETECTION,   "LogRecordType::RawDetection out of sync with IDL");
@@ -102,6 +105,59 @@ static_assert(static_cast<uint32_t>(LogRecordType::TrackUpdated)   == CounterUAS
 static_assert(static_cast<uint32_t>(LogRecordType::TrackDeleted)   == CounterUAS::LOG_TRACK_DELETED,   "LogRecordType::TrackDeleted out of sync with IDL");
 static_assert(static_cast<uint32_t>(LogRecordType::TrackSent)      == CounterUAS::LOG_TRACK_SENT,      "LogRecordType::TrackSent out of sync with IDL");
 static_assert(static_cast<uint32_t>(LogRecordType::RunInfo)        == CounterUAS::LOG_RUN_INFO,        "LogRecordType::RunInfo out of sync with IDL");
+static_assert(static_cast<uint32_t>(LogRecordType::Block)          == CounterUAS::LOG_BLOCK,           "LogRecordType::Block out of sync with IDL");
+static_assert(static_cast<uint32_t>(LogRecordType::BlockIndex)     == CounterUAS::LOG_BLOCK_INDEX,     "LogRecordType::BlockIndex out of sync with IDL");
+
+// ---------------------------------------------------------------------------
+// v2 log container.  A v2 .bin is still a sequence of the framed records
+// above, so v1 readers skip what they don't know and resync still works:
+//
+//   RunInfo record            (plain)
+//   Block record ...          payload = LogBlockHeader + packed records
+//   BlockIndex record         payload = LogBlockIndexEntry[n], then the
+//                             uint64 file offset of this record's header
+//
+// The file therefore ends with that offset and the EOM, so a reader finds
+// the index from the last 12 bytes.  A block's records are plain v1
+// records back to back; `checksum` is FNV-1a over them.  A file cut short
+// has no index but its sealed blocks remain readable in order.
+// ---------------------------------------------------------------------------
+enum class LogCodec : uint32_t {
+    None = 0,
+    LZ4  = 1        // LZ4 block format
+};
+
+#pragma pack(push, 1)
+struct LogBlockHeader {
+    uint32_t  codec      = 0;   // LogCodec
+    uint32_t  rawBytes   = 0;   // records, unpacked
+    uint32_t  records    = 0;
+    uint32_t  checksum   = 0;
+    uint32_t  firstDwell = 0;
+    uint32_t  lastDwell  = 0;
+    Timestamp firstTs    = 0;
+    Timestamp lastTs     = 0;
+};
+
+struct LogBlockIndexEntry {
+    uint64_t  offset     = 0;   // of the Block record's header
+    uint32_t  firstDwell = 0;
+    uint32_t  lastDwell  = 0;
+    Timestamp firstTs    = 0;
+    Timestamp lastTs     = 0;
+    uint32_t  records    = 0;
+    uint32_t  rawBytes   = 0;
+};
+
+// .idx sidecar entry: a dwell's first record (v1) or a block (v2) in the
+// .bin, appended while logging.  Entries are in file order.
+struct LogSidecarEntry {
+    uint32_t  dwell     = 0;
+    uint32_t  reserved  = 0;
+    Timestamp timestamp = 0;
+    uint64_t  offset    = 0;    // of a record header in the .bin
+};
+#pragma pack(pop)
 
 // ---------------------------------------------------------------------------
 // TrackStatus and TrackClassification — re-export IDL-generated plain enums
@@ -168,21 +224,90 @@ struct SPDetectionMessage {
     Timestamp timestamp     = 0;
     uint32_t  numDetections = 0;
     std::vector<Detection> detections;
+    uint32_t  sensorId      = 0;   // radar face
+    Timestamp receivedAt    = 0;   // taken from the DDS reader (host clock)
+    Timestamp dequeuedAt    = 0;   // popped from the ingest ring
 };
 
-// Conversion from IDL wire type to internal.
-inline SPDetectionMessage toInternal(const CounterUAS::SPDetectionMessage& m) {
-    SPDetectionMessage r;
+// Conversion from IDL wire type to internal.  The in-place form reuses the
+// capacity already held by `r.detections`, so a recycled message converts
+// without allocating.
+inline void toInternal(const CounterUAS::SPDetectionMessage& m, SPDetectionMessage& r) {
     r.messageId     = m.messageId();
     r.dwellCount    = m.dwellCount();
     r.timestamp     = m.timestamp();
     r.numDetections = m.numDetections();
+    r.sensorId      = m.sensorId();
+    r.detections.clear();
     r.detections.reserve(m.detections().size());
     for (const auto& d : m.detections())
         r.detections.push_back(toInternal(d));
+}
+
+inline SPDetectionMessage toInternal(const CounterUAS::SPDetectionMessage& m) {
+    SPDetectionMessage r;
+    toInternal(m, r);
     return r;
 }
 
+// Same from the plain SPDetectionFrame; numDetections is clamped to the
+// frame's capacity.
+inline void toInternal(const CounterUAS::SPDetectionFrame& f, SPDetectionMessage& r) {
+    const uint32_t n = std::min<uint32_t>(f.numDetections(), CounterUAS::FRAME_MAX_DETECTIONS);
+    r.messageId     = f.messageId();
+    r.dwellCount    = f.dwellCount();
+    r.timestamp     = f.timestamp();
+    r.numDetections = n;
+    r.sensorId      = f.sensorId();
+    r.detections.clear();
+    r.detections.reserve(n);
+    for (uint32_t i = 0; i < n; ++i)
+        r.detections.push_back(toInternal(f.detections()[i]));
+}
+
+// TrackUpdateMessage <-> TrackFrameEntry (TrackTableFrame).  The entry has
+// no messageId or trace; toTrackUpdate() takes the frame's trace.
+inline void toFrameEntry(const CounterUAS::TrackUpdateMessage& u, CounterUAS::TrackFrameEntry& e) {
+    e.trackId(u.trackId());   e.status(u.status());     e.timestamp(u.timestamp());
+    e.classification(u.classification());                e.hitCount(u.hitCount());
+    e.range(u.range());       e.azimuth(u.azimuth());   e.elevation(u.elevation());
+    e.rangeRate(u.rangeRate());
+    e.x(u.x());   e.y(u.y());   e.z(u.z());
+    e.vx(u.vx()); e.vy(u.vy()); e.vz(u.vz());
+    e.trackQuality(u.trackQuality());
+    e.missCount(u.missCount()); e.age(u.age());
+}
+inline CounterUAS::TrackUpdateMessage toTrackUpdate(const CounterUAS::TrackFrameEntry& e,
+                                                    const CounterUAS::LatencyTrace& trace) {
+    CounterUAS::TrackUpdateMessage u;
+    u.messageId(CounterUAS::MSG_ID_TRACK_UPDATE);
+    u.trackId(e.trackId());   u.status(e.status());     u.timestamp(e.timestamp());
+    u.classification(e.classification());                u.hitCount(e.hitCount());
+    u.range(e.range());       u.azimuth(e.azimuth());   u.elevation(e.elevation());
+    u.rangeRate(e.rangeRate());
+    u.x(e.x());   u.y(e.y());   u.z(e.z());
+    u.vx(e.vx()); u.vy(e.vy()); u.vz(e.vz());
+    u.trackQuality(e.trackQuality());
+    u.missCount(e.missCount()); u.age(e.age());
+    u.trace(trace);
+    return u;
+}
+
+// DetectionView — non-owning view of a contiguous run of detections, so
+// stages can read a dwell in place instead of taking a vector copy.
+struct DetectionView {
+    const Detection* data = nullptr;
+    size_t           size = 0;
+
+    DetectionView() = default;
+    DetectionView(const Detection* d, size_t n) : data(d), size(n) {}
+    DetectionView(const std::vector<Detection>& v) : data(v.data()), size(v.size()) {}
+
+    const Detection* begin() const { return data; }
+    const Detection* end()   const { return data + size; }
+    bool empty() const { return size == 0; }
+};
+
 // ---------------------------------------------------------------------------
 // Cartesian position / state
 // ---------------------------------------------------------------------------
@@ -242,6 +367,12 @@ using StateMatrix    = std::array<std::array<double, STATE_DIM>, STATE_DIM>;
 using MeasVector     = std::array<double, MEAS_DIM>;
 using MeasMatrix     = std::array<std::array<double, MEAS_DIM>, MEAS_DIM>;
 using MeasStateMatrix = std::array<std::array<double, STATE_DIM>, MEAS_DIM>;
+using StateMeasMatrix = std::array<std::array<double, MEAS_DIM>, STATE_DIM>;  // P*H^T, gain
+
+// The state is NUM_AXES blocks of [pos, vel, acc]; block-aware kernels in
+// matrix_ops.h rely on this layout.  The measurement is the three positions.
+static constexpr int AXIS_DIM = 3;
+static constexpr int NUM_AXES = STATE_DIM / AXIS_DIM;
 
 inline StateVector stateZero() {
     StateVector v{};
@@ -261,19 +392,111 @@ inline StateMatrix matIdentity() {
     return m;
 }
 
+// Covariances are symmetric and stored packed: the upper triangle row by
+// row, 45 doubles instead of 81.  (i, j) and (j, i) name the same element.
+static constexpr int SYM_DIM = STATE_DIM * (STATE_DIM + 1) / 2;
+
+constexpr int symIndex(int i, int j) {
+    return i <= j ? i * (2 * STATE_DIM - i + 1) / 2 + (j - i)
+                  : j * (2 * STATE_DIM - j + 1) / 2 + (i - j);
+}
+
+struct SymStateMatrix {
+    std::array<double, SYM_DIM> v{};
+
+    double& operator()(int i, int j)       { return v[symIndex(i, j)]; }
+    double  operator()(int i, int j) const { return v[symIndex(i, j)]; }
+
+    bool operator==(const SymStateMatrix& o) const { return v == o.v; }
+};
+
+// Packs the upper triangle of M (M is assumed symmetric).
+inline SymStateMatrix symFromMatrix(const StateMatrix& M) {
+    SymStateMatrix S;
+    for (int i = 0, e = 0; i < STATE_DIM; ++i)
+        for (int j = i; j < STATE_DIM; ++j, ++e) S.v[e] = M[i][j];
+    return S;
+}
+
+inline StateMatrix symToMatrix(const SymStateMatrix& S) {
+    StateMatrix M;
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = 0; j < STATE_DIM; ++j) M[i][j] = S(i, j);
+    return M;
+}
+
 // ---------------------------------------------------------------------------
 // Clustering and association method enums (config-only, not wire types)
 // ---------------------------------------------------------------------------
 enum class ClusterMethod {
     DBSCAN,
     RangeBased,
-    RangeStrengthBased
+    RangeStrengthBased,
+    ConnectedComponents
 };
 
 enum class AssociationMethod {
     Mahalanobis,
     GNN,
-    JPDA
+    JPDA,
+    MHT
+};
+
+// Assignment solver of the GNN associator.
+enum class GNNSolver {
+    Greedy,           // row/column reduction then greedy passes; not optimal
+    JonkerVolgenant   // optimal, on the sparse gated pairs (association/assignment.h)
+};
+
+// Where the tracker's detections come from (receiver/).
+enum class IngestBackend {
+    Dds,            // SPDetection topic (DetectionReceiver)
+    Udp             // legacy raw UDP datagrams (UdpDetectionReceiver)
+};
+
+// What the ingest ring does when the DDS listener outruns the pipeline.
+enum class OverloadPolicy {
+    Block,          // stall the producer until a slot frees up
+    DropOldest,     // discard the oldest queued dwell
+    DropNewest,     // discard the incoming dwell
+    CoalesceLatest  // keep only the newest dwell
+};
+
+// When combined_track_flow.dat is written.  Offline leaves it out of the
+// run entirely; `log_extractor <log>.bin dat <dir>` rebuilds it from the
+// binary log.
+enum class CombinedTextMode {
+    Live,           // written alongside the binary log
+    Offline         // binary log only
 };
 
+// How the binary logger's files reach the disk.
+enum class LogSyncMode {
+    None,           // page cache; the kernel writes back when it likes
+    Periodic,       // fdatasync every LogOptions::syncInterval
+    Direct          // O_DIRECT aligned writes that bypass the page cache
+};
+
+// Scalar type of the batched IMM predict (IMMBatch).  The measurement
+// update and everything downstream of it always run in double.
+enum class IMMPrecision {
+    Double,
+    Float     // half the per-track memory, twice the lanes per vector
+};
+
+// Covariance form of the IMM measurement update.
+enum class CovarianceUpdate {
+    Joseph,   // (I-KH) P (I-KH)^T + K R K^T on P
+    Bierman   // sequential scalar updates on the UD factors of P
+};
+
+// Debug pipeline tables a TrackManager builds per dwell, as a bit set.  The
+// pipeline asks only for those a display subscribes to
+// (TrackSender::debugTables()).
+constexpr uint32_t DEBUG_TABLE_CLUSTERS  = 1u << 0;   // ClusterTable
+constexpr uint32_t DEBUG_TABLE_PREDICTED = 1u << 1;   // PredictedTable
+constexpr uint32_t DEBUG_TABLE_ASSOC     = 1u << 2;   // AssocTable
+constexpr uint32_t DEBUG_TABLES_ALL      = DEBUG_TABLE_CLUSTERS | DEBUG_TABLE_PREDICTED |
+                                           DEBUG_TABLE_ASSOC;
+
 } // namespace cuas
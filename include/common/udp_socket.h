@@ -4,9 +4,9 @@
  * Raw UDP socket wrapper.
  *
  * DDS (via FastRTPS) manages the actual transport for all IDL-typed messages.
- * This class is retained for any non-DDS UDP usage (e.g., legacy tooling,
- * raw binary log file transfers) and as the underlying transport layer that
- * the DDS participant internally relies on.
+ * This class is retained for non-DDS UDP usage: the raw UDP ingest backend
+ * (receiver/udp_detection_receiver.h), legacy tooling and raw binary log
+ * file transfers.
  *
  * MessageSerializer has been removed: all serialization is now performed by
  * the IDL-generated CDR code (messages.cxx / messagesPubSubTypes.cxx) and
@@ -47,9 +47,21 @@ public:
     bool setDestination(const std::string& ip, int port);
     bool setReceiveTimeout(int timeoutMs);
     bool setBufferSize(int recvSize, int sendSize);
+    // SO_REUSEPORT, before bindSocket(): several sockets share one port and
+    // the kernel spreads senders across them.  False where unsupported.
+    bool setReusePort(bool on);
+    // SO_RCVBUF as the kernel applied it (capped by net.core.rmem_max).
+    int  receiveBufferSize() const;
 
     int  receive(uint8_t* buffer, int maxLen);
     int  receive(uint8_t* buffer, int maxLen, std::string& senderIp, int& senderPort);
+    // Up to `count` datagrams (at most MAX_BATCH) into consecutive
+    // `stride`-byte slots of `buffers`, their sizes into `lengths` (-1 if
+    // truncated).  Waits, up to the receive timeout, for the first only.
+    // Returns the number received, 0 on timeout, -1 on error.  One
+    // recvmmsg() call on Linux; a recvfrom() loop elsewhere.
+    int  receiveBatch(uint8_t* buffers, int stride, int count, int* lengths);
+    static constexpr int MAX_BATCH = 64;
     bool send(const uint8_t* data, int len);
     bool send(const uint8_t* data, int len, const std::string& ip, int port);
 
@@ -0,0 +1,81 @@
+#pragma once
+
+/*
+ * WorkerPool — small fork/join pool for data-parallel loops inside a dwell.
+ *
+ * parallelFor() splits [0, n) into fixed-size chunks; the calling thread and
+ * every worker claim chunks from a shared atomic cursor until none remain,
+ * so a thread that finishes early keeps taking work from the rest.  The call
+ * returns only when every chunk has run.  A pool of one thread (or a range
+ * that fits in a single chunk) runs inline with no synchronisation.
+ *
+ * Only one parallelFor() may be in flight at a time; it is meant to be driven
+ * by the thread that owns the data being processed.  The loop body is taken
+ * by reference (RangeFn), so a call never allocates.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cuas {
+
+class WorkerPool {
+public:
+    // Non-owning reference to a callable fn(begin, end).  It must outlive
+    // the parallelFor() it is passed to, which a lambda argument does.
+    class RangeFn {
+    public:
+        template <typename F, typename = std::enable_if_t<
+                                  !std::is_same_v<std::decay_t<F>, RangeFn>>>
+        RangeFn(F&& fn)   // implicit, so a lambda converts in place
+            : obj_(const_cast<void*>(static_cast<const void*>(std::addressof(fn)))),
+              call_([](void* obj, size_t begin, size_t end) {
+                  (*static_cast<std::remove_reference_t<F>*>(obj))(begin, end);
+              }) {}
+
+        void operator()(size_t begin, size_t end) const { call_(obj_, begin, end); }
+
+    private:
+        void* obj_;
+        void (*call_)(void*, size_t, size_t);
+    };
+
+    // numThreads counts the caller; 0 selects std::thread::hardware_concurrency().
+    explicit WorkerPool(int numThreads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&)            = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    void parallelFor(size_t n, size_t chunk, RangeFn fn);
+
+    int numThreads() const { return static_cast<int>(workers_.size()) + 1; }
+
+private:
+    void workerLoop();
+    void runChunks();
+
+    std::vector<std::thread> workers_;
+
+    std::mutex              mutex_;
+    std::condition_variable startCV_;
+    std::condition_variable doneCV_;
+    uint64_t                generation_ = 0;
+    size_t                  busy_       = 0;
+    bool                    stopping_   = false;
+
+    // Current job; written under mutex_ before generation_ is bumped.
+    const RangeFn*      fn_    = nullptr;
+    size_t              n_     = 0;
+    size_t              chunk_ = 1;
+    std::atomic<size_t> next_{0};
+};
+
+} // namespace cuas
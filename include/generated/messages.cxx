@@ -486,16 +486,18 @@ void CounterUAS::DetectionData::serializeKey(
 
 CounterUAS::SPDetectionMessage::SPDetectionMessage()
 {
-    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5a4aa2f2
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@9cfbac6e
     m_messageId = 0;
-    // m_dwellCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6591f517
+    // m_dwellCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4462ebfc
     m_dwellCount = 0;
-    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@345965f2
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2fa7320
     m_timestamp = 0;
-    // m_numDetections com.eprosima.idl.parser.typecode.PrimitiveTypeCode@429bd883
+    // m_numDetections com.eprosima.idl.parser.typecode.PrimitiveTypeCode@d2dd28
     m_numDetections = 0;
-    // m_detections com.eprosima.idl.parser.typecode.SequenceTypeCode@4d49af10
+    // m_detections com.eprosima.idl.parser.typecode.SequenceTypeCode@80b65386
 
+    // m_sensorId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@e5f6db1d
+    m_sensorId = 0;
 
 }
 
@@ -505,6 +507,7 @@ CounterUAS::SPDetectionMessage::~SPDetectionMessage()
 
 
 
+
 }
 
 CounterUAS::SPDetectionMessage::SPDetectionMessage(
@@ -515,6 +518,7 @@ CounterUAS::SPDetectionMessage::SPDetectionMessage(
     m_timestamp = x.m_timestamp;
     m_numDetections = x.m_numDetections;
     m_detections = x.m_detections;
+    m_sensorId = x.m_sensorId;
 }
 
 CounterUAS::SPDetectionMessage::SPDetectionMessage(
@@ -525,6 +529,7 @@ CounterUAS::SPDetectionMessage::SPDetectionMessage(
     m_timestamp = x.m_timestamp;
     m_numDetections = x.m_numDetections;
     m_detections = std::move(x.m_detections);
+    m_sensorId = x.m_sensorId;
 }
 
 CounterUAS::SPDetectionMessage& CounterUAS::SPDetectionMessage::operator =(
@@ -536,6 +541,7 @@ CounterUAS::SPDetectionMessage& CounterUAS::SPDetectionMessage::operator =(
     m_timestamp = x.m_timestamp;
     m_numDetections = x.m_numDetections;
     m_detections = x.m_detections;
+    m_sensorId = x.m_sensorId;
 
     return *this;
 }
@@ -549,6 +555,7 @@ CounterUAS::SPDetectionMessage& CounterUAS::SPDetectionMessage::operator =(
     m_timestamp = x.m_timestamp;
     m_numDetections = x.m_numDetections;
     m_detections = std::move(x.m_detections);
+    m_sensorId = x.m_sensorId;
 
     return *this;
 }
@@ -557,7 +564,7 @@ bool CounterUAS::SPDetectionMessage::operator ==(
         const SPDetectionMessage& x) const
 {
 
-    return (m_messageId == x.m_messageId && m_dwellCount == x.m_dwellCount && m_timestamp == x.m_timestamp && m_numDetections == x.m_numDetections && m_detections == x.m_detections);
+    return (m_messageId == x.m_messageId && m_dwellCount == x.m_dwellCount && m_timestamp == x.m_timestamp && m_numDetections == x.m_numDetections && m_detections == x.m_detections && m_sensorId == x.m_sensorId);
 }
 
 bool CounterUAS::SPDetectionMessage::operator !=(
@@ -592,6 +599,10 @@ size_t CounterUAS::SPDetectionMessage::getMaxCdrSerializedSize(
         current_alignment += CounterUAS::DetectionData::getMaxCdrSerializedSize(current_alignment);}
 
 
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+
     return current_alignment - initial_alignment;
 }
 
@@ -623,6 +634,10 @@ size_t CounterUAS::SPDetectionMessage::getCdrSerializedSize(
         current_alignment += CounterUAS::DetectionData::getCdrSerializedSize(data.detections().at(a), current_alignment);}
 
 
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+
     return current_alignment - initial_alignment;
 }
 
@@ -635,6 +650,7 @@ void CounterUAS::SPDetectionMessage::serialize(
     scdr << m_timestamp;
     scdr << m_numDetections;
     scdr << m_detections;
+    scdr << m_sensorId;
 
 }
 
@@ -647,6 +663,7 @@ void CounterUAS::SPDetectionMessage::deserialize(
     dcdr >> m_timestamp;
     dcdr >> m_numDetections;
     dcdr >> m_detections;
+    dcdr >> m_sensorId;
 }
 
 /*!
@@ -798,6 +815,34 @@ std::vector<CounterUAS::DetectionData>& CounterUAS::SPDetectionMessage::detectio
 {
     return m_detections;
 }
+/*!
+ * @brief This function sets a value in member sensorId
+ * @param _sensorId New value for member sensorId
+ */
+void CounterUAS::SPDetectionMessage::sensorId(
+        uint32_t _sensorId)
+{
+    m_sensorId = _sensorId;
+}
+
+/*!
+ * @brief This function returns the value of member sensorId
+ * @return Value of member sensorId
+ */
+uint32_t CounterUAS::SPDetectionMessage::sensorId() const
+{
+    return m_sensorId;
+}
+
+/*!
+ * @brief This function returns a reference to member sensorId
+ * @return Reference to member sensorId
+ */
+uint32_t& CounterUAS::SPDetectionMessage::sensorId()
+{
+    return m_sensorId;
+}
+
 
 size_t CounterUAS::SPDetectionMessage::getKeyMaxCdrSerializedSize(
         size_t current_alignment)
@@ -818,193 +863,99 @@ void CounterUAS::SPDetectionMessage::serializeKey(
         eprosima::fastcdr::Cdr& scdr) const
 {
     (void) scdr;
-         
+        
 }
 
 
 
 
-CounterUAS::TrackUpdateMessage::TrackUpdateMessage()
+CounterUAS::SPDetectionFrame::SPDetectionFrame()
 {
-    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@255b53dc
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4efe7dea
     m_messageId = 0;
-    // m_trackId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1dd92fe2
-    m_trackId = 0;
-    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6b53e23f
+    // m_dwellCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6d35dab1
+    m_dwellCount = 0;
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@71f00f6d
     m_timestamp = 0;
-    // m_status com.eprosima.idl.parser.typecode.EnumTypeCode@1b68b9a4
-    m_status = CounterUAS::TRACK_TENTATIVE;
-    // m_classification com.eprosima.idl.parser.typecode.EnumTypeCode@4f9a3314
-    m_classification = CounterUAS::CLASS_UNKNOWN;
-    // m_range com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3b2c72c2
-    m_range = 0.0;
-    // m_azimuth com.eprosima.idl.parser.typecode.PrimitiveTypeCode@491666ad
-    m_azimuth = 0.0;
-    // m_elevation com.eprosima.idl.parser.typecode.PrimitiveTypeCode@176d53b2
-    m_elevation = 0.0;
-    // m_rangeRate com.eprosima.idl.parser.typecode.PrimitiveTypeCode@971d0d8
-    m_rangeRate = 0.0;
-    // m_x com.eprosima.idl.parser.typecode.PrimitiveTypeCode@51931956
-    m_x = 0.0;
-    // m_y com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2b4a2ec7
-    m_y = 0.0;
-    // m_z com.eprosima.idl.parser.typecode.PrimitiveTypeCode@564718df
-    m_z = 0.0;
-    // m_vx com.eprosima.idl.parser.typecode.PrimitiveTypeCode@51b7e5df
-    m_vx = 0.0;
-    // m_vy com.eprosima.idl.parser.typecode.PrimitiveTypeCode@18a70f16
-    m_vy = 0.0;
-    // m_vz com.eprosima.idl.parser.typecode.PrimitiveTypeCode@62e136d3
-    m_vz = 0.0;
-    // m_trackQuality com.eprosima.idl.parser.typecode.PrimitiveTypeCode@c8e4bb0
-    m_trackQuality = 0.0;
-    // m_hitCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6279cee3
-    m_hitCount = 0;
-    // m_missCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4206a205
-    m_missCount = 0;
-    // m_age com.eprosima.idl.parser.typecode.PrimitiveTypeCode@29ba4338
-    m_age = 0;
+    // m_numDetections com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1ba7a34f
+    m_numDetections = 0;
+    // m_sensorId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3a6e2c58
+    m_sensorId = 0;
+    // m_detections com.eprosima.idl.parser.typecode.ArrayTypeCode@40439ff3
+
 
 }
 
-CounterUAS::TrackUpdateMessage::~TrackUpdateMessage()
+CounterUAS::SPDetectionFrame::~SPDetectionFrame()
 {
 
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
 }
 
-CounterUAS::TrackUpdateMessage::TrackUpdateMessage(
-        const TrackUpdateMessage& x)
+CounterUAS::SPDetectionFrame::SPDetectionFrame(
+        const SPDetectionFrame& x)
 {
     m_messageId = x.m_messageId;
-    m_trackId = x.m_trackId;
+    m_dwellCount = x.m_dwellCount;
     m_timestamp = x.m_timestamp;
-    m_status = x.m_status;
-    m_classification = x.m_classification;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_rangeRate = x.m_rangeRate;
-    m_x = x.m_x;
-    m_y = x.m_y;
-    m_z = x.m_z;
-    m_vx = x.m_vx;
-    m_vy = x.m_vy;
-    m_vz = x.m_vz;
-    m_trackQuality = x.m_trackQuality;
-    m_hitCount = x.m_hitCount;
-    m_missCount = x.m_missCount;
-    m_age = x.m_age;
+    m_numDetections = x.m_numDetections;
+    m_sensorId = x.m_sensorId;
+    m_detections = x.m_detections;
 }
 
-CounterUAS::TrackUpdateMessage::TrackUpdateMessage(
-        TrackUpdateMessage&& x) noexcept 
+CounterUAS::SPDetectionFrame::SPDetectionFrame(
+        SPDetectionFrame&& x) noexcept 
 {
     m_messageId = x.m_messageId;
-    m_trackId = x.m_trackId;
+    m_dwellCount = x.m_dwellCount;
     m_timestamp = x.m_timestamp;
-    m_status = x.m_status;
-    m_classification = x.m_classification;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_rangeRate = x.m_rangeRate;
-    m_x = x.m_x;
-    m_y = x.m_y;
-    m_z = x.m_z;
-    m_vx = x.m_vx;
-    m_vy = x.m_vy;
-    m_vz = x.m_vz;
-    m_trackQuality = x.m_trackQuality;
-    m_hitCount = x.m_hitCount;
-    m_missCount = x.m_missCount;
-    m_age = x.m_age;
+    m_numDetections = x.m_numDetections;
+    m_sensorId = x.m_sensorId;
+    m_detections = std::move(x.m_detections);
 }
 
-CounterUAS::TrackUpdateMessage& CounterUAS::TrackUpdateMessage::operator =(
-        const TrackUpdateMessage& x)
+CounterUAS::SPDetectionFrame& CounterUAS::SPDetectionFrame::operator =(
+        const SPDetectionFrame& x)
 {
 
     m_messageId = x.m_messageId;
-    m_trackId = x.m_trackId;
+    m_dwellCount = x.m_dwellCount;
     m_timestamp = x.m_timestamp;
-    m_status = x.m_status;
-    m_classification = x.m_classification;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_rangeRate = x.m_rangeRate;
-    m_x = x.m_x;
-    m_y = x.m_y;
-    m_z = x.m_z;
-    m_vx = x.m_vx;
-    m_vy = x.m_vy;
-    m_vz = x.m_vz;
-    m_trackQuality = x.m_trackQuality;
-    m_hitCount = x.m_hitCount;
-    m_missCount = x.m_missCount;
-    m_age = x.m_age;
+    m_numDetections = x.m_numDetections;
+    m_sensorId = x.m_sensorId;
+    m_detections = x.m_detections;
 
     return *this;
 }
 
-CounterUAS::TrackUpdateMessage& CounterUAS::TrackUpdateMessage::operator =(
-        TrackUpdateMessage&& x) noexcept
+CounterUAS::SPDetectionFrame& CounterUAS::SPDetectionFrame::operator =(
+        SPDetectionFrame&& x) noexcept
 {
 
     m_messageId = x.m_messageId;
-    m_trackId = x.m_trackId;
+    m_dwellCount = x.m_dwellCount;
     m_timestamp = x.m_timestamp;
-    m_status = x.m_status;
-    m_classification = x.m_classification;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_rangeRate = x.m_rangeRate;
-    m_x = x.m_x;
-    m_y = x.m_y;
-    m_z = x.m_z;
-    m_vx = x.m_vx;
-    m_vy = x.m_vy;
-    m_vz = x.m_vz;
-    m_trackQuality = x.m_trackQuality;
-    m_hitCount = x.m_hitCount;
-    m_missCount = x.m_missCount;
-    m_age = x.m_age;
+    m_numDetections = x.m_numDetections;
+    m_sensorId = x.m_sensorId;
+    m_detections = std::move(x.m_detections);
 
     return *this;
 }
 
-bool CounterUAS::TrackUpdateMessage::operator ==(
-        const TrackUpdateMessage& x) const
+bool CounterUAS::SPDetectionFrame::operator ==(
+        const SPDetectionFrame& x) const
 {
 
-    return (m_messageId == x.m_messageId && m_trackId == x.m_trackId && m_timestamp == x.m_timestamp && m_status == x.m_status && m_classification == x.m_classification && m_range == x.m_range && m_azimuth == x.m_azimuth && m_elevation == x.m_elevation && m_rangeRate == x.m_rangeRate && m_x == x.m_x && m_y == x.m_y && m_z == x.m_z && m_vx == x.m_vx && m_vy == x.m_vy && m_vz == x.m_vz && m_trackQuality == x.m_trackQuality && m_hitCount == x.m_hitCount && m_missCount == x.m_missCount && m_age == x.m_age);
+    return (m_messageId == x.m_messageId && m_dwellCount == x.m_dwellCount && m_timestamp == x.m_timestamp && m_numDetections == x.m_numDetections && m_sensorId == x.m_sensorId && m_detections == x.m_detections);
 }
 
-bool CounterUAS::TrackUpdateMessage::operator !=(
-        const TrackUpdateMessage& x) const
+bool CounterUAS::SPDetectionFrame::operator !=(
+        const SPDetectionFrame& x) const
 {
     return !(*this == x);
 }
 
-size_t CounterUAS::TrackUpdateMessage::getMaxCdrSerializedSize(
+size_t CounterUAS::SPDetectionFrame::getMaxCdrSerializedSize(
         size_t current_alignment)
 {
     size_t initial_alignment = current_alignment;
@@ -1025,54 +976,17 @@ size_t CounterUAS::TrackUpdateMessage::getMaxCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+    for(size_t a = 0; a < (CounterUAS::FRAME_MAX_DETECTIONS); ++a)
+    {
+        current_alignment += CounterUAS::DetectionData::getMaxCdrSerializedSize(current_alignment);}
 
 
 
     return current_alignment - initial_alignment;
 }
 
-size_t CounterUAS::TrackUpdateMessage::getCdrSerializedSize(
-        const CounterUAS::TrackUpdateMessage& data,
+size_t CounterUAS::SPDetectionFrame::getCdrSerializedSize(
+        const CounterUAS::SPDetectionFrame& data,
         size_t current_alignment)
 {
     (void)data;
@@ -1094,128 +1008,55 @@ size_t CounterUAS::TrackUpdateMessage::getCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
+    for(size_t a = 0; a < data.detections().size(); ++a)
+    {
+        current_alignment += CounterUAS::DetectionData::getCdrSerializedSize(data.detections().at(a), current_alignment);}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    return current_alignment - initial_alignment;
+}
 
+void CounterUAS::SPDetectionFrame::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    scdr << m_messageId;
+    scdr << m_dwellCount;
+    scdr << m_timestamp;
+    scdr << m_numDetections;
+    scdr << m_sensorId;
+    scdr << m_detections;
 
+}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+void CounterUAS::SPDetectionFrame::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
 
+    dcdr >> m_messageId;
+    dcdr >> m_dwellCount;
+    dcdr >> m_timestamp;
+    dcdr >> m_numDetections;
+    dcdr >> m_sensorId;
+    dcdr >> m_detections;
+}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-
-    return current_alignment - initial_alignment;
-}
-
-void CounterUAS::TrackUpdateMessage::serialize(
-        eprosima::fastcdr::Cdr& scdr) const
-{
-
-    scdr << m_messageId;
-    scdr << m_trackId;
-    scdr << m_timestamp;
-    scdr << (uint32_t)m_status;
-    scdr << (uint32_t)m_classification;
-    scdr << m_range;
-    scdr << m_azimuth;
-    scdr << m_elevation;
-    scdr << m_rangeRate;
-    scdr << m_x;
-    scdr << m_y;
-    scdr << m_z;
-    scdr << m_vx;
-    scdr << m_vy;
-    scdr << m_vz;
-    scdr << m_trackQuality;
-    scdr << m_hitCount;
-    scdr << m_missCount;
-    scdr << m_age;
-
-}
-
-void CounterUAS::TrackUpdateMessage::deserialize(
-        eprosima::fastcdr::Cdr& dcdr)
-{
-
-    dcdr >> m_messageId;
-    dcdr >> m_trackId;
-    dcdr >> m_timestamp;
-    {
-        uint32_t enum_value = 0;
-        dcdr >> enum_value;
-        m_status = (CounterUAS::TrackStatus)enum_value;
-    }
-
-    {
-        uint32_t enum_value = 0;
-        dcdr >> enum_value;
-        m_classification = (CounterUAS::TrackClassification)enum_value;
-    }
-
-    dcdr >> m_range;
-    dcdr >> m_azimuth;
-    dcdr >> m_elevation;
-    dcdr >> m_rangeRate;
-    dcdr >> m_x;
-    dcdr >> m_y;
-    dcdr >> m_z;
-    dcdr >> m_vx;
-    dcdr >> m_vy;
-    dcdr >> m_vz;
-    dcdr >> m_trackQuality;
-    dcdr >> m_hitCount;
-    dcdr >> m_missCount;
-    dcdr >> m_age;
-}
-
-/*!
- * @brief This function sets a value in member messageId
- * @param _messageId New value for member messageId
- */
-void CounterUAS::TrackUpdateMessage::messageId(
-        uint32_t _messageId)
-{
-    m_messageId = _messageId;
-}
+/*!
+ * @brief This function sets a value in member messageId
+ * @param _messageId New value for member messageId
+ */
+void CounterUAS::SPDetectionFrame::messageId(
+        uint32_t _messageId)
+{
+    m_messageId = _messageId;
+}
 
 /*!
  * @brief This function returns the value of member messageId
  * @return Value of member messageId
  */
-uint32_t CounterUAS::TrackUpdateMessage::messageId() const
+uint32_t CounterUAS::SPDetectionFrame::messageId() const
 {
     return m_messageId;
 }
@@ -1224,44 +1065,44 @@ uint32_t CounterUAS::TrackUpdateMessage::messageId() const
  * @brief This function returns a reference to member messageId
  * @return Reference to member messageId
  */
-uint32_t& CounterUAS::TrackUpdateMessage::messageId()
+uint32_t& CounterUAS::SPDetectionFrame::messageId()
 {
     return m_messageId;
 }
 
 /*!
- * @brief This function sets a value in member trackId
- * @param _trackId New value for member trackId
+ * @brief This function sets a value in member dwellCount
+ * @param _dwellCount New value for member dwellCount
  */
-void CounterUAS::TrackUpdateMessage::trackId(
-        uint32_t _trackId)
+void CounterUAS::SPDetectionFrame::dwellCount(
+        uint32_t _dwellCount)
 {
-    m_trackId = _trackId;
+    m_dwellCount = _dwellCount;
 }
 
 /*!
- * @brief This function returns the value of member trackId
- * @return Value of member trackId
+ * @brief This function returns the value of member dwellCount
+ * @return Value of member dwellCount
  */
-uint32_t CounterUAS::TrackUpdateMessage::trackId() const
+uint32_t CounterUAS::SPDetectionFrame::dwellCount() const
 {
-    return m_trackId;
+    return m_dwellCount;
 }
 
 /*!
- * @brief This function returns a reference to member trackId
- * @return Reference to member trackId
+ * @brief This function returns a reference to member dwellCount
+ * @return Reference to member dwellCount
  */
-uint32_t& CounterUAS::TrackUpdateMessage::trackId()
+uint32_t& CounterUAS::SPDetectionFrame::dwellCount()
 {
-    return m_trackId;
+    return m_dwellCount;
 }
 
 /*!
  * @brief This function sets a value in member timestamp
  * @param _timestamp New value for member timestamp
  */
-void CounterUAS::TrackUpdateMessage::timestamp(
+void CounterUAS::SPDetectionFrame::timestamp(
         uint64_t _timestamp)
 {
     m_timestamp = _timestamp;
@@ -1271,7 +1112,7 @@ void CounterUAS::TrackUpdateMessage::timestamp(
  * @brief This function returns the value of member timestamp
  * @return Value of member timestamp
  */
-uint64_t CounterUAS::TrackUpdateMessage::timestamp() const
+uint64_t CounterUAS::SPDetectionFrame::timestamp() const
 {
     return m_timestamp;
 }
@@ -1280,461 +1121,473 @@ uint64_t CounterUAS::TrackUpdateMessage::timestamp() const
  * @brief This function returns a reference to member timestamp
  * @return Reference to member timestamp
  */
-uint64_t& CounterUAS::TrackUpdateMessage::timestamp()
+uint64_t& CounterUAS::SPDetectionFrame::timestamp()
 {
     return m_timestamp;
 }
 
 /*!
- * @brief This function sets a value in member status
- * @param _status New value for member status
+ * @brief This function sets a value in member numDetections
+ * @param _numDetections New value for member numDetections
  */
-void CounterUAS::TrackUpdateMessage::status(
-        CounterUAS::TrackStatus _status)
+void CounterUAS::SPDetectionFrame::numDetections(
+        uint32_t _numDetections)
 {
-    m_status = _status;
+    m_numDetections = _numDetections;
 }
 
 /*!
- * @brief This function returns the value of member status
- * @return Value of member status
+ * @brief This function returns the value of member numDetections
+ * @return Value of member numDetections
  */
-CounterUAS::TrackStatus CounterUAS::TrackUpdateMessage::status() const
+uint32_t CounterUAS::SPDetectionFrame::numDetections() const
 {
-    return m_status;
+    return m_numDetections;
 }
 
 /*!
- * @brief This function returns a reference to member status
- * @return Reference to member status
+ * @brief This function returns a reference to member numDetections
+ * @return Reference to member numDetections
  */
-CounterUAS::TrackStatus& CounterUAS::TrackUpdateMessage::status()
+uint32_t& CounterUAS::SPDetectionFrame::numDetections()
 {
-    return m_status;
+    return m_numDetections;
 }
 
 /*!
- * @brief This function sets a value in member classification
- * @param _classification New value for member classification
+ * @brief This function sets a value in member sensorId
+ * @param _sensorId New value for member sensorId
  */
-void CounterUAS::TrackUpdateMessage::classification(
-        CounterUAS::TrackClassification _classification)
+void CounterUAS::SPDetectionFrame::sensorId(
+        uint32_t _sensorId)
 {
-    m_classification = _classification;
+    m_sensorId = _sensorId;
 }
 
 /*!
- * @brief This function returns the value of member classification
- * @return Value of member classification
+ * @brief This function returns the value of member sensorId
+ * @return Value of member sensorId
  */
-CounterUAS::TrackClassification CounterUAS::TrackUpdateMessage::classification() const
+uint32_t CounterUAS::SPDetectionFrame::sensorId() const
 {
-    return m_classification;
+    return m_sensorId;
 }
 
 /*!
- * @brief This function returns a reference to member classification
- * @return Reference to member classification
+ * @brief This function returns a reference to member sensorId
+ * @return Reference to member sensorId
  */
-CounterUAS::TrackClassification& CounterUAS::TrackUpdateMessage::classification()
+uint32_t& CounterUAS::SPDetectionFrame::sensorId()
 {
-    return m_classification;
+    return m_sensorId;
 }
 
 /*!
- * @brief This function sets a value in member range
- * @param _range New value for member range
+ * @brief This function copies the value in member detections
+ * @param _detections New value to be copied in member detections
  */
-void CounterUAS::TrackUpdateMessage::range(
-        double _range)
+void CounterUAS::SPDetectionFrame::detections(
+        const std::array<CounterUAS::DetectionData, CounterUAS::FRAME_MAX_DETECTIONS>& _detections)
 {
-    m_range = _range;
+    m_detections = _detections;
 }
 
 /*!
- * @brief This function returns the value of member range
- * @return Value of member range
+ * @brief This function moves the value in member detections
+ * @param _detections New value to be moved in member detections
  */
-double CounterUAS::TrackUpdateMessage::range() const
+void CounterUAS::SPDetectionFrame::detections(
+        std::array<CounterUAS::DetectionData, CounterUAS::FRAME_MAX_DETECTIONS>&& _detections)
 {
-    return m_range;
+    m_detections = std::move(_detections);
 }
 
 /*!
- * @brief This function returns a reference to member range
- * @return Reference to member range
+ * @brief This function returns a constant reference to member detections
+ * @return Constant reference to member detections
  */
-double& CounterUAS::TrackUpdateMessage::range()
+const std::array<CounterUAS::DetectionData, CounterUAS::FRAME_MAX_DETECTIONS>& CounterUAS::SPDetectionFrame::detections() const
 {
-    return m_range;
+    return m_detections;
 }
 
 /*!
- * @brief This function sets a value in member azimuth
- * @param _azimuth New value for member azimuth
+ * @brief This function returns a reference to member detections
+ * @return Reference to member detections
  */
-void CounterUAS::TrackUpdateMessage::azimuth(
-        double _azimuth)
+std::array<CounterUAS::DetectionData, CounterUAS::FRAME_MAX_DETECTIONS>& CounterUAS::SPDetectionFrame::detections()
 {
-    m_azimuth = _azimuth;
+    return m_detections;
 }
 
-/*!
- * @brief This function returns the value of member azimuth
- * @return Value of member azimuth
- */
-double CounterUAS::TrackUpdateMessage::azimuth() const
+
+size_t CounterUAS::SPDetectionFrame::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
 {
-    return m_azimuth;
+    size_t current_align = current_alignment;
+
+
+
+    return current_align;
 }
 
-/*!
- * @brief This function returns a reference to member azimuth
- * @return Reference to member azimuth
- */
-double& CounterUAS::TrackUpdateMessage::azimuth()
+bool CounterUAS::SPDetectionFrame::isKeyDefined()
 {
-    return m_azimuth;
+    return false;
 }
 
-/*!
- * @brief This function sets a value in member elevation
- * @param _elevation New value for member elevation
- */
-void CounterUAS::TrackUpdateMessage::elevation(
-        double _elevation)
+void CounterUAS::SPDetectionFrame::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
 {
-    m_elevation = _elevation;
+    (void) scdr;
+            
 }
 
-/*!
- * @brief This function returns the value of member elevation
- * @return Value of member elevation
- */
-double CounterUAS::TrackUpdateMessage::elevation() const
+
+
+CounterUAS::LatencyTrace::LatencyTrace()
 {
-    return m_elevation;
+    // m_dwellCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3faf4730
+    m_dwellCount = 0;
+    // m_sensorTime com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6d876d20
+    m_sensorTime = 0;
+    // m_receiveTime com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2211fb06
+    m_receiveTime = 0;
+    // m_dequeueTime com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2e9abfff
+    m_dequeueTime = 0;
+    // m_processedTime com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5196b058
+    m_processedTime = 0;
+    // m_publishTime com.eprosima.idl.parser.typecode.PrimitiveTypeCode@72062c64
+    m_publishTime = 0;
+
 }
 
-/*!
- * @brief This function returns a reference to member elevation
- * @return Reference to member elevation
- */
-double& CounterUAS::TrackUpdateMessage::elevation()
+CounterUAS::LatencyTrace::~LatencyTrace()
 {
-    return m_elevation;
+
+
+
+
+
+
 }
 
-/*!
- * @brief This function sets a value in member rangeRate
- * @param _rangeRate New value for member rangeRate
- */
-void CounterUAS::TrackUpdateMessage::rangeRate(
-        double _rangeRate)
+CounterUAS::LatencyTrace::LatencyTrace(
+        const LatencyTrace& x)
 {
-    m_rangeRate = _rangeRate;
+    m_dwellCount = x.m_dwellCount;
+    m_sensorTime = x.m_sensorTime;
+    m_receiveTime = x.m_receiveTime;
+    m_dequeueTime = x.m_dequeueTime;
+    m_processedTime = x.m_processedTime;
+    m_publishTime = x.m_publishTime;
 }
 
-/*!
- * @brief This function returns the value of member rangeRate
- * @return Value of member rangeRate
- */
-double CounterUAS::TrackUpdateMessage::rangeRate() const
+CounterUAS::LatencyTrace::LatencyTrace(
+        LatencyTrace&& x) noexcept 
 {
-    return m_rangeRate;
+    m_dwellCount = x.m_dwellCount;
+    m_sensorTime = x.m_sensorTime;
+    m_receiveTime = x.m_receiveTime;
+    m_dequeueTime = x.m_dequeueTime;
+    m_processedTime = x.m_processedTime;
+    m_publishTime = x.m_publishTime;
 }
 
-/*!
- * @brief This function returns a reference to member rangeRate
- * @return Reference to member rangeRate
- */
-double& CounterUAS::TrackUpdateMessage::rangeRate()
+CounterUAS::LatencyTrace& CounterUAS::LatencyTrace::operator =(
+        const LatencyTrace& x)
 {
-    return m_rangeRate;
-}
 
-/*!
- * @brief This function sets a value in member x
- * @param _x New value for member x
- */
-void CounterUAS::TrackUpdateMessage::x(
-        double _x)
-{
-    m_x = _x;
-}
+    m_dwellCount = x.m_dwellCount;
+    m_sensorTime = x.m_sensorTime;
+    m_receiveTime = x.m_receiveTime;
+    m_dequeueTime = x.m_dequeueTime;
+    m_processedTime = x.m_processedTime;
+    m_publishTime = x.m_publishTime;
 
-/*!
- * @brief This function returns the value of member x
- * @return Value of member x
- */
-double CounterUAS::TrackUpdateMessage::x() const
-{
-    return m_x;
+    return *this;
 }
 
-/*!
- * @brief This function returns a reference to member x
- * @return Reference to member x
- */
-double& CounterUAS::TrackUpdateMessage::x()
+CounterUAS::LatencyTrace& CounterUAS::LatencyTrace::operator =(
+        LatencyTrace&& x) noexcept
 {
-    return m_x;
-}
 
-/*!
- * @brief This function sets a value in member y
- * @param _y New value for member y
- */
-void CounterUAS::TrackUpdateMessage::y(
-        double _y)
-{
-    m_y = _y;
-}
+    m_dwellCount = x.m_dwellCount;
+    m_sensorTime = x.m_sensorTime;
+    m_receiveTime = x.m_receiveTime;
+    m_dequeueTime = x.m_dequeueTime;
+    m_processedTime = x.m_processedTime;
+    m_publishTime = x.m_publishTime;
 
-/*!
- * @brief This function returns the value of member y
- * @return Value of member y
- */
-double CounterUAS::TrackUpdateMessage::y() const
-{
-    return m_y;
+    return *this;
 }
 
-/*!
- * @brief This function returns a reference to member y
- * @return Reference to member y
- */
-double& CounterUAS::TrackUpdateMessage::y()
+bool CounterUAS::LatencyTrace::operator ==(
+        const LatencyTrace& x) const
 {
-    return m_y;
-}
 
-/*!
- * @brief This function sets a value in member z
- * @param _z New value for member z
- */
-void CounterUAS::TrackUpdateMessage::z(
-        double _z)
-{
-    m_z = _z;
+    return (m_dwellCount == x.m_dwellCount && m_sensorTime == x.m_sensorTime && m_receiveTime == x.m_receiveTime && m_dequeueTime == x.m_dequeueTime && m_processedTime == x.m_processedTime && m_publishTime == x.m_publishTime);
 }
 
-/*!
- * @brief This function returns the value of member z
- * @return Value of member z
- */
-double CounterUAS::TrackUpdateMessage::z() const
+bool CounterUAS::LatencyTrace::operator !=(
+        const LatencyTrace& x) const
 {
-    return m_z;
+    return !(*this == x);
 }
 
-/*!
- * @brief This function returns a reference to member z
- * @return Reference to member z
- */
-double& CounterUAS::TrackUpdateMessage::z()
+size_t CounterUAS::LatencyTrace::getMaxCdrSerializedSize(
+        size_t current_alignment)
 {
-    return m_z;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+
+    return current_alignment - initial_alignment;
 }
 
-/*!
- * @brief This function sets a value in member vx
- * @param _vx New value for member vx
- */
-void CounterUAS::TrackUpdateMessage::vx(
-        double _vx)
+size_t CounterUAS::LatencyTrace::getCdrSerializedSize(
+        const CounterUAS::LatencyTrace& data,
+        size_t current_alignment)
 {
-    m_vx = _vx;
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+
+    return current_alignment - initial_alignment;
 }
 
-/*!
- * @brief This function returns the value of member vx
- * @return Value of member vx
- */
-double CounterUAS::TrackUpdateMessage::vx() const
+void CounterUAS::LatencyTrace::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
 {
-    return m_vx;
+
+    scdr << m_dwellCount;
+    scdr << m_sensorTime;
+    scdr << m_receiveTime;
+    scdr << m_dequeueTime;
+    scdr << m_processedTime;
+    scdr << m_publishTime;
+
 }
 
-/*!
- * @brief This function returns a reference to member vx
- * @return Reference to member vx
- */
-double& CounterUAS::TrackUpdateMessage::vx()
+void CounterUAS::LatencyTrace::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
 {
-    return m_vx;
+
+    dcdr >> m_dwellCount;
+    dcdr >> m_sensorTime;
+    dcdr >> m_receiveTime;
+    dcdr >> m_dequeueTime;
+    dcdr >> m_processedTime;
+    dcdr >> m_publishTime;
 }
 
 /*!
- * @brief This function sets a value in member vy
- * @param _vy New value for member vy
+ * @brief This function sets a value in member dwellCount
+ * @param _dwellCount New value for member dwellCount
  */
-void CounterUAS::TrackUpdateMessage::vy(
-        double _vy)
+void CounterUAS::LatencyTrace::dwellCount(
+        uint32_t _dwellCount)
 {
-    m_vy = _vy;
+    m_dwellCount = _dwellCount;
 }
 
 /*!
- * @brief This function returns the value of member vy
- * @return Value of member vy
+ * @brief This function returns the value of member dwellCount
+ * @return Value of member dwellCount
  */
-double CounterUAS::TrackUpdateMessage::vy() const
+uint32_t CounterUAS::LatencyTrace::dwellCount() const
 {
-    return m_vy;
+    return m_dwellCount;
 }
 
 /*!
- * @brief This function returns a reference to member vy
- * @return Reference to member vy
+ * @brief This function returns a reference to member dwellCount
+ * @return Reference to member dwellCount
  */
-double& CounterUAS::TrackUpdateMessage::vy()
+uint32_t& CounterUAS::LatencyTrace::dwellCount()
 {
-    return m_vy;
+    return m_dwellCount;
 }
 
 /*!
- * @brief This function sets a value in member vz
- * @param _vz New value for member vz
+ * @brief This function sets a value in member sensorTime
+ * @param _sensorTime New value for member sensorTime
  */
-void CounterUAS::TrackUpdateMessage::vz(
-        double _vz)
+void CounterUAS::LatencyTrace::sensorTime(
+        uint64_t _sensorTime)
 {
-    m_vz = _vz;
+    m_sensorTime = _sensorTime;
 }
 
 /*!
- * @brief This function returns the value of member vz
- * @return Value of member vz
+ * @brief This function returns the value of member sensorTime
+ * @return Value of member sensorTime
  */
-double CounterUAS::TrackUpdateMessage::vz() const
+uint64_t CounterUAS::LatencyTrace::sensorTime() const
 {
-    return m_vz;
+    return m_sensorTime;
 }
 
 /*!
- * @brief This function returns a reference to member vz
- * @return Reference to member vz
+ * @brief This function returns a reference to member sensorTime
+ * @return Reference to member sensorTime
  */
-double& CounterUAS::TrackUpdateMessage::vz()
+uint64_t& CounterUAS::LatencyTrace::sensorTime()
 {
-    return m_vz;
+    return m_sensorTime;
 }
 
 /*!
- * @brief This function sets a value in member trackQuality
- * @param _trackQuality New value for member trackQuality
+ * @brief This function sets a value in member receiveTime
+ * @param _receiveTime New value for member receiveTime
  */
-void CounterUAS::TrackUpdateMessage::trackQuality(
-        double _trackQuality)
+void CounterUAS::LatencyTrace::receiveTime(
+        uint64_t _receiveTime)
 {
-    m_trackQuality = _trackQuality;
+    m_receiveTime = _receiveTime;
 }
 
 /*!
- * @brief This function returns the value of member trackQuality
- * @return Value of member trackQuality
+ * @brief This function returns the value of member receiveTime
+ * @return Value of member receiveTime
  */
-double CounterUAS::TrackUpdateMessage::trackQuality() const
+uint64_t CounterUAS::LatencyTrace::receiveTime() const
 {
-    return m_trackQuality;
+    return m_receiveTime;
 }
 
 /*!
- * @brief This function returns a reference to member trackQuality
- * @return Reference to member trackQuality
+ * @brief This function returns a reference to member receiveTime
+ * @return Reference to member receiveTime
  */
-double& CounterUAS::TrackUpdateMessage::trackQuality()
+uint64_t& CounterUAS::LatencyTrace::receiveTime()
 {
-    return m_trackQuality;
+    return m_receiveTime;
 }
 
 /*!
- * @brief This function sets a value in member hitCount
- * @param _hitCount New value for member hitCount
+ * @brief This function sets a value in member dequeueTime
+ * @param _dequeueTime New value for member dequeueTime
  */
-void CounterUAS::TrackUpdateMessage::hitCount(
-        uint32_t _hitCount)
+void CounterUAS::LatencyTrace::dequeueTime(
+        uint64_t _dequeueTime)
 {
-    m_hitCount = _hitCount;
+    m_dequeueTime = _dequeueTime;
 }
 
 /*!
- * @brief This function returns the value of member hitCount
- * @return Value of member hitCount
+ * @brief This function returns the value of member dequeueTime
+ * @return Value of member dequeueTime
  */
-uint32_t CounterUAS::TrackUpdateMessage::hitCount() const
+uint64_t CounterUAS::LatencyTrace::dequeueTime() const
 {
-    return m_hitCount;
+    return m_dequeueTime;
 }
 
 /*!
- * @brief This function returns a reference to member hitCount
- * @return Reference to member hitCount
+ * @brief This function returns a reference to member dequeueTime
+ * @return Reference to member dequeueTime
  */
-uint32_t& CounterUAS::TrackUpdateMessage::hitCount()
+uint64_t& CounterUAS::LatencyTrace::dequeueTime()
 {
-    return m_hitCount;
+    return m_dequeueTime;
 }
 
 /*!
- * @brief This function sets a value in member missCount
- * @param _missCount New value for member missCount
+ * @brief This function sets a value in member processedTime
+ * @param _processedTime New value for member processedTime
  */
-void CounterUAS::TrackUpdateMessage::missCount(
-        uint32_t _missCount)
+void CounterUAS::LatencyTrace::processedTime(
+        uint64_t _processedTime)
 {
-    m_missCount = _missCount;
+    m_processedTime = _processedTime;
 }
 
 /*!
- * @brief This function returns the value of member missCount
- * @return Value of member missCount
+ * @brief This function returns the value of member processedTime
+ * @return Value of member processedTime
  */
-uint32_t CounterUAS::TrackUpdateMessage::missCount() const
+uint64_t CounterUAS::LatencyTrace::processedTime() const
 {
-    return m_missCount;
+    return m_processedTime;
 }
 
 /*!
- * @brief This function returns a reference to member missCount
- * @return Reference to member missCount
+ * @brief This function returns a reference to member processedTime
+ * @return Reference to member processedTime
  */
-uint32_t& CounterUAS::TrackUpdateMessage::missCount()
+uint64_t& CounterUAS::LatencyTrace::processedTime()
 {
-    return m_missCount;
+    return m_processedTime;
 }
 
 /*!
- * @brief This function sets a value in member age
- * @param _age New value for member age
+ * @brief This function sets a value in member publishTime
+ * @param _publishTime New value for member publishTime
  */
-void CounterUAS::TrackUpdateMessage::age(
-        uint32_t _age)
+void CounterUAS::LatencyTrace::publishTime(
+        uint64_t _publishTime)
 {
-    m_age = _age;
+    m_publishTime = _publishTime;
 }
 
 /*!
- * @brief This function returns the value of member age
- * @return Value of member age
+ * @brief This function returns the value of member publishTime
+ * @return Value of member publishTime
  */
-uint32_t CounterUAS::TrackUpdateMessage::age() const
+uint64_t CounterUAS::LatencyTrace::publishTime() const
 {
-    return m_age;
+    return m_publishTime;
 }
 
 /*!
- * @brief This function returns a reference to member age
- * @return Reference to member age
+ * @brief This function returns a reference to member publishTime
+ * @return Reference to member publishTime
  */
-uint32_t& CounterUAS::TrackUpdateMessage::age()
+uint64_t& CounterUAS::LatencyTrace::publishTime()
 {
-    return m_age;
+    return m_publishTime;
 }
 
 
-size_t CounterUAS::TrackUpdateMessage::getKeyMaxCdrSerializedSize(
+size_t CounterUAS::LatencyTrace::getKeyMaxCdrSerializedSize(
         size_t current_alignment)
 {
     size_t current_align = current_alignment;
@@ -1744,95 +1597,205 @@ size_t CounterUAS::TrackUpdateMessage::getKeyMaxCdrSerializedSize(
     return current_align;
 }
 
-bool CounterUAS::TrackUpdateMessage::isKeyDefined()
+bool CounterUAS::LatencyTrace::isKeyDefined()
 {
     return false;
 }
 
-void CounterUAS::TrackUpdateMessage::serializeKey(
+void CounterUAS::LatencyTrace::serializeKey(
         eprosima::fastcdr::Cdr& scdr) const
 {
     (void) scdr;
-                       
+        
 }
 
-
-CounterUAS::TrackTableMessage::TrackTableMessage()
+CounterUAS::TrackUpdateMessage::TrackUpdateMessage()
 {
-    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@77e9807f
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@255b53dc
     m_messageId = 0;
-    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@448ff1a8
-    m_timestamp = 0;
-    // m_numTracks com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1a38c59b
-    m_numTracks = 0;
-    // m_tracks com.eprosima.idl.parser.typecode.SequenceTypeCode@7f77e91b
-
+    // m_trackId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1dd92fe2
+    m_trackId = 0;
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6b53e23f
+    m_timestamp = 0;
+    // m_status com.eprosima.idl.parser.typecode.EnumTypeCode@1b68b9a4
+    m_status = CounterUAS::TRACK_TENTATIVE;
+    // m_classification com.eprosima.idl.parser.typecode.EnumTypeCode@4f9a3314
+    m_classification = CounterUAS::CLASS_UNKNOWN;
+    // m_range com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3b2c72c2
+    m_range = 0.0;
+    // m_azimuth com.eprosima.idl.parser.typecode.PrimitiveTypeCode@491666ad
+    m_azimuth = 0.0;
+    // m_elevation com.eprosima.idl.parser.typecode.PrimitiveTypeCode@176d53b2
+    m_elevation = 0.0;
+    // m_rangeRate com.eprosima.idl.parser.typecode.PrimitiveTypeCode@971d0d8
+    m_rangeRate = 0.0;
+    // m_x com.eprosima.idl.parser.typecode.PrimitiveTypeCode@51931956
+    m_x = 0.0;
+    // m_y com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2b4a2ec7
+    m_y = 0.0;
+    // m_z com.eprosima.idl.parser.typecode.PrimitiveTypeCode@564718df
+    m_z = 0.0;
+    // m_vx com.eprosima.idl.parser.typecode.PrimitiveTypeCode@51b7e5df
+    m_vx = 0.0;
+    // m_vy com.eprosima.idl.parser.typecode.PrimitiveTypeCode@18a70f16
+    m_vy = 0.0;
+    // m_vz com.eprosima.idl.parser.typecode.PrimitiveTypeCode@62e136d3
+    m_vz = 0.0;
+    // m_trackQuality com.eprosima.idl.parser.typecode.PrimitiveTypeCode@c8e4bb0
+    m_trackQuality = 0.0;
+    // m_hitCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6279cee3
+    m_hitCount = 0;
+    // m_missCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4206a205
+    m_missCount = 0;
+    // m_age com.eprosima.idl.parser.typecode.PrimitiveTypeCode@29ba4338
+    m_age = 0;
+    // m_trace com.eprosima.idl.parser.typecode.StructTypeCode@1f099397
 
 }
 
-CounterUAS::TrackTableMessage::~TrackTableMessage()
+CounterUAS::TrackUpdateMessage::~TrackUpdateMessage()
 {
 
 
 
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
 }
 
-CounterUAS::TrackTableMessage::TrackTableMessage(
-        const TrackTableMessage& x)
+CounterUAS::TrackUpdateMessage::TrackUpdateMessage(
+        const TrackUpdateMessage& x)
 {
     m_messageId = x.m_messageId;
+    m_trackId = x.m_trackId;
     m_timestamp = x.m_timestamp;
-    m_numTracks = x.m_numTracks;
-    m_tracks = x.m_tracks;
+    m_status = x.m_status;
+    m_classification = x.m_classification;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_rangeRate = x.m_rangeRate;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+    m_vx = x.m_vx;
+    m_vy = x.m_vy;
+    m_vz = x.m_vz;
+    m_trackQuality = x.m_trackQuality;
+    m_hitCount = x.m_hitCount;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+    m_trace = x.m_trace;
 }
 
-CounterUAS::TrackTableMessage::TrackTableMessage(
-        TrackTableMessage&& x) noexcept 
+CounterUAS::TrackUpdateMessage::TrackUpdateMessage(
+        TrackUpdateMessage&& x) noexcept 
 {
     m_messageId = x.m_messageId;
+    m_trackId = x.m_trackId;
     m_timestamp = x.m_timestamp;
-    m_numTracks = x.m_numTracks;
-    m_tracks = std::move(x.m_tracks);
+    m_status = x.m_status;
+    m_classification = x.m_classification;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_rangeRate = x.m_rangeRate;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+    m_vx = x.m_vx;
+    m_vy = x.m_vy;
+    m_vz = x.m_vz;
+    m_trackQuality = x.m_trackQuality;
+    m_hitCount = x.m_hitCount;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+    m_trace = std::move(x.m_trace);
 }
 
-CounterUAS::TrackTableMessage& CounterUAS::TrackTableMessage::operator =(
-        const TrackTableMessage& x)
+CounterUAS::TrackUpdateMessage& CounterUAS::TrackUpdateMessage::operator =(
+        const TrackUpdateMessage& x)
 {
 
     m_messageId = x.m_messageId;
+    m_trackId = x.m_trackId;
     m_timestamp = x.m_timestamp;
-    m_numTracks = x.m_numTracks;
-    m_tracks = x.m_tracks;
+    m_status = x.m_status;
+    m_classification = x.m_classification;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_rangeRate = x.m_rangeRate;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+    m_vx = x.m_vx;
+    m_vy = x.m_vy;
+    m_vz = x.m_vz;
+    m_trackQuality = x.m_trackQuality;
+    m_hitCount = x.m_hitCount;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+    m_trace = x.m_trace;
 
     return *this;
 }
 
-CounterUAS::TrackTableMessage& CounterUAS::TrackTableMessage::operator =(
-        TrackTableMessage&& x) noexcept
+CounterUAS::TrackUpdateMessage& CounterUAS::TrackUpdateMessage::operator =(
+        TrackUpdateMessage&& x) noexcept
 {
 
     m_messageId = x.m_messageId;
+    m_trackId = x.m_trackId;
     m_timestamp = x.m_timestamp;
-    m_numTracks = x.m_numTracks;
-    m_tracks = std::move(x.m_tracks);
+    m_status = x.m_status;
+    m_classification = x.m_classification;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_rangeRate = x.m_rangeRate;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+    m_vx = x.m_vx;
+    m_vy = x.m_vy;
+    m_vz = x.m_vz;
+    m_trackQuality = x.m_trackQuality;
+    m_hitCount = x.m_hitCount;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+    m_trace = std::move(x.m_trace);
 
     return *this;
 }
 
-bool CounterUAS::TrackTableMessage::operator ==(
-        const TrackTableMessage& x) const
+bool CounterUAS::TrackUpdateMessage::operator ==(
+        const TrackUpdateMessage& x) const
 {
 
-    return (m_messageId == x.m_messageId && m_timestamp == x.m_timestamp && m_numTracks == x.m_numTracks && m_tracks == x.m_tracks);
+    return (m_messageId == x.m_messageId && m_trackId == x.m_trackId && m_timestamp == x.m_timestamp && m_status == x.m_status && m_classification == x.m_classification && m_range == x.m_range && m_azimuth == x.m_azimuth && m_elevation == x.m_elevation && m_rangeRate == x.m_rangeRate && m_x == x.m_x && m_y == x.m_y && m_z == x.m_z && m_vx == x.m_vx && m_vy == x.m_vy && m_vz == x.m_vz && m_trackQuality == x.m_trackQuality && m_hitCount == x.m_hitCount && m_missCount == x.m_missCount && m_age == x.m_age && m_trace == x.m_trace);
 }
 
-bool CounterUAS::TrackTableMessage::operator !=(
-        const TrackTableMessage& x) const
+bool CounterUAS::TrackUpdateMessage::operator !=(
+        const TrackUpdateMessage& x) const
 {
     return !(*this == x);
 }
 
-size_t CounterUAS::TrackTableMessage::getMaxCdrSerializedSize(
+size_t CounterUAS::TrackUpdateMessage::getMaxCdrSerializedSize(
         size_t current_alignment)
 {
     size_t initial_alignment = current_alignment;
@@ -1841,6 +1804,9 @@ size_t CounterUAS::TrackTableMessage::getMaxCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
@@ -1850,16 +1816,57 @@ size_t CounterUAS::TrackTableMessage::getMaxCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    for(size_t a = 0; a < 100; ++a)
-    {
-        current_alignment += CounterUAS::TrackUpdateMessage::getMaxCdrSerializedSize(current_alignment);}
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += CounterUAS::LatencyTrace::getMaxCdrSerializedSize(current_alignment);
+
 
 
     return current_alignment - initial_alignment;
 }
 
-size_t CounterUAS::TrackTableMessage::getCdrSerializedSize(
-        const CounterUAS::TrackTableMessage& data,
+size_t CounterUAS::TrackUpdateMessage::getCdrSerializedSize(
+        const CounterUAS::TrackUpdateMessage& data,
         size_t current_alignment)
 {
     (void)data;
@@ -1869,6 +1876,9 @@ size_t CounterUAS::TrackTableMessage::getCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
@@ -1878,68 +1888,179 @@ size_t CounterUAS::TrackTableMessage::getCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    for(size_t a = 0; a < data.tracks().size(); ++a)
-    {
-        current_alignment += CounterUAS::TrackUpdateMessage::getCdrSerializedSize(data.tracks().at(a), current_alignment);}
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
-    return current_alignment - initial_alignment;
-}
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
-void CounterUAS::TrackTableMessage::serialize(
-        eprosima::fastcdr::Cdr& scdr) const
-{
 
-    scdr << m_messageId;
-    scdr << m_timestamp;
-    scdr << m_numTracks;
-    scdr << m_tracks;
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
-}
 
-void CounterUAS::TrackTableMessage::deserialize(
-        eprosima::fastcdr::Cdr& dcdr)
-{
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
-    dcdr >> m_messageId;
-    dcdr >> m_timestamp;
-    dcdr >> m_numTracks;
-    dcdr >> m_tracks;
-}
 
-/*!
- * @brief This function sets a value in member messageId
- * @param _messageId New value for member messageId
- */
-void CounterUAS::TrackTableMessage::messageId(
-        uint32_t _messageId)
-{
-    m_messageId = _messageId;
-}
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
-/*!
- * @brief This function returns the value of member messageId
- * @return Value of member messageId
- */
-uint32_t CounterUAS::TrackTableMessage::messageId() const
-{
-    return m_messageId;
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += CounterUAS::LatencyTrace::getCdrSerializedSize(data.trace(), current_alignment);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+void CounterUAS::TrackUpdateMessage::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_messageId;
+    scdr << m_trackId;
+    scdr << m_timestamp;
+    scdr << (uint32_t)m_status;
+    scdr << (uint32_t)m_classification;
+    scdr << m_range;
+    scdr << m_azimuth;
+    scdr << m_elevation;
+    scdr << m_rangeRate;
+    scdr << m_x;
+    scdr << m_y;
+    scdr << m_z;
+    scdr << m_vx;
+    scdr << m_vy;
+    scdr << m_vz;
+    scdr << m_trackQuality;
+    scdr << m_hitCount;
+    scdr << m_missCount;
+    scdr << m_age;
+    scdr << m_trace;
+
+}
+
+void CounterUAS::TrackUpdateMessage::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_messageId;
+    dcdr >> m_trackId;
+    dcdr >> m_timestamp;
+    {
+        uint32_t enum_value = 0;
+        dcdr >> enum_value;
+        m_status = (CounterUAS::TrackStatus)enum_value;
+    }
+
+    {
+        uint32_t enum_value = 0;
+        dcdr >> enum_value;
+        m_classification = (CounterUAS::TrackClassification)enum_value;
+    }
+
+    dcdr >> m_range;
+    dcdr >> m_azimuth;
+    dcdr >> m_elevation;
+    dcdr >> m_rangeRate;
+    dcdr >> m_x;
+    dcdr >> m_y;
+    dcdr >> m_z;
+    dcdr >> m_vx;
+    dcdr >> m_vy;
+    dcdr >> m_vz;
+    dcdr >> m_trackQuality;
+    dcdr >> m_hitCount;
+    dcdr >> m_missCount;
+    dcdr >> m_age;
+    dcdr >> m_trace;
+}
+
+/*!
+ * @brief This function sets a value in member messageId
+ * @param _messageId New value for member messageId
+ */
+void CounterUAS::TrackUpdateMessage::messageId(
+        uint32_t _messageId)
+{
+    m_messageId = _messageId;
+}
+
+/*!
+ * @brief This function returns the value of member messageId
+ * @return Value of member messageId
+ */
+uint32_t CounterUAS::TrackUpdateMessage::messageId() const
+{
+    return m_messageId;
 }
 
 /*!
  * @brief This function returns a reference to member messageId
  * @return Reference to member messageId
  */
-uint32_t& CounterUAS::TrackTableMessage::messageId()
+uint32_t& CounterUAS::TrackUpdateMessage::messageId()
 {
     return m_messageId;
 }
 
+/*!
+ * @brief This function sets a value in member trackId
+ * @param _trackId New value for member trackId
+ */
+void CounterUAS::TrackUpdateMessage::trackId(
+        uint32_t _trackId)
+{
+    m_trackId = _trackId;
+}
+
+/*!
+ * @brief This function returns the value of member trackId
+ * @return Value of member trackId
+ */
+uint32_t CounterUAS::TrackUpdateMessage::trackId() const
+{
+    return m_trackId;
+}
+
+/*!
+ * @brief This function returns a reference to member trackId
+ * @return Reference to member trackId
+ */
+uint32_t& CounterUAS::TrackUpdateMessage::trackId()
+{
+    return m_trackId;
+}
+
 /*!
  * @brief This function sets a value in member timestamp
  * @param _timestamp New value for member timestamp
  */
-void CounterUAS::TrackTableMessage::timestamp(
+void CounterUAS::TrackUpdateMessage::timestamp(
         uint64_t _timestamp)
 {
     m_timestamp = _timestamp;
@@ -1949,7 +2070,7 @@ void CounterUAS::TrackTableMessage::timestamp(
  * @brief This function returns the value of member timestamp
  * @return Value of member timestamp
  */
-uint64_t CounterUAS::TrackTableMessage::timestamp() const
+uint64_t CounterUAS::TrackUpdateMessage::timestamp() const
 {
     return m_timestamp;
 }
@@ -1958,131 +2079,3808 @@ uint64_t CounterUAS::TrackTableMessage::timestamp() const
  * @brief This function returns a reference to member timestamp
  * @return Reference to member timestamp
  */
-uint64_t& CounterUAS::TrackTableMessage::timestamp()
+uint64_t& CounterUAS::TrackUpdateMessage::timestamp()
 {
     return m_timestamp;
 }
 
 /*!
- * @brief This function sets a value in member numTracks
- * @param _numTracks New value for member numTracks
+ * @brief This function sets a value in member status
+ * @param _status New value for member status
  */
-void CounterUAS::TrackTableMessage::numTracks(
-        uint32_t _numTracks)
+void CounterUAS::TrackUpdateMessage::status(
+        CounterUAS::TrackStatus _status)
 {
-    m_numTracks = _numTracks;
+    m_status = _status;
 }
 
 /*!
- * @brief This function returns the value of member numTracks
- * @return Value of member numTracks
+ * @brief This function returns the value of member status
+ * @return Value of member status
  */
-uint32_t CounterUAS::TrackTableMessage::numTracks() const
+CounterUAS::TrackStatus CounterUAS::TrackUpdateMessage::status() const
 {
-    return m_numTracks;
+    return m_status;
 }
 
 /*!
- * @brief This function returns a reference to member numTracks
- * @return Reference to member numTracks
+ * @brief This function returns a reference to member status
+ * @return Reference to member status
  */
-uint32_t& CounterUAS::TrackTableMessage::numTracks()
+CounterUAS::TrackStatus& CounterUAS::TrackUpdateMessage::status()
 {
-    return m_numTracks;
+    return m_status;
 }
 
 /*!
- * @brief This function copies the value in member tracks
- * @param _tracks New value to be copied in member tracks
+ * @brief This function sets a value in member classification
+ * @param _classification New value for member classification
  */
-void CounterUAS::TrackTableMessage::tracks(
-        const std::vector<CounterUAS::TrackUpdateMessage>& _tracks)
+void CounterUAS::TrackUpdateMessage::classification(
+        CounterUAS::TrackClassification _classification)
 {
-    m_tracks = _tracks;
+    m_classification = _classification;
 }
 
 /*!
- * @brief This function moves the value in member tracks
- * @param _tracks New value to be moved in member tracks
+ * @brief This function returns the value of member classification
+ * @return Value of member classification
  */
-void CounterUAS::TrackTableMessage::tracks(
-        std::vector<CounterUAS::TrackUpdateMessage>&& _tracks)
+CounterUAS::TrackClassification CounterUAS::TrackUpdateMessage::classification() const
 {
-    m_tracks = std::move(_tracks);
+    return m_classification;
 }
 
 /*!
- * @brief This function returns a constant reference to member tracks
- * @return Constant reference to member tracks
+ * @brief This function returns a reference to member classification
+ * @return Reference to member classification
  */
-const std::vector<CounterUAS::TrackUpdateMessage>& CounterUAS::TrackTableMessage::tracks() const
+CounterUAS::TrackClassification& CounterUAS::TrackUpdateMessage::classification()
 {
-    return m_tracks;
+    return m_classification;
 }
 
 /*!
- * @brief This function returns a reference to member tracks
- * @return Reference to member tracks
+ * @brief This function sets a value in member range
+ * @param _range New value for member range
  */
-std::vector<CounterUAS::TrackUpdateMessage>& CounterUAS::TrackTableMessage::tracks()
+void CounterUAS::TrackUpdateMessage::range(
+        double _range)
 {
-    return m_tracks;
+    m_range = _range;
 }
 
-size_t CounterUAS::TrackTableMessage::getKeyMaxCdrSerializedSize(
-        size_t current_alignment)
+/*!
+ * @brief This function returns the value of member range
+ * @return Value of member range
+ */
+double CounterUAS::TrackUpdateMessage::range() const
 {
-    size_t current_align = current_alignment;
-
-
-
-    return current_align;
+    return m_range;
 }
 
-bool CounterUAS::TrackTableMessage::isKeyDefined()
+/*!
+ * @brief This function returns a reference to member range
+ * @return Reference to member range
+ */
+double& CounterUAS::TrackUpdateMessage::range()
 {
-    return false;
+    return m_range;
 }
 
-void CounterUAS::TrackTableMessage::serializeKey(
-        eprosima::fastcdr::Cdr& scdr) const
+/*!
+ * @brief This function sets a value in member azimuth
+ * @param _azimuth New value for member azimuth
+ */
+void CounterUAS::TrackUpdateMessage::azimuth(
+        double _azimuth)
 {
-    (void) scdr;
-        
+    m_azimuth = _azimuth;
 }
 
+/*!
+ * @brief This function returns the value of member azimuth
+ * @return Value of member azimuth
+ */
+double CounterUAS::TrackUpdateMessage::azimuth() const
+{
+    return m_azimuth;
+}
 
-CounterUAS::ClusterData::ClusterData()
+/*!
+ * @brief This function returns a reference to member azimuth
+ * @return Reference to member azimuth
+ */
+double& CounterUAS::TrackUpdateMessage::azimuth()
+{
+    return m_azimuth;
+}
+
+/*!
+ * @brief This function sets a value in member elevation
+ * @param _elevation New value for member elevation
+ */
+void CounterUAS::TrackUpdateMessage::elevation(
+        double _elevation)
+{
+    m_elevation = _elevation;
+}
+
+/*!
+ * @brief This function returns the value of member elevation
+ * @return Value of member elevation
+ */
+double CounterUAS::TrackUpdateMessage::elevation() const
+{
+    return m_elevation;
+}
+
+/*!
+ * @brief This function returns a reference to member elevation
+ * @return Reference to member elevation
+ */
+double& CounterUAS::TrackUpdateMessage::elevation()
+{
+    return m_elevation;
+}
+
+/*!
+ * @brief This function sets a value in member rangeRate
+ * @param _rangeRate New value for member rangeRate
+ */
+void CounterUAS::TrackUpdateMessage::rangeRate(
+        double _rangeRate)
+{
+    m_rangeRate = _rangeRate;
+}
+
+/*!
+ * @brief This function returns the value of member rangeRate
+ * @return Value of member rangeRate
+ */
+double CounterUAS::TrackUpdateMessage::rangeRate() const
+{
+    return m_rangeRate;
+}
+
+/*!
+ * @brief This function returns a reference to member rangeRate
+ * @return Reference to member rangeRate
+ */
+double& CounterUAS::TrackUpdateMessage::rangeRate()
+{
+    return m_rangeRate;
+}
+
+/*!
+ * @brief This function sets a value in member x
+ * @param _x New value for member x
+ */
+void CounterUAS::TrackUpdateMessage::x(
+        double _x)
+{
+    m_x = _x;
+}
+
+/*!
+ * @brief This function returns the value of member x
+ * @return Value of member x
+ */
+double CounterUAS::TrackUpdateMessage::x() const
+{
+    return m_x;
+}
+
+/*!
+ * @brief This function returns a reference to member x
+ * @return Reference to member x
+ */
+double& CounterUAS::TrackUpdateMessage::x()
+{
+    return m_x;
+}
+
+/*!
+ * @brief This function sets a value in member y
+ * @param _y New value for member y
+ */
+void CounterUAS::TrackUpdateMessage::y(
+        double _y)
+{
+    m_y = _y;
+}
+
+/*!
+ * @brief This function returns the value of member y
+ * @return Value of member y
+ */
+double CounterUAS::TrackUpdateMessage::y() const
+{
+    return m_y;
+}
+
+/*!
+ * @brief This function returns a reference to member y
+ * @return Reference to member y
+ */
+double& CounterUAS::TrackUpdateMessage::y()
+{
+    return m_y;
+}
+
+/*!
+ * @brief This function sets a value in member z
+ * @param _z New value for member z
+ */
+void CounterUAS::TrackUpdateMessage::z(
+        double _z)
+{
+    m_z = _z;
+}
+
+/*!
+ * @brief This function returns the value of member z
+ * @return Value of member z
+ */
+double CounterUAS::TrackUpdateMessage::z() const
+{
+    return m_z;
+}
+
+/*!
+ * @brief This function returns a reference to member z
+ * @return Reference to member z
+ */
+double& CounterUAS::TrackUpdateMessage::z()
+{
+    return m_z;
+}
+
+/*!
+ * @brief This function sets a value in member vx
+ * @param _vx New value for member vx
+ */
+void CounterUAS::TrackUpdateMessage::vx(
+        double _vx)
+{
+    m_vx = _vx;
+}
+
+/*!
+ * @brief This function returns the value of member vx
+ * @return Value of member vx
+ */
+double CounterUAS::TrackUpdateMessage::vx() const
+{
+    return m_vx;
+}
+
+/*!
+ * @brief This function returns a reference to member vx
+ * @return Reference to member vx
+ */
+double& CounterUAS::TrackUpdateMessage::vx()
+{
+    return m_vx;
+}
+
+/*!
+ * @brief This function sets a value in member vy
+ * @param _vy New value for member vy
+ */
+void CounterUAS::TrackUpdateMessage::vy(
+        double _vy)
+{
+    m_vy = _vy;
+}
+
+/*!
+ * @brief This function returns the value of member vy
+ * @return Value of member vy
+ */
+double CounterUAS::TrackUpdateMessage::vy() const
+{
+    return m_vy;
+}
+
+/*!
+ * @brief This function returns a reference to member vy
+ * @return Reference to member vy
+ */
+double& CounterUAS::TrackUpdateMessage::vy()
+{
+    return m_vy;
+}
+
+/*!
+ * @brief This function sets a value in member vz
+ * @param _vz New value for member vz
+ */
+void CounterUAS::TrackUpdateMessage::vz(
+        double _vz)
+{
+    m_vz = _vz;
+}
+
+/*!
+ * @brief This function returns the value of member vz
+ * @return Value of member vz
+ */
+double CounterUAS::TrackUpdateMessage::vz() const
+{
+    return m_vz;
+}
+
+/*!
+ * @brief This function returns a reference to member vz
+ * @return Reference to member vz
+ */
+double& CounterUAS::TrackUpdateMessage::vz()
+{
+    return m_vz;
+}
+
+/*!
+ * @brief This function sets a value in member trackQuality
+ * @param _trackQuality New value for member trackQuality
+ */
+void CounterUAS::TrackUpdateMessage::trackQuality(
+        double _trackQuality)
+{
+    m_trackQuality = _trackQuality;
+}
+
+/*!
+ * @brief This function returns the value of member trackQuality
+ * @return Value of member trackQuality
+ */
+double CounterUAS::TrackUpdateMessage::trackQuality() const
+{
+    return m_trackQuality;
+}
+
+/*!
+ * @brief This function returns a reference to member trackQuality
+ * @return Reference to member trackQuality
+ */
+double& CounterUAS::TrackUpdateMessage::trackQuality()
+{
+    return m_trackQuality;
+}
+
+/*!
+ * @brief This function sets a value in member hitCount
+ * @param _hitCount New value for member hitCount
+ */
+void CounterUAS::TrackUpdateMessage::hitCount(
+        uint32_t _hitCount)
+{
+    m_hitCount = _hitCount;
+}
+
+/*!
+ * @brief This function returns the value of member hitCount
+ * @return Value of member hitCount
+ */
+uint32_t CounterUAS::TrackUpdateMessage::hitCount() const
+{
+    return m_hitCount;
+}
+
+/*!
+ * @brief This function returns a reference to member hitCount
+ * @return Reference to member hitCount
+ */
+uint32_t& CounterUAS::TrackUpdateMessage::hitCount()
+{
+    return m_hitCount;
+}
+
+/*!
+ * @brief This function sets a value in member missCount
+ * @param _missCount New value for member missCount
+ */
+void CounterUAS::TrackUpdateMessage::missCount(
+        uint32_t _missCount)
+{
+    m_missCount = _missCount;
+}
+
+/*!
+ * @brief This function returns the value of member missCount
+ * @return Value of member missCount
+ */
+uint32_t CounterUAS::TrackUpdateMessage::missCount() const
+{
+    return m_missCount;
+}
+
+/*!
+ * @brief This function returns a reference to member missCount
+ * @return Reference to member missCount
+ */
+uint32_t& CounterUAS::TrackUpdateMessage::missCount()
+{
+    return m_missCount;
+}
+
+/*!
+ * @brief This function sets a value in member age
+ * @param _age New value for member age
+ */
+void CounterUAS::TrackUpdateMessage::age(
+        uint32_t _age)
+{
+    m_age = _age;
+}
+
+/*!
+ * @brief This function returns the value of member age
+ * @return Value of member age
+ */
+uint32_t CounterUAS::TrackUpdateMessage::age() const
+{
+    return m_age;
+}
+
+/*!
+ * @brief This function returns a reference to member age
+ * @return Reference to member age
+ */
+uint32_t& CounterUAS::TrackUpdateMessage::age()
+{
+    return m_age;
+}
+/*!
+ * @brief This function copies the value in member trace
+ * @param _trace New value to be copied in member trace
+ */
+void CounterUAS::TrackUpdateMessage::trace(
+        const CounterUAS::LatencyTrace& _trace)
+{
+    m_trace = _trace;
+}
+
+/*!
+ * @brief This function moves the value in member trace
+ * @param _trace New value to be moved in member trace
+ */
+void CounterUAS::TrackUpdateMessage::trace(
+        CounterUAS::LatencyTrace&& _trace)
+{
+    m_trace = std::move(_trace);
+}
+
+/*!
+ * @brief This function returns a constant reference to member trace
+ * @return Constant reference to member trace
+ */
+const CounterUAS::LatencyTrace& CounterUAS::TrackUpdateMessage::trace() const
+{
+    return m_trace;
+}
+
+/*!
+ * @brief This function returns a reference to member trace
+ * @return Reference to member trace
+ */
+CounterUAS::LatencyTrace& CounterUAS::TrackUpdateMessage::trace()
+{
+    return m_trace;
+}
+
+size_t CounterUAS::TrackUpdateMessage::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+    current_align += 4 + eprosima::fastcdr::Cdr::alignment(current_align, 4);
+
+
+    return current_align;
+}
+
+bool CounterUAS::TrackUpdateMessage::isKeyDefined()
+{
+    return true;
+}
+
+void CounterUAS::TrackUpdateMessage::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+     scdr << m_trackId;
+                       
+}
+
+
+CounterUAS::TrackTableMessage::TrackTableMessage()
+{
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@a58226b
+    m_messageId = 0;
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@8de4ab47
+    m_timestamp = 0;
+    // m_numTracks com.eprosima.idl.parser.typecode.PrimitiveTypeCode@599cd23b
+    m_numTracks = 0;
+    // m_tracks com.eprosima.idl.parser.typecode.SequenceTypeCode@ba6ace6
+
+    // m_sensorId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2b5ebaa0
+    m_sensorId = 0;
+    // m_trace com.eprosima.idl.parser.typecode.StructTypeCode@58a540da
+
+}
+
+CounterUAS::TrackTableMessage::~TrackTableMessage()
+{
+
+
+
+
+
+}
+
+CounterUAS::TrackTableMessage::TrackTableMessage(
+        const TrackTableMessage& x)
+{
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numTracks = x.m_numTracks;
+    m_tracks = x.m_tracks;
+    m_sensorId = x.m_sensorId;
+    m_trace = x.m_trace;
+}
+
+CounterUAS::TrackTableMessage::TrackTableMessage(
+        TrackTableMessage&& x) noexcept 
+{
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numTracks = x.m_numTracks;
+    m_tracks = std::move(x.m_tracks);
+    m_sensorId = x.m_sensorId;
+    m_trace = std::move(x.m_trace);
+}
+
+CounterUAS::TrackTableMessage& CounterUAS::TrackTableMessage::operator =(
+        const TrackTableMessage& x)
+{
+
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numTracks = x.m_numTracks;
+    m_tracks = x.m_tracks;
+    m_sensorId = x.m_sensorId;
+    m_trace = x.m_trace;
+
+    return *this;
+}
+
+CounterUAS::TrackTableMessage& CounterUAS::TrackTableMessage::operator =(
+        TrackTableMessage&& x) noexcept
+{
+
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numTracks = x.m_numTracks;
+    m_tracks = std::move(x.m_tracks);
+    m_sensorId = x.m_sensorId;
+    m_trace = std::move(x.m_trace);
+
+    return *this;
+}
+
+bool CounterUAS::TrackTableMessage::operator ==(
+        const TrackTableMessage& x) const
+{
+
+    return (m_messageId == x.m_messageId && m_timestamp == x.m_timestamp && m_numTracks == x.m_numTracks && m_tracks == x.m_tracks && m_sensorId == x.m_sensorId && m_trace == x.m_trace);
+}
+
+bool CounterUAS::TrackTableMessage::operator !=(
+        const TrackTableMessage& x) const
+{
+    return !(*this == x);
+}
+
+size_t CounterUAS::TrackTableMessage::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    for(size_t a = 0; a < 100; ++a)
+    {
+        current_alignment += CounterUAS::TrackUpdateMessage::getMaxCdrSerializedSize(current_alignment);}
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += CounterUAS::LatencyTrace::getMaxCdrSerializedSize(current_alignment);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t CounterUAS::TrackTableMessage::getCdrSerializedSize(
+        const CounterUAS::TrackTableMessage& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    for(size_t a = 0; a < data.tracks().size(); ++a)
+    {
+        current_alignment += CounterUAS::TrackUpdateMessage::getCdrSerializedSize(data.tracks().at(a), current_alignment);}
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += CounterUAS::LatencyTrace::getCdrSerializedSize(data.trace(), current_alignment);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+void CounterUAS::TrackTableMessage::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_messageId;
+    scdr << m_timestamp;
+    scdr << m_numTracks;
+    scdr << m_tracks;
+    scdr << m_sensorId;
+    scdr << m_trace;
+
+}
+
+void CounterUAS::TrackTableMessage::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_messageId;
+    dcdr >> m_timestamp;
+    dcdr >> m_numTracks;
+    dcdr >> m_tracks;
+    dcdr >> m_sensorId;
+    dcdr >> m_trace;
+}
+
+/*!
+ * @brief This function sets a value in member messageId
+ * @param _messageId New value for member messageId
+ */
+void CounterUAS::TrackTableMessage::messageId(
+        uint32_t _messageId)
+{
+    m_messageId = _messageId;
+}
+
+/*!
+ * @brief This function returns the value of member messageId
+ * @return Value of member messageId
+ */
+uint32_t CounterUAS::TrackTableMessage::messageId() const
+{
+    return m_messageId;
+}
+
+/*!
+ * @brief This function returns a reference to member messageId
+ * @return Reference to member messageId
+ */
+uint32_t& CounterUAS::TrackTableMessage::messageId()
+{
+    return m_messageId;
+}
+
+/*!
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
+ */
+void CounterUAS::TrackTableMessage::timestamp(
+        uint64_t _timestamp)
+{
+    m_timestamp = _timestamp;
+}
+
+/*!
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
+ */
+uint64_t CounterUAS::TrackTableMessage::timestamp() const
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
+ */
+uint64_t& CounterUAS::TrackTableMessage::timestamp()
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function sets a value in member numTracks
+ * @param _numTracks New value for member numTracks
+ */
+void CounterUAS::TrackTableMessage::numTracks(
+        uint32_t _numTracks)
+{
+    m_numTracks = _numTracks;
+}
+
+/*!
+ * @brief This function returns the value of member numTracks
+ * @return Value of member numTracks
+ */
+uint32_t CounterUAS::TrackTableMessage::numTracks() const
+{
+    return m_numTracks;
+}
+
+/*!
+ * @brief This function returns a reference to member numTracks
+ * @return Reference to member numTracks
+ */
+uint32_t& CounterUAS::TrackTableMessage::numTracks()
+{
+    return m_numTracks;
+}
+
+/*!
+ * @brief This function copies the value in member tracks
+ * @param _tracks New value to be copied in member tracks
+ */
+void CounterUAS::TrackTableMessage::tracks(
+        const std::vector<CounterUAS::TrackUpdateMessage>& _tracks)
+{
+    m_tracks = _tracks;
+}
+
+/*!
+ * @brief This function moves the value in member tracks
+ * @param _tracks New value to be moved in member tracks
+ */
+void CounterUAS::TrackTableMessage::tracks(
+        std::vector<CounterUAS::TrackUpdateMessage>&& _tracks)
+{
+    m_tracks = std::move(_tracks);
+}
+
+/*!
+ * @brief This function returns a constant reference to member tracks
+ * @return Constant reference to member tracks
+ */
+const std::vector<CounterUAS::TrackUpdateMessage>& CounterUAS::TrackTableMessage::tracks() const
+{
+    return m_tracks;
+}
+
+/*!
+ * @brief This function returns a reference to member tracks
+ * @return Reference to member tracks
+ */
+std::vector<CounterUAS::TrackUpdateMessage>& CounterUAS::TrackTableMessage::tracks()
+{
+    return m_tracks;
+}
+/*!
+ * @brief This function sets a value in member sensorId
+ * @param _sensorId New value for member sensorId
+ */
+void CounterUAS::TrackTableMessage::sensorId(
+        uint32_t _sensorId)
+{
+    m_sensorId = _sensorId;
+}
+
+/*!
+ * @brief This function returns the value of member sensorId
+ * @return Value of member sensorId
+ */
+uint32_t CounterUAS::TrackTableMessage::sensorId() const
+{
+    return m_sensorId;
+}
+
+/*!
+ * @brief This function returns a reference to member sensorId
+ * @return Reference to member sensorId
+ */
+uint32_t& CounterUAS::TrackTableMessage::sensorId()
+{
+    return m_sensorId;
+}
+/*!
+ * @brief This function copies the value in member trace
+ * @param _trace New value to be copied in member trace
+ */
+void CounterUAS::TrackTableMessage::trace(
+        const CounterUAS::LatencyTrace& _trace)
+{
+    m_trace = _trace;
+}
+
+/*!
+ * @brief This function moves the value in member trace
+ * @param _trace New value to be moved in member trace
+ */
+void CounterUAS::TrackTableMessage::trace(
+        CounterUAS::LatencyTrace&& _trace)
+{
+    m_trace = std::move(_trace);
+}
+
+/*!
+ * @brief This function returns a constant reference to member trace
+ * @return Constant reference to member trace
+ */
+const CounterUAS::LatencyTrace& CounterUAS::TrackTableMessage::trace() const
+{
+    return m_trace;
+}
+
+/*!
+ * @brief This function returns a reference to member trace
+ * @return Reference to member trace
+ */
+CounterUAS::LatencyTrace& CounterUAS::TrackTableMessage::trace()
+{
+    return m_trace;
+}
+
+size_t CounterUAS::TrackTableMessage::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+
+    return current_align;
+}
+
+bool CounterUAS::TrackTableMessage::isKeyDefined()
+{
+    return false;
+}
+
+void CounterUAS::TrackTableMessage::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+        
+}
+
+
+CounterUAS::TrackFrameEntry::TrackFrameEntry()
+{
+    // m_trackId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5b0f4fab
+    m_trackId = 0;
+    // m_status com.eprosima.idl.parser.typecode.EnumTypeCode@3dc8fa0c
+    m_status = CounterUAS::TRACK_TENTATIVE;
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@77ef00db
+    m_timestamp = 0;
+    // m_classification com.eprosima.idl.parser.typecode.EnumTypeCode@5be450dd
+    m_classification = CounterUAS::CLASS_UNKNOWN;
+    // m_hitCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@42a1b45c
+    m_hitCount = 0;
+    // m_range com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2e2b9af5
+    m_range = 0.0;
+    // m_azimuth com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5dee7988
+    m_azimuth = 0.0;
+    // m_elevation com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3a31b627
+    m_elevation = 0.0;
+    // m_rangeRate com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5d302ab4
+    m_rangeRate = 0.0;
+    // m_x com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3fee05f
+    m_x = 0.0;
+    // m_y com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6dd90f1c
+    m_y = 0.0;
+    // m_z com.eprosima.idl.parser.typecode.PrimitiveTypeCode@76ec4464
+    m_z = 0.0;
+    // m_vx com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4b59d47
+    m_vx = 0.0;
+    // m_vy com.eprosima.idl.parser.typecode.PrimitiveTypeCode@74a612c8
+    m_vy = 0.0;
+    // m_vz com.eprosima.idl.parser.typecode.PrimitiveTypeCode@15ab5dc5
+    m_vz = 0.0;
+    // m_trackQuality com.eprosima.idl.parser.typecode.PrimitiveTypeCode@7d203358
+    m_trackQuality = 0.0;
+    // m_missCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@7f9ce7c8
+    m_missCount = 0;
+    // m_age com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2c006547
+    m_age = 0;
+
+}
+
+CounterUAS::TrackFrameEntry::~TrackFrameEntry()
+{
+
+}
+
+CounterUAS::TrackFrameEntry::TrackFrameEntry(
+        const TrackFrameEntry& x)
+{
+    m_trackId = x.m_trackId;
+    m_status = x.m_status;
+    m_timestamp = x.m_timestamp;
+    m_classification = x.m_classification;
+    m_hitCount = x.m_hitCount;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_rangeRate = x.m_rangeRate;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+    m_vx = x.m_vx;
+    m_vy = x.m_vy;
+    m_vz = x.m_vz;
+    m_trackQuality = x.m_trackQuality;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+}
+
+CounterUAS::TrackFrameEntry::TrackFrameEntry(
+        TrackFrameEntry&& x) noexcept 
+{
+    m_trackId = x.m_trackId;
+    m_status = x.m_status;
+    m_timestamp = x.m_timestamp;
+    m_classification = x.m_classification;
+    m_hitCount = x.m_hitCount;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_rangeRate = x.m_rangeRate;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+    m_vx = x.m_vx;
+    m_vy = x.m_vy;
+    m_vz = x.m_vz;
+    m_trackQuality = x.m_trackQuality;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+}
+
+CounterUAS::TrackFrameEntry& CounterUAS::TrackFrameEntry::operator =(
+        const TrackFrameEntry& x)
+{
+
+    m_trackId = x.m_trackId;
+    m_status = x.m_status;
+    m_timestamp = x.m_timestamp;
+    m_classification = x.m_classification;
+    m_hitCount = x.m_hitCount;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_rangeRate = x.m_rangeRate;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+    m_vx = x.m_vx;
+    m_vy = x.m_vy;
+    m_vz = x.m_vz;
+    m_trackQuality = x.m_trackQuality;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+
+    return *this;
+}
+
+CounterUAS::TrackFrameEntry& CounterUAS::TrackFrameEntry::operator =(
+        TrackFrameEntry&& x) noexcept
+{
+
+    m_trackId = x.m_trackId;
+    m_status = x.m_status;
+    m_timestamp = x.m_timestamp;
+    m_classification = x.m_classification;
+    m_hitCount = x.m_hitCount;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_rangeRate = x.m_rangeRate;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+    m_vx = x.m_vx;
+    m_vy = x.m_vy;
+    m_vz = x.m_vz;
+    m_trackQuality = x.m_trackQuality;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+
+    return *this;
+}
+
+bool CounterUAS::TrackFrameEntry::operator ==(
+        const TrackFrameEntry& x) const
+{
+
+    return (m_trackId == x.m_trackId && m_status == x.m_status && m_timestamp == x.m_timestamp && m_classification == x.m_classification && m_hitCount == x.m_hitCount && m_range == x.m_range && m_azimuth == x.m_azimuth && m_elevation == x.m_elevation && m_rangeRate == x.m_rangeRate && m_x == x.m_x && m_y == x.m_y && m_z == x.m_z && m_vx == x.m_vx && m_vy == x.m_vy && m_vz == x.m_vz && m_trackQuality == x.m_trackQuality && m_missCount == x.m_missCount && m_age == x.m_age);
+}
+
+bool CounterUAS::TrackFrameEntry::operator !=(
+        const TrackFrameEntry& x) const
+{
+    return !(*this == x);
+}
+
+size_t CounterUAS::TrackFrameEntry::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t CounterUAS::TrackFrameEntry::getCdrSerializedSize(
+        const CounterUAS::TrackFrameEntry& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+void CounterUAS::TrackFrameEntry::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_trackId;
+    scdr << (uint32_t)m_status;
+    scdr << m_timestamp;
+    scdr << (uint32_t)m_classification;
+    scdr << m_hitCount;
+    scdr << m_range;
+    scdr << m_azimuth;
+    scdr << m_elevation;
+    scdr << m_rangeRate;
+    scdr << m_x;
+    scdr << m_y;
+    scdr << m_z;
+    scdr << m_vx;
+    scdr << m_vy;
+    scdr << m_vz;
+    scdr << m_trackQuality;
+    scdr << m_missCount;
+    scdr << m_age;
+
+}
+
+void CounterUAS::TrackFrameEntry::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_trackId;
+    {
+        uint32_t enum_value = 0;
+        dcdr >> enum_value;
+        m_status = (CounterUAS::TrackStatus)enum_value;
+    }
+
+    dcdr >> m_timestamp;
+    {
+        uint32_t enum_value = 0;
+        dcdr >> enum_value;
+        m_classification = (CounterUAS::TrackClassification)enum_value;
+    }
+
+    dcdr >> m_hitCount;
+    dcdr >> m_range;
+    dcdr >> m_azimuth;
+    dcdr >> m_elevation;
+    dcdr >> m_rangeRate;
+    dcdr >> m_x;
+    dcdr >> m_y;
+    dcdr >> m_z;
+    dcdr >> m_vx;
+    dcdr >> m_vy;
+    dcdr >> m_vz;
+    dcdr >> m_trackQuality;
+    dcdr >> m_missCount;
+    dcdr >> m_age;
+}
+
+/*!
+ * @brief This function sets a value in member trackId
+ * @param _trackId New value for member trackId
+ */
+void CounterUAS::TrackFrameEntry::trackId(
+        uint32_t _trackId)
+{
+    m_trackId = _trackId;
+}
+
+/*!
+ * @brief This function returns the value of member trackId
+ * @return Value of member trackId
+ */
+uint32_t CounterUAS::TrackFrameEntry::trackId() const
+{
+    return m_trackId;
+}
+
+/*!
+ * @brief This function returns a reference to member trackId
+ * @return Reference to member trackId
+ */
+uint32_t& CounterUAS::TrackFrameEntry::trackId()
+{
+    return m_trackId;
+}
+
+/*!
+ * @brief This function sets a value in member status
+ * @param _status New value for member status
+ */
+void CounterUAS::TrackFrameEntry::status(
+        CounterUAS::TrackStatus _status)
+{
+    m_status = _status;
+}
+
+/*!
+ * @brief This function returns the value of member status
+ * @return Value of member status
+ */
+CounterUAS::TrackStatus CounterUAS::TrackFrameEntry::status() const
+{
+    return m_status;
+}
+
+/*!
+ * @brief This function returns a reference to member status
+ * @return Reference to member status
+ */
+CounterUAS::TrackStatus& CounterUAS::TrackFrameEntry::status()
+{
+    return m_status;
+}
+
+/*!
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
+ */
+void CounterUAS::TrackFrameEntry::timestamp(
+        uint64_t _timestamp)
+{
+    m_timestamp = _timestamp;
+}
+
+/*!
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
+ */
+uint64_t CounterUAS::TrackFrameEntry::timestamp() const
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
+ */
+uint64_t& CounterUAS::TrackFrameEntry::timestamp()
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function sets a value in member classification
+ * @param _classification New value for member classification
+ */
+void CounterUAS::TrackFrameEntry::classification(
+        CounterUAS::TrackClassification _classification)
+{
+    m_classification = _classification;
+}
+
+/*!
+ * @brief This function returns the value of member classification
+ * @return Value of member classification
+ */
+CounterUAS::TrackClassification CounterUAS::TrackFrameEntry::classification() const
+{
+    return m_classification;
+}
+
+/*!
+ * @brief This function returns a reference to member classification
+ * @return Reference to member classification
+ */
+CounterUAS::TrackClassification& CounterUAS::TrackFrameEntry::classification()
+{
+    return m_classification;
+}
+
+/*!
+ * @brief This function sets a value in member hitCount
+ * @param _hitCount New value for member hitCount
+ */
+void CounterUAS::TrackFrameEntry::hitCount(
+        uint32_t _hitCount)
+{
+    m_hitCount = _hitCount;
+}
+
+/*!
+ * @brief This function returns the value of member hitCount
+ * @return Value of member hitCount
+ */
+uint32_t CounterUAS::TrackFrameEntry::hitCount() const
+{
+    return m_hitCount;
+}
+
+/*!
+ * @brief This function returns a reference to member hitCount
+ * @return Reference to member hitCount
+ */
+uint32_t& CounterUAS::TrackFrameEntry::hitCount()
+{
+    return m_hitCount;
+}
+
+/*!
+ * @brief This function sets a value in member range
+ * @param _range New value for member range
+ */
+void CounterUAS::TrackFrameEntry::range(
+        double _range)
+{
+    m_range = _range;
+}
+
+/*!
+ * @brief This function returns the value of member range
+ * @return Value of member range
+ */
+double CounterUAS::TrackFrameEntry::range() const
+{
+    return m_range;
+}
+
+/*!
+ * @brief This function returns a reference to member range
+ * @return Reference to member range
+ */
+double& CounterUAS::TrackFrameEntry::range()
+{
+    return m_range;
+}
+
+/*!
+ * @brief This function sets a value in member azimuth
+ * @param _azimuth New value for member azimuth
+ */
+void CounterUAS::TrackFrameEntry::azimuth(
+        double _azimuth)
+{
+    m_azimuth = _azimuth;
+}
+
+/*!
+ * @brief This function returns the value of member azimuth
+ * @return Value of member azimuth
+ */
+double CounterUAS::TrackFrameEntry::azimuth() const
+{
+    return m_azimuth;
+}
+
+/*!
+ * @brief This function returns a reference to member azimuth
+ * @return Reference to member azimuth
+ */
+double& CounterUAS::TrackFrameEntry::azimuth()
+{
+    return m_azimuth;
+}
+
+/*!
+ * @brief This function sets a value in member elevation
+ * @param _elevation New value for member elevation
+ */
+void CounterUAS::TrackFrameEntry::elevation(
+        double _elevation)
+{
+    m_elevation = _elevation;
+}
+
+/*!
+ * @brief This function returns the value of member elevation
+ * @return Value of member elevation
+ */
+double CounterUAS::TrackFrameEntry::elevation() const
+{
+    return m_elevation;
+}
+
+/*!
+ * @brief This function returns a reference to member elevation
+ * @return Reference to member elevation
+ */
+double& CounterUAS::TrackFrameEntry::elevation()
+{
+    return m_elevation;
+}
+
+/*!
+ * @brief This function sets a value in member rangeRate
+ * @param _rangeRate New value for member rangeRate
+ */
+void CounterUAS::TrackFrameEntry::rangeRate(
+        double _rangeRate)
+{
+    m_rangeRate = _rangeRate;
+}
+
+/*!
+ * @brief This function returns the value of member rangeRate
+ * @return Value of member rangeRate
+ */
+double CounterUAS::TrackFrameEntry::rangeRate() const
+{
+    return m_rangeRate;
+}
+
+/*!
+ * @brief This function returns a reference to member rangeRate
+ * @return Reference to member rangeRate
+ */
+double& CounterUAS::TrackFrameEntry::rangeRate()
+{
+    return m_rangeRate;
+}
+
+/*!
+ * @brief This function sets a value in member x
+ * @param _x New value for member x
+ */
+void CounterUAS::TrackFrameEntry::x(
+        double _x)
+{
+    m_x = _x;
+}
+
+/*!
+ * @brief This function returns the value of member x
+ * @return Value of member x
+ */
+double CounterUAS::TrackFrameEntry::x() const
+{
+    return m_x;
+}
+
+/*!
+ * @brief This function returns a reference to member x
+ * @return Reference to member x
+ */
+double& CounterUAS::TrackFrameEntry::x()
+{
+    return m_x;
+}
+
+/*!
+ * @brief This function sets a value in member y
+ * @param _y New value for member y
+ */
+void CounterUAS::TrackFrameEntry::y(
+        double _y)
+{
+    m_y = _y;
+}
+
+/*!
+ * @brief This function returns the value of member y
+ * @return Value of member y
+ */
+double CounterUAS::TrackFrameEntry::y() const
+{
+    return m_y;
+}
+
+/*!
+ * @brief This function returns a reference to member y
+ * @return Reference to member y
+ */
+double& CounterUAS::TrackFrameEntry::y()
+{
+    return m_y;
+}
+
+/*!
+ * @brief This function sets a value in member z
+ * @param _z New value for member z
+ */
+void CounterUAS::TrackFrameEntry::z(
+        double _z)
+{
+    m_z = _z;
+}
+
+/*!
+ * @brief This function returns the value of member z
+ * @return Value of member z
+ */
+double CounterUAS::TrackFrameEntry::z() const
+{
+    return m_z;
+}
+
+/*!
+ * @brief This function returns a reference to member z
+ * @return Reference to member z
+ */
+double& CounterUAS::TrackFrameEntry::z()
+{
+    return m_z;
+}
+
+/*!
+ * @brief This function sets a value in member vx
+ * @param _vx New value for member vx
+ */
+void CounterUAS::TrackFrameEntry::vx(
+        double _vx)
+{
+    m_vx = _vx;
+}
+
+/*!
+ * @brief This function returns the value of member vx
+ * @return Value of member vx
+ */
+double CounterUAS::TrackFrameEntry::vx() const
+{
+    return m_vx;
+}
+
+/*!
+ * @brief This function returns a reference to member vx
+ * @return Reference to member vx
+ */
+double& CounterUAS::TrackFrameEntry::vx()
+{
+    return m_vx;
+}
+
+/*!
+ * @brief This function sets a value in member vy
+ * @param _vy New value for member vy
+ */
+void CounterUAS::TrackFrameEntry::vy(
+        double _vy)
+{
+    m_vy = _vy;
+}
+
+/*!
+ * @brief This function returns the value of member vy
+ * @return Value of member vy
+ */
+double CounterUAS::TrackFrameEntry::vy() const
+{
+    return m_vy;
+}
+
+/*!
+ * @brief This function returns a reference to member vy
+ * @return Reference to member vy
+ */
+double& CounterUAS::TrackFrameEntry::vy()
+{
+    return m_vy;
+}
+
+/*!
+ * @brief This function sets a value in member vz
+ * @param _vz New value for member vz
+ */
+void CounterUAS::TrackFrameEntry::vz(
+        double _vz)
+{
+    m_vz = _vz;
+}
+
+/*!
+ * @brief This function returns the value of member vz
+ * @return Value of member vz
+ */
+double CounterUAS::TrackFrameEntry::vz() const
+{
+    return m_vz;
+}
+
+/*!
+ * @brief This function returns a reference to member vz
+ * @return Reference to member vz
+ */
+double& CounterUAS::TrackFrameEntry::vz()
+{
+    return m_vz;
+}
+
+/*!
+ * @brief This function sets a value in member trackQuality
+ * @param _trackQuality New value for member trackQuality
+ */
+void CounterUAS::TrackFrameEntry::trackQuality(
+        double _trackQuality)
+{
+    m_trackQuality = _trackQuality;
+}
+
+/*!
+ * @brief This function returns the value of member trackQuality
+ * @return Value of member trackQuality
+ */
+double CounterUAS::TrackFrameEntry::trackQuality() const
+{
+    return m_trackQuality;
+}
+
+/*!
+ * @brief This function returns a reference to member trackQuality
+ * @return Reference to member trackQuality
+ */
+double& CounterUAS::TrackFrameEntry::trackQuality()
+{
+    return m_trackQuality;
+}
+
+/*!
+ * @brief This function sets a value in member missCount
+ * @param _missCount New value for member missCount
+ */
+void CounterUAS::TrackFrameEntry::missCount(
+        uint32_t _missCount)
+{
+    m_missCount = _missCount;
+}
+
+/*!
+ * @brief This function returns the value of member missCount
+ * @return Value of member missCount
+ */
+uint32_t CounterUAS::TrackFrameEntry::missCount() const
+{
+    return m_missCount;
+}
+
+/*!
+ * @brief This function returns a reference to member missCount
+ * @return Reference to member missCount
+ */
+uint32_t& CounterUAS::TrackFrameEntry::missCount()
+{
+    return m_missCount;
+}
+
+/*!
+ * @brief This function sets a value in member age
+ * @param _age New value for member age
+ */
+void CounterUAS::TrackFrameEntry::age(
+        uint32_t _age)
+{
+    m_age = _age;
+}
+
+/*!
+ * @brief This function returns the value of member age
+ * @return Value of member age
+ */
+uint32_t CounterUAS::TrackFrameEntry::age() const
+{
+    return m_age;
+}
+
+/*!
+ * @brief This function returns a reference to member age
+ * @return Reference to member age
+ */
+uint32_t& CounterUAS::TrackFrameEntry::age()
+{
+    return m_age;
+}
+
+
+
+size_t CounterUAS::TrackFrameEntry::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+
+    return current_align;
+}
+
+bool CounterUAS::TrackFrameEntry::isKeyDefined()
+{
+    return false;
+}
+
+void CounterUAS::TrackFrameEntry::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+            
+}
+
+
+
+CounterUAS::TrackTableFrame::TrackTableFrame()
+{
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5f97359f
+    m_messageId = 0;
+    // m_numTracks com.eprosima.idl.parser.typecode.PrimitiveTypeCode@10f155df
+    m_numTracks = 0;
+    // m_sensorId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@21686222
+    m_sensorId = 0;
+    // m_reserved com.eprosima.idl.parser.typecode.PrimitiveTypeCode@70c081c5
+    m_reserved = 0;
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5f085e2b
+    m_timestamp = 0;
+    // m_trace com.eprosima.idl.parser.typecode.StructTypeCode@72d8faf
+
+    // m_tracks com.eprosima.idl.parser.typecode.ArrayTypeCode@15a98f70
+
+
+}
+
+CounterUAS::TrackTableFrame::~TrackTableFrame()
+{
+
+
+
+}
+
+CounterUAS::TrackTableFrame::TrackTableFrame(
+        const TrackTableFrame& x)
+{
+    m_messageId = x.m_messageId;
+    m_numTracks = x.m_numTracks;
+    m_sensorId = x.m_sensorId;
+    m_reserved = x.m_reserved;
+    m_timestamp = x.m_timestamp;
+    m_trace = x.m_trace;
+    m_tracks = x.m_tracks;
+}
+
+CounterUAS::TrackTableFrame::TrackTableFrame(
+        TrackTableFrame&& x) noexcept 
+{
+    m_messageId = x.m_messageId;
+    m_numTracks = x.m_numTracks;
+    m_sensorId = x.m_sensorId;
+    m_reserved = x.m_reserved;
+    m_timestamp = x.m_timestamp;
+    m_trace = std::move(x.m_trace);
+    m_tracks = std::move(x.m_tracks);
+}
+
+CounterUAS::TrackTableFrame& CounterUAS::TrackTableFrame::operator =(
+        const TrackTableFrame& x)
+{
+
+    m_messageId = x.m_messageId;
+    m_numTracks = x.m_numTracks;
+    m_sensorId = x.m_sensorId;
+    m_reserved = x.m_reserved;
+    m_timestamp = x.m_timestamp;
+    m_trace = x.m_trace;
+    m_tracks = x.m_tracks;
+
+    return *this;
+}
+
+CounterUAS::TrackTableFrame& CounterUAS::TrackTableFrame::operator =(
+        TrackTableFrame&& x) noexcept
+{
+
+    m_messageId = x.m_messageId;
+    m_numTracks = x.m_numTracks;
+    m_sensorId = x.m_sensorId;
+    m_reserved = x.m_reserved;
+    m_timestamp = x.m_timestamp;
+    m_trace = std::move(x.m_trace);
+    m_tracks = std::move(x.m_tracks);
+
+    return *this;
+}
+
+bool CounterUAS::TrackTableFrame::operator ==(
+        const TrackTableFrame& x) const
+{
+
+    return (m_messageId == x.m_messageId && m_numTracks == x.m_numTracks && m_sensorId == x.m_sensorId && m_reserved == x.m_reserved && m_timestamp == x.m_timestamp && m_trace == x.m_trace && m_tracks == x.m_tracks);
+}
+
+bool CounterUAS::TrackTableFrame::operator !=(
+        const TrackTableFrame& x) const
+{
+    return !(*this == x);
+}
+
+size_t CounterUAS::TrackTableFrame::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += CounterUAS::LatencyTrace::getMaxCdrSerializedSize(current_alignment);
+
+
+    for(size_t a = 0; a < (CounterUAS::FRAME_MAX_TRACKS); ++a)
+    {
+        current_alignment += CounterUAS::TrackFrameEntry::getMaxCdrSerializedSize(current_alignment);}
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t CounterUAS::TrackTableFrame::getCdrSerializedSize(
+        const CounterUAS::TrackTableFrame& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += CounterUAS::LatencyTrace::getCdrSerializedSize(data.trace(), current_alignment);
+
+
+    for(size_t a = 0; a < data.tracks().size(); ++a)
+    {
+        current_alignment += CounterUAS::TrackFrameEntry::getCdrSerializedSize(data.tracks().at(a), current_alignment);}
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+void CounterUAS::TrackTableFrame::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_messageId;
+    scdr << m_numTracks;
+    scdr << m_sensorId;
+    scdr << m_reserved;
+    scdr << m_timestamp;
+    scdr << m_trace;
+    scdr << m_tracks;
+
+}
+
+void CounterUAS::TrackTableFrame::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_messageId;
+    dcdr >> m_numTracks;
+    dcdr >> m_sensorId;
+    dcdr >> m_reserved;
+    dcdr >> m_timestamp;
+    dcdr >> m_trace;
+    dcdr >> m_tracks;
+}
+
+/*!
+ * @brief This function sets a value in member messageId
+ * @param _messageId New value for member messageId
+ */
+void CounterUAS::TrackTableFrame::messageId(
+        uint32_t _messageId)
+{
+    m_messageId = _messageId;
+}
+
+/*!
+ * @brief This function returns the value of member messageId
+ * @return Value of member messageId
+ */
+uint32_t CounterUAS::TrackTableFrame::messageId() const
+{
+    return m_messageId;
+}
+
+/*!
+ * @brief This function returns a reference to member messageId
+ * @return Reference to member messageId
+ */
+uint32_t& CounterUAS::TrackTableFrame::messageId()
+{
+    return m_messageId;
+}
+
+/*!
+ * @brief This function sets a value in member numTracks
+ * @param _numTracks New value for member numTracks
+ */
+void CounterUAS::TrackTableFrame::numTracks(
+        uint32_t _numTracks)
+{
+    m_numTracks = _numTracks;
+}
+
+/*!
+ * @brief This function returns the value of member numTracks
+ * @return Value of member numTracks
+ */
+uint32_t CounterUAS::TrackTableFrame::numTracks() const
+{
+    return m_numTracks;
+}
+
+/*!
+ * @brief This function returns a reference to member numTracks
+ * @return Reference to member numTracks
+ */
+uint32_t& CounterUAS::TrackTableFrame::numTracks()
+{
+    return m_numTracks;
+}
+
+/*!
+ * @brief This function sets a value in member sensorId
+ * @param _sensorId New value for member sensorId
+ */
+void CounterUAS::TrackTableFrame::sensorId(
+        uint32_t _sensorId)
+{
+    m_sensorId = _sensorId;
+}
+
+/*!
+ * @brief This function returns the value of member sensorId
+ * @return Value of member sensorId
+ */
+uint32_t CounterUAS::TrackTableFrame::sensorId() const
+{
+    return m_sensorId;
+}
+
+/*!
+ * @brief This function returns a reference to member sensorId
+ * @return Reference to member sensorId
+ */
+uint32_t& CounterUAS::TrackTableFrame::sensorId()
+{
+    return m_sensorId;
+}
+
+/*!
+ * @brief This function sets a value in member reserved
+ * @param _reserved New value for member reserved
+ */
+void CounterUAS::TrackTableFrame::reserved(
+        uint32_t _reserved)
+{
+    m_reserved = _reserved;
+}
+
+/*!
+ * @brief This function returns the value of member reserved
+ * @return Value of member reserved
+ */
+uint32_t CounterUAS::TrackTableFrame::reserved() const
+{
+    return m_reserved;
+}
+
+/*!
+ * @brief This function returns a reference to member reserved
+ * @return Reference to member reserved
+ */
+uint32_t& CounterUAS::TrackTableFrame::reserved()
+{
+    return m_reserved;
+}
+
+/*!
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
+ */
+void CounterUAS::TrackTableFrame::timestamp(
+        uint64_t _timestamp)
+{
+    m_timestamp = _timestamp;
+}
+
+/*!
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
+ */
+uint64_t CounterUAS::TrackTableFrame::timestamp() const
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
+ */
+uint64_t& CounterUAS::TrackTableFrame::timestamp()
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function copies the value in member trace
+ * @param _trace New value to be copied in member trace
+ */
+void CounterUAS::TrackTableFrame::trace(
+        const CounterUAS::LatencyTrace& _trace)
+{
+    m_trace = _trace;
+}
+
+/*!
+ * @brief This function moves the value in member trace
+ * @param _trace New value to be moved in member trace
+ */
+void CounterUAS::TrackTableFrame::trace(
+        CounterUAS::LatencyTrace&& _trace)
+{
+    m_trace = std::move(_trace);
+}
+
+/*!
+ * @brief This function returns a constant reference to member trace
+ * @return Constant reference to member trace
+ */
+const CounterUAS::LatencyTrace& CounterUAS::TrackTableFrame::trace() const
+{
+    return m_trace;
+}
+
+/*!
+ * @brief This function returns a reference to member trace
+ * @return Reference to member trace
+ */
+CounterUAS::LatencyTrace& CounterUAS::TrackTableFrame::trace()
+{
+    return m_trace;
+}
+/*!
+ * @brief This function copies the value in member tracks
+ * @param _tracks New value to be copied in member tracks
+ */
+void CounterUAS::TrackTableFrame::tracks(
+        const std::array<CounterUAS::TrackFrameEntry, CounterUAS::FRAME_MAX_TRACKS>& _tracks)
+{
+    m_tracks = _tracks;
+}
+
+/*!
+ * @brief This function moves the value in member tracks
+ * @param _tracks New value to be moved in member tracks
+ */
+void CounterUAS::TrackTableFrame::tracks(
+        std::array<CounterUAS::TrackFrameEntry, CounterUAS::FRAME_MAX_TRACKS>&& _tracks)
+{
+    m_tracks = std::move(_tracks);
+}
+
+/*!
+ * @brief This function returns a constant reference to member tracks
+ * @return Constant reference to member tracks
+ */
+const std::array<CounterUAS::TrackFrameEntry, CounterUAS::FRAME_MAX_TRACKS>& CounterUAS::TrackTableFrame::tracks() const
+{
+    return m_tracks;
+}
+
+/*!
+ * @brief This function returns a reference to member tracks
+ * @return Reference to member tracks
+ */
+std::array<CounterUAS::TrackFrameEntry, CounterUAS::FRAME_MAX_TRACKS>& CounterUAS::TrackTableFrame::tracks()
+{
+    return m_tracks;
+}
+
+
+size_t CounterUAS::TrackTableFrame::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+
+    return current_align;
+}
+
+bool CounterUAS::TrackTableFrame::isKeyDefined()
+{
+    return false;
+}
+
+void CounterUAS::TrackTableFrame::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+            
+}
+
+
+
+CounterUAS::ClusterData::ClusterData()
 {
     // m_clusterId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@15bb6bea
     m_clusterId = 0;
-    // m_numDetections com.eprosima.idl.parser.typecode.PrimitiveTypeCode@8b96fde
-    m_numDetections = 0;
-    // m_range com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2d2e5f00
-    m_range = 0.0;
-    // m_azimuth com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4c40b76e
-    m_azimuth = 0.0;
-    // m_elevation com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2ea6137
-    m_elevation = 0.0;
-    // m_strength com.eprosima.idl.parser.typecode.PrimitiveTypeCode@41ee392b
-    m_strength = 0.0;
-    // m_snr com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1e67a849
-    m_snr = 0.0;
-    // m_rcs com.eprosima.idl.parser.typecode.PrimitiveTypeCode@57d5872c
-    m_rcs = 0.0;
-    // m_microDoppler com.eprosima.idl.parser.typecode.PrimitiveTypeCode@667a738
-    m_microDoppler = 0.0;
-    // m_x com.eprosima.idl.parser.typecode.PrimitiveTypeCode@36f0f1be
+    // m_numDetections com.eprosima.idl.parser.typecode.PrimitiveTypeCode@8b96fde
+    m_numDetections = 0;
+    // m_range com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2d2e5f00
+    m_range = 0.0;
+    // m_azimuth com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4c40b76e
+    m_azimuth = 0.0;
+    // m_elevation com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2ea6137
+    m_elevation = 0.0;
+    // m_strength com.eprosima.idl.parser.typecode.PrimitiveTypeCode@41ee392b
+    m_strength = 0.0;
+    // m_snr com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1e67a849
+    m_snr = 0.0;
+    // m_rcs com.eprosima.idl.parser.typecode.PrimitiveTypeCode@57d5872c
+    m_rcs = 0.0;
+    // m_microDoppler com.eprosima.idl.parser.typecode.PrimitiveTypeCode@667a738
+    m_microDoppler = 0.0;
+    // m_x com.eprosima.idl.parser.typecode.PrimitiveTypeCode@36f0f1be
+    m_x = 0.0;
+    // m_y com.eprosima.idl.parser.typecode.PrimitiveTypeCode@157632c9
+    m_y = 0.0;
+    // m_z com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6ee12bac
+    m_z = 0.0;
+
+}
+
+CounterUAS::ClusterData::~ClusterData()
+{
+
+
+
+
+
+
+
+
+
+
+
+}
+
+CounterUAS::ClusterData::ClusterData(
+        const ClusterData& x)
+{
+    m_clusterId = x.m_clusterId;
+    m_numDetections = x.m_numDetections;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_strength = x.m_strength;
+    m_snr = x.m_snr;
+    m_rcs = x.m_rcs;
+    m_microDoppler = x.m_microDoppler;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+}
+
+CounterUAS::ClusterData::ClusterData(
+        ClusterData&& x) noexcept 
+{
+    m_clusterId = x.m_clusterId;
+    m_numDetections = x.m_numDetections;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_strength = x.m_strength;
+    m_snr = x.m_snr;
+    m_rcs = x.m_rcs;
+    m_microDoppler = x.m_microDoppler;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+}
+
+CounterUAS::ClusterData& CounterUAS::ClusterData::operator =(
+        const ClusterData& x)
+{
+
+    m_clusterId = x.m_clusterId;
+    m_numDetections = x.m_numDetections;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_strength = x.m_strength;
+    m_snr = x.m_snr;
+    m_rcs = x.m_rcs;
+    m_microDoppler = x.m_microDoppler;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+
+    return *this;
+}
+
+CounterUAS::ClusterData& CounterUAS::ClusterData::operator =(
+        ClusterData&& x) noexcept
+{
+
+    m_clusterId = x.m_clusterId;
+    m_numDetections = x.m_numDetections;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_strength = x.m_strength;
+    m_snr = x.m_snr;
+    m_rcs = x.m_rcs;
+    m_microDoppler = x.m_microDoppler;
+    m_x = x.m_x;
+    m_y = x.m_y;
+    m_z = x.m_z;
+
+    return *this;
+}
+
+bool CounterUAS::ClusterData::operator ==(
+        const ClusterData& x) const
+{
+
+    return (m_clusterId == x.m_clusterId && m_numDetections == x.m_numDetections && m_range == x.m_range && m_azimuth == x.m_azimuth && m_elevation == x.m_elevation && m_strength == x.m_strength && m_snr == x.m_snr && m_rcs == x.m_rcs && m_microDoppler == x.m_microDoppler && m_x == x.m_x && m_y == x.m_y && m_z == x.m_z);
+}
+
+bool CounterUAS::ClusterData::operator !=(
+        const ClusterData& x) const
+{
+    return !(*this == x);
+}
+
+size_t CounterUAS::ClusterData::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t CounterUAS::ClusterData::getCdrSerializedSize(
+        const CounterUAS::ClusterData& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+void CounterUAS::ClusterData::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_clusterId;
+    scdr << m_numDetections;
+    scdr << m_range;
+    scdr << m_azimuth;
+    scdr << m_elevation;
+    scdr << m_strength;
+    scdr << m_snr;
+    scdr << m_rcs;
+    scdr << m_microDoppler;
+    scdr << m_x;
+    scdr << m_y;
+    scdr << m_z;
+
+}
+
+void CounterUAS::ClusterData::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_clusterId;
+    dcdr >> m_numDetections;
+    dcdr >> m_range;
+    dcdr >> m_azimuth;
+    dcdr >> m_elevation;
+    dcdr >> m_strength;
+    dcdr >> m_snr;
+    dcdr >> m_rcs;
+    dcdr >> m_microDoppler;
+    dcdr >> m_x;
+    dcdr >> m_y;
+    dcdr >> m_z;
+}
+
+/*!
+ * @brief This function sets a value in member clusterId
+ * @param _clusterId New value for member clusterId
+ */
+void CounterUAS::ClusterData::clusterId(
+        uint32_t _clusterId)
+{
+    m_clusterId = _clusterId;
+}
+
+/*!
+ * @brief This function returns the value of member clusterId
+ * @return Value of member clusterId
+ */
+uint32_t CounterUAS::ClusterData::clusterId() const
+{
+    return m_clusterId;
+}
+
+/*!
+ * @brief This function returns a reference to member clusterId
+ * @return Reference to member clusterId
+ */
+uint32_t& CounterUAS::ClusterData::clusterId()
+{
+    return m_clusterId;
+}
+
+/*!
+ * @brief This function sets a value in member numDetections
+ * @param _numDetections New value for member numDetections
+ */
+void CounterUAS::ClusterData::numDetections(
+        uint32_t _numDetections)
+{
+    m_numDetections = _numDetections;
+}
+
+/*!
+ * @brief This function returns the value of member numDetections
+ * @return Value of member numDetections
+ */
+uint32_t CounterUAS::ClusterData::numDetections() const
+{
+    return m_numDetections;
+}
+
+/*!
+ * @brief This function returns a reference to member numDetections
+ * @return Reference to member numDetections
+ */
+uint32_t& CounterUAS::ClusterData::numDetections()
+{
+    return m_numDetections;
+}
+
+/*!
+ * @brief This function sets a value in member range
+ * @param _range New value for member range
+ */
+void CounterUAS::ClusterData::range(
+        double _range)
+{
+    m_range = _range;
+}
+
+/*!
+ * @brief This function returns the value of member range
+ * @return Value of member range
+ */
+double CounterUAS::ClusterData::range() const
+{
+    return m_range;
+}
+
+/*!
+ * @brief This function returns a reference to member range
+ * @return Reference to member range
+ */
+double& CounterUAS::ClusterData::range()
+{
+    return m_range;
+}
+
+/*!
+ * @brief This function sets a value in member azimuth
+ * @param _azimuth New value for member azimuth
+ */
+void CounterUAS::ClusterData::azimuth(
+        double _azimuth)
+{
+    m_azimuth = _azimuth;
+}
+
+/*!
+ * @brief This function returns the value of member azimuth
+ * @return Value of member azimuth
+ */
+double CounterUAS::ClusterData::azimuth() const
+{
+    return m_azimuth;
+}
+
+/*!
+ * @brief This function returns a reference to member azimuth
+ * @return Reference to member azimuth
+ */
+double& CounterUAS::ClusterData::azimuth()
+{
+    return m_azimuth;
+}
+
+/*!
+ * @brief This function sets a value in member elevation
+ * @param _elevation New value for member elevation
+ */
+void CounterUAS::ClusterData::elevation(
+        double _elevation)
+{
+    m_elevation = _elevation;
+}
+
+/*!
+ * @brief This function returns the value of member elevation
+ * @return Value of member elevation
+ */
+double CounterUAS::ClusterData::elevation() const
+{
+    return m_elevation;
+}
+
+/*!
+ * @brief This function returns a reference to member elevation
+ * @return Reference to member elevation
+ */
+double& CounterUAS::ClusterData::elevation()
+{
+    return m_elevation;
+}
+
+/*!
+ * @brief This function sets a value in member strength
+ * @param _strength New value for member strength
+ */
+void CounterUAS::ClusterData::strength(
+        double _strength)
+{
+    m_strength = _strength;
+}
+
+/*!
+ * @brief This function returns the value of member strength
+ * @return Value of member strength
+ */
+double CounterUAS::ClusterData::strength() const
+{
+    return m_strength;
+}
+
+/*!
+ * @brief This function returns a reference to member strength
+ * @return Reference to member strength
+ */
+double& CounterUAS::ClusterData::strength()
+{
+    return m_strength;
+}
+
+/*!
+ * @brief This function sets a value in member snr
+ * @param _snr New value for member snr
+ */
+void CounterUAS::ClusterData::snr(
+        double _snr)
+{
+    m_snr = _snr;
+}
+
+/*!
+ * @brief This function returns the value of member snr
+ * @return Value of member snr
+ */
+double CounterUAS::ClusterData::snr() const
+{
+    return m_snr;
+}
+
+/*!
+ * @brief This function returns a reference to member snr
+ * @return Reference to member snr
+ */
+double& CounterUAS::ClusterData::snr()
+{
+    return m_snr;
+}
+
+/*!
+ * @brief This function sets a value in member rcs
+ * @param _rcs New value for member rcs
+ */
+void CounterUAS::ClusterData::rcs(
+        double _rcs)
+{
+    m_rcs = _rcs;
+}
+
+/*!
+ * @brief This function returns the value of member rcs
+ * @return Value of member rcs
+ */
+double CounterUAS::ClusterData::rcs() const
+{
+    return m_rcs;
+}
+
+/*!
+ * @brief This function returns a reference to member rcs
+ * @return Reference to member rcs
+ */
+double& CounterUAS::ClusterData::rcs()
+{
+    return m_rcs;
+}
+
+/*!
+ * @brief This function sets a value in member microDoppler
+ * @param _microDoppler New value for member microDoppler
+ */
+void CounterUAS::ClusterData::microDoppler(
+        double _microDoppler)
+{
+    m_microDoppler = _microDoppler;
+}
+
+/*!
+ * @brief This function returns the value of member microDoppler
+ * @return Value of member microDoppler
+ */
+double CounterUAS::ClusterData::microDoppler() const
+{
+    return m_microDoppler;
+}
+
+/*!
+ * @brief This function returns a reference to member microDoppler
+ * @return Reference to member microDoppler
+ */
+double& CounterUAS::ClusterData::microDoppler()
+{
+    return m_microDoppler;
+}
+
+/*!
+ * @brief This function sets a value in member x
+ * @param _x New value for member x
+ */
+void CounterUAS::ClusterData::x(
+        double _x)
+{
+    m_x = _x;
+}
+
+/*!
+ * @brief This function returns the value of member x
+ * @return Value of member x
+ */
+double CounterUAS::ClusterData::x() const
+{
+    return m_x;
+}
+
+/*!
+ * @brief This function returns a reference to member x
+ * @return Reference to member x
+ */
+double& CounterUAS::ClusterData::x()
+{
+    return m_x;
+}
+
+/*!
+ * @brief This function sets a value in member y
+ * @param _y New value for member y
+ */
+void CounterUAS::ClusterData::y(
+        double _y)
+{
+    m_y = _y;
+}
+
+/*!
+ * @brief This function returns the value of member y
+ * @return Value of member y
+ */
+double CounterUAS::ClusterData::y() const
+{
+    return m_y;
+}
+
+/*!
+ * @brief This function returns a reference to member y
+ * @return Reference to member y
+ */
+double& CounterUAS::ClusterData::y()
+{
+    return m_y;
+}
+
+/*!
+ * @brief This function sets a value in member z
+ * @param _z New value for member z
+ */
+void CounterUAS::ClusterData::z(
+        double _z)
+{
+    m_z = _z;
+}
+
+/*!
+ * @brief This function returns the value of member z
+ * @return Value of member z
+ */
+double CounterUAS::ClusterData::z() const
+{
+    return m_z;
+}
+
+/*!
+ * @brief This function returns a reference to member z
+ * @return Reference to member z
+ */
+double& CounterUAS::ClusterData::z()
+{
+    return m_z;
+}
+
+
+size_t CounterUAS::ClusterData::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+
+    return current_align;
+}
+
+bool CounterUAS::ClusterData::isKeyDefined()
+{
+    return false;
+}
+
+void CounterUAS::ClusterData::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+                
+}
+
+CounterUAS::ClusterTableMessage::ClusterTableMessage()
+{
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@55040f2f
+    m_messageId = 0;
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@64c87930
+    m_timestamp = 0;
+    // m_dwellCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@400cff1a
+    m_dwellCount = 0;
+    // m_numClusters com.eprosima.idl.parser.typecode.PrimitiveTypeCode@275710fc
+    m_numClusters = 0;
+    // m_clusters com.eprosima.idl.parser.typecode.SequenceTypeCode@525f1e4e
+
+
+}
+
+CounterUAS::ClusterTableMessage::~ClusterTableMessage()
+{
+
+
+
+
+}
+
+CounterUAS::ClusterTableMessage::ClusterTableMessage(
+        const ClusterTableMessage& x)
+{
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_dwellCount = x.m_dwellCount;
+    m_numClusters = x.m_numClusters;
+    m_clusters = x.m_clusters;
+}
+
+CounterUAS::ClusterTableMessage::ClusterTableMessage(
+        ClusterTableMessage&& x) noexcept 
+{
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_dwellCount = x.m_dwellCount;
+    m_numClusters = x.m_numClusters;
+    m_clusters = std::move(x.m_clusters);
+}
+
+CounterUAS::ClusterTableMessage& CounterUAS::ClusterTableMessage::operator =(
+        const ClusterTableMessage& x)
+{
+
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_dwellCount = x.m_dwellCount;
+    m_numClusters = x.m_numClusters;
+    m_clusters = x.m_clusters;
+
+    return *this;
+}
+
+CounterUAS::ClusterTableMessage& CounterUAS::ClusterTableMessage::operator =(
+        ClusterTableMessage&& x) noexcept
+{
+
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_dwellCount = x.m_dwellCount;
+    m_numClusters = x.m_numClusters;
+    m_clusters = std::move(x.m_clusters);
+
+    return *this;
+}
+
+bool CounterUAS::ClusterTableMessage::operator ==(
+        const ClusterTableMessage& x) const
+{
+
+    return (m_messageId == x.m_messageId && m_timestamp == x.m_timestamp && m_dwellCount == x.m_dwellCount && m_numClusters == x.m_numClusters && m_clusters == x.m_clusters);
+}
+
+bool CounterUAS::ClusterTableMessage::operator !=(
+        const ClusterTableMessage& x) const
+{
+    return !(*this == x);
+}
+
+size_t CounterUAS::ClusterTableMessage::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    for(size_t a = 0; a < 100; ++a)
+    {
+        current_alignment += CounterUAS::ClusterData::getMaxCdrSerializedSize(current_alignment);}
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t CounterUAS::ClusterTableMessage::getCdrSerializedSize(
+        const CounterUAS::ClusterTableMessage& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    for(size_t a = 0; a < data.clusters().size(); ++a)
+    {
+        current_alignment += CounterUAS::ClusterData::getCdrSerializedSize(data.clusters().at(a), current_alignment);}
+
+
+    return current_alignment - initial_alignment;
+}
+
+void CounterUAS::ClusterTableMessage::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_messageId;
+    scdr << m_timestamp;
+    scdr << m_dwellCount;
+    scdr << m_numClusters;
+    scdr << m_clusters;
+
+}
+
+void CounterUAS::ClusterTableMessage::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_messageId;
+    dcdr >> m_timestamp;
+    dcdr >> m_dwellCount;
+    dcdr >> m_numClusters;
+    dcdr >> m_clusters;
+}
+
+/*!
+ * @brief This function sets a value in member messageId
+ * @param _messageId New value for member messageId
+ */
+void CounterUAS::ClusterTableMessage::messageId(
+        uint32_t _messageId)
+{
+    m_messageId = _messageId;
+}
+
+/*!
+ * @brief This function returns the value of member messageId
+ * @return Value of member messageId
+ */
+uint32_t CounterUAS::ClusterTableMessage::messageId() const
+{
+    return m_messageId;
+}
+
+/*!
+ * @brief This function returns a reference to member messageId
+ * @return Reference to member messageId
+ */
+uint32_t& CounterUAS::ClusterTableMessage::messageId()
+{
+    return m_messageId;
+}
+
+/*!
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
+ */
+void CounterUAS::ClusterTableMessage::timestamp(
+        uint64_t _timestamp)
+{
+    m_timestamp = _timestamp;
+}
+
+/*!
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
+ */
+uint64_t CounterUAS::ClusterTableMessage::timestamp() const
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
+ */
+uint64_t& CounterUAS::ClusterTableMessage::timestamp()
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function sets a value in member dwellCount
+ * @param _dwellCount New value for member dwellCount
+ */
+void CounterUAS::ClusterTableMessage::dwellCount(
+        uint32_t _dwellCount)
+{
+    m_dwellCount = _dwellCount;
+}
+
+/*!
+ * @brief This function returns the value of member dwellCount
+ * @return Value of member dwellCount
+ */
+uint32_t CounterUAS::ClusterTableMessage::dwellCount() const
+{
+    return m_dwellCount;
+}
+
+/*!
+ * @brief This function returns a reference to member dwellCount
+ * @return Reference to member dwellCount
+ */
+uint32_t& CounterUAS::ClusterTableMessage::dwellCount()
+{
+    return m_dwellCount;
+}
+
+/*!
+ * @brief This function sets a value in member numClusters
+ * @param _numClusters New value for member numClusters
+ */
+void CounterUAS::ClusterTableMessage::numClusters(
+        uint32_t _numClusters)
+{
+    m_numClusters = _numClusters;
+}
+
+/*!
+ * @brief This function returns the value of member numClusters
+ * @return Value of member numClusters
+ */
+uint32_t CounterUAS::ClusterTableMessage::numClusters() const
+{
+    return m_numClusters;
+}
+
+/*!
+ * @brief This function returns a reference to member numClusters
+ * @return Reference to member numClusters
+ */
+uint32_t& CounterUAS::ClusterTableMessage::numClusters()
+{
+    return m_numClusters;
+}
+
+/*!
+ * @brief This function copies the value in member clusters
+ * @param _clusters New value to be copied in member clusters
+ */
+void CounterUAS::ClusterTableMessage::clusters(
+        const std::vector<CounterUAS::ClusterData>& _clusters)
+{
+    m_clusters = _clusters;
+}
+
+/*!
+ * @brief This function moves the value in member clusters
+ * @param _clusters New value to be moved in member clusters
+ */
+void CounterUAS::ClusterTableMessage::clusters(
+        std::vector<CounterUAS::ClusterData>&& _clusters)
+{
+    m_clusters = std::move(_clusters);
+}
+
+/*!
+ * @brief This function returns a constant reference to member clusters
+ * @return Constant reference to member clusters
+ */
+const std::vector<CounterUAS::ClusterData>& CounterUAS::ClusterTableMessage::clusters() const
+{
+    return m_clusters;
+}
+
+/*!
+ * @brief This function returns a reference to member clusters
+ * @return Reference to member clusters
+ */
+std::vector<CounterUAS::ClusterData>& CounterUAS::ClusterTableMessage::clusters()
+{
+    return m_clusters;
+}
+
+size_t CounterUAS::ClusterTableMessage::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+
+    return current_align;
+}
+
+bool CounterUAS::ClusterTableMessage::isKeyDefined()
+{
+    return false;
+}
+
+void CounterUAS::ClusterTableMessage::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+         
+}
+
+
+CounterUAS::AssocEntry::AssocEntry()
+{
+    // m_trackId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@67e2d983
+    m_trackId = 0;
+    // m_clusterId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5d47c63f
+    m_clusterId = 0;
+    // m_distance com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5ea434c8
+    m_distance = 0.0;
+    // m_matched com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3bbc39f8
+    m_matched = false;
+
+}
+
+CounterUAS::AssocEntry::~AssocEntry()
+{
+
+
+
+}
+
+CounterUAS::AssocEntry::AssocEntry(
+        const AssocEntry& x)
+{
+    m_trackId = x.m_trackId;
+    m_clusterId = x.m_clusterId;
+    m_distance = x.m_distance;
+    m_matched = x.m_matched;
+}
+
+CounterUAS::AssocEntry::AssocEntry(
+        AssocEntry&& x) noexcept 
+{
+    m_trackId = x.m_trackId;
+    m_clusterId = x.m_clusterId;
+    m_distance = x.m_distance;
+    m_matched = x.m_matched;
+}
+
+CounterUAS::AssocEntry& CounterUAS::AssocEntry::operator =(
+        const AssocEntry& x)
+{
+
+    m_trackId = x.m_trackId;
+    m_clusterId = x.m_clusterId;
+    m_distance = x.m_distance;
+    m_matched = x.m_matched;
+
+    return *this;
+}
+
+CounterUAS::AssocEntry& CounterUAS::AssocEntry::operator =(
+        AssocEntry&& x) noexcept
+{
+
+    m_trackId = x.m_trackId;
+    m_clusterId = x.m_clusterId;
+    m_distance = x.m_distance;
+    m_matched = x.m_matched;
+
+    return *this;
+}
+
+bool CounterUAS::AssocEntry::operator ==(
+        const AssocEntry& x) const
+{
+
+    return (m_trackId == x.m_trackId && m_clusterId == x.m_clusterId && m_distance == x.m_distance && m_matched == x.m_matched);
+}
+
+bool CounterUAS::AssocEntry::operator !=(
+        const AssocEntry& x) const
+{
+    return !(*this == x);
+}
+
+size_t CounterUAS::AssocEntry::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 1 + eprosima::fastcdr::Cdr::alignment(current_alignment, 1);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t CounterUAS::AssocEntry::getCdrSerializedSize(
+        const CounterUAS::AssocEntry& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 1 + eprosima::fastcdr::Cdr::alignment(current_alignment, 1);
+
+
+
+    return current_alignment - initial_alignment;
+}
+
+void CounterUAS::AssocEntry::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_trackId;
+    scdr << m_clusterId;
+    scdr << m_distance;
+    scdr << m_matched;
+
+}
+
+void CounterUAS::AssocEntry::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_trackId;
+    dcdr >> m_clusterId;
+    dcdr >> m_distance;
+    dcdr >> m_matched;
+}
+
+/*!
+ * @brief This function sets a value in member trackId
+ * @param _trackId New value for member trackId
+ */
+void CounterUAS::AssocEntry::trackId(
+        uint32_t _trackId)
+{
+    m_trackId = _trackId;
+}
+
+/*!
+ * @brief This function returns the value of member trackId
+ * @return Value of member trackId
+ */
+uint32_t CounterUAS::AssocEntry::trackId() const
+{
+    return m_trackId;
+}
+
+/*!
+ * @brief This function returns a reference to member trackId
+ * @return Reference to member trackId
+ */
+uint32_t& CounterUAS::AssocEntry::trackId()
+{
+    return m_trackId;
+}
+
+/*!
+ * @brief This function sets a value in member clusterId
+ * @param _clusterId New value for member clusterId
+ */
+void CounterUAS::AssocEntry::clusterId(
+        uint32_t _clusterId)
+{
+    m_clusterId = _clusterId;
+}
+
+/*!
+ * @brief This function returns the value of member clusterId
+ * @return Value of member clusterId
+ */
+uint32_t CounterUAS::AssocEntry::clusterId() const
+{
+    return m_clusterId;
+}
+
+/*!
+ * @brief This function returns a reference to member clusterId
+ * @return Reference to member clusterId
+ */
+uint32_t& CounterUAS::AssocEntry::clusterId()
+{
+    return m_clusterId;
+}
+
+/*!
+ * @brief This function sets a value in member distance
+ * @param _distance New value for member distance
+ */
+void CounterUAS::AssocEntry::distance(
+        double _distance)
+{
+    m_distance = _distance;
+}
+
+/*!
+ * @brief This function returns the value of member distance
+ * @return Value of member distance
+ */
+double CounterUAS::AssocEntry::distance() const
+{
+    return m_distance;
+}
+
+/*!
+ * @brief This function returns a reference to member distance
+ * @return Reference to member distance
+ */
+double& CounterUAS::AssocEntry::distance()
+{
+    return m_distance;
+}
+
+/*!
+ * @brief This function sets a value in member matched
+ * @param _matched New value for member matched
+ */
+void CounterUAS::AssocEntry::matched(
+        bool _matched)
+{
+    m_matched = _matched;
+}
+
+/*!
+ * @brief This function returns the value of member matched
+ * @return Value of member matched
+ */
+bool CounterUAS::AssocEntry::matched() const
+{
+    return m_matched;
+}
+
+/*!
+ * @brief This function returns a reference to member matched
+ * @return Reference to member matched
+ */
+bool& CounterUAS::AssocEntry::matched()
+{
+    return m_matched;
+}
+
+
+size_t CounterUAS::AssocEntry::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+
+    return current_align;
+}
+
+bool CounterUAS::AssocEntry::isKeyDefined()
+{
+    return false;
+}
+
+void CounterUAS::AssocEntry::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+        
+}
+
+CounterUAS::AssocTableMessage::AssocTableMessage()
+{
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4ae3c1cd
+    m_messageId = 0;
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@29f69090
+    m_timestamp = 0;
+    // m_numEntries com.eprosima.idl.parser.typecode.PrimitiveTypeCode@568bf312
+    m_numEntries = 0;
+    // m_entries com.eprosima.idl.parser.typecode.SequenceTypeCode@ca263c2
+
+
+}
+
+CounterUAS::AssocTableMessage::~AssocTableMessage()
+{
+
+
+
+}
+
+CounterUAS::AssocTableMessage::AssocTableMessage(
+        const AssocTableMessage& x)
+{
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numEntries = x.m_numEntries;
+    m_entries = x.m_entries;
+}
+
+CounterUAS::AssocTableMessage::AssocTableMessage(
+        AssocTableMessage&& x) noexcept 
+{
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numEntries = x.m_numEntries;
+    m_entries = std::move(x.m_entries);
+}
+
+CounterUAS::AssocTableMessage& CounterUAS::AssocTableMessage::operator =(
+        const AssocTableMessage& x)
+{
+
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numEntries = x.m_numEntries;
+    m_entries = x.m_entries;
+
+    return *this;
+}
+
+CounterUAS::AssocTableMessage& CounterUAS::AssocTableMessage::operator =(
+        AssocTableMessage&& x) noexcept
+{
+
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numEntries = x.m_numEntries;
+    m_entries = std::move(x.m_entries);
+
+    return *this;
+}
+
+bool CounterUAS::AssocTableMessage::operator ==(
+        const AssocTableMessage& x) const
+{
+
+    return (m_messageId == x.m_messageId && m_timestamp == x.m_timestamp && m_numEntries == x.m_numEntries && m_entries == x.m_entries);
+}
+
+bool CounterUAS::AssocTableMessage::operator !=(
+        const AssocTableMessage& x) const
+{
+    return !(*this == x);
+}
+
+size_t CounterUAS::AssocTableMessage::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    for(size_t a = 0; a < 100; ++a)
+    {
+        current_alignment += CounterUAS::AssocEntry::getMaxCdrSerializedSize(current_alignment);}
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t CounterUAS::AssocTableMessage::getCdrSerializedSize(
+        const CounterUAS::AssocTableMessage& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    for(size_t a = 0; a < data.entries().size(); ++a)
+    {
+        current_alignment += CounterUAS::AssocEntry::getCdrSerializedSize(data.entries().at(a), current_alignment);}
+
+
+    return current_alignment - initial_alignment;
+}
+
+void CounterUAS::AssocTableMessage::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_messageId;
+    scdr << m_timestamp;
+    scdr << m_numEntries;
+    scdr << m_entries;
+
+}
+
+void CounterUAS::AssocTableMessage::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_messageId;
+    dcdr >> m_timestamp;
+    dcdr >> m_numEntries;
+    dcdr >> m_entries;
+}
+
+/*!
+ * @brief This function sets a value in member messageId
+ * @param _messageId New value for member messageId
+ */
+void CounterUAS::AssocTableMessage::messageId(
+        uint32_t _messageId)
+{
+    m_messageId = _messageId;
+}
+
+/*!
+ * @brief This function returns the value of member messageId
+ * @return Value of member messageId
+ */
+uint32_t CounterUAS::AssocTableMessage::messageId() const
+{
+    return m_messageId;
+}
+
+/*!
+ * @brief This function returns a reference to member messageId
+ * @return Reference to member messageId
+ */
+uint32_t& CounterUAS::AssocTableMessage::messageId()
+{
+    return m_messageId;
+}
+
+/*!
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
+ */
+void CounterUAS::AssocTableMessage::timestamp(
+        uint64_t _timestamp)
+{
+    m_timestamp = _timestamp;
+}
+
+/*!
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
+ */
+uint64_t CounterUAS::AssocTableMessage::timestamp() const
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
+ */
+uint64_t& CounterUAS::AssocTableMessage::timestamp()
+{
+    return m_timestamp;
+}
+
+/*!
+ * @brief This function sets a value in member numEntries
+ * @param _numEntries New value for member numEntries
+ */
+void CounterUAS::AssocTableMessage::numEntries(
+        uint32_t _numEntries)
+{
+    m_numEntries = _numEntries;
+}
+
+/*!
+ * @brief This function returns the value of member numEntries
+ * @return Value of member numEntries
+ */
+uint32_t CounterUAS::AssocTableMessage::numEntries() const
+{
+    return m_numEntries;
+}
+
+/*!
+ * @brief This function returns a reference to member numEntries
+ * @return Reference to member numEntries
+ */
+uint32_t& CounterUAS::AssocTableMessage::numEntries()
+{
+    return m_numEntries;
+}
+
+/*!
+ * @brief This function copies the value in member entries
+ * @param _entries New value to be copied in member entries
+ */
+void CounterUAS::AssocTableMessage::entries(
+        const std::vector<CounterUAS::AssocEntry>& _entries)
+{
+    m_entries = _entries;
+}
+
+/*!
+ * @brief This function moves the value in member entries
+ * @param _entries New value to be moved in member entries
+ */
+void CounterUAS::AssocTableMessage::entries(
+        std::vector<CounterUAS::AssocEntry>&& _entries)
+{
+    m_entries = std::move(_entries);
+}
+
+/*!
+ * @brief This function returns a constant reference to member entries
+ * @return Constant reference to member entries
+ */
+const std::vector<CounterUAS::AssocEntry>& CounterUAS::AssocTableMessage::entries() const
+{
+    return m_entries;
+}
+
+/*!
+ * @brief This function returns a reference to member entries
+ * @return Reference to member entries
+ */
+std::vector<CounterUAS::AssocEntry>& CounterUAS::AssocTableMessage::entries()
+{
+    return m_entries;
+}
+
+size_t CounterUAS::AssocTableMessage::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+
+    return current_align;
+}
+
+bool CounterUAS::AssocTableMessage::isKeyDefined()
+{
+    return false;
+}
+
+void CounterUAS::AssocTableMessage::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+        
+}
+
+
+CounterUAS::PredictedEntry::PredictedEntry()
+{
+    // m_trackId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4c6e276e
+    m_trackId = 0;
+    // m_trackStatus com.eprosima.idl.parser.typecode.EnumTypeCode@1b68b9a4
+    m_trackStatus = CounterUAS::TRACK_TENTATIVE;
+    // m_x com.eprosima.idl.parser.typecode.PrimitiveTypeCode@534df152
     m_x = 0.0;
-    // m_y com.eprosima.idl.parser.typecode.PrimitiveTypeCode@157632c9
+    // m_vx com.eprosima.idl.parser.typecode.PrimitiveTypeCode@52e677af
+    m_vx = 0.0;
+    // m_ax com.eprosima.idl.parser.typecode.PrimitiveTypeCode@35083305
+    m_ax = 0.0;
+    // m_y com.eprosima.idl.parser.typecode.PrimitiveTypeCode@8e0379d
     m_y = 0.0;
-    // m_z com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6ee12bac
+    // m_vy com.eprosima.idl.parser.typecode.PrimitiveTypeCode@341b80b2
+    m_vy = 0.0;
+    // m_ay com.eprosima.idl.parser.typecode.PrimitiveTypeCode@55a1c291
+    m_ay = 0.0;
+    // m_z com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2145433b
     m_z = 0.0;
+    // m_vz com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2890c451
+    m_vz = 0.0;
+    // m_az com.eprosima.idl.parser.typecode.PrimitiveTypeCode@40e6dfe1
+    m_az = 0.0;
+    // m_range com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1b083826
+    m_range = 0.0;
+    // m_azimuth com.eprosima.idl.parser.typecode.PrimitiveTypeCode@105fece7
+    m_azimuth = 0.0;
+    // m_elevation com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3ec300f1
+    m_elevation = 0.0;
+    // m_covX com.eprosima.idl.parser.typecode.PrimitiveTypeCode@482cd91f
+    m_covX = 0.0;
+    // m_covY com.eprosima.idl.parser.typecode.PrimitiveTypeCode@123f1134
+    m_covY = 0.0;
+    // m_covZ com.eprosima.idl.parser.typecode.PrimitiveTypeCode@7d68ef40
+    m_covZ = 0.0;
+    // m_modelProb0 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5b0abc94
+    m_modelProb0 = 0.0;
+    // m_modelProb1 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@75c072cb
+    m_modelProb1 = 0.0;
+    // m_modelProb2 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1f1c7bf6
+    m_modelProb2 = 0.0;
+    // m_modelProb3 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@25b485ba
+    m_modelProb3 = 0.0;
+    // m_modelProb4 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2b546384
+    m_modelProb4 = 0.0;
+
+}
+
+CounterUAS::PredictedEntry::~PredictedEntry()
+{
+
+
+
+
+
+
+
+
 
-}
 
-CounterUAS::ClusterData::~ClusterData()
-{
 
 
 
@@ -2096,94 +5894,134 @@ CounterUAS::ClusterData::~ClusterData()
 
 }
 
-CounterUAS::ClusterData::ClusterData(
-        const ClusterData& x)
+CounterUAS::PredictedEntry::PredictedEntry(
+        const PredictedEntry& x)
 {
-    m_clusterId = x.m_clusterId;
-    m_numDetections = x.m_numDetections;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_strength = x.m_strength;
-    m_snr = x.m_snr;
-    m_rcs = x.m_rcs;
-    m_microDoppler = x.m_microDoppler;
+    m_trackId = x.m_trackId;
+    m_trackStatus = x.m_trackStatus;
     m_x = x.m_x;
+    m_vx = x.m_vx;
+    m_ax = x.m_ax;
     m_y = x.m_y;
+    m_vy = x.m_vy;
+    m_ay = x.m_ay;
     m_z = x.m_z;
-}
-
-CounterUAS::ClusterData::ClusterData(
-        ClusterData&& x) noexcept 
-{
-    m_clusterId = x.m_clusterId;
-    m_numDetections = x.m_numDetections;
+    m_vz = x.m_vz;
+    m_az = x.m_az;
     m_range = x.m_range;
     m_azimuth = x.m_azimuth;
     m_elevation = x.m_elevation;
-    m_strength = x.m_strength;
-    m_snr = x.m_snr;
-    m_rcs = x.m_rcs;
-    m_microDoppler = x.m_microDoppler;
+    m_covX = x.m_covX;
+    m_covY = x.m_covY;
+    m_covZ = x.m_covZ;
+    m_modelProb0 = x.m_modelProb0;
+    m_modelProb1 = x.m_modelProb1;
+    m_modelProb2 = x.m_modelProb2;
+    m_modelProb3 = x.m_modelProb3;
+    m_modelProb4 = x.m_modelProb4;
+}
+
+CounterUAS::PredictedEntry::PredictedEntry(
+        PredictedEntry&& x) noexcept 
+{
+    m_trackId = x.m_trackId;
+    m_trackStatus = x.m_trackStatus;
     m_x = x.m_x;
+    m_vx = x.m_vx;
+    m_ax = x.m_ax;
     m_y = x.m_y;
+    m_vy = x.m_vy;
+    m_ay = x.m_ay;
     m_z = x.m_z;
+    m_vz = x.m_vz;
+    m_az = x.m_az;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_covX = x.m_covX;
+    m_covY = x.m_covY;
+    m_covZ = x.m_covZ;
+    m_modelProb0 = x.m_modelProb0;
+    m_modelProb1 = x.m_modelProb1;
+    m_modelProb2 = x.m_modelProb2;
+    m_modelProb3 = x.m_modelProb3;
+    m_modelProb4 = x.m_modelProb4;
 }
 
-CounterUAS::ClusterData& CounterUAS::ClusterData::operator =(
-        const ClusterData& x)
+CounterUAS::PredictedEntry& CounterUAS::PredictedEntry::operator =(
+        const PredictedEntry& x)
 {
 
-    m_clusterId = x.m_clusterId;
-    m_numDetections = x.m_numDetections;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_strength = x.m_strength;
-    m_snr = x.m_snr;
-    m_rcs = x.m_rcs;
-    m_microDoppler = x.m_microDoppler;
+    m_trackId = x.m_trackId;
+    m_trackStatus = x.m_trackStatus;
     m_x = x.m_x;
+    m_vx = x.m_vx;
+    m_ax = x.m_ax;
     m_y = x.m_y;
+    m_vy = x.m_vy;
+    m_ay = x.m_ay;
     m_z = x.m_z;
+    m_vz = x.m_vz;
+    m_az = x.m_az;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_covX = x.m_covX;
+    m_covY = x.m_covY;
+    m_covZ = x.m_covZ;
+    m_modelProb0 = x.m_modelProb0;
+    m_modelProb1 = x.m_modelProb1;
+    m_modelProb2 = x.m_modelProb2;
+    m_modelProb3 = x.m_modelProb3;
+    m_modelProb4 = x.m_modelProb4;
 
     return *this;
 }
 
-CounterUAS::ClusterData& CounterUAS::ClusterData::operator =(
-        ClusterData&& x) noexcept
+CounterUAS::PredictedEntry& CounterUAS::PredictedEntry::operator =(
+        PredictedEntry&& x) noexcept
 {
 
-    m_clusterId = x.m_clusterId;
-    m_numDetections = x.m_numDetections;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_strength = x.m_strength;
-    m_snr = x.m_snr;
-    m_rcs = x.m_rcs;
-    m_microDoppler = x.m_microDoppler;
+    m_trackId = x.m_trackId;
+    m_trackStatus = x.m_trackStatus;
     m_x = x.m_x;
+    m_vx = x.m_vx;
+    m_ax = x.m_ax;
     m_y = x.m_y;
+    m_vy = x.m_vy;
+    m_ay = x.m_ay;
     m_z = x.m_z;
+    m_vz = x.m_vz;
+    m_az = x.m_az;
+    m_range = x.m_range;
+    m_azimuth = x.m_azimuth;
+    m_elevation = x.m_elevation;
+    m_covX = x.m_covX;
+    m_covY = x.m_covY;
+    m_covZ = x.m_covZ;
+    m_modelProb0 = x.m_modelProb0;
+    m_modelProb1 = x.m_modelProb1;
+    m_modelProb2 = x.m_modelProb2;
+    m_modelProb3 = x.m_modelProb3;
+    m_modelProb4 = x.m_modelProb4;
 
     return *this;
 }
 
-bool CounterUAS::ClusterData::operator ==(
-        const ClusterData& x) const
+bool CounterUAS::PredictedEntry::operator ==(
+        const PredictedEntry& x) const
 {
 
-    return (m_clusterId == x.m_clusterId && m_numDetections == x.m_numDetections && m_range == x.m_range && m_azimuth == x.m_azimuth && m_elevation == x.m_elevation && m_strength == x.m_strength && m_snr == x.m_snr && m_rcs == x.m_rcs && m_microDoppler == x.m_microDoppler && m_x == x.m_x && m_y == x.m_y && m_z == x.m_z);
+    return (m_trackId == x.m_trackId && m_trackStatus == x.m_trackStatus && m_x == x.m_x && m_vx == x.m_vx && m_ax == x.m_ax && m_y == x.m_y && m_vy == x.m_vy && m_ay == x.m_ay && m_z == x.m_z && m_vz == x.m_vz && m_az == x.m_az && m_range == x.m_range && m_azimuth == x.m_azimuth && m_elevation == x.m_elevation && m_covX == x.m_covX && m_covY == x.m_covY && m_covZ == x.m_covZ && m_modelProb0 == x.m_modelProb0 && m_modelProb1 == x.m_modelProb1 && m_modelProb2 == x.m_modelProb2 && m_modelProb3 == x.m_modelProb3 && m_modelProb4 == x.m_modelProb4);
 }
 
-bool CounterUAS::ClusterData::operator !=(
-        const ClusterData& x) const
+bool CounterUAS::PredictedEntry::operator !=(
+        const PredictedEntry& x) const
 {
     return !(*this == x);
 }
 
-size_t CounterUAS::ClusterData::getMaxCdrSerializedSize(
+size_t CounterUAS::PredictedEntry::getMaxCdrSerializedSize(
         size_t current_alignment)
 {
     size_t initial_alignment = current_alignment;
@@ -2225,12 +6063,42 @@ size_t CounterUAS::ClusterData::getMaxCdrSerializedSize(
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
 
     return current_alignment - initial_alignment;
 }
 
-size_t CounterUAS::ClusterData::getCdrSerializedSize(
-        const CounterUAS::ClusterData& data,
+size_t CounterUAS::PredictedEntry::getCdrSerializedSize(
+        const CounterUAS::PredictedEntry& data,
         size_t current_alignment)
 {
     (void)data;
@@ -2273,360 +6141,331 @@ size_t CounterUAS::ClusterData::getCdrSerializedSize(
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
-    return current_alignment - initial_alignment;
-}
 
-void CounterUAS::ClusterData::serialize(
-        eprosima::fastcdr::Cdr& scdr) const
-{
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
-    scdr << m_clusterId;
-    scdr << m_numDetections;
-    scdr << m_range;
-    scdr << m_azimuth;
-    scdr << m_elevation;
-    scdr << m_strength;
-    scdr << m_snr;
-    scdr << m_rcs;
-    scdr << m_microDoppler;
-    scdr << m_x;
-    scdr << m_y;
-    scdr << m_z;
 
-}
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
-void CounterUAS::ClusterData::deserialize(
-        eprosima::fastcdr::Cdr& dcdr)
-{
 
-    dcdr >> m_clusterId;
-    dcdr >> m_numDetections;
-    dcdr >> m_range;
-    dcdr >> m_azimuth;
-    dcdr >> m_elevation;
-    dcdr >> m_strength;
-    dcdr >> m_snr;
-    dcdr >> m_rcs;
-    dcdr >> m_microDoppler;
-    dcdr >> m_x;
-    dcdr >> m_y;
-    dcdr >> m_z;
-}
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
-/*!
- * @brief This function sets a value in member clusterId
- * @param _clusterId New value for member clusterId
- */
-void CounterUAS::ClusterData::clusterId(
-        uint32_t _clusterId)
-{
-    m_clusterId = _clusterId;
-}
 
-/*!
- * @brief This function returns the value of member clusterId
- * @return Value of member clusterId
- */
-uint32_t CounterUAS::ClusterData::clusterId() const
-{
-    return m_clusterId;
-}
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
-/*!
- * @brief This function returns a reference to member clusterId
- * @return Reference to member clusterId
- */
-uint32_t& CounterUAS::ClusterData::clusterId()
-{
-    return m_clusterId;
-}
 
-/*!
- * @brief This function sets a value in member numDetections
- * @param _numDetections New value for member numDetections
- */
-void CounterUAS::ClusterData::numDetections(
-        uint32_t _numDetections)
-{
-    m_numDetections = _numDetections;
-}
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
 
-/*!
- * @brief This function returns the value of member numDetections
- * @return Value of member numDetections
- */
-uint32_t CounterUAS::ClusterData::numDetections() const
-{
-    return m_numDetections;
-}
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
-/*!
- * @brief This function returns a reference to member numDetections
- * @return Reference to member numDetections
- */
-uint32_t& CounterUAS::ClusterData::numDetections()
-{
-    return m_numDetections;
-}
 
-/*!
- * @brief This function sets a value in member range
- * @param _range New value for member range
- */
-void CounterUAS::ClusterData::range(
-        double _range)
-{
-    m_range = _range;
+
+    return current_alignment - initial_alignment;
 }
 
-/*!
- * @brief This function returns the value of member range
- * @return Value of member range
- */
-double CounterUAS::ClusterData::range() const
+void CounterUAS::PredictedEntry::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
 {
-    return m_range;
+
+    scdr << m_trackId;
+    scdr << (uint32_t)m_trackStatus;
+    scdr << m_x;
+    scdr << m_vx;
+    scdr << m_ax;
+    scdr << m_y;
+    scdr << m_vy;
+    scdr << m_ay;
+    scdr << m_z;
+    scdr << m_vz;
+    scdr << m_az;
+    scdr << m_range;
+    scdr << m_azimuth;
+    scdr << m_elevation;
+    scdr << m_covX;
+    scdr << m_covY;
+    scdr << m_covZ;
+    scdr << m_modelProb0;
+    scdr << m_modelProb1;
+    scdr << m_modelProb2;
+    scdr << m_modelProb3;
+    scdr << m_modelProb4;
+
 }
 
-/*!
- * @brief This function returns a reference to member range
- * @return Reference to member range
- */
-double& CounterUAS::ClusterData::range()
+void CounterUAS::PredictedEntry::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
 {
-    return m_range;
+
+    dcdr >> m_trackId;
+    {
+        uint32_t enum_value = 0;
+        dcdr >> enum_value;
+        m_trackStatus = (CounterUAS::TrackStatus)enum_value;
+    }
+
+    dcdr >> m_x;
+    dcdr >> m_vx;
+    dcdr >> m_ax;
+    dcdr >> m_y;
+    dcdr >> m_vy;
+    dcdr >> m_ay;
+    dcdr >> m_z;
+    dcdr >> m_vz;
+    dcdr >> m_az;
+    dcdr >> m_range;
+    dcdr >> m_azimuth;
+    dcdr >> m_elevation;
+    dcdr >> m_covX;
+    dcdr >> m_covY;
+    dcdr >> m_covZ;
+    dcdr >> m_modelProb0;
+    dcdr >> m_modelProb1;
+    dcdr >> m_modelProb2;
+    dcdr >> m_modelProb3;
+    dcdr >> m_modelProb4;
 }
 
 /*!
- * @brief This function sets a value in member azimuth
- * @param _azimuth New value for member azimuth
+ * @brief This function sets a value in member trackId
+ * @param _trackId New value for member trackId
  */
-void CounterUAS::ClusterData::azimuth(
-        double _azimuth)
+void CounterUAS::PredictedEntry::trackId(
+        uint32_t _trackId)
 {
-    m_azimuth = _azimuth;
+    m_trackId = _trackId;
 }
 
 /*!
- * @brief This function returns the value of member azimuth
- * @return Value of member azimuth
+ * @brief This function returns the value of member trackId
+ * @return Value of member trackId
  */
-double CounterUAS::ClusterData::azimuth() const
+uint32_t CounterUAS::PredictedEntry::trackId() const
 {
-    return m_azimuth;
+    return m_trackId;
 }
 
 /*!
- * @brief This function returns a reference to member azimuth
- * @return Reference to member azimuth
+ * @brief This function returns a reference to member trackId
+ * @return Reference to member trackId
  */
-double& CounterUAS::ClusterData::azimuth()
+uint32_t& CounterUAS::PredictedEntry::trackId()
 {
-    return m_azimuth;
+    return m_trackId;
 }
 
 /*!
- * @brief This function sets a value in member elevation
- * @param _elevation New value for member elevation
+ * @brief This function sets a value in member trackStatus
+ * @param _trackStatus New value for member trackStatus
  */
-void CounterUAS::ClusterData::elevation(
-        double _elevation)
+void CounterUAS::PredictedEntry::trackStatus(
+        CounterUAS::TrackStatus _trackStatus)
 {
-    m_elevation = _elevation;
+    m_trackStatus = _trackStatus;
 }
 
 /*!
- * @brief This function returns the value of member elevation
- * @return Value of member elevation
+ * @brief This function returns the value of member trackStatus
+ * @return Value of member trackStatus
  */
-double CounterUAS::ClusterData::elevation() const
+CounterUAS::TrackStatus CounterUAS::PredictedEntry::trackStatus() const
 {
-    return m_elevation;
+    return m_trackStatus;
 }
 
 /*!
- * @brief This function returns a reference to member elevation
- * @return Reference to member elevation
+ * @brief This function returns a reference to member trackStatus
+ * @return Reference to member trackStatus
  */
-double& CounterUAS::ClusterData::elevation()
+CounterUAS::TrackStatus& CounterUAS::PredictedEntry::trackStatus()
 {
-    return m_elevation;
+    return m_trackStatus;
 }
 
 /*!
- * @brief This function sets a value in member strength
- * @param _strength New value for member strength
+ * @brief This function sets a value in member x
+ * @param _x New value for member x
  */
-void CounterUAS::ClusterData::strength(
-        double _strength)
+void CounterUAS::PredictedEntry::x(
+        double _x)
 {
-    m_strength = _strength;
+    m_x = _x;
 }
 
 /*!
- * @brief This function returns the value of member strength
- * @return Value of member strength
+ * @brief This function returns the value of member x
+ * @return Value of member x
  */
-double CounterUAS::ClusterData::strength() const
+double CounterUAS::PredictedEntry::x() const
 {
-    return m_strength;
+    return m_x;
 }
 
 /*!
- * @brief This function returns a reference to member strength
- * @return Reference to member strength
+ * @brief This function returns a reference to member x
+ * @return Reference to member x
  */
-double& CounterUAS::ClusterData::strength()
+double& CounterUAS::PredictedEntry::x()
 {
-    return m_strength;
+    return m_x;
 }
 
 /*!
- * @brief This function sets a value in member snr
- * @param _snr New value for member snr
+ * @brief This function sets a value in member vx
+ * @param _vx New value for member vx
  */
-void CounterUAS::ClusterData::snr(
-        double _snr)
+void CounterUAS::PredictedEntry::vx(
+        double _vx)
 {
-    m_snr = _snr;
+    m_vx = _vx;
 }
 
 /*!
- * @brief This function returns the value of member snr
- * @return Value of member snr
+ * @brief This function returns the value of member vx
+ * @return Value of member vx
  */
-double CounterUAS::ClusterData::snr() const
+double CounterUAS::PredictedEntry::vx() const
 {
-    return m_snr;
+    return m_vx;
 }
 
 /*!
- * @brief This function returns a reference to member snr
- * @return Reference to member snr
+ * @brief This function returns a reference to member vx
+ * @return Reference to member vx
  */
-double& CounterUAS::ClusterData::snr()
+double& CounterUAS::PredictedEntry::vx()
 {
-    return m_snr;
+    return m_vx;
 }
 
 /*!
- * @brief This function sets a value in member rcs
- * @param _rcs New value for member rcs
+ * @brief This function sets a value in member ax
+ * @param _ax New value for member ax
  */
-void CounterUAS::ClusterData::rcs(
-        double _rcs)
+void CounterUAS::PredictedEntry::ax(
+        double _ax)
 {
-    m_rcs = _rcs;
+    m_ax = _ax;
 }
 
 /*!
- * @brief This function returns the value of member rcs
- * @return Value of member rcs
+ * @brief This function returns the value of member ax
+ * @return Value of member ax
  */
-double CounterUAS::ClusterData::rcs() const
+double CounterUAS::PredictedEntry::ax() const
 {
-    return m_rcs;
+    return m_ax;
 }
 
 /*!
- * @brief This function returns a reference to member rcs
- * @return Reference to member rcs
+ * @brief This function returns a reference to member ax
+ * @return Reference to member ax
  */
-double& CounterUAS::ClusterData::rcs()
+double& CounterUAS::PredictedEntry::ax()
 {
-    return m_rcs;
+    return m_ax;
 }
 
 /*!
- * @brief This function sets a value in member microDoppler
- * @param _microDoppler New value for member microDoppler
+ * @brief This function sets a value in member y
+ * @param _y New value for member y
  */
-void CounterUAS::ClusterData::microDoppler(
-        double _microDoppler)
+void CounterUAS::PredictedEntry::y(
+        double _y)
 {
-    m_microDoppler = _microDoppler;
+    m_y = _y;
 }
 
 /*!
- * @brief This function returns the value of member microDoppler
- * @return Value of member microDoppler
+ * @brief This function returns the value of member y
+ * @return Value of member y
  */
-double CounterUAS::ClusterData::microDoppler() const
+double CounterUAS::PredictedEntry::y() const
 {
-    return m_microDoppler;
+    return m_y;
 }
 
 /*!
- * @brief This function returns a reference to member microDoppler
- * @return Reference to member microDoppler
+ * @brief This function returns a reference to member y
+ * @return Reference to member y
  */
-double& CounterUAS::ClusterData::microDoppler()
+double& CounterUAS::PredictedEntry::y()
 {
-    return m_microDoppler;
+    return m_y;
 }
 
 /*!
- * @brief This function sets a value in member x
- * @param _x New value for member x
+ * @brief This function sets a value in member vy
+ * @param _vy New value for member vy
  */
-void CounterUAS::ClusterData::x(
-        double _x)
+void CounterUAS::PredictedEntry::vy(
+        double _vy)
 {
-    m_x = _x;
+    m_vy = _vy;
 }
 
 /*!
- * @brief This function returns the value of member x
- * @return Value of member x
+ * @brief This function returns the value of member vy
+ * @return Value of member vy
  */
-double CounterUAS::ClusterData::x() const
+double CounterUAS::PredictedEntry::vy() const
 {
-    return m_x;
+    return m_vy;
 }
 
 /*!
- * @brief This function returns a reference to member x
- * @return Reference to member x
+ * @brief This function returns a reference to member vy
+ * @return Reference to member vy
  */
-double& CounterUAS::ClusterData::x()
+double& CounterUAS::PredictedEntry::vy()
 {
-    return m_x;
+    return m_vy;
 }
 
 /*!
- * @brief This function sets a value in member y
- * @param _y New value for member y
+ * @brief This function sets a value in member ay
+ * @param _ay New value for member ay
  */
-void CounterUAS::ClusterData::y(
-        double _y)
+void CounterUAS::PredictedEntry::ay(
+        double _ay)
 {
-    m_y = _y;
+    m_ay = _ay;
 }
 
 /*!
- * @brief This function returns the value of member y
- * @return Value of member y
+ * @brief This function returns the value of member ay
+ * @return Value of member ay
  */
-double CounterUAS::ClusterData::y() const
+double CounterUAS::PredictedEntry::ay() const
 {
-    return m_y;
+    return m_ay;
 }
 
 /*!
- * @brief This function returns a reference to member y
- * @return Reference to member y
+ * @brief This function returns a reference to member ay
+ * @return Reference to member ay
  */
-double& CounterUAS::ClusterData::y()
+double& CounterUAS::PredictedEntry::ay()
 {
-    return m_y;
+    return m_ay;
 }
 
 /*!
  * @brief This function sets a value in member z
  * @param _z New value for member z
  */
-void CounterUAS::ClusterData::z(
+void CounterUAS::PredictedEntry::z(
         double _z)
 {
     m_z = _z;
@@ -2636,7 +6475,7 @@ void CounterUAS::ClusterData::z(
  * @brief This function returns the value of member z
  * @return Value of member z
  */
-double CounterUAS::ClusterData::z() const
+double CounterUAS::PredictedEntry::z() const
 {
     return m_z;
 }
@@ -2645,350 +6484,377 @@ double CounterUAS::ClusterData::z() const
  * @brief This function returns a reference to member z
  * @return Reference to member z
  */
-double& CounterUAS::ClusterData::z()
+double& CounterUAS::PredictedEntry::z()
 {
     return m_z;
 }
 
-
-size_t CounterUAS::ClusterData::getKeyMaxCdrSerializedSize(
-        size_t current_alignment)
-{
-    size_t current_align = current_alignment;
-
-
-
-    return current_align;
-}
-
-bool CounterUAS::ClusterData::isKeyDefined()
+/*!
+ * @brief This function sets a value in member vz
+ * @param _vz New value for member vz
+ */
+void CounterUAS::PredictedEntry::vz(
+        double _vz)
 {
-    return false;
+    m_vz = _vz;
 }
 
-void CounterUAS::ClusterData::serializeKey(
-        eprosima::fastcdr::Cdr& scdr) const
+/*!
+ * @brief This function returns the value of member vz
+ * @return Value of member vz
+ */
+double CounterUAS::PredictedEntry::vz() const
 {
-    (void) scdr;
-                
+    return m_vz;
 }
 
-CounterUAS::ClusterTableMessage::ClusterTableMessage()
+/*!
+ * @brief This function returns a reference to member vz
+ * @return Reference to member vz
+ */
+double& CounterUAS::PredictedEntry::vz()
 {
-    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@55040f2f
-    m_messageId = 0;
-    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@64c87930
-    m_timestamp = 0;
-    // m_dwellCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@400cff1a
-    m_dwellCount = 0;
-    // m_numClusters com.eprosima.idl.parser.typecode.PrimitiveTypeCode@275710fc
-    m_numClusters = 0;
-    // m_clusters com.eprosima.idl.parser.typecode.SequenceTypeCode@525f1e4e
-
-
+    return m_vz;
 }
 
-CounterUAS::ClusterTableMessage::~ClusterTableMessage()
+/*!
+ * @brief This function sets a value in member az
+ * @param _az New value for member az
+ */
+void CounterUAS::PredictedEntry::az(
+        double _az)
 {
-
-
-
-
+    m_az = _az;
 }
 
-CounterUAS::ClusterTableMessage::ClusterTableMessage(
-        const ClusterTableMessage& x)
+/*!
+ * @brief This function returns the value of member az
+ * @return Value of member az
+ */
+double CounterUAS::PredictedEntry::az() const
 {
-    m_messageId = x.m_messageId;
-    m_timestamp = x.m_timestamp;
-    m_dwellCount = x.m_dwellCount;
-    m_numClusters = x.m_numClusters;
-    m_clusters = x.m_clusters;
+    return m_az;
 }
 
-CounterUAS::ClusterTableMessage::ClusterTableMessage(
-        ClusterTableMessage&& x) noexcept 
+/*!
+ * @brief This function returns a reference to member az
+ * @return Reference to member az
+ */
+double& CounterUAS::PredictedEntry::az()
 {
-    m_messageId = x.m_messageId;
-    m_timestamp = x.m_timestamp;
-    m_dwellCount = x.m_dwellCount;
-    m_numClusters = x.m_numClusters;
-    m_clusters = std::move(x.m_clusters);
+    return m_az;
 }
 
-CounterUAS::ClusterTableMessage& CounterUAS::ClusterTableMessage::operator =(
-        const ClusterTableMessage& x)
+/*!
+ * @brief This function sets a value in member range
+ * @param _range New value for member range
+ */
+void CounterUAS::PredictedEntry::range(
+        double _range)
 {
-
-    m_messageId = x.m_messageId;
-    m_timestamp = x.m_timestamp;
-    m_dwellCount = x.m_dwellCount;
-    m_numClusters = x.m_numClusters;
-    m_clusters = x.m_clusters;
-
-    return *this;
+    m_range = _range;
 }
 
-CounterUAS::ClusterTableMessage& CounterUAS::ClusterTableMessage::operator =(
-        ClusterTableMessage&& x) noexcept
+/*!
+ * @brief This function returns the value of member range
+ * @return Value of member range
+ */
+double CounterUAS::PredictedEntry::range() const
 {
-
-    m_messageId = x.m_messageId;
-    m_timestamp = x.m_timestamp;
-    m_dwellCount = x.m_dwellCount;
-    m_numClusters = x.m_numClusters;
-    m_clusters = std::move(x.m_clusters);
-
-    return *this;
+    return m_range;
 }
 
-bool CounterUAS::ClusterTableMessage::operator ==(
-        const ClusterTableMessage& x) const
+/*!
+ * @brief This function returns a reference to member range
+ * @return Reference to member range
+ */
+double& CounterUAS::PredictedEntry::range()
 {
-
-    return (m_messageId == x.m_messageId && m_timestamp == x.m_timestamp && m_dwellCount == x.m_dwellCount && m_numClusters == x.m_numClusters && m_clusters == x.m_clusters);
+    return m_range;
 }
 
-bool CounterUAS::ClusterTableMessage::operator !=(
-        const ClusterTableMessage& x) const
+/*!
+ * @brief This function sets a value in member azimuth
+ * @param _azimuth New value for member azimuth
+ */
+void CounterUAS::PredictedEntry::azimuth(
+        double _azimuth)
 {
-    return !(*this == x);
+    m_azimuth = _azimuth;
 }
 
-size_t CounterUAS::ClusterTableMessage::getMaxCdrSerializedSize(
-        size_t current_alignment)
+/*!
+ * @brief This function returns the value of member azimuth
+ * @return Value of member azimuth
+ */
+double CounterUAS::PredictedEntry::azimuth() const
 {
-    size_t initial_alignment = current_alignment;
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    for(size_t a = 0; a < 100; ++a)
-    {
-        current_alignment += CounterUAS::ClusterData::getMaxCdrSerializedSize(current_alignment);}
-
-
-    return current_alignment - initial_alignment;
+    return m_azimuth;
 }
 
-size_t CounterUAS::ClusterTableMessage::getCdrSerializedSize(
-        const CounterUAS::ClusterTableMessage& data,
-        size_t current_alignment)
+/*!
+ * @brief This function returns a reference to member azimuth
+ * @return Reference to member azimuth
+ */
+double& CounterUAS::PredictedEntry::azimuth()
 {
-    (void)data;
-    size_t initial_alignment = current_alignment;
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+    return m_azimuth;
+}
 
+/*!
+ * @brief This function sets a value in member elevation
+ * @param _elevation New value for member elevation
+ */
+void CounterUAS::PredictedEntry::elevation(
+        double _elevation)
+{
+    m_elevation = _elevation;
+}
 
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+/*!
+ * @brief This function returns the value of member elevation
+ * @return Value of member elevation
+ */
+double CounterUAS::PredictedEntry::elevation() const
+{
+    return m_elevation;
+}
 
+/*!
+ * @brief This function returns a reference to member elevation
+ * @return Reference to member elevation
+ */
+double& CounterUAS::PredictedEntry::elevation()
+{
+    return m_elevation;
+}
 
-    for(size_t a = 0; a < data.clusters().size(); ++a)
-    {
-        current_alignment += CounterUAS::ClusterData::getCdrSerializedSize(data.clusters().at(a), current_alignment);}
+/*!
+ * @brief This function sets a value in member covX
+ * @param _covX New value for member covX
+ */
+void CounterUAS::PredictedEntry::covX(
+        double _covX)
+{
+    m_covX = _covX;
+}
 
+/*!
+ * @brief This function returns the value of member covX
+ * @return Value of member covX
+ */
+double CounterUAS::PredictedEntry::covX() const
+{
+    return m_covX;
+}
 
-    return current_alignment - initial_alignment;
+/*!
+ * @brief This function returns a reference to member covX
+ * @return Reference to member covX
+ */
+double& CounterUAS::PredictedEntry::covX()
+{
+    return m_covX;
 }
 
-void CounterUAS::ClusterTableMessage::serialize(
-        eprosima::fastcdr::Cdr& scdr) const
+/*!
+ * @brief This function sets a value in member covY
+ * @param _covY New value for member covY
+ */
+void CounterUAS::PredictedEntry::covY(
+        double _covY)
 {
+    m_covY = _covY;
+}
 
-    scdr << m_messageId;
-    scdr << m_timestamp;
-    scdr << m_dwellCount;
-    scdr << m_numClusters;
-    scdr << m_clusters;
+/*!
+ * @brief This function returns the value of member covY
+ * @return Value of member covY
+ */
+double CounterUAS::PredictedEntry::covY() const
+{
+    return m_covY;
+}
 
+/*!
+ * @brief This function returns a reference to member covY
+ * @return Reference to member covY
+ */
+double& CounterUAS::PredictedEntry::covY()
+{
+    return m_covY;
 }
 
-void CounterUAS::ClusterTableMessage::deserialize(
-        eprosima::fastcdr::Cdr& dcdr)
+/*!
+ * @brief This function sets a value in member covZ
+ * @param _covZ New value for member covZ
+ */
+void CounterUAS::PredictedEntry::covZ(
+        double _covZ)
 {
+    m_covZ = _covZ;
+}
 
-    dcdr >> m_messageId;
-    dcdr >> m_timestamp;
-    dcdr >> m_dwellCount;
-    dcdr >> m_numClusters;
-    dcdr >> m_clusters;
+/*!
+ * @brief This function returns the value of member covZ
+ * @return Value of member covZ
+ */
+double CounterUAS::PredictedEntry::covZ() const
+{
+    return m_covZ;
 }
 
 /*!
- * @brief This function sets a value in member messageId
- * @param _messageId New value for member messageId
+ * @brief This function returns a reference to member covZ
+ * @return Reference to member covZ
  */
-void CounterUAS::ClusterTableMessage::messageId(
-        uint32_t _messageId)
+double& CounterUAS::PredictedEntry::covZ()
 {
-    m_messageId = _messageId;
+    return m_covZ;
 }
 
 /*!
- * @brief This function returns the value of member messageId
- * @return Value of member messageId
+ * @brief This function sets a value in member modelProb0
+ * @param _modelProb0 New value for member modelProb0
  */
-uint32_t CounterUAS::ClusterTableMessage::messageId() const
+void CounterUAS::PredictedEntry::modelProb0(
+        double _modelProb0)
 {
-    return m_messageId;
+    m_modelProb0 = _modelProb0;
 }
 
 /*!
- * @brief This function returns a reference to member messageId
- * @return Reference to member messageId
+ * @brief This function returns the value of member modelProb0
+ * @return Value of member modelProb0
  */
-uint32_t& CounterUAS::ClusterTableMessage::messageId()
+double CounterUAS::PredictedEntry::modelProb0() const
 {
-    return m_messageId;
+    return m_modelProb0;
 }
 
 /*!
- * @brief This function sets a value in member timestamp
- * @param _timestamp New value for member timestamp
+ * @brief This function returns a reference to member modelProb0
+ * @return Reference to member modelProb0
  */
-void CounterUAS::ClusterTableMessage::timestamp(
-        uint64_t _timestamp)
+double& CounterUAS::PredictedEntry::modelProb0()
 {
-    m_timestamp = _timestamp;
+    return m_modelProb0;
 }
 
 /*!
- * @brief This function returns the value of member timestamp
- * @return Value of member timestamp
+ * @brief This function sets a value in member modelProb1
+ * @param _modelProb1 New value for member modelProb1
  */
-uint64_t CounterUAS::ClusterTableMessage::timestamp() const
+void CounterUAS::PredictedEntry::modelProb1(
+        double _modelProb1)
 {
-    return m_timestamp;
+    m_modelProb1 = _modelProb1;
 }
 
 /*!
- * @brief This function returns a reference to member timestamp
- * @return Reference to member timestamp
+ * @brief This function returns the value of member modelProb1
+ * @return Value of member modelProb1
  */
-uint64_t& CounterUAS::ClusterTableMessage::timestamp()
+double CounterUAS::PredictedEntry::modelProb1() const
 {
-    return m_timestamp;
+    return m_modelProb1;
 }
 
 /*!
- * @brief This function sets a value in member dwellCount
- * @param _dwellCount New value for member dwellCount
+ * @brief This function returns a reference to member modelProb1
+ * @return Reference to member modelProb1
  */
-void CounterUAS::ClusterTableMessage::dwellCount(
-        uint32_t _dwellCount)
+double& CounterUAS::PredictedEntry::modelProb1()
 {
-    m_dwellCount = _dwellCount;
+    return m_modelProb1;
 }
 
 /*!
- * @brief This function returns the value of member dwellCount
- * @return Value of member dwellCount
+ * @brief This function sets a value in member modelProb2
+ * @param _modelProb2 New value for member modelProb2
  */
-uint32_t CounterUAS::ClusterTableMessage::dwellCount() const
+void CounterUAS::PredictedEntry::modelProb2(
+        double _modelProb2)
 {
-    return m_dwellCount;
+    m_modelProb2 = _modelProb2;
 }
 
 /*!
- * @brief This function returns a reference to member dwellCount
- * @return Reference to member dwellCount
+ * @brief This function returns the value of member modelProb2
+ * @return Value of member modelProb2
  */
-uint32_t& CounterUAS::ClusterTableMessage::dwellCount()
+double CounterUAS::PredictedEntry::modelProb2() const
 {
-    return m_dwellCount;
+    return m_modelProb2;
 }
 
 /*!
- * @brief This function sets a value in member numClusters
- * @param _numClusters New value for member numClusters
+ * @brief This function returns a reference to member modelProb2
+ * @return Reference to member modelProb2
  */
-void CounterUAS::ClusterTableMessage::numClusters(
-        uint32_t _numClusters)
+double& CounterUAS::PredictedEntry::modelProb2()
 {
-    m_numClusters = _numClusters;
+    return m_modelProb2;
 }
 
 /*!
- * @brief This function returns the value of member numClusters
- * @return Value of member numClusters
+ * @brief This function sets a value in member modelProb3
+ * @param _modelProb3 New value for member modelProb3
  */
-uint32_t CounterUAS::ClusterTableMessage::numClusters() const
+void CounterUAS::PredictedEntry::modelProb3(
+        double _modelProb3)
 {
-    return m_numClusters;
+    m_modelProb3 = _modelProb3;
 }
 
 /*!
- * @brief This function returns a reference to member numClusters
- * @return Reference to member numClusters
+ * @brief This function returns the value of member modelProb3
+ * @return Value of member modelProb3
  */
-uint32_t& CounterUAS::ClusterTableMessage::numClusters()
+double CounterUAS::PredictedEntry::modelProb3() const
 {
-    return m_numClusters;
+    return m_modelProb3;
 }
 
 /*!
- * @brief This function copies the value in member clusters
- * @param _clusters New value to be copied in member clusters
+ * @brief This function returns a reference to member modelProb3
+ * @return Reference to member modelProb3
  */
-void CounterUAS::ClusterTableMessage::clusters(
-        const std::vector<CounterUAS::ClusterData>& _clusters)
+double& CounterUAS::PredictedEntry::modelProb3()
 {
-    m_clusters = _clusters;
+    return m_modelProb3;
 }
 
 /*!
- * @brief This function moves the value in member clusters
- * @param _clusters New value to be moved in member clusters
+ * @brief This function sets a value in member modelProb4
+ * @param _modelProb4 New value for member modelProb4
  */
-void CounterUAS::ClusterTableMessage::clusters(
-        std::vector<CounterUAS::ClusterData>&& _clusters)
+void CounterUAS::PredictedEntry::modelProb4(
+        double _modelProb4)
 {
-    m_clusters = std::move(_clusters);
+    m_modelProb4 = _modelProb4;
 }
 
 /*!
- * @brief This function returns a constant reference to member clusters
- * @return Constant reference to member clusters
+ * @brief This function returns the value of member modelProb4
+ * @return Value of member modelProb4
  */
-const std::vector<CounterUAS::ClusterData>& CounterUAS::ClusterTableMessage::clusters() const
+double CounterUAS::PredictedEntry::modelProb4() const
 {
-    return m_clusters;
+    return m_modelProb4;
 }
 
 /*!
- * @brief This function returns a reference to member clusters
- * @return Reference to member clusters
+ * @brief This function returns a reference to member modelProb4
+ * @return Reference to member modelProb4
  */
-std::vector<CounterUAS::ClusterData>& CounterUAS::ClusterTableMessage::clusters()
+double& CounterUAS::PredictedEntry::modelProb4()
 {
-    return m_clusters;
+    return m_modelProb4;
 }
 
-size_t CounterUAS::ClusterTableMessage::getKeyMaxCdrSerializedSize(
+
+size_t CounterUAS::PredictedEntry::getKeyMaxCdrSerializedSize(
         size_t current_alignment)
 {
     size_t current_align = current_alignment;
@@ -2998,95 +6864,94 @@ size_t CounterUAS::ClusterTableMessage::getKeyMaxCdrSerializedSize(
     return current_align;
 }
 
-bool CounterUAS::ClusterTableMessage::isKeyDefined()
+bool CounterUAS::PredictedEntry::isKeyDefined()
 {
     return false;
 }
 
-void CounterUAS::ClusterTableMessage::serializeKey(
+void CounterUAS::PredictedEntry::serializeKey(
         eprosima::fastcdr::Cdr& scdr) const
 {
     (void) scdr;
-         
+                          
 }
 
-
-CounterUAS::AssocEntry::AssocEntry()
+CounterUAS::PredictedTableMessage::PredictedTableMessage()
 {
-    // m_trackId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@67e2d983
-    m_trackId = 0;
-    // m_clusterId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5d47c63f
-    m_clusterId = 0;
-    // m_distance com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5ea434c8
-    m_distance = 0.0;
-    // m_matched com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3bbc39f8
-    m_matched = false;
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@20d3d15a
+    m_messageId = 0;
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2893de87
+    m_timestamp = 0;
+    // m_numEntries com.eprosima.idl.parser.typecode.PrimitiveTypeCode@55ca8de8
+    m_numEntries = 0;
+    // m_entries com.eprosima.idl.parser.typecode.SequenceTypeCode@2c34f934
+
 
 }
 
-CounterUAS::AssocEntry::~AssocEntry()
+CounterUAS::PredictedTableMessage::~PredictedTableMessage()
 {
 
 
 
 }
 
-CounterUAS::AssocEntry::AssocEntry(
-        const AssocEntry& x)
+CounterUAS::PredictedTableMessage::PredictedTableMessage(
+        const PredictedTableMessage& x)
 {
-    m_trackId = x.m_trackId;
-    m_clusterId = x.m_clusterId;
-    m_distance = x.m_distance;
-    m_matched = x.m_matched;
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numEntries = x.m_numEntries;
+    m_entries = x.m_entries;
 }
 
-CounterUAS::AssocEntry::AssocEntry(
-        AssocEntry&& x) noexcept 
+CounterUAS::PredictedTableMessage::PredictedTableMessage(
+        PredictedTableMessage&& x) noexcept 
 {
-    m_trackId = x.m_trackId;
-    m_clusterId = x.m_clusterId;
-    m_distance = x.m_distance;
-    m_matched = x.m_matched;
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numEntries = x.m_numEntries;
+    m_entries = std::move(x.m_entries);
 }
 
-CounterUAS::AssocEntry& CounterUAS::AssocEntry::operator =(
-        const AssocEntry& x)
+CounterUAS::PredictedTableMessage& CounterUAS::PredictedTableMessage::operator =(
+        const PredictedTableMessage& x)
 {
 
-    m_trackId = x.m_trackId;
-    m_clusterId = x.m_clusterId;
-    m_distance = x.m_distance;
-    m_matched = x.m_matched;
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numEntries = x.m_numEntries;
+    m_entries = x.m_entries;
 
     return *this;
 }
 
-CounterUAS::AssocEntry& CounterUAS::AssocEntry::operator =(
-        AssocEntry&& x) noexcept
+CounterUAS::PredictedTableMessage& CounterUAS::PredictedTableMessage::operator =(
+        PredictedTableMessage&& x) noexcept
 {
 
-    m_trackId = x.m_trackId;
-    m_clusterId = x.m_clusterId;
-    m_distance = x.m_distance;
-    m_matched = x.m_matched;
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_numEntries = x.m_numEntries;
+    m_entries = std::move(x.m_entries);
 
     return *this;
 }
 
-bool CounterUAS::AssocEntry::operator ==(
-        const AssocEntry& x) const
+bool CounterUAS::PredictedTableMessage::operator ==(
+        const PredictedTableMessage& x) const
 {
 
-    return (m_trackId == x.m_trackId && m_clusterId == x.m_clusterId && m_distance == x.m_distance && m_matched == x.m_matched);
+    return (m_messageId == x.m_messageId && m_timestamp == x.m_timestamp && m_numEntries == x.m_numEntries && m_entries == x.m_entries);
 }
 
-bool CounterUAS::AssocEntry::operator !=(
-        const AssocEntry& x) const
+bool CounterUAS::PredictedTableMessage::operator !=(
+        const PredictedTableMessage& x) const
 {
     return !(*this == x);
 }
 
-size_t CounterUAS::AssocEntry::getMaxCdrSerializedSize(
+size_t CounterUAS::PredictedTableMessage::getMaxCdrSerializedSize(
         size_t current_alignment)
 {
     size_t initial_alignment = current_alignment;
@@ -3095,21 +6960,25 @@ size_t CounterUAS::AssocEntry::getMaxCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    current_alignment += 1 + eprosima::fastcdr::Cdr::alignment(current_alignment, 1);
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
+    for(size_t a = 0; a < 100; ++a)
+    {
+        current_alignment += CounterUAS::PredictedEntry::getMaxCdrSerializedSize(current_alignment);}
+
 
     return current_alignment - initial_alignment;
 }
 
-size_t CounterUAS::AssocEntry::getCdrSerializedSize(
-        const CounterUAS::AssocEntry& data,
+size_t CounterUAS::PredictedTableMessage::getCdrSerializedSize(
+        const CounterUAS::PredictedTableMessage& data,
         size_t current_alignment)
 {
     (void)data;
@@ -3119,154 +6988,167 @@ size_t CounterUAS::AssocEntry::getCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    current_alignment += 1 + eprosima::fastcdr::Cdr::alignment(current_alignment, 1);
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
+    for(size_t a = 0; a < data.entries().size(); ++a)
+    {
+        current_alignment += CounterUAS::PredictedEntry::getCdrSerializedSize(data.entries().at(a), current_alignment);}
+
 
     return current_alignment - initial_alignment;
 }
 
-void CounterUAS::AssocEntry::serialize(
+void CounterUAS::PredictedTableMessage::serialize(
         eprosima::fastcdr::Cdr& scdr) const
 {
 
-    scdr << m_trackId;
-    scdr << m_clusterId;
-    scdr << m_distance;
-    scdr << m_matched;
+    scdr << m_messageId;
+    scdr << m_timestamp;
+    scdr << m_numEntries;
+    scdr << m_entries;
 
 }
 
-void CounterUAS::AssocEntry::deserialize(
+void CounterUAS::PredictedTableMessage::deserialize(
         eprosima::fastcdr::Cdr& dcdr)
 {
 
-    dcdr >> m_trackId;
-    dcdr >> m_clusterId;
-    dcdr >> m_distance;
-    dcdr >> m_matched;
+    dcdr >> m_messageId;
+    dcdr >> m_timestamp;
+    dcdr >> m_numEntries;
+    dcdr >> m_entries;
 }
 
 /*!
- * @brief This function sets a value in member trackId
- * @param _trackId New value for member trackId
+ * @brief This function sets a value in member messageId
+ * @param _messageId New value for member messageId
  */
-void CounterUAS::AssocEntry::trackId(
-        uint32_t _trackId)
+void CounterUAS::PredictedTableMessage::messageId(
+        uint32_t _messageId)
 {
-    m_trackId = _trackId;
+    m_messageId = _messageId;
 }
 
 /*!
- * @brief This function returns the value of member trackId
- * @return Value of member trackId
+ * @brief This function returns the value of member messageId
+ * @return Value of member messageId
  */
-uint32_t CounterUAS::AssocEntry::trackId() const
+uint32_t CounterUAS::PredictedTableMessage::messageId() const
 {
-    return m_trackId;
+    return m_messageId;
 }
 
 /*!
- * @brief This function returns a reference to member trackId
- * @return Reference to member trackId
+ * @brief This function returns a reference to member messageId
+ * @return Reference to member messageId
  */
-uint32_t& CounterUAS::AssocEntry::trackId()
+uint32_t& CounterUAS::PredictedTableMessage::messageId()
 {
-    return m_trackId;
+    return m_messageId;
 }
 
 /*!
- * @brief This function sets a value in member clusterId
- * @param _clusterId New value for member clusterId
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
  */
-void CounterUAS::AssocEntry::clusterId(
-        uint32_t _clusterId)
+void CounterUAS::PredictedTableMessage::timestamp(
+        uint64_t _timestamp)
 {
-    m_clusterId = _clusterId;
+    m_timestamp = _timestamp;
 }
 
 /*!
- * @brief This function returns the value of member clusterId
- * @return Value of member clusterId
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
  */
-uint32_t CounterUAS::AssocEntry::clusterId() const
+uint64_t CounterUAS::PredictedTableMessage::timestamp() const
 {
-    return m_clusterId;
+    return m_timestamp;
 }
 
 /*!
- * @brief This function returns a reference to member clusterId
- * @return Reference to member clusterId
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
  */
-uint32_t& CounterUAS::AssocEntry::clusterId()
+uint64_t& CounterUAS::PredictedTableMessage::timestamp()
 {
-    return m_clusterId;
+    return m_timestamp;
 }
 
 /*!
- * @brief This function sets a value in member distance
- * @param _distance New value for member distance
+ * @brief This function sets a value in member numEntries
+ * @param _numEntries New value for member numEntries
  */
-void CounterUAS::AssocEntry::distance(
-        double _distance)
+void CounterUAS::PredictedTableMessage::numEntries(
+        uint32_t _numEntries)
 {
-    m_distance = _distance;
+    m_numEntries = _numEntries;
 }
 
 /*!
- * @brief This function returns the value of member distance
- * @return Value of member distance
+ * @brief This function returns the value of member numEntries
+ * @return Value of member numEntries
  */
-double CounterUAS::AssocEntry::distance() const
+uint32_t CounterUAS::PredictedTableMessage::numEntries() const
 {
-    return m_distance;
+    return m_numEntries;
 }
 
 /*!
- * @brief This function returns a reference to member distance
- * @return Reference to member distance
+ * @brief This function returns a reference to member numEntries
+ * @return Reference to member numEntries
  */
-double& CounterUAS::AssocEntry::distance()
+uint32_t& CounterUAS::PredictedTableMessage::numEntries()
 {
-    return m_distance;
+    return m_numEntries;
 }
 
 /*!
- * @brief This function sets a value in member matched
- * @param _matched New value for member matched
+ * @brief This function copies the value in member entries
+ * @param _entries New value to be copied in member entries
  */
-void CounterUAS::AssocEntry::matched(
-        bool _matched)
+void CounterUAS::PredictedTableMessage::entries(
+        const std::vector<CounterUAS::PredictedEntry>& _entries)
 {
-    m_matched = _matched;
+    m_entries = _entries;
 }
 
 /*!
- * @brief This function returns the value of member matched
- * @return Value of member matched
+ * @brief This function moves the value in member entries
+ * @param _entries New value to be moved in member entries
  */
-bool CounterUAS::AssocEntry::matched() const
+void CounterUAS::PredictedTableMessage::entries(
+        std::vector<CounterUAS::PredictedEntry>&& _entries)
 {
-    return m_matched;
+    m_entries = std::move(_entries);
 }
 
 /*!
- * @brief This function returns a reference to member matched
- * @return Reference to member matched
+ * @brief This function returns a constant reference to member entries
+ * @return Constant reference to member entries
  */
-bool& CounterUAS::AssocEntry::matched()
+const std::vector<CounterUAS::PredictedEntry>& CounterUAS::PredictedTableMessage::entries() const
 {
-    return m_matched;
+    return m_entries;
 }
 
+/*!
+ * @brief This function returns a reference to member entries
+ * @return Reference to member entries
+ */
+std::vector<CounterUAS::PredictedEntry>& CounterUAS::PredictedTableMessage::entries()
+{
+    return m_entries;
+}
 
-size_t CounterUAS::AssocEntry::getKeyMaxCdrSerializedSize(
+size_t CounterUAS::PredictedTableMessage::getKeyMaxCdrSerializedSize(
         size_t current_alignment)
 {
     size_t current_align = current_alignment;
@@ -3276,94 +7158,132 @@ size_t CounterUAS::AssocEntry::getKeyMaxCdrSerializedSize(
     return current_align;
 }
 
-bool CounterUAS::AssocEntry::isKeyDefined()
+bool CounterUAS::PredictedTableMessage::isKeyDefined()
 {
     return false;
 }
 
-void CounterUAS::AssocEntry::serializeKey(
+void CounterUAS::PredictedTableMessage::serializeKey(
         eprosima::fastcdr::Cdr& scdr) const
 {
     (void) scdr;
         
 }
 
-CounterUAS::AssocTableMessage::AssocTableMessage()
+
+
+
+CounterUAS::PipelineStatsMessage::PipelineStatsMessage()
 {
-    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4ae3c1cd
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@177219d
     m_messageId = 0;
-    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@29f69090
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5c6e433
     m_timestamp = 0;
-    // m_numEntries com.eprosima.idl.parser.typecode.PrimitiveTypeCode@568bf312
-    m_numEntries = 0;
-    // m_entries com.eprosima.idl.parser.typecode.SequenceTypeCode@ca263c2
+    // m_cycleCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@bc68877
+    m_cycleCount = 0;
+    // m_messagesReceived com.eprosima.idl.parser.typecode.PrimitiveTypeCode@6d4a71f4
+    m_messagesReceived = 0;
+    // m_ingestCapacity com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4067c358
+    m_ingestCapacity = 0;
+    // m_ingestDepth com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1b29fc6e
+    m_ingestDepth = 0;
+    // m_ingestHighWater com.eprosima.idl.parser.typecode.PrimitiveTypeCode@492f23a
+    m_ingestHighWater = 0;
+    // m_ingestDropped com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5733133a
+    m_ingestDropped = 0;
+    // m_ingestCoalesced com.eprosima.idl.parser.typecode.PrimitiveTypeCode@ffed923
+    m_ingestCoalesced = 0;
+
+}
+
+CounterUAS::PipelineStatsMessage::~PipelineStatsMessage()
+{
+
+
 
 
-}
 
-CounterUAS::AssocTableMessage::~AssocTableMessage()
-{
 
 
 
 }
 
-CounterUAS::AssocTableMessage::AssocTableMessage(
-        const AssocTableMessage& x)
+CounterUAS::PipelineStatsMessage::PipelineStatsMessage(
+        const PipelineStatsMessage& x)
 {
     m_messageId = x.m_messageId;
     m_timestamp = x.m_timestamp;
-    m_numEntries = x.m_numEntries;
-    m_entries = x.m_entries;
+    m_cycleCount = x.m_cycleCount;
+    m_messagesReceived = x.m_messagesReceived;
+    m_ingestCapacity = x.m_ingestCapacity;
+    m_ingestDepth = x.m_ingestDepth;
+    m_ingestHighWater = x.m_ingestHighWater;
+    m_ingestDropped = x.m_ingestDropped;
+    m_ingestCoalesced = x.m_ingestCoalesced;
 }
 
-CounterUAS::AssocTableMessage::AssocTableMessage(
-        AssocTableMessage&& x) noexcept 
+CounterUAS::PipelineStatsMessage::PipelineStatsMessage(
+        PipelineStatsMessage&& x) noexcept 
 {
     m_messageId = x.m_messageId;
     m_timestamp = x.m_timestamp;
-    m_numEntries = x.m_numEntries;
-    m_entries = std::move(x.m_entries);
+    m_cycleCount = x.m_cycleCount;
+    m_messagesReceived = x.m_messagesReceived;
+    m_ingestCapacity = x.m_ingestCapacity;
+    m_ingestDepth = x.m_ingestDepth;
+    m_ingestHighWater = x.m_ingestHighWater;
+    m_ingestDropped = x.m_ingestDropped;
+    m_ingestCoalesced = x.m_ingestCoalesced;
 }
 
-CounterUAS::AssocTableMessage& CounterUAS::AssocTableMessage::operator =(
-        const AssocTableMessage& x)
+CounterUAS::PipelineStatsMessage& CounterUAS::PipelineStatsMessage::operator =(
+        const PipelineStatsMessage& x)
 {
 
     m_messageId = x.m_messageId;
     m_timestamp = x.m_timestamp;
-    m_numEntries = x.m_numEntries;
-    m_entries = x.m_entries;
+    m_cycleCount = x.m_cycleCount;
+    m_messagesReceived = x.m_messagesReceived;
+    m_ingestCapacity = x.m_ingestCapacity;
+    m_ingestDepth = x.m_ingestDepth;
+    m_ingestHighWater = x.m_ingestHighWater;
+    m_ingestDropped = x.m_ingestDropped;
+    m_ingestCoalesced = x.m_ingestCoalesced;
 
     return *this;
 }
 
-CounterUAS::AssocTableMessage& CounterUAS::AssocTableMessage::operator =(
-        AssocTableMessage&& x) noexcept
+CounterUAS::PipelineStatsMessage& CounterUAS::PipelineStatsMessage::operator =(
+        PipelineStatsMessage&& x) noexcept
 {
 
     m_messageId = x.m_messageId;
     m_timestamp = x.m_timestamp;
-    m_numEntries = x.m_numEntries;
-    m_entries = std::move(x.m_entries);
+    m_cycleCount = x.m_cycleCount;
+    m_messagesReceived = x.m_messagesReceived;
+    m_ingestCapacity = x.m_ingestCapacity;
+    m_ingestDepth = x.m_ingestDepth;
+    m_ingestHighWater = x.m_ingestHighWater;
+    m_ingestDropped = x.m_ingestDropped;
+    m_ingestCoalesced = x.m_ingestCoalesced;
 
     return *this;
 }
 
-bool CounterUAS::AssocTableMessage::operator ==(
-        const AssocTableMessage& x) const
+bool CounterUAS::PipelineStatsMessage::operator ==(
+        const PipelineStatsMessage& x) const
 {
 
-    return (m_messageId == x.m_messageId && m_timestamp == x.m_timestamp && m_numEntries == x.m_numEntries && m_entries == x.m_entries);
+    return (m_messageId == x.m_messageId && m_timestamp == x.m_timestamp && m_cycleCount == x.m_cycleCount && m_messagesReceived == x.m_messagesReceived && m_ingestCapacity == x.m_ingestCapacity && m_ingestDepth == x.m_ingestDepth && m_ingestHighWater == x.m_ingestHighWater && m_ingestDropped == x.m_ingestDropped && m_ingestCoalesced == x.m_ingestCoalesced);
 }
 
-bool CounterUAS::AssocTableMessage::operator !=(
-        const AssocTableMessage& x) const
+bool CounterUAS::PipelineStatsMessage::operator !=(
+        const PipelineStatsMessage& x) const
 {
     return !(*this == x);
 }
 
-size_t CounterUAS::AssocTableMessage::getMaxCdrSerializedSize(
+size_t CounterUAS::PipelineStatsMessage::getMaxCdrSerializedSize(
         size_t current_alignment)
 {
     size_t initial_alignment = current_alignment;
@@ -3375,22 +7295,33 @@ size_t CounterUAS::AssocTableMessage::getMaxCdrSerializedSize(
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    for(size_t a = 0; a < 100; ++a)
-    {
-        current_alignment += CounterUAS::AssocEntry::getMaxCdrSerializedSize(current_alignment);}
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
 
 
     return current_alignment - initial_alignment;
 }
 
-size_t CounterUAS::AssocTableMessage::getCdrSerializedSize(
-        const CounterUAS::AssocTableMessage& data,
+size_t CounterUAS::PipelineStatsMessage::getCdrSerializedSize(
+        const CounterUAS::PipelineStatsMessage& data,
         size_t current_alignment)
 {
     (void)data;
@@ -3403,46 +7334,67 @@ size_t CounterUAS::AssocTableMessage::getCdrSerializedSize(
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    for(size_t a = 0; a < data.entries().size(); ++a)
-    {
-        current_alignment += CounterUAS::AssocEntry::getCdrSerializedSize(data.entries().at(a), current_alignment);}
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
 
 
     return current_alignment - initial_alignment;
 }
 
-void CounterUAS::AssocTableMessage::serialize(
+void CounterUAS::PipelineStatsMessage::serialize(
         eprosima::fastcdr::Cdr& scdr) const
 {
 
     scdr << m_messageId;
     scdr << m_timestamp;
-    scdr << m_numEntries;
-    scdr << m_entries;
+    scdr << m_cycleCount;
+    scdr << m_messagesReceived;
+    scdr << m_ingestCapacity;
+    scdr << m_ingestDepth;
+    scdr << m_ingestHighWater;
+    scdr << m_ingestDropped;
+    scdr << m_ingestCoalesced;
 
 }
 
-void CounterUAS::AssocTableMessage::deserialize(
+void CounterUAS::PipelineStatsMessage::deserialize(
         eprosima::fastcdr::Cdr& dcdr)
 {
 
     dcdr >> m_messageId;
     dcdr >> m_timestamp;
-    dcdr >> m_numEntries;
-    dcdr >> m_entries;
+    dcdr >> m_cycleCount;
+    dcdr >> m_messagesReceived;
+    dcdr >> m_ingestCapacity;
+    dcdr >> m_ingestDepth;
+    dcdr >> m_ingestHighWater;
+    dcdr >> m_ingestDropped;
+    dcdr >> m_ingestCoalesced;
 }
 
 /*!
  * @brief This function sets a value in member messageId
  * @param _messageId New value for member messageId
  */
-void CounterUAS::AssocTableMessage::messageId(
+void CounterUAS::PipelineStatsMessage::messageId(
         uint32_t _messageId)
 {
     m_messageId = _messageId;
@@ -3452,7 +7404,7 @@ void CounterUAS::AssocTableMessage::messageId(
  * @brief This function returns the value of member messageId
  * @return Value of member messageId
  */
-uint32_t CounterUAS::AssocTableMessage::messageId() const
+uint32_t CounterUAS::PipelineStatsMessage::messageId() const
 {
     return m_messageId;
 }
@@ -3461,7 +7413,7 @@ uint32_t CounterUAS::AssocTableMessage::messageId() const
  * @brief This function returns a reference to member messageId
  * @return Reference to member messageId
  */
-uint32_t& CounterUAS::AssocTableMessage::messageId()
+uint32_t& CounterUAS::PipelineStatsMessage::messageId()
 {
     return m_messageId;
 }
@@ -3470,7 +7422,7 @@ uint32_t& CounterUAS::AssocTableMessage::messageId()
  * @brief This function sets a value in member timestamp
  * @param _timestamp New value for member timestamp
  */
-void CounterUAS::AssocTableMessage::timestamp(
+void CounterUAS::PipelineStatsMessage::timestamp(
         uint64_t _timestamp)
 {
     m_timestamp = _timestamp;
@@ -3480,7 +7432,7 @@ void CounterUAS::AssocTableMessage::timestamp(
  * @brief This function returns the value of member timestamp
  * @return Value of member timestamp
  */
-uint64_t CounterUAS::AssocTableMessage::timestamp() const
+uint64_t CounterUAS::PipelineStatsMessage::timestamp() const
 {
     return m_timestamp;
 }
@@ -3489,165 +7441,255 @@ uint64_t CounterUAS::AssocTableMessage::timestamp() const
  * @brief This function returns a reference to member timestamp
  * @return Reference to member timestamp
  */
-uint64_t& CounterUAS::AssocTableMessage::timestamp()
+uint64_t& CounterUAS::PipelineStatsMessage::timestamp()
 {
     return m_timestamp;
 }
 
 /*!
- * @brief This function sets a value in member numEntries
- * @param _numEntries New value for member numEntries
+ * @brief This function sets a value in member cycleCount
+ * @param _cycleCount New value for member cycleCount
  */
-void CounterUAS::AssocTableMessage::numEntries(
-        uint32_t _numEntries)
+void CounterUAS::PipelineStatsMessage::cycleCount(
+        uint64_t _cycleCount)
 {
-    m_numEntries = _numEntries;
+    m_cycleCount = _cycleCount;
 }
 
 /*!
- * @brief This function returns the value of member numEntries
- * @return Value of member numEntries
+ * @brief This function returns the value of member cycleCount
+ * @return Value of member cycleCount
  */
-uint32_t CounterUAS::AssocTableMessage::numEntries() const
+uint64_t CounterUAS::PipelineStatsMessage::cycleCount() const
 {
-    return m_numEntries;
+    return m_cycleCount;
 }
 
 /*!
- * @brief This function returns a reference to member numEntries
- * @return Reference to member numEntries
+ * @brief This function returns a reference to member cycleCount
+ * @return Reference to member cycleCount
  */
-uint32_t& CounterUAS::AssocTableMessage::numEntries()
+uint64_t& CounterUAS::PipelineStatsMessage::cycleCount()
 {
-    return m_numEntries;
+    return m_cycleCount;
 }
 
 /*!
- * @brief This function copies the value in member entries
- * @param _entries New value to be copied in member entries
+ * @brief This function sets a value in member messagesReceived
+ * @param _messagesReceived New value for member messagesReceived
  */
-void CounterUAS::AssocTableMessage::entries(
-        const std::vector<CounterUAS::AssocEntry>& _entries)
+void CounterUAS::PipelineStatsMessage::messagesReceived(
+        uint64_t _messagesReceived)
 {
-    m_entries = _entries;
+    m_messagesReceived = _messagesReceived;
 }
 
 /*!
- * @brief This function moves the value in member entries
- * @param _entries New value to be moved in member entries
+ * @brief This function returns the value of member messagesReceived
+ * @return Value of member messagesReceived
  */
-void CounterUAS::AssocTableMessage::entries(
-        std::vector<CounterUAS::AssocEntry>&& _entries)
+uint64_t CounterUAS::PipelineStatsMessage::messagesReceived() const
 {
-    m_entries = std::move(_entries);
+    return m_messagesReceived;
 }
 
 /*!
- * @brief This function returns a constant reference to member entries
- * @return Constant reference to member entries
+ * @brief This function returns a reference to member messagesReceived
+ * @return Reference to member messagesReceived
  */
-const std::vector<CounterUAS::AssocEntry>& CounterUAS::AssocTableMessage::entries() const
+uint64_t& CounterUAS::PipelineStatsMessage::messagesReceived()
 {
-    return m_entries;
+    return m_messagesReceived;
 }
 
 /*!
- * @brief This function returns a reference to member entries
- * @return Reference to member entries
+ * @brief This function sets a value in member ingestCapacity
+ * @param _ingestCapacity New value for member ingestCapacity
  */
-std::vector<CounterUAS::AssocEntry>& CounterUAS::AssocTableMessage::entries()
+void CounterUAS::PipelineStatsMessage::ingestCapacity(
+        uint32_t _ingestCapacity)
 {
-    return m_entries;
+    m_ingestCapacity = _ingestCapacity;
 }
 
-size_t CounterUAS::AssocTableMessage::getKeyMaxCdrSerializedSize(
-        size_t current_alignment)
+/*!
+ * @brief This function returns the value of member ingestCapacity
+ * @return Value of member ingestCapacity
+ */
+uint32_t CounterUAS::PipelineStatsMessage::ingestCapacity() const
 {
-    size_t current_align = current_alignment;
-
-
-
-    return current_align;
+    return m_ingestCapacity;
 }
 
-bool CounterUAS::AssocTableMessage::isKeyDefined()
+/*!
+ * @brief This function returns a reference to member ingestCapacity
+ * @return Reference to member ingestCapacity
+ */
+uint32_t& CounterUAS::PipelineStatsMessage::ingestCapacity()
 {
-    return false;
+    return m_ingestCapacity;
 }
 
-void CounterUAS::AssocTableMessage::serializeKey(
-        eprosima::fastcdr::Cdr& scdr) const
+/*!
+ * @brief This function sets a value in member ingestDepth
+ * @param _ingestDepth New value for member ingestDepth
+ */
+void CounterUAS::PipelineStatsMessage::ingestDepth(
+        uint32_t _ingestDepth)
 {
-    (void) scdr;
-        
+    m_ingestDepth = _ingestDepth;
 }
 
-
-CounterUAS::PredictedEntry::PredictedEntry()
+/*!
+ * @brief This function returns the value of member ingestDepth
+ * @return Value of member ingestDepth
+ */
+uint32_t CounterUAS::PipelineStatsMessage::ingestDepth() const
 {
-    // m_trackId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4c6e276e
-    m_trackId = 0;
-    // m_trackStatus com.eprosima.idl.parser.typecode.EnumTypeCode@1b68b9a4
-    m_trackStatus = CounterUAS::TRACK_TENTATIVE;
-    // m_x com.eprosima.idl.parser.typecode.PrimitiveTypeCode@534df152
-    m_x = 0.0;
-    // m_vx com.eprosima.idl.parser.typecode.PrimitiveTypeCode@52e677af
-    m_vx = 0.0;
-    // m_ax com.eprosima.idl.parser.typecode.PrimitiveTypeCode@35083305
-    m_ax = 0.0;
-    // m_y com.eprosima.idl.parser.typecode.PrimitiveTypeCode@8e0379d
-    m_y = 0.0;
-    // m_vy com.eprosima.idl.parser.typecode.PrimitiveTypeCode@341b80b2
-    m_vy = 0.0;
-    // m_ay com.eprosima.idl.parser.typecode.PrimitiveTypeCode@55a1c291
-    m_ay = 0.0;
-    // m_z com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2145433b
-    m_z = 0.0;
-    // m_vz com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2890c451
-    m_vz = 0.0;
-    // m_az com.eprosima.idl.parser.typecode.PrimitiveTypeCode@40e6dfe1
-    m_az = 0.0;
-    // m_range com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1b083826
-    m_range = 0.0;
-    // m_azimuth com.eprosima.idl.parser.typecode.PrimitiveTypeCode@105fece7
-    m_azimuth = 0.0;
-    // m_elevation com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3ec300f1
-    m_elevation = 0.0;
-    // m_covX com.eprosima.idl.parser.typecode.PrimitiveTypeCode@482cd91f
-    m_covX = 0.0;
-    // m_covY com.eprosima.idl.parser.typecode.PrimitiveTypeCode@123f1134
-    m_covY = 0.0;
-    // m_covZ com.eprosima.idl.parser.typecode.PrimitiveTypeCode@7d68ef40
-    m_covZ = 0.0;
-    // m_modelProb0 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5b0abc94
-    m_modelProb0 = 0.0;
-    // m_modelProb1 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@75c072cb
-    m_modelProb1 = 0.0;
-    // m_modelProb2 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1f1c7bf6
-    m_modelProb2 = 0.0;
-    // m_modelProb3 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@25b485ba
-    m_modelProb3 = 0.0;
-    // m_modelProb4 com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2b546384
-    m_modelProb4 = 0.0;
-
+    return m_ingestDepth;
 }
 
-CounterUAS::PredictedEntry::~PredictedEntry()
+/*!
+ * @brief This function returns a reference to member ingestDepth
+ * @return Reference to member ingestDepth
+ */
+uint32_t& CounterUAS::PipelineStatsMessage::ingestDepth()
 {
+    return m_ingestDepth;
+}
 
+/*!
+ * @brief This function sets a value in member ingestHighWater
+ * @param _ingestHighWater New value for member ingestHighWater
+ */
+void CounterUAS::PipelineStatsMessage::ingestHighWater(
+        uint32_t _ingestHighWater)
+{
+    m_ingestHighWater = _ingestHighWater;
+}
 
+/*!
+ * @brief This function returns the value of member ingestHighWater
+ * @return Value of member ingestHighWater
+ */
+uint32_t CounterUAS::PipelineStatsMessage::ingestHighWater() const
+{
+    return m_ingestHighWater;
+}
 
+/*!
+ * @brief This function returns a reference to member ingestHighWater
+ * @return Reference to member ingestHighWater
+ */
+uint32_t& CounterUAS::PipelineStatsMessage::ingestHighWater()
+{
+    return m_ingestHighWater;
+}
 
+/*!
+ * @brief This function sets a value in member ingestDropped
+ * @param _ingestDropped New value for member ingestDropped
+ */
+void CounterUAS::PipelineStatsMessage::ingestDropped(
+        uint64_t _ingestDropped)
+{
+    m_ingestDropped = _ingestDropped;
+}
 
+/*!
+ * @brief This function returns the value of member ingestDropped
+ * @return Value of member ingestDropped
+ */
+uint64_t CounterUAS::PipelineStatsMessage::ingestDropped() const
+{
+    return m_ingestDropped;
+}
 
+/*!
+ * @brief This function returns a reference to member ingestDropped
+ * @return Reference to member ingestDropped
+ */
+uint64_t& CounterUAS::PipelineStatsMessage::ingestDropped()
+{
+    return m_ingestDropped;
+}
 
+/*!
+ * @brief This function sets a value in member ingestCoalesced
+ * @param _ingestCoalesced New value for member ingestCoalesced
+ */
+void CounterUAS::PipelineStatsMessage::ingestCoalesced(
+        uint64_t _ingestCoalesced)
+{
+    m_ingestCoalesced = _ingestCoalesced;
+}
 
+/*!
+ * @brief This function returns the value of member ingestCoalesced
+ * @return Value of member ingestCoalesced
+ */
+uint64_t CounterUAS::PipelineStatsMessage::ingestCoalesced() const
+{
+    return m_ingestCoalesced;
+}
 
+/*!
+ * @brief This function returns a reference to member ingestCoalesced
+ * @return Reference to member ingestCoalesced
+ */
+uint64_t& CounterUAS::PipelineStatsMessage::ingestCoalesced()
+{
+    return m_ingestCoalesced;
+}
 
 
+size_t CounterUAS::PipelineStatsMessage::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
 
 
 
+    return current_align;
+}
+
+bool CounterUAS::PipelineStatsMessage::isKeyDefined()
+{
+    return false;
+}
+
+void CounterUAS::PipelineStatsMessage::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+        
+}
+
+CounterUAS::StageLatency::StageLatency()
+{
+    // m_stageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4da4f9f
+    m_stageId = 0;
+    // m_name com.eprosima.idl.parser.typecode.StringTypeCode@b8a1abc
+    m_name ="";
+    // m_count com.eprosima.idl.parser.typecode.PrimitiveTypeCode@7a97c643
+    m_count = 0;
+    // m_p50Us com.eprosima.idl.parser.typecode.PrimitiveTypeCode@1710cf5
+    m_p50Us = 0.0;
+    // m_p99Us com.eprosima.idl.parser.typecode.PrimitiveTypeCode@512bd1
+    m_p99Us = 0.0;
+    // m_p999Us com.eprosima.idl.parser.typecode.PrimitiveTypeCode@8ca59966
+    m_p999Us = 0.0;
+    // m_maxUs com.eprosima.idl.parser.typecode.PrimitiveTypeCode@ccea71ff
+    m_maxUs = 0.0;
+    // m_allocCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3f2a1c7e
+    m_allocCount = 0;
+    // m_allocBytes com.eprosima.idl.parser.typecode.PrimitiveTypeCode@5b9e0d41
+    m_allocBytes = 0;
+
+}
+
+CounterUAS::StageLatency::~StageLatency()
+{
 
 
 
@@ -3655,136 +7697,85 @@ CounterUAS::PredictedEntry::~PredictedEntry()
 
 
 
-}
 
-CounterUAS::PredictedEntry::PredictedEntry(
-        const PredictedEntry& x)
-{
-    m_trackId = x.m_trackId;
-    m_trackStatus = x.m_trackStatus;
-    m_x = x.m_x;
-    m_vx = x.m_vx;
-    m_ax = x.m_ax;
-    m_y = x.m_y;
-    m_vy = x.m_vy;
-    m_ay = x.m_ay;
-    m_z = x.m_z;
-    m_vz = x.m_vz;
-    m_az = x.m_az;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_covX = x.m_covX;
-    m_covY = x.m_covY;
-    m_covZ = x.m_covZ;
-    m_modelProb0 = x.m_modelProb0;
-    m_modelProb1 = x.m_modelProb1;
-    m_modelProb2 = x.m_modelProb2;
-    m_modelProb3 = x.m_modelProb3;
-    m_modelProb4 = x.m_modelProb4;
 }
 
-CounterUAS::PredictedEntry::PredictedEntry(
-        PredictedEntry&& x) noexcept 
+CounterUAS::StageLatency::StageLatency(
+        const StageLatency& x)
 {
-    m_trackId = x.m_trackId;
-    m_trackStatus = x.m_trackStatus;
-    m_x = x.m_x;
-    m_vx = x.m_vx;
-    m_ax = x.m_ax;
-    m_y = x.m_y;
-    m_vy = x.m_vy;
-    m_ay = x.m_ay;
-    m_z = x.m_z;
-    m_vz = x.m_vz;
-    m_az = x.m_az;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_covX = x.m_covX;
-    m_covY = x.m_covY;
-    m_covZ = x.m_covZ;
-    m_modelProb0 = x.m_modelProb0;
-    m_modelProb1 = x.m_modelProb1;
-    m_modelProb2 = x.m_modelProb2;
-    m_modelProb3 = x.m_modelProb3;
-    m_modelProb4 = x.m_modelProb4;
+    m_stageId = x.m_stageId;
+    m_name = x.m_name;
+    m_count = x.m_count;
+    m_p50Us = x.m_p50Us;
+    m_p99Us = x.m_p99Us;
+    m_p999Us = x.m_p999Us;
+    m_maxUs = x.m_maxUs;
+    m_allocCount = x.m_allocCount;
+    m_allocBytes = x.m_allocBytes;
 }
 
-CounterUAS::PredictedEntry& CounterUAS::PredictedEntry::operator =(
-        const PredictedEntry& x)
+CounterUAS::StageLatency::StageLatency(
+        StageLatency&& x) noexcept 
+{
+    m_stageId = x.m_stageId;
+    m_name = std::move(x.m_name);
+    m_count = x.m_count;
+    m_p50Us = x.m_p50Us;
+    m_p99Us = x.m_p99Us;
+    m_p999Us = x.m_p999Us;
+    m_maxUs = x.m_maxUs;
+    m_allocCount = x.m_allocCount;
+    m_allocBytes = x.m_allocBytes;
+}
+
+CounterUAS::StageLatency& CounterUAS::StageLatency::operator =(
+        const StageLatency& x)
 {
 
-    m_trackId = x.m_trackId;
-    m_trackStatus = x.m_trackStatus;
-    m_x = x.m_x;
-    m_vx = x.m_vx;
-    m_ax = x.m_ax;
-    m_y = x.m_y;
-    m_vy = x.m_vy;
-    m_ay = x.m_ay;
-    m_z = x.m_z;
-    m_vz = x.m_vz;
-    m_az = x.m_az;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_covX = x.m_covX;
-    m_covY = x.m_covY;
-    m_covZ = x.m_covZ;
-    m_modelProb0 = x.m_modelProb0;
-    m_modelProb1 = x.m_modelProb1;
-    m_modelProb2 = x.m_modelProb2;
-    m_modelProb3 = x.m_modelProb3;
-    m_modelProb4 = x.m_modelProb4;
+    m_stageId = x.m_stageId;
+    m_name = x.m_name;
+    m_count = x.m_count;
+    m_p50Us = x.m_p50Us;
+    m_p99Us = x.m_p99Us;
+    m_p999Us = x.m_p999Us;
+    m_maxUs = x.m_maxUs;
+    m_allocCount = x.m_allocCount;
+    m_allocBytes = x.m_allocBytes;
 
     return *this;
 }
 
-CounterUAS::PredictedEntry& CounterUAS::PredictedEntry::operator =(
-        PredictedEntry&& x) noexcept
+CounterUAS::StageLatency& CounterUAS::StageLatency::operator =(
+        StageLatency&& x) noexcept
 {
 
-    m_trackId = x.m_trackId;
-    m_trackStatus = x.m_trackStatus;
-    m_x = x.m_x;
-    m_vx = x.m_vx;
-    m_ax = x.m_ax;
-    m_y = x.m_y;
-    m_vy = x.m_vy;
-    m_ay = x.m_ay;
-    m_z = x.m_z;
-    m_vz = x.m_vz;
-    m_az = x.m_az;
-    m_range = x.m_range;
-    m_azimuth = x.m_azimuth;
-    m_elevation = x.m_elevation;
-    m_covX = x.m_covX;
-    m_covY = x.m_covY;
-    m_covZ = x.m_covZ;
-    m_modelProb0 = x.m_modelProb0;
-    m_modelProb1 = x.m_modelProb1;
-    m_modelProb2 = x.m_modelProb2;
-    m_modelProb3 = x.m_modelProb3;
-    m_modelProb4 = x.m_modelProb4;
+    m_stageId = x.m_stageId;
+    m_name = std::move(x.m_name);
+    m_count = x.m_count;
+    m_p50Us = x.m_p50Us;
+    m_p99Us = x.m_p99Us;
+    m_p999Us = x.m_p999Us;
+    m_maxUs = x.m_maxUs;
+    m_allocCount = x.m_allocCount;
+    m_allocBytes = x.m_allocBytes;
 
     return *this;
 }
 
-bool CounterUAS::PredictedEntry::operator ==(
-        const PredictedEntry& x) const
+bool CounterUAS::StageLatency::operator ==(
+        const StageLatency& x) const
 {
 
-    return (m_trackId == x.m_trackId && m_trackStatus == x.m_trackStatus && m_x == x.m_x && m_vx == x.m_vx && m_ax == x.m_ax && m_y == x.m_y && m_vy == x.m_vy && m_ay == x.m_ay && m_z == x.m_z && m_vz == x.m_vz && m_az == x.m_az && m_range == x.m_range && m_azimuth == x.m_azimuth && m_elevation == x.m_elevation && m_covX == x.m_covX && m_covY == x.m_covY && m_covZ == x.m_covZ && m_modelProb0 == x.m_modelProb0 && m_modelProb1 == x.m_modelProb1 && m_modelProb2 == x.m_modelProb2 && m_modelProb3 == x.m_modelProb3 && m_modelProb4 == x.m_modelProb4);
+    return (m_stageId == x.m_stageId && m_name == x.m_name && m_count == x.m_count && m_p50Us == x.m_p50Us && m_p99Us == x.m_p99Us && m_p999Us == x.m_p999Us && m_maxUs == x.m_maxUs && m_allocCount == x.m_allocCount && m_allocBytes == x.m_allocBytes);
 }
 
-bool CounterUAS::PredictedEntry::operator !=(
-        const PredictedEntry& x) const
+bool CounterUAS::StageLatency::operator !=(
+        const StageLatency& x) const
 {
     return !(*this == x);
 }
 
-size_t CounterUAS::PredictedEntry::getMaxCdrSerializedSize(
+size_t CounterUAS::StageLatency::getMaxCdrSerializedSize(
         size_t current_alignment)
 {
     size_t initial_alignment = current_alignment;
@@ -3793,7 +7784,7 @@ size_t CounterUAS::PredictedEntry::getMaxCdrSerializedSize(
     current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4) + 255 + 1;
 
 
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
@@ -3817,16 +7808,22 @@ size_t CounterUAS::PredictedEntry::getMaxCdrSerializedSize(
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
+    return current_alignment - initial_alignment;
+}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+size_t CounterUAS::StageLatency::getCdrSerializedSize(
+        const CounterUAS::StageLatency& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4) + data.name().size() + 1;
 
 
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
@@ -3850,58 +7847,414 @@ size_t CounterUAS::PredictedEntry::getMaxCdrSerializedSize(
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
+    return current_alignment - initial_alignment;
+}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+void CounterUAS::StageLatency::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_stageId;
+    scdr << m_name.c_str();
+    scdr << m_count;
+    scdr << m_p50Us;
+    scdr << m_p99Us;
+    scdr << m_p999Us;
+    scdr << m_maxUs;
+    scdr << m_allocCount;
+    scdr << m_allocBytes;
+
+}
+
+void CounterUAS::StageLatency::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
+{
+
+    dcdr >> m_stageId;
+    dcdr >> m_name;
+    dcdr >> m_count;
+    dcdr >> m_p50Us;
+    dcdr >> m_p99Us;
+    dcdr >> m_p999Us;
+    dcdr >> m_maxUs;
+    dcdr >> m_allocCount;
+    dcdr >> m_allocBytes;
+}
+
+/*!
+ * @brief This function sets a value in member stageId
+ * @param _stageId New value for member stageId
+ */
+void CounterUAS::StageLatency::stageId(
+        uint32_t _stageId)
+{
+    m_stageId = _stageId;
+}
+
+/*!
+ * @brief This function returns the value of member stageId
+ * @return Value of member stageId
+ */
+uint32_t CounterUAS::StageLatency::stageId() const
+{
+    return m_stageId;
+}
+
+/*!
+ * @brief This function returns a reference to member stageId
+ * @return Reference to member stageId
+ */
+uint32_t& CounterUAS::StageLatency::stageId()
+{
+    return m_stageId;
+}
+
+/*!
+ * @brief This function copies the value in member name
+ * @param _name New value to be copied in member name
+ */
+void CounterUAS::StageLatency::name(
+        const std::string& _name)
+{
+    m_name = _name;
+}
+
+/*!
+ * @brief This function moves the value in member name
+ * @param _name New value to be moved in member name
+ */
+void CounterUAS::StageLatency::name(
+        std::string&& _name)
+{
+    m_name = std::move(_name);
+}
+
+/*!
+ * @brief This function returns a constant reference to member name
+ * @return Constant reference to member name
+ */
+const std::string& CounterUAS::StageLatency::name() const
+{
+    return m_name;
+}
+
+/*!
+ * @brief This function returns a reference to member name
+ * @return Reference to member name
+ */
+std::string& CounterUAS::StageLatency::name()
+{
+    return m_name;
+}
+/*!
+ * @brief This function sets a value in member count
+ * @param _count New value for member count
+ */
+void CounterUAS::StageLatency::count(
+        uint64_t _count)
+{
+    m_count = _count;
+}
+
+/*!
+ * @brief This function returns the value of member count
+ * @return Value of member count
+ */
+uint64_t CounterUAS::StageLatency::count() const
+{
+    return m_count;
+}
+
+/*!
+ * @brief This function returns a reference to member count
+ * @return Reference to member count
+ */
+uint64_t& CounterUAS::StageLatency::count()
+{
+    return m_count;
+}
+
+/*!
+ * @brief This function sets a value in member p50Us
+ * @param _p50Us New value for member p50Us
+ */
+void CounterUAS::StageLatency::p50Us(
+        double _p50Us)
+{
+    m_p50Us = _p50Us;
+}
+
+/*!
+ * @brief This function returns the value of member p50Us
+ * @return Value of member p50Us
+ */
+double CounterUAS::StageLatency::p50Us() const
+{
+    return m_p50Us;
+}
+
+/*!
+ * @brief This function returns a reference to member p50Us
+ * @return Reference to member p50Us
+ */
+double& CounterUAS::StageLatency::p50Us()
+{
+    return m_p50Us;
+}
+
+/*!
+ * @brief This function sets a value in member p99Us
+ * @param _p99Us New value for member p99Us
+ */
+void CounterUAS::StageLatency::p99Us(
+        double _p99Us)
+{
+    m_p99Us = _p99Us;
+}
+
+/*!
+ * @brief This function returns the value of member p99Us
+ * @return Value of member p99Us
+ */
+double CounterUAS::StageLatency::p99Us() const
+{
+    return m_p99Us;
+}
+
+/*!
+ * @brief This function returns a reference to member p99Us
+ * @return Reference to member p99Us
+ */
+double& CounterUAS::StageLatency::p99Us()
+{
+    return m_p99Us;
+}
+
+/*!
+ * @brief This function sets a value in member p999Us
+ * @param _p999Us New value for member p999Us
+ */
+void CounterUAS::StageLatency::p999Us(
+        double _p999Us)
+{
+    m_p999Us = _p999Us;
+}
+
+/*!
+ * @brief This function returns the value of member p999Us
+ * @return Value of member p999Us
+ */
+double CounterUAS::StageLatency::p999Us() const
+{
+    return m_p999Us;
+}
+
+/*!
+ * @brief This function returns a reference to member p999Us
+ * @return Reference to member p999Us
+ */
+double& CounterUAS::StageLatency::p999Us()
+{
+    return m_p999Us;
+}
+
+/*!
+ * @brief This function sets a value in member maxUs
+ * @param _maxUs New value for member maxUs
+ */
+void CounterUAS::StageLatency::maxUs(
+        double _maxUs)
+{
+    m_maxUs = _maxUs;
+}
+
+/*!
+ * @brief This function returns the value of member maxUs
+ * @return Value of member maxUs
+ */
+double CounterUAS::StageLatency::maxUs() const
+{
+    return m_maxUs;
+}
+
+/*!
+ * @brief This function returns a reference to member maxUs
+ * @return Reference to member maxUs
+ */
+double& CounterUAS::StageLatency::maxUs()
+{
+    return m_maxUs;
+}
+
+/*!
+ * @brief This function sets a value in member allocCount
+ * @param _allocCount New value for member allocCount
+ */
+void CounterUAS::StageLatency::allocCount(
+        uint64_t _allocCount)
+{
+    m_allocCount = _allocCount;
+}
+
+/*!
+ * @brief This function returns the value of member allocCount
+ * @return Value of member allocCount
+ */
+uint64_t CounterUAS::StageLatency::allocCount() const
+{
+    return m_allocCount;
+}
+
+/*!
+ * @brief This function returns a reference to member allocCount
+ * @return Reference to member allocCount
+ */
+uint64_t& CounterUAS::StageLatency::allocCount()
+{
+    return m_allocCount;
+}
+
+/*!
+ * @brief This function sets a value in member allocBytes
+ * @param _allocBytes New value for member allocBytes
+ */
+void CounterUAS::StageLatency::allocBytes(
+        uint64_t _allocBytes)
+{
+    m_allocBytes = _allocBytes;
+}
+
+/*!
+ * @brief This function returns the value of member allocBytes
+ * @return Value of member allocBytes
+ */
+uint64_t CounterUAS::StageLatency::allocBytes() const
+{
+    return m_allocBytes;
+}
+
+/*!
+ * @brief This function returns a reference to member allocBytes
+ * @return Reference to member allocBytes
+ */
+uint64_t& CounterUAS::StageLatency::allocBytes()
+{
+    return m_allocBytes;
+}
+
+
+size_t CounterUAS::StageLatency::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
 
 
 
-    return current_alignment - initial_alignment;
+    return current_align;
 }
 
-size_t CounterUAS::PredictedEntry::getCdrSerializedSize(
-        const CounterUAS::PredictedEntry& data,
-        size_t current_alignment)
+bool CounterUAS::StageLatency::isKeyDefined()
 {
-    (void)data;
-    size_t initial_alignment = current_alignment;
-
+    return false;
+}
 
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+void CounterUAS::StageLatency::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+        
+}
 
+CounterUAS::TrackerHealthMessage::TrackerHealthMessage()
+{
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@38d048e
+    m_messageId = 0;
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@44b1ee37
+    m_timestamp = 0;
+    // m_cycleCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@46d4ac7a
+    m_cycleCount = 0;
+    // m_numStages com.eprosima.idl.parser.typecode.PrimitiveTypeCode@d3addcc
+    m_numStages = 0;
+    // m_stages com.eprosima.idl.parser.typecode.SequenceTypeCode@43000de
 
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
+}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+CounterUAS::TrackerHealthMessage::~TrackerHealthMessage()
+{
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+}
 
+CounterUAS::TrackerHealthMessage::TrackerHealthMessage(
+        const TrackerHealthMessage& x)
+{
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_cycleCount = x.m_cycleCount;
+    m_numStages = x.m_numStages;
+    m_stages = x.m_stages;
+}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+CounterUAS::TrackerHealthMessage::TrackerHealthMessage(
+        TrackerHealthMessage&& x) noexcept 
+{
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_cycleCount = x.m_cycleCount;
+    m_numStages = x.m_numStages;
+    m_stages = std::move(x.m_stages);
+}
 
+CounterUAS::TrackerHealthMessage& CounterUAS::TrackerHealthMessage::operator =(
+        const TrackerHealthMessage& x)
+{
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_cycleCount = x.m_cycleCount;
+    m_numStages = x.m_numStages;
+    m_stages = x.m_stages;
 
+    return *this;
+}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+CounterUAS::TrackerHealthMessage& CounterUAS::TrackerHealthMessage::operator =(
+        TrackerHealthMessage&& x) noexcept
+{
 
+    m_messageId = x.m_messageId;
+    m_timestamp = x.m_timestamp;
+    m_cycleCount = x.m_cycleCount;
+    m_numStages = x.m_numStages;
+    m_stages = std::move(x.m_stages);
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    return *this;
+}
 
+bool CounterUAS::TrackerHealthMessage::operator ==(
+        const TrackerHealthMessage& x) const
+{
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    return (m_messageId == x.m_messageId && m_timestamp == x.m_timestamp && m_cycleCount == x.m_cycleCount && m_numStages == x.m_numStages && m_stages == x.m_stages);
+}
 
+bool CounterUAS::TrackerHealthMessage::operator !=(
+        const TrackerHealthMessage& x) const
+{
+    return !(*this == x);
+}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+size_t CounterUAS::TrackerHealthMessage::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
@@ -3910,22 +8263,29 @@ size_t CounterUAS::PredictedEntry::getCdrSerializedSize(
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
+    for(size_t a = 0; a < 100; ++a)
+    {
+        current_alignment += CounterUAS::StageLatency::getMaxCdrSerializedSize(current_alignment);}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
+    return current_alignment - initial_alignment;
+}
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+size_t CounterUAS::TrackerHealthMessage::getCdrSerializedSize(
+        const CounterUAS::TrackerHealthMessage& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
 
 
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
 
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
@@ -3934,984 +8294,1217 @@ size_t CounterUAS::PredictedEntry::getCdrSerializedSize(
     current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
 
 
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
-    return current_alignment - initial_alignment;
-}
-
-void CounterUAS::PredictedEntry::serialize(
-        eprosima::fastcdr::Cdr& scdr) const
-{
-
-    scdr << m_trackId;
-    scdr << (uint32_t)m_trackStatus;
-    scdr << m_x;
-    scdr << m_vx;
-    scdr << m_ax;
-    scdr << m_y;
-    scdr << m_vy;
-    scdr << m_ay;
-    scdr << m_z;
-    scdr << m_vz;
-    scdr << m_az;
-    scdr << m_range;
-    scdr << m_azimuth;
-    scdr << m_elevation;
-    scdr << m_covX;
-    scdr << m_covY;
-    scdr << m_covZ;
-    scdr << m_modelProb0;
-    scdr << m_modelProb1;
-    scdr << m_modelProb2;
-    scdr << m_modelProb3;
-    scdr << m_modelProb4;
 
-}
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
 
-void CounterUAS::PredictedEntry::deserialize(
-        eprosima::fastcdr::Cdr& dcdr)
-{
 
-    dcdr >> m_trackId;
+    for(size_t a = 0; a < data.stages().size(); ++a)
     {
-        uint32_t enum_value = 0;
-        dcdr >> enum_value;
-        m_trackStatus = (CounterUAS::TrackStatus)enum_value;
-    }
-
-    dcdr >> m_x;
-    dcdr >> m_vx;
-    dcdr >> m_ax;
-    dcdr >> m_y;
-    dcdr >> m_vy;
-    dcdr >> m_ay;
-    dcdr >> m_z;
-    dcdr >> m_vz;
-    dcdr >> m_az;
-    dcdr >> m_range;
-    dcdr >> m_azimuth;
-    dcdr >> m_elevation;
-    dcdr >> m_covX;
-    dcdr >> m_covY;
-    dcdr >> m_covZ;
-    dcdr >> m_modelProb0;
-    dcdr >> m_modelProb1;
-    dcdr >> m_modelProb2;
-    dcdr >> m_modelProb3;
-    dcdr >> m_modelProb4;
-}
-
-/*!
- * @brief This function sets a value in member trackId
- * @param _trackId New value for member trackId
- */
-void CounterUAS::PredictedEntry::trackId(
-        uint32_t _trackId)
-{
-    m_trackId = _trackId;
-}
+        current_alignment += CounterUAS::StageLatency::getCdrSerializedSize(data.stages().at(a), current_alignment);}
 
-/*!
- * @brief This function returns the value of member trackId
- * @return Value of member trackId
- */
-uint32_t CounterUAS::PredictedEntry::trackId() const
-{
-    return m_trackId;
-}
 
-/*!
- * @brief This function returns a reference to member trackId
- * @return Reference to member trackId
- */
-uint32_t& CounterUAS::PredictedEntry::trackId()
-{
-    return m_trackId;
+    return current_alignment - initial_alignment;
 }
 
-/*!
- * @brief This function sets a value in member trackStatus
- * @param _trackStatus New value for member trackStatus
- */
-void CounterUAS::PredictedEntry::trackStatus(
-        CounterUAS::TrackStatus _trackStatus)
+void CounterUAS::TrackerHealthMessage::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
 {
-    m_trackStatus = _trackStatus;
-}
 
-/*!
- * @brief This function returns the value of member trackStatus
- * @return Value of member trackStatus
- */
-CounterUAS::TrackStatus CounterUAS::PredictedEntry::trackStatus() const
-{
-    return m_trackStatus;
-}
+    scdr << m_messageId;
+    scdr << m_timestamp;
+    scdr << m_cycleCount;
+    scdr << m_numStages;
+    scdr << m_stages;
 
-/*!
- * @brief This function returns a reference to member trackStatus
- * @return Reference to member trackStatus
- */
-CounterUAS::TrackStatus& CounterUAS::PredictedEntry::trackStatus()
-{
-    return m_trackStatus;
 }
 
-/*!
- * @brief This function sets a value in member x
- * @param _x New value for member x
- */
-void CounterUAS::PredictedEntry::x(
-        double _x)
+void CounterUAS::TrackerHealthMessage::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
 {
-    m_x = _x;
-}
 
-/*!
- * @brief This function returns the value of member x
- * @return Value of member x
- */
-double CounterUAS::PredictedEntry::x() const
-{
-    return m_x;
+    dcdr >> m_messageId;
+    dcdr >> m_timestamp;
+    dcdr >> m_cycleCount;
+    dcdr >> m_numStages;
+    dcdr >> m_stages;
 }
 
 /*!
- * @brief This function returns a reference to member x
- * @return Reference to member x
+ * @brief This function sets a value in member messageId
+ * @param _messageId New value for member messageId
  */
-double& CounterUAS::PredictedEntry::x()
+void CounterUAS::TrackerHealthMessage::messageId(
+        uint32_t _messageId)
 {
-    return m_x;
+    m_messageId = _messageId;
 }
 
 /*!
- * @brief This function sets a value in member vx
- * @param _vx New value for member vx
+ * @brief This function returns the value of member messageId
+ * @return Value of member messageId
  */
-void CounterUAS::PredictedEntry::vx(
-        double _vx)
+uint32_t CounterUAS::TrackerHealthMessage::messageId() const
 {
-    m_vx = _vx;
+    return m_messageId;
 }
 
 /*!
- * @brief This function returns the value of member vx
- * @return Value of member vx
+ * @brief This function returns a reference to member messageId
+ * @return Reference to member messageId
  */
-double CounterUAS::PredictedEntry::vx() const
+uint32_t& CounterUAS::TrackerHealthMessage::messageId()
 {
-    return m_vx;
+    return m_messageId;
 }
 
 /*!
- * @brief This function returns a reference to member vx
- * @return Reference to member vx
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
  */
-double& CounterUAS::PredictedEntry::vx()
+void CounterUAS::TrackerHealthMessage::timestamp(
+        uint64_t _timestamp)
 {
-    return m_vx;
+    m_timestamp = _timestamp;
 }
 
 /*!
- * @brief This function sets a value in member ax
- * @param _ax New value for member ax
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
  */
-void CounterUAS::PredictedEntry::ax(
-        double _ax)
+uint64_t CounterUAS::TrackerHealthMessage::timestamp() const
 {
-    m_ax = _ax;
+    return m_timestamp;
 }
 
 /*!
- * @brief This function returns the value of member ax
- * @return Value of member ax
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
  */
-double CounterUAS::PredictedEntry::ax() const
+uint64_t& CounterUAS::TrackerHealthMessage::timestamp()
 {
-    return m_ax;
+    return m_timestamp;
 }
 
 /*!
- * @brief This function returns a reference to member ax
- * @return Reference to member ax
+ * @brief This function sets a value in member cycleCount
+ * @param _cycleCount New value for member cycleCount
  */
-double& CounterUAS::PredictedEntry::ax()
+void CounterUAS::TrackerHealthMessage::cycleCount(
+        uint64_t _cycleCount)
 {
-    return m_ax;
+    m_cycleCount = _cycleCount;
 }
 
 /*!
- * @brief This function sets a value in member y
- * @param _y New value for member y
+ * @brief This function returns the value of member cycleCount
+ * @return Value of member cycleCount
  */
-void CounterUAS::PredictedEntry::y(
-        double _y)
+uint64_t CounterUAS::TrackerHealthMessage::cycleCount() const
 {
-    m_y = _y;
+    return m_cycleCount;
 }
 
 /*!
- * @brief This function returns the value of member y
- * @return Value of member y
+ * @brief This function returns a reference to member cycleCount
+ * @return Reference to member cycleCount
  */
-double CounterUAS::PredictedEntry::y() const
+uint64_t& CounterUAS::TrackerHealthMessage::cycleCount()
 {
-    return m_y;
+    return m_cycleCount;
 }
 
 /*!
- * @brief This function returns a reference to member y
- * @return Reference to member y
+ * @brief This function sets a value in member numStages
+ * @param _numStages New value for member numStages
  */
-double& CounterUAS::PredictedEntry::y()
+void CounterUAS::TrackerHealthMessage::numStages(
+        uint32_t _numStages)
 {
-    return m_y;
+    m_numStages = _numStages;
 }
 
 /*!
- * @brief This function sets a value in member vy
- * @param _vy New value for member vy
+ * @brief This function returns the value of member numStages
+ * @return Value of member numStages
  */
-void CounterUAS::PredictedEntry::vy(
-        double _vy)
+uint32_t CounterUAS::TrackerHealthMessage::numStages() const
 {
-    m_vy = _vy;
+    return m_numStages;
 }
 
 /*!
- * @brief This function returns the value of member vy
- * @return Value of member vy
+ * @brief This function returns a reference to member numStages
+ * @return Reference to member numStages
  */
-double CounterUAS::PredictedEntry::vy() const
+uint32_t& CounterUAS::TrackerHealthMessage::numStages()
 {
-    return m_vy;
+    return m_numStages;
 }
 
 /*!
- * @brief This function returns a reference to member vy
- * @return Reference to member vy
+ * @brief This function copies the value in member stages
+ * @param _stages New value to be copied in member stages
  */
-double& CounterUAS::PredictedEntry::vy()
+void CounterUAS::TrackerHealthMessage::stages(
+        const std::vector<CounterUAS::StageLatency>& _stages)
 {
-    return m_vy;
+    m_stages = _stages;
 }
 
 /*!
- * @brief This function sets a value in member ay
- * @param _ay New value for member ay
+ * @brief This function moves the value in member stages
+ * @param _stages New value to be moved in member stages
  */
-void CounterUAS::PredictedEntry::ay(
-        double _ay)
+void CounterUAS::TrackerHealthMessage::stages(
+        std::vector<CounterUAS::StageLatency>&& _stages)
 {
-    m_ay = _ay;
+    m_stages = std::move(_stages);
 }
 
 /*!
- * @brief This function returns the value of member ay
- * @return Value of member ay
+ * @brief This function returns a constant reference to member stages
+ * @return Constant reference to member stages
  */
-double CounterUAS::PredictedEntry::ay() const
+const std::vector<CounterUAS::StageLatency>& CounterUAS::TrackerHealthMessage::stages() const
 {
-    return m_ay;
+    return m_stages;
 }
 
 /*!
- * @brief This function returns a reference to member ay
- * @return Reference to member ay
+ * @brief This function returns a reference to member stages
+ * @return Reference to member stages
  */
-double& CounterUAS::PredictedEntry::ay()
+std::vector<CounterUAS::StageLatency>& CounterUAS::TrackerHealthMessage::stages()
 {
-    return m_ay;
+    return m_stages;
+}
+
+size_t CounterUAS::TrackerHealthMessage::getKeyMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t current_align = current_alignment;
+
+
+
+    return current_align;
+}
+
+bool CounterUAS::TrackerHealthMessage::isKeyDefined()
+{
+    return false;
+}
+
+void CounterUAS::TrackerHealthMessage::serializeKey(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+    (void) scdr;
+        
+}
+
+CounterUAS::TrackHandoverMessage::TrackHandoverMessage()
+{
+    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@451654d1
+    m_messageId = 0;
+    // m_fromNode com.eprosima.idl.parser.typecode.PrimitiveTypeCode@34f8db08
+    m_fromNode = 0;
+    // m_toNode com.eprosima.idl.parser.typecode.PrimitiveTypeCode@34d35bf6
+    m_toNode = 0;
+    // m_sensorId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@51d296f9
+    m_sensorId = 0;
+    // m_trackId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@7c1f88bf
+    m_trackId = 0;
+    // m_status com.eprosima.idl.parser.typecode.EnumTypeCode@2c273ce7
+    m_status = CounterUAS::TRACK_TENTATIVE;
+    // m_classification com.eprosima.idl.parser.typecode.EnumTypeCode@48cd7d20
+    m_classification = CounterUAS::CLASS_UNKNOWN;
+    // m_hitCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@4aae941a
+    m_hitCount = 0;
+    // m_consecutiveMisses com.eprosima.idl.parser.typecode.PrimitiveTypeCode@53ad4fda
+    m_consecutiveMisses = 0;
+    // m_missCount com.eprosima.idl.parser.typecode.PrimitiveTypeCode@48b76ca6
+    m_missCount = 0;
+    // m_age com.eprosima.idl.parser.typecode.PrimitiveTypeCode@568fa948
+    m_age = 0;
+    // m_reserved com.eprosima.idl.parser.typecode.PrimitiveTypeCode@3b612cff
+    m_reserved = 0;
+    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@79b6bc44
+    m_timestamp = 0;
+    // m_initiationTime com.eprosima.idl.parser.typecode.PrimitiveTypeCode@61dafe03
+    m_initiationTime = 0;
+    // m_lastUpdateTime com.eprosima.idl.parser.typecode.PrimitiveTypeCode@47de2b80
+    m_lastUpdateTime = 0;
+    // m_quality com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2cde9a3b
+    m_quality = 0.0;
+    // m_state com.eprosima.idl.parser.typecode.ArrayTypeCode@1936f9fb
+    memset(&m_state, 0, (CounterUAS::HANDOVER_STATE_DIM) * 8);
+    // m_covariance com.eprosima.idl.parser.typecode.ArrayTypeCode@57cc13a5
+    memset(&m_covariance, 0, (CounterUAS::HANDOVER_SYM_DIM) * 8);
+    // m_modeProbabilities com.eprosima.idl.parser.typecode.ArrayTypeCode@4bcb3037
+    memset(&m_modeProbabilities, 0, (CounterUAS::HANDOVER_NUM_MODELS) * 8);
+    // m_modelStates com.eprosima.idl.parser.typecode.ArrayTypeCode@31cc20d4
+    memset(&m_modelStates, 0, (CounterUAS::HANDOVER_MODEL_STATES) * 8);
+    // m_modelCovariances com.eprosima.idl.parser.typecode.ArrayTypeCode@2931c7e0
+    memset(&m_modelCovariances, 0, (CounterUAS::HANDOVER_MODEL_COVARIANCES) * 8);
+
+}
+
+CounterUAS::TrackHandoverMessage::~TrackHandoverMessage()
+{
+
+
+
+
+
+
+}
+
+CounterUAS::TrackHandoverMessage::TrackHandoverMessage(
+        const TrackHandoverMessage& x)
+{
+    m_messageId = x.m_messageId;
+    m_fromNode = x.m_fromNode;
+    m_toNode = x.m_toNode;
+    m_sensorId = x.m_sensorId;
+    m_trackId = x.m_trackId;
+    m_status = x.m_status;
+    m_classification = x.m_classification;
+    m_hitCount = x.m_hitCount;
+    m_consecutiveMisses = x.m_consecutiveMisses;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+    m_reserved = x.m_reserved;
+    m_timestamp = x.m_timestamp;
+    m_initiationTime = x.m_initiationTime;
+    m_lastUpdateTime = x.m_lastUpdateTime;
+    m_quality = x.m_quality;
+    m_state = x.m_state;
+    m_covariance = x.m_covariance;
+    m_modeProbabilities = x.m_modeProbabilities;
+    m_modelStates = x.m_modelStates;
+    m_modelCovariances = x.m_modelCovariances;
+}
+
+CounterUAS::TrackHandoverMessage::TrackHandoverMessage(
+        TrackHandoverMessage&& x) noexcept 
+{
+    m_messageId = x.m_messageId;
+    m_fromNode = x.m_fromNode;
+    m_toNode = x.m_toNode;
+    m_sensorId = x.m_sensorId;
+    m_trackId = x.m_trackId;
+    m_status = x.m_status;
+    m_classification = x.m_classification;
+    m_hitCount = x.m_hitCount;
+    m_consecutiveMisses = x.m_consecutiveMisses;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+    m_reserved = x.m_reserved;
+    m_timestamp = x.m_timestamp;
+    m_initiationTime = x.m_initiationTime;
+    m_lastUpdateTime = x.m_lastUpdateTime;
+    m_quality = x.m_quality;
+    m_state = std::move(x.m_state);
+    m_covariance = std::move(x.m_covariance);
+    m_modeProbabilities = std::move(x.m_modeProbabilities);
+    m_modelStates = std::move(x.m_modelStates);
+    m_modelCovariances = std::move(x.m_modelCovariances);
+}
+
+CounterUAS::TrackHandoverMessage& CounterUAS::TrackHandoverMessage::operator =(
+        const TrackHandoverMessage& x)
+{
+
+    m_messageId = x.m_messageId;
+    m_fromNode = x.m_fromNode;
+    m_toNode = x.m_toNode;
+    m_sensorId = x.m_sensorId;
+    m_trackId = x.m_trackId;
+    m_status = x.m_status;
+    m_classification = x.m_classification;
+    m_hitCount = x.m_hitCount;
+    m_consecutiveMisses = x.m_consecutiveMisses;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+    m_reserved = x.m_reserved;
+    m_timestamp = x.m_timestamp;
+    m_initiationTime = x.m_initiationTime;
+    m_lastUpdateTime = x.m_lastUpdateTime;
+    m_quality = x.m_quality;
+    m_state = x.m_state;
+    m_covariance = x.m_covariance;
+    m_modeProbabilities = x.m_modeProbabilities;
+    m_modelStates = x.m_modelStates;
+    m_modelCovariances = x.m_modelCovariances;
+
+    return *this;
+}
+
+CounterUAS::TrackHandoverMessage& CounterUAS::TrackHandoverMessage::operator =(
+        TrackHandoverMessage&& x) noexcept
+{
+
+    m_messageId = x.m_messageId;
+    m_fromNode = x.m_fromNode;
+    m_toNode = x.m_toNode;
+    m_sensorId = x.m_sensorId;
+    m_trackId = x.m_trackId;
+    m_status = x.m_status;
+    m_classification = x.m_classification;
+    m_hitCount = x.m_hitCount;
+    m_consecutiveMisses = x.m_consecutiveMisses;
+    m_missCount = x.m_missCount;
+    m_age = x.m_age;
+    m_reserved = x.m_reserved;
+    m_timestamp = x.m_timestamp;
+    m_initiationTime = x.m_initiationTime;
+    m_lastUpdateTime = x.m_lastUpdateTime;
+    m_quality = x.m_quality;
+    m_state = std::move(x.m_state);
+    m_covariance = std::move(x.m_covariance);
+    m_modeProbabilities = std::move(x.m_modeProbabilities);
+    m_modelStates = std::move(x.m_modelStates);
+    m_modelCovariances = std::move(x.m_modelCovariances);
+
+    return *this;
+}
+
+bool CounterUAS::TrackHandoverMessage::operator ==(
+        const TrackHandoverMessage& x) const
+{
+
+    return (m_messageId == x.m_messageId && m_fromNode == x.m_fromNode && m_toNode == x.m_toNode && m_sensorId == x.m_sensorId && m_trackId == x.m_trackId && m_status == x.m_status && m_classification == x.m_classification && m_hitCount == x.m_hitCount && m_consecutiveMisses == x.m_consecutiveMisses && m_missCount == x.m_missCount && m_age == x.m_age && m_reserved == x.m_reserved && m_timestamp == x.m_timestamp && m_initiationTime == x.m_initiationTime && m_lastUpdateTime == x.m_lastUpdateTime && m_quality == x.m_quality && m_state == x.m_state && m_covariance == x.m_covariance && m_modeProbabilities == x.m_modeProbabilities && m_modelStates == x.m_modelStates && m_modelCovariances == x.m_modelCovariances);
+}
+
+bool CounterUAS::TrackHandoverMessage::operator !=(
+        const TrackHandoverMessage& x) const
+{
+    return !(*this == x);
+}
+
+size_t CounterUAS::TrackHandoverMessage::getMaxCdrSerializedSize(
+        size_t current_alignment)
+{
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += ((CounterUAS::HANDOVER_STATE_DIM) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += ((CounterUAS::HANDOVER_SYM_DIM) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += ((CounterUAS::HANDOVER_NUM_MODELS) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += ((CounterUAS::HANDOVER_MODEL_STATES) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += ((CounterUAS::HANDOVER_MODEL_COVARIANCES) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+
+    return current_alignment - initial_alignment;
+}
+
+size_t CounterUAS::TrackHandoverMessage::getCdrSerializedSize(
+        const CounterUAS::TrackHandoverMessage& data,
+        size_t current_alignment)
+{
+    (void)data;
+    size_t initial_alignment = current_alignment;
+
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+
+    if ((CounterUAS::HANDOVER_STATE_DIM) > 0)
+    {
+        current_alignment += ((CounterUAS::HANDOVER_STATE_DIM) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    }
+
+    if ((CounterUAS::HANDOVER_SYM_DIM) > 0)
+    {
+        current_alignment += ((CounterUAS::HANDOVER_SYM_DIM) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    }
+
+    if ((CounterUAS::HANDOVER_NUM_MODELS) > 0)
+    {
+        current_alignment += ((CounterUAS::HANDOVER_NUM_MODELS) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    }
+
+    if ((CounterUAS::HANDOVER_MODEL_STATES) > 0)
+    {
+        current_alignment += ((CounterUAS::HANDOVER_MODEL_STATES) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    }
+
+    if ((CounterUAS::HANDOVER_MODEL_COVARIANCES) > 0)
+    {
+        current_alignment += ((CounterUAS::HANDOVER_MODEL_COVARIANCES) * 8) + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
+    }
+
+
+    return current_alignment - initial_alignment;
 }
 
-/*!
- * @brief This function sets a value in member z
- * @param _z New value for member z
- */
-void CounterUAS::PredictedEntry::z(
-        double _z)
-{
-    m_z = _z;
+void CounterUAS::TrackHandoverMessage::serialize(
+        eprosima::fastcdr::Cdr& scdr) const
+{
+
+    scdr << m_messageId;
+    scdr << m_fromNode;
+    scdr << m_toNode;
+    scdr << m_sensorId;
+    scdr << m_trackId;
+    scdr << (uint32_t)m_status;
+    scdr << (uint32_t)m_classification;
+    scdr << m_hitCount;
+    scdr << m_consecutiveMisses;
+    scdr << m_missCount;
+    scdr << m_age;
+    scdr << m_reserved;
+    scdr << m_timestamp;
+    scdr << m_initiationTime;
+    scdr << m_lastUpdateTime;
+    scdr << m_quality;
+    scdr << m_state;
+    scdr << m_covariance;
+    scdr << m_modeProbabilities;
+    scdr << m_modelStates;
+    scdr << m_modelCovariances;
+
 }
 
-/*!
- * @brief This function returns the value of member z
- * @return Value of member z
- */
-double CounterUAS::PredictedEntry::z() const
+void CounterUAS::TrackHandoverMessage::deserialize(
+        eprosima::fastcdr::Cdr& dcdr)
 {
-    return m_z;
+
+    dcdr >> m_messageId;
+    dcdr >> m_fromNode;
+    dcdr >> m_toNode;
+    dcdr >> m_sensorId;
+    dcdr >> m_trackId;
+    {
+        uint32_t enum_value = 0;
+        dcdr >> enum_value;
+        m_status = (CounterUAS::TrackStatus)enum_value;
+    }
+
+    {
+        uint32_t enum_value = 0;
+        dcdr >> enum_value;
+        m_classification = (CounterUAS::TrackClassification)enum_value;
+    }
+
+    dcdr >> m_hitCount;
+    dcdr >> m_consecutiveMisses;
+    dcdr >> m_missCount;
+    dcdr >> m_age;
+    dcdr >> m_reserved;
+    dcdr >> m_timestamp;
+    dcdr >> m_initiationTime;
+    dcdr >> m_lastUpdateTime;
+    dcdr >> m_quality;
+    dcdr >> m_state;
+    dcdr >> m_covariance;
+    dcdr >> m_modeProbabilities;
+    dcdr >> m_modelStates;
+    dcdr >> m_modelCovariances;
 }
 
 /*!
- * @brief This function returns a reference to member z
- * @return Reference to member z
+ * @brief This function sets a value in member messageId
+ * @param _messageId New value for member messageId
  */
-double& CounterUAS::PredictedEntry::z()
+void CounterUAS::TrackHandoverMessage::messageId(
+        uint32_t _messageId)
 {
-    return m_z;
+    m_messageId = _messageId;
 }
 
 /*!
- * @brief This function sets a value in member vz
- * @param _vz New value for member vz
+ * @brief This function returns the value of member messageId
+ * @return Value of member messageId
  */
-void CounterUAS::PredictedEntry::vz(
-        double _vz)
+uint32_t CounterUAS::TrackHandoverMessage::messageId() const
 {
-    m_vz = _vz;
+    return m_messageId;
 }
 
 /*!
- * @brief This function returns the value of member vz
- * @return Value of member vz
+ * @brief This function returns a reference to member messageId
+ * @return Reference to member messageId
  */
-double CounterUAS::PredictedEntry::vz() const
+uint32_t& CounterUAS::TrackHandoverMessage::messageId()
 {
-    return m_vz;
+    return m_messageId;
 }
 
 /*!
- * @brief This function returns a reference to member vz
- * @return Reference to member vz
+ * @brief This function sets a value in member fromNode
+ * @param _fromNode New value for member fromNode
  */
-double& CounterUAS::PredictedEntry::vz()
+void CounterUAS::TrackHandoverMessage::fromNode(
+        uint32_t _fromNode)
 {
-    return m_vz;
+    m_fromNode = _fromNode;
 }
 
 /*!
- * @brief This function sets a value in member az
- * @param _az New value for member az
+ * @brief This function returns the value of member fromNode
+ * @return Value of member fromNode
  */
-void CounterUAS::PredictedEntry::az(
-        double _az)
+uint32_t CounterUAS::TrackHandoverMessage::fromNode() const
 {
-    m_az = _az;
+    return m_fromNode;
 }
 
 /*!
- * @brief This function returns the value of member az
- * @return Value of member az
+ * @brief This function returns a reference to member fromNode
+ * @return Reference to member fromNode
  */
-double CounterUAS::PredictedEntry::az() const
+uint32_t& CounterUAS::TrackHandoverMessage::fromNode()
 {
-    return m_az;
+    return m_fromNode;
 }
 
 /*!
- * @brief This function returns a reference to member az
- * @return Reference to member az
+ * @brief This function sets a value in member toNode
+ * @param _toNode New value for member toNode
  */
-double& CounterUAS::PredictedEntry::az()
+void CounterUAS::TrackHandoverMessage::toNode(
+        uint32_t _toNode)
 {
-    return m_az;
+    m_toNode = _toNode;
 }
 
 /*!
- * @brief This function sets a value in member range
- * @param _range New value for member range
+ * @brief This function returns the value of member toNode
+ * @return Value of member toNode
  */
-void CounterUAS::PredictedEntry::range(
-        double _range)
+uint32_t CounterUAS::TrackHandoverMessage::toNode() const
 {
-    m_range = _range;
+    return m_toNode;
 }
 
 /*!
- * @brief This function returns the value of member range
- * @return Value of member range
+ * @brief This function returns a reference to member toNode
+ * @return Reference to member toNode
  */
-double CounterUAS::PredictedEntry::range() const
+uint32_t& CounterUAS::TrackHandoverMessage::toNode()
 {
-    return m_range;
+    return m_toNode;
 }
 
 /*!
- * @brief This function returns a reference to member range
- * @return Reference to member range
+ * @brief This function sets a value in member sensorId
+ * @param _sensorId New value for member sensorId
  */
-double& CounterUAS::PredictedEntry::range()
+void CounterUAS::TrackHandoverMessage::sensorId(
+        uint32_t _sensorId)
 {
-    return m_range;
+    m_sensorId = _sensorId;
 }
 
 /*!
- * @brief This function sets a value in member azimuth
- * @param _azimuth New value for member azimuth
+ * @brief This function returns the value of member sensorId
+ * @return Value of member sensorId
  */
-void CounterUAS::PredictedEntry::azimuth(
-        double _azimuth)
+uint32_t CounterUAS::TrackHandoverMessage::sensorId() const
 {
-    m_azimuth = _azimuth;
+    return m_sensorId;
 }
 
 /*!
- * @brief This function returns the value of member azimuth
- * @return Value of member azimuth
+ * @brief This function returns a reference to member sensorId
+ * @return Reference to member sensorId
  */
-double CounterUAS::PredictedEntry::azimuth() const
+uint32_t& CounterUAS::TrackHandoverMessage::sensorId()
 {
-    return m_azimuth;
+    return m_sensorId;
 }
 
 /*!
- * @brief This function returns a reference to member azimuth
- * @return Reference to member azimuth
+ * @brief This function sets a value in member trackId
+ * @param _trackId New value for member trackId
  */
-double& CounterUAS::PredictedEntry::azimuth()
+void CounterUAS::TrackHandoverMessage::trackId(
+        uint32_t _trackId)
 {
-    return m_azimuth;
+    m_trackId = _trackId;
 }
 
 /*!
- * @brief This function sets a value in member elevation
- * @param _elevation New value for member elevation
+ * @brief This function returns the value of member trackId
+ * @return Value of member trackId
  */
-void CounterUAS::PredictedEntry::elevation(
-        double _elevation)
+uint32_t CounterUAS::TrackHandoverMessage::trackId() const
 {
-    m_elevation = _elevation;
+    return m_trackId;
 }
 
 /*!
- * @brief This function returns the value of member elevation
- * @return Value of member elevation
+ * @brief This function returns a reference to member trackId
+ * @return Reference to member trackId
  */
-double CounterUAS::PredictedEntry::elevation() const
+uint32_t& CounterUAS::TrackHandoverMessage::trackId()
 {
-    return m_elevation;
+    return m_trackId;
 }
 
 /*!
- * @brief This function returns a reference to member elevation
- * @return Reference to member elevation
+ * @brief This function sets a value in member status
+ * @param _status New value for member status
  */
-double& CounterUAS::PredictedEntry::elevation()
+void CounterUAS::TrackHandoverMessage::status(
+        CounterUAS::TrackStatus _status)
 {
-    return m_elevation;
+    m_status = _status;
 }
 
 /*!
- * @brief This function sets a value in member covX
- * @param _covX New value for member covX
+ * @brief This function returns the value of member status
+ * @return Value of member status
  */
-void CounterUAS::PredictedEntry::covX(
-        double _covX)
+CounterUAS::TrackStatus CounterUAS::TrackHandoverMessage::status() const
 {
-    m_covX = _covX;
+    return m_status;
 }
 
 /*!
- * @brief This function returns the value of member covX
- * @return Value of member covX
+ * @brief This function returns a reference to member status
+ * @return Reference to member status
  */
-double CounterUAS::PredictedEntry::covX() const
+CounterUAS::TrackStatus& CounterUAS::TrackHandoverMessage::status()
 {
-    return m_covX;
+    return m_status;
 }
 
 /*!
- * @brief This function returns a reference to member covX
- * @return Reference to member covX
+ * @brief This function sets a value in member classification
+ * @param _classification New value for member classification
  */
-double& CounterUAS::PredictedEntry::covX()
+void CounterUAS::TrackHandoverMessage::classification(
+        CounterUAS::TrackClassification _classification)
 {
-    return m_covX;
+    m_classification = _classification;
 }
 
 /*!
- * @brief This function sets a value in member covY
- * @param _covY New value for member covY
+ * @brief This function returns the value of member classification
+ * @return Value of member classification
  */
-void CounterUAS::PredictedEntry::covY(
-        double _covY)
+CounterUAS::TrackClassification CounterUAS::TrackHandoverMessage::classification() const
 {
-    m_covY = _covY;
+    return m_classification;
 }
 
 /*!
- * @brief This function returns the value of member covY
- * @return Value of member covY
+ * @brief This function returns a reference to member classification
+ * @return Reference to member classification
  */
-double CounterUAS::PredictedEntry::covY() const
+CounterUAS::TrackClassification& CounterUAS::TrackHandoverMessage::classification()
 {
-    return m_covY;
+    return m_classification;
 }
 
 /*!
- * @brief This function returns a reference to member covY
- * @return Reference to member covY
+ * @brief This function sets a value in member hitCount
+ * @param _hitCount New value for member hitCount
  */
-double& CounterUAS::PredictedEntry::covY()
+void CounterUAS::TrackHandoverMessage::hitCount(
+        uint32_t _hitCount)
 {
-    return m_covY;
+    m_hitCount = _hitCount;
 }
 
 /*!
- * @brief This function sets a value in member covZ
- * @param _covZ New value for member covZ
+ * @brief This function returns the value of member hitCount
+ * @return Value of member hitCount
  */
-void CounterUAS::PredictedEntry::covZ(
-        double _covZ)
+uint32_t CounterUAS::TrackHandoverMessage::hitCount() const
 {
-    m_covZ = _covZ;
+    return m_hitCount;
 }
 
 /*!
- * @brief This function returns the value of member covZ
- * @return Value of member covZ
+ * @brief This function returns a reference to member hitCount
+ * @return Reference to member hitCount
  */
-double CounterUAS::PredictedEntry::covZ() const
+uint32_t& CounterUAS::TrackHandoverMessage::hitCount()
 {
-    return m_covZ;
+    return m_hitCount;
 }
 
 /*!
- * @brief This function returns a reference to member covZ
- * @return Reference to member covZ
+ * @brief This function sets a value in member consecutiveMisses
+ * @param _consecutiveMisses New value for member consecutiveMisses
  */
-double& CounterUAS::PredictedEntry::covZ()
+void CounterUAS::TrackHandoverMessage::consecutiveMisses(
+        uint32_t _consecutiveMisses)
 {
-    return m_covZ;
+    m_consecutiveMisses = _consecutiveMisses;
 }
 
 /*!
- * @brief This function sets a value in member modelProb0
- * @param _modelProb0 New value for member modelProb0
+ * @brief This function returns the value of member consecutiveMisses
+ * @return Value of member consecutiveMisses
  */
-void CounterUAS::PredictedEntry::modelProb0(
-        double _modelProb0)
+uint32_t CounterUAS::TrackHandoverMessage::consecutiveMisses() const
 {
-    m_modelProb0 = _modelProb0;
+    return m_consecutiveMisses;
 }
 
 /*!
- * @brief This function returns the value of member modelProb0
- * @return Value of member modelProb0
+ * @brief This function returns a reference to member consecutiveMisses
+ * @return Reference to member consecutiveMisses
  */
-double CounterUAS::PredictedEntry::modelProb0() const
+uint32_t& CounterUAS::TrackHandoverMessage::consecutiveMisses()
 {
-    return m_modelProb0;
+    return m_consecutiveMisses;
 }
 
 /*!
- * @brief This function returns a reference to member modelProb0
- * @return Reference to member modelProb0
+ * @brief This function sets a value in member missCount
+ * @param _missCount New value for member missCount
  */
-double& CounterUAS::PredictedEntry::modelProb0()
+void CounterUAS::TrackHandoverMessage::missCount(
+        uint32_t _missCount)
 {
-    return m_modelProb0;
+    m_missCount = _missCount;
 }
 
 /*!
- * @brief This function sets a value in member modelProb1
- * @param _modelProb1 New value for member modelProb1
+ * @brief This function returns the value of member missCount
+ * @return Value of member missCount
  */
-void CounterUAS::PredictedEntry::modelProb1(
-        double _modelProb1)
+uint32_t CounterUAS::TrackHandoverMessage::missCount() const
 {
-    m_modelProb1 = _modelProb1;
+    return m_missCount;
 }
 
 /*!
- * @brief This function returns the value of member modelProb1
- * @return Value of member modelProb1
+ * @brief This function returns a reference to member missCount
+ * @return Reference to member missCount
  */
-double CounterUAS::PredictedEntry::modelProb1() const
+uint32_t& CounterUAS::TrackHandoverMessage::missCount()
 {
-    return m_modelProb1;
+    return m_missCount;
 }
 
 /*!
- * @brief This function returns a reference to member modelProb1
- * @return Reference to member modelProb1
+ * @brief This function sets a value in member age
+ * @param _age New value for member age
  */
-double& CounterUAS::PredictedEntry::modelProb1()
+void CounterUAS::TrackHandoverMessage::age(
+        uint32_t _age)
 {
-    return m_modelProb1;
+    m_age = _age;
 }
 
 /*!
- * @brief This function sets a value in member modelProb2
- * @param _modelProb2 New value for member modelProb2
+ * @brief This function returns the value of member age
+ * @return Value of member age
  */
-void CounterUAS::PredictedEntry::modelProb2(
-        double _modelProb2)
+uint32_t CounterUAS::TrackHandoverMessage::age() const
 {
-    m_modelProb2 = _modelProb2;
+    return m_age;
 }
 
 /*!
- * @brief This function returns the value of member modelProb2
- * @return Value of member modelProb2
+ * @brief This function returns a reference to member age
+ * @return Reference to member age
  */
-double CounterUAS::PredictedEntry::modelProb2() const
+uint32_t& CounterUAS::TrackHandoverMessage::age()
 {
-    return m_modelProb2;
+    return m_age;
 }
 
 /*!
- * @brief This function returns a reference to member modelProb2
- * @return Reference to member modelProb2
+ * @brief This function sets a value in member reserved
+ * @param _reserved New value for member reserved
  */
-double& CounterUAS::PredictedEntry::modelProb2()
+void CounterUAS::TrackHandoverMessage::reserved(
+        uint32_t _reserved)
 {
-    return m_modelProb2;
+    m_reserved = _reserved;
 }
 
 /*!
- * @brief This function sets a value in member modelProb3
- * @param _modelProb3 New value for member modelProb3
+ * @brief This function returns the value of member reserved
+ * @return Value of member reserved
  */
-void CounterUAS::PredictedEntry::modelProb3(
-        double _modelProb3)
+uint32_t CounterUAS::TrackHandoverMessage::reserved() const
 {
-    m_modelProb3 = _modelProb3;
+    return m_reserved;
 }
 
 /*!
- * @brief This function returns the value of member modelProb3
- * @return Value of member modelProb3
+ * @brief This function returns a reference to member reserved
+ * @return Reference to member reserved
  */
-double CounterUAS::PredictedEntry::modelProb3() const
+uint32_t& CounterUAS::TrackHandoverMessage::reserved()
 {
-    return m_modelProb3;
+    return m_reserved;
 }
 
 /*!
- * @brief This function returns a reference to member modelProb3
- * @return Reference to member modelProb3
+ * @brief This function sets a value in member timestamp
+ * @param _timestamp New value for member timestamp
  */
-double& CounterUAS::PredictedEntry::modelProb3()
+void CounterUAS::TrackHandoverMessage::timestamp(
+        uint64_t _timestamp)
 {
-    return m_modelProb3;
+    m_timestamp = _timestamp;
 }
 
 /*!
- * @brief This function sets a value in member modelProb4
- * @param _modelProb4 New value for member modelProb4
+ * @brief This function returns the value of member timestamp
+ * @return Value of member timestamp
  */
-void CounterUAS::PredictedEntry::modelProb4(
-        double _modelProb4)
+uint64_t CounterUAS::TrackHandoverMessage::timestamp() const
 {
-    m_modelProb4 = _modelProb4;
+    return m_timestamp;
 }
 
 /*!
- * @brief This function returns the value of member modelProb4
- * @return Value of member modelProb4
+ * @brief This function returns a reference to member timestamp
+ * @return Reference to member timestamp
  */
-double CounterUAS::PredictedEntry::modelProb4() const
+uint64_t& CounterUAS::TrackHandoverMessage::timestamp()
 {
-    return m_modelProb4;
+    return m_timestamp;
 }
 
 /*!
- * @brief This function returns a reference to member modelProb4
- * @return Reference to member modelProb4
+ * @brief This function sets a value in member initiationTime
+ * @param _initiationTime New value for member initiationTime
  */
-double& CounterUAS::PredictedEntry::modelProb4()
+void CounterUAS::TrackHandoverMessage::initiationTime(
+        uint64_t _initiationTime)
 {
-    return m_modelProb4;
+    m_initiationTime = _initiationTime;
 }
 
-
-size_t CounterUAS::PredictedEntry::getKeyMaxCdrSerializedSize(
-        size_t current_alignment)
+/*!
+ * @brief This function returns the value of member initiationTime
+ * @return Value of member initiationTime
+ */
+uint64_t CounterUAS::TrackHandoverMessage::initiationTime() const
 {
-    size_t current_align = current_alignment;
-
-
-
-    return current_align;
+    return m_initiationTime;
 }
 
-bool CounterUAS::PredictedEntry::isKeyDefined()
+/*!
+ * @brief This function returns a reference to member initiationTime
+ * @return Reference to member initiationTime
+ */
+uint64_t& CounterUAS::TrackHandoverMessage::initiationTime()
 {
-    return false;
+    return m_initiationTime;
 }
 
-void CounterUAS::PredictedEntry::serializeKey(
-        eprosima::fastcdr::Cdr& scdr) const
+/*!
+ * @brief This function sets a value in member lastUpdateTime
+ * @param _lastUpdateTime New value for member lastUpdateTime
+ */
+void CounterUAS::TrackHandoverMessage::lastUpdateTime(
+        uint64_t _lastUpdateTime)
 {
-    (void) scdr;
-                          
+    m_lastUpdateTime = _lastUpdateTime;
 }
 
-CounterUAS::PredictedTableMessage::PredictedTableMessage()
+/*!
+ * @brief This function returns the value of member lastUpdateTime
+ * @return Value of member lastUpdateTime
+ */
+uint64_t CounterUAS::TrackHandoverMessage::lastUpdateTime() const
 {
-    // m_messageId com.eprosima.idl.parser.typecode.PrimitiveTypeCode@20d3d15a
-    m_messageId = 0;
-    // m_timestamp com.eprosima.idl.parser.typecode.PrimitiveTypeCode@2893de87
-    m_timestamp = 0;
-    // m_numEntries com.eprosima.idl.parser.typecode.PrimitiveTypeCode@55ca8de8
-    m_numEntries = 0;
-    // m_entries com.eprosima.idl.parser.typecode.SequenceTypeCode@2c34f934
-
-
+    return m_lastUpdateTime;
 }
 
-CounterUAS::PredictedTableMessage::~PredictedTableMessage()
+/*!
+ * @brief This function returns a reference to member lastUpdateTime
+ * @return Reference to member lastUpdateTime
+ */
+uint64_t& CounterUAS::TrackHandoverMessage::lastUpdateTime()
 {
-
-
-
+    return m_lastUpdateTime;
 }
 
-CounterUAS::PredictedTableMessage::PredictedTableMessage(
-        const PredictedTableMessage& x)
+/*!
+ * @brief This function sets a value in member quality
+ * @param _quality New value for member quality
+ */
+void CounterUAS::TrackHandoverMessage::quality(
+        double _quality)
 {
-    m_messageId = x.m_messageId;
-    m_timestamp = x.m_timestamp;
-    m_numEntries = x.m_numEntries;
-    m_entries = x.m_entries;
+    m_quality = _quality;
 }
 
-CounterUAS::PredictedTableMessage::PredictedTableMessage(
-        PredictedTableMessage&& x) noexcept 
+/*!
+ * @brief This function returns the value of member quality
+ * @return Value of member quality
+ */
+double CounterUAS::TrackHandoverMessage::quality() const
 {
-    m_messageId = x.m_messageId;
-    m_timestamp = x.m_timestamp;
-    m_numEntries = x.m_numEntries;
-    m_entries = std::move(x.m_entries);
+    return m_quality;
 }
 
-CounterUAS::PredictedTableMessage& CounterUAS::PredictedTableMessage::operator =(
-        const PredictedTableMessage& x)
+/*!
+ * @brief This function returns a reference to member quality
+ * @return Reference to member quality
+ */
+double& CounterUAS::TrackHandoverMessage::quality()
 {
-
-    m_messageId = x.m_messageId;
-    m_timestamp = x.m_timestamp;
-    m_numEntries = x.m_numEntries;
-    m_entries = x.m_entries;
-
-    return *this;
+    return m_quality;
 }
 
-CounterUAS::PredictedTableMessage& CounterUAS::PredictedTableMessage::operator =(
-        PredictedTableMessage&& x) noexcept
+/*!
+ * @brief This function copies the value in member state
+ * @param _state New value to be copied in member state
+ */
+void CounterUAS::TrackHandoverMessage::state(
+        const std::array<double, CounterUAS::HANDOVER_STATE_DIM>& _state)
 {
-
-    m_messageId = x.m_messageId;
-    m_timestamp = x.m_timestamp;
-    m_numEntries = x.m_numEntries;
-    m_entries = std::move(x.m_entries);
-
-    return *this;
+    m_state = _state;
 }
 
-bool CounterUAS::PredictedTableMessage::operator ==(
-        const PredictedTableMessage& x) const
+/*!
+ * @brief This function moves the value in member state
+ * @param _state New value to be moved in member state
+ */
+void CounterUAS::TrackHandoverMessage::state(
+        std::array<double, CounterUAS::HANDOVER_STATE_DIM>&& _state)
 {
-
-    return (m_messageId == x.m_messageId && m_timestamp == x.m_timestamp && m_numEntries == x.m_numEntries && m_entries == x.m_entries);
+    m_state = std::move(_state);
 }
 
-bool CounterUAS::PredictedTableMessage::operator !=(
-        const PredictedTableMessage& x) const
+/*!
+ * @brief This function returns a constant reference to member state
+ * @return Constant reference to member state
+ */
+const std::array<double, CounterUAS::HANDOVER_STATE_DIM>& CounterUAS::TrackHandoverMessage::state() const
 {
-    return !(*this == x);
+    return m_state;
 }
 
-size_t CounterUAS::PredictedTableMessage::getMaxCdrSerializedSize(
-        size_t current_alignment)
+/*!
+ * @brief This function returns a reference to member state
+ * @return Reference to member state
+ */
+std::array<double, CounterUAS::HANDOVER_STATE_DIM>& CounterUAS::TrackHandoverMessage::state()
 {
-    size_t initial_alignment = current_alignment;
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    for(size_t a = 0; a < 100; ++a)
-    {
-        current_alignment += CounterUAS::PredictedEntry::getMaxCdrSerializedSize(current_alignment);}
-
-
-    return current_alignment - initial_alignment;
+    return m_state;
 }
-
-size_t CounterUAS::PredictedTableMessage::getCdrSerializedSize(
-        const CounterUAS::PredictedTableMessage& data,
-        size_t current_alignment)
+/*!
+ * @brief This function copies the value in member covariance
+ * @param _covariance New value to be copied in member covariance
+ */
+void CounterUAS::TrackHandoverMessage::covariance(
+        const std::array<double, CounterUAS::HANDOVER_SYM_DIM>& _covariance)
 {
-    (void)data;
-    size_t initial_alignment = current_alignment;
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 8 + eprosima::fastcdr::Cdr::alignment(current_alignment, 8);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
-
-
-    for(size_t a = 0; a < data.entries().size(); ++a)
-    {
-        current_alignment += CounterUAS::PredictedEntry::getCdrSerializedSize(data.entries().at(a), current_alignment);}
-
-
-    return current_alignment - initial_alignment;
+    m_covariance = _covariance;
 }
 
-void CounterUAS::PredictedTableMessage::serialize(
-        eprosima::fastcdr::Cdr& scdr) const
+/*!
+ * @brief This function moves the value in member covariance
+ * @param _covariance New value to be moved in member covariance
+ */
+void CounterUAS::TrackHandoverMessage::covariance(
+        std::array<double, CounterUAS::HANDOVER_SYM_DIM>&& _covariance)
 {
-
-    scdr << m_messageId;
-    scdr << m_timestamp;
-    scdr << m_numEntries;
-    scdr << m_entries;
-
+    m_covariance = std::move(_covariance);
 }
 
-void CounterUAS::PredictedTableMessage::deserialize(
-        eprosima::fastcdr::Cdr& dcdr)
+/*!
+ * @brief This function returns a constant reference to member covariance
+ * @return Constant reference to member covariance
+ */
+const std::array<double, CounterUAS::HANDOVER_SYM_DIM>& CounterUAS::TrackHandoverMessage::covariance() const
 {
-
-    dcdr >> m_messageId;
-    dcdr >> m_timestamp;
-    dcdr >> m_numEntries;
-    dcdr >> m_entries;
+    return m_covariance;
 }
 
 /*!
- * @brief This function sets a value in member messageId
- * @param _messageId New value for member messageId
+ * @brief This function returns a reference to member covariance
+ * @return Reference to member covariance
  */
-void CounterUAS::PredictedTableMessage::messageId(
-        uint32_t _messageId)
+std::array<double, CounterUAS::HANDOVER_SYM_DIM>& CounterUAS::TrackHandoverMessage::covariance()
 {
-    m_messageId = _messageId;
+    return m_covariance;
 }
-
 /*!
- * @brief This function returns the value of member messageId
- * @return Value of member messageId
+ * @brief This function copies the value in member modeProbabilities
+ * @param _modeProbabilities New value to be copied in member modeProbabilities
  */
-uint32_t CounterUAS::PredictedTableMessage::messageId() const
+void CounterUAS::TrackHandoverMessage::modeProbabilities(
+        const std::array<double, CounterUAS::HANDOVER_NUM_MODELS>& _modeProbabilities)
 {
-    return m_messageId;
+    m_modeProbabilities = _modeProbabilities;
 }
 
 /*!
- * @brief This function returns a reference to member messageId
- * @return Reference to member messageId
+ * @brief This function moves the value in member modeProbabilities
+ * @param _modeProbabilities New value to be moved in member modeProbabilities
  */
-uint32_t& CounterUAS::PredictedTableMessage::messageId()
+void CounterUAS::TrackHandoverMessage::modeProbabilities(
+        std::array<double, CounterUAS::HANDOVER_NUM_MODELS>&& _modeProbabilities)
 {
-    return m_messageId;
+    m_modeProbabilities = std::move(_modeProbabilities);
 }
 
 /*!
- * @brief This function sets a value in member timestamp
- * @param _timestamp New value for member timestamp
+ * @brief This function returns a constant reference to member modeProbabilities
+ * @return Constant reference to member modeProbabilities
  */
-void CounterUAS::PredictedTableMessage::timestamp(
-        uint64_t _timestamp)
+const std::array<double, CounterUAS::HANDOVER_NUM_MODELS>& CounterUAS::TrackHandoverMessage::modeProbabilities() const
 {
-    m_timestamp = _timestamp;
+    return m_modeProbabilities;
 }
 
 /*!
- * @brief This function returns the value of member timestamp
- * @return Value of member timestamp
+ * @brief This function returns a reference to member modeProbabilities
+ * @return Reference to member modeProbabilities
  */
-uint64_t CounterUAS::PredictedTableMessage::timestamp() const
+std::array<double, CounterUAS::HANDOVER_NUM_MODELS>& CounterUAS::TrackHandoverMessage::modeProbabilities()
 {
-    return m_timestamp;
+    return m_modeProbabilities;
 }
-
 /*!
- * @brief This function returns a reference to member timestamp
- * @return Reference to member timestamp
+ * @brief This function copies the value in member modelStates
+ * @param _modelStates New value to be copied in member modelStates
  */
-uint64_t& CounterUAS::PredictedTableMessage::timestamp()
+void CounterUAS::TrackHandoverMessage::modelStates(
+        const std::array<double, CounterUAS::HANDOVER_MODEL_STATES>& _modelStates)
 {
-    return m_timestamp;
+    m_modelStates = _modelStates;
 }
 
 /*!
- * @brief This function sets a value in member numEntries
- * @param _numEntries New value for member numEntries
+ * @brief This function moves the value in member modelStates
+ * @param _modelStates New value to be moved in member modelStates
  */
-void CounterUAS::PredictedTableMessage::numEntries(
-        uint32_t _numEntries)
+void CounterUAS::TrackHandoverMessage::modelStates(
+        std::array<double, CounterUAS::HANDOVER_MODEL_STATES>&& _modelStates)
 {
-    m_numEntries = _numEntries;
+    m_modelStates = std::move(_modelStates);
 }
 
 /*!
- * @brief This function returns the value of member numEntries
- * @return Value of member numEntries
+ * @brief This function returns a constant reference to member modelStates
+ * @return Constant reference to member modelStates
  */
-uint32_t CounterUAS::PredictedTableMessage::numEntries() const
+const std::array<double, CounterUAS::HANDOVER_MODEL_STATES>& CounterUAS::TrackHandoverMessage::modelStates() const
 {
-    return m_numEntries;
+    return m_modelStates;
 }
 
 /*!
- * @brief This function returns a reference to member numEntries
- * @return Reference to member numEntries
+ * @brief This function returns a reference to member modelStates
+ * @return Reference to member modelStates
  */
-uint32_t& CounterUAS::PredictedTableMessage::numEntries()
+std::array<double, CounterUAS::HANDOVER_MODEL_STATES>& CounterUAS::TrackHandoverMessage::modelStates()
 {
-    return m_numEntries;
+    return m_modelStates;
 }
-
 /*!
- * @brief This function copies the value in member entries
- * @param _entries New value to be copied in member entries
+ * @brief This function copies the value in member modelCovariances
+ * @param _modelCovariances New value to be copied in member modelCovariances
  */
-void CounterUAS::PredictedTableMessage::entries(
-        const std::vector<CounterUAS::PredictedEntry>& _entries)
+void CounterUAS::TrackHandoverMessage::modelCovariances(
+        const std::array<double, CounterUAS::HANDOVER_MODEL_COVARIANCES>& _modelCovariances)
 {
-    m_entries = _entries;
+    m_modelCovariances = _modelCovariances;
 }
 
 /*!
- * @brief This function moves the value in member entries
- * @param _entries New value to be moved in member entries
+ * @brief This function moves the value in member modelCovariances
+ * @param _modelCovariances New value to be moved in member modelCovariances
  */
-void CounterUAS::PredictedTableMessage::entries(
-        std::vector<CounterUAS::PredictedEntry>&& _entries)
+void CounterUAS::TrackHandoverMessage::modelCovariances(
+        std::array<double, CounterUAS::HANDOVER_MODEL_COVARIANCES>&& _modelCovariances)
 {
-    m_entries = std::move(_entries);
+    m_modelCovariances = std::move(_modelCovariances);
 }
 
 /*!
- * @brief This function returns a constant reference to member entries
- * @return Constant reference to member entries
+ * @brief This function returns a constant reference to member modelCovariances
+ * @return Constant reference to member modelCovariances
  */
-const std::vector<CounterUAS::PredictedEntry>& CounterUAS::PredictedTableMessage::entries() const
+const std::array<double, CounterUAS::HANDOVER_MODEL_COVARIANCES>& CounterUAS::TrackHandoverMessage::modelCovariances() const
 {
-    return m_entries;
+    return m_modelCovariances;
 }
 
 /*!
- * @brief This function returns a reference to member entries
- * @return Reference to member entries
+ * @brief This function returns a reference to member modelCovariances
+ * @return Reference to member modelCovariances
  */
-std::vector<CounterUAS::PredictedEntry>& CounterUAS::PredictedTableMessage::entries()
+std::array<double, CounterUAS::HANDOVER_MODEL_COVARIANCES>& CounterUAS::TrackHandoverMessage::modelCovariances()
 {
-    return m_entries;
+    return m_modelCovariances;
 }
 
-size_t CounterUAS::PredictedTableMessage::getKeyMaxCdrSerializedSize(
+
+size_t CounterUAS::TrackHandoverMessage::getKeyMaxCdrSerializedSize(
         size_t current_alignment)
 {
     size_t current_align = current_alignment;
@@ -4921,12 +9514,12 @@ size_t CounterUAS::PredictedTableMessage::getKeyMaxCdrSerializedSize(
     return current_align;
 }
 
-bool CounterUAS::PredictedTableMessage::isKeyDefined()
+bool CounterUAS::TrackHandoverMessage::isKeyDefined()
 {
     return false;
 }
 
-void CounterUAS::PredictedTableMessage::serializeKey(
+void CounterUAS::TrackHandoverMessage::serializeKey(
         eprosima::fastcdr::Cdr& scdr) const
 {
     (void) scdr;
@@ -4934,8 +9527,6 @@ void CounterUAS::PredictedTableMessage::serializeKey(
 }
 
 
-
-
 CounterUAS::LogRecordHeader::LogRecordHeader()
 {
     // m_magic com.eprosima.idl.parser.typecode.PrimitiveTypeCode@12d3a4e9
@@ -508,6 +508,26 @@ namespace CounterUAS {
          */
         eProsima_user_DllExport std::vector<CounterUAS::DetectionData>& detections();
 
+        /*!
+         * @brief This function sets a value in member sensorId
+         * @param _sensorId New value for member sensorId
+         */
+        eProsima_user_DllExport void sensorId(
+                uint32_t _sensorId);
+
+        /*!
+         * @brief This function returns the value of member sensorId
+         * @return Value of member sensorId
+         */
+        eProsima_user_DllExport uint32_t sensorId() const;
+
+        /*!
+         * @brief This function returns a reference to member sensorId
+         * @return Reference to member sensorId
+         */
+        eProsima_user_DllExport uint32_t& sensorId();
+
+
         /*!
          * @brief This function returns the maximum serialized size of an object
          * depending on the buffer alignment.
@@ -572,90 +592,68 @@ namespace CounterUAS {
         uint64_t m_timestamp;
         uint32_t m_numDetections;
         std::vector<CounterUAS::DetectionData> m_detections;
+        uint32_t m_sensorId;
     };
-    const uint32_t MSG_ID_TRACK_UPDATE = 0x0002;
-    /*!
-     * @brief This class represents the enumeration TrackStatus defined by the user in the IDL file.
-     * @ingroup MESSAGES
-     */
-    enum TrackStatus : uint32_t
-    {
-        TRACK_TENTATIVE,
-        TRACK_CONFIRMED,
-        TRACK_COASTING,
-        TRACK_DELETED
-    };
-    /*!
-     * @brief This class represents the enumeration TrackClassification defined by the user in the IDL file.
-     * @ingroup MESSAGES
-     */
-    enum TrackClassification : uint32_t
-    {
-        CLASS_UNKNOWN,
-        CLASS_DRONE_ROTARY,
-        CLASS_DRONE_FIXED_WING,
-        CLASS_BIRD,
-        CLASS_CLUTTER
-    };
+    const uint32_t FRAME_MAX_DETECTIONS = 256;
     /*!
-     * @brief This class represents the structure TrackUpdateMessage defined by the user in the IDL file.
+     * @brief This class represents the structure SPDetectionFrame defined by the user in the IDL file.
      * @ingroup MESSAGES
      */
-    class TrackUpdateMessage
+    class SPDetectionFrame
     {
     public:
 
         /*!
          * @brief Default constructor.
          */
-        eProsima_user_DllExport TrackUpdateMessage();
+        eProsima_user_DllExport SPDetectionFrame();
 
         /*!
          * @brief Default destructor.
          */
-        eProsima_user_DllExport ~TrackUpdateMessage();
+        eProsima_user_DllExport ~SPDetectionFrame();
 
         /*!
          * @brief Copy constructor.
-         * @param x Reference to the object CounterUAS::TrackUpdateMessage that will be copied.
+         * @param x Reference to the object CounterUAS::SPDetectionFrame that will be copied.
          */
-        eProsima_user_DllExport TrackUpdateMessage(
-                const TrackUpdateMessage& x);
+        eProsima_user_DllExport SPDetectionFrame(
+                const SPDetectionFrame& x);
 
         /*!
          * @brief Move constructor.
-         * @param x Reference to the object CounterUAS::TrackUpdateMessage that will be copied.
+         * @param x Reference to the object CounterUAS::SPDetectionFrame that will be copied.
          */
-        eProsima_user_DllExport TrackUpdateMessage(
-                TrackUpdateMessage&& x) noexcept;
+        eProsima_user_DllExport SPDetectionFrame(
+                SPDetectionFrame&& x) noexcept;
 
         /*!
          * @brief Copy assignment.
-         * @param x Reference to the object CounterUAS::TrackUpdateMessage that will be copied.
+         * @param x Reference to the object CounterUAS::SPDetectionFrame that will be copied.
          */
-        eProsima_user_DllExport TrackUpdateMessage& operator =(
-                const TrackUpdateMessage& x);
+        eProsima_user_DllExport SPDetectionFrame& operator =(
+                const SPDetectionFrame& x);
 
         /*!
          * @brief Move assignment.
-         * @param x Reference to the object CounterUAS::TrackUpdateMessage that will be copied.
+         * @param x Reference to the object CounterUAS::SPDetectionFrame that will be copied.
          */
-        eProsima_user_DllExport TrackUpdateMessage& operator =(
-                TrackUpdateMessage&& x) noexcept;
+        eProsima_user_DllExport SPDetectionFrame& operator =(
+                SPDetectionFrame&& x) noexcept;
 
         /*!
          * @brief Comparison operator.
-         * @param x CounterUAS::TrackUpdateMessage object to compare.
+         * @param x CounterUAS::SPDetectionFrame object to compare.
          */
         eProsima_user_DllExport bool operator ==(
-                const TrackUpdateMessage& x) const;
+                const SPDetectionFrame& x) const;
 
         /*!
          * @brief Comparison operator.
-         * @param x CounterUAS::TrackUpdateMessage object to compare.
+         * @param x CounterUAS::SPDetectionFrame object to compare.
          */
         eProsima_user_DllExport bool operator !=(
-                const TrackUpdateMessage& x) const;
+                const SPDetectionFrame& x) const;
 
         /*!
          * @brief This function sets a value in member messageId
@@ -677,23 +675,23 @@ namespace CounterUAS {
         eProsima_user_DllExport uint32_t& messageId();
 
         /*!
-         * @brief This function sets a value in member trackId
-         * @param _trackId New value for member trackId
+         * @brief This function sets a value in member dwellCount
+         * @param _dwellCount New value for member dwellCount
          */
-        eProsima_user_DllExport void trackId(
-                uint32_t _trackId);
+        eProsima_user_DllExport void dwellCount(
+                uint32_t _dwellCount);
 
         /*!
-         * @brief This function returns the value of member trackId
-         * @return Value of member trackId
+         * @brief This function returns the value of member dwellCount
+         * @return Value of member dwellCount
          */
-        eProsima_user_DllExport uint32_t trackId() const;
+        eProsima_user_DllExport uint32_t dwellCount() const;
 
         /*!
-         * @brief This function returns a reference to member trackId
-         * @return Reference to member trackId
+         * @brief This function returns a reference to member dwellCount
+         * @return Reference to member dwellCount
          */
-        eProsima_user_DllExport uint32_t& trackId();
+        eProsima_user_DllExport uint32_t& dwellCount();
 
         /*!
          * @brief This function sets a value in member timestamp
@@ -715,308 +713,333 @@ namespace CounterUAS {
         eProsima_user_DllExport uint64_t& timestamp();
 
         /*!
-         * @brief This function sets a value in member status
-         * @param _status New value for member status
+         * @brief This function sets a value in member numDetections
+         * @param _numDetections New value for member numDetections
          */
-        eProsima_user_DllExport void status(
-                CounterUAS::TrackStatus _status);
+        eProsima_user_DllExport void numDetections(
+                uint32_t _numDetections);
 
         /*!
-         * @brief This function returns the value of member status
-         * @return Value of member status
+         * @brief This function returns the value of member numDetections
+         * @return Value of member numDetections
          */
-        eProsima_user_DllExport CounterUAS::TrackStatus status() const;
+        eProsima_user_DllExport uint32_t numDetections() const;
 
         /*!
-         * @brief This function returns a reference to member status
-         * @return Reference to member status
+         * @brief This function returns a reference to member numDetections
+         * @return Reference to member numDetections
          */
-        eProsima_user_DllExport CounterUAS::TrackStatus& status();
+        eProsima_user_DllExport uint32_t& numDetections();
 
         /*!
-         * @brief This function sets a value in member classification
-         * @param _classification New value for member classification
+         * @brief This function sets a value in member sensorId
+         * @param _sensorId New value for member sensorId
          */
-        eProsima_user_DllExport void classification(
-                CounterUAS::TrackClassification _classification);
+        eProsima_user_DllExport void sensorId(
+                uint32_t _sensorId);
 
         /*!
-         * @brief This function returns the value of member classification
-         * @return Value of member classification
+         * @brief This function returns the value of member sensorId
+         * @return Value of member sensorId
          */
-        eProsima_user_DllExport CounterUAS::TrackClassification classification() const;
+        eProsima_user_DllExport uint32_t sensorId() const;
 
         /*!
-         * @brief This function returns a reference to member classification
-         * @return Reference to member classification
+         * @brief This function returns a reference to member sensorId
+         * @return Reference to member sensorId
          */
-        eProsima_user_DllExport CounterUAS::TrackClassification& classification();
+        eProsima_user_DllExport uint32_t& sensorId();
 
         /*!
-         * @brief This function sets a value in member range
-         * @param _range New value for member range
+         * @brief This function copies the value in member detections
+         * @param _detections New value to be copied in member detections
          */
-        eProsima_user_DllExport void range(
-                double _range);
+        eProsima_user_DllExport void detections(
+                const std::array<CounterUAS::DetectionData, CounterUAS::FRAME_MAX_DETECTIONS>& _detections);
 
         /*!
-         * @brief This function returns the value of member range
-         * @return Value of member range
+         * @brief This function moves the value in member detections
+         * @param _detections New value to be moved in member detections
          */
-        eProsima_user_DllExport double range() const;
+        eProsima_user_DllExport void detections(
+                std::array<CounterUAS::DetectionData, CounterUAS::FRAME_MAX_DETECTIONS>&& _detections);
 
         /*!
-         * @brief This function returns a reference to member range
-         * @return Reference to member range
+         * @brief This function returns a constant reference to member detections
+         * @return Constant reference to member detections
          */
-        eProsima_user_DllExport double& range();
+        eProsima_user_DllExport const std::array<CounterUAS::DetectionData, CounterUAS::FRAME_MAX_DETECTIONS>& detections() const;
 
         /*!
-         * @brief This function sets a value in member azimuth
-         * @param _azimuth New value for member azimuth
+         * @brief This function returns a reference to member detections
+         * @return Reference to member detections
          */
-        eProsima_user_DllExport void azimuth(
-                double _azimuth);
+        eProsima_user_DllExport std::array<CounterUAS::DetectionData, CounterUAS::FRAME_MAX_DETECTIONS>& detections();
+
 
         /*!
-         * @brief This function returns the value of member azimuth
-         * @return Value of member azimuth
+         * @brief This function returns the maximum serialized size of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
          */
-        eProsima_user_DllExport double azimuth() const;
+        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                size_t current_alignment = 0);
 
         /*!
-         * @brief This function returns a reference to member azimuth
-         * @return Reference to member azimuth
+         * @brief This function returns the serialized size of a data depending on the buffer alignment.
+         * @param data Data which is calculated its serialized size.
+         * @param current_alignment Buffer alignment.
+         * @return Serialized size.
          */
-        eProsima_user_DllExport double& azimuth();
+        eProsima_user_DllExport static size_t getCdrSerializedSize(
+                const CounterUAS::SPDetectionFrame& data,
+                size_t current_alignment = 0);
+
 
         /*!
-         * @brief This function sets a value in member elevation
-         * @param _elevation New value for member elevation
+         * @brief This function serializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
          */
-        eProsima_user_DllExport void elevation(
-                double _elevation);
+        eProsima_user_DllExport void serialize(
+                eprosima::fastcdr::Cdr& cdr) const;
 
         /*!
-         * @brief This function returns the value of member elevation
-         * @return Value of member elevation
+         * @brief This function deserializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
          */
-        eProsima_user_DllExport double elevation() const;
+        eProsima_user_DllExport void deserialize(
+                eprosima::fastcdr::Cdr& cdr);
+
+
 
         /*!
-         * @brief This function returns a reference to member elevation
-         * @return Reference to member elevation
+         * @brief This function returns the maximum serialized size of the Key of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
          */
-        eProsima_user_DllExport double& elevation();
+        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                size_t current_alignment = 0);
 
         /*!
-         * @brief This function sets a value in member rangeRate
-         * @param _rangeRate New value for member rangeRate
+         * @brief This function tells you if the Key has been defined for this type
          */
-        eProsima_user_DllExport void rangeRate(
-                double _rangeRate);
+        eProsima_user_DllExport static bool isKeyDefined();
 
         /*!
-         * @brief This function returns the value of member rangeRate
-         * @return Value of member rangeRate
+         * @brief This function serializes the key members of an object using CDR serialization.
+         * @param cdr CDR serialization object.
          */
-        eProsima_user_DllExport double rangeRate() const;
+        eProsima_user_DllExport void serializeKey(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+    private:
+
+        uint32_t m_messageId;
+        uint32_t m_dwellCount;
+        uint64_t m_timestamp;
+        uint32_t m_numDetections;
+        uint32_t m_sensorId;
+        std::array<CounterUAS::DetectionData, CounterUAS::FRAME_MAX_DETECTIONS> m_detections;
+    };
+    const uint32_t MSG_ID_TRACK_UPDATE = 0x0002;
+    /*!
+     * @brief This class represents the enumeration TrackStatus defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    enum TrackStatus : uint32_t
+    {
+        TRACK_TENTATIVE,
+        TRACK_CONFIRMED,
+        TRACK_COASTING,
+        TRACK_DELETED
+    };
+    /*!
+     * @brief This class represents the enumeration TrackClassification defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    enum TrackClassification : uint32_t
+    {
+        CLASS_UNKNOWN,
+        CLASS_DRONE_ROTARY,
+        CLASS_DRONE_FIXED_WING,
+        CLASS_BIRD,
+        CLASS_CLUTTER
+    };
+    /*!
+     * @brief This class represents the structure LatencyTrace defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class LatencyTrace
+    {
+    public:
 
         /*!
-         * @brief This function returns a reference to member rangeRate
-         * @return Reference to member rangeRate
+         * @brief Default constructor.
          */
-        eProsima_user_DllExport double& rangeRate();
+        eProsima_user_DllExport LatencyTrace();
 
         /*!
-         * @brief This function sets a value in member x
-         * @param _x New value for member x
+         * @brief Default destructor.
          */
-        eProsima_user_DllExport void x(
-                double _x);
+        eProsima_user_DllExport ~LatencyTrace();
 
         /*!
-         * @brief This function returns the value of member x
-         * @return Value of member x
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::LatencyTrace that will be copied.
          */
-        eProsima_user_DllExport double x() const;
+        eProsima_user_DllExport LatencyTrace(
+                const LatencyTrace& x);
 
         /*!
-         * @brief This function returns a reference to member x
-         * @return Reference to member x
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::LatencyTrace that will be copied.
          */
-        eProsima_user_DllExport double& x();
+        eProsima_user_DllExport LatencyTrace(
+                LatencyTrace&& x) noexcept;
 
         /*!
-         * @brief This function sets a value in member y
-         * @param _y New value for member y
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::LatencyTrace that will be copied.
          */
-        eProsima_user_DllExport void y(
-                double _y);
+        eProsima_user_DllExport LatencyTrace& operator =(
+                const LatencyTrace& x);
 
         /*!
-         * @brief This function returns the value of member y
-         * @return Value of member y
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::LatencyTrace that will be copied.
          */
-        eProsima_user_DllExport double y() const;
+        eProsima_user_DllExport LatencyTrace& operator =(
+                LatencyTrace&& x) noexcept;
 
         /*!
-         * @brief This function returns a reference to member y
-         * @return Reference to member y
+         * @brief Comparison operator.
+         * @param x CounterUAS::LatencyTrace object to compare.
          */
-        eProsima_user_DllExport double& y();
+        eProsima_user_DllExport bool operator ==(
+                const LatencyTrace& x) const;
 
         /*!
-         * @brief This function sets a value in member z
-         * @param _z New value for member z
-         */
-        eProsima_user_DllExport void z(
-                double _z);
-
-        /*!
-         * @brief This function returns the value of member z
-         * @return Value of member z
-         */
-        eProsima_user_DllExport double z() const;
-
-        /*!
-         * @brief This function returns a reference to member z
-         * @return Reference to member z
-         */
-        eProsima_user_DllExport double& z();
-
-        /*!
-         * @brief This function sets a value in member vx
-         * @param _vx New value for member vx
-         */
-        eProsima_user_DllExport void vx(
-                double _vx);
-
-        /*!
-         * @brief This function returns the value of member vx
-         * @return Value of member vx
-         */
-        eProsima_user_DllExport double vx() const;
-
-        /*!
-         * @brief This function returns a reference to member vx
-         * @return Reference to member vx
+         * @brief Comparison operator.
+         * @param x CounterUAS::LatencyTrace object to compare.
          */
-        eProsima_user_DllExport double& vx();
+        eProsima_user_DllExport bool operator !=(
+                const LatencyTrace& x) const;
 
         /*!
-         * @brief This function sets a value in member vy
-         * @param _vy New value for member vy
+         * @brief This function sets a value in member dwellCount
+         * @param _dwellCount New value for member dwellCount
          */
-        eProsima_user_DllExport void vy(
-                double _vy);
+        eProsima_user_DllExport void dwellCount(
+                uint32_t _dwellCount);
 
         /*!
-         * @brief This function returns the value of member vy
-         * @return Value of member vy
+         * @brief This function returns the value of member dwellCount
+         * @return Value of member dwellCount
          */
-        eProsima_user_DllExport double vy() const;
+        eProsima_user_DllExport uint32_t dwellCount() const;
 
         /*!
-         * @brief This function returns a reference to member vy
-         * @return Reference to member vy
+         * @brief This function returns a reference to member dwellCount
+         * @return Reference to member dwellCount
          */
-        eProsima_user_DllExport double& vy();
+        eProsima_user_DllExport uint32_t& dwellCount();
 
         /*!
-         * @brief This function sets a value in member vz
-         * @param _vz New value for member vz
+         * @brief This function sets a value in member sensorTime
+         * @param _sensorTime New value for member sensorTime
          */
-        eProsima_user_DllExport void vz(
-                double _vz);
+        eProsima_user_DllExport void sensorTime(
+                uint64_t _sensorTime);
 
         /*!
-         * @brief This function returns the value of member vz
-         * @return Value of member vz
+         * @brief This function returns the value of member sensorTime
+         * @return Value of member sensorTime
          */
-        eProsima_user_DllExport double vz() const;
+        eProsima_user_DllExport uint64_t sensorTime() const;
 
         /*!
-         * @brief This function returns a reference to member vz
-         * @return Reference to member vz
+         * @brief This function returns a reference to member sensorTime
+         * @return Reference to member sensorTime
          */
-        eProsima_user_DllExport double& vz();
+        eProsima_user_DllExport uint64_t& sensorTime();
 
         /*!
-         * @brief This function sets a value in member trackQuality
-         * @param _trackQuality New value for member trackQuality
+         * @brief This function sets a value in member receiveTime
+         * @param _receiveTime New value for member receiveTime
          */
-        eProsima_user_DllExport void trackQuality(
-                double _trackQuality);
+        eProsima_user_DllExport void receiveTime(
+                uint64_t _receiveTime);
 
         /*!
-         * @brief This function returns the value of member trackQuality
-         * @return Value of member trackQuality
+         * @brief This function returns the value of member receiveTime
+         * @return Value of member receiveTime
          */
-        eProsima_user_DllExport double trackQuality() const;
+        eProsima_user_DllExport uint64_t receiveTime() const;
 
         /*!
-         * @brief This function returns a reference to member trackQuality
-         * @return Reference to member trackQuality
+         * @brief This function returns a reference to member receiveTime
+         * @return Reference to member receiveTime
          */
-        eProsima_user_DllExport double& trackQuality();
+        eProsima_user_DllExport uint64_t& receiveTime();
 
         /*!
-         * @brief This function sets a value in member hitCount
-         * @param _hitCount New value for member hitCount
+         * @brief This function sets a value in member dequeueTime
+         * @param _dequeueTime New value for member dequeueTime
          */
-        eProsima_user_DllExport void hitCount(
-                uint32_t _hitCount);
+        eProsima_user_DllExport void dequeueTime(
+                uint64_t _dequeueTime);
 
         /*!
-         * @brief This function returns the value of member hitCount
-         * @return Value of member hitCount
+         * @brief This function returns the value of member dequeueTime
+         * @return Value of member dequeueTime
          */
-        eProsima_user_DllExport uint32_t hitCount() const;
+        eProsima_user_DllExport uint64_t dequeueTime() const;
 
         /*!
-         * @brief This function returns a reference to member hitCount
-         * @return Reference to member hitCount
+         * @brief This function returns a reference to member dequeueTime
+         * @return Reference to member dequeueTime
          */
-        eProsima_user_DllExport uint32_t& hitCount();
+        eProsima_user_DllExport uint64_t& dequeueTime();
 
         /*!
-         * @brief This function sets a value in member missCount
-         * @param _missCount New value for member missCount
+         * @brief This function sets a value in member processedTime
+         * @param _processedTime New value for member processedTime
          */
-        eProsima_user_DllExport void missCount(
-                uint32_t _missCount);
+        eProsima_user_DllExport void processedTime(
+                uint64_t _processedTime);
 
         /*!
-         * @brief This function returns the value of member missCount
-         * @return Value of member missCount
+         * @brief This function returns the value of member processedTime
+         * @return Value of member processedTime
          */
-        eProsima_user_DllExport uint32_t missCount() const;
+        eProsima_user_DllExport uint64_t processedTime() const;
 
         /*!
-         * @brief This function returns a reference to member missCount
-         * @return Reference to member missCount
+         * @brief This function returns a reference to member processedTime
+         * @return Reference to member processedTime
          */
-        eProsima_user_DllExport uint32_t& missCount();
+        eProsima_user_DllExport uint64_t& processedTime();
 
         /*!
-         * @brief This function sets a value in member age
-         * @param _age New value for member age
+         * @brief This function sets a value in member publishTime
+         * @param _publishTime New value for member publishTime
          */
-        eProsima_user_DllExport void age(
-                uint32_t _age);
+        eProsima_user_DllExport void publishTime(
+                uint64_t _publishTime);
 
         /*!
-         * @brief This function returns the value of member age
-         * @return Value of member age
+         * @brief This function returns the value of member publishTime
+         * @return Value of member publishTime
          */
-        eProsima_user_DllExport uint32_t age() const;
+        eProsima_user_DllExport uint64_t publishTime() const;
 
         /*!
-         * @brief This function returns a reference to member age
-         * @return Reference to member age
+         * @brief This function returns a reference to member publishTime
+         * @return Reference to member publishTime
          */
-        eProsima_user_DllExport uint32_t& age();
+        eProsima_user_DllExport uint64_t& publishTime();
 
 
         /*!
@@ -1035,7 +1058,7 @@ namespace CounterUAS {
          * @return Serialized size.
          */
         eProsima_user_DllExport static size_t getCdrSerializedSize(
-                const CounterUAS::TrackUpdateMessage& data,
+                const CounterUAS::LatencyTrace& data,
                 size_t current_alignment = 0);
 
 
@@ -1078,86 +1101,72 @@ namespace CounterUAS {
 
     private:
 
-        uint32_t m_messageId;
-        uint32_t m_trackId;
-        uint64_t m_timestamp;
-        CounterUAS::TrackStatus m_status;
-        CounterUAS::TrackClassification m_classification;
-        double m_range;
-        double m_azimuth;
-        double m_elevation;
-        double m_rangeRate;
-        double m_x;
-        double m_y;
-        double m_z;
-        double m_vx;
-        double m_vy;
-        double m_vz;
-        double m_trackQuality;
-        uint32_t m_hitCount;
-        uint32_t m_missCount;
-        uint32_t m_age;
+        uint32_t m_dwellCount;
+        uint64_t m_sensorTime;
+        uint64_t m_receiveTime;
+        uint64_t m_dequeueTime;
+        uint64_t m_processedTime;
+        uint64_t m_publishTime;
     };
-    const uint32_t MSG_ID_TRACK_TABLE = 0x0003;
     /*!
-     * @brief This class represents the structure TrackTableMessage defined by the user in the IDL file.
+     * @brief This class represents the structure TrackUpdateMessage defined by the user in the IDL file.
      * @ingroup MESSAGES
      */
-    class TrackTableMessage
+    class TrackUpdateMessage
     {
     public:
 
         /*!
          * @brief Default constructor.
          */
-        eProsima_user_DllExport TrackTableMessage();
+        eProsima_user_DllExport TrackUpdateMessage();
 
         /*!
          * @brief Default destructor.
          */
-        eProsima_user_DllExport ~TrackTableMessage();
+        eProsima_user_DllExport ~TrackUpdateMessage();
 
         /*!
          * @brief Copy constructor.
-         * @param x Reference to the object CounterUAS::TrackTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::TrackUpdateMessage that will be copied.
          */
-        eProsima_user_DllExport TrackTableMessage(
-                const TrackTableMessage& x);
+        eProsima_user_DllExport TrackUpdateMessage(
+                const TrackUpdateMessage& x);
 
         /*!
          * @brief Move constructor.
-         * @param x Reference to the object CounterUAS::TrackTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::TrackUpdateMessage that will be copied.
          */
-        eProsima_user_DllExport TrackTableMessage(
-                TrackTableMessage&& x) noexcept;
+        eProsima_user_DllExport TrackUpdateMessage(
+                TrackUpdateMessage&& x) noexcept;
 
         /*!
          * @brief Copy assignment.
-         * @param x Reference to the object CounterUAS::TrackTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::TrackUpdateMessage that will be copied.
          */
-        eProsima_user_DllExport TrackTableMessage& operator =(
-                const TrackTableMessage& x);
+        eProsima_user_DllExport TrackUpdateMessage& operator =(
+                const TrackUpdateMessage& x);
 
         /*!
          * @brief Move assignment.
-         * @param x Reference to the object CounterUAS::TrackTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::TrackUpdateMessage that will be copied.
          */
-        eProsima_user_DllExport TrackTableMessage& operator =(
-                TrackTableMessage&& x) noexcept;
+        eProsima_user_DllExport TrackUpdateMessage& operator =(
+                TrackUpdateMessage&& x) noexcept;
 
         /*!
          * @brief Comparison operator.
-         * @param x CounterUAS::TrackTableMessage object to compare.
+         * @param x CounterUAS::TrackUpdateMessage object to compare.
          */
         eProsima_user_DllExport bool operator ==(
-                const TrackTableMessage& x) const;
+                const TrackUpdateMessage& x) const;
 
         /*!
          * @brief Comparison operator.
-         * @param x CounterUAS::TrackTableMessage object to compare.
+         * @param x CounterUAS::TrackUpdateMessage object to compare.
          */
         eProsima_user_DllExport bool operator !=(
-                const TrackTableMessage& x) const;
+                const TrackUpdateMessage& x) const;
 
         /*!
          * @brief This function sets a value in member messageId
@@ -1178,6 +1187,25 @@ namespace CounterUAS {
          */
         eProsima_user_DllExport uint32_t& messageId();
 
+        /*!
+         * @brief This function sets a value in member trackId
+         * @param _trackId New value for member trackId
+         */
+        eProsima_user_DllExport void trackId(
+                uint32_t _trackId);
+
+        /*!
+         * @brief This function returns the value of member trackId
+         * @return Value of member trackId
+         */
+        eProsima_user_DllExport uint32_t trackId() const;
+
+        /*!
+         * @brief This function returns a reference to member trackId
+         * @return Reference to member trackId
+         */
+        eProsima_user_DllExport uint32_t& trackId();
+
         /*!
          * @brief This function sets a value in member timestamp
          * @param _timestamp New value for member timestamp
@@ -1198,212 +1226,2696 @@ namespace CounterUAS {
         eProsima_user_DllExport uint64_t& timestamp();
 
         /*!
-         * @brief This function sets a value in member numTracks
-         * @param _numTracks New value for member numTracks
+         * @brief This function sets a value in member status
+         * @param _status New value for member status
          */
-        eProsima_user_DllExport void numTracks(
-                uint32_t _numTracks);
+        eProsima_user_DllExport void status(
+                CounterUAS::TrackStatus _status);
 
         /*!
-         * @brief This function returns the value of member numTracks
-         * @return Value of member numTracks
+         * @brief This function returns the value of member status
+         * @return Value of member status
          */
-        eProsima_user_DllExport uint32_t numTracks() const;
+        eProsima_user_DllExport CounterUAS::TrackStatus status() const;
 
         /*!
-         * @brief This function returns a reference to member numTracks
-         * @return Reference to member numTracks
+         * @brief This function returns a reference to member status
+         * @return Reference to member status
          */
-        eProsima_user_DllExport uint32_t& numTracks();
+        eProsima_user_DllExport CounterUAS::TrackStatus& status();
 
         /*!
-         * @brief This function copies the value in member tracks
-         * @param _tracks New value to be copied in member tracks
+         * @brief This function sets a value in member classification
+         * @param _classification New value for member classification
          */
-        eProsima_user_DllExport void tracks(
-                const std::vector<CounterUAS::TrackUpdateMessage>& _tracks);
+        eProsima_user_DllExport void classification(
+                CounterUAS::TrackClassification _classification);
 
         /*!
-         * @brief This function moves the value in member tracks
-         * @param _tracks New value to be moved in member tracks
+         * @brief This function returns the value of member classification
+         * @return Value of member classification
          */
-        eProsima_user_DllExport void tracks(
-                std::vector<CounterUAS::TrackUpdateMessage>&& _tracks);
+        eProsima_user_DllExport CounterUAS::TrackClassification classification() const;
 
         /*!
-         * @brief This function returns a constant reference to member tracks
-         * @return Constant reference to member tracks
+         * @brief This function returns a reference to member classification
+         * @return Reference to member classification
          */
-        eProsima_user_DllExport const std::vector<CounterUAS::TrackUpdateMessage>& tracks() const;
+        eProsima_user_DllExport CounterUAS::TrackClassification& classification();
 
         /*!
-         * @brief This function returns a reference to member tracks
-         * @return Reference to member tracks
+         * @brief This function sets a value in member range
+         * @param _range New value for member range
          */
-        eProsima_user_DllExport std::vector<CounterUAS::TrackUpdateMessage>& tracks();
+        eProsima_user_DllExport void range(
+                double _range);
 
         /*!
-         * @brief This function returns the maximum serialized size of an object
-         * depending on the buffer alignment.
-         * @param current_alignment Buffer alignment.
-         * @return Maximum serialized size.
+         * @brief This function returns the value of member range
+         * @return Value of member range
          */
-        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
-                size_t current_alignment = 0);
+        eProsima_user_DllExport double range() const;
 
         /*!
-         * @brief This function returns the serialized size of a data depending on the buffer alignment.
-         * @param data Data which is calculated its serialized size.
-         * @param current_alignment Buffer alignment.
-         * @return Serialized size.
+         * @brief This function returns a reference to member range
+         * @return Reference to member range
          */
-        eProsima_user_DllExport static size_t getCdrSerializedSize(
-                const CounterUAS::TrackTableMessage& data,
-                size_t current_alignment = 0);
-
+        eProsima_user_DllExport double& range();
 
         /*!
-         * @brief This function serializes an object using CDR serialization.
+         * @brief This function sets a value in member azimuth
+         * @param _azimuth New value for member azimuth
+         */
+        eProsima_user_DllExport void azimuth(
+                double _azimuth);
+
+        /*!
+         * @brief This function returns the value of member azimuth
+         * @return Value of member azimuth
+         */
+        eProsima_user_DllExport double azimuth() const;
+
+        /*!
+         * @brief This function returns a reference to member azimuth
+         * @return Reference to member azimuth
+         */
+        eProsima_user_DllExport double& azimuth();
+
+        /*!
+         * @brief This function sets a value in member elevation
+         * @param _elevation New value for member elevation
+         */
+        eProsima_user_DllExport void elevation(
+                double _elevation);
+
+        /*!
+         * @brief This function returns the value of member elevation
+         * @return Value of member elevation
+         */
+        eProsima_user_DllExport double elevation() const;
+
+        /*!
+         * @brief This function returns a reference to member elevation
+         * @return Reference to member elevation
+         */
+        eProsima_user_DllExport double& elevation();
+
+        /*!
+         * @brief This function sets a value in member rangeRate
+         * @param _rangeRate New value for member rangeRate
+         */
+        eProsima_user_DllExport void rangeRate(
+                double _rangeRate);
+
+        /*!
+         * @brief This function returns the value of member rangeRate
+         * @return Value of member rangeRate
+         */
+        eProsima_user_DllExport double rangeRate() const;
+
+        /*!
+         * @brief This function returns a reference to member rangeRate
+         * @return Reference to member rangeRate
+         */
+        eProsima_user_DllExport double& rangeRate();
+
+        /*!
+         * @brief This function sets a value in member x
+         * @param _x New value for member x
+         */
+        eProsima_user_DllExport void x(
+                double _x);
+
+        /*!
+         * @brief This function returns the value of member x
+         * @return Value of member x
+         */
+        eProsima_user_DllExport double x() const;
+
+        /*!
+         * @brief This function returns a reference to member x
+         * @return Reference to member x
+         */
+        eProsima_user_DllExport double& x();
+
+        /*!
+         * @brief This function sets a value in member y
+         * @param _y New value for member y
+         */
+        eProsima_user_DllExport void y(
+                double _y);
+
+        /*!
+         * @brief This function returns the value of member y
+         * @return Value of member y
+         */
+        eProsima_user_DllExport double y() const;
+
+        /*!
+         * @brief This function returns a reference to member y
+         * @return Reference to member y
+         */
+        eProsima_user_DllExport double& y();
+
+        /*!
+         * @brief This function sets a value in member z
+         * @param _z New value for member z
+         */
+        eProsima_user_DllExport void z(
+                double _z);
+
+        /*!
+         * @brief This function returns the value of member z
+         * @return Value of member z
+         */
+        eProsima_user_DllExport double z() const;
+
+        /*!
+         * @brief This function returns a reference to member z
+         * @return Reference to member z
+         */
+        eProsima_user_DllExport double& z();
+
+        /*!
+         * @brief This function sets a value in member vx
+         * @param _vx New value for member vx
+         */
+        eProsima_user_DllExport void vx(
+                double _vx);
+
+        /*!
+         * @brief This function returns the value of member vx
+         * @return Value of member vx
+         */
+        eProsima_user_DllExport double vx() const;
+
+        /*!
+         * @brief This function returns a reference to member vx
+         * @return Reference to member vx
+         */
+        eProsima_user_DllExport double& vx();
+
+        /*!
+         * @brief This function sets a value in member vy
+         * @param _vy New value for member vy
+         */
+        eProsima_user_DllExport void vy(
+                double _vy);
+
+        /*!
+         * @brief This function returns the value of member vy
+         * @return Value of member vy
+         */
+        eProsima_user_DllExport double vy() const;
+
+        /*!
+         * @brief This function returns a reference to member vy
+         * @return Reference to member vy
+         */
+        eProsima_user_DllExport double& vy();
+
+        /*!
+         * @brief This function sets a value in member vz
+         * @param _vz New value for member vz
+         */
+        eProsima_user_DllExport void vz(
+                double _vz);
+
+        /*!
+         * @brief This function returns the value of member vz
+         * @return Value of member vz
+         */
+        eProsima_user_DllExport double vz() const;
+
+        /*!
+         * @brief This function returns a reference to member vz
+         * @return Reference to member vz
+         */
+        eProsima_user_DllExport double& vz();
+
+        /*!
+         * @brief This function sets a value in member trackQuality
+         * @param _trackQuality New value for member trackQuality
+         */
+        eProsima_user_DllExport void trackQuality(
+                double _trackQuality);
+
+        /*!
+         * @brief This function returns the value of member trackQuality
+         * @return Value of member trackQuality
+         */
+        eProsima_user_DllExport double trackQuality() const;
+
+        /*!
+         * @brief This function returns a reference to member trackQuality
+         * @return Reference to member trackQuality
+         */
+        eProsima_user_DllExport double& trackQuality();
+
+        /*!
+         * @brief This function sets a value in member hitCount
+         * @param _hitCount New value for member hitCount
+         */
+        eProsima_user_DllExport void hitCount(
+                uint32_t _hitCount);
+
+        /*!
+         * @brief This function returns the value of member hitCount
+         * @return Value of member hitCount
+         */
+        eProsima_user_DllExport uint32_t hitCount() const;
+
+        /*!
+         * @brief This function returns a reference to member hitCount
+         * @return Reference to member hitCount
+         */
+        eProsima_user_DllExport uint32_t& hitCount();
+
+        /*!
+         * @brief This function sets a value in member missCount
+         * @param _missCount New value for member missCount
+         */
+        eProsima_user_DllExport void missCount(
+                uint32_t _missCount);
+
+        /*!
+         * @brief This function returns the value of member missCount
+         * @return Value of member missCount
+         */
+        eProsima_user_DllExport uint32_t missCount() const;
+
+        /*!
+         * @brief This function returns a reference to member missCount
+         * @return Reference to member missCount
+         */
+        eProsima_user_DllExport uint32_t& missCount();
+
+        /*!
+         * @brief This function sets a value in member age
+         * @param _age New value for member age
+         */
+        eProsima_user_DllExport void age(
+                uint32_t _age);
+
+        /*!
+         * @brief This function returns the value of member age
+         * @return Value of member age
+         */
+        eProsima_user_DllExport uint32_t age() const;
+
+        /*!
+         * @brief This function returns a reference to member age
+         * @return Reference to member age
+         */
+        eProsima_user_DllExport uint32_t& age();
+
+        /*!
+         * @brief This function copies the value in member trace
+         * @param _trace New value to be copied in member trace
+         */
+        eProsima_user_DllExport void trace(
+                const CounterUAS::LatencyTrace& _trace);
+
+        /*!
+         * @brief This function moves the value in member trace
+         * @param _trace New value to be moved in member trace
+         */
+        eProsima_user_DllExport void trace(
+                CounterUAS::LatencyTrace&& _trace);
+
+        /*!
+         * @brief This function returns a constant reference to member trace
+         * @return Constant reference to member trace
+         */
+        eProsima_user_DllExport const CounterUAS::LatencyTrace& trace() const;
+
+        /*!
+         * @brief This function returns a reference to member trace
+         * @return Reference to member trace
+         */
+        eProsima_user_DllExport CounterUAS::LatencyTrace& trace();
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function returns the serialized size of a data depending on the buffer alignment.
+         * @param data Data which is calculated its serialized size.
+         * @param current_alignment Buffer alignment.
+         * @return Serialized size.
+         */
+        eProsima_user_DllExport static size_t getCdrSerializedSize(
+                const CounterUAS::TrackUpdateMessage& data,
+                size_t current_alignment = 0);
+
+
+        /*!
+         * @brief This function serializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serialize(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+        /*!
+         * @brief This function deserializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void deserialize(
+                eprosima::fastcdr::Cdr& cdr);
+
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of the Key of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function tells you if the Key has been defined for this type
+         */
+        eProsima_user_DllExport static bool isKeyDefined();
+
+        /*!
+         * @brief This function serializes the key members of an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serializeKey(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+    private:
+
+        uint32_t m_messageId;
+        uint32_t m_trackId;
+        uint64_t m_timestamp;
+        CounterUAS::TrackStatus m_status;
+        CounterUAS::TrackClassification m_classification;
+        double m_range;
+        double m_azimuth;
+        double m_elevation;
+        double m_rangeRate;
+        double m_x;
+        double m_y;
+        double m_z;
+        double m_vx;
+        double m_vy;
+        double m_vz;
+        double m_trackQuality;
+        uint32_t m_hitCount;
+        uint32_t m_missCount;
+        uint32_t m_age;
+        CounterUAS::LatencyTrace m_trace;
+    };
+    const uint32_t MSG_ID_TRACK_TABLE = 0x0003;
+    /*!
+     * @brief This class represents the structure TrackTableMessage defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class TrackTableMessage
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport TrackTableMessage();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~TrackTableMessage();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::TrackTableMessage that will be copied.
+         */
+        eProsima_user_DllExport TrackTableMessage(
+                const TrackTableMessage& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::TrackTableMessage that will be copied.
+         */
+        eProsima_user_DllExport TrackTableMessage(
+                TrackTableMessage&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::TrackTableMessage that will be copied.
+         */
+        eProsima_user_DllExport TrackTableMessage& operator =(
+                const TrackTableMessage& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::TrackTableMessage that will be copied.
+         */
+        eProsima_user_DllExport TrackTableMessage& operator =(
+                TrackTableMessage&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::TrackTableMessage object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const TrackTableMessage& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::TrackTableMessage object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const TrackTableMessage& x) const;
+
+        /*!
+         * @brief This function sets a value in member messageId
+         * @param _messageId New value for member messageId
+         */
+        eProsima_user_DllExport void messageId(
+                uint32_t _messageId);
+
+        /*!
+         * @brief This function returns the value of member messageId
+         * @return Value of member messageId
+         */
+        eProsima_user_DllExport uint32_t messageId() const;
+
+        /*!
+         * @brief This function returns a reference to member messageId
+         * @return Reference to member messageId
+         */
+        eProsima_user_DllExport uint32_t& messageId();
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
+         */
+        eProsima_user_DllExport uint64_t& timestamp();
+
+        /*!
+         * @brief This function sets a value in member numTracks
+         * @param _numTracks New value for member numTracks
+         */
+        eProsima_user_DllExport void numTracks(
+                uint32_t _numTracks);
+
+        /*!
+         * @brief This function returns the value of member numTracks
+         * @return Value of member numTracks
+         */
+        eProsima_user_DllExport uint32_t numTracks() const;
+
+        /*!
+         * @brief This function returns a reference to member numTracks
+         * @return Reference to member numTracks
+         */
+        eProsima_user_DllExport uint32_t& numTracks();
+
+        /*!
+         * @brief This function copies the value in member tracks
+         * @param _tracks New value to be copied in member tracks
+         */
+        eProsima_user_DllExport void tracks(
+                const std::vector<CounterUAS::TrackUpdateMessage>& _tracks);
+
+        /*!
+         * @brief This function moves the value in member tracks
+         * @param _tracks New value to be moved in member tracks
+         */
+        eProsima_user_DllExport void tracks(
+                std::vector<CounterUAS::TrackUpdateMessage>&& _tracks);
+
+        /*!
+         * @brief This function returns a constant reference to member tracks
+         * @return Constant reference to member tracks
+         */
+        eProsima_user_DllExport const std::vector<CounterUAS::TrackUpdateMessage>& tracks() const;
+
+        /*!
+         * @brief This function returns a reference to member tracks
+         * @return Reference to member tracks
+         */
+        eProsima_user_DllExport std::vector<CounterUAS::TrackUpdateMessage>& tracks();
+
+        /*!
+         * @brief This function sets a value in member sensorId
+         * @param _sensorId New value for member sensorId
+         */
+        eProsima_user_DllExport void sensorId(
+                uint32_t _sensorId);
+
+        /*!
+         * @brief This function returns the value of member sensorId
+         * @return Value of member sensorId
+         */
+        eProsima_user_DllExport uint32_t sensorId() const;
+
+        /*!
+         * @brief This function returns a reference to member sensorId
+         * @return Reference to member sensorId
+         */
+        eProsima_user_DllExport uint32_t& sensorId();
+
+        /*!
+         * @brief This function copies the value in member trace
+         * @param _trace New value to be copied in member trace
+         */
+        eProsima_user_DllExport void trace(
+                const CounterUAS::LatencyTrace& _trace);
+
+        /*!
+         * @brief This function moves the value in member trace
+         * @param _trace New value to be moved in member trace
+         */
+        eProsima_user_DllExport void trace(
+                CounterUAS::LatencyTrace&& _trace);
+
+        /*!
+         * @brief This function returns a constant reference to member trace
+         * @return Constant reference to member trace
+         */
+        eProsima_user_DllExport const CounterUAS::LatencyTrace& trace() const;
+
+        /*!
+         * @brief This function returns a reference to member trace
+         * @return Reference to member trace
+         */
+        eProsima_user_DllExport CounterUAS::LatencyTrace& trace();
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function returns the serialized size of a data depending on the buffer alignment.
+         * @param data Data which is calculated its serialized size.
+         * @param current_alignment Buffer alignment.
+         * @return Serialized size.
+         */
+        eProsima_user_DllExport static size_t getCdrSerializedSize(
+                const CounterUAS::TrackTableMessage& data,
+                size_t current_alignment = 0);
+
+
+        /*!
+         * @brief This function serializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serialize(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+        /*!
+         * @brief This function deserializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void deserialize(
+                eprosima::fastcdr::Cdr& cdr);
+
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of the Key of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function tells you if the Key has been defined for this type
+         */
+        eProsima_user_DllExport static bool isKeyDefined();
+
+        /*!
+         * @brief This function serializes the key members of an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serializeKey(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+    private:
+
+        uint32_t m_messageId;
+        uint64_t m_timestamp;
+        uint32_t m_numTracks;
+        std::vector<CounterUAS::TrackUpdateMessage> m_tracks;
+        uint32_t m_sensorId;
+        CounterUAS::LatencyTrace m_trace;
+    };
+    const uint32_t FRAME_MAX_TRACKS = 200;
+    /*!
+     * @brief This class represents the structure TrackFrameEntry defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class TrackFrameEntry
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport TrackFrameEntry();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~TrackFrameEntry();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::TrackFrameEntry that will be copied.
+         */
+        eProsima_user_DllExport TrackFrameEntry(
+                const TrackFrameEntry& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::TrackFrameEntry that will be copied.
+         */
+        eProsima_user_DllExport TrackFrameEntry(
+                TrackFrameEntry&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::TrackFrameEntry that will be copied.
+         */
+        eProsima_user_DllExport TrackFrameEntry& operator =(
+                const TrackFrameEntry& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::TrackFrameEntry that will be copied.
+         */
+        eProsima_user_DllExport TrackFrameEntry& operator =(
+                TrackFrameEntry&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::TrackFrameEntry object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const TrackFrameEntry& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::TrackFrameEntry object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const TrackFrameEntry& x) const;
+
+        /*!
+         * @brief This function sets a value in member trackId
+         * @param _trackId New value for member trackId
+         */
+        eProsima_user_DllExport void trackId(
+                uint32_t _trackId);
+
+        /*!
+         * @brief This function returns the value of member trackId
+         * @return Value of member trackId
+         */
+        eProsima_user_DllExport uint32_t trackId() const;
+
+        /*!
+         * @brief This function returns a reference to member trackId
+         * @return Reference to member trackId
+         */
+        eProsima_user_DllExport uint32_t& trackId();
+
+        /*!
+         * @brief This function sets a value in member status
+         * @param _status New value for member status
+         */
+        eProsima_user_DllExport void status(
+                CounterUAS::TrackStatus _status);
+
+        /*!
+         * @brief This function returns the value of member status
+         * @return Value of member status
+         */
+        eProsima_user_DllExport CounterUAS::TrackStatus status() const;
+
+        /*!
+         * @brief This function returns a reference to member status
+         * @return Reference to member status
+         */
+        eProsima_user_DllExport CounterUAS::TrackStatus& status();
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
+         */
+        eProsima_user_DllExport uint64_t& timestamp();
+
+        /*!
+         * @brief This function sets a value in member classification
+         * @param _classification New value for member classification
+         */
+        eProsima_user_DllExport void classification(
+                CounterUAS::TrackClassification _classification);
+
+        /*!
+         * @brief This function returns the value of member classification
+         * @return Value of member classification
+         */
+        eProsima_user_DllExport CounterUAS::TrackClassification classification() const;
+
+        /*!
+         * @brief This function returns a reference to member classification
+         * @return Reference to member classification
+         */
+        eProsima_user_DllExport CounterUAS::TrackClassification& classification();
+
+        /*!
+         * @brief This function sets a value in member hitCount
+         * @param _hitCount New value for member hitCount
+         */
+        eProsima_user_DllExport void hitCount(
+                uint32_t _hitCount);
+
+        /*!
+         * @brief This function returns the value of member hitCount
+         * @return Value of member hitCount
+         */
+        eProsima_user_DllExport uint32_t hitCount() const;
+
+        /*!
+         * @brief This function returns a reference to member hitCount
+         * @return Reference to member hitCount
+         */
+        eProsima_user_DllExport uint32_t& hitCount();
+
+        /*!
+         * @brief This function sets a value in member range
+         * @param _range New value for member range
+         */
+        eProsima_user_DllExport void range(
+                double _range);
+
+        /*!
+         * @brief This function returns the value of member range
+         * @return Value of member range
+         */
+        eProsima_user_DllExport double range() const;
+
+        /*!
+         * @brief This function returns a reference to member range
+         * @return Reference to member range
+         */
+        eProsima_user_DllExport double& range();
+
+        /*!
+         * @brief This function sets a value in member azimuth
+         * @param _azimuth New value for member azimuth
+         */
+        eProsima_user_DllExport void azimuth(
+                double _azimuth);
+
+        /*!
+         * @brief This function returns the value of member azimuth
+         * @return Value of member azimuth
+         */
+        eProsima_user_DllExport double azimuth() const;
+
+        /*!
+         * @brief This function returns a reference to member azimuth
+         * @return Reference to member azimuth
+         */
+        eProsima_user_DllExport double& azimuth();
+
+        /*!
+         * @brief This function sets a value in member elevation
+         * @param _elevation New value for member elevation
+         */
+        eProsima_user_DllExport void elevation(
+                double _elevation);
+
+        /*!
+         * @brief This function returns the value of member elevation
+         * @return Value of member elevation
+         */
+        eProsima_user_DllExport double elevation() const;
+
+        /*!
+         * @brief This function returns a reference to member elevation
+         * @return Reference to member elevation
+         */
+        eProsima_user_DllExport double& elevation();
+
+        /*!
+         * @brief This function sets a value in member rangeRate
+         * @param _rangeRate New value for member rangeRate
+         */
+        eProsima_user_DllExport void rangeRate(
+                double _rangeRate);
+
+        /*!
+         * @brief This function returns the value of member rangeRate
+         * @return Value of member rangeRate
+         */
+        eProsima_user_DllExport double rangeRate() const;
+
+        /*!
+         * @brief This function returns a reference to member rangeRate
+         * @return Reference to member rangeRate
+         */
+        eProsima_user_DllExport double& rangeRate();
+
+        /*!
+         * @brief This function sets a value in member x
+         * @param _x New value for member x
+         */
+        eProsima_user_DllExport void x(
+                double _x);
+
+        /*!
+         * @brief This function returns the value of member x
+         * @return Value of member x
+         */
+        eProsima_user_DllExport double x() const;
+
+        /*!
+         * @brief This function returns a reference to member x
+         * @return Reference to member x
+         */
+        eProsima_user_DllExport double& x();
+
+        /*!
+         * @brief This function sets a value in member y
+         * @param _y New value for member y
+         */
+        eProsima_user_DllExport void y(
+                double _y);
+
+        /*!
+         * @brief This function returns the value of member y
+         * @return Value of member y
+         */
+        eProsima_user_DllExport double y() const;
+
+        /*!
+         * @brief This function returns a reference to member y
+         * @return Reference to member y
+         */
+        eProsima_user_DllExport double& y();
+
+        /*!
+         * @brief This function sets a value in member z
+         * @param _z New value for member z
+         */
+        eProsima_user_DllExport void z(
+                double _z);
+
+        /*!
+         * @brief This function returns the value of member z
+         * @return Value of member z
+         */
+        eProsima_user_DllExport double z() const;
+
+        /*!
+         * @brief This function returns a reference to member z
+         * @return Reference to member z
+         */
+        eProsima_user_DllExport double& z();
+
+        /*!
+         * @brief This function sets a value in member vx
+         * @param _vx New value for member vx
+         */
+        eProsima_user_DllExport void vx(
+                double _vx);
+
+        /*!
+         * @brief This function returns the value of member vx
+         * @return Value of member vx
+         */
+        eProsima_user_DllExport double vx() const;
+
+        /*!
+         * @brief This function returns a reference to member vx
+         * @return Reference to member vx
+         */
+        eProsima_user_DllExport double& vx();
+
+        /*!
+         * @brief This function sets a value in member vy
+         * @param _vy New value for member vy
+         */
+        eProsima_user_DllExport void vy(
+                double _vy);
+
+        /*!
+         * @brief This function returns the value of member vy
+         * @return Value of member vy
+         */
+        eProsima_user_DllExport double vy() const;
+
+        /*!
+         * @brief This function returns a reference to member vy
+         * @return Reference to member vy
+         */
+        eProsima_user_DllExport double& vy();
+
+        /*!
+         * @brief This function sets a value in member vz
+         * @param _vz New value for member vz
+         */
+        eProsima_user_DllExport void vz(
+                double _vz);
+
+        /*!
+         * @brief This function returns the value of member vz
+         * @return Value of member vz
+         */
+        eProsima_user_DllExport double vz() const;
+
+        /*!
+         * @brief This function returns a reference to member vz
+         * @return Reference to member vz
+         */
+        eProsima_user_DllExport double& vz();
+
+        /*!
+         * @brief This function sets a value in member trackQuality
+         * @param _trackQuality New value for member trackQuality
+         */
+        eProsima_user_DllExport void trackQuality(
+                double _trackQuality);
+
+        /*!
+         * @brief This function returns the value of member trackQuality
+         * @return Value of member trackQuality
+         */
+        eProsima_user_DllExport double trackQuality() const;
+
+        /*!
+         * @brief This function returns a reference to member trackQuality
+         * @return Reference to member trackQuality
+         */
+        eProsima_user_DllExport double& trackQuality();
+
+        /*!
+         * @brief This function sets a value in member missCount
+         * @param _missCount New value for member missCount
+         */
+        eProsima_user_DllExport void missCount(
+                uint32_t _missCount);
+
+        /*!
+         * @brief This function returns the value of member missCount
+         * @return Value of member missCount
+         */
+        eProsima_user_DllExport uint32_t missCount() const;
+
+        /*!
+         * @brief This function returns a reference to member missCount
+         * @return Reference to member missCount
+         */
+        eProsima_user_DllExport uint32_t& missCount();
+
+        /*!
+         * @brief This function sets a value in member age
+         * @param _age New value for member age
+         */
+        eProsima_user_DllExport void age(
+                uint32_t _age);
+
+        /*!
+         * @brief This function returns the value of member age
+         * @return Value of member age
+         */
+        eProsima_user_DllExport uint32_t age() const;
+
+        /*!
+         * @brief This function returns a reference to member age
+         * @return Reference to member age
+         */
+        eProsima_user_DllExport uint32_t& age();
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function returns the serialized size of a data depending on the buffer alignment.
+         * @param data Data which is calculated its serialized size.
+         * @param current_alignment Buffer alignment.
+         * @return Serialized size.
+         */
+        eProsima_user_DllExport static size_t getCdrSerializedSize(
+                const CounterUAS::TrackFrameEntry& data,
+                size_t current_alignment = 0);
+
+
+        /*!
+         * @brief This function serializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serialize(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+        /*!
+         * @brief This function deserializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void deserialize(
+                eprosima::fastcdr::Cdr& cdr);
+
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of the Key of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function tells you if the Key has been defined for this type
+         */
+        eProsima_user_DllExport static bool isKeyDefined();
+
+        /*!
+         * @brief This function serializes the key members of an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serializeKey(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+    private:
+
+        uint32_t m_trackId;
+        CounterUAS::TrackStatus m_status;
+        uint64_t m_timestamp;
+        CounterUAS::TrackClassification m_classification;
+        uint32_t m_hitCount;
+        double m_range;
+        double m_azimuth;
+        double m_elevation;
+        double m_rangeRate;
+        double m_x;
+        double m_y;
+        double m_z;
+        double m_vx;
+        double m_vy;
+        double m_vz;
+        double m_trackQuality;
+        uint32_t m_missCount;
+        uint32_t m_age;
+    };
+    /*!
+     * @brief This class represents the structure TrackTableFrame defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class TrackTableFrame
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport TrackTableFrame();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~TrackTableFrame();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::TrackTableFrame that will be copied.
+         */
+        eProsima_user_DllExport TrackTableFrame(
+                const TrackTableFrame& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::TrackTableFrame that will be copied.
+         */
+        eProsima_user_DllExport TrackTableFrame(
+                TrackTableFrame&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::TrackTableFrame that will be copied.
+         */
+        eProsima_user_DllExport TrackTableFrame& operator =(
+                const TrackTableFrame& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::TrackTableFrame that will be copied.
+         */
+        eProsima_user_DllExport TrackTableFrame& operator =(
+                TrackTableFrame&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::TrackTableFrame object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const TrackTableFrame& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::TrackTableFrame object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const TrackTableFrame& x) const;
+
+        /*!
+         * @brief This function sets a value in member messageId
+         * @param _messageId New value for member messageId
+         */
+        eProsima_user_DllExport void messageId(
+                uint32_t _messageId);
+
+        /*!
+         * @brief This function returns the value of member messageId
+         * @return Value of member messageId
+         */
+        eProsima_user_DllExport uint32_t messageId() const;
+
+        /*!
+         * @brief This function returns a reference to member messageId
+         * @return Reference to member messageId
+         */
+        eProsima_user_DllExport uint32_t& messageId();
+
+        /*!
+         * @brief This function sets a value in member numTracks
+         * @param _numTracks New value for member numTracks
+         */
+        eProsima_user_DllExport void numTracks(
+                uint32_t _numTracks);
+
+        /*!
+         * @brief This function returns the value of member numTracks
+         * @return Value of member numTracks
+         */
+        eProsima_user_DllExport uint32_t numTracks() const;
+
+        /*!
+         * @brief This function returns a reference to member numTracks
+         * @return Reference to member numTracks
+         */
+        eProsima_user_DllExport uint32_t& numTracks();
+
+        /*!
+         * @brief This function sets a value in member sensorId
+         * @param _sensorId New value for member sensorId
+         */
+        eProsima_user_DllExport void sensorId(
+                uint32_t _sensorId);
+
+        /*!
+         * @brief This function returns the value of member sensorId
+         * @return Value of member sensorId
+         */
+        eProsima_user_DllExport uint32_t sensorId() const;
+
+        /*!
+         * @brief This function returns a reference to member sensorId
+         * @return Reference to member sensorId
+         */
+        eProsima_user_DllExport uint32_t& sensorId();
+
+        /*!
+         * @brief This function sets a value in member reserved
+         * @param _reserved New value for member reserved
+         */
+        eProsima_user_DllExport void reserved(
+                uint32_t _reserved);
+
+        /*!
+         * @brief This function returns the value of member reserved
+         * @return Value of member reserved
+         */
+        eProsima_user_DllExport uint32_t reserved() const;
+
+        /*!
+         * @brief This function returns a reference to member reserved
+         * @return Reference to member reserved
+         */
+        eProsima_user_DllExport uint32_t& reserved();
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
+         */
+        eProsima_user_DllExport uint64_t& timestamp();
+
+        /*!
+         * @brief This function copies the value in member trace
+         * @param _trace New value to be copied in member trace
+         */
+        eProsima_user_DllExport void trace(
+                const CounterUAS::LatencyTrace& _trace);
+
+        /*!
+         * @brief This function moves the value in member trace
+         * @param _trace New value to be moved in member trace
+         */
+        eProsima_user_DllExport void trace(
+                CounterUAS::LatencyTrace&& _trace);
+
+        /*!
+         * @brief This function returns a constant reference to member trace
+         * @return Constant reference to member trace
+         */
+        eProsima_user_DllExport const CounterUAS::LatencyTrace& trace() const;
+
+        /*!
+         * @brief This function returns a reference to member trace
+         * @return Reference to member trace
+         */
+        eProsima_user_DllExport CounterUAS::LatencyTrace& trace();
+
+        /*!
+         * @brief This function copies the value in member tracks
+         * @param _tracks New value to be copied in member tracks
+         */
+        eProsima_user_DllExport void tracks(
+                const std::array<CounterUAS::TrackFrameEntry, CounterUAS::FRAME_MAX_TRACKS>& _tracks);
+
+        /*!
+         * @brief This function moves the value in member tracks
+         * @param _tracks New value to be moved in member tracks
+         */
+        eProsima_user_DllExport void tracks(
+                std::array<CounterUAS::TrackFrameEntry, CounterUAS::FRAME_MAX_TRACKS>&& _tracks);
+
+        /*!
+         * @brief This function returns a constant reference to member tracks
+         * @return Constant reference to member tracks
+         */
+        eProsima_user_DllExport const std::array<CounterUAS::TrackFrameEntry, CounterUAS::FRAME_MAX_TRACKS>& tracks() const;
+
+        /*!
+         * @brief This function returns a reference to member tracks
+         * @return Reference to member tracks
+         */
+        eProsima_user_DllExport std::array<CounterUAS::TrackFrameEntry, CounterUAS::FRAME_MAX_TRACKS>& tracks();
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function returns the serialized size of a data depending on the buffer alignment.
+         * @param data Data which is calculated its serialized size.
+         * @param current_alignment Buffer alignment.
+         * @return Serialized size.
+         */
+        eProsima_user_DllExport static size_t getCdrSerializedSize(
+                const CounterUAS::TrackTableFrame& data,
+                size_t current_alignment = 0);
+
+
+        /*!
+         * @brief This function serializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serialize(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+        /*!
+         * @brief This function deserializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void deserialize(
+                eprosima::fastcdr::Cdr& cdr);
+
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of the Key of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function tells you if the Key has been defined for this type
+         */
+        eProsima_user_DllExport static bool isKeyDefined();
+
+        /*!
+         * @brief This function serializes the key members of an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serializeKey(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+    private:
+
+        uint32_t m_messageId;
+        uint32_t m_numTracks;
+        uint32_t m_sensorId;
+        uint32_t m_reserved;
+        uint64_t m_timestamp;
+        CounterUAS::LatencyTrace m_trace;
+        std::array<CounterUAS::TrackFrameEntry, CounterUAS::FRAME_MAX_TRACKS> m_tracks;
+    };
+    const uint32_t MSG_ID_CLUSTER_TABLE = 0x0010;
+    /*!
+     * @brief This class represents the structure ClusterData defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class ClusterData
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport ClusterData();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~ClusterData();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::ClusterData that will be copied.
+         */
+        eProsima_user_DllExport ClusterData(
+                const ClusterData& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::ClusterData that will be copied.
+         */
+        eProsima_user_DllExport ClusterData(
+                ClusterData&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::ClusterData that will be copied.
+         */
+        eProsima_user_DllExport ClusterData& operator =(
+                const ClusterData& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::ClusterData that will be copied.
+         */
+        eProsima_user_DllExport ClusterData& operator =(
+                ClusterData&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::ClusterData object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const ClusterData& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::ClusterData object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const ClusterData& x) const;
+
+        /*!
+         * @brief This function sets a value in member clusterId
+         * @param _clusterId New value for member clusterId
+         */
+        eProsima_user_DllExport void clusterId(
+                uint32_t _clusterId);
+
+        /*!
+         * @brief This function returns the value of member clusterId
+         * @return Value of member clusterId
+         */
+        eProsima_user_DllExport uint32_t clusterId() const;
+
+        /*!
+         * @brief This function returns a reference to member clusterId
+         * @return Reference to member clusterId
+         */
+        eProsima_user_DllExport uint32_t& clusterId();
+
+        /*!
+         * @brief This function sets a value in member numDetections
+         * @param _numDetections New value for member numDetections
+         */
+        eProsima_user_DllExport void numDetections(
+                uint32_t _numDetections);
+
+        /*!
+         * @brief This function returns the value of member numDetections
+         * @return Value of member numDetections
+         */
+        eProsima_user_DllExport uint32_t numDetections() const;
+
+        /*!
+         * @brief This function returns a reference to member numDetections
+         * @return Reference to member numDetections
+         */
+        eProsima_user_DllExport uint32_t& numDetections();
+
+        /*!
+         * @brief This function sets a value in member range
+         * @param _range New value for member range
+         */
+        eProsima_user_DllExport void range(
+                double _range);
+
+        /*!
+         * @brief This function returns the value of member range
+         * @return Value of member range
+         */
+        eProsima_user_DllExport double range() const;
+
+        /*!
+         * @brief This function returns a reference to member range
+         * @return Reference to member range
+         */
+        eProsima_user_DllExport double& range();
+
+        /*!
+         * @brief This function sets a value in member azimuth
+         * @param _azimuth New value for member azimuth
+         */
+        eProsima_user_DllExport void azimuth(
+                double _azimuth);
+
+        /*!
+         * @brief This function returns the value of member azimuth
+         * @return Value of member azimuth
+         */
+        eProsima_user_DllExport double azimuth() const;
+
+        /*!
+         * @brief This function returns a reference to member azimuth
+         * @return Reference to member azimuth
+         */
+        eProsima_user_DllExport double& azimuth();
+
+        /*!
+         * @brief This function sets a value in member elevation
+         * @param _elevation New value for member elevation
+         */
+        eProsima_user_DllExport void elevation(
+                double _elevation);
+
+        /*!
+         * @brief This function returns the value of member elevation
+         * @return Value of member elevation
+         */
+        eProsima_user_DllExport double elevation() const;
+
+        /*!
+         * @brief This function returns a reference to member elevation
+         * @return Reference to member elevation
+         */
+        eProsima_user_DllExport double& elevation();
+
+        /*!
+         * @brief This function sets a value in member strength
+         * @param _strength New value for member strength
+         */
+        eProsima_user_DllExport void strength(
+                double _strength);
+
+        /*!
+         * @brief This function returns the value of member strength
+         * @return Value of member strength
+         */
+        eProsima_user_DllExport double strength() const;
+
+        /*!
+         * @brief This function returns a reference to member strength
+         * @return Reference to member strength
+         */
+        eProsima_user_DllExport double& strength();
+
+        /*!
+         * @brief This function sets a value in member snr
+         * @param _snr New value for member snr
+         */
+        eProsima_user_DllExport void snr(
+                double _snr);
+
+        /*!
+         * @brief This function returns the value of member snr
+         * @return Value of member snr
+         */
+        eProsima_user_DllExport double snr() const;
+
+        /*!
+         * @brief This function returns a reference to member snr
+         * @return Reference to member snr
+         */
+        eProsima_user_DllExport double& snr();
+
+        /*!
+         * @brief This function sets a value in member rcs
+         * @param _rcs New value for member rcs
+         */
+        eProsima_user_DllExport void rcs(
+                double _rcs);
+
+        /*!
+         * @brief This function returns the value of member rcs
+         * @return Value of member rcs
+         */
+        eProsima_user_DllExport double rcs() const;
+
+        /*!
+         * @brief This function returns a reference to member rcs
+         * @return Reference to member rcs
+         */
+        eProsima_user_DllExport double& rcs();
+
+        /*!
+         * @brief This function sets a value in member microDoppler
+         * @param _microDoppler New value for member microDoppler
+         */
+        eProsima_user_DllExport void microDoppler(
+                double _microDoppler);
+
+        /*!
+         * @brief This function returns the value of member microDoppler
+         * @return Value of member microDoppler
+         */
+        eProsima_user_DllExport double microDoppler() const;
+
+        /*!
+         * @brief This function returns a reference to member microDoppler
+         * @return Reference to member microDoppler
+         */
+        eProsima_user_DllExport double& microDoppler();
+
+        /*!
+         * @brief This function sets a value in member x
+         * @param _x New value for member x
+         */
+        eProsima_user_DllExport void x(
+                double _x);
+
+        /*!
+         * @brief This function returns the value of member x
+         * @return Value of member x
+         */
+        eProsima_user_DllExport double x() const;
+
+        /*!
+         * @brief This function returns a reference to member x
+         * @return Reference to member x
+         */
+        eProsima_user_DllExport double& x();
+
+        /*!
+         * @brief This function sets a value in member y
+         * @param _y New value for member y
+         */
+        eProsima_user_DllExport void y(
+                double _y);
+
+        /*!
+         * @brief This function returns the value of member y
+         * @return Value of member y
+         */
+        eProsima_user_DllExport double y() const;
+
+        /*!
+         * @brief This function returns a reference to member y
+         * @return Reference to member y
+         */
+        eProsima_user_DllExport double& y();
+
+        /*!
+         * @brief This function sets a value in member z
+         * @param _z New value for member z
+         */
+        eProsima_user_DllExport void z(
+                double _z);
+
+        /*!
+         * @brief This function returns the value of member z
+         * @return Value of member z
+         */
+        eProsima_user_DllExport double z() const;
+
+        /*!
+         * @brief This function returns a reference to member z
+         * @return Reference to member z
+         */
+        eProsima_user_DllExport double& z();
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function returns the serialized size of a data depending on the buffer alignment.
+         * @param data Data which is calculated its serialized size.
+         * @param current_alignment Buffer alignment.
+         * @return Serialized size.
+         */
+        eProsima_user_DllExport static size_t getCdrSerializedSize(
+                const CounterUAS::ClusterData& data,
+                size_t current_alignment = 0);
+
+
+        /*!
+         * @brief This function serializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serialize(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+        /*!
+         * @brief This function deserializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void deserialize(
+                eprosima::fastcdr::Cdr& cdr);
+
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of the Key of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function tells you if the Key has been defined for this type
+         */
+        eProsima_user_DllExport static bool isKeyDefined();
+
+        /*!
+         * @brief This function serializes the key members of an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serializeKey(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+    private:
+
+        uint32_t m_clusterId;
+        uint32_t m_numDetections;
+        double m_range;
+        double m_azimuth;
+        double m_elevation;
+        double m_strength;
+        double m_snr;
+        double m_rcs;
+        double m_microDoppler;
+        double m_x;
+        double m_y;
+        double m_z;
+    };
+    /*!
+     * @brief This class represents the structure ClusterTableMessage defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class ClusterTableMessage
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport ClusterTableMessage();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~ClusterTableMessage();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::ClusterTableMessage that will be copied.
+         */
+        eProsima_user_DllExport ClusterTableMessage(
+                const ClusterTableMessage& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::ClusterTableMessage that will be copied.
+         */
+        eProsima_user_DllExport ClusterTableMessage(
+                ClusterTableMessage&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::ClusterTableMessage that will be copied.
+         */
+        eProsima_user_DllExport ClusterTableMessage& operator =(
+                const ClusterTableMessage& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::ClusterTableMessage that will be copied.
+         */
+        eProsima_user_DllExport ClusterTableMessage& operator =(
+                ClusterTableMessage&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::ClusterTableMessage object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const ClusterTableMessage& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::ClusterTableMessage object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const ClusterTableMessage& x) const;
+
+        /*!
+         * @brief This function sets a value in member messageId
+         * @param _messageId New value for member messageId
+         */
+        eProsima_user_DllExport void messageId(
+                uint32_t _messageId);
+
+        /*!
+         * @brief This function returns the value of member messageId
+         * @return Value of member messageId
+         */
+        eProsima_user_DllExport uint32_t messageId() const;
+
+        /*!
+         * @brief This function returns a reference to member messageId
+         * @return Reference to member messageId
+         */
+        eProsima_user_DllExport uint32_t& messageId();
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
+         */
+        eProsima_user_DllExport uint64_t& timestamp();
+
+        /*!
+         * @brief This function sets a value in member dwellCount
+         * @param _dwellCount New value for member dwellCount
+         */
+        eProsima_user_DllExport void dwellCount(
+                uint32_t _dwellCount);
+
+        /*!
+         * @brief This function returns the value of member dwellCount
+         * @return Value of member dwellCount
+         */
+        eProsima_user_DllExport uint32_t dwellCount() const;
+
+        /*!
+         * @brief This function returns a reference to member dwellCount
+         * @return Reference to member dwellCount
+         */
+        eProsima_user_DllExport uint32_t& dwellCount();
+
+        /*!
+         * @brief This function sets a value in member numClusters
+         * @param _numClusters New value for member numClusters
+         */
+        eProsima_user_DllExport void numClusters(
+                uint32_t _numClusters);
+
+        /*!
+         * @brief This function returns the value of member numClusters
+         * @return Value of member numClusters
+         */
+        eProsima_user_DllExport uint32_t numClusters() const;
+
+        /*!
+         * @brief This function returns a reference to member numClusters
+         * @return Reference to member numClusters
+         */
+        eProsima_user_DllExport uint32_t& numClusters();
+
+        /*!
+         * @brief This function copies the value in member clusters
+         * @param _clusters New value to be copied in member clusters
+         */
+        eProsima_user_DllExport void clusters(
+                const std::vector<CounterUAS::ClusterData>& _clusters);
+
+        /*!
+         * @brief This function moves the value in member clusters
+         * @param _clusters New value to be moved in member clusters
+         */
+        eProsima_user_DllExport void clusters(
+                std::vector<CounterUAS::ClusterData>&& _clusters);
+
+        /*!
+         * @brief This function returns a constant reference to member clusters
+         * @return Constant reference to member clusters
+         */
+        eProsima_user_DllExport const std::vector<CounterUAS::ClusterData>& clusters() const;
+
+        /*!
+         * @brief This function returns a reference to member clusters
+         * @return Reference to member clusters
+         */
+        eProsima_user_DllExport std::vector<CounterUAS::ClusterData>& clusters();
+
+        /*!
+         * @brief This function returns the maximum serialized size of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function returns the serialized size of a data depending on the buffer alignment.
+         * @param data Data which is calculated its serialized size.
+         * @param current_alignment Buffer alignment.
+         * @return Serialized size.
+         */
+        eProsima_user_DllExport static size_t getCdrSerializedSize(
+                const CounterUAS::ClusterTableMessage& data,
+                size_t current_alignment = 0);
+
+
+        /*!
+         * @brief This function serializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serialize(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+        /*!
+         * @brief This function deserializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void deserialize(
+                eprosima::fastcdr::Cdr& cdr);
+
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of the Key of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function tells you if the Key has been defined for this type
+         */
+        eProsima_user_DllExport static bool isKeyDefined();
+
+        /*!
+         * @brief This function serializes the key members of an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serializeKey(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+    private:
+
+        uint32_t m_messageId;
+        uint64_t m_timestamp;
+        uint32_t m_dwellCount;
+        uint32_t m_numClusters;
+        std::vector<CounterUAS::ClusterData> m_clusters;
+    };
+    const uint32_t MSG_ID_ASSOC_TABLE = 0x0011;
+    /*!
+     * @brief This class represents the structure AssocEntry defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class AssocEntry
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport AssocEntry();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~AssocEntry();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::AssocEntry that will be copied.
+         */
+        eProsima_user_DllExport AssocEntry(
+                const AssocEntry& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::AssocEntry that will be copied.
+         */
+        eProsima_user_DllExport AssocEntry(
+                AssocEntry&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::AssocEntry that will be copied.
+         */
+        eProsima_user_DllExport AssocEntry& operator =(
+                const AssocEntry& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::AssocEntry that will be copied.
+         */
+        eProsima_user_DllExport AssocEntry& operator =(
+                AssocEntry&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::AssocEntry object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const AssocEntry& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::AssocEntry object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const AssocEntry& x) const;
+
+        /*!
+         * @brief This function sets a value in member trackId
+         * @param _trackId New value for member trackId
+         */
+        eProsima_user_DllExport void trackId(
+                uint32_t _trackId);
+
+        /*!
+         * @brief This function returns the value of member trackId
+         * @return Value of member trackId
+         */
+        eProsima_user_DllExport uint32_t trackId() const;
+
+        /*!
+         * @brief This function returns a reference to member trackId
+         * @return Reference to member trackId
+         */
+        eProsima_user_DllExport uint32_t& trackId();
+
+        /*!
+         * @brief This function sets a value in member clusterId
+         * @param _clusterId New value for member clusterId
+         */
+        eProsima_user_DllExport void clusterId(
+                uint32_t _clusterId);
+
+        /*!
+         * @brief This function returns the value of member clusterId
+         * @return Value of member clusterId
+         */
+        eProsima_user_DllExport uint32_t clusterId() const;
+
+        /*!
+         * @brief This function returns a reference to member clusterId
+         * @return Reference to member clusterId
+         */
+        eProsima_user_DllExport uint32_t& clusterId();
+
+        /*!
+         * @brief This function sets a value in member distance
+         * @param _distance New value for member distance
+         */
+        eProsima_user_DllExport void distance(
+                double _distance);
+
+        /*!
+         * @brief This function returns the value of member distance
+         * @return Value of member distance
+         */
+        eProsima_user_DllExport double distance() const;
+
+        /*!
+         * @brief This function returns a reference to member distance
+         * @return Reference to member distance
+         */
+        eProsima_user_DllExport double& distance();
+
+        /*!
+         * @brief This function sets a value in member matched
+         * @param _matched New value for member matched
+         */
+        eProsima_user_DllExport void matched(
+                bool _matched);
+
+        /*!
+         * @brief This function returns the value of member matched
+         * @return Value of member matched
+         */
+        eProsima_user_DllExport bool matched() const;
+
+        /*!
+         * @brief This function returns a reference to member matched
+         * @return Reference to member matched
+         */
+        eProsima_user_DllExport bool& matched();
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function returns the serialized size of a data depending on the buffer alignment.
+         * @param data Data which is calculated its serialized size.
+         * @param current_alignment Buffer alignment.
+         * @return Serialized size.
+         */
+        eProsima_user_DllExport static size_t getCdrSerializedSize(
+                const CounterUAS::AssocEntry& data,
+                size_t current_alignment = 0);
+
+
+        /*!
+         * @brief This function serializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serialize(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+        /*!
+         * @brief This function deserializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void deserialize(
+                eprosima::fastcdr::Cdr& cdr);
+
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of the Key of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function tells you if the Key has been defined for this type
+         */
+        eProsima_user_DllExport static bool isKeyDefined();
+
+        /*!
+         * @brief This function serializes the key members of an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serializeKey(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+    private:
+
+        uint32_t m_trackId;
+        uint32_t m_clusterId;
+        double m_distance;
+        bool m_matched;
+    };
+    /*!
+     * @brief This class represents the structure AssocTableMessage defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class AssocTableMessage
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport AssocTableMessage();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~AssocTableMessage();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::AssocTableMessage that will be copied.
+         */
+        eProsima_user_DllExport AssocTableMessage(
+                const AssocTableMessage& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::AssocTableMessage that will be copied.
+         */
+        eProsima_user_DllExport AssocTableMessage(
+                AssocTableMessage&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::AssocTableMessage that will be copied.
+         */
+        eProsima_user_DllExport AssocTableMessage& operator =(
+                const AssocTableMessage& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::AssocTableMessage that will be copied.
+         */
+        eProsima_user_DllExport AssocTableMessage& operator =(
+                AssocTableMessage&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::AssocTableMessage object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const AssocTableMessage& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::AssocTableMessage object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const AssocTableMessage& x) const;
+
+        /*!
+         * @brief This function sets a value in member messageId
+         * @param _messageId New value for member messageId
+         */
+        eProsima_user_DllExport void messageId(
+                uint32_t _messageId);
+
+        /*!
+         * @brief This function returns the value of member messageId
+         * @return Value of member messageId
+         */
+        eProsima_user_DllExport uint32_t messageId() const;
+
+        /*!
+         * @brief This function returns a reference to member messageId
+         * @return Reference to member messageId
+         */
+        eProsima_user_DllExport uint32_t& messageId();
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
+         */
+        eProsima_user_DllExport uint64_t& timestamp();
+
+        /*!
+         * @brief This function sets a value in member numEntries
+         * @param _numEntries New value for member numEntries
+         */
+        eProsima_user_DllExport void numEntries(
+                uint32_t _numEntries);
+
+        /*!
+         * @brief This function returns the value of member numEntries
+         * @return Value of member numEntries
+         */
+        eProsima_user_DllExport uint32_t numEntries() const;
+
+        /*!
+         * @brief This function returns a reference to member numEntries
+         * @return Reference to member numEntries
+         */
+        eProsima_user_DllExport uint32_t& numEntries();
+
+        /*!
+         * @brief This function copies the value in member entries
+         * @param _entries New value to be copied in member entries
+         */
+        eProsima_user_DllExport void entries(
+                const std::vector<CounterUAS::AssocEntry>& _entries);
+
+        /*!
+         * @brief This function moves the value in member entries
+         * @param _entries New value to be moved in member entries
+         */
+        eProsima_user_DllExport void entries(
+                std::vector<CounterUAS::AssocEntry>&& _entries);
+
+        /*!
+         * @brief This function returns a constant reference to member entries
+         * @return Constant reference to member entries
+         */
+        eProsima_user_DllExport const std::vector<CounterUAS::AssocEntry>& entries() const;
+
+        /*!
+         * @brief This function returns a reference to member entries
+         * @return Reference to member entries
+         */
+        eProsima_user_DllExport std::vector<CounterUAS::AssocEntry>& entries();
+
+        /*!
+         * @brief This function returns the maximum serialized size of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function returns the serialized size of a data depending on the buffer alignment.
+         * @param data Data which is calculated its serialized size.
+         * @param current_alignment Buffer alignment.
+         * @return Serialized size.
+         */
+        eProsima_user_DllExport static size_t getCdrSerializedSize(
+                const CounterUAS::AssocTableMessage& data,
+                size_t current_alignment = 0);
+
+
+        /*!
+         * @brief This function serializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void serialize(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+        /*!
+         * @brief This function deserializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
+         */
+        eProsima_user_DllExport void deserialize(
+                eprosima::fastcdr::Cdr& cdr);
+
+
+
+        /*!
+         * @brief This function returns the maximum serialized size of the Key of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
+         */
+        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                size_t current_alignment = 0);
+
+        /*!
+         * @brief This function tells you if the Key has been defined for this type
+         */
+        eProsima_user_DllExport static bool isKeyDefined();
+
+        /*!
+         * @brief This function serializes the key members of an object using CDR serialization.
          * @param cdr CDR serialization object.
          */
-        eProsima_user_DllExport void serialize(
-                eprosima::fastcdr::Cdr& cdr) const;
+        eProsima_user_DllExport void serializeKey(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+    private:
+
+        uint32_t m_messageId;
+        uint64_t m_timestamp;
+        uint32_t m_numEntries;
+        std::vector<CounterUAS::AssocEntry> m_entries;
+    };
+    const uint32_t MSG_ID_PREDICTED_TABLE = 0x0012;
+    /*!
+     * @brief This class represents the structure PredictedEntry defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class PredictedEntry
+    {
+    public:
+
+        /*!
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport PredictedEntry();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~PredictedEntry();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::PredictedEntry that will be copied.
+         */
+        eProsima_user_DllExport PredictedEntry(
+                const PredictedEntry& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::PredictedEntry that will be copied.
+         */
+        eProsima_user_DllExport PredictedEntry(
+                PredictedEntry&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::PredictedEntry that will be copied.
+         */
+        eProsima_user_DllExport PredictedEntry& operator =(
+                const PredictedEntry& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::PredictedEntry that will be copied.
+         */
+        eProsima_user_DllExport PredictedEntry& operator =(
+                PredictedEntry&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::PredictedEntry object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const PredictedEntry& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::PredictedEntry object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const PredictedEntry& x) const;
+
+        /*!
+         * @brief This function sets a value in member trackId
+         * @param _trackId New value for member trackId
+         */
+        eProsima_user_DllExport void trackId(
+                uint32_t _trackId);
+
+        /*!
+         * @brief This function returns the value of member trackId
+         * @return Value of member trackId
+         */
+        eProsima_user_DllExport uint32_t trackId() const;
+
+        /*!
+         * @brief This function returns a reference to member trackId
+         * @return Reference to member trackId
+         */
+        eProsima_user_DllExport uint32_t& trackId();
+
+        /*!
+         * @brief This function sets a value in member trackStatus
+         * @param _trackStatus New value for member trackStatus
+         */
+        eProsima_user_DllExport void trackStatus(
+                CounterUAS::TrackStatus _trackStatus);
+
+        /*!
+         * @brief This function returns the value of member trackStatus
+         * @return Value of member trackStatus
+         */
+        eProsima_user_DllExport CounterUAS::TrackStatus trackStatus() const;
+
+        /*!
+         * @brief This function returns a reference to member trackStatus
+         * @return Reference to member trackStatus
+         */
+        eProsima_user_DllExport CounterUAS::TrackStatus& trackStatus();
+
+        /*!
+         * @brief This function sets a value in member x
+         * @param _x New value for member x
+         */
+        eProsima_user_DllExport void x(
+                double _x);
+
+        /*!
+         * @brief This function returns the value of member x
+         * @return Value of member x
+         */
+        eProsima_user_DllExport double x() const;
+
+        /*!
+         * @brief This function returns a reference to member x
+         * @return Reference to member x
+         */
+        eProsima_user_DllExport double& x();
+
+        /*!
+         * @brief This function sets a value in member vx
+         * @param _vx New value for member vx
+         */
+        eProsima_user_DllExport void vx(
+                double _vx);
+
+        /*!
+         * @brief This function returns the value of member vx
+         * @return Value of member vx
+         */
+        eProsima_user_DllExport double vx() const;
+
+        /*!
+         * @brief This function returns a reference to member vx
+         * @return Reference to member vx
+         */
+        eProsima_user_DllExport double& vx();
+
+        /*!
+         * @brief This function sets a value in member ax
+         * @param _ax New value for member ax
+         */
+        eProsima_user_DllExport void ax(
+                double _ax);
+
+        /*!
+         * @brief This function returns the value of member ax
+         * @return Value of member ax
+         */
+        eProsima_user_DllExport double ax() const;
+
+        /*!
+         * @brief This function returns a reference to member ax
+         * @return Reference to member ax
+         */
+        eProsima_user_DllExport double& ax();
 
         /*!
-         * @brief This function deserializes an object using CDR serialization.
-         * @param cdr CDR serialization object.
+         * @brief This function sets a value in member y
+         * @param _y New value for member y
          */
-        eProsima_user_DllExport void deserialize(
-                eprosima::fastcdr::Cdr& cdr);
-
-
+        eProsima_user_DllExport void y(
+                double _y);
 
         /*!
-         * @brief This function returns the maximum serialized size of the Key of an object
-         * depending on the buffer alignment.
-         * @param current_alignment Buffer alignment.
-         * @return Maximum serialized size.
+         * @brief This function returns the value of member y
+         * @return Value of member y
          */
-        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
-                size_t current_alignment = 0);
+        eProsima_user_DllExport double y() const;
 
         /*!
-         * @brief This function tells you if the Key has been defined for this type
+         * @brief This function returns a reference to member y
+         * @return Reference to member y
          */
-        eProsima_user_DllExport static bool isKeyDefined();
+        eProsima_user_DllExport double& y();
 
         /*!
-         * @brief This function serializes the key members of an object using CDR serialization.
-         * @param cdr CDR serialization object.
+         * @brief This function sets a value in member vy
+         * @param _vy New value for member vy
          */
-        eProsima_user_DllExport void serializeKey(
-                eprosima::fastcdr::Cdr& cdr) const;
-
-    private:
-
-        uint32_t m_messageId;
-        uint64_t m_timestamp;
-        uint32_t m_numTracks;
-        std::vector<CounterUAS::TrackUpdateMessage> m_tracks;
-    };
-    const uint32_t MSG_ID_CLUSTER_TABLE = 0x0010;
-    /*!
-     * @brief This class represents the structure ClusterData defined by the user in the IDL file.
-     * @ingroup MESSAGES
-     */
-    class ClusterData
-    {
-    public:
+        eProsima_user_DllExport void vy(
+                double _vy);
 
         /*!
-         * @brief Default constructor.
+         * @brief This function returns the value of member vy
+         * @return Value of member vy
          */
-        eProsima_user_DllExport ClusterData();
+        eProsima_user_DllExport double vy() const;
 
         /*!
-         * @brief Default destructor.
+         * @brief This function returns a reference to member vy
+         * @return Reference to member vy
          */
-        eProsima_user_DllExport ~ClusterData();
+        eProsima_user_DllExport double& vy();
 
         /*!
-         * @brief Copy constructor.
-         * @param x Reference to the object CounterUAS::ClusterData that will be copied.
+         * @brief This function sets a value in member ay
+         * @param _ay New value for member ay
          */
-        eProsima_user_DllExport ClusterData(
-                const ClusterData& x);
+        eProsima_user_DllExport void ay(
+                double _ay);
 
         /*!
-         * @brief Move constructor.
-         * @param x Reference to the object CounterUAS::ClusterData that will be copied.
+         * @brief This function returns the value of member ay
+         * @return Value of member ay
          */
-        eProsima_user_DllExport ClusterData(
-                ClusterData&& x) noexcept;
+        eProsima_user_DllExport double ay() const;
 
         /*!
-         * @brief Copy assignment.
-         * @param x Reference to the object CounterUAS::ClusterData that will be copied.
+         * @brief This function returns a reference to member ay
+         * @return Reference to member ay
          */
-        eProsima_user_DllExport ClusterData& operator =(
-                const ClusterData& x);
+        eProsima_user_DllExport double& ay();
 
         /*!
-         * @brief Move assignment.
-         * @param x Reference to the object CounterUAS::ClusterData that will be copied.
+         * @brief This function sets a value in member z
+         * @param _z New value for member z
          */
-        eProsima_user_DllExport ClusterData& operator =(
-                ClusterData&& x) noexcept;
+        eProsima_user_DllExport void z(
+                double _z);
 
         /*!
-         * @brief Comparison operator.
-         * @param x CounterUAS::ClusterData object to compare.
+         * @brief This function returns the value of member z
+         * @return Value of member z
          */
-        eProsima_user_DllExport bool operator ==(
-                const ClusterData& x) const;
+        eProsima_user_DllExport double z() const;
 
         /*!
-         * @brief Comparison operator.
-         * @param x CounterUAS::ClusterData object to compare.
+         * @brief This function returns a reference to member z
+         * @return Reference to member z
          */
-        eProsima_user_DllExport bool operator !=(
-                const ClusterData& x) const;
+        eProsima_user_DllExport double& z();
 
         /*!
-         * @brief This function sets a value in member clusterId
-         * @param _clusterId New value for member clusterId
+         * @brief This function sets a value in member vz
+         * @param _vz New value for member vz
          */
-        eProsima_user_DllExport void clusterId(
-                uint32_t _clusterId);
+        eProsima_user_DllExport void vz(
+                double _vz);
 
         /*!
-         * @brief This function returns the value of member clusterId
-         * @return Value of member clusterId
+         * @brief This function returns the value of member vz
+         * @return Value of member vz
          */
-        eProsima_user_DllExport uint32_t clusterId() const;
+        eProsima_user_DllExport double vz() const;
 
         /*!
-         * @brief This function returns a reference to member clusterId
-         * @return Reference to member clusterId
+         * @brief This function returns a reference to member vz
+         * @return Reference to member vz
          */
-        eProsima_user_DllExport uint32_t& clusterId();
+        eProsima_user_DllExport double& vz();
 
         /*!
-         * @brief This function sets a value in member numDetections
-         * @param _numDetections New value for member numDetections
+         * @brief This function sets a value in member az
+         * @param _az New value for member az
          */
-        eProsima_user_DllExport void numDetections(
-                uint32_t _numDetections);
+        eProsima_user_DllExport void az(
+                double _az);
 
         /*!
-         * @brief This function returns the value of member numDetections
-         * @return Value of member numDetections
+         * @brief This function returns the value of member az
+         * @return Value of member az
          */
-        eProsima_user_DllExport uint32_t numDetections() const;
+        eProsima_user_DllExport double az() const;
 
         /*!
-         * @brief This function returns a reference to member numDetections
-         * @return Reference to member numDetections
+         * @brief This function returns a reference to member az
+         * @return Reference to member az
          */
-        eProsima_user_DllExport uint32_t& numDetections();
+        eProsima_user_DllExport double& az();
 
         /*!
          * @brief This function sets a value in member range
@@ -1463,137 +3975,156 @@ namespace CounterUAS {
         eProsima_user_DllExport double& elevation();
 
         /*!
-         * @brief This function sets a value in member strength
-         * @param _strength New value for member strength
+         * @brief This function sets a value in member covX
+         * @param _covX New value for member covX
          */
-        eProsima_user_DllExport void strength(
-                double _strength);
+        eProsima_user_DllExport void covX(
+                double _covX);
 
         /*!
-         * @brief This function returns the value of member strength
-         * @return Value of member strength
+         * @brief This function returns the value of member covX
+         * @return Value of member covX
          */
-        eProsima_user_DllExport double strength() const;
+        eProsima_user_DllExport double covX() const;
 
         /*!
-         * @brief This function returns a reference to member strength
-         * @return Reference to member strength
+         * @brief This function returns a reference to member covX
+         * @return Reference to member covX
          */
-        eProsima_user_DllExport double& strength();
+        eProsima_user_DllExport double& covX();
 
         /*!
-         * @brief This function sets a value in member snr
-         * @param _snr New value for member snr
+         * @brief This function sets a value in member covY
+         * @param _covY New value for member covY
          */
-        eProsima_user_DllExport void snr(
-                double _snr);
+        eProsima_user_DllExport void covY(
+                double _covY);
 
         /*!
-         * @brief This function returns the value of member snr
-         * @return Value of member snr
+         * @brief This function returns the value of member covY
+         * @return Value of member covY
          */
-        eProsima_user_DllExport double snr() const;
+        eProsima_user_DllExport double covY() const;
 
         /*!
-         * @brief This function returns a reference to member snr
-         * @return Reference to member snr
+         * @brief This function returns a reference to member covY
+         * @return Reference to member covY
          */
-        eProsima_user_DllExport double& snr();
+        eProsima_user_DllExport double& covY();
 
         /*!
-         * @brief This function sets a value in member rcs
-         * @param _rcs New value for member rcs
+         * @brief This function sets a value in member covZ
+         * @param _covZ New value for member covZ
          */
-        eProsima_user_DllExport void rcs(
-                double _rcs);
+        eProsima_user_DllExport void covZ(
+                double _covZ);
 
         /*!
-         * @brief This function returns the value of member rcs
-         * @return Value of member rcs
+         * @brief This function returns the value of member covZ
+         * @return Value of member covZ
          */
-        eProsima_user_DllExport double rcs() const;
+        eProsima_user_DllExport double covZ() const;
 
         /*!
-         * @brief This function returns a reference to member rcs
-         * @return Reference to member rcs
+         * @brief This function returns a reference to member covZ
+         * @return Reference to member covZ
          */
-        eProsima_user_DllExport double& rcs();
+        eProsima_user_DllExport double& covZ();
 
         /*!
-         * @brief This function sets a value in member microDoppler
-         * @param _microDoppler New value for member microDoppler
+         * @brief This function sets a value in member modelProb0
+         * @param _modelProb0 New value for member modelProb0
          */
-        eProsima_user_DllExport void microDoppler(
-                double _microDoppler);
+        eProsima_user_DllExport void modelProb0(
+                double _modelProb0);
 
         /*!
-         * @brief This function returns the value of member microDoppler
-         * @return Value of member microDoppler
+         * @brief This function returns the value of member modelProb0
+         * @return Value of member modelProb0
          */
-        eProsima_user_DllExport double microDoppler() const;
+        eProsima_user_DllExport double modelProb0() const;
 
         /*!
-         * @brief This function returns a reference to member microDoppler
-         * @return Reference to member microDoppler
+         * @brief This function returns a reference to member modelProb0
+         * @return Reference to member modelProb0
          */
-        eProsima_user_DllExport double& microDoppler();
+        eProsima_user_DllExport double& modelProb0();
 
         /*!
-         * @brief This function sets a value in member x
-         * @param _x New value for member x
+         * @brief This function sets a value in member modelProb1
+         * @param _modelProb1 New value for member modelProb1
          */
-        eProsima_user_DllExport void x(
-                double _x);
+        eProsima_user_DllExport void modelProb1(
+                double _modelProb1);
 
         /*!
-         * @brief This function returns the value of member x
-         * @return Value of member x
+         * @brief This function returns the value of member modelProb1
+         * @return Value of member modelProb1
+         */
+        eProsima_user_DllExport double modelProb1() const;
+
+        /*!
+         * @brief This function returns a reference to member modelProb1
+         * @return Reference to member modelProb1
+         */
+        eProsima_user_DllExport double& modelProb1();
+
+        /*!
+         * @brief This function sets a value in member modelProb2
+         * @param _modelProb2 New value for member modelProb2
+         */
+        eProsima_user_DllExport void modelProb2(
+                double _modelProb2);
+
+        /*!
+         * @brief This function returns the value of member modelProb2
+         * @return Value of member modelProb2
          */
-        eProsima_user_DllExport double x() const;
+        eProsima_user_DllExport double modelProb2() const;
 
         /*!
-         * @brief This function returns a reference to member x
-         * @return Reference to member x
+         * @brief This function returns a reference to member modelProb2
+         * @return Reference to member modelProb2
          */
-        eProsima_user_DllExport double& x();
+        eProsima_user_DllExport double& modelProb2();
 
         /*!
-         * @brief This function sets a value in member y
-         * @param _y New value for member y
+         * @brief This function sets a value in member modelProb3
+         * @param _modelProb3 New value for member modelProb3
          */
-        eProsima_user_DllExport void y(
-                double _y);
+        eProsima_user_DllExport void modelProb3(
+                double _modelProb3);
 
         /*!
-         * @brief This function returns the value of member y
-         * @return Value of member y
+         * @brief This function returns the value of member modelProb3
+         * @return Value of member modelProb3
          */
-        eProsima_user_DllExport double y() const;
+        eProsima_user_DllExport double modelProb3() const;
 
         /*!
-         * @brief This function returns a reference to member y
-         * @return Reference to member y
+         * @brief This function returns a reference to member modelProb3
+         * @return Reference to member modelProb3
          */
-        eProsima_user_DllExport double& y();
+        eProsima_user_DllExport double& modelProb3();
 
         /*!
-         * @brief This function sets a value in member z
-         * @param _z New value for member z
+         * @brief This function sets a value in member modelProb4
+         * @param _modelProb4 New value for member modelProb4
          */
-        eProsima_user_DllExport void z(
-                double _z);
+        eProsima_user_DllExport void modelProb4(
+                double _modelProb4);
 
         /*!
-         * @brief This function returns the value of member z
-         * @return Value of member z
+         * @brief This function returns the value of member modelProb4
+         * @return Value of member modelProb4
          */
-        eProsima_user_DllExport double z() const;
+        eProsima_user_DllExport double modelProb4() const;
 
         /*!
-         * @brief This function returns a reference to member z
-         * @return Reference to member z
+         * @brief This function returns a reference to member modelProb4
+         * @return Reference to member modelProb4
          */
-        eProsima_user_DllExport double& z();
+        eProsima_user_DllExport double& modelProb4();
 
 
         /*!
@@ -1612,7 +4143,7 @@ namespace CounterUAS {
          * @return Serialized size.
          */
         eProsima_user_DllExport static size_t getCdrSerializedSize(
-                const CounterUAS::ClusterData& data,
+                const CounterUAS::PredictedEntry& data,
                 size_t current_alignment = 0);
 
 
@@ -1655,78 +4186,88 @@ namespace CounterUAS {
 
     private:
 
-        uint32_t m_clusterId;
-        uint32_t m_numDetections;
-        double m_range;
-        double m_azimuth;
-        double m_elevation;
-        double m_strength;
-        double m_snr;
-        double m_rcs;
-        double m_microDoppler;
+        uint32_t m_trackId;
+        CounterUAS::TrackStatus m_trackStatus;
         double m_x;
+        double m_vx;
+        double m_ax;
         double m_y;
+        double m_vy;
+        double m_ay;
         double m_z;
+        double m_vz;
+        double m_az;
+        double m_range;
+        double m_azimuth;
+        double m_elevation;
+        double m_covX;
+        double m_covY;
+        double m_covZ;
+        double m_modelProb0;
+        double m_modelProb1;
+        double m_modelProb2;
+        double m_modelProb3;
+        double m_modelProb4;
     };
     /*!
-     * @brief This class represents the structure ClusterTableMessage defined by the user in the IDL file.
+     * @brief This class represents the structure PredictedTableMessage defined by the user in the IDL file.
      * @ingroup MESSAGES
      */
-    class ClusterTableMessage
+    class PredictedTableMessage
     {
     public:
 
         /*!
          * @brief Default constructor.
          */
-        eProsima_user_DllExport ClusterTableMessage();
+        eProsima_user_DllExport PredictedTableMessage();
 
         /*!
          * @brief Default destructor.
          */
-        eProsima_user_DllExport ~ClusterTableMessage();
+        eProsima_user_DllExport ~PredictedTableMessage();
 
         /*!
          * @brief Copy constructor.
-         * @param x Reference to the object CounterUAS::ClusterTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::PredictedTableMessage that will be copied.
          */
-        eProsima_user_DllExport ClusterTableMessage(
-                const ClusterTableMessage& x);
+        eProsima_user_DllExport PredictedTableMessage(
+                const PredictedTableMessage& x);
 
         /*!
          * @brief Move constructor.
-         * @param x Reference to the object CounterUAS::ClusterTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::PredictedTableMessage that will be copied.
          */
-        eProsima_user_DllExport ClusterTableMessage(
-                ClusterTableMessage&& x) noexcept;
+        eProsima_user_DllExport PredictedTableMessage(
+                PredictedTableMessage&& x) noexcept;
 
         /*!
          * @brief Copy assignment.
-         * @param x Reference to the object CounterUAS::ClusterTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::PredictedTableMessage that will be copied.
          */
-        eProsima_user_DllExport ClusterTableMessage& operator =(
-                const ClusterTableMessage& x);
+        eProsima_user_DllExport PredictedTableMessage& operator =(
+                const PredictedTableMessage& x);
 
         /*!
          * @brief Move assignment.
-         * @param x Reference to the object CounterUAS::ClusterTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::PredictedTableMessage that will be copied.
          */
-        eProsima_user_DllExport ClusterTableMessage& operator =(
-                ClusterTableMessage&& x) noexcept;
+        eProsima_user_DllExport PredictedTableMessage& operator =(
+                PredictedTableMessage&& x) noexcept;
 
         /*!
          * @brief Comparison operator.
-         * @param x CounterUAS::ClusterTableMessage object to compare.
+         * @param x CounterUAS::PredictedTableMessage object to compare.
          */
         eProsima_user_DllExport bool operator ==(
-                const ClusterTableMessage& x) const;
+                const PredictedTableMessage& x) const;
 
         /*!
          * @brief Comparison operator.
-         * @param x CounterUAS::ClusterTableMessage object to compare.
+         * @param x CounterUAS::PredictedTableMessage object to compare.
          */
         eProsima_user_DllExport bool operator !=(
-                const ClusterTableMessage& x) const;
+                const PredictedTableMessage& x) const;
 
         /*!
          * @brief This function sets a value in member messageId
@@ -1767,68 +4308,49 @@ namespace CounterUAS {
         eProsima_user_DllExport uint64_t& timestamp();
 
         /*!
-         * @brief This function sets a value in member dwellCount
-         * @param _dwellCount New value for member dwellCount
-         */
-        eProsima_user_DllExport void dwellCount(
-                uint32_t _dwellCount);
-
-        /*!
-         * @brief This function returns the value of member dwellCount
-         * @return Value of member dwellCount
-         */
-        eProsima_user_DllExport uint32_t dwellCount() const;
-
-        /*!
-         * @brief This function returns a reference to member dwellCount
-         * @return Reference to member dwellCount
-         */
-        eProsima_user_DllExport uint32_t& dwellCount();
-
-        /*!
-         * @brief This function sets a value in member numClusters
-         * @param _numClusters New value for member numClusters
+         * @brief This function sets a value in member numEntries
+         * @param _numEntries New value for member numEntries
          */
-        eProsima_user_DllExport void numClusters(
-                uint32_t _numClusters);
+        eProsima_user_DllExport void numEntries(
+                uint32_t _numEntries);
 
         /*!
-         * @brief This function returns the value of member numClusters
-         * @return Value of member numClusters
+         * @brief This function returns the value of member numEntries
+         * @return Value of member numEntries
          */
-        eProsima_user_DllExport uint32_t numClusters() const;
+        eProsima_user_DllExport uint32_t numEntries() const;
 
         /*!
-         * @brief This function returns a reference to member numClusters
-         * @return Reference to member numClusters
+         * @brief This function returns a reference to member numEntries
+         * @return Reference to member numEntries
          */
-        eProsima_user_DllExport uint32_t& numClusters();
+        eProsima_user_DllExport uint32_t& numEntries();
 
         /*!
-         * @brief This function copies the value in member clusters
-         * @param _clusters New value to be copied in member clusters
+         * @brief This function copies the value in member entries
+         * @param _entries New value to be copied in member entries
          */
-        eProsima_user_DllExport void clusters(
-                const std::vector<CounterUAS::ClusterData>& _clusters);
+        eProsima_user_DllExport void entries(
+                const std::vector<CounterUAS::PredictedEntry>& _entries);
 
         /*!
-         * @brief This function moves the value in member clusters
-         * @param _clusters New value to be moved in member clusters
+         * @brief This function moves the value in member entries
+         * @param _entries New value to be moved in member entries
          */
-        eProsima_user_DllExport void clusters(
-                std::vector<CounterUAS::ClusterData>&& _clusters);
+        eProsima_user_DllExport void entries(
+                std::vector<CounterUAS::PredictedEntry>&& _entries);
 
         /*!
-         * @brief This function returns a constant reference to member clusters
-         * @return Constant reference to member clusters
+         * @brief This function returns a constant reference to member entries
+         * @return Constant reference to member entries
          */
-        eProsima_user_DllExport const std::vector<CounterUAS::ClusterData>& clusters() const;
+        eProsima_user_DllExport const std::vector<CounterUAS::PredictedEntry>& entries() const;
 
         /*!
-         * @brief This function returns a reference to member clusters
-         * @return Reference to member clusters
+         * @brief This function returns a reference to member entries
+         * @return Reference to member entries
          */
-        eProsima_user_DllExport std::vector<CounterUAS::ClusterData>& clusters();
+        eProsima_user_DllExport std::vector<CounterUAS::PredictedEntry>& entries();
 
         /*!
          * @brief This function returns the maximum serialized size of an object
@@ -1846,7 +4368,7 @@ namespace CounterUAS {
          * @return Serialized size.
          */
         eProsima_user_DllExport static size_t getCdrSerializedSize(
-                const CounterUAS::ClusterTableMessage& data,
+                const CounterUAS::PredictedTableMessage& data,
                 size_t current_alignment = 0);
 
 
@@ -1891,146 +4413,240 @@ namespace CounterUAS {
 
         uint32_t m_messageId;
         uint64_t m_timestamp;
-        uint32_t m_dwellCount;
-        uint32_t m_numClusters;
-        std::vector<CounterUAS::ClusterData> m_clusters;
+        uint32_t m_numEntries;
+        std::vector<CounterUAS::PredictedEntry> m_entries;
     };
-    const uint32_t MSG_ID_ASSOC_TABLE = 0x0011;
+    const uint32_t MSG_ID_PIPELINE_STATS = 0x0020;
     /*!
-     * @brief This class represents the structure AssocEntry defined by the user in the IDL file.
+     * @brief This class represents the structure PipelineStatsMessage defined by the user in the IDL file.
      * @ingroup MESSAGES
      */
-    class AssocEntry
+    class PipelineStatsMessage
     {
     public:
 
         /*!
-         * @brief Default constructor.
+         * @brief Default constructor.
+         */
+        eProsima_user_DllExport PipelineStatsMessage();
+
+        /*!
+         * @brief Default destructor.
+         */
+        eProsima_user_DllExport ~PipelineStatsMessage();
+
+        /*!
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::PipelineStatsMessage that will be copied.
+         */
+        eProsima_user_DllExport PipelineStatsMessage(
+                const PipelineStatsMessage& x);
+
+        /*!
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::PipelineStatsMessage that will be copied.
+         */
+        eProsima_user_DllExport PipelineStatsMessage(
+                PipelineStatsMessage&& x) noexcept;
+
+        /*!
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::PipelineStatsMessage that will be copied.
+         */
+        eProsima_user_DllExport PipelineStatsMessage& operator =(
+                const PipelineStatsMessage& x);
+
+        /*!
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::PipelineStatsMessage that will be copied.
+         */
+        eProsima_user_DllExport PipelineStatsMessage& operator =(
+                PipelineStatsMessage&& x) noexcept;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::PipelineStatsMessage object to compare.
+         */
+        eProsima_user_DllExport bool operator ==(
+                const PipelineStatsMessage& x) const;
+
+        /*!
+         * @brief Comparison operator.
+         * @param x CounterUAS::PipelineStatsMessage object to compare.
+         */
+        eProsima_user_DllExport bool operator !=(
+                const PipelineStatsMessage& x) const;
+
+        /*!
+         * @brief This function sets a value in member messageId
+         * @param _messageId New value for member messageId
+         */
+        eProsima_user_DllExport void messageId(
+                uint32_t _messageId);
+
+        /*!
+         * @brief This function returns the value of member messageId
+         * @return Value of member messageId
+         */
+        eProsima_user_DllExport uint32_t messageId() const;
+
+        /*!
+         * @brief This function returns a reference to member messageId
+         * @return Reference to member messageId
+         */
+        eProsima_user_DllExport uint32_t& messageId();
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
+
+        /*!
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
          */
-        eProsima_user_DllExport AssocEntry();
+        eProsima_user_DllExport uint64_t& timestamp();
 
         /*!
-         * @brief Default destructor.
+         * @brief This function sets a value in member cycleCount
+         * @param _cycleCount New value for member cycleCount
          */
-        eProsima_user_DllExport ~AssocEntry();
+        eProsima_user_DllExport void cycleCount(
+                uint64_t _cycleCount);
 
         /*!
-         * @brief Copy constructor.
-         * @param x Reference to the object CounterUAS::AssocEntry that will be copied.
+         * @brief This function returns the value of member cycleCount
+         * @return Value of member cycleCount
          */
-        eProsima_user_DllExport AssocEntry(
-                const AssocEntry& x);
+        eProsima_user_DllExport uint64_t cycleCount() const;
 
         /*!
-         * @brief Move constructor.
-         * @param x Reference to the object CounterUAS::AssocEntry that will be copied.
+         * @brief This function returns a reference to member cycleCount
+         * @return Reference to member cycleCount
          */
-        eProsima_user_DllExport AssocEntry(
-                AssocEntry&& x) noexcept;
+        eProsima_user_DllExport uint64_t& cycleCount();
 
         /*!
-         * @brief Copy assignment.
-         * @param x Reference to the object CounterUAS::AssocEntry that will be copied.
+         * @brief This function sets a value in member messagesReceived
+         * @param _messagesReceived New value for member messagesReceived
          */
-        eProsima_user_DllExport AssocEntry& operator =(
-                const AssocEntry& x);
+        eProsima_user_DllExport void messagesReceived(
+                uint64_t _messagesReceived);
 
         /*!
-         * @brief Move assignment.
-         * @param x Reference to the object CounterUAS::AssocEntry that will be copied.
+         * @brief This function returns the value of member messagesReceived
+         * @return Value of member messagesReceived
          */
-        eProsima_user_DllExport AssocEntry& operator =(
-                AssocEntry&& x) noexcept;
+        eProsima_user_DllExport uint64_t messagesReceived() const;
 
         /*!
-         * @brief Comparison operator.
-         * @param x CounterUAS::AssocEntry object to compare.
+         * @brief This function returns a reference to member messagesReceived
+         * @return Reference to member messagesReceived
          */
-        eProsima_user_DllExport bool operator ==(
-                const AssocEntry& x) const;
+        eProsima_user_DllExport uint64_t& messagesReceived();
 
         /*!
-         * @brief Comparison operator.
-         * @param x CounterUAS::AssocEntry object to compare.
+         * @brief This function sets a value in member ingestCapacity
+         * @param _ingestCapacity New value for member ingestCapacity
          */
-        eProsima_user_DllExport bool operator !=(
-                const AssocEntry& x) const;
+        eProsima_user_DllExport void ingestCapacity(
+                uint32_t _ingestCapacity);
 
         /*!
-         * @brief This function sets a value in member trackId
-         * @param _trackId New value for member trackId
+         * @brief This function returns the value of member ingestCapacity
+         * @return Value of member ingestCapacity
          */
-        eProsima_user_DllExport void trackId(
-                uint32_t _trackId);
+        eProsima_user_DllExport uint32_t ingestCapacity() const;
 
         /*!
-         * @brief This function returns the value of member trackId
-         * @return Value of member trackId
+         * @brief This function returns a reference to member ingestCapacity
+         * @return Reference to member ingestCapacity
          */
-        eProsima_user_DllExport uint32_t trackId() const;
+        eProsima_user_DllExport uint32_t& ingestCapacity();
 
         /*!
-         * @brief This function returns a reference to member trackId
-         * @return Reference to member trackId
+         * @brief This function sets a value in member ingestDepth
+         * @param _ingestDepth New value for member ingestDepth
          */
-        eProsima_user_DllExport uint32_t& trackId();
+        eProsima_user_DllExport void ingestDepth(
+                uint32_t _ingestDepth);
 
         /*!
-         * @brief This function sets a value in member clusterId
-         * @param _clusterId New value for member clusterId
+         * @brief This function returns the value of member ingestDepth
+         * @return Value of member ingestDepth
          */
-        eProsima_user_DllExport void clusterId(
-                uint32_t _clusterId);
+        eProsima_user_DllExport uint32_t ingestDepth() const;
 
         /*!
-         * @brief This function returns the value of member clusterId
-         * @return Value of member clusterId
+         * @brief This function returns a reference to member ingestDepth
+         * @return Reference to member ingestDepth
          */
-        eProsima_user_DllExport uint32_t clusterId() const;
+        eProsima_user_DllExport uint32_t& ingestDepth();
 
         /*!
-         * @brief This function returns a reference to member clusterId
-         * @return Reference to member clusterId
+         * @brief This function sets a value in member ingestHighWater
+         * @param _ingestHighWater New value for member ingestHighWater
          */
-        eProsima_user_DllExport uint32_t& clusterId();
+        eProsima_user_DllExport void ingestHighWater(
+                uint32_t _ingestHighWater);
 
         /*!
-         * @brief This function sets a value in member distance
-         * @param _distance New value for member distance
+         * @brief This function returns the value of member ingestHighWater
+         * @return Value of member ingestHighWater
          */
-        eProsima_user_DllExport void distance(
-                double _distance);
+        eProsima_user_DllExport uint32_t ingestHighWater() const;
 
         /*!
-         * @brief This function returns the value of member distance
-         * @return Value of member distance
+         * @brief This function returns a reference to member ingestHighWater
+         * @return Reference to member ingestHighWater
          */
-        eProsima_user_DllExport double distance() const;
+        eProsima_user_DllExport uint32_t& ingestHighWater();
 
         /*!
-         * @brief This function returns a reference to member distance
-         * @return Reference to member distance
+         * @brief This function sets a value in member ingestDropped
+         * @param _ingestDropped New value for member ingestDropped
          */
-        eProsima_user_DllExport double& distance();
+        eProsima_user_DllExport void ingestDropped(
+                uint64_t _ingestDropped);
 
         /*!
-         * @brief This function sets a value in member matched
-         * @param _matched New value for member matched
+         * @brief This function returns the value of member ingestDropped
+         * @return Value of member ingestDropped
          */
-        eProsima_user_DllExport void matched(
-                bool _matched);
+        eProsima_user_DllExport uint64_t ingestDropped() const;
 
         /*!
-         * @brief This function returns the value of member matched
-         * @return Value of member matched
+         * @brief This function returns a reference to member ingestDropped
+         * @return Reference to member ingestDropped
          */
-        eProsima_user_DllExport bool matched() const;
+        eProsima_user_DllExport uint64_t& ingestDropped();
 
         /*!
-         * @brief This function returns a reference to member matched
-         * @return Reference to member matched
+         * @brief This function sets a value in member ingestCoalesced
+         * @param _ingestCoalesced New value for member ingestCoalesced
          */
-        eProsima_user_DllExport bool& matched();
+        eProsima_user_DllExport void ingestCoalesced(
+                uint64_t _ingestCoalesced);
+
+        /*!
+         * @brief This function returns the value of member ingestCoalesced
+         * @return Value of member ingestCoalesced
+         */
+        eProsima_user_DllExport uint64_t ingestCoalesced() const;
+
+        /*!
+         * @brief This function returns a reference to member ingestCoalesced
+         * @return Reference to member ingestCoalesced
+         */
+        eProsima_user_DllExport uint64_t& ingestCoalesced();
 
 
         /*!
@@ -2049,7 +4665,7 @@ namespace CounterUAS {
          * @return Serialized size.
          */
         eProsima_user_DllExport static size_t getCdrSerializedSize(
-                const CounterUAS::AssocEntry& data,
+                const CounterUAS::PipelineStatsMessage& data,
                 size_t current_alignment = 0);
 
 
@@ -2092,153 +4708,255 @@ namespace CounterUAS {
 
     private:
 
-        uint32_t m_trackId;
-        uint32_t m_clusterId;
-        double m_distance;
-        bool m_matched;
+        uint32_t m_messageId;
+        uint64_t m_timestamp;
+        uint64_t m_cycleCount;
+        uint64_t m_messagesReceived;
+        uint32_t m_ingestCapacity;
+        uint32_t m_ingestDepth;
+        uint32_t m_ingestHighWater;
+        uint64_t m_ingestDropped;
+        uint64_t m_ingestCoalesced;
     };
+    const uint32_t MSG_ID_TRACKER_HEALTH = 0x0021;
     /*!
-     * @brief This class represents the structure AssocTableMessage defined by the user in the IDL file.
+     * @brief This class represents the structure StageLatency defined by the user in the IDL file.
      * @ingroup MESSAGES
      */
-    class AssocTableMessage
+    class StageLatency
     {
     public:
 
         /*!
          * @brief Default constructor.
          */
-        eProsima_user_DllExport AssocTableMessage();
+        eProsima_user_DllExport StageLatency();
 
         /*!
          * @brief Default destructor.
          */
-        eProsima_user_DllExport ~AssocTableMessage();
+        eProsima_user_DllExport ~StageLatency();
 
         /*!
          * @brief Copy constructor.
-         * @param x Reference to the object CounterUAS::AssocTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::StageLatency that will be copied.
          */
-        eProsima_user_DllExport AssocTableMessage(
-                const AssocTableMessage& x);
+        eProsima_user_DllExport StageLatency(
+                const StageLatency& x);
 
         /*!
          * @brief Move constructor.
-         * @param x Reference to the object CounterUAS::AssocTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::StageLatency that will be copied.
          */
-        eProsima_user_DllExport AssocTableMessage(
-                AssocTableMessage&& x) noexcept;
+        eProsima_user_DllExport StageLatency(
+                StageLatency&& x) noexcept;
 
         /*!
          * @brief Copy assignment.
-         * @param x Reference to the object CounterUAS::AssocTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::StageLatency that will be copied.
          */
-        eProsima_user_DllExport AssocTableMessage& operator =(
-                const AssocTableMessage& x);
+        eProsima_user_DllExport StageLatency& operator =(
+                const StageLatency& x);
 
         /*!
          * @brief Move assignment.
-         * @param x Reference to the object CounterUAS::AssocTableMessage that will be copied.
+         * @param x Reference to the object CounterUAS::StageLatency that will be copied.
          */
-        eProsima_user_DllExport AssocTableMessage& operator =(
-                AssocTableMessage&& x) noexcept;
+        eProsima_user_DllExport StageLatency& operator =(
+                StageLatency&& x) noexcept;
 
         /*!
          * @brief Comparison operator.
-         * @param x CounterUAS::AssocTableMessage object to compare.
+         * @param x CounterUAS::StageLatency object to compare.
          */
         eProsima_user_DllExport bool operator ==(
-                const AssocTableMessage& x) const;
+                const StageLatency& x) const;
 
         /*!
          * @brief Comparison operator.
-         * @param x CounterUAS::AssocTableMessage object to compare.
+         * @param x CounterUAS::StageLatency object to compare.
          */
         eProsima_user_DllExport bool operator !=(
-                const AssocTableMessage& x) const;
+                const StageLatency& x) const;
 
         /*!
-         * @brief This function sets a value in member messageId
-         * @param _messageId New value for member messageId
+         * @brief This function sets a value in member stageId
+         * @param _stageId New value for member stageId
          */
-        eProsima_user_DllExport void messageId(
-                uint32_t _messageId);
+        eProsima_user_DllExport void stageId(
+                uint32_t _stageId);
 
         /*!
-         * @brief This function returns the value of member messageId
-         * @return Value of member messageId
+         * @brief This function returns the value of member stageId
+         * @return Value of member stageId
          */
-        eProsima_user_DllExport uint32_t messageId() const;
+        eProsima_user_DllExport uint32_t stageId() const;
 
         /*!
-         * @brief This function returns a reference to member messageId
-         * @return Reference to member messageId
+         * @brief This function returns a reference to member stageId
+         * @return Reference to member stageId
          */
-        eProsima_user_DllExport uint32_t& messageId();
+        eProsima_user_DllExport uint32_t& stageId();
 
         /*!
-         * @brief This function sets a value in member timestamp
-         * @param _timestamp New value for member timestamp
+         * @brief This function copies the value in member name
+         * @param _name New value to be copied in member name
          */
-        eProsima_user_DllExport void timestamp(
-                uint64_t _timestamp);
+        eProsima_user_DllExport void name(
+                const std::string& _name);
 
         /*!
-         * @brief This function returns the value of member timestamp
-         * @return Value of member timestamp
+         * @brief This function moves the value in member name
+         * @param _name New value to be moved in member name
          */
-        eProsima_user_DllExport uint64_t timestamp() const;
+        eProsima_user_DllExport void name(
+                std::string&& _name);
 
         /*!
-         * @brief This function returns a reference to member timestamp
-         * @return Reference to member timestamp
+         * @brief This function returns a constant reference to member name
+         * @return Constant reference to member name
          */
-        eProsima_user_DllExport uint64_t& timestamp();
+        eProsima_user_DllExport const std::string& name() const;
 
         /*!
-         * @brief This function sets a value in member numEntries
-         * @param _numEntries New value for member numEntries
+         * @brief This function returns a reference to member name
+         * @return Reference to member name
          */
-        eProsima_user_DllExport void numEntries(
-                uint32_t _numEntries);
+        eProsima_user_DllExport std::string& name();
 
         /*!
-         * @brief This function returns the value of member numEntries
-         * @return Value of member numEntries
+         * @brief This function sets a value in member count
+         * @param _count New value for member count
          */
-        eProsima_user_DllExport uint32_t numEntries() const;
+        eProsima_user_DllExport void count(
+                uint64_t _count);
 
         /*!
-         * @brief This function returns a reference to member numEntries
-         * @return Reference to member numEntries
+         * @brief This function returns the value of member count
+         * @return Value of member count
          */
-        eProsima_user_DllExport uint32_t& numEntries();
+        eProsima_user_DllExport uint64_t count() const;
 
         /*!
-         * @brief This function copies the value in member entries
-         * @param _entries New value to be copied in member entries
+         * @brief This function returns a reference to member count
+         * @return Reference to member count
          */
-        eProsima_user_DllExport void entries(
-                const std::vector<CounterUAS::AssocEntry>& _entries);
+        eProsima_user_DllExport uint64_t& count();
 
         /*!
-         * @brief This function moves the value in member entries
-         * @param _entries New value to be moved in member entries
+         * @brief This function sets a value in member p50Us
+         * @param _p50Us New value for member p50Us
          */
-        eProsima_user_DllExport void entries(
-                std::vector<CounterUAS::AssocEntry>&& _entries);
+        eProsima_user_DllExport void p50Us(
+                double _p50Us);
 
         /*!
-         * @brief This function returns a constant reference to member entries
-         * @return Constant reference to member entries
+         * @brief This function returns the value of member p50Us
+         * @return Value of member p50Us
          */
-        eProsima_user_DllExport const std::vector<CounterUAS::AssocEntry>& entries() const;
+        eProsima_user_DllExport double p50Us() const;
 
         /*!
-         * @brief This function returns a reference to member entries
-         * @return Reference to member entries
+         * @brief This function returns a reference to member p50Us
+         * @return Reference to member p50Us
          */
-        eProsima_user_DllExport std::vector<CounterUAS::AssocEntry>& entries();
+        eProsima_user_DllExport double& p50Us();
+
+        /*!
+         * @brief This function sets a value in member p99Us
+         * @param _p99Us New value for member p99Us
+         */
+        eProsima_user_DllExport void p99Us(
+                double _p99Us);
+
+        /*!
+         * @brief This function returns the value of member p99Us
+         * @return Value of member p99Us
+         */
+        eProsima_user_DllExport double p99Us() const;
+
+        /*!
+         * @brief This function returns a reference to member p99Us
+         * @return Reference to member p99Us
+         */
+        eProsima_user_DllExport double& p99Us();
+
+        /*!
+         * @brief This function sets a value in member p999Us
+         * @param _p999Us New value for member p999Us
+         */
+        eProsima_user_DllExport void p999Us(
+                double _p999Us);
+
+        /*!
+         * @brief This function returns the value of member p999Us
+         * @return Value of member p999Us
+         */
+        eProsima_user_DllExport double p999Us() const;
+
+        /*!
+         * @brief This function returns a reference to member p999Us
+         * @return Reference to member p999Us
+         */
+        eProsima_user_DllExport double& p999Us();
+
+        /*!
+         * @brief This function sets a value in member maxUs
+         * @param _maxUs New value for member maxUs
+         */
+        eProsima_user_DllExport void maxUs(
+                double _maxUs);
+
+        /*!
+         * @brief This function returns the value of member maxUs
+         * @return Value of member maxUs
+         */
+        eProsima_user_DllExport double maxUs() const;
+
+        /*!
+         * @brief This function returns a reference to member maxUs
+         * @return Reference to member maxUs
+         */
+        eProsima_user_DllExport double& maxUs();
+
+        /*!
+         * @brief This function sets a value in member allocCount
+         * @param _allocCount New value for member allocCount
+         */
+        eProsima_user_DllExport void allocCount(
+                uint64_t _allocCount);
+
+        /*!
+         * @brief This function returns the value of member allocCount
+         * @return Value of member allocCount
+         */
+        eProsima_user_DllExport uint64_t allocCount() const;
+
+        /*!
+         * @brief This function returns a reference to member allocCount
+         * @return Reference to member allocCount
+         */
+        eProsima_user_DllExport uint64_t& allocCount();
+
+        /*!
+         * @brief This function sets a value in member allocBytes
+         * @param _allocBytes New value for member allocBytes
+         */
+        eProsima_user_DllExport void allocBytes(
+                uint64_t _allocBytes);
+
+        /*!
+         * @brief This function returns the value of member allocBytes
+         * @return Value of member allocBytes
+         */
+        eProsima_user_DllExport uint64_t allocBytes() const;
+
+        /*!
+         * @brief This function returns a reference to member allocBytes
+         * @return Reference to member allocBytes
+         */
+        eProsima_user_DllExport uint64_t& allocBytes();
+
 
         /*!
          * @brief This function returns the maximum serialized size of an object
@@ -2256,7 +4974,7 @@ namespace CounterUAS {
          * @return Serialized size.
          */
         eProsima_user_DllExport static size_t getCdrSerializedSize(
-                const CounterUAS::AssocTableMessage& data,
+                const CounterUAS::StageLatency& data,
                 size_t current_alignment = 0);
 
 
@@ -2299,715 +5017,743 @@ namespace CounterUAS {
 
     private:
 
-        uint32_t m_messageId;
-        uint64_t m_timestamp;
-        uint32_t m_numEntries;
-        std::vector<CounterUAS::AssocEntry> m_entries;
+        uint32_t m_stageId;
+        std::string m_name;
+        uint64_t m_count;
+        double m_p50Us;
+        double m_p99Us;
+        double m_p999Us;
+        double m_maxUs;
+        uint64_t m_allocCount;
+        uint64_t m_allocBytes;
     };
-    const uint32_t MSG_ID_PREDICTED_TABLE = 0x0012;
     /*!
-     * @brief This class represents the structure PredictedEntry defined by the user in the IDL file.
+     * @brief This class represents the structure TrackerHealthMessage defined by the user in the IDL file.
      * @ingroup MESSAGES
      */
-    class PredictedEntry
+    class TrackerHealthMessage
     {
     public:
 
         /*!
          * @brief Default constructor.
          */
-        eProsima_user_DllExport PredictedEntry();
+        eProsima_user_DllExport TrackerHealthMessage();
 
         /*!
          * @brief Default destructor.
          */
-        eProsima_user_DllExport ~PredictedEntry();
+        eProsima_user_DllExport ~TrackerHealthMessage();
 
         /*!
          * @brief Copy constructor.
-         * @param x Reference to the object CounterUAS::PredictedEntry that will be copied.
+         * @param x Reference to the object CounterUAS::TrackerHealthMessage that will be copied.
          */
-        eProsima_user_DllExport PredictedEntry(
-                const PredictedEntry& x);
+        eProsima_user_DllExport TrackerHealthMessage(
+                const TrackerHealthMessage& x);
 
         /*!
          * @brief Move constructor.
-         * @param x Reference to the object CounterUAS::PredictedEntry that will be copied.
+         * @param x Reference to the object CounterUAS::TrackerHealthMessage that will be copied.
          */
-        eProsima_user_DllExport PredictedEntry(
-                PredictedEntry&& x) noexcept;
+        eProsima_user_DllExport TrackerHealthMessage(
+                TrackerHealthMessage&& x) noexcept;
 
         /*!
          * @brief Copy assignment.
-         * @param x Reference to the object CounterUAS::PredictedEntry that will be copied.
+         * @param x Reference to the object CounterUAS::TrackerHealthMessage that will be copied.
          */
-        eProsima_user_DllExport PredictedEntry& operator =(
-                const PredictedEntry& x);
+        eProsima_user_DllExport TrackerHealthMessage& operator =(
+                const TrackerHealthMessage& x);
 
         /*!
          * @brief Move assignment.
-         * @param x Reference to the object CounterUAS::PredictedEntry that will be copied.
+         * @param x Reference to the object CounterUAS::TrackerHealthMessage that will be copied.
          */
-        eProsima_user_DllExport PredictedEntry& operator =(
-                PredictedEntry&& x) noexcept;
+        eProsima_user_DllExport TrackerHealthMessage& operator =(
+                TrackerHealthMessage&& x) noexcept;
 
         /*!
          * @brief Comparison operator.
-         * @param x CounterUAS::PredictedEntry object to compare.
+         * @param x CounterUAS::TrackerHealthMessage object to compare.
          */
         eProsima_user_DllExport bool operator ==(
-                const PredictedEntry& x) const;
+                const TrackerHealthMessage& x) const;
 
         /*!
          * @brief Comparison operator.
-         * @param x CounterUAS::PredictedEntry object to compare.
+         * @param x CounterUAS::TrackerHealthMessage object to compare.
          */
         eProsima_user_DllExport bool operator !=(
-                const PredictedEntry& x) const;
+                const TrackerHealthMessage& x) const;
+
+        /*!
+         * @brief This function sets a value in member messageId
+         * @param _messageId New value for member messageId
+         */
+        eProsima_user_DllExport void messageId(
+                uint32_t _messageId);
+
+        /*!
+         * @brief This function returns the value of member messageId
+         * @return Value of member messageId
+         */
+        eProsima_user_DllExport uint32_t messageId() const;
+
+        /*!
+         * @brief This function returns a reference to member messageId
+         * @return Reference to member messageId
+         */
+        eProsima_user_DllExport uint32_t& messageId();
+
+        /*!
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
+         */
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
+
+        /*!
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
+         */
+        eProsima_user_DllExport uint64_t timestamp() const;
 
         /*!
-         * @brief This function sets a value in member trackId
-         * @param _trackId New value for member trackId
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
          */
-        eProsima_user_DllExport void trackId(
-                uint32_t _trackId);
+        eProsima_user_DllExport uint64_t& timestamp();
 
         /*!
-         * @brief This function returns the value of member trackId
-         * @return Value of member trackId
+         * @brief This function sets a value in member cycleCount
+         * @param _cycleCount New value for member cycleCount
          */
-        eProsima_user_DllExport uint32_t trackId() const;
+        eProsima_user_DllExport void cycleCount(
+                uint64_t _cycleCount);
 
         /*!
-         * @brief This function returns a reference to member trackId
-         * @return Reference to member trackId
+         * @brief This function returns the value of member cycleCount
+         * @return Value of member cycleCount
          */
-        eProsima_user_DllExport uint32_t& trackId();
+        eProsima_user_DllExport uint64_t cycleCount() const;
 
         /*!
-         * @brief This function sets a value in member trackStatus
-         * @param _trackStatus New value for member trackStatus
+         * @brief This function returns a reference to member cycleCount
+         * @return Reference to member cycleCount
          */
-        eProsima_user_DllExport void trackStatus(
-                CounterUAS::TrackStatus _trackStatus);
+        eProsima_user_DllExport uint64_t& cycleCount();
 
         /*!
-         * @brief This function returns the value of member trackStatus
-         * @return Value of member trackStatus
+         * @brief This function sets a value in member numStages
+         * @param _numStages New value for member numStages
          */
-        eProsima_user_DllExport CounterUAS::TrackStatus trackStatus() const;
+        eProsima_user_DllExport void numStages(
+                uint32_t _numStages);
 
         /*!
-         * @brief This function returns a reference to member trackStatus
-         * @return Reference to member trackStatus
+         * @brief This function returns the value of member numStages
+         * @return Value of member numStages
          */
-        eProsima_user_DllExport CounterUAS::TrackStatus& trackStatus();
+        eProsima_user_DllExport uint32_t numStages() const;
 
         /*!
-         * @brief This function sets a value in member x
-         * @param _x New value for member x
+         * @brief This function returns a reference to member numStages
+         * @return Reference to member numStages
          */
-        eProsima_user_DllExport void x(
-                double _x);
+        eProsima_user_DllExport uint32_t& numStages();
 
         /*!
-         * @brief This function returns the value of member x
-         * @return Value of member x
+         * @brief This function copies the value in member stages
+         * @param _stages New value to be copied in member stages
          */
-        eProsima_user_DllExport double x() const;
+        eProsima_user_DllExport void stages(
+                const std::vector<CounterUAS::StageLatency>& _stages);
 
         /*!
-         * @brief This function returns a reference to member x
-         * @return Reference to member x
+         * @brief This function moves the value in member stages
+         * @param _stages New value to be moved in member stages
          */
-        eProsima_user_DllExport double& x();
+        eProsima_user_DllExport void stages(
+                std::vector<CounterUAS::StageLatency>&& _stages);
 
         /*!
-         * @brief This function sets a value in member vx
-         * @param _vx New value for member vx
+         * @brief This function returns a constant reference to member stages
+         * @return Constant reference to member stages
          */
-        eProsima_user_DllExport void vx(
-                double _vx);
+        eProsima_user_DllExport const std::vector<CounterUAS::StageLatency>& stages() const;
 
         /*!
-         * @brief This function returns the value of member vx
-         * @return Value of member vx
+         * @brief This function returns a reference to member stages
+         * @return Reference to member stages
          */
-        eProsima_user_DllExport double vx() const;
+        eProsima_user_DllExport std::vector<CounterUAS::StageLatency>& stages();
 
         /*!
-         * @brief This function returns a reference to member vx
-         * @return Reference to member vx
+         * @brief This function returns the maximum serialized size of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
          */
-        eProsima_user_DllExport double& vx();
+        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
+                size_t current_alignment = 0);
 
         /*!
-         * @brief This function sets a value in member ax
-         * @param _ax New value for member ax
+         * @brief This function returns the serialized size of a data depending on the buffer alignment.
+         * @param data Data which is calculated its serialized size.
+         * @param current_alignment Buffer alignment.
+         * @return Serialized size.
          */
-        eProsima_user_DllExport void ax(
-                double _ax);
+        eProsima_user_DllExport static size_t getCdrSerializedSize(
+                const CounterUAS::TrackerHealthMessage& data,
+                size_t current_alignment = 0);
+
 
         /*!
-         * @brief This function returns the value of member ax
-         * @return Value of member ax
+         * @brief This function serializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
          */
-        eProsima_user_DllExport double ax() const;
+        eProsima_user_DllExport void serialize(
+                eprosima::fastcdr::Cdr& cdr) const;
 
         /*!
-         * @brief This function returns a reference to member ax
-         * @return Reference to member ax
+         * @brief This function deserializes an object using CDR serialization.
+         * @param cdr CDR serialization object.
          */
-        eProsima_user_DllExport double& ax();
+        eProsima_user_DllExport void deserialize(
+                eprosima::fastcdr::Cdr& cdr);
+
+
 
         /*!
-         * @brief This function sets a value in member y
-         * @param _y New value for member y
+         * @brief This function returns the maximum serialized size of the Key of an object
+         * depending on the buffer alignment.
+         * @param current_alignment Buffer alignment.
+         * @return Maximum serialized size.
          */
-        eProsima_user_DllExport void y(
-                double _y);
+        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
+                size_t current_alignment = 0);
 
         /*!
-         * @brief This function returns the value of member y
-         * @return Value of member y
+         * @brief This function tells you if the Key has been defined for this type
          */
-        eProsima_user_DllExport double y() const;
+        eProsima_user_DllExport static bool isKeyDefined();
 
         /*!
-         * @brief This function returns a reference to member y
-         * @return Reference to member y
+         * @brief This function serializes the key members of an object using CDR serialization.
+         * @param cdr CDR serialization object.
          */
-        eProsima_user_DllExport double& y();
+        eProsima_user_DllExport void serializeKey(
+                eprosima::fastcdr::Cdr& cdr) const;
+
+    private:
+
+        uint32_t m_messageId;
+        uint64_t m_timestamp;
+        uint64_t m_cycleCount;
+        uint32_t m_numStages;
+        std::vector<CounterUAS::StageLatency> m_stages;
+    };
+    const uint32_t MSG_ID_TRACK_HANDOVER = 0x0030;
+    const uint32_t HANDOVER_STATE_DIM = 9;
+    const uint32_t HANDOVER_SYM_DIM = 45;
+    const uint32_t HANDOVER_NUM_MODELS = 5;
+    const uint32_t HANDOVER_MODEL_STATES = 45;
+    const uint32_t HANDOVER_MODEL_COVARIANCES = 225;
+    /*!
+     * @brief This class represents the structure TrackHandoverMessage defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class TrackHandoverMessage
+    {
+    public:
 
         /*!
-         * @brief This function sets a value in member vy
-         * @param _vy New value for member vy
+         * @brief Default constructor.
          */
-        eProsima_user_DllExport void vy(
-                double _vy);
+        eProsima_user_DllExport TrackHandoverMessage();
 
         /*!
-         * @brief This function returns the value of member vy
-         * @return Value of member vy
+         * @brief Default destructor.
          */
-        eProsima_user_DllExport double vy() const;
+        eProsima_user_DllExport ~TrackHandoverMessage();
 
         /*!
-         * @brief This function returns a reference to member vy
-         * @return Reference to member vy
+         * @brief Copy constructor.
+         * @param x Reference to the object CounterUAS::TrackHandoverMessage that will be copied.
          */
-        eProsima_user_DllExport double& vy();
+        eProsima_user_DllExport TrackHandoverMessage(
+                const TrackHandoverMessage& x);
 
         /*!
-         * @brief This function sets a value in member ay
-         * @param _ay New value for member ay
+         * @brief Move constructor.
+         * @param x Reference to the object CounterUAS::TrackHandoverMessage that will be copied.
          */
-        eProsima_user_DllExport void ay(
-                double _ay);
+        eProsima_user_DllExport TrackHandoverMessage(
+                TrackHandoverMessage&& x) noexcept;
 
         /*!
-         * @brief This function returns the value of member ay
-         * @return Value of member ay
+         * @brief Copy assignment.
+         * @param x Reference to the object CounterUAS::TrackHandoverMessage that will be copied.
          */
-        eProsima_user_DllExport double ay() const;
+        eProsima_user_DllExport TrackHandoverMessage& operator =(
+                const TrackHandoverMessage& x);
 
         /*!
-         * @brief This function returns a reference to member ay
-         * @return Reference to member ay
+         * @brief Move assignment.
+         * @param x Reference to the object CounterUAS::TrackHandoverMessage that will be copied.
          */
-        eProsima_user_DllExport double& ay();
+        eProsima_user_DllExport TrackHandoverMessage& operator =(
+                TrackHandoverMessage&& x) noexcept;
 
         /*!
-         * @brief This function sets a value in member z
-         * @param _z New value for member z
+         * @brief Comparison operator.
+         * @param x CounterUAS::TrackHandoverMessage object to compare.
          */
-        eProsima_user_DllExport void z(
-                double _z);
+        eProsima_user_DllExport bool operator ==(
+                const TrackHandoverMessage& x) const;
 
         /*!
-         * @brief This function returns the value of member z
-         * @return Value of member z
+         * @brief Comparison operator.
+         * @param x CounterUAS::TrackHandoverMessage object to compare.
          */
-        eProsima_user_DllExport double z() const;
+        eProsima_user_DllExport bool operator !=(
+                const TrackHandoverMessage& x) const;
 
         /*!
-         * @brief This function returns a reference to member z
-         * @return Reference to member z
+         * @brief This function sets a value in member messageId
+         * @param _messageId New value for member messageId
          */
-        eProsima_user_DllExport double& z();
+        eProsima_user_DllExport void messageId(
+                uint32_t _messageId);
 
         /*!
-         * @brief This function sets a value in member vz
-         * @param _vz New value for member vz
+         * @brief This function returns the value of member messageId
+         * @return Value of member messageId
          */
-        eProsima_user_DllExport void vz(
-                double _vz);
+        eProsima_user_DllExport uint32_t messageId() const;
 
         /*!
-         * @brief This function returns the value of member vz
-         * @return Value of member vz
+         * @brief This function returns a reference to member messageId
+         * @return Reference to member messageId
          */
-        eProsima_user_DllExport double vz() const;
+        eProsima_user_DllExport uint32_t& messageId();
 
         /*!
-         * @brief This function returns a reference to member vz
-         * @return Reference to member vz
+         * @brief This function sets a value in member fromNode
+         * @param _fromNode New value for member fromNode
          */
-        eProsima_user_DllExport double& vz();
+        eProsima_user_DllExport void fromNode(
+                uint32_t _fromNode);
 
         /*!
-         * @brief This function sets a value in member az
-         * @param _az New value for member az
+         * @brief This function returns the value of member fromNode
+         * @return Value of member fromNode
          */
-        eProsima_user_DllExport void az(
-                double _az);
+        eProsima_user_DllExport uint32_t fromNode() const;
 
         /*!
-         * @brief This function returns the value of member az
-         * @return Value of member az
+         * @brief This function returns a reference to member fromNode
+         * @return Reference to member fromNode
          */
-        eProsima_user_DllExport double az() const;
+        eProsima_user_DllExport uint32_t& fromNode();
 
         /*!
-         * @brief This function returns a reference to member az
-         * @return Reference to member az
+         * @brief This function sets a value in member toNode
+         * @param _toNode New value for member toNode
          */
-        eProsima_user_DllExport double& az();
+        eProsima_user_DllExport void toNode(
+                uint32_t _toNode);
 
         /*!
-         * @brief This function sets a value in member range
-         * @param _range New value for member range
+         * @brief This function returns the value of member toNode
+         * @return Value of member toNode
          */
-        eProsima_user_DllExport void range(
-                double _range);
+        eProsima_user_DllExport uint32_t toNode() const;
 
         /*!
-         * @brief This function returns the value of member range
-         * @return Value of member range
+         * @brief This function returns a reference to member toNode
+         * @return Reference to member toNode
          */
-        eProsima_user_DllExport double range() const;
+        eProsima_user_DllExport uint32_t& toNode();
 
         /*!
-         * @brief This function returns a reference to member range
-         * @return Reference to member range
+         * @brief This function sets a value in member sensorId
+         * @param _sensorId New value for member sensorId
          */
-        eProsima_user_DllExport double& range();
+        eProsima_user_DllExport void sensorId(
+                uint32_t _sensorId);
 
         /*!
-         * @brief This function sets a value in member azimuth
-         * @param _azimuth New value for member azimuth
+         * @brief This function returns the value of member sensorId
+         * @return Value of member sensorId
          */
-        eProsima_user_DllExport void azimuth(
-                double _azimuth);
+        eProsima_user_DllExport uint32_t sensorId() const;
 
         /*!
-         * @brief This function returns the value of member azimuth
-         * @return Value of member azimuth
+         * @brief This function returns a reference to member sensorId
+         * @return Reference to member sensorId
          */
-        eProsima_user_DllExport double azimuth() const;
+        eProsima_user_DllExport uint32_t& sensorId();
 
         /*!
-         * @brief This function returns a reference to member azimuth
-         * @return Reference to member azimuth
+         * @brief This function sets a value in member trackId
+         * @param _trackId New value for member trackId
          */
-        eProsima_user_DllExport double& azimuth();
+        eProsima_user_DllExport void trackId(
+                uint32_t _trackId);
 
         /*!
-         * @brief This function sets a value in member elevation
-         * @param _elevation New value for member elevation
+         * @brief This function returns the value of member trackId
+         * @return Value of member trackId
          */
-        eProsima_user_DllExport void elevation(
-                double _elevation);
+        eProsima_user_DllExport uint32_t trackId() const;
 
         /*!
-         * @brief This function returns the value of member elevation
-         * @return Value of member elevation
+         * @brief This function returns a reference to member trackId
+         * @return Reference to member trackId
          */
-        eProsima_user_DllExport double elevation() const;
+        eProsima_user_DllExport uint32_t& trackId();
 
         /*!
-         * @brief This function returns a reference to member elevation
-         * @return Reference to member elevation
+         * @brief This function sets a value in member status
+         * @param _status New value for member status
          */
-        eProsima_user_DllExport double& elevation();
+        eProsima_user_DllExport void status(
+                CounterUAS::TrackStatus _status);
 
         /*!
-         * @brief This function sets a value in member covX
-         * @param _covX New value for member covX
+         * @brief This function returns the value of member status
+         * @return Value of member status
          */
-        eProsima_user_DllExport void covX(
-                double _covX);
+        eProsima_user_DllExport CounterUAS::TrackStatus status() const;
 
         /*!
-         * @brief This function returns the value of member covX
-         * @return Value of member covX
+         * @brief This function returns a reference to member status
+         * @return Reference to member status
          */
-        eProsima_user_DllExport double covX() const;
+        eProsima_user_DllExport CounterUAS::TrackStatus& status();
 
         /*!
-         * @brief This function returns a reference to member covX
-         * @return Reference to member covX
+         * @brief This function sets a value in member classification
+         * @param _classification New value for member classification
          */
-        eProsima_user_DllExport double& covX();
+        eProsima_user_DllExport void classification(
+                CounterUAS::TrackClassification _classification);
 
         /*!
-         * @brief This function sets a value in member covY
-         * @param _covY New value for member covY
+         * @brief This function returns the value of member classification
+         * @return Value of member classification
          */
-        eProsima_user_DllExport void covY(
-                double _covY);
+        eProsima_user_DllExport CounterUAS::TrackClassification classification() const;
 
         /*!
-         * @brief This function returns the value of member covY
-         * @return Value of member covY
+         * @brief This function returns a reference to member classification
+         * @return Reference to member classification
          */
-        eProsima_user_DllExport double covY() const;
+        eProsima_user_DllExport CounterUAS::TrackClassification& classification();
 
         /*!
-         * @brief This function returns a reference to member covY
-         * @return Reference to member covY
+         * @brief This function sets a value in member hitCount
+         * @param _hitCount New value for member hitCount
          */
-        eProsima_user_DllExport double& covY();
+        eProsima_user_DllExport void hitCount(
+                uint32_t _hitCount);
 
         /*!
-         * @brief This function sets a value in member covZ
-         * @param _covZ New value for member covZ
+         * @brief This function returns the value of member hitCount
+         * @return Value of member hitCount
          */
-        eProsima_user_DllExport void covZ(
-                double _covZ);
+        eProsima_user_DllExport uint32_t hitCount() const;
 
         /*!
-         * @brief This function returns the value of member covZ
-         * @return Value of member covZ
+         * @brief This function returns a reference to member hitCount
+         * @return Reference to member hitCount
          */
-        eProsima_user_DllExport double covZ() const;
+        eProsima_user_DllExport uint32_t& hitCount();
 
         /*!
-         * @brief This function returns a reference to member covZ
-         * @return Reference to member covZ
+         * @brief This function sets a value in member consecutiveMisses
+         * @param _consecutiveMisses New value for member consecutiveMisses
          */
-        eProsima_user_DllExport double& covZ();
+        eProsima_user_DllExport void consecutiveMisses(
+                uint32_t _consecutiveMisses);
 
         /*!
-         * @brief This function sets a value in member modelProb0
-         * @param _modelProb0 New value for member modelProb0
+         * @brief This function returns the value of member consecutiveMisses
+         * @return Value of member consecutiveMisses
          */
-        eProsima_user_DllExport void modelProb0(
-                double _modelProb0);
+        eProsima_user_DllExport uint32_t consecutiveMisses() const;
 
         /*!
-         * @brief This function returns the value of member modelProb0
-         * @return Value of member modelProb0
+         * @brief This function returns a reference to member consecutiveMisses
+         * @return Reference to member consecutiveMisses
          */
-        eProsima_user_DllExport double modelProb0() const;
+        eProsima_user_DllExport uint32_t& consecutiveMisses();
 
         /*!
-         * @brief This function returns a reference to member modelProb0
-         * @return Reference to member modelProb0
+         * @brief This function sets a value in member missCount
+         * @param _missCount New value for member missCount
          */
-        eProsima_user_DllExport double& modelProb0();
+        eProsima_user_DllExport void missCount(
+                uint32_t _missCount);
 
         /*!
-         * @brief This function sets a value in member modelProb1
-         * @param _modelProb1 New value for member modelProb1
+         * @brief This function returns the value of member missCount
+         * @return Value of member missCount
          */
-        eProsima_user_DllExport void modelProb1(
-                double _modelProb1);
+        eProsima_user_DllExport uint32_t missCount() const;
 
         /*!
-         * @brief This function returns the value of member modelProb1
-         * @return Value of member modelProb1
+         * @brief This function returns a reference to member missCount
+         * @return Reference to member missCount
          */
-        eProsima_user_DllExport double modelProb1() const;
+        eProsima_user_DllExport uint32_t& missCount();
 
         /*!
-         * @brief This function returns a reference to member modelProb1
-         * @return Reference to member modelProb1
+         * @brief This function sets a value in member age
+         * @param _age New value for member age
          */
-        eProsima_user_DllExport double& modelProb1();
+        eProsima_user_DllExport void age(
+                uint32_t _age);
 
         /*!
-         * @brief This function sets a value in member modelProb2
-         * @param _modelProb2 New value for member modelProb2
+         * @brief This function returns the value of member age
+         * @return Value of member age
          */
-        eProsima_user_DllExport void modelProb2(
-                double _modelProb2);
+        eProsima_user_DllExport uint32_t age() const;
 
         /*!
-         * @brief This function returns the value of member modelProb2
-         * @return Value of member modelProb2
+         * @brief This function returns a reference to member age
+         * @return Reference to member age
          */
-        eProsima_user_DllExport double modelProb2() const;
+        eProsima_user_DllExport uint32_t& age();
 
         /*!
-         * @brief This function returns a reference to member modelProb2
-         * @return Reference to member modelProb2
+         * @brief This function sets a value in member reserved
+         * @param _reserved New value for member reserved
          */
-        eProsima_user_DllExport double& modelProb2();
+        eProsima_user_DllExport void reserved(
+                uint32_t _reserved);
 
         /*!
-         * @brief This function sets a value in member modelProb3
-         * @param _modelProb3 New value for member modelProb3
+         * @brief This function returns the value of member reserved
+         * @return Value of member reserved
          */
-        eProsima_user_DllExport void modelProb3(
-                double _modelProb3);
+        eProsima_user_DllExport uint32_t reserved() const;
 
         /*!
-         * @brief This function returns the value of member modelProb3
-         * @return Value of member modelProb3
+         * @brief This function returns a reference to member reserved
+         * @return Reference to member reserved
          */
-        eProsima_user_DllExport double modelProb3() const;
+        eProsima_user_DllExport uint32_t& reserved();
 
         /*!
-         * @brief This function returns a reference to member modelProb3
-         * @return Reference to member modelProb3
+         * @brief This function sets a value in member timestamp
+         * @param _timestamp New value for member timestamp
          */
-        eProsima_user_DllExport double& modelProb3();
+        eProsima_user_DllExport void timestamp(
+                uint64_t _timestamp);
 
         /*!
-         * @brief This function sets a value in member modelProb4
-         * @param _modelProb4 New value for member modelProb4
+         * @brief This function returns the value of member timestamp
+         * @return Value of member timestamp
          */
-        eProsima_user_DllExport void modelProb4(
-                double _modelProb4);
+        eProsima_user_DllExport uint64_t timestamp() const;
 
         /*!
-         * @brief This function returns the value of member modelProb4
-         * @return Value of member modelProb4
+         * @brief This function returns a reference to member timestamp
+         * @return Reference to member timestamp
          */
-        eProsima_user_DllExport double modelProb4() const;
+        eProsima_user_DllExport uint64_t& timestamp();
 
         /*!
-         * @brief This function returns a reference to member modelProb4
-         * @return Reference to member modelProb4
+         * @brief This function sets a value in member initiationTime
+         * @param _initiationTime New value for member initiationTime
          */
-        eProsima_user_DllExport double& modelProb4();
-
+        eProsima_user_DllExport void initiationTime(
+                uint64_t _initiationTime);
 
         /*!
-         * @brief This function returns the maximum serialized size of an object
-         * depending on the buffer alignment.
-         * @param current_alignment Buffer alignment.
-         * @return Maximum serialized size.
+         * @brief This function returns the value of member initiationTime
+         * @return Value of member initiationTime
          */
-        eProsima_user_DllExport static size_t getMaxCdrSerializedSize(
-                size_t current_alignment = 0);
+        eProsima_user_DllExport uint64_t initiationTime() const;
 
         /*!
-         * @brief This function returns the serialized size of a data depending on the buffer alignment.
-         * @param data Data which is calculated its serialized size.
-         * @param current_alignment Buffer alignment.
-         * @return Serialized size.
+         * @brief This function returns a reference to member initiationTime
+         * @return Reference to member initiationTime
          */
-        eProsima_user_DllExport static size_t getCdrSerializedSize(
-                const CounterUAS::PredictedEntry& data,
-                size_t current_alignment = 0);
-
+        eProsima_user_DllExport uint64_t& initiationTime();
 
         /*!
-         * @brief This function serializes an object using CDR serialization.
-         * @param cdr CDR serialization object.
+         * @brief This function sets a value in member lastUpdateTime
+         * @param _lastUpdateTime New value for member lastUpdateTime
          */
-        eProsima_user_DllExport void serialize(
-                eprosima::fastcdr::Cdr& cdr) const;
+        eProsima_user_DllExport void lastUpdateTime(
+                uint64_t _lastUpdateTime);
 
         /*!
-         * @brief This function deserializes an object using CDR serialization.
-         * @param cdr CDR serialization object.
+         * @brief This function returns the value of member lastUpdateTime
+         * @return Value of member lastUpdateTime
          */
-        eProsima_user_DllExport void deserialize(
-                eprosima::fastcdr::Cdr& cdr);
-
-
+        eProsima_user_DllExport uint64_t lastUpdateTime() const;
 
         /*!
-         * @brief This function returns the maximum serialized size of the Key of an object
-         * depending on the buffer alignment.
-         * @param current_alignment Buffer alignment.
-         * @return Maximum serialized size.
+         * @brief This function returns a reference to member lastUpdateTime
+         * @return Reference to member lastUpdateTime
          */
-        eProsima_user_DllExport static size_t getKeyMaxCdrSerializedSize(
-                size_t current_alignment = 0);
+        eProsima_user_DllExport uint64_t& lastUpdateTime();
 
         /*!
-         * @brief This function tells you if the Key has been defined for this type
+         * @brief This function sets a value in member quality
+         * @param _quality New value for member quality
          */
-        eProsima_user_DllExport static bool isKeyDefined();
+        eProsima_user_DllExport void quality(
+                double _quality);
 
         /*!
-         * @brief This function serializes the key members of an object using CDR serialization.
-         * @param cdr CDR serialization object.
+         * @brief This function returns the value of member quality
+         * @return Value of member quality
          */
-        eProsima_user_DllExport void serializeKey(
-                eprosima::fastcdr::Cdr& cdr) const;
-
-    private:
-
-        uint32_t m_trackId;
-        CounterUAS::TrackStatus m_trackStatus;
-        double m_x;
-        double m_vx;
-        double m_ax;
-        double m_y;
-        double m_vy;
-        double m_ay;
-        double m_z;
-        double m_vz;
-        double m_az;
-        double m_range;
-        double m_azimuth;
-        double m_elevation;
-        double m_covX;
-        double m_covY;
-        double m_covZ;
-        double m_modelProb0;
-        double m_modelProb1;
-        double m_modelProb2;
-        double m_modelProb3;
-        double m_modelProb4;
-    };
-    /*!
-     * @brief This class represents the structure PredictedTableMessage defined by the user in the IDL file.
-     * @ingroup MESSAGES
-     */
-    class PredictedTableMessage
-    {
-    public:
+        eProsima_user_DllExport double quality() const;
 
         /*!
-         * @brief Default constructor.
+         * @brief This function returns a reference to member quality
+         * @return Reference to member quality
          */
-        eProsima_user_DllExport PredictedTableMessage();
+        eProsima_user_DllExport double& quality();
 
         /*!
-         * @brief Default destructor.
+         * @brief This function copies the value in member state
+         * @param _state New value to be copied in member state
          */
-        eProsima_user_DllExport ~PredictedTableMessage();
+        eProsima_user_DllExport void state(
+                const std::array<double, CounterUAS::HANDOVER_STATE_DIM>& _state);
 
         /*!
-         * @brief Copy constructor.
-         * @param x Reference to the object CounterUAS::PredictedTableMessage that will be copied.
+         * @brief This function moves the value in member state
+         * @param _state New value to be moved in member state
          */
-        eProsima_user_DllExport PredictedTableMessage(
-                const PredictedTableMessage& x);
+        eProsima_user_DllExport void state(
+                std::array<double, CounterUAS::HANDOVER_STATE_DIM>&& _state);
 
         /*!
-         * @brief Move constructor.
-         * @param x Reference to the object CounterUAS::PredictedTableMessage that will be copied.
+         * @brief This function returns a constant reference to member state
+         * @return Constant reference to member state
          */
-        eProsima_user_DllExport PredictedTableMessage(
-                PredictedTableMessage&& x) noexcept;
+        eProsima_user_DllExport const std::array<double, CounterUAS::HANDOVER_STATE_DIM>& state() const;
 
         /*!
-         * @brief Copy assignment.
-         * @param x Reference to the object CounterUAS::PredictedTableMessage that will be copied.
+         * @brief This function returns a reference to member state
+         * @return Reference to member state
          */
-        eProsima_user_DllExport PredictedTableMessage& operator =(
-                const PredictedTableMessage& x);
+        eProsima_user_DllExport std::array<double, CounterUAS::HANDOVER_STATE_DIM>& state();
 
         /*!
-         * @brief Move assignment.
-         * @param x Reference to the object CounterUAS::PredictedTableMessage that will be copied.
+         * @brief This function copies the value in member covariance
+         * @param _covariance New value to be copied in member covariance
          */
-        eProsima_user_DllExport PredictedTableMessage& operator =(
-                PredictedTableMessage&& x) noexcept;
+        eProsima_user_DllExport void covariance(
+                const std::array<double, CounterUAS::HANDOVER_SYM_DIM>& _covariance);
 
         /*!
-         * @brief Comparison operator.
-         * @param x CounterUAS::PredictedTableMessage object to compare.
+         * @brief This function moves the value in member covariance
+         * @param _covariance New value to be moved in member covariance
          */
-        eProsima_user_DllExport bool operator ==(
-                const PredictedTableMessage& x) const;
+        eProsima_user_DllExport void covariance(
+                std::array<double, CounterUAS::HANDOVER_SYM_DIM>&& _covariance);
 
         /*!
-         * @brief Comparison operator.
-         * @param x CounterUAS::PredictedTableMessage object to compare.
+         * @brief This function returns a constant reference to member covariance
+         * @return Constant reference to member covariance
          */
-        eProsima_user_DllExport bool operator !=(
-                const PredictedTableMessage& x) const;
+        eProsima_user_DllExport const std::array<double, CounterUAS::HANDOVER_SYM_DIM>& covariance() const;
 
         /*!
-         * @brief This function sets a value in member messageId
-         * @param _messageId New value for member messageId
+         * @brief This function returns a reference to member covariance
+         * @return Reference to member covariance
          */
-        eProsima_user_DllExport void messageId(
-                uint32_t _messageId);
+        eProsima_user_DllExport std::array<double, CounterUAS::HANDOVER_SYM_DIM>& covariance();
 
         /*!
-         * @brief This function returns the value of member messageId
-         * @return Value of member messageId
+         * @brief This function copies the value in member modeProbabilities
+         * @param _modeProbabilities New value to be copied in member modeProbabilities
          */
-        eProsima_user_DllExport uint32_t messageId() const;
+        eProsima_user_DllExport void modeProbabilities(
+                const std::array<double, CounterUAS::HANDOVER_NUM_MODELS>& _modeProbabilities);
 
         /*!
-         * @brief This function returns a reference to member messageId
-         * @return Reference to member messageId
+         * @brief This function moves the value in member modeProbabilities
+         * @param _modeProbabilities New value to be moved in member modeProbabilities
          */
-        eProsima_user_DllExport uint32_t& messageId();
+        eProsima_user_DllExport void modeProbabilities(
+                std::array<double, CounterUAS::HANDOVER_NUM_MODELS>&& _modeProbabilities);
 
         /*!
-         * @brief This function sets a value in member timestamp
-         * @param _timestamp New value for member timestamp
+         * @brief This function returns a constant reference to member modeProbabilities
+         * @return Constant reference to member modeProbabilities
          */
-        eProsima_user_DllExport void timestamp(
-                uint64_t _timestamp);
+        eProsima_user_DllExport const std::array<double, CounterUAS::HANDOVER_NUM_MODELS>& modeProbabilities() const;
 
         /*!
-         * @brief This function returns the value of member timestamp
-         * @return Value of member timestamp
+         * @brief This function returns a reference to member modeProbabilities
+         * @return Reference to member modeProbabilities
          */
-        eProsima_user_DllExport uint64_t timestamp() const;
+        eProsima_user_DllExport std::array<double, CounterUAS::HANDOVER_NUM_MODELS>& modeProbabilities();
 
         /*!
-         * @brief This function returns a reference to member timestamp
-         * @return Reference to member timestamp
+         * @brief This function copies the value in member modelStates
+         * @param _modelStates New value to be copied in member modelStates
          */
-        eProsima_user_DllExport uint64_t& timestamp();
+        eProsima_user_DllExport void modelStates(
+                const std::array<double, CounterUAS::HANDOVER_MODEL_STATES>& _modelStates);
 
         /*!
-         * @brief This function sets a value in member numEntries
-         * @param _numEntries New value for member numEntries
+         * @brief This function moves the value in member modelStates
+         * @param _modelStates New value to be moved in member modelStates
          */
-        eProsima_user_DllExport void numEntries(
-                uint32_t _numEntries);
+        eProsima_user_DllExport void modelStates(
+                std::array<double, CounterUAS::HANDOVER_MODEL_STATES>&& _modelStates);
 
         /*!
-         * @brief This function returns the value of member numEntries
-         * @return Value of member numEntries
+         * @brief This function returns a constant reference to member modelStates
+         * @return Constant reference to member modelStates
          */
-        eProsima_user_DllExport uint32_t numEntries() const;
+        eProsima_user_DllExport const std::array<double, CounterUAS::HANDOVER_MODEL_STATES>& modelStates() const;
 
         /*!
-         * @brief This function returns a reference to member numEntries
-         * @return Reference to member numEntries
+         * @brief This function returns a reference to member modelStates
+         * @return Reference to member modelStates
          */
-        eProsima_user_DllExport uint32_t& numEntries();
+        eProsima_user_DllExport std::array<double, CounterUAS::HANDOVER_MODEL_STATES>& modelStates();
 
         /*!
-         * @brief This function copies the value in member entries
-         * @param _entries New value to be copied in member entries
+         * @brief This function copies the value in member modelCovariances
+         * @param _modelCovariances New value to be copied in member modelCovariances
          */
-        eProsima_user_DllExport void entries(
-                const std::vector<CounterUAS::PredictedEntry>& _entries);
+        eProsima_user_DllExport void modelCovariances(
+                const std::array<double, CounterUAS::HANDOVER_MODEL_COVARIANCES>& _modelCovariances);
 
         /*!
-         * @brief This function moves the value in member entries
-         * @param _entries New value to be moved in member entries
+         * @brief This function moves the value in member modelCovariances
+         * @param _modelCovariances New value to be moved in member modelCovariances
          */
-        eProsima_user_DllExport void entries(
-                std::vector<CounterUAS::PredictedEntry>&& _entries);
+        eProsima_user_DllExport void modelCovariances(
+                std::array<double, CounterUAS::HANDOVER_MODEL_COVARIANCES>&& _modelCovariances);
 
         /*!
-         * @brief This function returns a constant reference to member entries
-         * @return Constant reference to member entries
+         * @brief This function returns a constant reference to member modelCovariances
+         * @return Constant reference to member modelCovariances
          */
-        eProsima_user_DllExport const std::vector<CounterUAS::PredictedEntry>& entries() const;
+        eProsima_user_DllExport const std::array<double, CounterUAS::HANDOVER_MODEL_COVARIANCES>& modelCovariances() const;
 
         /*!
-         * @brief This function returns a reference to member entries
-         * @return Reference to member entries
+         * @brief This function returns a reference to member modelCovariances
+         * @return Reference to member modelCovariances
          */
-        eProsima_user_DllExport std::vector<CounterUAS::PredictedEntry>& entries();
+        eProsima_user_DllExport std::array<double, CounterUAS::HANDOVER_MODEL_COVARIANCES>& modelCovariances();
+
 
         /*!
          * @brief This function returns the maximum serialized size of an object
@@ -3025,7 +5771,7 @@ namespace CounterUAS {
          * @return Serialized size.
          */
         eProsima_user_DllExport static size_t getCdrSerializedSize(
-                const CounterUAS::PredictedTableMessage& data,
+                const CounterUAS::TrackHandoverMessage& data,
                 size_t current_alignment = 0);
 
 
@@ -3069,9 +5815,26 @@ namespace CounterUAS {
     private:
 
         uint32_t m_messageId;
+        uint32_t m_fromNode;
+        uint32_t m_toNode;
+        uint32_t m_sensorId;
+        uint32_t m_trackId;
+        CounterUAS::TrackStatus m_status;
+        CounterUAS::TrackClassification m_classification;
+        uint32_t m_hitCount;
+        uint32_t m_consecutiveMisses;
+        uint32_t m_missCount;
+        uint32_t m_age;
+        uint32_t m_reserved;
         uint64_t m_timestamp;
-        uint32_t m_numEntries;
-        std::vector<CounterUAS::PredictedEntry> m_entries;
+        uint64_t m_initiationTime;
+        uint64_t m_lastUpdateTime;
+        double m_quality;
+        std::array<double, CounterUAS::HANDOVER_STATE_DIM> m_state;
+        std::array<double, CounterUAS::HANDOVER_SYM_DIM> m_covariance;
+        std::array<double, CounterUAS::HANDOVER_NUM_MODELS> m_modeProbabilities;
+        std::array<double, CounterUAS::HANDOVER_MODEL_STATES> m_modelStates;
+        std::array<double, CounterUAS::HANDOVER_MODEL_COVARIANCES> m_modelCovariances;
     };
     const uint32_t LOG_MAGIC = 0xCAFEBABE;
     const uint32_t LOG_EOM = 0xDEADBEEF;
@@ -3090,7 +5853,9 @@ namespace CounterUAS {
         LOG_TRACK_UPDATED,
         LOG_TRACK_DELETED,
         LOG_TRACK_SENT,
-        LOG_RUN_INFO
+        LOG_RUN_INFO,
+        LOG_BLOCK,
+        LOG_BLOCK_INDEX
     };
     /*!
      * @brief This class represents the structure LogRecordHeader defined by the user in the IDL file.
@@ -313,20 +313,20 @@ namespace CounterUAS {
 
 
 
-    TrackUpdateMessagePubSubType::TrackUpdateMessagePubSubType()
+    SPDetectionFramePubSubType::SPDetectionFramePubSubType()
     {
-        setName("CounterUAS::TrackUpdateMessage");
-        auto type_size = TrackUpdateMessage::getMaxCdrSerializedSize();
+        setName("CounterUAS::SPDetectionFrame");
+        auto type_size = SPDetectionFrame::getMaxCdrSerializedSize();
         type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
         m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
-        m_isGetKeyDefined = TrackUpdateMessage::isKeyDefined();
-        size_t keyLength = TrackUpdateMessage::getKeyMaxCdrSerializedSize() > 16 ?
-                TrackUpdateMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_isGetKeyDefined = SPDetectionFrame::isKeyDefined();
+        size_t keyLength = SPDetectionFrame::getKeyMaxCdrSerializedSize() > 16 ?
+                SPDetectionFrame::getKeyMaxCdrSerializedSize() : 16;
         m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
         memset(m_keyBuffer, 0, keyLength);
     }
 
-    TrackUpdateMessagePubSubType::~TrackUpdateMessagePubSubType()
+    SPDetectionFramePubSubType::~SPDetectionFramePubSubType()
     {
         if (m_keyBuffer != nullptr)
         {
@@ -334,11 +334,11 @@ namespace CounterUAS {
         }
     }
 
-    bool TrackUpdateMessagePubSubType::serialize(
+    bool SPDetectionFramePubSubType::serialize(
             void* data,
             SerializedPayload_t* payload)
     {
-        TrackUpdateMessage* p_type = static_cast<TrackUpdateMessage*>(data);
+        SPDetectionFrame* p_type = static_cast<SPDetectionFrame*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
@@ -363,14 +363,14 @@ namespace CounterUAS {
         return true;
     }
 
-    bool TrackUpdateMessagePubSubType::deserialize(
+    bool SPDetectionFramePubSubType::deserialize(
             SerializedPayload_t* payload,
             void* data)
     {
         try
         {
             //Convert DATA to pointer of your type
-            TrackUpdateMessage* p_type = static_cast<TrackUpdateMessage*>(data);
+            SPDetectionFrame* p_type = static_cast<SPDetectionFrame*>(data);
 
             // Object that manages the raw buffer.
             eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
@@ -393,28 +393,28 @@ namespace CounterUAS {
         return true;
     }
 
-    std::function<uint32_t()> TrackUpdateMessagePubSubType::getSerializedSizeProvider(
+    std::function<uint32_t()> SPDetectionFramePubSubType::getSerializedSizeProvider(
             void* data)
     {
         return [data]() -> uint32_t
                {
-                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<TrackUpdateMessage*>(data))) +
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<SPDetectionFrame*>(data))) +
                           4u /*encapsulation*/;
                };
     }
 
-    void* TrackUpdateMessagePubSubType::createData()
+    void* SPDetectionFramePubSubType::createData()
     {
-        return reinterpret_cast<void*>(new TrackUpdateMessage());
+        return reinterpret_cast<void*>(new SPDetectionFrame());
     }
 
-    void TrackUpdateMessagePubSubType::deleteData(
+    void SPDetectionFramePubSubType::deleteData(
             void* data)
     {
-        delete(reinterpret_cast<TrackUpdateMessage*>(data));
+        delete(reinterpret_cast<SPDetectionFrame*>(data));
     }
 
-    bool TrackUpdateMessagePubSubType::getKey(
+    bool SPDetectionFramePubSubType::getKey(
             void* data,
             InstanceHandle_t* handle,
             bool force_md5)
@@ -424,16 +424,16 @@ namespace CounterUAS {
             return false;
         }
 
-        TrackUpdateMessage* p_type = static_cast<TrackUpdateMessage*>(data);
+        SPDetectionFrame* p_type = static_cast<SPDetectionFrame*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
-                TrackUpdateMessage::getKeyMaxCdrSerializedSize());
+                SPDetectionFrame::getKeyMaxCdrSerializedSize());
 
         // Object that serializes the data.
         eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
         p_type->serializeKey(ser);
-        if (force_md5 || TrackUpdateMessage::getKeyMaxCdrSerializedSize() > 16)
+        if (force_md5 || SPDetectionFrame::getKeyMaxCdrSerializedSize() > 16)
         {
             m_md5.init();
             m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
@@ -454,20 +454,22 @@ namespace CounterUAS {
     }
 
 
-    TrackTableMessagePubSubType::TrackTableMessagePubSubType()
+
+
+    LatencyTracePubSubType::LatencyTracePubSubType()
     {
-        setName("CounterUAS::TrackTableMessage");
-        auto type_size = TrackTableMessage::getMaxCdrSerializedSize();
+        setName("CounterUAS::LatencyTrace");
+        auto type_size = LatencyTrace::getMaxCdrSerializedSize();
         type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
         m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
-        m_isGetKeyDefined = TrackTableMessage::isKeyDefined();
-        size_t keyLength = TrackTableMessage::getKeyMaxCdrSerializedSize() > 16 ?
-                TrackTableMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_isGetKeyDefined = LatencyTrace::isKeyDefined();
+        size_t keyLength = LatencyTrace::getKeyMaxCdrSerializedSize() > 16 ?
+                LatencyTrace::getKeyMaxCdrSerializedSize() : 16;
         m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
         memset(m_keyBuffer, 0, keyLength);
     }
 
-    TrackTableMessagePubSubType::~TrackTableMessagePubSubType()
+    LatencyTracePubSubType::~LatencyTracePubSubType()
     {
         if (m_keyBuffer != nullptr)
         {
@@ -475,11 +477,11 @@ namespace CounterUAS {
         }
     }
 
-    bool TrackTableMessagePubSubType::serialize(
+    bool LatencyTracePubSubType::serialize(
             void* data,
             SerializedPayload_t* payload)
     {
-        TrackTableMessage* p_type = static_cast<TrackTableMessage*>(data);
+        LatencyTrace* p_type = static_cast<LatencyTrace*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
@@ -504,14 +506,14 @@ namespace CounterUAS {
         return true;
     }
 
-    bool TrackTableMessagePubSubType::deserialize(
+    bool LatencyTracePubSubType::deserialize(
             SerializedPayload_t* payload,
             void* data)
     {
         try
         {
             //Convert DATA to pointer of your type
-            TrackTableMessage* p_type = static_cast<TrackTableMessage*>(data);
+            LatencyTrace* p_type = static_cast<LatencyTrace*>(data);
 
             // Object that manages the raw buffer.
             eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
@@ -534,28 +536,28 @@ namespace CounterUAS {
         return true;
     }
 
-    std::function<uint32_t()> TrackTableMessagePubSubType::getSerializedSizeProvider(
+    std::function<uint32_t()> LatencyTracePubSubType::getSerializedSizeProvider(
             void* data)
     {
         return [data]() -> uint32_t
                {
-                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<TrackTableMessage*>(data))) +
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<LatencyTrace*>(data))) +
                           4u /*encapsulation*/;
                };
     }
 
-    void* TrackTableMessagePubSubType::createData()
+    void* LatencyTracePubSubType::createData()
     {
-        return reinterpret_cast<void*>(new TrackTableMessage());
+        return reinterpret_cast<void*>(new LatencyTrace());
     }
 
-    void TrackTableMessagePubSubType::deleteData(
+    void LatencyTracePubSubType::deleteData(
             void* data)
     {
-        delete(reinterpret_cast<TrackTableMessage*>(data));
+        delete(reinterpret_cast<LatencyTrace*>(data));
     }
 
-    bool TrackTableMessagePubSubType::getKey(
+    bool LatencyTracePubSubType::getKey(
             void* data,
             InstanceHandle_t* handle,
             bool force_md5)
@@ -565,16 +567,16 @@ namespace CounterUAS {
             return false;
         }
 
-        TrackTableMessage* p_type = static_cast<TrackTableMessage*>(data);
+        LatencyTrace* p_type = static_cast<LatencyTrace*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
-                TrackTableMessage::getKeyMaxCdrSerializedSize());
+                LatencyTrace::getKeyMaxCdrSerializedSize());
 
         // Object that serializes the data.
         eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
         p_type->serializeKey(ser);
-        if (force_md5 || TrackTableMessage::getKeyMaxCdrSerializedSize() > 16)
+        if (force_md5 || LatencyTrace::getKeyMaxCdrSerializedSize() > 16)
         {
             m_md5.init();
             m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
@@ -595,20 +597,20 @@ namespace CounterUAS {
     }
 
 
-    ClusterDataPubSubType::ClusterDataPubSubType()
+    TrackUpdateMessagePubSubType::TrackUpdateMessagePubSubType()
     {
-        setName("CounterUAS::ClusterData");
-        auto type_size = ClusterData::getMaxCdrSerializedSize();
+        setName("CounterUAS::TrackUpdateMessage");
+        auto type_size = TrackUpdateMessage::getMaxCdrSerializedSize();
         type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
         m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
-        m_isGetKeyDefined = ClusterData::isKeyDefined();
-        size_t keyLength = ClusterData::getKeyMaxCdrSerializedSize() > 16 ?
-                ClusterData::getKeyMaxCdrSerializedSize() : 16;
+        m_isGetKeyDefined = TrackUpdateMessage::isKeyDefined();
+        size_t keyLength = TrackUpdateMessage::getKeyMaxCdrSerializedSize() > 16 ?
+                TrackUpdateMessage::getKeyMaxCdrSerializedSize() : 16;
         m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
         memset(m_keyBuffer, 0, keyLength);
     }
 
-    ClusterDataPubSubType::~ClusterDataPubSubType()
+    TrackUpdateMessagePubSubType::~TrackUpdateMessagePubSubType()
     {
         if (m_keyBuffer != nullptr)
         {
@@ -616,11 +618,11 @@ namespace CounterUAS {
         }
     }
 
-    bool ClusterDataPubSubType::serialize(
+    bool TrackUpdateMessagePubSubType::serialize(
             void* data,
             SerializedPayload_t* payload)
     {
-        ClusterData* p_type = static_cast<ClusterData*>(data);
+        TrackUpdateMessage* p_type = static_cast<TrackUpdateMessage*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
@@ -645,14 +647,14 @@ namespace CounterUAS {
         return true;
     }
 
-    bool ClusterDataPubSubType::deserialize(
+    bool TrackUpdateMessagePubSubType::deserialize(
             SerializedPayload_t* payload,
             void* data)
     {
         try
         {
             //Convert DATA to pointer of your type
-            ClusterData* p_type = static_cast<ClusterData*>(data);
+            TrackUpdateMessage* p_type = static_cast<TrackUpdateMessage*>(data);
 
             // Object that manages the raw buffer.
             eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
@@ -675,28 +677,28 @@ namespace CounterUAS {
         return true;
     }
 
-    std::function<uint32_t()> ClusterDataPubSubType::getSerializedSizeProvider(
+    std::function<uint32_t()> TrackUpdateMessagePubSubType::getSerializedSizeProvider(
             void* data)
     {
         return [data]() -> uint32_t
                {
-                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<ClusterData*>(data))) +
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<TrackUpdateMessage*>(data))) +
                           4u /*encapsulation*/;
                };
     }
 
-    void* ClusterDataPubSubType::createData()
+    void* TrackUpdateMessagePubSubType::createData()
     {
-        return reinterpret_cast<void*>(new ClusterData());
+        return reinterpret_cast<void*>(new TrackUpdateMessage());
     }
 
-    void ClusterDataPubSubType::deleteData(
+    void TrackUpdateMessagePubSubType::deleteData(
             void* data)
     {
-        delete(reinterpret_cast<ClusterData*>(data));
+        delete(reinterpret_cast<TrackUpdateMessage*>(data));
     }
 
-    bool ClusterDataPubSubType::getKey(
+    bool TrackUpdateMessagePubSubType::getKey(
             void* data,
             InstanceHandle_t* handle,
             bool force_md5)
@@ -706,16 +708,16 @@ namespace CounterUAS {
             return false;
         }
 
-        ClusterData* p_type = static_cast<ClusterData*>(data);
+        TrackUpdateMessage* p_type = static_cast<TrackUpdateMessage*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
-                ClusterData::getKeyMaxCdrSerializedSize());
+                TrackUpdateMessage::getKeyMaxCdrSerializedSize());
 
         // Object that serializes the data.
         eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
         p_type->serializeKey(ser);
-        if (force_md5 || ClusterData::getKeyMaxCdrSerializedSize() > 16)
+        if (force_md5 || TrackUpdateMessage::getKeyMaxCdrSerializedSize() > 16)
         {
             m_md5.init();
             m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
@@ -735,20 +737,21 @@ namespace CounterUAS {
         return true;
     }
 
-    ClusterTableMessagePubSubType::ClusterTableMessagePubSubType()
+
+    TrackTableMessagePubSubType::TrackTableMessagePubSubType()
     {
-        setName("CounterUAS::ClusterTableMessage");
-        auto type_size = ClusterTableMessage::getMaxCdrSerializedSize();
+        setName("CounterUAS::TrackTableMessage");
+        auto type_size = TrackTableMessage::getMaxCdrSerializedSize();
         type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
         m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
-        m_isGetKeyDefined = ClusterTableMessage::isKeyDefined();
-        size_t keyLength = ClusterTableMessage::getKeyMaxCdrSerializedSize() > 16 ?
-                ClusterTableMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_isGetKeyDefined = TrackTableMessage::isKeyDefined();
+        size_t keyLength = TrackTableMessage::getKeyMaxCdrSerializedSize() > 16 ?
+                TrackTableMessage::getKeyMaxCdrSerializedSize() : 16;
         m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
         memset(m_keyBuffer, 0, keyLength);
     }
 
-    ClusterTableMessagePubSubType::~ClusterTableMessagePubSubType()
+    TrackTableMessagePubSubType::~TrackTableMessagePubSubType()
     {
         if (m_keyBuffer != nullptr)
         {
@@ -756,11 +759,11 @@ namespace CounterUAS {
         }
     }
 
-    bool ClusterTableMessagePubSubType::serialize(
+    bool TrackTableMessagePubSubType::serialize(
             void* data,
             SerializedPayload_t* payload)
     {
-        ClusterTableMessage* p_type = static_cast<ClusterTableMessage*>(data);
+        TrackTableMessage* p_type = static_cast<TrackTableMessage*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
@@ -785,14 +788,14 @@ namespace CounterUAS {
         return true;
     }
 
-    bool ClusterTableMessagePubSubType::deserialize(
+    bool TrackTableMessagePubSubType::deserialize(
             SerializedPayload_t* payload,
             void* data)
     {
         try
         {
             //Convert DATA to pointer of your type
-            ClusterTableMessage* p_type = static_cast<ClusterTableMessage*>(data);
+            TrackTableMessage* p_type = static_cast<TrackTableMessage*>(data);
 
             // Object that manages the raw buffer.
             eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
@@ -815,28 +818,28 @@ namespace CounterUAS {
         return true;
     }
 
-    std::function<uint32_t()> ClusterTableMessagePubSubType::getSerializedSizeProvider(
+    std::function<uint32_t()> TrackTableMessagePubSubType::getSerializedSizeProvider(
             void* data)
     {
         return [data]() -> uint32_t
                {
-                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<ClusterTableMessage*>(data))) +
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<TrackTableMessage*>(data))) +
                           4u /*encapsulation*/;
                };
     }
 
-    void* ClusterTableMessagePubSubType::createData()
+    void* TrackTableMessagePubSubType::createData()
     {
-        return reinterpret_cast<void*>(new ClusterTableMessage());
+        return reinterpret_cast<void*>(new TrackTableMessage());
     }
 
-    void ClusterTableMessagePubSubType::deleteData(
+    void TrackTableMessagePubSubType::deleteData(
             void* data)
     {
-        delete(reinterpret_cast<ClusterTableMessage*>(data));
+        delete(reinterpret_cast<TrackTableMessage*>(data));
     }
 
-    bool ClusterTableMessagePubSubType::getKey(
+    bool TrackTableMessagePubSubType::getKey(
             void* data,
             InstanceHandle_t* handle,
             bool force_md5)
@@ -846,16 +849,16 @@ namespace CounterUAS {
             return false;
         }
 
-        ClusterTableMessage* p_type = static_cast<ClusterTableMessage*>(data);
+        TrackTableMessage* p_type = static_cast<TrackTableMessage*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
-                ClusterTableMessage::getKeyMaxCdrSerializedSize());
+                TrackTableMessage::getKeyMaxCdrSerializedSize());
 
         // Object that serializes the data.
         eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
         p_type->serializeKey(ser);
-        if (force_md5 || ClusterTableMessage::getKeyMaxCdrSerializedSize() > 16)
+        if (force_md5 || TrackTableMessage::getKeyMaxCdrSerializedSize() > 16)
         {
             m_md5.init();
             m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
@@ -876,20 +879,20 @@ namespace CounterUAS {
     }
 
 
-    AssocEntryPubSubType::AssocEntryPubSubType()
+    TrackFrameEntryPubSubType::TrackFrameEntryPubSubType()
     {
-        setName("CounterUAS::AssocEntry");
-        auto type_size = AssocEntry::getMaxCdrSerializedSize();
+        setName("CounterUAS::TrackFrameEntry");
+        auto type_size = TrackFrameEntry::getMaxCdrSerializedSize();
         type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
         m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
-        m_isGetKeyDefined = AssocEntry::isKeyDefined();
-        size_t keyLength = AssocEntry::getKeyMaxCdrSerializedSize() > 16 ?
-                AssocEntry::getKeyMaxCdrSerializedSize() : 16;
+        m_isGetKeyDefined = TrackFrameEntry::isKeyDefined();
+        size_t keyLength = TrackFrameEntry::getKeyMaxCdrSerializedSize() > 16 ?
+                TrackFrameEntry::getKeyMaxCdrSerializedSize() : 16;
         m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
         memset(m_keyBuffer, 0, keyLength);
     }
 
-    AssocEntryPubSubType::~AssocEntryPubSubType()
+    TrackFrameEntryPubSubType::~TrackFrameEntryPubSubType()
     {
         if (m_keyBuffer != nullptr)
         {
@@ -897,11 +900,11 @@ namespace CounterUAS {
         }
     }
 
-    bool AssocEntryPubSubType::serialize(
+    bool TrackFrameEntryPubSubType::serialize(
             void* data,
             SerializedPayload_t* payload)
     {
-        AssocEntry* p_type = static_cast<AssocEntry*>(data);
+        TrackFrameEntry* p_type = static_cast<TrackFrameEntry*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
@@ -926,14 +929,14 @@ namespace CounterUAS {
         return true;
     }
 
-    bool AssocEntryPubSubType::deserialize(
+    bool TrackFrameEntryPubSubType::deserialize(
             SerializedPayload_t* payload,
             void* data)
     {
         try
         {
             //Convert DATA to pointer of your type
-            AssocEntry* p_type = static_cast<AssocEntry*>(data);
+            TrackFrameEntry* p_type = static_cast<TrackFrameEntry*>(data);
 
             // Object that manages the raw buffer.
             eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
@@ -956,28 +959,28 @@ namespace CounterUAS {
         return true;
     }
 
-    std::function<uint32_t()> AssocEntryPubSubType::getSerializedSizeProvider(
+    std::function<uint32_t()> TrackFrameEntryPubSubType::getSerializedSizeProvider(
             void* data)
     {
         return [data]() -> uint32_t
                {
-                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<AssocEntry*>(data))) +
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<TrackFrameEntry*>(data))) +
                           4u /*encapsulation*/;
                };
     }
 
-    void* AssocEntryPubSubType::createData()
+    void* TrackFrameEntryPubSubType::createData()
     {
-        return reinterpret_cast<void*>(new AssocEntry());
+        return reinterpret_cast<void*>(new TrackFrameEntry());
     }
 
-    void AssocEntryPubSubType::deleteData(
+    void TrackFrameEntryPubSubType::deleteData(
             void* data)
     {
-        delete(reinterpret_cast<AssocEntry*>(data));
+        delete(reinterpret_cast<TrackFrameEntry*>(data));
     }
 
-    bool AssocEntryPubSubType::getKey(
+    bool TrackFrameEntryPubSubType::getKey(
             void* data,
             InstanceHandle_t* handle,
             bool force_md5)
@@ -987,16 +990,16 @@ namespace CounterUAS {
             return false;
         }
 
-        AssocEntry* p_type = static_cast<AssocEntry*>(data);
+        TrackFrameEntry* p_type = static_cast<TrackFrameEntry*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
-                AssocEntry::getKeyMaxCdrSerializedSize());
+                TrackFrameEntry::getKeyMaxCdrSerializedSize());
 
         // Object that serializes the data.
         eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
         p_type->serializeKey(ser);
-        if (force_md5 || AssocEntry::getKeyMaxCdrSerializedSize() > 16)
+        if (force_md5 || TrackFrameEntry::getKeyMaxCdrSerializedSize() > 16)
         {
             m_md5.init();
             m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
@@ -1016,20 +1019,23 @@ namespace CounterUAS {
         return true;
     }
 
-    AssocTableMessagePubSubType::AssocTableMessagePubSubType()
+
+
+
+    SPDetectionFramePubSubType::SPDetectionFramePubSubType()
     {
-        setName("CounterUAS::AssocTableMessage");
-        auto type_size = AssocTableMessage::getMaxCdrSerializedSize();
+        setName("CounterUAS::SPDetectionFrame");
+        auto type_size = SPDetectionFrame::getMaxCdrSerializedSize();
         type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
         m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
-        m_isGetKeyDefined = AssocTableMessage::isKeyDefined();
-        size_t keyLength = AssocTableMessage::getKeyMaxCdrSerializedSize() > 16 ?
-                AssocTableMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_isGetKeyDefined = SPDetectionFrame::isKeyDefined();
+        size_t keyLength = SPDetectionFrame::getKeyMaxCdrSerializedSize() > 16 ?
+                SPDetectionFrame::getKeyMaxCdrSerializedSize() : 16;
         m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
         memset(m_keyBuffer, 0, keyLength);
     }
 
-    AssocTableMessagePubSubType::~AssocTableMessagePubSubType()
+    SPDetectionFramePubSubType::~SPDetectionFramePubSubType()
     {
         if (m_keyBuffer != nullptr)
         {
@@ -1037,11 +1043,11 @@ namespace CounterUAS {
         }
     }
 
-    bool AssocTableMessagePubSubType::serialize(
+    bool SPDetectionFramePubSubType::serialize(
             void* data,
             SerializedPayload_t* payload)
     {
-        AssocTableMessage* p_type = static_cast<AssocTableMessage*>(data);
+        SPDetectionFrame* p_type = static_cast<SPDetectionFrame*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
@@ -1066,14 +1072,14 @@ namespace CounterUAS {
         return true;
     }
 
-    bool AssocTableMessagePubSubType::deserialize(
+    bool SPDetectionFramePubSubType::deserialize(
             SerializedPayload_t* payload,
             void* data)
     {
         try
         {
             //Convert DATA to pointer of your type
-            AssocTableMessage* p_type = static_cast<AssocTableMessage*>(data);
+            SPDetectionFrame* p_type = static_cast<SPDetectionFrame*>(data);
 
             // Object that manages the raw buffer.
             eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
@@ -1096,28 +1102,28 @@ namespace CounterUAS {
         return true;
     }
 
-    std::function<uint32_t()> AssocTableMessagePubSubType::getSerializedSizeProvider(
+    std::function<uint32_t()> SPDetectionFramePubSubType::getSerializedSizeProvider(
             void* data)
     {
         return [data]() -> uint32_t
                {
-                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<AssocTableMessage*>(data))) +
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<SPDetectionFrame*>(data))) +
                           4u /*encapsulation*/;
                };
     }
 
-    void* AssocTableMessagePubSubType::createData()
+    void* SPDetectionFramePubSubType::createData()
     {
-        return reinterpret_cast<void*>(new AssocTableMessage());
+        return reinterpret_cast<void*>(new SPDetectionFrame());
     }
 
-    void AssocTableMessagePubSubType::deleteData(
+    void SPDetectionFramePubSubType::deleteData(
             void* data)
     {
-        delete(reinterpret_cast<AssocTableMessage*>(data));
+        delete(reinterpret_cast<SPDetectionFrame*>(data));
     }
 
-    bool AssocTableMessagePubSubType::getKey(
+    bool SPDetectionFramePubSubType::getKey(
             void* data,
             InstanceHandle_t* handle,
             bool force_md5)
@@ -1127,16 +1133,16 @@ namespace CounterUAS {
             return false;
         }
 
-        AssocTableMessage* p_type = static_cast<AssocTableMessage*>(data);
+        SPDetectionFrame* p_type = static_cast<SPDetectionFrame*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
-                AssocTableMessage::getKeyMaxCdrSerializedSize());
+                SPDetectionFrame::getKeyMaxCdrSerializedSize());
 
         // Object that serializes the data.
         eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
         p_type->serializeKey(ser);
-        if (force_md5 || AssocTableMessage::getKeyMaxCdrSerializedSize() > 16)
+        if (force_md5 || SPDetectionFrame::getKeyMaxCdrSerializedSize() > 16)
         {
             m_md5.init();
             m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
@@ -1157,20 +1163,22 @@ namespace CounterUAS {
     }
 
 
-    PredictedEntryPubSubType::PredictedEntryPubSubType()
+
+
+    TrackTableFramePubSubType::TrackTableFramePubSubType()
     {
-        setName("CounterUAS::PredictedEntry");
-        auto type_size = PredictedEntry::getMaxCdrSerializedSize();
+        setName("CounterUAS::TrackTableFrame");
+        auto type_size = TrackTableFrame::getMaxCdrSerializedSize();
         type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
         m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
-        m_isGetKeyDefined = PredictedEntry::isKeyDefined();
-        size_t keyLength = PredictedEntry::getKeyMaxCdrSerializedSize() > 16 ?
-                PredictedEntry::getKeyMaxCdrSerializedSize() : 16;
+        m_isGetKeyDefined = TrackTableFrame::isKeyDefined();
+        size_t keyLength = TrackTableFrame::getKeyMaxCdrSerializedSize() > 16 ?
+                TrackTableFrame::getKeyMaxCdrSerializedSize() : 16;
         m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
         memset(m_keyBuffer, 0, keyLength);
     }
 
-    PredictedEntryPubSubType::~PredictedEntryPubSubType()
+    TrackTableFramePubSubType::~TrackTableFramePubSubType()
     {
         if (m_keyBuffer != nullptr)
         {
@@ -1178,11 +1186,11 @@ namespace CounterUAS {
         }
     }
 
-    bool PredictedEntryPubSubType::serialize(
+    bool TrackTableFramePubSubType::serialize(
             void* data,
             SerializedPayload_t* payload)
     {
-        PredictedEntry* p_type = static_cast<PredictedEntry*>(data);
+        TrackTableFrame* p_type = static_cast<TrackTableFrame*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
@@ -1207,14 +1215,14 @@ namespace CounterUAS {
         return true;
     }
 
-    bool PredictedEntryPubSubType::deserialize(
+    bool TrackTableFramePubSubType::deserialize(
             SerializedPayload_t* payload,
             void* data)
     {
         try
         {
             //Convert DATA to pointer of your type
-            PredictedEntry* p_type = static_cast<PredictedEntry*>(data);
+            TrackTableFrame* p_type = static_cast<TrackTableFrame*>(data);
 
             // Object that manages the raw buffer.
             eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
@@ -1237,28 +1245,28 @@ namespace CounterUAS {
         return true;
     }
 
-    std::function<uint32_t()> PredictedEntryPubSubType::getSerializedSizeProvider(
+    std::function<uint32_t()> TrackTableFramePubSubType::getSerializedSizeProvider(
             void* data)
     {
         return [data]() -> uint32_t
                {
-                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<PredictedEntry*>(data))) +
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<TrackTableFrame*>(data))) +
                           4u /*encapsulation*/;
                };
     }
 
-    void* PredictedEntryPubSubType::createData()
+    void* TrackTableFramePubSubType::createData()
     {
-        return reinterpret_cast<void*>(new PredictedEntry());
+        return reinterpret_cast<void*>(new TrackTableFrame());
     }
 
-    void PredictedEntryPubSubType::deleteData(
+    void TrackTableFramePubSubType::deleteData(
             void* data)
     {
-        delete(reinterpret_cast<PredictedEntry*>(data));
+        delete(reinterpret_cast<TrackTableFrame*>(data));
     }
 
-    bool PredictedEntryPubSubType::getKey(
+    bool TrackTableFramePubSubType::getKey(
             void* data,
             InstanceHandle_t* handle,
             bool force_md5)
@@ -1268,16 +1276,16 @@ namespace CounterUAS {
             return false;
         }
 
-        PredictedEntry* p_type = static_cast<PredictedEntry*>(data);
+        TrackTableFrame* p_type = static_cast<TrackTableFrame*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
-                PredictedEntry::getKeyMaxCdrSerializedSize());
+                TrackTableFrame::getKeyMaxCdrSerializedSize());
 
         // Object that serializes the data.
         eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
         p_type->serializeKey(ser);
-        if (force_md5 || PredictedEntry::getKeyMaxCdrSerializedSize() > 16)
+        if (force_md5 || TrackTableFrame::getKeyMaxCdrSerializedSize() > 16)
         {
             m_md5.init();
             m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
@@ -1297,20 +1305,23 @@ namespace CounterUAS {
         return true;
     }
 
-    PredictedTableMessagePubSubType::PredictedTableMessagePubSubType()
+
+
+
+    SPDetectionFramePubSubType::SPDetectionFramePubSubType()
     {
-        setName("CounterUAS::PredictedTableMessage");
-        auto type_size = PredictedTableMessage::getMaxCdrSerializedSize();
+        setName("CounterUAS::SPDetectionFrame");
+        auto type_size = SPDetectionFrame::getMaxCdrSerializedSize();
         type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
         m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
-        m_isGetKeyDefined = PredictedTableMessage::isKeyDefined();
-        size_t keyLength = PredictedTableMessage::getKeyMaxCdrSerializedSize() > 16 ?
-                PredictedTableMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_isGetKeyDefined = SPDetectionFrame::isKeyDefined();
+        size_t keyLength = SPDetectionFrame::getKeyMaxCdrSerializedSize() > 16 ?
+                SPDetectionFrame::getKeyMaxCdrSerializedSize() : 16;
         m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
         memset(m_keyBuffer, 0, keyLength);
     }
 
-    PredictedTableMessagePubSubType::~PredictedTableMessagePubSubType()
+    SPDetectionFramePubSubType::~SPDetectionFramePubSubType()
     {
         if (m_keyBuffer != nullptr)
         {
@@ -1318,11 +1329,11 @@ namespace CounterUAS {
         }
     }
 
-    bool PredictedTableMessagePubSubType::serialize(
+    bool SPDetectionFramePubSubType::serialize(
             void* data,
             SerializedPayload_t* payload)
     {
-        PredictedTableMessage* p_type = static_cast<PredictedTableMessage*>(data);
+        SPDetectionFrame* p_type = static_cast<SPDetectionFrame*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
@@ -1347,14 +1358,14 @@ namespace CounterUAS {
         return true;
     }
 
-    bool PredictedTableMessagePubSubType::deserialize(
+    bool SPDetectionFramePubSubType::deserialize(
             SerializedPayload_t* payload,
             void* data)
     {
         try
         {
             //Convert DATA to pointer of your type
-            PredictedTableMessage* p_type = static_cast<PredictedTableMessage*>(data);
+            SPDetectionFrame* p_type = static_cast<SPDetectionFrame*>(data);
 
             // Object that manages the raw buffer.
             eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
@@ -1377,28 +1388,28 @@ namespace CounterUAS {
         return true;
     }
 
-    std::function<uint32_t()> PredictedTableMessagePubSubType::getSerializedSizeProvider(
+    std::function<uint32_t()> SPDetectionFramePubSubType::getSerializedSizeProvider(
             void* data)
     {
         return [data]() -> uint32_t
                {
-                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<PredictedTableMessage*>(data))) +
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<SPDetectionFrame*>(data))) +
                           4u /*encapsulation*/;
                };
     }
 
-    void* PredictedTableMessagePubSubType::createData()
+    void* SPDetectionFramePubSubType::createData()
     {
-        return reinterpret_cast<void*>(new PredictedTableMessage());
+        return reinterpret_cast<void*>(new SPDetectionFrame());
     }
 
-    void PredictedTableMessagePubSubType::deleteData(
+    void SPDetectionFramePubSubType::deleteData(
             void* data)
     {
-        delete(reinterpret_cast<PredictedTableMessage*>(data));
+        delete(reinterpret_cast<SPDetectionFrame*>(data));
     }
 
-    bool PredictedTableMessagePubSubType::getKey(
+    bool SPDetectionFramePubSubType::getKey(
             void* data,
             InstanceHandle_t* handle,
             bool force_md5)
@@ -1408,16 +1419,16 @@ namespace CounterUAS {
             return false;
         }
 
-        PredictedTableMessage* p_type = static_cast<PredictedTableMessage*>(data);
+        SPDetectionFrame* p_type = static_cast<SPDetectionFrame*>(data);
 
         // Object that manages the raw buffer.
         eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
-                PredictedTableMessage::getKeyMaxCdrSerializedSize());
+                SPDetectionFrame::getKeyMaxCdrSerializedSize());
 
         // Object that serializes the data.
         eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
         p_type->serializeKey(ser);
-        if (force_md5 || PredictedTableMessage::getKeyMaxCdrSerializedSize() > 16)
+        if (force_md5 || SPDetectionFrame::getKeyMaxCdrSerializedSize() > 16)
         {
             m_md5.init();
             m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
@@ -1440,6 +1451,1415 @@ namespace CounterUAS {
 
 
 
+    ClusterDataPubSubType::ClusterDataPubSubType()
+    {
+        setName("CounterUAS::ClusterData");
+        auto type_size = ClusterData::getMaxCdrSerializedSize();
+        type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
+        m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
+        m_isGetKeyDefined = ClusterData::isKeyDefined();
+        size_t keyLength = ClusterData::getKeyMaxCdrSerializedSize() > 16 ?
+                ClusterData::getKeyMaxCdrSerializedSize() : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    ClusterDataPubSubType::~ClusterDataPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool ClusterDataPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload)
+    {
+        ClusterData* p_type = static_cast<ClusterData*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        // Serialize encapsulation
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Serialize the object.
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool ClusterDataPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            //Convert DATA to pointer of your type
+            ClusterData* p_type = static_cast<ClusterData*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            p_type->deserialize(deser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> ClusterDataPubSubType::getSerializedSizeProvider(
+            void* data)
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<ClusterData*>(data))) +
+                          4u /*encapsulation*/;
+               };
+    }
+
+    void* ClusterDataPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new ClusterData());
+    }
+
+    void ClusterDataPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<ClusterData*>(data));
+    }
+
+    bool ClusterDataPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        ClusterData* p_type = static_cast<ClusterData*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                ClusterData::getKeyMaxCdrSerializedSize());
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        p_type->serializeKey(ser);
+        if (force_md5 || ClusterData::getKeyMaxCdrSerializedSize() > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+    ClusterTableMessagePubSubType::ClusterTableMessagePubSubType()
+    {
+        setName("CounterUAS::ClusterTableMessage");
+        auto type_size = ClusterTableMessage::getMaxCdrSerializedSize();
+        type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
+        m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
+        m_isGetKeyDefined = ClusterTableMessage::isKeyDefined();
+        size_t keyLength = ClusterTableMessage::getKeyMaxCdrSerializedSize() > 16 ?
+                ClusterTableMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    ClusterTableMessagePubSubType::~ClusterTableMessagePubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool ClusterTableMessagePubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload)
+    {
+        ClusterTableMessage* p_type = static_cast<ClusterTableMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        // Serialize encapsulation
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Serialize the object.
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool ClusterTableMessagePubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            //Convert DATA to pointer of your type
+            ClusterTableMessage* p_type = static_cast<ClusterTableMessage*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            p_type->deserialize(deser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> ClusterTableMessagePubSubType::getSerializedSizeProvider(
+            void* data)
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<ClusterTableMessage*>(data))) +
+                          4u /*encapsulation*/;
+               };
+    }
+
+    void* ClusterTableMessagePubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new ClusterTableMessage());
+    }
+
+    void ClusterTableMessagePubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<ClusterTableMessage*>(data));
+    }
+
+    bool ClusterTableMessagePubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        ClusterTableMessage* p_type = static_cast<ClusterTableMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                ClusterTableMessage::getKeyMaxCdrSerializedSize());
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        p_type->serializeKey(ser);
+        if (force_md5 || ClusterTableMessage::getKeyMaxCdrSerializedSize() > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+
+    AssocEntryPubSubType::AssocEntryPubSubType()
+    {
+        setName("CounterUAS::AssocEntry");
+        auto type_size = AssocEntry::getMaxCdrSerializedSize();
+        type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
+        m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
+        m_isGetKeyDefined = AssocEntry::isKeyDefined();
+        size_t keyLength = AssocEntry::getKeyMaxCdrSerializedSize() > 16 ?
+                AssocEntry::getKeyMaxCdrSerializedSize() : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    AssocEntryPubSubType::~AssocEntryPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool AssocEntryPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload)
+    {
+        AssocEntry* p_type = static_cast<AssocEntry*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        // Serialize encapsulation
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Serialize the object.
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool AssocEntryPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            //Convert DATA to pointer of your type
+            AssocEntry* p_type = static_cast<AssocEntry*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            p_type->deserialize(deser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> AssocEntryPubSubType::getSerializedSizeProvider(
+            void* data)
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<AssocEntry*>(data))) +
+                          4u /*encapsulation*/;
+               };
+    }
+
+    void* AssocEntryPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new AssocEntry());
+    }
+
+    void AssocEntryPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<AssocEntry*>(data));
+    }
+
+    bool AssocEntryPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        AssocEntry* p_type = static_cast<AssocEntry*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AssocEntry::getKeyMaxCdrSerializedSize());
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        p_type->serializeKey(ser);
+        if (force_md5 || AssocEntry::getKeyMaxCdrSerializedSize() > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+    AssocTableMessagePubSubType::AssocTableMessagePubSubType()
+    {
+        setName("CounterUAS::AssocTableMessage");
+        auto type_size = AssocTableMessage::getMaxCdrSerializedSize();
+        type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
+        m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
+        m_isGetKeyDefined = AssocTableMessage::isKeyDefined();
+        size_t keyLength = AssocTableMessage::getKeyMaxCdrSerializedSize() > 16 ?
+                AssocTableMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    AssocTableMessagePubSubType::~AssocTableMessagePubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool AssocTableMessagePubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload)
+    {
+        AssocTableMessage* p_type = static_cast<AssocTableMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        // Serialize encapsulation
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Serialize the object.
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool AssocTableMessagePubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            //Convert DATA to pointer of your type
+            AssocTableMessage* p_type = static_cast<AssocTableMessage*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            p_type->deserialize(deser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> AssocTableMessagePubSubType::getSerializedSizeProvider(
+            void* data)
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<AssocTableMessage*>(data))) +
+                          4u /*encapsulation*/;
+               };
+    }
+
+    void* AssocTableMessagePubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new AssocTableMessage());
+    }
+
+    void AssocTableMessagePubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<AssocTableMessage*>(data));
+    }
+
+    bool AssocTableMessagePubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        AssocTableMessage* p_type = static_cast<AssocTableMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                AssocTableMessage::getKeyMaxCdrSerializedSize());
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        p_type->serializeKey(ser);
+        if (force_md5 || AssocTableMessage::getKeyMaxCdrSerializedSize() > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+
+    PredictedEntryPubSubType::PredictedEntryPubSubType()
+    {
+        setName("CounterUAS::PredictedEntry");
+        auto type_size = PredictedEntry::getMaxCdrSerializedSize();
+        type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
+        m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
+        m_isGetKeyDefined = PredictedEntry::isKeyDefined();
+        size_t keyLength = PredictedEntry::getKeyMaxCdrSerializedSize() > 16 ?
+                PredictedEntry::getKeyMaxCdrSerializedSize() : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    PredictedEntryPubSubType::~PredictedEntryPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool PredictedEntryPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload)
+    {
+        PredictedEntry* p_type = static_cast<PredictedEntry*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        // Serialize encapsulation
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Serialize the object.
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool PredictedEntryPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            //Convert DATA to pointer of your type
+            PredictedEntry* p_type = static_cast<PredictedEntry*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            p_type->deserialize(deser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> PredictedEntryPubSubType::getSerializedSizeProvider(
+            void* data)
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<PredictedEntry*>(data))) +
+                          4u /*encapsulation*/;
+               };
+    }
+
+    void* PredictedEntryPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new PredictedEntry());
+    }
+
+    void PredictedEntryPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<PredictedEntry*>(data));
+    }
+
+    bool PredictedEntryPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        PredictedEntry* p_type = static_cast<PredictedEntry*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                PredictedEntry::getKeyMaxCdrSerializedSize());
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        p_type->serializeKey(ser);
+        if (force_md5 || PredictedEntry::getKeyMaxCdrSerializedSize() > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+    PredictedTableMessagePubSubType::PredictedTableMessagePubSubType()
+    {
+        setName("CounterUAS::PredictedTableMessage");
+        auto type_size = PredictedTableMessage::getMaxCdrSerializedSize();
+        type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
+        m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
+        m_isGetKeyDefined = PredictedTableMessage::isKeyDefined();
+        size_t keyLength = PredictedTableMessage::getKeyMaxCdrSerializedSize() > 16 ?
+                PredictedTableMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    PredictedTableMessagePubSubType::~PredictedTableMessagePubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool PredictedTableMessagePubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload)
+    {
+        PredictedTableMessage* p_type = static_cast<PredictedTableMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        // Serialize encapsulation
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Serialize the object.
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool PredictedTableMessagePubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            //Convert DATA to pointer of your type
+            PredictedTableMessage* p_type = static_cast<PredictedTableMessage*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            p_type->deserialize(deser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> PredictedTableMessagePubSubType::getSerializedSizeProvider(
+            void* data)
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<PredictedTableMessage*>(data))) +
+                          4u /*encapsulation*/;
+               };
+    }
+
+    void* PredictedTableMessagePubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new PredictedTableMessage());
+    }
+
+    void PredictedTableMessagePubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<PredictedTableMessage*>(data));
+    }
+
+    bool PredictedTableMessagePubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        PredictedTableMessage* p_type = static_cast<PredictedTableMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                PredictedTableMessage::getKeyMaxCdrSerializedSize());
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        p_type->serializeKey(ser);
+        if (force_md5 || PredictedTableMessage::getKeyMaxCdrSerializedSize() > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+
+
+
+    PipelineStatsMessagePubSubType::PipelineStatsMessagePubSubType()
+    {
+        setName("CounterUAS::PipelineStatsMessage");
+        auto type_size = PipelineStatsMessage::getMaxCdrSerializedSize();
+        type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
+        m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
+        m_isGetKeyDefined = PipelineStatsMessage::isKeyDefined();
+        size_t keyLength = PipelineStatsMessage::getKeyMaxCdrSerializedSize() > 16 ?
+                PipelineStatsMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    PipelineStatsMessagePubSubType::~PipelineStatsMessagePubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool PipelineStatsMessagePubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload)
+    {
+        PipelineStatsMessage* p_type = static_cast<PipelineStatsMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        // Serialize encapsulation
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Serialize the object.
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool PipelineStatsMessagePubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            //Convert DATA to pointer of your type
+            PipelineStatsMessage* p_type = static_cast<PipelineStatsMessage*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            p_type->deserialize(deser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> PipelineStatsMessagePubSubType::getSerializedSizeProvider(
+            void* data)
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<PipelineStatsMessage*>(data))) +
+                          4u /*encapsulation*/;
+               };
+    }
+
+    void* PipelineStatsMessagePubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new PipelineStatsMessage());
+    }
+
+    void PipelineStatsMessagePubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<PipelineStatsMessage*>(data));
+    }
+
+    bool PipelineStatsMessagePubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        PipelineStatsMessage* p_type = static_cast<PipelineStatsMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                PipelineStatsMessage::getKeyMaxCdrSerializedSize());
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        p_type->serializeKey(ser);
+        if (force_md5 || PipelineStatsMessage::getKeyMaxCdrSerializedSize() > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+
+    StageLatencyPubSubType::StageLatencyPubSubType()
+    {
+        setName("CounterUAS::StageLatency");
+        auto type_size = StageLatency::getMaxCdrSerializedSize();
+        type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
+        m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
+        m_isGetKeyDefined = StageLatency::isKeyDefined();
+        size_t keyLength = StageLatency::getKeyMaxCdrSerializedSize() > 16 ?
+                StageLatency::getKeyMaxCdrSerializedSize() : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    StageLatencyPubSubType::~StageLatencyPubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool StageLatencyPubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload)
+    {
+        StageLatency* p_type = static_cast<StageLatency*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        // Serialize encapsulation
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Serialize the object.
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool StageLatencyPubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            //Convert DATA to pointer of your type
+            StageLatency* p_type = static_cast<StageLatency*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            p_type->deserialize(deser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> StageLatencyPubSubType::getSerializedSizeProvider(
+            void* data)
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<StageLatency*>(data))) +
+                          4u /*encapsulation*/;
+               };
+    }
+
+    void* StageLatencyPubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new StageLatency());
+    }
+
+    void StageLatencyPubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<StageLatency*>(data));
+    }
+
+    bool StageLatencyPubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        StageLatency* p_type = static_cast<StageLatency*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                StageLatency::getKeyMaxCdrSerializedSize());
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        p_type->serializeKey(ser);
+        if (force_md5 || StageLatency::getKeyMaxCdrSerializedSize() > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+
+    TrackerHealthMessagePubSubType::TrackerHealthMessagePubSubType()
+    {
+        setName("CounterUAS::TrackerHealthMessage");
+        auto type_size = TrackerHealthMessage::getMaxCdrSerializedSize();
+        type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
+        m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
+        m_isGetKeyDefined = TrackerHealthMessage::isKeyDefined();
+        size_t keyLength = TrackerHealthMessage::getKeyMaxCdrSerializedSize() > 16 ?
+                TrackerHealthMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    TrackerHealthMessagePubSubType::~TrackerHealthMessagePubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool TrackerHealthMessagePubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload)
+    {
+        TrackerHealthMessage* p_type = static_cast<TrackerHealthMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        // Serialize encapsulation
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Serialize the object.
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool TrackerHealthMessagePubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            //Convert DATA to pointer of your type
+            TrackerHealthMessage* p_type = static_cast<TrackerHealthMessage*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            p_type->deserialize(deser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> TrackerHealthMessagePubSubType::getSerializedSizeProvider(
+            void* data)
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<TrackerHealthMessage*>(data))) +
+                          4u /*encapsulation*/;
+               };
+    }
+
+    void* TrackerHealthMessagePubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new TrackerHealthMessage());
+    }
+
+    void TrackerHealthMessagePubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<TrackerHealthMessage*>(data));
+    }
+
+    bool TrackerHealthMessagePubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        TrackerHealthMessage* p_type = static_cast<TrackerHealthMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                TrackerHealthMessage::getKeyMaxCdrSerializedSize());
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        p_type->serializeKey(ser);
+        if (force_md5 || TrackerHealthMessage::getKeyMaxCdrSerializedSize() > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+
+    TrackHandoverMessagePubSubType::TrackHandoverMessagePubSubType()
+    {
+        setName("CounterUAS::TrackHandoverMessage");
+        auto type_size = TrackHandoverMessage::getMaxCdrSerializedSize();
+        type_size += eprosima::fastcdr::Cdr::alignment(type_size, 4); /* possible submessage alignment */
+        m_typeSize = static_cast<uint32_t>(type_size) + 4; /*encapsulation*/
+        m_isGetKeyDefined = TrackHandoverMessage::isKeyDefined();
+        size_t keyLength = TrackHandoverMessage::getKeyMaxCdrSerializedSize() > 16 ?
+                TrackHandoverMessage::getKeyMaxCdrSerializedSize() : 16;
+        m_keyBuffer = reinterpret_cast<unsigned char*>(malloc(keyLength));
+        memset(m_keyBuffer, 0, keyLength);
+    }
+
+    TrackHandoverMessagePubSubType::~TrackHandoverMessagePubSubType()
+    {
+        if (m_keyBuffer != nullptr)
+        {
+            free(m_keyBuffer);
+        }
+    }
+
+    bool TrackHandoverMessagePubSubType::serialize(
+            void* data,
+            SerializedPayload_t* payload)
+    {
+        TrackHandoverMessage* p_type = static_cast<TrackHandoverMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+        // Serialize encapsulation
+        ser.serialize_encapsulation();
+
+        try
+        {
+            // Serialize the object.
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        // Get the serialized length
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+        return true;
+    }
+
+    bool TrackHandoverMessagePubSubType::deserialize(
+            SerializedPayload_t* payload,
+            void* data)
+    {
+        try
+        {
+            //Convert DATA to pointer of your type
+            TrackHandoverMessage* p_type = static_cast<TrackHandoverMessage*>(data);
+
+            // Object that manages the raw buffer.
+            eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload->data), payload->length);
+
+            // Object that deserializes the data.
+            eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+            // Deserialize encapsulation.
+            deser.read_encapsulation();
+            payload->encapsulation = deser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+            // Deserialize the object.
+            p_type->deserialize(deser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    std::function<uint32_t()> TrackHandoverMessagePubSubType::getSerializedSizeProvider(
+            void* data)
+    {
+        return [data]() -> uint32_t
+               {
+                   return static_cast<uint32_t>(type::getCdrSerializedSize(*static_cast<TrackHandoverMessage*>(data))) +
+                          4u /*encapsulation*/;
+               };
+    }
+
+    void* TrackHandoverMessagePubSubType::createData()
+    {
+        return reinterpret_cast<void*>(new TrackHandoverMessage());
+    }
+
+    void TrackHandoverMessagePubSubType::deleteData(
+            void* data)
+    {
+        delete(reinterpret_cast<TrackHandoverMessage*>(data));
+    }
+
+    bool TrackHandoverMessagePubSubType::getKey(
+            void* data,
+            InstanceHandle_t* handle,
+            bool force_md5)
+    {
+        if (!m_isGetKeyDefined)
+        {
+            return false;
+        }
+
+        TrackHandoverMessage* p_type = static_cast<TrackHandoverMessage*>(data);
+
+        // Object that manages the raw buffer.
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(m_keyBuffer),
+                TrackHandoverMessage::getKeyMaxCdrSerializedSize());
+
+        // Object that serializes the data.
+        eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);
+        p_type->serializeKey(ser);
+        if (force_md5 || TrackHandoverMessage::getKeyMaxCdrSerializedSize() > 16)
+        {
+            m_md5.init();
+            m_md5.update(m_keyBuffer, static_cast<unsigned int>(ser.getSerializedDataLength()));
+            m_md5.finalize();
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_md5.digest[i];
+            }
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 16; ++i)
+            {
+                handle->value[i] = m_keyBuffer[i];
+            }
+        }
+        return true;
+    }
+
+
     LogRecordHeaderPubSubType::LogRecordHeaderPubSubType()
     {
         setName("CounterUAS::LogRecordHeader");
@@ -167,6 +167,140 @@ namespace CounterUAS
 
 
 
+    /*!
+     * @brief This class represents the TopicDataType of the type SPDetectionFrame defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class SPDetectionFramePubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef SPDetectionFrame type;
+
+        eProsima_user_DllExport SPDetectionFramePubSubType();
+
+        eProsima_user_DllExport virtual ~SPDetectionFramePubSubType() override;
+
+        eProsima_user_DllExport virtual bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+        eProsima_user_DllExport virtual bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override;
+
+        eProsima_user_DllExport virtual bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport virtual void* createData() override;
+
+        eProsima_user_DllExport virtual void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            new (memory) SPDetectionFrame();
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+    };
+
+
+
+    /*!
+     * @brief This class represents the TopicDataType of the type LatencyTrace defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class LatencyTracePubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef LatencyTrace type;
+
+        eProsima_user_DllExport LatencyTracePubSubType();
+
+        eProsima_user_DllExport virtual ~LatencyTracePubSubType() override;
+
+        eProsima_user_DllExport virtual bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+        eProsima_user_DllExport virtual bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override;
+
+        eProsima_user_DllExport virtual bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport virtual void* createData() override;
+
+        eProsima_user_DllExport virtual void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            new (memory) LatencyTrace();
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+    };
+
+
+
     /*!
      * @brief This class represents the TopicDataType of the type TrackUpdateMessage defined by the user in the IDL file.
      * @ingroup MESSAGES
@@ -205,7 +339,7 @@ namespace CounterUAS
     #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
         eProsima_user_DllExport inline bool is_bounded() const override
         {
-            return false;
+            return true;
         }
 
     #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
@@ -297,6 +431,140 @@ namespace CounterUAS
         unsigned char* m_keyBuffer;
     };
 
+    /*!
+     * @brief This class represents the TopicDataType of the type TrackFrameEntry defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class TrackFrameEntryPubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef TrackFrameEntry type;
+
+        eProsima_user_DllExport TrackFrameEntryPubSubType();
+
+        eProsima_user_DllExport virtual ~TrackFrameEntryPubSubType() override;
+
+        eProsima_user_DllExport virtual bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+        eProsima_user_DllExport virtual bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override;
+
+        eProsima_user_DllExport virtual bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport virtual void* createData() override;
+
+        eProsima_user_DllExport virtual void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            new (memory) TrackFrameEntry();
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+    };
+
+
+
+    /*!
+     * @brief This class represents the TopicDataType of the type TrackTableFrame defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class TrackTableFramePubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef TrackTableFrame type;
+
+        eProsima_user_DllExport TrackTableFramePubSubType();
+
+        eProsima_user_DllExport virtual ~TrackTableFramePubSubType() override;
+
+        eProsima_user_DllExport virtual bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+        eProsima_user_DllExport virtual bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override;
+
+        eProsima_user_DllExport virtual bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport virtual void* createData() override;
+
+        eProsima_user_DllExport virtual void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            new (memory) TrackTableFrame();
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+    };
+
+
+
     /*!
      * @brief This class represents the TopicDataType of the type ClusterData defined by the user in the IDL file.
      * @ingroup MESSAGES
@@ -686,6 +954,262 @@ namespace CounterUAS
 
 
 
+    /*!
+     * @brief This class represents the TopicDataType of the type PipelineStatsMessage defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class PipelineStatsMessagePubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef PipelineStatsMessage type;
+
+        eProsima_user_DllExport PipelineStatsMessagePubSubType();
+
+        eProsima_user_DllExport virtual ~PipelineStatsMessagePubSubType() override;
+
+        eProsima_user_DllExport virtual bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+        eProsima_user_DllExport virtual bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override;
+
+        eProsima_user_DllExport virtual bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport virtual void* createData() override;
+
+        eProsima_user_DllExport virtual void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            new (memory) PipelineStatsMessage();
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+    };
+    /*!
+     * @brief This class represents the TopicDataType of the type StageLatency defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class StageLatencyPubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef StageLatency type;
+
+        eProsima_user_DllExport StageLatencyPubSubType();
+
+        eProsima_user_DllExport virtual ~StageLatencyPubSubType() override;
+
+        eProsima_user_DllExport virtual bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+        eProsima_user_DllExport virtual bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override;
+
+        eProsima_user_DllExport virtual bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport virtual void* createData() override;
+
+        eProsima_user_DllExport virtual void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            (void)memory;
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+    };
+    /*!
+     * @brief This class represents the TopicDataType of the type TrackerHealthMessage defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class TrackerHealthMessagePubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef TrackerHealthMessage type;
+
+        eProsima_user_DllExport TrackerHealthMessagePubSubType();
+
+        eProsima_user_DllExport virtual ~TrackerHealthMessagePubSubType() override;
+
+        eProsima_user_DllExport virtual bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+        eProsima_user_DllExport virtual bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override;
+
+        eProsima_user_DllExport virtual bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport virtual void* createData() override;
+
+        eProsima_user_DllExport virtual void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            (void)memory;
+            return false;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+    };
+    /*!
+     * @brief This class represents the TopicDataType of the type TrackHandoverMessage defined by the user in the IDL file.
+     * @ingroup MESSAGES
+     */
+    class TrackHandoverMessagePubSubType : public eprosima::fastdds::dds::TopicDataType
+    {
+    public:
+
+        typedef TrackHandoverMessage type;
+
+        eProsima_user_DllExport TrackHandoverMessagePubSubType();
+
+        eProsima_user_DllExport virtual ~TrackHandoverMessagePubSubType() override;
+
+        eProsima_user_DllExport virtual bool serialize(
+                void* data,
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+        eProsima_user_DllExport virtual bool deserialize(
+                eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+                void* data) override;
+
+        eProsima_user_DllExport virtual std::function<uint32_t()> getSerializedSizeProvider(
+                void* data) override;
+
+        eProsima_user_DllExport virtual bool getKey(
+                void* data,
+                eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+                bool force_md5 = false) override;
+
+        eProsima_user_DllExport virtual void* createData() override;
+
+        eProsima_user_DllExport virtual void deleteData(
+                void* data) override;
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+        eProsima_user_DllExport inline bool is_bounded() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_BOUNDED
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+        eProsima_user_DllExport inline bool is_plain() const override
+        {
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_IS_PLAIN
+
+    #ifdef TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+        eProsima_user_DllExport inline bool construct_sample(
+                void* memory) const override
+        {
+            new (memory) TrackHandoverMessage();
+            return true;
+        }
+
+    #endif  // TOPIC_DATA_TYPE_API_HAS_CONSTRUCT_SAMPLE
+
+        MD5 m_md5;
+        unsigned char* m_keyBuffer;
+    };
     /*!
      * @brief This class represents the TopicDataType of the type LogRecordHeader defined by the user in the IDL file.
      * @ingroup MESSAGES
@@ -0,0 +1,234 @@
+#pragma once
+
+/*
+ * IngestRing — fixed-capacity lock-free ring between the DDS listener thread
+ * (producer) and the pipeline thread (consumer).
+ *
+ * Slots carry a sequence number (bounded-queue scheme after D. Vyukov), so a
+ * slot is only ever owned by one side at a time and T may be a non-trivial
+ * type such as SPDetectionMessage.  Because slot ownership is claimed with a
+ * CAS, the producer may also discard from the head of the ring; that is what
+ * lets the DropOldest and CoalesceLatest policies stay lock-free.
+ *
+ * Overload policies (applied by push() when the ring is full):
+ *   Block          – spin/yield until the consumer frees a slot (or close()).
+ *   DropOldest     – discard the oldest queued dwell, then enqueue.
+ *   DropNewest     – discard the incoming dwell.
+ *   CoalesceLatest – discard everything queued; only the newest dwell waits.
+ *                    Applied on every push, not just when full.
+ *
+ * The consumer sleeps in waitPop() on a condition variable only when the
+ * ring is empty; the mutex guards the sleep, never the data.
+ *
+ * push() and waitPop() exchange contents with the slot by swap rather than
+ * copy, so the buffers a dwell owns circulate between producer, ring and
+ * consumer and are reused instead of reallocated.  Discarded dwells stay in
+ * their slot for the same reason.
+ */
+
+#include "common/profiling.h"
+#include "common/types.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace cuas {
+
+struct IngestStats {
+    uint32_t capacity  = 0;
+    uint32_t depth     = 0;
+    uint32_t highWater = 0;
+    uint64_t pushed    = 0;
+    uint64_t dropped   = 0;
+    uint64_t coalesced = 0;
+};
+
+template <typename T>
+class IngestRing {
+public:
+    IngestRing(size_t capacity, OverloadPolicy policy)
+        : capacity_(roundUpPow2(capacity)), mask_(capacity_ - 1),
+          policy_(policy), slots_(new Slot[capacity_]) {
+        for (size_t i = 0; i < capacity_; ++i)
+            slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    IngestRing(const IngestRing&)            = delete;
+    IngestRing& operator=(const IngestRing&) = delete;
+
+    // Producer side.  Swaps `item` into the ring and leaves a recycled
+    // buffer in its place.  Returns false (item untouched) if it was dropped.
+    bool push(T& item) {
+        if (policy_ == OverloadPolicy::CoalesceLatest) {
+            while (tryDiscard()) coalesced_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        while (!tryPush(item)) {
+            switch (policy_) {
+                case OverloadPolicy::DropNewest:
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                case OverloadPolicy::DropOldest:
+                case OverloadPolicy::CoalesceLatest:
+                    if (tryDiscard()) dropped_.fetch_add(1, std::memory_order_relaxed);
+                    break;
+                case OverloadPolicy::Block:
+                    if (closed_.load(std::memory_order_acquire)) return false;
+                    std::this_thread::yield();
+                    break;
+            }
+        }
+
+        pushed_.fetch_add(1, std::memory_order_relaxed);
+        updateHighWater();
+        if (consumerWaiting_.load()) {
+            CUAS_PROFILE_LOCK(waitMutex_, "IngestRing waitMutex_ wait");
+            waitMutex_.unlock();
+            waitCV_.notify_one();
+        }
+        return true;
+    }
+
+    // Consumer side.  Waits up to `timeout` for an item; `out`'s previous
+    // contents go back into the ring for the producer to reuse.
+    template <typename Rep, typename Period>
+    bool waitPop(T& out, std::chrono::duration<Rep, Period> timeout) {
+        if (tryPop(out)) return true;
+
+        std::unique_lock<std::mutex> lock(waitMutex_);
+        consumerWaiting_.store(true);
+        // Re-check after publishing the waiting flag so a concurrent push
+        // either sees the flag or its item is visible here.
+        if (!tryPop(out)) {
+            waitCV_.wait_for(lock, timeout, [&] {
+                return closed_.load(std::memory_order_acquire) || !empty();
+            });
+            consumerWaiting_.store(false);
+            lock.unlock();
+            return tryPop(out);
+        }
+        consumerWaiting_.store(false);
+        return true;
+    }
+
+    // Wakes a waiting consumer and releases a producer blocked on Block policy.
+    void close() {
+        closed_.store(true, std::memory_order_release);
+        { std::lock_guard<std::mutex> lock(waitMutex_); }
+        waitCV_.notify_all();
+    }
+
+    bool empty() const { return size() == 0; }
+
+    size_t size() const {
+        size_t w = enqueuePos_.load(std::memory_order_acquire);
+        size_t r = dequeuePos_.load(std::memory_order_acquire);
+        return w > r ? w - r : 0;
+    }
+
+    IngestStats stats() const {
+        IngestStats s;
+        s.capacity  = static_cast<uint32_t>(capacity_);
+        s.depth     = static_cast<uint32_t>(size());
+        s.highWater = static_cast<uint32_t>(highWater_.load(std::memory_order_relaxed));
+        s.pushed    = pushed_.load(std::memory_order_relaxed);
+        s.dropped   = dropped_.load(std::memory_order_relaxed);
+        s.coalesced = coalesced_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> seq{0};
+        T                   value;
+    };
+
+    static size_t roundUpPow2(size_t n) {
+        size_t p = 2;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    bool tryPush(T& item) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            size_t seq = slot.seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    using std::swap;
+                    swap(slot.value, item);
+                    slot.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;   // full
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Claims the oldest slot.  With `out` the contents are swapped out; without
+    // (producer-side discard) they stay put so the buffer is reused.
+    bool tryPop(T& out) { return claimHead(&out); }
+    bool tryDiscard()   { return claimHead(nullptr); }
+
+    bool claimHead(T* out) {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            size_t seq = slot.seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    if (out) {
+                        using std::swap;
+                        swap(*out, slot.value);
+                    }
+                    slot.seq.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;   // empty
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void updateHighWater() {
+        size_t depth = size();
+        size_t hw = highWater_.load(std::memory_order_relaxed);
+        while (depth > hw &&
+               !highWater_.compare_exchange_weak(hw, depth, std::memory_order_relaxed)) {}
+    }
+
+    const size_t           capacity_;
+    const size_t           mask_;
+    const OverloadPolicy   policy_;
+    std::unique_ptr<Slot[]> slots_;
+
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) std::atomic<size_t> dequeuePos_{0};
+
+    std::atomic<size_t>   highWater_{0};
+    std::atomic<uint64_t> pushed_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> coalesced_{0};
+
+    std::atomic<bool>       closed_{false};
+    std::atomic<bool>       consumerWaiting_{false};
+    std::mutex              waitMutex_;
+    std::condition_variable waitCV_;
+};
+
+} // namespace cuas
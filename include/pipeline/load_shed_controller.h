@@ -0,0 +1,40 @@
+#pragma once
+
+/*
+ * LoadShedController — decides the pipeline degradation level.
+ *
+ * Fed once per completed dwell with its processing time and the ingest ring
+ * depth.  A dwell is "overloaded" if it overran overrunRatio * cyclePeriodMs
+ * or the ring holds at least queueDepthHigh dwells, and "healthy" if it
+ * finished under recoverRatio * cyclePeriodMs with the ring empty.  Anything
+ * in between resets both streaks, so the level only moves on a sustained
+ * trend: one step down after degradeAfterDwells overloaded dwells, one step
+ * up after recoverAfterDwells healthy ones.
+ *
+ * This class only decides; TrackerPipeline applies the level (see
+ * LoadShedConfig for what each level turns off).
+ */
+
+#include "common/config.h"
+#include <cstdint>
+
+namespace cuas {
+
+class LoadShedController {
+public:
+    LoadShedController(const LoadShedConfig& cfg, int cyclePeriodMs);
+
+    // Returns true if the level changed.
+    bool update(double cycleMs, uint32_t queueDepth);
+
+    int level() const { return level_; }
+
+private:
+    LoadShedConfig config_;
+    double         periodMs_;
+    int            level_          = 0;
+    int            overloadStreak_ = 0;
+    int            healthyStreak_  = 0;
+};
+
+} // namespace cuas
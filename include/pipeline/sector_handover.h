@@ -0,0 +1,64 @@
+#pragma once
+
+/*
+ * SectorHandover — node-to-node track handover on the "TrackHandover" topic
+ * (distributed.enabled).
+ *
+ * send() publishes a track TrackManager handed over, IMM per-model state
+ * included, addressed to the node owning its new sector.  The reader takes
+ * only messages addressed to this node: through a content filter on toNode
+ * when distributed.contentFilter is set and the filter can be created, and
+ * by checking toNode itself either way.  Each one is converted back to a
+ * CheckpointTrack and given to the callback with its sensorId, on the DDS
+ * thread; the pipeline queues it for the lane tracking that face.
+ *
+ * The topic is reliable KEEP_ALL: a lost handover is a lost track.
+ */
+
+#include "common/config.h"
+#include "common/dds_participant.h"
+#include "track_management/track_manager.h"
+
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+
+#include <atomic>
+#include <functional>
+
+namespace cuas {
+
+class SectorHandover : public eprosima::fastdds::dds::DataReaderListener {
+public:
+    using Callback = std::function<void(uint32_t sensorId, const CheckpointTrack& track)>;
+
+    SectorHandover(CuasDdsParticipant& participant, const DistributedConfig& cfg,
+                   Callback onTrack);
+    ~SectorHandover() override = default;
+
+    SectorHandover(const SectorHandover&)            = delete;
+    SectorHandover& operator=(const SectorHandover&) = delete;
+
+    // Publishes one handed-over track of `sensorId`'s lane.  Thread-safe:
+    // every lane calls it from its own tracking thread.
+    void send(uint32_t sensorId, const TrackManager::Handover& handover);
+
+    void on_data_available(eprosima::fastdds::dds::DataReader* reader) override;
+
+    uint64_t totalSent()     const { return sent_.load(); }
+    uint64_t totalReceived() const { return received_.load(); }
+
+private:
+    uint32_t nodeId_;
+    Callback onTrack_;
+
+    eprosima::fastdds::dds::DataWriter* writer_ = nullptr;
+
+    // Only touched from on_data_available.
+    CounterUAS::TrackHandoverMessage in_;
+    CheckpointTrack                  track_;
+
+    std::atomic<uint64_t> sent_{0};
+    std::atomic<uint64_t> received_{0};
+};
+
+} // namespace cuas
@@ -0,0 +1,75 @@
+#pragma once
+
+/*
+ * StageQueue — bounded blocking hand-off between pipeline stage groups.
+ *
+ * push() blocks while the queue is full so a slow downstream stage applies
+ * back-pressure instead of letting work pile up; pop() blocks while empty.
+ * close() wakes all waiters: further pushes fail, and pop() keeps draining
+ * what is already queued before it returns false.
+ */
+
+#include "common/profiling.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace cuas {
+
+template <typename T>
+class StageQueue {
+public:
+    explicit StageQueue(size_t capacity) : capacity_(capacity > 0 ? capacity : 1) {}
+
+    StageQueue(const StageQueue&)            = delete;
+    StageQueue& operator=(const StageQueue&) = delete;
+
+    bool push(T&& item) {
+        CUAS_PROFILE_LOCK(mutex_, "StageQueue mutex_ wait");
+        std::unique_lock<std::mutex> lock(mutex_, std::adopt_lock);
+        notFull_.wait(lock, [this] { return closed_ || items_.size() < capacity_; });
+        if (closed_) return false;
+        items_.push_back(std::move(item));
+        lock.unlock();
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    bool pop(T& out) {
+        CUAS_PROFILE_LOCK(mutex_, "StageQueue mutex_ wait");
+        std::unique_lock<std::mutex> lock(mutex_, std::adopt_lock);
+        notEmpty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+        if (items_.empty()) return false;
+        out = std::move(items_.front());
+        items_.pop_front();
+        lock.unlock();
+        notFull_.notify_one();
+        return true;
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        notFull_.notify_all();
+        notEmpty_.notify_all();
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return items_.size();
+    }
+
+private:
+    const size_t            capacity_;
+    std::deque<T>           items_;
+    mutable std::mutex      mutex_;
+    std::condition_variable notFull_;
+    std::condition_variable notEmpty_;
+    bool                    closed_ = false;
+};
+
+} // namespace cuas
@@ -2,14 +2,21 @@
 
 #include "common/config.h"
 #include "common/dds_participant.h"
+#include "common/latency_histogram.h"
 #include "receiver/detection_receiver.h"
+#include "receiver/udp_detection_receiver.h"
 #include "track_management/track_manager.h"
 #include "sender/track_sender.h"
+#include "pipeline/ingest_ring.h"
+#include "pipeline/load_shed_controller.h"
+#include "pipeline/sector_handover.h"
+#include "pipeline/stage_queue.h"
 #include <atomic>
+#include <chrono>
+#include <memory>
 #include <mutex>
-#include <condition_variable>
-#include <queue>
 #include <thread>
+#include <vector>
 
 namespace cuas {
 
@@ -22,27 +29,138 @@ public:
     void stop();
     bool isRunning() const { return running_.load(); }
 
+    // Hot reload: validates `cfg` and queues its tuning sections (see
+    // TrackManager::reconfigure) for every lane, which applies them between
+    // two dwells without dropping tracks.  Sections outside those keep
+    // their startup values.  Returns false, changing nothing, if invalid.
+    // Call from any thread but a pipeline one.
+    bool reloadConfig(const TrackerConfig& cfg);
+
     void printStats() const;
 
 private:
-    void processingLoop();
-    void onDetectionReceived(const SPDetectionMessage& msg);
+    // One dwell in flight between the pipelined stage groups.  Everything the
+    // publish stage needs is captured here so it never reads TrackManager
+    // state that the tracking stage is already mutating for the next dwell.
+    struct DwellWork {
+        uint32_t  dwellCount = 0;
+        Timestamp ts         = 0;
+        std::chrono::high_resolution_clock::time_point start;
+
+        std::vector<Cluster> clusters;
+        DwellOutputs         out;   // raw detections are sent by the ingest stage
+
+        uint32_t numActive    = 0;
+        uint32_t numConfirmed = 0;
+
+        double busiestStageMs = 0.0;   // throughput bottleneck, for load shedding
+        bool   catchUp        = false; // track only, publish nothing
+
+        // Hot reload applied to clustering from this dwell on; the tracking
+        // stage applies its half before tracking it.
+        std::shared_ptr<const TrackerConfig> reconfigure;
+    };
+
+    // One radar face: its own TrackManager, ingest ring and thread(s), so
+    // faces track independently and in parallel while sharing the DDS
+    // participant, receiver, sender and stage timings.
+    struct SensorLane {
+        uint32_t sensorId = 0;
+        size_t   index    = 0;   // position in lanes_, TrackSender slot
+
+        std::unique_ptr<TrackManager> trackManager;
+
+        // Ingest thread → lane hand-off; bounded, see OverloadPolicy.
+        std::unique_ptr<IngestRing<SPDetectionMessage>> ingest;
+        std::thread                                     processingThread;
+
+        std::unique_ptr<StageQueue<DwellWork>> clusterQueue;
+        std::unique_ptr<StageQueue<DwellWork>> publishQueue;
+        std::thread                            trackThread;
+        std::thread                            publishThread;
+
+        std::unique_ptr<LoadShedController> loadShed;   // null when disabled
+        std::atomic<int>                    shedLevel{0};
+
+        // Queued by reloadConfig(), taken by the lane's first stage; accessed
+        // only through std::atomic_load/exchange.
+        std::shared_ptr<const TrackerConfig> pendingConfig;
+
+        // Tracks handed over by other nodes (distributed), queued by the DDS
+        // thread and adopted by the tracking thread before its next dwell.
+        std::mutex                   handoverMutex;
+        std::vector<CheckpointTrack> handoverInbox;
+        std::atomic<bool>            handoverPending{false};
+
+        // Owned by the lane's consumer thread (sequential loop or ingest stage).
+        bool     catchingUp       = false;
+        uint64_t catchUpRunDwells = 0;
+        std::chrono::steady_clock::time_point lastStatsTime;
+        uint64_t lastReportedDrops = 0;
+    };
+
+    // Applies system.realtime CPU pinning and SCHED_FIFO to every lane
+    // thread; failures are logged and otherwise ignored.
+    void applyThreadPlacement();
+
+    void processingLoop(SensorLane& lane);
+    void onDetectionReceived(SPDetectionMessage& msg);
+    bool waitForMessage(SensorLane& lane, SPDetectionMessage& msg);
+    // The reload queued for this lane, if any; clears it.
+    static std::shared_ptr<const TrackerConfig> takePendingConfig(SensorLane& lane);
+
+    // Distributed tracking: queue a track handed over by another node for
+    // its lane (DDS thread); adopt the queued ones and publish the lane's own
+    // handovers around each tracked dwell (tracking thread).
+    void onHandoverReceived(uint32_t sensorId, const CheckpointTrack& track);
+    void acceptHandovers(SensorLane& lane);
+    void sendHandovers(SensorLane& lane);
+
+    // Warns about this lane's ingest drops; lane 0 also publishes the
+    // process-wide PipelineStats and TrackerHealth topics.
+    void maybePublishStats(SensorLane& lane);
+
+    // Load shedding: feed one completed dwell to the lane's controller and
+    // apply any level change.  Called by whichever thread finishes dwells.
+    void onDwellCompleted(SensorLane& lane, double cycleMs);
+    void applyLoadShedLevel(SensorLane& lane, int level);
+
+    // Catch-up: while the ingest backlog is at or above catchUpThreshold,
+    // dwells are tracked but nothing is published.  Returns true if the dwell
+    // just popped should be fast-forwarded; the dwell that empties the
+    // backlog returns false and publishes the caught-up state.
+    bool updateCatchUp(SensorLane& lane);
+
+    // DEBUG_TABLE_* set worth building for the lane's next dwell: the debug
+    // topics with a matched reader, none while shedding or catching up.
+    uint32_t debugTables(const SensorLane& lane, bool catchUp) const;
+
+    // Pipelined mode: ingest/preprocess/cluster → predict/associate/update
+    // → publish/log, each on its own thread (per lane).
+    void ingestStageLoop(SensorLane& lane);
+    void trackStageLoop(SensorLane& lane);
+    void publishStageLoop(SensorLane& lane);
+    void publishDwell(SensorLane& lane, DwellWork& work);
 
     TrackerConfig config_;
 
+    // Per-stage latency histograms fed by every lane's TrackManager and
+    // BinaryLogger and by TrackSender; outlives all of them.
+    std::unique_ptr<StageTimings>       timings_;
+
     // One DDS participant shared by receiver and sender.
     std::unique_ptr<CuasDdsParticipant> participant_;
-    std::unique_ptr<DetectionReceiver>  receiver_;
-    std::unique_ptr<TrackManager>       trackManager_;
+    std::unique_ptr<IDetectionSource>   receiver_;    // network.ingest backend
     std::unique_ptr<TrackSender>        sender_;
+    std::unique_ptr<SectorHandover>     handover_;    // distributed.enabled
 
-    std::queue<SPDetectionMessage> messageQueue_;
-    std::mutex                     queueMutex_;
-    std::condition_variable        queueCV_;
-    std::atomic<bool>              running_{false};
-    std::thread                    processingThread_;
+    std::vector<std::unique_ptr<SensorLane>> lanes_;
+    bool                                     routeBySensor_ = false;
 
-    uint64_t cycleCount_ = 0;
+    std::atomic<bool>     running_{false};
+    std::atomic<uint64_t> cycleCount_{0};
+    std::atomic<uint64_t> fastForwarded_{0};
+    std::atomic<uint64_t> unroutedDwells_{0};   // sensorId not in sensorIds
 };
 
 } // namespace cuas
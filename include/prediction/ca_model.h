@@ -5,19 +5,29 @@
 
 namespace cuas {
 
-class CAModel : public IMotionModel {
+class CAModel final : public IMotionModel {
 public:
     CAModel(const CAConfig& cfg, const std::string& label);
 
-    void predict(const StateVector& xIn, const StateMatrix& PIn,
+    void predict(const StateVector& xIn, const SymStateMatrix& PIn,
                  double dt,
-                 StateVector& xOut, StateMatrix& POut) const override;
+                 StateVector& xOut, SymStateMatrix& POut) const override;
 
-    StateMatrix getProcessNoise(double dt) const override;
-    StateMatrix getTransitionMatrix(double dt, const StateVector& x) const override;
+    StateMatrix getTransitionMatrix(double dt, const StateVector& /*x*/) const override {
+        return prepared(dt) ? dwellF_ : buildTransition(dt);
+    }
+    TransitionStructure structure(const StateVector&) const override {
+        return TransitionStructure::AxisBlocks;
+    }
+    bool transitionDependsOnState() const override { return false; }
+    void prepare(double dt) override;
     std::string name() const override { return label_; }
 
 private:
+    StateMatrix buildProcessNoise(double dt) const override;
+    StateMatrix buildTransition(double dt) const;
+
+    StateMatrix dwellF_{};   // F for the prepared dt
     CAConfig config_;
     std::string label_;
 };
@@ -2,23 +2,73 @@
 
 #include "motion_model.h"
 #include "common/config.h"
+#include <cmath>
 
 namespace cuas {
 
-class CTRModel : public IMotionModel {
+class CTRModel final : public IMotionModel {
 public:
     CTRModel(const CTRConfig& cfg, const std::string& label);
 
-    void predict(const StateVector& xIn, const StateMatrix& PIn,
+    void predict(const StateVector& xIn, const SymStateMatrix& PIn,
                  double dt,
-                 StateVector& xOut, StateMatrix& POut) const override;
+                 StateVector& xOut, SymStateMatrix& POut) const override;
 
-    StateMatrix getProcessNoise(double dt) const override;
-    StateMatrix getTransitionMatrix(double dt, const StateVector& x) const override;
+    // With dt prepared, only the turn-rate trig terms are computed per call.
+    // Called per track; defined here so IMMBatch's statically dispatched
+    // calls inline.
+    StateMatrix getTransitionMatrix(double dt, const StateVector& x) const override {
+        double omega = estimateTurnRate(x);
+        if (std::abs(omega) < MIN_TURN_RATE)
+            return prepared(dt) ? dwellFStraight_ : buildStraightTransition(dt);
+
+        StateMatrix F = prepared(dt) ? dwellFTurn_ : buildTurnTransition(dt);
+        setTurnTerms(F, omega, dt);
+        return F;
+    }
+    // Dense while turning (x and y couple); axis blocks at zero turn rate.
+    TransitionStructure structure(const StateVector& x) const override {
+        return std::abs(estimateTurnRate(x)) < MIN_TURN_RATE ? TransitionStructure::AxisBlocks
+                                                             : TransitionStructure::Dense;
+    }
+    void prepare(double dt) override;
     std::string name() const override { return label_; }
 
 private:
-    double estimateTurnRate(const StateVector& x) const;
+    // Below this turn rate (rad/s) the model degenerates to CV.
+    static constexpr double MIN_TURN_RATE = 1e-6;
+
+    StateMatrix buildProcessNoise(double dt) const override;
+    StateMatrix buildStraightTransition(double dt) const;
+    StateMatrix buildTurnTransition(double dt) const;
+
+    // x-y coordinated turn
+    static void setTurnTerms(StateMatrix& F, double omega, double dt) {
+        double sinOt = std::sin(omega * dt);
+        double cosOt = std::cos(omega * dt);
+
+        F[0][1] = sinOt / omega;
+        F[0][4] = -(1.0 - cosOt) / omega;
+        F[1][1] = cosOt;
+        F[1][4] = -sinOt;
+        F[3][1] = (1.0 - cosOt) / omega;
+        F[3][4] = sinOt / omega;
+        F[4][1] = sinOt;
+        F[4][4] = cosOt;
+    }
+
+    static double estimateTurnRate(const StateVector& x) {
+        // Estimate turn rate from velocity and acceleration in x-y plane
+        double vx = x[1], vy = x[4];
+        double ax = x[2], ay = x[5];
+        double v2 = vx * vx + vy * vy;
+        if (v2 < 1e-6) return 0.0;
+        // omega = (vx*ay - vy*ax) / v^2
+        return (vx * ay - vy * ax) / v2;
+    }
+
+    StateMatrix dwellFStraight_{};   // F at zero turn rate, prepared dt
+    StateMatrix dwellFTurn_{};       // turning F for the prepared dt, trig terms unset
 
     CTRConfig config_;
     std::string label_;
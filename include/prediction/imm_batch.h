@@ -0,0 +1,81 @@
+#pragma once
+
+/*
+ * IMMBatch — structure-of-arrays IMM storage and predict step for all tracks.
+ *
+ * Every track owns one slot.  Slots are grouped into Blocks of one 64-byte
+ * vector's worth of lanes (8 doubles or 16 floats), and each Block stores
+ * every scalar of the IMM state (5 model states, 5 packed covariances, mode
+ * probabilities and the merged estimate) as a lane array, one lane per
+ * track.  predict() runs interaction, model prediction and merging for a
+ * whole Block at a time with the tracks in the vector lanes, so the 9x9
+ * arithmetic is issued once per Block instead of once per track.
+ *
+ * In double precision each lane performs exactly the operations the scalar
+ * IMMFilter::predict() does, in the same order, so per-track results are
+ * bit-identical.  Models whose transition matrix depends on the state (CTR)
+ * get per-lane coefficients.  A transition matrix with a non-zero outside
+ * the sparsity pattern every current model fits in is run through the
+ * model's scalar predict() for that lane instead.
+ * With model pruning on, a model frozen in every lane of a Block is skipped
+ * for that Block; lanes in which it is frozen keep their stored values.
+ *
+ * With PredictionConfig::imm.precision = Float the store and the batched
+ * predict use float: half the memory per track and twice the tracks per
+ * vector.  Packed storage keeps every covariance exactly symmetric, and
+ * transition matrices, process noise and the measurement update (Joseph
+ * form) stay in double; load() widens a slot to the double IMMState and
+ * store() rounds it back.  imm_precision_check replays a log through both
+ * precisions to quantify the divergence before float is enabled.
+ *
+ * The measurement update stays per track (only associated tracks are
+ * updated): load() a slot into an IMMState, run IMMFilter::update(), store()
+ * it back.  Distinct slots may be loaded/stored concurrently; allocate(),
+ * release(), relocate() and predict() must not overlap with any other call.
+ *
+ * allocate() takes the lowest free slot and predict() skips Blocks with no
+ * live slot, so a caller that relocate()s its slots down after releasing
+ * some pays only for the Blocks it fills.
+ */
+
+#include "imm_filter.h"
+#include "common/types.h"
+#include "common/worker_pool.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace cuas {
+
+class IMMBatch {
+public:
+    virtual ~IMMBatch() = default;
+
+    // Store of the precision in filter.config().imm.precision.  `filter`
+    // supplies the motion models and transition matrix; not owned.
+    static std::unique_ptr<IMMBatch> create(const IMMFilter& filter);
+
+    // Claims a slot and initialises every model to (x0, P0).
+    virtual uint32_t allocate(const StateVector& x0, const SymStateMatrix& P0,
+                              const std::array<double, IMM_NUM_MODELS>& modeProbs) = 0;
+    virtual void     release(uint32_t slot) = 0;
+    // Moves a live slot's state into the lowest free slot if that lies
+    // below it; returns the slot the state now occupies.
+    virtual uint32_t relocate(uint32_t slot) = 0;
+
+    // Interaction + model prediction + merge for every live slot.  Expects
+    // the filter to have been prepare()d for dt.
+    virtual void predict(double dt, WorkerPool& workers) = 0;
+
+    virtual void load(uint32_t slot, IMMState& out) const = 0;
+    virtual void store(uint32_t slot, const IMMState& in) = 0;
+
+    // Merged estimate and mode probabilities of one slot.
+    virtual void merged(uint32_t slot, StateVector& x, SymStateMatrix& P,
+                        std::array<double, IMM_NUM_MODELS>& modeProbs) const = 0;
+
+    virtual size_t       numLive()   const = 0;
+    virtual IMMPrecision precision() const = 0;
+};
+
+} // namespace cuas
@@ -1,7 +1,11 @@
 #pragma once
 
 #include "motion_model.h"
+#include "cv_model.h"
+#include "ca_model.h"
+#include "ctr_model.h"
 #include "common/types.h"
+#include "common/matrix_ops.h"
 #include "common/config.h"
 #include <vector>
 #include <memory>
@@ -9,41 +13,98 @@
 
 namespace cuas {
 
+// Covariances are stored packed (SymStateMatrix): 270 doubles per state for
+// the five model covariances and the merged one, instead of 486.
 struct IMMState {
-    std::array<StateVector, IMM_NUM_MODELS>  modelStates;
-    std::array<StateMatrix, IMM_NUM_MODELS>  modelCovariances;
-    std::array<double, IMM_NUM_MODELS>       modeProbabilities;
+    std::array<StateVector, IMM_NUM_MODELS>     modelStates;
+    std::array<SymStateMatrix, IMM_NUM_MODELS>  modelCovariances;
+    std::array<double, IMM_NUM_MODELS>          modeProbabilities;
 
-    StateVector mergedState;
-    StateMatrix mergedCovariance;
+    StateVector    mergedState;
+    SymStateMatrix mergedCovariance;
+};
+
+// Innovation statistics of one estimate under this dwell's R: the predicted
+// measurement H x and S^-1, log|S| for S = H P H^T + R.  None of it depends
+// on the measurement, so one fill serves gating, the Kalman gain and the
+// mode likelihood.
+struct InnovationStats {
+    MeasVector zPred{};
+    MeasMatrix Sinv{};
+    MeasVector sDiag{};           // diagonal of S: the gate's bounding box
+    double     logDetS = 0.0;
+    bool       valid   = false;   // S positive definite
 };
 
 class IMMFilter {
 public:
+    // Measurements are Cartesian position; see mat::SelectionMeasurement.
+    using Measurement = mat::PositionMeasurement;
+
     explicit IMMFilter(const PredictionConfig& cfg);
 
-    void init(const StateVector& x0, const StateMatrix& P0);
+    void init(const StateVector& x0, const SymStateMatrix& P0);
+    // Builds each model's per-dwell F/Q terms for dt (IMotionModel::prepare);
+    // call once per dwell before predicting any track.
+    void prepare(double dt);
     void predict(double dt, IMMState& state) const;
     void update(IMMState& state, const MeasVector& z, const MeasMatrix& R) const;
 
-    MeasStateMatrix getMeasurementMatrix() const;
-    MeasMatrix getInnovationCovariance(const IMMState& state, const MeasMatrix& R) const;
-    MeasVector getInnovation(const IMMState& state, const MeasVector& z) const;
+    MeasStateMatrix getMeasurementMatrix() const { return Measurement::matrix(); }
+    // Innovation covariance H P H^T + R and innovation z - H x of an estimate
+    // (typically a track's merged state).
+    MeasMatrix getInnovationCovariance(const SymStateMatrix& P, const MeasMatrix& R) const;
+    MeasVector getInnovation(const StateVector& x, const MeasVector& z) const;
+    InnovationStats innovationStats(const StateVector& x, const SymStateMatrix& P,
+                                    const MeasMatrix& R) const;
 
     static void mergeEstimates(IMMState& state);
 
+    // Bit m set if model m takes part in predict()/update() for these mode
+    // probabilities: always without pruning, else if mu_m > 0 or its Markov
+    // prior sum_i T_im mu_i reaches imm.reactivatePrior.
+    uint32_t activeModels(const std::array<double, IMM_NUM_MODELS>& modeProbs) const;
+
     const PredictionConfig& config() const { return config_; }
+    const IMotionModel& model(int m) const {
+        switch (m) {
+        case 0:  return cv_;
+        case 1:  return ca1_;
+        case 2:  return ca2_;
+        case 3:  return ctr1_;
+        default: return ctr2_;
+        }
+    }
+
+    // The model set is fixed (CV, CA1, CA2, CTR1, CTR2), so model m is
+    // resolved here rather than through IMotionModel: fn receives it as its
+    // concrete final type, and calls through it are direct and inline where
+    // the model defines them in its header.  Use it on per-track paths.
+    template<typename Fn>
+    decltype(auto) visitModel(int m, Fn&& fn) const {
+        switch (m) {
+        case 0:  return fn(cv_);
+        case 1:  return fn(ca1_);
+        case 2:  return fn(ca2_);
+        case 3:  return fn(ctr1_);
+        default: return fn(ctr2_);
+        }
+    }
+    const std::array<std::array<double, IMM_NUM_MODELS>, IMM_NUM_MODELS>&
+        transitionMatrix() const { return transMatrix_; }
 
 private:
-    void interaction(IMMState& state) const;
-    void modelPredictions(double dt, IMMState& state) const;
-    void updateModeProbabilities(IMMState& state, const MeasVector& z,
-                                 const MeasMatrix& R) const;
-    double modelLikelihood(int modelIdx, const IMMState& state,
-                           const MeasVector& z, const MeasMatrix& R) const;
+    void interaction(IMMState& state, uint32_t active) const;
+    void modelPredictions(double dt, IMMState& state, uint32_t active) const;
+    void updateModeProbabilities(IMMState& state,
+                                 const std::array<double, IMM_NUM_MODELS>& logLik) const;
+    void pruneModes(IMMState& state, double bestD2) const;
+    static double logLikelihood(const InnovationStats& s, double d2);
 
     PredictionConfig config_;
-    std::array<std::unique_ptr<IMotionModel>, IMM_NUM_MODELS> models_;
+    CVModel  cv_;
+    CAModel  ca1_, ca2_;
+    CTRModel ctr1_, ctr2_;
     std::array<std::array<double, IMM_NUM_MODELS>, IMM_NUM_MODELS> transMatrix_;
 };
 
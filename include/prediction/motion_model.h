@@ -1,21 +1,75 @@
 #pragma once
 
 #include "common/types.h"
+#include "common/matrix_ops.h"
+#include <limits>
 #include <string>
 
 namespace cuas {
 
+// Sparsity of a model's transition matrix F for a given state; selects the
+// covariance propagation kernel (see matrix_ops.h "Axis-block kernels").
+enum class TransitionStructure {
+    AxisBlocks,   // F = diag(F_x, F_y, F_z): no cross-axis coupling
+    Dense
+};
+
 class IMotionModel {
 public:
     virtual ~IMotionModel() = default;
 
-    virtual void predict(const StateVector& xIn, const StateMatrix& PIn,
+    virtual void predict(const StateVector& xIn, const SymStateMatrix& PIn,
                          double dt,
-                         StateVector& xOut, StateMatrix& POut) const = 0;
+                         StateVector& xOut, SymStateMatrix& POut) const = 0;
 
-    virtual StateMatrix getProcessNoise(double dt) const = 0;
+    StateMatrix getProcessNoise(double dt) const {
+        return prepared(dt) ? dwellQ_ : buildProcessNoise(dt);
+    }
     virtual StateMatrix getTransitionMatrix(double dt, const StateVector& x) const = 0;
+    virtual TransitionStructure structure(const StateVector& x) const = 0;
+    // False when F depends only on dt, letting IMMBatch build it once per
+    // dwell for every track.
+    virtual bool transitionDependsOnState() const { return true; }
     virtual std::string name() const = 0;
+
+    // Every track in a dwell is predicted with the same dt.  prepare(dt)
+    // builds Q and the dt-only part of F once; predict(), getProcessNoise()
+    // and getTransitionMatrix() with that dt then reuse them, and with any
+    // other dt build from scratch.  Must not run concurrently with them.
+    virtual void prepare(double dt) {
+        dwellQ_  = buildProcessNoise(dt);
+        dwellDt_ = dt;
+    }
+
+protected:
+    virtual StateMatrix buildProcessNoise(double dt) const = 0;
+
+    bool prepared(double dt) const { return dt == dwellDt_; }
+
+    // Q for dt without a copy when it is the prepared one.
+    const StateMatrix& processNoise(double dt, StateMatrix& scratch) const {
+        if (prepared(dt)) return dwellQ_;
+        scratch = buildProcessNoise(dt);
+        return scratch;
+    }
+
+    // xOut = F xIn, POut = F PIn F^T + Q with the kernel matching `s`.
+    static void propagate(TransitionStructure s,
+                          const StateMatrix& F, const StateMatrix& Q,
+                          const StateVector& xIn, const SymStateMatrix& PIn,
+                          StateVector& xOut, SymStateMatrix& POut) {
+        if (s == TransitionStructure::AxisBlocks) {
+            xOut = mat::multiplyMVAxisBlocks(F, xIn);
+            POut = mat::propagateAxisBlocks(F, PIn, Q);
+        } else {
+            xOut = mat::multiplyMV(F, xIn);
+            POut = mat::propagateDense(F, PIn, Q);
+        }
+    }
+
+private:
+    double      dwellDt_ = std::numeric_limits<double>::quiet_NaN();   // matches no dt
+    StateMatrix dwellQ_{};
 };
 
 } // namespace cuas
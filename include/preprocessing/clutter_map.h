@@ -0,0 +1,64 @@
+#pragma once
+
+/*
+ * ClutterMap — learned suppression of stationary returns.
+ *
+ * A dense range x azimuth x elevation grid over the preprocessing window
+ * (elevation capped at ClutterMapConfig::maxElevation, where ground clutter
+ * lives).  Each cell holds an exponential average of "was this cell hit in
+ * a dwell": density <- (1 - alpha) * density + alpha * hit.  A detection
+ * whose cell's density, learned from earlier dwells, has reached the
+ * threshold is dropped; every detection still feeds the map, so a cell
+ * that goes quiet decays back below threshold and is let through again.
+ *
+ * Decay is applied lazily: a cell stores the dwell of its last update and
+ * is aged by (1 - alpha)^elapsed when next touched, so a dwell costs one
+ * cell access per detection, not a sweep of the grid.
+ *
+ * Not thread-safe; it runs in clusterDwell() with the preprocessor.
+ */
+
+#include "common/types.h"
+#include "common/config.h"
+#include <cstdint>
+#include <vector>
+
+namespace cuas {
+
+class ClutterMap {
+public:
+    explicit ClutterMap(const PreprocessConfig& cfg);
+
+    // Learns from `dets` and removes, in place, those in clutter cells.
+    void filter(std::vector<Detection>& dets);
+
+    size_t   numCells()        const { return cells_.size(); }
+    uint64_t totalSuppressed() const { return suppressed_; }
+
+private:
+    // Dwell numbers are kept modulo 2^31 to leave room for the verdict.
+    static constexpr uint32_t DWELL_MASK = 0x7fffffffu;
+
+    struct Cell {
+        float    density   = 0.0f;
+        uint32_t lastDwell : 31;    // dwell of the last update
+        uint32_t clutter   : 1;     // verdict for that dwell
+        Cell() : lastDwell(0), clutter(0) {}
+    };
+
+    // Flat cell index, or -1 outside the mapped volume.
+    int64_t cellOf(const Detection& d) const;
+    // The cell's average as of the previous dwell.
+    float   history(const Cell& c) const;
+
+    ClutterMapConfig config_;
+    double minRange_, minAzimuth_, minElevation_;
+    int    numRange_ = 0, numAzimuth_ = 0, numElevation_ = 0;
+
+    std::vector<Cell>  cells_;
+    std::vector<float> decay_;      // (1 - alpha)^k; older is taken as 0
+    uint32_t dwell_      = 0;
+    uint64_t suppressed_ = 0;
+};
+
+} // namespace cuas
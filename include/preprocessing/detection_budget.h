@@ -0,0 +1,45 @@
+#pragma once
+
+/*
+ * DetectionBudget — caps a dwell at SystemConfig::maxDetectionsPerDwell.
+ *
+ * When a dwell has more detections than the budget, the strongest are kept:
+ * highest SNR first, then highest strength, then lowest index, so the choice
+ * is deterministic.  The cut is one nth_element over (key, index) pairs, not
+ * a sort, and the survivors keep their dwell order so clustering sees the
+ * same sequence it would without the budget.  A NaN SNR or strength ranks
+ * last.
+ *
+ * Not thread-safe; it runs in clusterDwell() with the preprocessor.
+ */
+
+#include "common/types.h"
+#include <cstdint>
+#include <vector>
+
+namespace cuas {
+
+class DetectionBudget {
+public:
+    explicit DetectionBudget(size_t maxDetections);
+
+    // Removes, in place, all but the maxDetections highest-priority entries.
+    void apply(std::vector<Detection>& dets);
+
+    size_t   limit()        const { return limit_; }
+    uint64_t totalDropped() const { return dropped_; }
+
+private:
+    struct Key {
+        double   snr, strength;
+        uint32_t index;
+    };
+
+    size_t   limit_;
+    uint64_t dropped_ = 0;
+
+    std::vector<Key>     keys_;   // apply scratch
+    std::vector<uint8_t> keep_;   // apply scratch
+};
+
+} // namespace cuas
@@ -2,6 +2,8 @@
 
 #include "common/types.h"
 #include "common/config.h"
+#include <atomic>
+#include <cstdint>
 #include <vector>
 
 namespace cuas {
@@ -10,15 +12,25 @@ class Preprocessor {
 public:
     explicit Preprocessor(const PreprocessConfig& cfg);
 
+    // New gates from the next dwell on; the load-shed SNR floor is kept.
+    void reconfigure(const PreprocessConfig& cfg) { config_ = cfg; }
+
+    // Filters `raw` into `out`, reusing out's capacity.
+    void process(DetectionView raw, std::vector<Detection>& out) const;
     std::vector<Detection> process(const std::vector<Detection>& raw) const;
     uint64_t totalRejected() const { return rejected_; }
+
+    // Load shedding: raise the SNR floor above config.minSNR (no-op if lower).
+    void setMinSNRFloor(double snr) { snrFloor_.store(snr); }
     void resetStats() { rejected_ = 0; }
 
 private:
-    bool isValid(const Detection& d) const;
-
     PreprocessConfig config_;
     mutable uint64_t rejected_ = 0;
+    std::atomic<double> snrFloor_{-1e30};
+
+    mutable std::vector<uint8_t>  keep_;      // process scratch: gate mask
+    mutable std::vector<uint32_t> selected_;  // process scratch: survivors
 };
 
 } // namespace cuas
@@ -10,11 +10,28 @@
  *
  * The DDS DataReaderListener runs on the DDS middleware thread.  The callback
  * is therefore invoked from that thread; callers must be thread-safe.
+ *
+ * Ingest buffers are recycled rather than reallocated: the IDL sample and the
+ * internal message are members reused for every dwell, and the callback may
+ * take the dwell by swapping it out (see IngestRing::push), leaving behind a
+ * drained buffer whose capacity the next conversion reuses.
+ *
+ * SPDetectionMessage carries an unbounded sequence, so it is not a plain
+ * (loanable) type and every sample is deserialized into idlMsg_.  With
+ * network.dds.zeroCopy the receiver also reads the plain SPDetectionFrame
+ * topic through loans: a same-host DSP's frame is read in place from its
+ * shared memory and converted straight into msg_.
+ *
+ * Given sensorIds, both readers go through a content filter on sensorId
+ * (distributed.contentFilter), so a node is not sent the dwells of faces
+ * other nodes track.  Without TypeObject support the filter is skipped and
+ * the pipeline drops unrouted dwells as before.
  */
 
 #include "common/types.h"
 #include "common/dds_participant.h"
 #include "common/config.h"
+#include "receiver/detection_source.h"
 
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
@@ -22,32 +39,45 @@
 
 #include <functional>
 #include <atomic>
+#include <mutex>
+#include <vector>
 
 namespace cuas {
 
 class DetectionReceiver
-    : public eprosima::fastdds::dds::DataReaderListener {
+    : public eprosima::fastdds::dds::DataReaderListener,
+      public IDetectionSource {
 public:
-    using Callback = std::function<void(const SPDetectionMessage&)>;
-
-    explicit DetectionReceiver(CuasDdsParticipant& participant,
-                               const std::string& topicName);
+    DetectionReceiver(CuasDdsParticipant& participant,
+                      const std::string& topicName,
+                      const std::vector<uint32_t>& sensorIds = {});
     ~DetectionReceiver() override = default;
 
     DetectionReceiver(const DetectionReceiver&)            = delete;
     DetectionReceiver& operator=(const DetectionReceiver&) = delete;
 
+    // The callee may swap the contents out of `msg` to take ownership.
     void setCallback(Callback cb) { callback_ = std::move(cb); }
 
     // DataReaderListener overrides
     void on_data_available(
         eprosima::fastdds::dds::DataReader* reader) override;
 
-    uint64_t totalMessagesReceived()   const { return msgCount_.load(); }
-    uint64_t totalDetectionsReceived() const { return detCount_.load(); }
+    uint64_t totalMessagesReceived()   const override { return msgCount_.load(); }
+    uint64_t totalDetectionsReceived() const override { return detCount_.load(); }
 
 private:
     Callback  callback_;
+
+    // Only touched from on_data_available (serialised per reader; with
+    // two readers, by readMutex_, since the callback has one producer).
+    CounterUAS::SPDetectionMessage idlMsg_;
+    SPDetectionMessage             msg_;
+    eprosima::fastdds::dds::DataReader* frameReader_ = nullptr;   // zeroCopy only
+    std::mutex                     readMutex_;
+
+    void deliver();
+
     std::atomic<uint64_t> msgCount_{0};
     std::atomic<uint64_t> detCount_{0};
 };
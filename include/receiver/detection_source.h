@@ -0,0 +1,28 @@
+#pragma once
+
+/*
+ * IDetectionSource — what the pipeline sees of an ingest backend
+ * (network.ingest): DetectionReceiver on the DDS SPDetection topic, or
+ * UdpDetectionReceiver on legacy raw UDP datagrams.  Each hands every dwell
+ * to a callback on its own thread(s), one dwell at a time.
+ */
+
+#include "common/types.h"
+
+#include <cstdint>
+#include <functional>
+
+namespace cuas {
+
+class IDetectionSource {
+public:
+    // The callee may swap the contents out of `msg` to take ownership.
+    using Callback = std::function<void(SPDetectionMessage& msg)>;
+
+    virtual ~IDetectionSource() = default;
+
+    virtual uint64_t totalMessagesReceived()   const = 0;
+    virtual uint64_t totalDetectionsReceived() const = 0;
+};
+
+} // namespace cuas
@@ -0,0 +1,76 @@
+#pragma once
+
+/*
+ * UdpDetectionReceiver — raw UDP ingest for legacy DSP front-ends that do
+ * not speak DDS (network.ingest "udp").
+ *
+ * Each datagram carries one dwell in the legacy layout, host byte order,
+ * packed (the raw detection log record's and the Qt display's layout):
+ *
+ *   messageId u32 | dwellCount u32 | timestamp u64 (us) | numDetections u32
+ *   numDetections x Detection (8 doubles, 64 bytes)
+ *
+ * Every receive thread (network.udp.threads) owns a socket bound to
+ * receiverIp:receiverPort with SO_RCVBUF = receiveBufferSize, and drains it
+ * up to network.udp.batch datagrams per recvmmsg() call.  With more than
+ * one thread the sockets share the port through SO_REUSEPORT; the kernel
+ * hashes each sender to one socket, so a DSP's dwells stay in order.
+ *
+ * Datagrams are parsed straight into the thread's SPDetectionMessage, whose
+ * buffer is recycled through the callback as in DetectionReceiver.  The
+ * callback has a single producer (the ingest ring), so threads deliver
+ * under a mutex; receiving and parsing run in parallel.  Malformed or
+ * truncated datagrams are dropped and counted.
+ */
+
+#include "common/types.h"
+#include "common/config.h"
+#include "common/udp_socket.h"
+#include "receiver/detection_source.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cuas {
+
+class UdpDetectionReceiver : public IDetectionSource {
+public:
+    // Binds the sockets and starts receiving into `callback`.  Throws
+    // std::runtime_error if no socket can be bound.
+    UdpDetectionReceiver(const NetworkConfig& cfg, Callback callback);
+    ~UdpDetectionReceiver() override;
+
+    UdpDetectionReceiver(const UdpDetectionReceiver&)            = delete;
+    UdpDetectionReceiver& operator=(const UdpDetectionReceiver&) = delete;
+
+    uint64_t totalMessagesReceived()   const override { return msgCount_.load(); }
+    uint64_t totalDetectionsReceived() const override { return detCount_.load(); }
+    uint64_t totalDatagramsRejected()  const { return rejected_.load(); }
+
+    // Legacy datagram → `msg` (sensorId and receivedAt untouched), reusing
+    // msg.detections' capacity.  False if the datagram is short or its
+    // detection count does not match its size.
+    static bool parse(const uint8_t* data, size_t size, SPDetectionMessage& msg);
+
+    static constexpr size_t HEADER_BYTES   = 20;
+    static constexpr int    DATAGRAM_BYTES = 65536;   // receive slot per datagram
+
+private:
+    void receiveLoop(size_t index);
+
+    Callback        callback_;
+    UdpIngestConfig udp_;
+    std::vector<std::unique_ptr<UdpSocket>> sockets_;
+    std::vector<std::thread>                threads_;
+    std::atomic<bool> running_{false};
+    std::mutex        deliverMutex_;
+
+    std::atomic<uint64_t> msgCount_{0};
+    std::atomic<uint64_t> detCount_{0};
+    std::atomic<uint64_t> rejected_{0};
+};
+
+} // namespace cuas
@@ -3,44 +3,120 @@
 /*
  * TrackSender — DDS publishers for all Tracker-to-Display topics.
  *
- * Publishes five DDS topics using IDL-generated types:
- *   "SPDetection"    — forwards raw detections (re-published for display)
- *   "TrackTable"     — batch of confirmed/active track updates
+ * Publishes eight DDS topics using IDL-generated types:
+ *   "SPDetectionDisplay" — every display.rawDetectionEvery-th raw dwell,
+ *                      only while a display subscribes
+ *   "TrackTable"     — batch of confirmed/active track updates, or with
+ *   "TrackUpdate"      dispCfg.deltaPublish one keyed instance per track
  *   "ClusterTable"   — post-clustering debug output
  *   "AssocTable"     — association/gating debug output
  *   "PredictedTable" — post-prediction debug output
+ *   "PipelineStats"  — 1 Hz ingest queue depth / overload counters
+ *   "TrackerHealth"  — 1 Hz per-stage latency percentiles
+ *
+ * With network.dds.zeroCopy a TrackTable that fits goes out instead as a
+ * plain TrackTableFrame on "TrackTableFrame", built in a sample loaned from
+ * the writer: same-host readers get it through data sharing with no
+ * serialization.  Larger tables still go on "TrackTable".
+ *
+ * The raw forward and the debug table writers (ClusterTable, PredictedTable,
+ * AssocTable) count their matched readers; nothing is converted for a
+ * topic nobody reads, and debugTables() tells the pipeline which tables
+ * anyone is listening to, so TrackManager builds only those.
  *
  * Internal types are converted to IDL wire types at this boundary.
  * No hand-written serialization code is needed.
+ *
+ * publish() sends one dwell's outputs.  With dispCfg.asyncPublish it only
+ * swaps the snapshot into a pending buffer and returns; a publisher thread
+ * swaps it out again and does the conversion and DDS writes, so a slow
+ * subscriber never stalls tracking.  The two buffers trade places on every
+ * hand-off, so their vectors are reused rather than reallocated.  If a new
+ * dwell arrives before the previous one was written, the older snapshot is
+ * superseded (counted in totalSnapshotsSuperseded()).  Each pipeline lane
+ * (radar face) has its own pending buffer, so one face never supersedes
+ * another's snapshot; the publisher thread serves lanes round-robin.
+ *
+ * In delta mode each lane remembers the last sample sent per track, so a
+ * superseded snapshot only delays changes, it never loses them.  A track
+ * missing from a lane's updates has been dropped by its TrackManager: its
+ * instance gets a final TRACK_DELETED sample (if sendDeletedTracks) and is
+ * disposed.
  */
 
 #include "common/types.h"
 #include "common/dds_participant.h"
 #include "common/config.h"
+#include "common/latency_histogram.h"
 
 #include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/DataWriterListener.hpp>
 
 #include <vector>
+#include <unordered_map>
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace cuas {
 
-class TrackSender {
+// Everything published for one dwell.  Filled by the pipeline, handed to
+// TrackSender::publish() which leaves a recycled buffer behind.
+struct DwellOutputs {
+    Timestamp ts         = 0;
+    uint32_t  dwellCount = 0;
+    uint32_t  sensorId   = 0;   // stamped on TrackTable
+    size_t    lane       = 0;   // async pending slot, < TrackSender numLanes
+
+    bool               hasRaw = false;   // forward `raw` on SPDetectionDisplay
+    SPDetectionMessage raw;
+
+    std::vector<CounterUAS::ClusterData>        clusters;
+    std::vector<CounterUAS::PredictedEntry>     predicted;
+    std::vector<CounterUAS::AssocEntry>         assoc;
+    std::vector<CounterUAS::TrackUpdateMessage> updates;
+
+    // Stamped on the TrackTable and on every track sample sent; publishNow()
+    // fills in publishTime.
+    CounterUAS::LatencyTrace trace;
+};
+
+class TrackSender : public eprosima::fastdds::dds::DataWriterListener {
 public:
-    TrackSender(CuasDdsParticipant& participant, const DisplayConfig& dispCfg);
-    ~TrackSender() = default;
+    // `timings` (optional, not owned) receives per-send latencies.
+    // `numLanes` is the number of pipeline lanes calling publish().
+    TrackSender(CuasDdsParticipant& participant, const DisplayConfig& dispCfg,
+                StageTimings* timings = nullptr, size_t numLanes = 1);
+    ~TrackSender() override;
 
     TrackSender(const TrackSender&)            = delete;
     TrackSender& operator=(const TrackSender&) = delete;
 
+    // Publishes every topic in `out` (see header comment for async mode).
+    // On return `out` holds a recycled buffer whose contents are unspecified.
+    void publish(DwellOutputs& out);
+
     // Publishes a TrackTableMessage on "TrackTable" topic.
     // Deleted tracks are filtered out unless dispCfg_.sendDeletedTracks.
     void sendTrackUpdates(
         const std::vector<CounterUAS::TrackUpdateMessage>& updates,
-        Timestamp ts);
+        Timestamp ts, uint32_t sensorId = 0,
+        const CounterUAS::LatencyTrace& trace = CounterUAS::LatencyTrace());
 
-    // Re-publishes the raw detection dwell on "SPDetection" for display.
+    // Publishes on "TrackUpdate" the tracks of `lane` that changed since they
+    // were last sent, or every track when a full refresh is due.
+    void sendTrackDeltas(
+        const std::vector<CounterUAS::TrackUpdateMessage>& updates,
+        Timestamp ts, size_t lane = 0,
+        const CounterUAS::LatencyTrace& trace = CounterUAS::LatencyTrace());
+
+    // Forwards the raw detection dwell on "SPDetectionDisplay" if
+    // wantsRawDetections(msg.dwellCount).
     void sendRawDetections(const SPDetectionMessage& msg);
+    // True if a display reads the forward and the dwell is not decimated
+    // away; callers skip copying the dwell otherwise.
+    bool wantsRawDetections(uint32_t dwellCount) const;
 
     // Debug pipeline topics.
     void sendClusterTable(
@@ -55,18 +131,83 @@ public:
         const std::vector<CounterUAS::PredictedEntry>& entries,
         Timestamp ts);
 
+    // Health telemetry; the pipeline fills the message, this just publishes it.
+    void sendPipelineStats(const CounterUAS::PipelineStatsMessage& stats);
+    void sendTrackerHealth(const CounterUAS::TrackerHealthMessage& health);
+
+    // DEBUG_TABLE_* set of the debug topics with at least one matched reader.
+    uint32_t debugTables() const;
+
+    // DataWriterListener: keeps the debug topics' reader counts current.
+    void on_publication_matched(
+        eprosima::fastdds::dds::DataWriter* writer,
+        const eprosima::fastdds::dds::PublicationMatchedStatus& info) override;
+
     uint64_t totalMessagesSent() const { return msgCount_.load(); }
+    uint64_t totalSnapshotsSuperseded() const { return superseded_.load(); }
+    // Delta mode: track samples written, and held back as unchanged.
+    uint64_t totalTrackSamplesSent()       const { return trackSamplesSent_.load(); }
+    uint64_t totalTrackSamplesSuppressed() const { return trackSamplesSuppressed_.load(); }
 
 private:
+    void publishNow(const DwellOutputs& out);
+    void publisherLoop();
+    bool changed(const CounterUAS::TrackUpdateMessage& last,
+                 const CounterUAS::TrackUpdateMessage& now) const;
+    // False if the table does not fit a frame or no loan is available.
+    bool sendTrackFrame(
+        const std::vector<CounterUAS::TrackUpdateMessage>& updates,
+        Timestamp ts, uint32_t sensorId, const CounterUAS::LatencyTrace& trace);
+
     DisplayConfig dispConfig_;
 
     eprosima::fastdds::dds::DataWriter* writerTrackTable_     = nullptr;
-    eprosima::fastdds::dds::DataWriter* writerSPDetection_    = nullptr;
+    eprosima::fastdds::dds::DataWriter* writerTrackUpdate_    = nullptr;  // delta mode
+    eprosima::fastdds::dds::DataWriter* writerTrackFrame_     = nullptr;  // zeroCopy
+    eprosima::fastdds::dds::DataWriter* writerRawDisplay_     = nullptr;
     eprosima::fastdds::dds::DataWriter* writerClusterTable_   = nullptr;
     eprosima::fastdds::dds::DataWriter* writerAssocTable_     = nullptr;
     eprosima::fastdds::dds::DataWriter* writerPredictedTable_ = nullptr;
+    eprosima::fastdds::dds::DataWriter* writerPipelineStats_  = nullptr;
+    eprosima::fastdds::dds::DataWriter* writerTrackerHealth_  = nullptr;
+
+    StageTimings* timings_ = nullptr;
 
     std::atomic<uint64_t> msgCount_{0};
+    std::atomic<uint64_t> superseded_{0};
+    std::atomic<uint64_t> trackSamplesSent_{0};
+    std::atomic<uint64_t> trackSamplesSuppressed_{0};
+
+    // Matched readers per forwarded topic, written on the DDS event thread.
+    std::atomic<int32_t> rawReaders_{0};
+    std::atomic<int32_t> clusterReaders_{0};
+    std::atomic<int32_t> predictedReaders_{0};
+    std::atomic<int32_t> assocReaders_{0};
+
+    // Delta mode, one per lane; only that lane's publishNow() touches it.
+    struct SentTrack {
+        CounterUAS::TrackUpdateMessage msg;   // last sample written
+        uint64_t                       seen = 0;   // last DeltaLane::epoch present
+    };
+    struct DeltaLane {
+        std::unordered_map<uint32_t, SentTrack> sent;
+        Timestamp lastRefresh = 0;
+        uint64_t  epoch       = 0;
+        bool      refreshed   = false;   // lastRefresh valid
+    };
+    std::vector<DeltaLane> delta_;
+
+    // Async mode: one hand-off buffer per lane, guarded by asyncMutex_.
+    struct PendingSlot {
+        DwellOutputs out;
+        bool         full = false;
+    };
+    std::vector<PendingSlot> pending_;
+    size_t                  numPending_ = 0;
+    bool                    stopping_   = false;
+    std::mutex              asyncMutex_;
+    std::condition_variable asyncCV_;
+    std::thread             publisherThread_;
 };
 
 } // namespace cuas
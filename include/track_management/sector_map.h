@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+ * SectorMap — which tracker node owns which part of the coverage
+ * (distributed.sectors).
+ *
+ * A sector is an azimuth interval, from azMinDeg increasing to azMaxDeg and
+ * possibly wrapping through ±180°, times a range interval.  Azimuth follows
+ * Detection / SphericalPos: atan2(y, x) in radians.  Distances outside a
+ * sector are in metres, the angular part taken as arc length at the point's
+ * range, so overlap and handover margins mean the same thing near the radar
+ * and far from it.
+ *
+ * Immutable after construction; safe to share between lanes.
+ */
+
+#include "common/config.h"
+#include <cstdint>
+#include <vector>
+
+namespace cuas {
+
+class SectorMap {
+public:
+    static constexpr uint32_t NO_NODE = 0xFFFFFFFFu;
+
+    explicit SectorMap(const std::vector<SectorConfig>& sectors);
+
+    bool hasSector(uint32_t nodeId) const { return find(nodeId) != nullptr; }
+
+    // Metres by which (range, azimuth) lies outside nodeId's sector: 0
+    // inside it, infinity for a node without one.
+    double outside(uint32_t nodeId, double range, double azimuth) const;
+
+    // The node whose sector holds the point; outside every sector, the
+    // nearest one's.  Sectors that overlap go to the first listed.
+    // NO_NODE if no sector is configured.
+    uint32_t owner(double range, double azimuth) const;
+
+private:
+    struct Sector {
+        uint32_t nodeId;
+        double   azMin;    // rad, in [0, 2π)
+        double   width;    // rad, in (0, 2π]
+        double   minRange, maxRange;
+    };
+
+    const Sector* find(uint32_t nodeId) const;
+    static double outside(const Sector& s, double range, double azimuth);
+
+    std::vector<Sector> sectors_;
+};
+
+} // namespace cuas
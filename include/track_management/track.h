@@ -6,56 +6,70 @@
 
 namespace cuas {
 
+// A track's estimate and bookkeeping.  Status, quality, hit count and
+// consecutive misses are read every dwell by every pass, so TrackStore keeps
+// them in arrays of their own beside the record.
 class Track {
 public:
-    Track(uint32_t id, const StateVector& x0, const StateMatrix& P0,
+    // Quality of a newly initiated track.
+    static constexpr double INITIAL_QUALITY = 0.5;
+    // slot() of a track under lazy prediction, whose IMM state the
+    // TrackManager holds outside the IMMBatch.
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+    Track(uint32_t id, const StateVector& x0, const SymStateMatrix& P0,
           const PredictionConfig& predCfg, Timestamp initTime);
 
     uint32_t id()                          const { return id_; }
-    TrackStatus status()                   const { return status_; }
     TrackClassification classification()   const { return classification_; }
 
-    const IMMState& immState()             const { return immState_; }
-    IMMState& immState()                         { return immState_; }
-
-    const StateVector& state()             const { return immState_.mergedState; }
-    const StateMatrix& covariance()        const { return immState_.mergedCovariance; }
+    // Merged IMM estimate; the per-model states live in the owning
+    // TrackManager's IMMBatch at slot().
+    const StateVector& state()             const { return state_; }
+    const SymStateMatrix& covariance()     const { return covariance_; }
+    const std::array<double, IMM_NUM_MODELS>& modeProbabilities() const { return modeProbs_; }
+    uint32_t slot()                        const { return slot_; }
 
     CartesianPos position()                const;
     CartesianPos velocity()                const;
     SphericalPos sphericalPosition()       const;
     double rangeRate()                     const;
 
-    uint32_t hitCount()            const { return hitCount_; }
     uint32_t missCount()           const { return missCount_; }
-    uint32_t consecutiveMisses()   const { return consecutiveMisses_; }
     uint32_t age()                 const { return age_; }
-    double   quality()             const { return quality_; }
     Timestamp lastUpdateTime()     const { return lastUpdateTime_; }
     Timestamp initiationTime()     const { return initiationTime_; }
 
-    void setStatus(TrackStatus s)              { status_ = s; }
     void setClassification(TrackClassification c) { classification_ = c; }
-    void setQuality(double q)                  { quality_ = q; }
+    void setSlot(uint32_t slot)                { slot_ = slot; }
+    void setEstimate(const StateVector& x, const SymStateMatrix& P,
+                     const std::array<double, IMM_NUM_MODELS>& modeProbs) {
+        state_ = x;  covariance_ = P;  modeProbs_ = modeProbs;
+    }
 
-    void recordHit();
+    void markUpdated();
     void recordMiss();
     void incrementAge();
+    // Warm restart: the counters and update time a checkpoint recorded.
+    void restoreCounters(uint32_t missCount, uint32_t age, Timestamp lastUpdateTime) {
+        missCount_ = missCount;  age_ = age;  lastUpdateTime_ = lastUpdateTime;
+    }
 
-    // Returns the IDL-generated wire type — ready for DDS publication.
-    CounterUAS::TrackUpdateMessage toUpdateMessage() const;
+    // Fills the IDL-generated wire type — ready for DDS publication.  `sph`
+    // is sphericalPosition(); the hot fields come from the owning TrackStore.
+    void toUpdateMessage(const SphericalPos& sph, TrackStatus status, double quality,
+                         uint32_t hitCount, CounterUAS::TrackUpdateMessage& msg) const;
 
 private:
     uint32_t            id_;
-    TrackStatus         status_         = TrackStatusVal::Tentative;
     TrackClassification classification_ = TrackClassVal::Unknown;
-    IMMState            immState_;
+    StateVector         state_;
+    SymStateMatrix      covariance_;
+    std::array<double, IMM_NUM_MODELS> modeProbs_;
+    uint32_t            slot_           = 0;
 
-    uint32_t hitCount_          = 0;
     uint32_t missCount_         = 0;
-    uint32_t consecutiveMisses_ = 0;
     uint32_t age_               = 0;
-    double   quality_           = 0.5;
     Timestamp initiationTime_   = 0;
     Timestamp lastUpdateTime_   = 0;
 };
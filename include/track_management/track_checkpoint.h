@@ -0,0 +1,92 @@
+#pragma once
+
+/*
+ * TrackCheckpoint — TrackManager state in a memory-mapped file, for warm
+ * restart.
+ *
+ * The file holds a header and two image slots.  save() copies an image into
+ * the slot not holding the newest one and then flips the header's `newest`
+ * index, so a crash mid-save leaves the previous image intact.  Saving is a
+ * memcpy into the page cache plus an asynchronous flush: the tracking thread
+ * never waits for the disk, and a process crash loses nothing the kernel
+ * already holds.  Each slot carries a checksum, so load() falls back to the
+ * older image if the newest was torn by a power loss.
+ *
+ * An image is tied to the record layouts it was written with; a file from a
+ * build with different record sizes or state dimensions is not loaded.
+ */
+
+#include "common/types.h"
+#include "prediction/imm_filter.h"
+#include "track_initiator.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cuas {
+
+// One track: the TrackStore record and hot fields, plus its IMM slot state.
+struct CheckpointTrack {
+    uint32_t id             = 0;
+    uint32_t status         = 0;
+    uint32_t classification = 0;
+    uint32_t hitCount       = 0;
+    uint32_t consecutiveMisses = 0;
+    uint32_t missCount      = 0;
+    uint32_t age            = 0;
+    uint32_t reserved       = 0;
+    double   quality        = 0.0;
+    Timestamp initiationTime = 0;
+    Timestamp lastUpdateTime = 0;
+    Timestamp stateTime      = 0;   // dwell the state is predicted to; 0 if unknown
+    StateVector    state;
+    SymStateMatrix covariance;
+    std::array<double, IMM_NUM_MODELS> modeProbs;
+    IMMState imm;
+};
+
+struct CheckpointImage {
+    uint32_t  sensorId      = 0;
+    uint32_t  dwellCount    = 0;
+    Timestamp lastDwellTime = 0;
+    uint32_t  nextTrackId   = 1;
+    uint64_t  nextSerial    = 0;
+    uint32_t  ringSize      = 0;   // history entries per candidate
+    std::vector<CheckpointTrack>     tracks;
+    std::vector<InitiationCandidate> candidates;
+    std::vector<TentativeDetection>  history;
+};
+
+class TrackCheckpoint {
+public:
+    // Opens or creates `directory`/`fileName`; isOpen() is false on failure.
+    TrackCheckpoint(const std::string& directory, const std::string& fileName);
+    ~TrackCheckpoint();
+
+    TrackCheckpoint(const TrackCheckpoint&)            = delete;
+    TrackCheckpoint& operator=(const TrackCheckpoint&) = delete;
+
+    bool isOpen() const { return base_ != nullptr; }
+    const std::string& path() const { return path_; }
+
+    bool save(const CheckpointImage& img);
+    // The newest intact image; false if there is none.
+    bool load(CheckpointImage& img) const;
+
+private:
+    bool map(uint64_t size);
+    void unmap();
+    bool loadSlot(uint32_t slot, CheckpointImage& img) const;
+
+    std::string path_;
+    uint8_t*    base_ = nullptr;
+    uint64_t    size_ = 0;
+#ifdef _WIN32
+    void* file_    = nullptr;
+    void* mapping_ = nullptr;
+#else
+    int   fd_ = -1;
+#endif
+};
+
+} // namespace cuas
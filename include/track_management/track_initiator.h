@@ -3,23 +3,34 @@
 #include "common/types.h"
 #include "common/config.h"
 #include "track.h"
+#include <cstdint>
 #include <vector>
-#include <deque>
-#include <memory>
 
 namespace cuas {
 
+// The parts of a cluster initiation uses.
 struct TentativeDetection {
-    Cluster cluster;
-    Timestamp timestamp;
-    uint32_t dwellCount;
+    double       range     = 0.0;
+    double       azimuth   = 0.0;
+    double       elevation = 0.0;
+    double       snr       = 0.0;
+    CartesianPos cartesian;
+    Timestamp    timestamp  = 0;
+    uint32_t     dwellCount = 0;
 };
 
+// Candidate state; its detections live in TrackInitiator's history ring.
 struct InitiationCandidate {
-    std::deque<TentativeDetection> history;
-    uint32_t hits  = 0;
-    uint32_t total = 0;
-    bool promoted  = false;
+    uint32_t hits       = 0;
+    uint32_t total      = 0;
+    uint32_t head       = 0;     // ring entry of the latest detection
+    uint32_t firstDwell = 0;
+    uint64_t serial     = 0;     // creation order
+    bool     promoted   = false;
+
+    // Chain of the grid bucket holding the latest detection (-1 = none).
+    int32_t  prev = -1, next = -1;
+    uint32_t bucket = 0;
 };
 
 class TrackInitiator {
@@ -28,25 +39,79 @@ public:
                    const InitialCovarianceConfig& covCfg,
                    const PredictionConfig& predCfg);
 
-    std::vector<std::unique_ptr<Track>> processCandidates(
-        const std::vector<Cluster>& unmatched,
-        Timestamp ts, uint32_t dwellCount);
+    // `unmatched` indexes the dwell's clusters left over by association.
+    // At most `maxNew` tracks are initiated, highest-SNR candidates first;
+    // `newTracks` is overwritten with them in the order they qualified.
+    void processCandidates(const std::vector<Cluster>& clusters,
+                           const std::vector<int>& unmatched, Timestamp ts,
+                           uint32_t dwellCount, std::vector<Track>& newTracks,
+                           size_t maxNew = SIZE_MAX);
 
     void purgeStaleCandidates(uint32_t currentDwell);
     size_t numCandidates() const { return candidates_.size(); }
+    // Qualified candidates held back by maxNew, summed over dwells.
+    uint64_t totalDeferred() const { return deferred_; }
+
+    // New settings from the next dwell on.  Candidates survive unless n
+    // (and with it the history ring) changes; track IDs carry on.
+    void reconfigure(const InitiationConfig& initCfg,
+                     const InitialCovarianceConfig& covCfg,
+                     const PredictionConfig& predCfg);
+
+    // Sets the next track ID to hand out (see TRACK_ID_BLOCK_PER_SENSOR).
+    void setFirstTrackId(uint32_t id) { nextId_ = id; }
+
+    // Checkpoint access: candidate i's history is history()[i * ringSize() ..].
+    const std::vector<InitiationCandidate>& candidates() const { return candidates_; }
+    const std::vector<TentativeDetection>&  history()    const { return history_; }
+    size_t   ringSize()   const { return ringSize_; }
+    uint32_t nextId()     const { return nextId_; }
+    uint64_t nextSerial() const { return nextSerial_; }
+    // Replaces every candidate; the grid is rebuilt.
+    void restore(const std::vector<InitiationCandidate>& candidates,
+                 const std::vector<TentativeDetection>& history,
+                 uint32_t nextId, uint64_t nextSerial);
 
 private:
-    StateVector initState(const Cluster& c) const;
-    StateVector initStateWithVelocity(const Cluster& c0, const Cluster& c1, double dt) const;
-    StateMatrix initCovariance() const;
+    StateVector initState(const TentativeDetection& d) const;
+    StateVector initStateWithVelocity(const TentativeDetection& d0,
+                                      const TentativeDetection& d1, double dt) const;
+    SymStateMatrix initCovariance() const;
     uint32_t nextTrackId();
 
+    // History ring: candidate i owns history_[i * ringSize_ ..][0 .. ringSize_),
+    // holding its last min(hits, ringSize_) detections.
+    const TentativeDetection& latest(size_t i) const;
+    const TentativeDetection& previous(size_t i) const;
+    void push(size_t i, const TentativeDetection& d);
+
+    // Candidates are hashed into a grid of range x azimuth cells by their
+    // latest detection, one intrusive chain per bucket.
+    uint32_t bucketOf(int64_t rangeCell, int64_t azimuthCell) const;
+    void link(size_t i);
+    void unlink(size_t i);
+    void rehash(size_t buckets);
+    int  findMatch(const TentativeDetection& d, Timestamp ts) const;
+    void removeAt(size_t i);
+
     InitiationConfig       initCfg_;
     InitialCovarianceConfig covCfg_;
     PredictionConfig       predCfg_;
 
+    size_t ringSize_;
+    double rangeCell_;
+
     std::vector<InitiationCandidate> candidates_;
-    uint32_t nextId_ = 1;
+    std::vector<TentativeDetection>  history_;
+    std::vector<int32_t>             buckets_;     // chain heads
+    // Bounds on every latest().timestamp, for the widest range gate.
+    Timestamp oldestLatest_ = UINT64_MAX;
+    Timestamp newestLatest_ = 0;
+    uint64_t  nextSerial_   = 0;
+
+    std::vector<size_t>              qualified_, ranked_;   // processCandidates scratch
+    uint32_t nextId_   = 1;
+    uint64_t deferred_ = 0;
 };
 
 } // namespace cuas
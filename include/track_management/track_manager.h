@@ -1,13 +1,20 @@
 #pragma once
 
 #include "track.h"
+#include "track_store.h"
 #include "track_initiator.h"
+#include "track_checkpoint.h"
+#include "sector_map.h"
 #include "common/config.h"
 #include "common/logger.h"
+#include "common/worker_pool.h"
 #include "prediction/imm_filter.h"
+#include "prediction/imm_batch.h"
 #include "association/association_engine.h"
 #include "clustering/cluster_engine.h"
 #include "preprocessing/preprocessor.h"
+#include "preprocessing/clutter_map.h"
+#include "preprocessing/detection_budget.h"
 #include <vector>
 #include <memory>
 
@@ -15,19 +22,94 @@ namespace cuas {
 
 class TrackManager {
 public:
-    explicit TrackManager(const TrackerConfig& cfg);
+    // `timings` (optional, not owned) receives per-stage latencies.
+    // `sensorId` selects the track ID block and binary log and checkpoint
+    // file names, so several instances can share one process (one per radar
+    // face).  With system.checkpoint enabled, the newest checkpoint is
+    // reloaded here and tracking resumes from it on the first dwell.
+    explicit TrackManager(const TrackerConfig& cfg, StageTimings* timings = nullptr,
+                          uint32_t sensorId = 0);
 
+    // Runs one dwell through every stage (clusterDwell + trackDwell).  With
+    // clustering.trackAided the tracks are predicted before clustering
+    // instead (ClusterEngine::processAided).
     void processDwell(const SPDetectionMessage& msg);
 
-    const std::vector<std::unique_ptr<Track>>& tracks() const { return tracks_; }
+    // Stage group 1: raw logging, preprocessing and clustering.  Touches only
+    // the preprocessor and cluster engine, so in pipelined mode it runs on a
+    // different thread than trackDwell() for the previous dwell.
+    std::vector<Cluster> clusterDwell(const SPDetectionMessage& msg, Timestamp ts);
+    // As above into `out`, reusing its capacity.
+    void clusterDwell(const SPDetectionMessage& msg, Timestamp ts, std::vector<Cluster>& out);
 
-    // Returns IDL-generated wire types ready for DDS publication.
-    std::vector<CounterUAS::TrackUpdateMessage> getTrackUpdates() const;
+    // Stage group 2: predict, associate, then one lifecycle pass that
+    // maintains, deletes, classifies and snapshots every track.
+    void trackDwell(const std::vector<Cluster>& clusters, Timestamp ts,
+                    uint32_t dwellCount);
 
-    uint32_t numActiveTracks()   const;
-    uint32_t numConfirmedTracks() const;
+    static std::vector<CounterUAS::ClusterData> toClusterTable(
+        const std::vector<Cluster>& clusters);
+    static void toClusterTable(const std::vector<Cluster>& clusters,
+                               std::vector<CounterUAS::ClusterData>& table);
+
+    // Live tracks, in no fixed order; deleted tracks are removed at once.
+    const TrackStore& tracks() const { return tracks_; }
+
+    // IDL-generated wire types ready for DDS publication, as the last
+    // trackDwell() left the tracks.
+    const std::vector<CounterUAS::TrackUpdateMessage>& getTrackUpdates() const { return trackUpdates_; }
+
+    // Distributed mode: a track this node handed to the owner of the sector
+    // it moved into, with the whole IMM state.
+    struct Handover {
+        uint32_t        toNode = 0;
+        CheckpointTrack track;
+    };
+
+    // Tracks the last trackDwell() handed over; they have already left
+    // tracks().  Publish them before the next dwell.
+    const std::vector<Handover>& handovers() const { return handovers_; }
+
+    // Continues a track another node handed to this one, under its own ID.
+    // A state from an earlier dwell is predicted up to this node's last
+    // dwell; one from a dwell this node has not reached yet waits for it.
+    // Either is dropped if more than maxCoastingDwells cycles away.  If a
+    // local track lies within distributed.dedupGateM of it, the one with
+    // more hits survives.  Returns false if the handover was dropped.
+    // Call between dwells, on the thread running trackDwell().
+    bool acceptHandover(const CheckpointTrack& track);
+
+    // Kept current on every status change; no scan.
+    uint32_t numActiveTracks()    const { return static_cast<uint32_t>(tracks_.size()); }
+    uint32_t numConfirmedTracks() const { return numConfirmed_; }
+
+    // Detections cut by maxDetectionsPerDwell and initiations held back by
+    // maxTracks, summed over dwells.
+    uint64_t droppedDetections()   const;
+    uint64_t deferredInitiations() const;
 
     BinaryLogger& logger() { return logger_; }
+    uint32_t      sensorId() const { return sensorId_; }
+
+    // Hot reload: adopts cfg's preprocessing, clustering, prediction,
+    // association and trackManagement settings from the next dwell on,
+    // keeping every track.  The clutter map and the IMM store precision
+    // are fixed at construction, as is everything under system.  Call
+    // between dwells; in pipelined mode the clustering half belongs on the
+    // clusterDwell() thread and the tracking half on the trackDwell() one.
+    void reconfigure(const TrackerConfig& cfg);
+    void reconfigureClustering(const TrackerConfig& cfg);
+    void reconfigureTracking(const TrackerConfig& cfg);
+
+    // Load-shedding hooks; safe to call from another pipeline thread.
+    void setAssociationFallback(bool useGNN) { associationEngine_->setFallbackToGNN(useGNN); }
+    void setMinSNRFloor(double snr)          { preprocessor_->setMinSNRFloor(snr); }
+
+    // DEBUG_TABLE_* set of the tables below to build from the next dwell on
+    // (default all); the others are left empty.  Not thread safe: call from
+    // the thread running the dwells.
+    void     setDebugTables(uint32_t tables) { debugTables_ = tables; }
+    uint32_t debugTables() const             { return debugTables_; }
 
     // Cached intermediate pipeline stages (IDL types) for TrackSender.
     const std::vector<CounterUAS::ClusterData>&       lastClusters()   const { return lastClusters_; }
@@ -36,30 +118,106 @@ public:
     uint32_t                                           lastDwellCount() const { return dwellCount_; }
 
 private:
-    void predict(double dt);
-    void associate(const std::vector<Cluster>& clusters);
-    void maintainTracks();
-    void deleteTracks();
-    void classifyTracks();
+    // trackDwell() in parts, which processDwell() runs around track-aided
+    // clustering.  beginDwell() returns the dt to predict over.
+    double beginDwell(Timestamp ts, uint32_t dwellCount);
+    void   preprocess(const SPDetectionMessage& msg, Timestamp ts);
+    void   predict(double dt);
+    void   logPredicted();
+    void   endDwell(Timestamp ts);
+    // Track-aided clustering: settles each aided cluster with its track
+    // before the association, or hands it back to clusters_.
+    void   claimAided();
+    // Lazy prediction: eligible tracks leave the IMMBatch, and lazy tracks
+    // whose bounding gate holds a cluster (all of them once disabled) catch
+    // up on the predicts they skipped and rejoin it.
+    void parkLazy();
+    void wakeLazy(const std::vector<Cluster>& clusters);
+    void associate(const std::vector<Cluster>& clusters, Timestamp ts);
+    void updateLifecycle();
+    void removeTrack(size_t pos, const char* reason);
+    void exportTrack(size_t pos, CheckpointTrack& out) const;
+    void importTrack(const CheckpointTrack& track);
+    // acceptHandover() for a state at lastDwellTime_.
+    bool adoptHandover(const CheckpointTrack& track);
+    // Distributed mode: drop detections beyond overlapM of this node's
+    // sector; the node a track should be handed to, or NO_NODE.
+    void     gateToSector(std::vector<Detection>& dets) const;
+    uint32_t handoverTarget(const SphericalPos& sph) const;
+    void restoreCheckpoint();
+    void saveCheckpoint();
+    void discardRestored();
+    static TrackClassification classify(const Track& track);
 
     TrackerConfig config_;
     std::unique_ptr<Preprocessor>        preprocessor_;
+    std::unique_ptr<ClutterMap>          clutterMap_;   // null unless enabled
+    std::unique_ptr<DetectionBudget>     budget_;       // null if maxDetectionsPerDwell <= 0
     std::unique_ptr<ClusterEngine>       clusterEngine_;
     std::unique_ptr<IMMFilter>           immFilter_;
+    std::unique_ptr<IMMBatch>            immBatch_;    // per-model IMM state of tracks_
+    std::unique_ptr<IMMBatch>            catchUp_;     // lazy tracks' owed predicts, in wakeLazy
     std::unique_ptr<AssociationEngine>   associationEngine_;
     std::unique_ptr<TrackInitiator>      trackInitiator_;
+    std::unique_ptr<WorkerPool>          workers_;
+    std::unique_ptr<TrackCheckpoint>     checkpoint_;  // null unless enabled
+    std::unique_ptr<SectorMap>           sectors_;     // null unless distributed
+
+    TrackStore tracks_;
+
+    // A track holding Track::NO_SLOT: its IMM state as of its last full
+    // predict or update, and the dwell dts of the predicts it owes since.
+    struct LazyTrack {
+        IMMState            imm;
+        std::vector<double> steps;
+        double              elapsed = 0.0;   // sum of steps
+    };
+    std::vector<LazyTrack> lazy_;   // by TrackStore handle
+
+    // Per-dwell scratch, reused: processDwell() keeps every stage's buffers
+    // (and the stages their own), so a steady dwell size allocates nothing.
+    std::vector<Detection>              filtered_;   // clusterDwell scratch, reused per dwell
+    std::vector<Cluster>                clusters_;   // processDwell's clusters
+    std::vector<MeasMatrix>             trackNoise_;  // R at each track's prediction, by position
+    std::vector<InnovationStats>        innovations_; // gates at each track's prediction, by position
+    std::vector<size_t>                 lazyPos_;     // wakeLazy scratch: lazy track positions,
+    std::vector<size_t>                 woken_;       //   those woken this dwell
+    std::vector<uint32_t>               wokenSlots_;  //   and their catchUp_ slots
+    std::vector<int>                    near_;        // wakeLazy and claimAided scratch
+    ClusterIndex                        lazyIndex_;
+    std::vector<Cluster>                aided_;        // processDwell's track-aided clusters,
+    std::vector<int>                    aidedTrack_;   //   their tracks' positions,
+    std::vector<AssociationResult>      aidedMatched_; //   and those claimAided() settled
+    std::vector<uint8_t>                aiding_;       // processDwell scratch: confirmed, by position
+    std::vector<uint8_t>                contested_;    // claimAided scratch: by aided cluster,
+    std::vector<int>                    aidedByX_;     //   aided clusters by x,
+    std::vector<int>                    aidedOf_;      //   and each track's, by position
+    std::vector<uint8_t>                claimed_;      // associate scratch, by position
+    std::vector<uint32_t>               trackIds_;    // associate scratch, same order
+    std::vector<TrackStore::Handle>     evictable_;   // associate scratch, weakest first
+    std::vector<Track>                  newTracks_;   // associate scratch, from the initiator
+    AssociationOutput                   assoc_;       // associate scratch
+    CheckpointImage                     ckptImage_;   // saveCheckpoint scratch
+    std::vector<Handover>               handovers_;   // last trackDwell's
+    std::vector<CheckpointTrack>        earlyHandovers_; // accepted ahead of their stateTime
 
-    std::vector<std::unique_ptr<Track>> tracks_;
-    BinaryLogger logger_;
-    MeasMatrix measurementNoise_;
+    BinaryLogger  logger_;
+    StageTimings* timings_  = nullptr;
+    uint32_t      sensorId_ = 0;
 
     Timestamp lastDwellTime_ = 0;
+    Timestamp dwellTime_     = 0;       // the running dwell's, from beginDwell()
     uint32_t  dwellCount_    = 0;
+    uint32_t  numConfirmed_  = 0;
+    uint32_t  sinceCheckpoint_ = 0;     // dwells since the last save
+    bool      resumed_       = false;   // restored; first dwell not yet seen
+    uint32_t  debugTables_   = DEBUG_TABLES_ALL;
 
     // IDL-typed caches for pipeline debug topics.
     std::vector<CounterUAS::ClusterData>     lastClusters_;
     std::vector<CounterUAS::AssocEntry>      lastAssoc_;
     std::vector<CounterUAS::PredictedEntry>  lastPredicted_;
+    std::vector<CounterUAS::TrackUpdateMessage> trackUpdates_;
 };
 
 } // namespace cuas
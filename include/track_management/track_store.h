@@ -0,0 +1,97 @@
+#pragma once
+
+/*
+ * TrackStore — dense, pooled table of the live tracks.
+ *
+ * Tracks occupy positions [0, size()) in no fixed order: remove() moves the
+ * last track into the hole, so deletion is O(1) and every pass scans
+ * contiguous memory.  A Handle names a track for its whole life across
+ * those moves, and find() maps a track ID to its position through an
+ * open-addressed table.
+ *
+ * The scalar fields every per-dwell pass reads — status, consecutive
+ * misses, quality and hit count — live in their own arrays.  The Track
+ * records beside them hold the rest, including the merged IMM estimate;
+ * the per-model IMM state stays in the TrackManager's IMMBatch.
+ *
+ * Records are stored by value, so once the table has reached its working
+ * size, adding a track allocates nothing.  Not thread-safe, except that
+ * distinct positions may be written concurrently.
+ */
+
+#include "track.h"
+#include <cstdint>
+#include <vector>
+
+namespace cuas {
+
+class TrackStore {
+public:
+    using Handle = uint32_t;
+
+    void reserve(size_t n);
+
+    // Appends `t` as a Tentative track with one hit, no misses and
+    // Track::INITIAL_QUALITY; returns its handle.
+    Handle add(const Track& t);
+    // Swap-removes the track at `pos`; the last track moves to `pos`.
+    void   remove(size_t pos);
+    void   clear();
+
+    size_t size()  const { return records_.size(); }
+    bool   empty() const { return records_.empty(); }
+
+    Track&       operator[](size_t pos)       { return records_[pos]; }
+    const Track& operator[](size_t pos) const { return records_[pos]; }
+
+    Handle handle(size_t pos)   const { return handleOf_[pos]; }
+    size_t position(Handle h)   const { return posOf_[h]; }
+    // Position of the track with this ID, or -1.
+    long   find(uint32_t id)    const;
+
+    // Hot fields, by position.
+    TrackStatus& status(size_t pos)                  { return status_[pos]; }
+    TrackStatus  status(size_t pos)            const { return status_[pos]; }
+    uint32_t&    consecutiveMisses(size_t pos)       { return misses_[pos]; }
+    uint32_t     consecutiveMisses(size_t pos) const { return misses_[pos]; }
+    double&      quality(size_t pos)                 { return quality_[pos]; }
+    double       quality(size_t pos)           const { return quality_[pos]; }
+    uint32_t&    hitCount(size_t pos)                { return hits_[pos]; }
+    uint32_t     hitCount(size_t pos)          const { return hits_[pos]; }
+
+    void recordHit(size_t pos);
+    void recordMiss(size_t pos);
+
+    // `sph` is the track's sphericalPosition().
+    void toUpdateMessage(size_t pos, const SphericalPos& sph,
+                         CounterUAS::TrackUpdateMessage& msg) const;
+
+private:
+    struct IdEntry {
+        uint32_t id;        // 0 = empty; track IDs start at 1
+        Handle   handle;
+    };
+
+    size_t home(uint32_t id) const;
+    void   insertId(uint32_t id, Handle h);
+    void   eraseId(uint32_t id);
+    void   growIds();
+
+    // Dense, by position.
+    std::vector<Track>       records_;
+    std::vector<TrackStatus> status_;
+    std::vector<uint32_t>    misses_;
+    std::vector<double>      quality_;
+    std::vector<uint32_t>    hits_;
+    std::vector<Handle>      handleOf_;
+
+    // By handle.
+    std::vector<uint32_t> posOf_;
+    std::vector<Handle>   freeHandles_;
+
+    // Linear probing with backward-shift deletion; at most half full.
+    std::vector<IdEntry> ids_;
+    int                  idBits_ = 0;
+};
+
+} // namespace cuas
@@ -6,21 +6,36 @@ CONFIG   += c++17
 SOURCES += \
     main.cpp \
     mainwindow.cpp \
+    displayreceiver.cpp \
     udpreceiver.cpp \
     ppiwidget.cpp \
     scopewidget.cpp \
     timeserieswidget.cpp \
+    tablemodels.cpp \
     logdialog.cpp
 
 HEADERS += \
     mainwindow.h \
+    displayreceiver.h \
     udpreceiver.h \
     ppiwidget.h \
     scopewidget.h \
     timeserieswidget.h \
+    tablemodels.h \
     logdialog.h
 
 win32 {
     LIBS += -lws2_32
     DEFINES += WIN32_LEAN_AND_MEAN NOMINMAX
 }
+
+# Native DDS feed (DdsReceiver): qmake "CONFIG+=cuas_dds" CUAS_BUILD=<tracker build dir>
+# Links the tracker's cuas_common / cuas_idl libraries and Fast DDS.
+cuas_dds {
+    isEmpty(CUAS_BUILD): CUAS_BUILD = $$PWD/../build
+    DEFINES     += CUAS_DISPLAY_DDS
+    INCLUDEPATH += $$PWD/../include $$CUAS_BUILD/generated
+    SOURCES     += ddsreceiver.cpp
+    HEADERS     += ddsreceiver.h
+    LIBS        += -L$$CUAS_BUILD -lcuas_common -lcuas_idl -lfastrtps -lfastcdr
+}
@@ -0,0 +1,322 @@
+#include "ddsreceiver.h"
+
+#include "common/constants.h"
+#include "common/dds_participant.h"
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <map>
+
+namespace dds = eprosima::fastdds::dds;
+using eprosima::fastrtps::types::ReturnCode_t;
+
+// ---------------------------------------------------------------------------
+// IDL → display structs.  TrackUpdateMessage and TrackFrameEntry share their
+// accessor names, so one template converts both.
+// ---------------------------------------------------------------------------
+template <typename Track>
+static void toTrackData(const Track &s, TrackData &t)
+{
+    t.trackId        = s.trackId();
+    t.timestamp      = s.timestamp();
+    t.status         = static_cast<uint32_t>(s.status());
+    t.classification = static_cast<uint32_t>(s.classification());
+    t.range          = s.range();
+    t.azimuth        = s.azimuth();
+    t.elevation      = s.elevation();
+    t.rangeRate      = s.rangeRate();
+    t.x  = s.x();  t.y  = s.y();  t.z  = s.z();
+    t.vx = s.vx(); t.vy = s.vy(); t.vz = s.vz();
+    t.trackQuality   = s.trackQuality();
+    t.hitCount       = s.hitCount();
+    t.missCount      = s.missCount();
+    t.age            = s.age();
+}
+
+// Forwards on_data_available to a DdsReceiver member.
+class ReaderListener : public dds::DataReaderListener {
+public:
+    explicit ReaderListener(std::function<void(dds::DataReader *)> fn) : fn_(std::move(fn)) {}
+    void on_data_available(dds::DataReader *reader) override { fn_(reader); }
+private:
+    std::function<void(dds::DataReader *)> fn_;
+};
+
+// Each reader's samples and decode targets.  Only that reader's listener
+// touches them, and the publish*() hand-offs swap in recycled buffers.
+struct DdsReceiver::Scratch {
+    CounterUAS::SPDetectionMessage    detMsg;
+    RawDetectionFrame                 detections;
+
+    CounterUAS::TrackTableMessage     tableMsg;
+    QVector<TrackData>                tableTracks;
+
+    QVector<TrackData>                frameTracks;
+
+    CounterUAS::TrackUpdateMessage    updateMsg;
+    std::map<uint32_t, TrackData>     liveTracks;   // TrackUpdate instances not disposed
+    QVector<TrackData>                updateTracks;
+
+    CounterUAS::ClusterTableMessage   clusterMsg;
+    QVector<ClusterData>              clusters;
+
+    CounterUAS::AssocTableMessage     assocMsg;
+    QVector<AssocEntry>               assoc;
+
+    CounterUAS::PredictedTableMessage predMsg;
+    QVector<PredictedEntry>           predicted;
+};
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+DdsReceiver::DdsReceiver(int domainId, QObject *parent)
+    : DisplayReceiver(parent)
+    , domainId_(domainId)
+    , scratch_(new Scratch)
+{
+}
+
+DdsReceiver::~DdsReceiver()
+{
+    stopRenderTick();
+    participant_.reset();
+}
+
+QString DdsReceiver::endpoint() const
+{
+    return tr("DDS domain %1").arg(domainId_);
+}
+
+bool DdsReceiver::start()
+{
+    if (participant_) return true;
+
+    // The tracker's default QoS profiles, with data sharing on so a
+    // same-host tracker's samples skip the transports.
+    cuas::DdsConfig cfg;
+    cfg.dataSharing = true;
+
+    auto listen = [this](void (DdsReceiver::*fn)(dds::DataReader *)) {
+        listeners_.emplace_back(new ReaderListener(
+            [this, fn](dds::DataReader *r) { (this->*fn)(r); }));
+        return listeners_.back().get();
+    };
+
+    try {
+        participant_.reset(new cuas::CuasDdsParticipant(
+            static_cast<uint8_t>(domainId_), 0, cfg));
+        participant_->makeReader<CounterUAS::SPDetectionMessage>(
+            cuas::TOPIC_SP_DETECTION_DISPLAY, listen(&DdsReceiver::onDetections));
+        participant_->makeReader<CounterUAS::TrackTableMessage>(
+            cuas::TOPIC_TRACK_TABLE, listen(&DdsReceiver::onTrackTable));
+        participant_->makeReader<CounterUAS::TrackTableFrame>(
+            cuas::TOPIC_TRACK_TABLE_FRAME, listen(&DdsReceiver::onTrackFrame));
+        participant_->makeReader<CounterUAS::TrackUpdateMessage>(
+            cuas::TOPIC_TRACK_UPDATE, listen(&DdsReceiver::onTrackUpdate));
+        participant_->makeReader<CounterUAS::ClusterTableMessage>(
+            cuas::TOPIC_CLUSTER_TABLE, listen(&DdsReceiver::onClusters));
+        participant_->makeReader<CounterUAS::AssocTableMessage>(
+            cuas::TOPIC_ASSOC_TABLE, listen(&DdsReceiver::onAssoc));
+        participant_->makeReader<CounterUAS::PredictedTableMessage>(
+            cuas::TOPIC_PREDICTED_TABLE, listen(&DdsReceiver::onPredicted));
+    } catch (const std::exception &e) {
+        participant_.reset();
+        listeners_.clear();
+        error_ = QString::fromUtf8(e.what());
+        return false;
+    }
+
+    startRenderTick();
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Listener callbacks (DDS threads).  Every queued sample is taken and
+// converted into the reader's scratch; the newest is published once.
+// ---------------------------------------------------------------------------
+void DdsReceiver::onDetections(dds::DataReader *reader)
+{
+    CounterUAS::SPDetectionMessage &msg = scratch_->detMsg;
+    dds::SampleInfo info;
+    bool have = false;
+    while (reader->take_next_sample(&msg, &info) == ReturnCode_t::RETCODE_OK) {
+        if (!info.valid_data) continue;
+        have = true;
+
+        RawDetectionFrame &frame = scratch_->detections;
+        frame.dwellCount = msg.dwellCount();
+        frame.timestamp  = msg.timestamp();
+        const auto &src  = msg.detections();
+        frame.detections.resize(static_cast<int>(src.size()));
+        for (int i = 0; i < frame.detections.size(); ++i) {
+            const CounterUAS::DetectionData &s = src[static_cast<size_t>(i)];
+            RawDetection &d = frame.detections[i];
+            d.range        = s.range();
+            d.azimuth      = s.azimuth();
+            d.elevation    = s.elevation();
+            d.strength     = s.strength();
+            d.noise        = s.noise();
+            d.snr          = s.snr();
+            d.rcs          = s.rcs();
+            d.microDoppler = s.microDoppler();
+        }
+    }
+    if (have) publishDetections(scratch_->detections);
+}
+
+void DdsReceiver::onTrackTable(dds::DataReader *reader)
+{
+    CounterUAS::TrackTableMessage &msg = scratch_->tableMsg;
+    QVector<TrackData>         &tracks = scratch_->tableTracks;
+    dds::SampleInfo info;
+    bool have = false;
+    while (reader->take_next_sample(&msg, &info) == ReturnCode_t::RETCODE_OK) {
+        if (!info.valid_data) continue;
+        have = true;
+
+        const auto &src = msg.tracks();
+        tracks.resize(static_cast<int>(src.size()));
+        for (int i = 0; i < tracks.size(); ++i)
+            toTrackData(src[static_cast<size_t>(i)], tracks[i]);
+    }
+    if (have) publishTracks(tracks);
+}
+
+// Plain frame from a tracker with network.dds.zeroCopy: read in place
+// through loans, straight from the writer's memory over data sharing.
+void DdsReceiver::onTrackFrame(dds::DataReader *reader)
+{
+    QVector<TrackData> &tracks = scratch_->frameTracks;
+    const size_t n = cuas::takeLoaned<CounterUAS::TrackTableFrame>(reader,
+        [&tracks](const CounterUAS::TrackTableFrame &frame, const dds::SampleInfo &) {
+            const uint32_t count = std::min(frame.numTracks(), CounterUAS::FRAME_MAX_TRACKS);
+            tracks.resize(static_cast<int>(count));
+            for (uint32_t i = 0; i < count; ++i)
+                toTrackData(frame.tracks()[i], tracks[static_cast<int>(i)]);
+        });
+    if (n > 0) publishTracks(tracks);
+}
+
+// Delta mode: one keyed instance per track, disposed when the tracker drops
+// it.  The full live set is published, as a TrackTable would carry it.
+void DdsReceiver::onTrackUpdate(dds::DataReader *reader)
+{
+    CounterUAS::TrackUpdateMessage &msg = scratch_->updateMsg;
+    auto &live = scratch_->liveTracks;
+    dds::SampleInfo info;
+    bool changed = false;
+    while (reader->take_next_sample(&msg, &info) == ReturnCode_t::RETCODE_OK) {
+        if (info.valid_data) {
+            toTrackData(msg, live[msg.trackId()]);
+            changed = true;
+        } else if (info.instance_state == dds::NOT_ALIVE_DISPOSED_INSTANCE_STATE &&
+                   reader->get_key_value(&msg, info.instance_handle) == ReturnCode_t::RETCODE_OK) {
+            changed = live.erase(msg.trackId()) > 0 || changed;
+        }
+    }
+    if (!changed) return;
+
+    QVector<TrackData> &tracks = scratch_->updateTracks;
+    tracks.resize(static_cast<int>(live.size()));
+    int i = 0;
+    for (const auto &kv : live) tracks[i++] = kv.second;
+    publishTracks(tracks);
+}
+
+void DdsReceiver::onClusters(dds::DataReader *reader)
+{
+    CounterUAS::ClusterTableMessage &msg = scratch_->clusterMsg;
+    QVector<ClusterData>      &clusters = scratch_->clusters;
+    dds::SampleInfo info;
+    bool have = false;
+    quint64 ts = 0;
+    quint32 dwellCount = 0;
+    while (reader->take_next_sample(&msg, &info) == ReturnCode_t::RETCODE_OK) {
+        if (!info.valid_data) continue;
+        have       = true;
+        ts         = msg.timestamp();
+        dwellCount = msg.dwellCount();
+
+        const auto &src = msg.clusters();
+        clusters.resize(static_cast<int>(src.size()));
+        for (int i = 0; i < clusters.size(); ++i) {
+            const CounterUAS::ClusterData &s = src[static_cast<size_t>(i)];
+            ClusterData &c = clusters[i];
+            c.clusterId     = s.clusterId();
+            c.numDetections = s.numDetections();
+            c.range         = s.range();
+            c.azimuth       = s.azimuth();
+            c.elevation     = s.elevation();
+            c.strength      = s.strength();
+            c.snr           = s.snr();
+            c.rcs           = s.rcs();
+            c.microDoppler  = s.microDoppler();
+            c.x = s.x(); c.y = s.y(); c.z = s.z();
+        }
+    }
+    if (have) publishClusters(clusters, ts, dwellCount);
+}
+
+void DdsReceiver::onAssoc(dds::DataReader *reader)
+{
+    CounterUAS::AssocTableMessage &msg = scratch_->assocMsg;
+    QVector<AssocEntry>       &entries = scratch_->assoc;
+    dds::SampleInfo info;
+    bool have = false;
+    quint64 ts = 0;
+    while (reader->take_next_sample(&msg, &info) == ReturnCode_t::RETCODE_OK) {
+        if (!info.valid_data) continue;
+        have = true;
+        ts   = msg.timestamp();
+
+        const auto &src = msg.entries();
+        entries.resize(static_cast<int>(src.size()));
+        for (int i = 0; i < entries.size(); ++i) {
+            const CounterUAS::AssocEntry &s = src[static_cast<size_t>(i)];
+            AssocEntry &e = entries[i];
+            e.trackId   = s.trackId();
+            e.clusterId = s.clusterId();
+            e.distance  = s.distance();
+            e.matched   = s.matched() ? 1u : 0u;
+        }
+    }
+    if (have) publishAssoc(entries, ts);
+}
+
+void DdsReceiver::onPredicted(dds::DataReader *reader)
+{
+    CounterUAS::PredictedTableMessage &msg = scratch_->predMsg;
+    QVector<PredictedEntry>       &entries = scratch_->predicted;
+    dds::SampleInfo info;
+    bool have = false;
+    quint64 ts = 0;
+    while (reader->take_next_sample(&msg, &info) == ReturnCode_t::RETCODE_OK) {
+        if (!info.valid_data) continue;
+        have = true;
+        ts   = msg.timestamp();
+
+        const auto &src = msg.entries();
+        entries.resize(static_cast<int>(src.size()));
+        for (int i = 0; i < entries.size(); ++i) {
+            const CounterUAS::PredictedEntry &s = src[static_cast<size_t>(i)];
+            PredictedEntry &e = entries[i];
+            e.trackId     = s.trackId();
+            e.trackStatus = static_cast<uint32_t>(s.trackStatus());
+            e.x = s.x(); e.vx = s.vx(); e.ax = s.ax();
+            e.y = s.y(); e.vy = s.vy(); e.ay = s.ay();
+            e.z = s.z(); e.vz = s.vz(); e.az = s.az();
+            e.range     = s.range();
+            e.azimuth   = s.azimuth();
+            e.elevation = s.elevation();
+            e.covX = s.covX(); e.covY = s.covY(); e.covZ = s.covZ();
+            e.modelProb[0] = s.modelProb0();
+            e.modelProb[1] = s.modelProb1();
+            e.modelProb[2] = s.modelProb2();
+            e.modelProb[3] = s.modelProb3();
+            e.modelProb[4] = s.modelProb4();
+        }
+    }
+    if (have) publishPredicted(entries, ts);
+}
@@ -0,0 +1,53 @@
+#ifndef DDSRECEIVER_H
+#define DDSRECEIVER_H
+
+#include "displayreceiver.h"
+#include <memory>
+#include <vector>
+
+namespace cuas { class CuasDdsParticipant; }
+namespace eprosima { namespace fastdds { namespace dds {
+class DataReader;
+class DataReaderListener;
+} } }
+
+// ---------------------------------------------------------------------------
+// DdsReceiver  – subscribes to the tracker's display topics directly
+//
+// Reads what TrackSender publishes (SPDetectionDisplay, TrackTable,
+// TrackTableFrame, TrackUpdate and the debug tables) as CDR, so the display
+// needs no UDP bridge and no hand-packed layouts.  Readers enable data
+// sharing: with a same-host tracker that also enables it, samples arrive
+// through shared memory, and TrackTableFrame is read in place via loans.
+// The DDS listener threads decode; the GUI sees frames on the render tick.
+// ---------------------------------------------------------------------------
+class DdsReceiver : public DisplayReceiver {
+    Q_OBJECT
+public:
+    explicit DdsReceiver(int domainId, QObject *parent = nullptr);
+    ~DdsReceiver() override;
+
+    bool    start() override;
+    QString endpoint() const override;
+
+private:
+    struct Scratch;     // per-topic samples and decode buffers
+
+    // Listener callbacks, one per reader (Fast DDS serialises each reader's).
+    void onDetections (eprosima::fastdds::dds::DataReader *reader);
+    void onTrackTable (eprosima::fastdds::dds::DataReader *reader);
+    void onTrackFrame (eprosima::fastdds::dds::DataReader *reader);
+    void onTrackUpdate(eprosima::fastdds::dds::DataReader *reader);
+    void onClusters   (eprosima::fastdds::dds::DataReader *reader);
+    void onAssoc      (eprosima::fastdds::dds::DataReader *reader);
+    void onPredicted  (eprosima::fastdds::dds::DataReader *reader);
+
+    int                      domainId_;
+    std::unique_ptr<Scratch> scratch_;
+    std::vector<std::unique_ptr<eprosima::fastdds::dds::DataReaderListener>> listeners_;
+    // Declared last so it is destroyed first: its readers stop calling the
+    // listeners before they go away.
+    std::unique_ptr<cuas::CuasDdsParticipant> participant_;
+};
+
+#endif // DDSRECEIVER_H
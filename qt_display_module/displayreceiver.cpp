@@ -0,0 +1,116 @@
+#include "displayreceiver.h"
+
+#include <QGuiApplication>
+#include <QMutexLocker>
+#include <QScreen>
+#include <algorithm>
+
+// ---------------------------------------------------------------------------
+// Construction
+// ---------------------------------------------------------------------------
+DisplayReceiver::DisplayReceiver(QObject *parent)
+    : QObject(parent)
+{
+    // Qt exposes no vsync signal to a QObject, so tick at the refresh rate
+    // of the screen the display is on; anything faster would never be seen.
+    const QScreen *screen = QGuiApplication::primaryScreen();
+    const qreal    hz     = (screen && screen->refreshRate() > 1.0)
+                                ? screen->refreshRate() : 60.0;
+    tick_.setTimerType(Qt::PreciseTimer);
+    tick_.setInterval(qMax(1, qRound(1000.0 / hz)));
+    connect(&tick_, &QTimer::timeout, this, &DisplayReceiver::onRenderTick);
+}
+
+// ---------------------------------------------------------------------------
+// Hand-offs from the receiving thread
+// ---------------------------------------------------------------------------
+void DisplayReceiver::publishDetections(RawDetectionFrame &frame)
+{
+    QMutexLocker lock(&mutex_);
+    std::swap(pending_.detections, frame);
+    pending_.dirty |= Frames::Detections;
+}
+
+void DisplayReceiver::publishTracks(QVector<TrackData> &tracks)
+{
+    QMutexLocker lock(&mutex_);
+    std::swap(pending_.tracks, tracks);
+    pending_.dirty |= Frames::Tracks;
+}
+
+void DisplayReceiver::publishClusters(QVector<ClusterData> &clusters,
+                                      quint64 timestamp, quint32 dwellCount)
+{
+    QMutexLocker lock(&mutex_);
+    std::swap(pending_.clusters, clusters);
+    pending_.clusterTs    = timestamp;
+    pending_.clusterDwell = dwellCount;
+    pending_.dirty |= Frames::Clusters;
+}
+
+void DisplayReceiver::publishAssoc(QVector<AssocEntry> &entries, quint64 timestamp)
+{
+    QMutexLocker lock(&mutex_);
+    std::swap(pending_.assoc, entries);
+    pending_.assocTs = timestamp;
+    pending_.dirty |= Frames::Assoc;
+}
+
+void DisplayReceiver::publishPredicted(QVector<PredictedEntry> &entries, quint64 timestamp)
+{
+    QMutexLocker lock(&mutex_);
+    std::swap(pending_.predicted, entries);
+    pending_.predictedTs = timestamp;
+    pending_.dirty |= Frames::Predicted;
+}
+
+void DisplayReceiver::mergeTrack(const TrackData &track)
+{
+    QMutexLocker lock(&mutex_);
+    QVector<TrackData> &tracks = pending_.tracks;
+    if (!(pending_.dirty & Frames::Tracks))
+        tracks.clear();
+    auto it = std::find_if(tracks.begin(), tracks.end(),
+                           [&track](const TrackData &t) { return t.trackId == track.trackId; });
+    if (it != tracks.end())
+        *it = track;
+    else
+        tracks.append(track);
+    pending_.dirty |= Frames::Tracks;
+}
+
+// ---------------------------------------------------------------------------
+// Render tick (GUI thread): deliver the newest frame of each type
+// ---------------------------------------------------------------------------
+void DisplayReceiver::onRenderTick()
+{
+    unsigned ready;
+    {
+        QMutexLocker lock(&mutex_);
+        ready = pending_.dirty;
+        if (!ready) return;
+        pending_.dirty = 0;
+        if (ready & Frames::Detections) std::swap(front_.detections, pending_.detections);
+        if (ready & Frames::Tracks)     std::swap(front_.tracks,     pending_.tracks);
+        if (ready & Frames::Clusters) {
+            std::swap(front_.clusters, pending_.clusters);
+            front_.clusterTs    = pending_.clusterTs;
+            front_.clusterDwell = pending_.clusterDwell;
+        }
+        if (ready & Frames::Assoc) {
+            std::swap(front_.assoc, pending_.assoc);
+            front_.assocTs = pending_.assocTs;
+        }
+        if (ready & Frames::Predicted) {
+            std::swap(front_.predicted, pending_.predicted);
+            front_.predictedTs = pending_.predictedTs;
+        }
+    }
+
+    if (ready & Frames::Detections) emit rawDetectionsReceived(front_.detections);
+    if (ready & Frames::Tracks)     emit tracksReceived(front_.tracks);
+    if (ready & Frames::Clusters)
+        emit clustersReceived(front_.clusters, front_.clusterTs, front_.clusterDwell);
+    if (ready & Frames::Assoc)      emit assocReceived(front_.assoc, front_.assocTs);
+    if (ready & Frames::Predicted)  emit predictedReceived(front_.predicted, front_.predictedTs);
+}
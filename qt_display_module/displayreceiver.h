@@ -0,0 +1,173 @@
+#ifndef DISPLAYRECEIVER_H
+#define DISPLAYRECEIVER_H
+
+#include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <QVector>
+#include <cstdint>
+
+// ---------------------------------------------------------------------------
+// Raw detections  (MSG_ID_SP_DETECTION = 0x0001)
+// ---------------------------------------------------------------------------
+struct RawDetection {
+    double range        = 0.0;  // metres
+    double azimuth      = 0.0;  // radians
+    double elevation    = 0.0;  // radians
+    double strength     = 0.0;  // dBm
+    double noise        = 0.0;  // dBm
+    double snr          = 0.0;  // dB
+    double rcs          = 0.0;  // dBsm
+    double microDoppler = 0.0;  // Hz
+};
+
+struct RawDetectionFrame {
+    uint32_t              dwellCount = 0;
+    uint64_t              timestamp  = 0;
+    QVector<RawDetection> detections;
+};
+
+// ---------------------------------------------------------------------------
+// Track data  (MSG_ID_TRACK_TABLE = 0x0003 / MSG_ID_TRACK_UPDATE = 0x0002)
+// ---------------------------------------------------------------------------
+struct TrackData {
+    uint32_t trackId        = 0;
+    uint64_t timestamp      = 0;
+    uint32_t status         = 0;   // 0=Tentative 1=Confirmed 2=Coasting 3=Deleted
+    uint32_t classification = 0;   // 0=Unknown 1=DroneR 2=DroneF 3=Bird 4=Clutter
+    double   range          = 0.0;
+    double   azimuth        = 0.0; // radians
+    double   elevation      = 0.0; // radians
+    double   rangeRate      = 0.0;
+    double   x = 0.0, y = 0.0, z = 0.0;
+    double   vx = 0.0, vy = 0.0, vz = 0.0;
+    double   trackQuality   = 0.0;
+    uint32_t hitCount       = 0;
+    uint32_t missCount      = 0;
+    uint32_t age            = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Cluster data  (MSG_ID_CLUSTER_TABLE = 0x0010)
+// ---------------------------------------------------------------------------
+struct ClusterData {
+    uint32_t clusterId     = 0;
+    uint32_t numDetections = 0;
+    double   range         = 0.0;
+    double   azimuth       = 0.0;  // radians
+    double   elevation     = 0.0;  // radians
+    double   strength      = 0.0;
+    double   snr           = 0.0;
+    double   rcs           = 0.0;
+    double   microDoppler  = 0.0;
+    double   x = 0.0, y = 0.0, z = 0.0;
+};
+
+// ---------------------------------------------------------------------------
+// Association entry  (MSG_ID_ASSOC_TABLE = 0x0011)
+// ---------------------------------------------------------------------------
+struct AssocEntry {
+    uint32_t trackId   = 0;
+    uint32_t clusterId = 0;    // 0xFFFFFFFF = unmatched track
+    double   distance  = -1.0; // Mahalanobis distance; -1 = unmatched
+    uint32_t matched   = 0;
+};
+
+// ---------------------------------------------------------------------------
+// Predicted-state entry  (MSG_ID_PREDICTED_TABLE = 0x0012)
+// ---------------------------------------------------------------------------
+struct PredictedEntry {
+    uint32_t trackId     = 0;
+    uint32_t trackStatus = 0;
+    double x  = 0, vx = 0, ax = 0;
+    double y  = 0, vy = 0, ay = 0;
+    double z  = 0, vz = 0, az = 0;
+    double range = 0, azimuth = 0, elevation = 0;
+    double covX = 0, covY = 0, covZ = 0;
+    double modelProb[5] = {};
+};
+
+// ---------------------------------------------------------------------------
+// DisplayReceiver  – transport-independent base of the display feeds
+//
+// A backend receives and decodes on its own thread and hands each frame to
+// one of the publish*() calls.  Each decoded frame replaces the previous
+// undelivered one of its type; the GUI thread collects whatever is newest
+// once per render tick (the primary screen's refresh period) and emits it,
+// so every signal fires at most once per displayed frame.
+// ---------------------------------------------------------------------------
+class DisplayReceiver : public QObject {
+    Q_OBJECT
+public:
+    explicit DisplayReceiver(QObject *parent = nullptr);
+
+    // Opens the transport and starts the render tick; false on failure.
+    virtual bool    start() = 0;
+    // Human-readable endpoint for the status bar, e.g. "UDP port 50001".
+    virtual QString endpoint() const = 0;
+    // Why the last start() failed.
+    QString errorString() const { return error_; }
+
+signals:
+    void tracksReceived      (const QVector<TrackData>      &tracks);
+    void rawDetectionsReceived(const RawDetectionFrame       &frame);
+    void clustersReceived    (const QVector<ClusterData>    &clusters,
+                              quint64 timestamp, quint32 dwellCount);
+    void assocReceived       (const QVector<AssocEntry>     &entries,
+                              quint64 timestamp);
+    void predictedReceived   (const QVector<PredictedEntry> &entries,
+                              quint64 timestamp);
+
+protected:
+    // Callable from any thread.  Each swaps its argument with the pending
+    // frame of that type, so the caller gets a recycled buffer back to
+    // decode the next frame into.
+    void publishDetections(RawDetectionFrame &frame);
+    void publishTracks    (QVector<TrackData> &tracks);
+    void publishClusters  (QVector<ClusterData> &clusters,
+                           quint64 timestamp, quint32 dwellCount);
+    void publishAssoc     (QVector<AssocEntry> &entries, quint64 timestamp);
+    void publishPredicted (QVector<PredictedEntry> &entries, quint64 timestamp);
+    // Merges one track into the pending track set by trackId, so several
+    // single-track updates within one tick are all shown.
+    void mergeTrack       (const TrackData &track);
+
+    void startRenderTick() { tick_.start(); }
+    void stopRenderTick()  { tick_.stop(); }
+
+    QString error_;
+
+private:
+    // One frame of each message type.  The pending set is guarded by
+    // mutex_; frames move in and out of it by swap, so the vectors' storage
+    // is recycled rather than reallocated per message.
+    struct Frames {
+        enum : unsigned {
+            Detections = 1u << 0,
+            Tracks     = 1u << 1,
+            Clusters   = 1u << 2,
+            Assoc      = 1u << 3,
+            Predicted  = 1u << 4,
+        };
+        unsigned                dirty        = 0;
+        RawDetectionFrame       detections;
+        QVector<TrackData>      tracks;
+        QVector<ClusterData>    clusters;
+        quint64                 clusterTs    = 0;
+        quint32                 clusterDwell = 0;
+        QVector<AssocEntry>     assoc;
+        quint64                 assocTs      = 0;
+        QVector<PredictedEntry> predicted;
+        quint64                 predictedTs  = 0;
+    };
+
+    void onRenderTick();
+
+    QTimer tick_;
+    QMutex mutex_;
+    Frames pending_;        // newest undelivered frame per type (mutex_)
+    Frames front_;          // GUI thread only
+};
+
+#endif // DISPLAYRECEIVER_H
@@ -1,13 +1,21 @@
 #include "mainwindow.h"
 #include "udpreceiver.h"
+#ifdef CUAS_DISPLAY_DDS
+#include "ddsreceiver.h"
+#endif
 #include "ppiwidget.h"
 #include "scopewidget.h"
 #include "timeserieswidget.h"
 #include "logdialog.h"
+#include "tablemodels.h"
 
 #include <QTabWidget>
-#include <QTableWidget>
+#include <QTableView>
 #include <QHeaderView>
+#include <QSortFilterProxyModel>
+#include <QLineEdit>
+#include <QVBoxLayout>
+#include <QComboBox>
 #include <QLabel>
 #include <QSpinBox>
 #include <QPushButton>
@@ -17,34 +25,7 @@
 #include <QFont>
 #include <QDateTime>
 #include <cmath>
-
-static constexpr double RAD2DEG = 180.0 / 3.14159265358979323846;
-
-// ---------------------------------------------------------------------------
-// Status / classification string helpers
-// ---------------------------------------------------------------------------
-static const char *statusStr(uint32_t s)
-{
-    switch (s) {
-    case 0:  return "TENT";
-    case 1:  return "CONF";
-    case 2:  return "COAST";
-    case 3:  return "DEL";
-    default: return "???";
-    }
-}
-
-static const char *classStr(uint32_t c)
-{
-    switch (c) {
-    case 0:  return "Unknown";
-    case 1:  return "Drone-R";
-    case 2:  return "Drone-F";
-    case 3:  return "Bird";
-    case 4:  return "Clutter";
-    default: return "???";
-    }
-}
+#include <algorithm>
 
 // ---------------------------------------------------------------------------
 // Construction
@@ -66,12 +47,21 @@ void MainWindow::buildUi()
     QToolBar *tb = addToolBar(tr("Controls"));
     tb->setMovable(false);
 
+#ifdef CUAS_DISPLAY_DDS
+    transportCombo_ = new QComboBox(this);
+    transportCombo_->addItem(tr("UDP"));
+    transportCombo_->addItem(tr("DDS"));
+    connect(transportCombo_, QOverload<int>::of(&QComboBox::currentIndexChanged),
+            this, &MainWindow::onTransportChanged);
+    tb->addWidget(transportCombo_);
+#endif
+
     portLabel_ = new QLabel(tr("  Port: "), this);
     tb->addWidget(portLabel_);
 
     portSpin_ = new QSpinBox(this);
     portSpin_->setRange(1024, 65535);
-    portSpin_->setValue(50001);
+    portSpin_->setValue(udpPort_);
     tb->addWidget(portSpin_);
 
     startBtn_ = new QPushButton(tr("Start"), this);
@@ -101,76 +91,66 @@ void MainWindow::buildUi()
     tsWidget_ = new TimeSeriesWidget(this);
     tabs_->addTab(tsWidget_, tr("Time Series"));
 
-    buildTrackTable();
-    tabs_->addTab(trackTable_, tr("Tracks"));
+    trackModel_ = new TrackTableModel(this);
+    tabs_->addTab(makeTablePage(trackModel_), tr("Tracks"));
 
-    buildClusterTable();
-    tabs_->addTab(clusterTable_, tr("Clusters"));
+    clusterModel_ = new ClusterTableModel(this);
+    tabs_->addTab(makeTablePage(clusterModel_), tr("Clusters"));
 
-    buildPredictedTable();
-    tabs_->addTab(predictedTable_, tr("Predicted"));
+    predictedModel_ = new PredictedTableModel(this);
+    tabs_->addTab(makeTablePage(predictedModel_), tr("Predicted"));
 
-    buildAssocTable();
-    tabs_->addTab(assocTable_, tr("Association"));
+    assocModel_ = new AssocTableModel(this);
+    tabs_->addTab(makeTablePage(assocModel_), tr("Association"));
 
     // ── Status bar ────────────────────────────────────────────────────────
     statusLabel_ = new QLabel(tr("Idle"), this);
     statusBar()->addPermanentWidget(statusLabel_);
 }
 
-static QTableWidget *makeTable(int cols, const QStringList &hdrs, QWidget *parent)
+// A filter line over a sortable view of `model`.  Sorting (by the raw
+// values, KeyedTableModelBase::SortRole) and filtering (on the shown text,
+// any column) are done by the proxy; the model keeps arrival order.
+QWidget *MainWindow::makeTablePage(QAbstractItemModel *model)
 {
-    auto *t = new QTableWidget(0, cols, parent);
-    t->setHorizontalHeaderLabels(hdrs);
-    t->horizontalHeader()->setStretchLastSection(true);
-    t->setEditTriggers(QTableWidget::NoEditTriggers);
-    t->setSelectionBehavior(QTableWidget::SelectRows);
-    t->setAlternatingRowColors(true);
-    t->verticalHeader()->setVisible(false);
+    auto *page = new QWidget(this);
+
+    auto *proxy = new QSortFilterProxyModel(page);
+    proxy->setSourceModel(model);
+    proxy->setSortRole(KeyedTableModelBase::SortRole);
+    proxy->setFilterKeyColumn(-1);
+    proxy->setFilterCaseSensitivity(Qt::CaseInsensitive);
+
+    auto *filter = new QLineEdit(page);
+    filter->setPlaceholderText(tr("Filter (any column)"));
+    filter->setClearButtonEnabled(true);
+    connect(filter, &QLineEdit::textChanged,
+            proxy,  &QSortFilterProxyModel::setFilterFixedString);
+
+    auto *view = new QTableView(page);
+    view->setModel(proxy);
+    view->setSortingEnabled(true);
+    view->sortByColumn(0, Qt::AscendingOrder);
+    view->horizontalHeader()->setStretchLastSection(true);
+    view->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    view->setSelectionBehavior(QAbstractItemView::SelectRows);
+    view->setAlternatingRowColors(true);
+    view->verticalHeader()->setVisible(false);
     QFont f("Consolas", 9);
     f.setStyleHint(QFont::Monospace);
-    t->setFont(f);
-    return t;
-}
-
-void MainWindow::buildTrackTable()
-{
-    trackTable_ = makeTable(17, {
-        "ID", "Status", "Class",
-        "Range(m)", "Az(°)", "El(°)", "Rdot(m/s)",
-        "X(m)", "Y(m)", "Z(m)",
-        "Vx", "Vy", "Vz",
-        "Quality", "Hits", "Miss", "Age"
-    }, this);
-}
-
-void MainWindow::buildClusterTable()
-{
-    clusterTable_ = makeTable(11, {
-        "ID", "#Dets",
-        "Range(m)", "Az(°)", "El(°)",
-        "Str(dBm)", "SNR(dB)", "RCS",
-        "X(m)", "Y(m)", "Z(m)"
-    }, this);
-}
-
-void MainWindow::buildAssocTable()
-{
-    assocTable_ = makeTable(4, {
-        "Track ID", "Cluster ID", "Distance", "Status"
-    }, this);
-}
-
-void MainWindow::buildPredictedTable()
-{
-    predictedTable_ = makeTable(19, {
-        "Track ID", "Status",
-        "Range(m)", "Az(°)", "El(°)",
-        "X(m)", "Y(m)", "Z(m)",
-        "Vx", "Vy", "Vz",
-        "CovX", "CovY", "CovZ",
-        "CV", "CA1", "CA2", "CTR1", "CTR2"
-    }, this);
+    view->setFont(f);
+
+    // Size the columns when the table first fills, not on every frame.
+    connect(model, &QAbstractItemModel::rowsInserted, view,
+            [view](const QModelIndex &, int first, int) {
+                if (first == 0) view->resizeColumnsToContents();
+            });
+
+    auto *layout = new QVBoxLayout(page);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(filter);
+    layout->addWidget(view);
+    return page;
 }
 
 // ---------------------------------------------------------------------------
@@ -185,18 +165,24 @@ void MainWindow::onStartStop()
         msgCount_ = 0;
         startBtn_->setText(tr("Start"));
         portSpin_->setEnabled(true);
+        if (transportCombo_) transportCombo_->setEnabled(true);
         statusLabel_->setText(tr("Stopped"));
         logLine(tr("Receiver stopped."));
         return;
     }
 
-    quint16 port = static_cast<quint16>(portSpin_->value());
-    receiver_ = new UdpReceiver(port, this);
+#ifdef CUAS_DISPLAY_DDS
+    if (transportCombo_->currentIndex() == TRANSPORT_DDS)
+        receiver_ = new DdsReceiver(portSpin_->value(), this);
+    else
+#endif
+        receiver_ = new UdpReceiver(static_cast<quint16>(portSpin_->value()), this);
     connectReceiver();
 
-    if (!receiver_->bind()) {
+    if (!receiver_->start()) {
         QMessageBox::warning(this, tr("Error"),
-                             tr("Cannot bind to UDP port %1").arg(port));
+                             tr("Cannot open %1: %2")
+                             .arg(receiver_->endpoint(), receiver_->errorString()));
         disconnectReceiver();
         delete receiver_;
         receiver_ = nullptr;
@@ -205,8 +191,26 @@ void MainWindow::onStartStop()
 
     startBtn_->setText(tr("Stop"));
     portSpin_->setEnabled(false);
-    statusLabel_->setText(tr("Listening on port %1 …").arg(port));
-    logLine(tr("Receiver started on port %1.").arg(port));
+    if (transportCombo_) transportCombo_->setEnabled(false);
+    statusLabel_->setText(tr("Listening on %1 …").arg(receiver_->endpoint()));
+    logLine(tr("Receiver started on %1.").arg(receiver_->endpoint()));
+}
+
+// The spin box holds the UDP port or the DDS domain; each keeps its value
+// across switches.
+void MainWindow::onTransportChanged(int index)
+{
+    if (index == TRANSPORT_DDS) {
+        udpPort_ = portSpin_->value();
+        portLabel_->setText(tr("  Domain: "));
+        portSpin_->setRange(0, 232);
+        portSpin_->setValue(ddsDomain_);
+    } else {
+        ddsDomain_ = portSpin_->value();
+        portLabel_->setText(tr("  Port: "));
+        portSpin_->setRange(1024, 65535);
+        portSpin_->setValue(udpPort_);
+    }
 }
 
 void MainWindow::onShowLog()
@@ -223,15 +227,15 @@ void MainWindow::onShowLog()
 // ---------------------------------------------------------------------------
 void MainWindow::connectReceiver()
 {
-    connect(receiver_, &UdpReceiver::tracksReceived,
+    connect(receiver_, &DisplayReceiver::tracksReceived,
             this,      &MainWindow::onTracksReceived);
-    connect(receiver_, &UdpReceiver::rawDetectionsReceived,
+    connect(receiver_, &DisplayReceiver::rawDetectionsReceived,
             this,      &MainWindow::onRawDetections);
-    connect(receiver_, &UdpReceiver::clustersReceived,
+    connect(receiver_, &DisplayReceiver::clustersReceived,
             this,      &MainWindow::onClustersReceived);
-    connect(receiver_, &UdpReceiver::assocReceived,
+    connect(receiver_, &DisplayReceiver::assocReceived,
             this,      &MainWindow::onAssocReceived);
-    connect(receiver_, &UdpReceiver::predictedReceived,
+    connect(receiver_, &DisplayReceiver::predictedReceived,
             this,      &MainWindow::onPredictedReceived);
 }
 
@@ -240,22 +244,6 @@ void MainWindow::disconnectReceiver()
     if (receiver_) disconnect(receiver_, nullptr, this, nullptr);
 }
 
-// ---------------------------------------------------------------------------
-// Slot helpers: fill one row in a QTableWidget
-// ---------------------------------------------------------------------------
-static void setCell(QTableWidget *tbl, int row, int &col, const QString &v,
-                    Qt::Alignment align = Qt::AlignRight | Qt::AlignVCenter)
-{
-    auto *it = tbl->item(row, col);
-    if (!it) {
-        it = new QTableWidgetItem;
-        it->setTextAlignment(align);
-        tbl->setItem(row, col, it);
-    }
-    it->setText(v);
-    ++col;
-}
-
 // ---------------------------------------------------------------------------
 // Data handlers
 // ---------------------------------------------------------------------------
@@ -268,29 +256,7 @@ void MainWindow::onTracksReceived(const QVector<TrackData> &tracks)
     cScope_->setTracks(tracks);
     tsWidget_->updateTracks(tracks);
 
-    trackTable_->setRowCount(tracks.size());
-    for (int r = 0; r < tracks.size(); ++r) {
-        const TrackData &t = tracks[r];
-        int c = 0;
-        setCell(trackTable_, r, c, QString::number(t.trackId));
-        setCell(trackTable_, r, c, statusStr(t.status));
-        setCell(trackTable_, r, c, classStr(t.classification));
-        setCell(trackTable_, r, c, QString::number(t.range,              'f', 1));
-        setCell(trackTable_, r, c, QString::number(t.azimuth * RAD2DEG,  'f', 2));
-        setCell(trackTable_, r, c, QString::number(t.elevation * RAD2DEG,'f', 2));
-        setCell(trackTable_, r, c, QString::number(t.rangeRate,           'f', 1));
-        setCell(trackTable_, r, c, QString::number(t.x,                  'f', 1));
-        setCell(trackTable_, r, c, QString::number(t.y,                  'f', 1));
-        setCell(trackTable_, r, c, QString::number(t.z,                  'f', 1));
-        setCell(trackTable_, r, c, QString::number(t.vx,                 'f', 1));
-        setCell(trackTable_, r, c, QString::number(t.vy,                 'f', 1));
-        setCell(trackTable_, r, c, QString::number(t.vz,                 'f', 1));
-        setCell(trackTable_, r, c, QString::number(t.trackQuality,       'f', 2));
-        setCell(trackTable_, r, c, QString::number(t.hitCount));
-        setCell(trackTable_, r, c, QString::number(t.missCount));
-        setCell(trackTable_, r, c, QString::number(t.age));
-    }
-    trackTable_->resizeColumnsToContents();
+    trackModel_->update(tracks);
 
     updateStatusBar(tracks);
 }
@@ -305,70 +271,19 @@ void MainWindow::onRawDetections(const RawDetectionFrame &frame)
 void MainWindow::onClustersReceived(const QVector<ClusterData> &clusters,
                                     quint64 /*ts*/, quint32 /*dwellCount*/)
 {
-    clusterTable_->setRowCount(clusters.size());
-    for (int r = 0; r < clusters.size(); ++r) {
-        const ClusterData &cl = clusters[r];
-        int c = 0;
-        setCell(clusterTable_, r, c, QString::number(cl.clusterId));
-        setCell(clusterTable_, r, c, QString::number(cl.numDetections));
-        setCell(clusterTable_, r, c, QString::number(cl.range,              'f', 1));
-        setCell(clusterTable_, r, c, QString::number(cl.azimuth * RAD2DEG,  'f', 2));
-        setCell(clusterTable_, r, c, QString::number(cl.elevation * RAD2DEG,'f', 2));
-        setCell(clusterTable_, r, c, QString::number(cl.strength,           'f', 1));
-        setCell(clusterTable_, r, c, QString::number(cl.snr,               'f', 1));
-        setCell(clusterTable_, r, c, QString::number(cl.rcs,               'f', 2));
-        setCell(clusterTable_, r, c, QString::number(cl.x,                 'f', 1));
-        setCell(clusterTable_, r, c, QString::number(cl.y,                 'f', 1));
-        setCell(clusterTable_, r, c, QString::number(cl.z,                 'f', 1));
-    }
-    clusterTable_->resizeColumnsToContents();
+    clusterModel_->update(clusters);
 }
 
 void MainWindow::onAssocReceived(const QVector<AssocEntry> &entries,
                                  quint64 /*ts*/)
 {
-    assocTable_->setRowCount(entries.size());
-    for (int r = 0; r < entries.size(); ++r) {
-        const AssocEntry &e = entries[r];
-        int c = 0;
-        setCell(assocTable_, r, c,
-                e.trackId   == 0xFFFFFFFFu ? QString("—") : QString::number(e.trackId));
-        setCell(assocTable_, r, c,
-                e.clusterId == 0xFFFFFFFFu ? QString("—") : QString::number(e.clusterId));
-        setCell(assocTable_, r, c,
-                e.distance < 0 ? QString("—") : QString::number(e.distance, 'f', 3));
-        setCell(assocTable_, r, c,
-                e.matched ? tr("Matched") : tr("Unmatched"),
-                Qt::AlignLeft | Qt::AlignVCenter);
-    }
-    assocTable_->resizeColumnsToContents();
+    assocModel_->update(entries);
 }
 
 void MainWindow::onPredictedReceived(const QVector<PredictedEntry> &entries,
                                      quint64 /*ts*/)
 {
-    predictedTable_->setRowCount(entries.size());
-    for (int r = 0; r < entries.size(); ++r) {
-        const PredictedEntry &e = entries[r];
-        int c = 0;
-        setCell(predictedTable_, r, c, QString::number(e.trackId));
-        setCell(predictedTable_, r, c, statusStr(e.trackStatus));
-        setCell(predictedTable_, r, c, QString::number(e.range,              'f', 1));
-        setCell(predictedTable_, r, c, QString::number(e.azimuth * RAD2DEG,  'f', 2));
-        setCell(predictedTable_, r, c, QString::number(e.elevation * RAD2DEG,'f', 2));
-        setCell(predictedTable_, r, c, QString::number(e.x,   'f', 1));
-        setCell(predictedTable_, r, c, QString::number(e.y,   'f', 1));
-        setCell(predictedTable_, r, c, QString::number(e.z,   'f', 1));
-        setCell(predictedTable_, r, c, QString::number(e.vx,  'f', 2));
-        setCell(predictedTable_, r, c, QString::number(e.vy,  'f', 2));
-        setCell(predictedTable_, r, c, QString::number(e.vz,  'f', 2));
-        setCell(predictedTable_, r, c, QString::number(e.covX,'f', 1));
-        setCell(predictedTable_, r, c, QString::number(e.covY,'f', 1));
-        setCell(predictedTable_, r, c, QString::number(e.covZ,'f', 1));
-        for (int m = 0; m < 5; ++m)
-            setCell(predictedTable_, r, c, QString::number(e.modelProb[m], 'f', 3));
-    }
-    predictedTable_->resizeColumnsToContents();
+    predictedModel_->update(entries);
 }
 
 // ---------------------------------------------------------------------------
@@ -377,16 +292,38 @@ void MainWindow::onPredictedReceived(const QVector<PredictedEntry> &entries,
 void MainWindow::updateStatusBar(const QVector<TrackData> &tracks)
 {
     int conf = 0, tent = 0, coast = 0;
+    quint64 newest = 0;
     for (const auto &t : tracks) {
         if      (t.status == 1) ++conf;
         else if (t.status == 0) ++tent;
         else if (t.status == 2) ++coast;
+        newest = std::max<quint64>(newest, t.timestamp);
+    }
+
+    // Timestamps are microseconds since epoch on the sensor clock.
+    const quint64 nowUs = static_cast<quint64>(QDateTime::currentMSecsSinceEpoch()) * 1000;
+    if (newest > 0 && nowUs >= newest) {
+        const double age = (nowUs - newest) / 1000.0;
+        if (ageMs_.size() < AGE_WINDOW) ageMs_.append(age);
+        else                            ageMs_[ageNext_] = age;
+        ageNext_ = (ageNext_ + 1) % AGE_WINDOW;
     }
+    QString ageText = tr("Age: n/a");
+    if (!ageMs_.isEmpty()) {
+        QVector<double> sorted = ageMs_;
+        std::sort(sorted.begin(), sorted.end());
+        auto pct = [&sorted](double q) {
+            return sorted[std::min<int>(sorted.size() - 1, static_cast<int>(q * sorted.size()))];
+        };
+        ageText = tr("Age ms: p50 %1  p99 %2").arg(pct(0.50), 0, 'f', 1).arg(pct(0.99), 0, 'f', 1);
+    }
+
     statusLabel_->setText(
-        tr("Msgs: %1 | Tracks: %2  (Conf %3  Tent %4  Coast %5)")
+        tr("Msgs: %1 | Tracks: %2  (Conf %3  Tent %4  Coast %5) | %6")
             .arg(msgCount_)
             .arg(tracks.size())
-            .arg(conf).arg(tent).arg(coast));
+            .arg(conf).arg(tent).arg(coast)
+            .arg(ageText));
 }
 
 // ---------------------------------------------------------------------------
@@ -1,19 +1,24 @@
 #ifndef MAINWINDOW_H
 #define MAINWINDOW_H
 
-#include "udpreceiver.h"
+#include "displayreceiver.h"
 #include <QMainWindow>
 #include <QVector>
 
+class QComboBox;
 class QTabWidget;
-class QTableWidget;
+class QAbstractItemModel;
 class QLabel;
 class QSpinBox;
 class QPushButton;
-class UdpReceiver;
+class DisplayReceiver;
 class PPIWidget;
 class ScopeWidget;
 class TimeSeriesWidget;
+class TrackTableModel;
+class ClusterTableModel;
+class AssocTableModel;
+class PredictedTableModel;
 class LogDialog;
 
 class MainWindow : public QMainWindow {
@@ -22,7 +27,7 @@ public:
     explicit MainWindow(QWidget *parent = nullptr);
 
 private slots:
-    // UdpReceiver signals
+    // DisplayReceiver signals
     void onTracksReceived      (const QVector<TrackData>      &tracks);
     void onRawDetections       (const RawDetectionFrame       &frame);
     void onClustersReceived    (const QVector<ClusterData>    &clusters,
@@ -34,14 +39,12 @@ private slots:
 
     // Toolbar
     void onStartStop();
+    void onTransportChanged(int index);
     void onShowLog();
 
 private:
     void buildUi();
-    void buildTrackTable();
-    void buildClusterTable();
-    void buildAssocTable();
-    void buildPredictedTable();
+    QWidget *makeTablePage(QAbstractItemModel *model);
     void connectReceiver();
     void disconnectReceiver();
     void updateStatusBar(const QVector<TrackData> &tracks);
@@ -53,12 +56,15 @@ private:
     ScopeWidget     *bScope_          = nullptr;
     ScopeWidget     *cScope_          = nullptr;
     TimeSeriesWidget*tsWidget_        = nullptr;
-    QTableWidget    *trackTable_      = nullptr;
-    QTableWidget    *clusterTable_    = nullptr;
-    QTableWidget    *assocTable_      = nullptr;
-    QTableWidget    *predictedTable_  = nullptr;
+
+    // Table tabs: keyed models behind sort/filter proxies
+    TrackTableModel     *trackModel_     = nullptr;
+    ClusterTableModel   *clusterModel_   = nullptr;
+    AssocTableModel     *assocModel_     = nullptr;
+    PredictedTableModel *predictedModel_ = nullptr;
 
     // Toolbar controls
+    QComboBox       *transportCombo_  = nullptr;   // DDS builds only
     QLabel          *portLabel_       = nullptr;
     QSpinBox        *portSpin_        = nullptr;
     QPushButton     *startBtn_        = nullptr;
@@ -68,8 +74,18 @@ private:
     LogDialog       *logDialog_       = nullptr;
 
     // Networking
-    UdpReceiver     *receiver_        = nullptr;
+    static constexpr int TRANSPORT_DDS = 1;        // transportCombo_ index
+    DisplayReceiver *receiver_        = nullptr;
+    int              udpPort_         = 50001;
+    int              ddsDomain_       = 0;
     quint64          msgCount_        = 0;
+
+    // Track age (wall clock now minus the newest track timestamp), in ms,
+    // over the last AGE_WINDOW track messages.  The UDP track layout has no
+    // LatencyTrace, so this is the only latency figure available here.
+    static constexpr int AGE_WINDOW   = 256;
+    QVector<double>  ageMs_;
+    int              ageNext_         = 0;
 };
 
 #endif // MAINWINDOW_H
@@ -2,6 +2,8 @@
 
 #include <QPainter>
 #include <QPen>
+#include <QFontMetricsF>
+#include <QLineF>
 #include <QWheelEvent>
 #include <QMouseEvent>
 #include <cmath>
@@ -9,20 +11,38 @@
 static constexpr double PI = 3.14159265358979323846;
 static constexpr double RAD2DEG = 180.0 / PI;
 
+// Track sprite edge (logical pixels): the largest symbol plus its pen.
+static constexpr int SPRITE_SIZE = 18;
+
+// Symbol colour / sprite index by track status; Deleted draws as Tentative.
+static uint32_t spriteIndex(uint32_t status) { return status <= 2 ? status : 0; }
+
+static QColor statusColor(uint32_t status)
+{
+    return status == 1 ? QColor(255, 80, 80)
+         : status == 2 ? QColor(255, 180, 0)
+                       : QColor(100, 160, 255);
+}
+
 PPIWidget::PPIWidget(QWidget *parent)
     : QWidget(parent)
 {
     setMinimumSize(300, 300);
-    setBackgroundRole(QPalette::Base);
-    setAutoFillBackground(true);
+    // Every repaint starts by blitting the opaque background pixmap.
+    setAttribute(Qt::WA_OpaquePaintEvent);
 }
 
 void PPIWidget::setDetections(const RawDetectionFrame &frame)
 {
-    dets_ = frame;
-    // Adjust maxRange from data
-    for (const auto &d : frame.detections)
-        if (d.range > maxRange_) maxRange_ = std::ceil(d.range / 1000.0) * 1000.0;
+    // Horizontal Cartesian (top-down view, ignore elevation for plot), once
+    // per frame rather than on every repaint.
+    const int n = static_cast<int>(frame.detections.size());
+    detWorld_.resize(n);
+    for (int i = 0; i < n; ++i) {
+        const auto &d = frame.detections[i];
+        detWorld_[i] = QPointF(d.range * std::cos(d.azimuth), d.range * std::sin(d.azimuth));
+        growRange(d.range);
+    }
     update();
 }
 
@@ -30,10 +50,20 @@ void PPIWidget::setTracks(const QVector<TrackData> &tracks)
 {
     tracks_ = tracks;
     for (const auto &t : tracks)
-        if (t.range > maxRange_) maxRange_ = std::ceil(t.range / 1000.0) * 1000.0;
+        growRange(t.range);
+    // Labels of long-gone tracks are dropped now and then.
+    if (labels_.size() > 2 * tracks.size() + 256) labels_.clear();
     update();
 }
 
+// Adjust maxRange from data
+void PPIWidget::growRange(double range)
+{
+    if (range <= maxRange_) return;
+    maxRange_ = std::ceil(range / 1000.0) * 1000.0;
+    backgroundValid_ = false;
+}
+
 // World (metres) → screen pixels.
 // Radar at widget centre; X→East (right), Y→North (up, so flipped on screen).
 QPointF PPIWidget::toScreen(double x, double y) const
@@ -44,9 +74,14 @@ QPointF PPIWidget::toScreen(double x, double y) const
     return QPointF(cx + x * ppm, cy - y * ppm);
 }
 
-void PPIWidget::paintEvent(QPaintEvent *)
+void PPIWidget::renderBackground()
 {
-    QPainter p(this);
+    const qreal dpr = devicePixelRatioF();
+    background_ = QPixmap(size() * dpr);
+    background_.setDevicePixelRatio(dpr);
+    backgroundValid_ = true;
+
+    QPainter p(&background_);
     p.setRenderHint(QPainter::Antialiasing);
 
     // Background
@@ -90,57 +125,108 @@ void PPIWidget::paintEvent(QPaintEvent *)
     p.setFont(QFont("Arial", 9, QFont::Bold));
     p.drawText(QPointF(cx - 4, cy - R - 8), "N");
 
-    // Raw detections — small green dots
-    p.setPen(Qt::NoPen);
-    p.setBrush(QColor(0, 220, 80, 180));
-    for (const auto &d : dets_.detections) {
-        // Use horizontal Cartesian (top-down view, ignore elevation for plot)
-        double wx = d.range * std::cos(d.azimuth);
-        double wy = d.range * std::sin(d.azimuth);
-        QPointF sp = toScreen(wx, wy);
-        p.drawEllipse(sp, 3.0, 3.0);
+    // Legend
+    p.setFont(QFont("Arial", 8));
+    int ly = height() - 60;
+    p.setPen(QColor(0, 220, 80));  p.drawText(10, ly,      "● Raw Det");
+    p.setPen(QColor(255, 80, 80)); p.drawText(10, ly + 14, "▲ Confirmed");
+    p.setPen(QColor(100, 160, 255)); p.drawText(10, ly + 28, "+ Tentative");
+    p.setPen(QColor(255, 180, 0)); p.drawText(10, ly + 42, "+ Coasting");
+}
+
+const QPixmap &PPIWidget::trackSprite(uint32_t status)
+{
+    const qreal dpr = devicePixelRatioF();
+    if (dpr != spriteDpr_) {
+        for (uint32_t k = 0; k < 3; ++k) {
+            QPixmap pm(QSize(SPRITE_SIZE, SPRITE_SIZE) * dpr);
+            pm.setDevicePixelRatio(dpr);
+            pm.fill(Qt::transparent);
+
+            {
+                QPainter p(&pm);
+                p.setRenderHint(QPainter::Antialiasing);
+                p.setPen(QPen(statusColor(k), 2));
+                p.setBrush(Qt::NoBrush);
+                const QPointF sp(SPRITE_SIZE / 2.0, SPRITE_SIZE / 2.0);
+                if (k == 1) {
+                    // Triangle
+                    const double sz = 7.0;
+                    QPolygonF tri;
+                    tri << QPointF(sp.x(), sp.y() - sz)
+                        << QPointF(sp.x() + sz * 0.866, sp.y() + sz * 0.5)
+                        << QPointF(sp.x() - sz * 0.866, sp.y() + sz * 0.5);
+                    p.drawPolygon(tri);
+                } else {
+                    const double sz = 5.0;
+                    p.drawLine(QPointF(sp.x() - sz, sp.y()), QPointF(sp.x() + sz, sp.y()));
+                    p.drawLine(QPointF(sp.x(), sp.y() - sz), QPointF(sp.x(), sp.y() + sz));
+                }
+            }
+            sprites_[k] = pm;
+        }
+        spriteDpr_ = dpr;
     }
+    return sprites_[spriteIndex(status)];
+}
 
-    // Tracks
-    QFont idFont("Arial", 7);
-    p.setFont(idFont);
+const QStaticText &PPIWidget::trackLabel(uint32_t trackId)
+{
+    auto it = labels_.find(trackId);
+    if (it == labels_.end()) {
+        QStaticText text(QString("#%1").arg(trackId));
+        text.setPerformanceHint(QStaticText::AggressiveCaching);
+        it = labels_.insert(trackId, text);
+    }
+    return *it;
+}
+
+void PPIWidget::paintEvent(QPaintEvent *)
+{
+    if (!backgroundValid_) renderBackground();
+
+    QPainter p(this);
+    p.drawPixmap(0, 0, background_);
+    p.setRenderHint(QPainter::Antialiasing);
+
+    double cx = width()  / 2.0 + panOffset_.x();
+    double cy = height() / 2.0 + panOffset_.y();
+    double ppm = (std::min(width(), height()) / 2.0) * scale_ / maxRange_;
+
+    // Raw detections — small green dots, in one call: a 6 px round-capped
+    // point is the 3 px radius dot.
+    const int n = static_cast<int>(detWorld_.size());
+    detScreen_.resize(n);
+    for (int i = 0; i < n; ++i)
+        detScreen_[i] = QPointF(cx + detWorld_[i].x() * ppm, cy - detWorld_[i].y() * ppm);
+    p.setPen(QPen(QColor(0, 220, 80, 180), 6.0, Qt::SolidLine, Qt::RoundCap));
+    p.drawPoints(detScreen_);
+
+    // Tracks: a sprite each, then the velocity vectors (3 s look-ahead) of
+    // confirmed tracks and the ID labels, one pen per batch.
+    QVector<QLineF> vectors;
     for (const auto &t : tracks_) {
         QPointF sp = toScreen(t.x, t.y);
-        bool confirmed = (t.status == 1);
-        bool coasting  = (t.status == 2);
-
-        QColor col = confirmed ? QColor(255, 80, 80)
-                   : coasting  ? QColor(255, 180, 0)
-                               : QColor(100, 160, 255);
-
-        // Draw a cross/diamond symbol
-        p.setPen(QPen(col, 2));
-        p.setBrush(Qt::NoBrush);
-        double sz = confirmed ? 7.0 : 5.0;
-        if (confirmed) {
-            // Triangle
-            QPolygonF tri;
-            tri << QPointF(sp.x(), sp.y() - sz)
-                << QPointF(sp.x() + sz * 0.866, sp.y() + sz * 0.5)
-                << QPointF(sp.x() - sz * 0.866, sp.y() + sz * 0.5);
-            p.drawPolygon(tri);
-        } else {
-            p.drawLine(QPointF(sp.x() - sz, sp.y()), QPointF(sp.x() + sz, sp.y()));
-            p.drawLine(QPointF(sp.x(), sp.y() - sz), QPointF(sp.x(), sp.y() + sz));
-        }
-
-        // Velocity vector (3 s look-ahead)
-        if (confirmed) {
+        p.drawPixmap(sp - QPointF(SPRITE_SIZE / 2.0, SPRITE_SIZE / 2.0), trackSprite(t.status));
+        if (t.status == 1) {
             double vscale = 3.0;
-            QPointF vEnd = toScreen(t.x + t.vx * vscale, t.y + t.vy * vscale);
-            p.setPen(QPen(col, 1, Qt::DashLine));
-            p.drawLine(sp, vEnd);
+            vectors.append(QLineF(sp, toScreen(t.x + t.vx * vscale, t.y + t.vy * vscale)));
         }
+    }
+    p.setPen(QPen(statusColor(1), 1, Qt::DashLine));
+    p.drawLines(vectors);
 
-        // ID label
-        p.setPen(col);
-        p.drawText(QPointF(sp.x() + sz + 2, sp.y() + 4),
-                   QString("#%1").arg(t.trackId));
+    QFont idFont("Arial", 7);
+    p.setFont(idFont);
+    const double ascent = QFontMetricsF(idFont).ascent();   // drawStaticText takes the top left
+    for (uint32_t k = 0; k < 3; ++k) {
+        p.setPen(statusColor(k));
+        for (const auto &t : tracks_) {
+            if (spriteIndex(t.status) != k) continue;
+            QPointF sp = toScreen(t.x, t.y);
+            double sz = (t.status == 1) ? 7.0 : 5.0;
+            p.drawStaticText(QPointF(sp.x() + sz + 2, sp.y() + 4 - ascent), trackLabel(t.trackId));
+        }
     }
 
     // Radar center dot
@@ -150,21 +236,13 @@ void PPIWidget::paintEvent(QPaintEvent *)
     p.setPen(QColor(255, 255, 100));
     p.drawText(QPointF(cx + 6, cy + 4), "RAD");
 
-    // Legend
-    p.setFont(QFont("Arial", 8));
-    int ly = height() - 60;
-    p.setPen(QColor(0, 220, 80));  p.drawText(10, ly,      "● Raw Det");
-    p.setPen(QColor(255, 80, 80)); p.drawText(10, ly + 14, "▲ Confirmed");
-    p.setPen(QColor(100, 160, 255)); p.drawText(10, ly + 28, "+ Tentative");
-    p.setPen(QColor(255, 180, 0)); p.drawText(10, ly + 42, "+ Coasting");
-
     // Stats overlay
     p.setPen(QColor(180, 255, 180));
     p.setFont(QFont("Consolas", 8));
     p.drawText(10, 20, QString("Max range: %1 km  |  Zoom: %2x  |  Dets: %3  |  Tracks: %4")
                .arg(maxRange_ / 1000.0, 0, 'f', 1)
                .arg(scale_, 0, 'f', 2)
-               .arg(dets_.detections.size())
+               .arg(detWorld_.size())
                .arg(tracks_.size()));
 }
 
@@ -172,6 +250,7 @@ void PPIWidget::wheelEvent(QWheelEvent *event)
 {
     double factor = (event->angleDelta().y() > 0) ? 1.15 : (1.0 / 1.15);
     scale_ = qBound(0.1, scale_ * factor, 20.0);
+    backgroundValid_ = false;
     update();
 }
 
@@ -189,6 +268,7 @@ void PPIWidget::mouseMoveEvent(QMouseEvent *event)
         QPointF delta = event->pos() - lastMouse_;
         panOffset_ += delta;
         lastMouse_ = event->pos();
+        backgroundValid_ = false;
         update();
     }
 }
@@ -201,5 +281,6 @@ void PPIWidget::mouseReleaseEvent(QMouseEvent *event)
 
 void PPIWidget::resizeEvent(QResizeEvent *)
 {
+    backgroundValid_ = false;
     update();
 }
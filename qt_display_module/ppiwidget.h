@@ -1,10 +1,14 @@
 #ifndef PPIWIDGET_H
 #define PPIWIDGET_H
 
-#include "udpreceiver.h"
+#include "displayreceiver.h"
 #include <QWidget>
 #include <QVector>
 #include <QPointF>
+#include <QPolygonF>
+#include <QPixmap>
+#include <QHash>
+#include <QStaticText>
 
 class PPIWidget : public QWidget
 {
@@ -26,10 +30,26 @@ protected:
 
 private:
     QPointF toScreen(double x, double y) const;
-
-    RawDetectionFrame dets_;
+    void    growRange(double range);
+
+    // Rings, spokes, labels and legend only change with the view, so they
+    // are drawn once into background_ and blitted on every repaint until
+    // resize, zoom, pan or a range change invalidates them.
+    void renderBackground();
+    // Track symbols, pre-rendered per status at the screen's pixel ratio.
+    const QPixmap &trackSprite(uint32_t status);
+    const QStaticText &trackLabel(uint32_t trackId);
+
+    QVector<QPointF>   detWorld_;    // detections, horizontal metres (x East, y North)
+    QPolygonF          detScreen_;   // paintEvent scratch
     QVector<TrackData> tracks_;
 
+    QPixmap background_;
+    bool    backgroundValid_ = false;
+    QPixmap sprites_[3];             // tentative, confirmed, coasting
+    qreal   spriteDpr_ = 0.0;
+    QHash<uint32_t, QStaticText> labels_;
+
     double maxRange_  = 5000.0;  // metres
     double scale_     = 1.0;     // zoom multiplier
     QPointF panOffset_;          // pixels
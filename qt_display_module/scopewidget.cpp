@@ -2,25 +2,38 @@
 
 #include <QPainter>
 #include <QPen>
+#include <QFontMetricsF>
 #include <cmath>
 
 static constexpr double PI = 3.14159265358979323846;
 static constexpr double RAD2DEG = 180.0 / PI;
 
+// Track sprite edge (logical pixels): the largest cross plus its pen.
+static constexpr int SPRITE_SIZE = 18;
+
+static QColor trackColor(bool confirmed)
+{
+    return confirmed ? QColor(255, 80, 80) : QColor(100, 160, 255);
+}
+
 ScopeWidget::ScopeWidget(Mode mode, QWidget *parent)
     : QWidget(parent), mode_(mode)
 {
     setMinimumSize(300, 200);
-    setBackgroundRole(QPalette::Base);
-    setAutoFillBackground(true);
+    // Every repaint starts by blitting the opaque background pixmap.
+    setAttribute(Qt::WA_OpaquePaintEvent);
 }
 
 void ScopeWidget::setDetections(const RawDetectionFrame &frame)
 {
-    dets_ = frame;
-    if (mode_ == BScope) {
-        for (const auto &d : frame.detections)
-            if (d.range > maxRange_) maxRange_ = std::ceil(d.range / 1000.0) * 1000.0;
+    // Plot coordinates once per frame rather than on every repaint.
+    const int n = static_cast<int>(frame.detections.size());
+    detData_.resize(n);
+    for (int i = 0; i < n; ++i) {
+        const auto &d = frame.detections[i];
+        double vv = (mode_ == BScope) ? d.range : d.elevation * RAD2DEG;
+        detData_[i] = QPointF(d.azimuth * RAD2DEG, vv);
+        growRange(d.range);
     }
     update();
 }
@@ -28,13 +41,26 @@ void ScopeWidget::setDetections(const RawDetectionFrame &frame)
 void ScopeWidget::setTracks(const QVector<TrackData> &tracks)
 {
     tracks_ = tracks;
-    if (mode_ == BScope) {
-        for (const auto &t : tracks)
-            if (t.range > maxRange_) maxRange_ = std::ceil(t.range / 1000.0) * 1000.0;
-    }
+    for (const auto &t : tracks)
+        growRange(t.range);
+    // Labels of long-gone tracks are dropped now and then.
+    if (labels_.size() > 2 * tracks.size() + 256) labels_.clear();
     update();
 }
 
+void ScopeWidget::growRange(double range)
+{
+    if (mode_ != BScope || range <= maxRange_) return;
+    maxRange_ = std::ceil(range / 1000.0) * 1000.0;
+    backgroundValid_ = false;
+}
+
+// Plot area with margins
+QRectF ScopeWidget::plotRect() const
+{
+    return QRectF(48, 10, width() - 58, height() - 34);
+}
+
 // Map data coords to plot rect pixels.
 // B-scope: hVal=azimuth(deg), vVal=range(m)   → top=maxRange, bottom=0
 // C-scope: hVal=azimuth(deg), vVal=elev(deg)  → top=90°, bottom=-10°
@@ -125,16 +151,18 @@ void ScopeWidget::drawAxesLabels(QPainter &p, const QRectF &plot) const
     p.restore();
 }
 
-void ScopeWidget::paintEvent(QPaintEvent *)
+void ScopeWidget::renderBackground(const QRectF &plot)
 {
-    QPainter p(this);
+    const qreal dpr = devicePixelRatioF();
+    background_ = QPixmap(size() * dpr);
+    background_.setDevicePixelRatio(dpr);
+    backgroundValid_ = true;
+
+    QPainter p(&background_);
     p.setRenderHint(QPainter::Antialiasing);
 
     // Background
     p.fillRect(rect(), QColor(15, 20, 15));
-
-    // Plot area with margins
-    QRectF plot(48, 10, width() - 58, height() - 34);
     if (plot.width() < 10 || plot.height() < 10) return;
 
     // Border
@@ -145,36 +173,83 @@ void ScopeWidget::paintEvent(QPaintEvent *)
     // Grid & labels
     drawGrid(p, plot);
     drawAxesLabels(p, plot);
+}
 
-    // Plot detections
-    p.setPen(Qt::NoPen);
-    p.setBrush(QColor(0, 220, 80, 200));
-    for (const auto &d : dets_.detections) {
-        double hv = d.azimuth * RAD2DEG;
-        double vv = (mode_ == BScope) ? d.range : d.elevation * RAD2DEG;
-        QPointF sp = dataToPlot(hv, vv, plot);
-        p.drawEllipse(sp, 3.0, 3.0);
+const QPixmap &ScopeWidget::trackSprite(bool confirmed)
+{
+    const qreal dpr = devicePixelRatioF();
+    if (dpr != spriteDpr_) {
+        for (int k = 0; k < 2; ++k) {
+            QPixmap pm(QSize(SPRITE_SIZE, SPRITE_SIZE) * dpr);
+            pm.setDevicePixelRatio(dpr);
+            pm.fill(Qt::transparent);
+            {
+                QPainter p(&pm);
+                p.setRenderHint(QPainter::Antialiasing);
+                p.setPen(QPen(trackColor(k == 1), 2));
+                const QPointF sp(SPRITE_SIZE / 2.0, SPRITE_SIZE / 2.0);
+                double sz = (k == 1) ? 7.0 : 5.0;
+                p.drawLine(QPointF(sp.x() - sz, sp.y()), QPointF(sp.x() + sz, sp.y()));
+                p.drawLine(QPointF(sp.x(), sp.y() - sz), QPointF(sp.x(), sp.y() + sz));
+            }
+            sprites_[k] = pm;
+        }
+        spriteDpr_ = dpr;
+    }
+    return sprites_[confirmed ? 1 : 0];
+}
+
+const QStaticText &ScopeWidget::trackLabel(uint32_t trackId)
+{
+    auto it = labels_.find(trackId);
+    if (it == labels_.end()) {
+        QStaticText text(QString("#%1").arg(trackId));
+        text.setPerformanceHint(QStaticText::AggressiveCaching);
+        it = labels_.insert(trackId, text);
     }
+    return *it;
+}
 
-    // Plot tracks
-    for (const auto &t : tracks_) {
+void ScopeWidget::paintEvent(QPaintEvent *)
+{
+    const QRectF plot = plotRect();
+    if (!backgroundValid_) renderBackground(plot);
+
+    QPainter p(this);
+    p.drawPixmap(0, 0, background_);
+    if (plot.width() < 10 || plot.height() < 10) return;
+    p.setRenderHint(QPainter::Antialiasing);
+
+    // Plot detections, in one call: a 6 px round-capped point is the 3 px
+    // radius dot.
+    const int n = static_cast<int>(detData_.size());
+    detScreen_.resize(n);
+    for (int i = 0; i < n; ++i)
+        detScreen_[i] = dataToPlot(detData_[i].x(), detData_[i].y(), plot);
+    p.setPen(QPen(QColor(0, 220, 80, 200), 6.0, Qt::SolidLine, Qt::RoundCap));
+    p.drawPoints(detScreen_);
+
+    // Plot tracks: a sprite each, then the labels one colour at a time.
+    auto trackPos = [&](const TrackData &t) {
         double hv = t.azimuth * RAD2DEG;
         double vv = (mode_ == BScope) ? t.range : t.elevation * RAD2DEG;
-        QPointF sp = dataToPlot(hv, vv, plot);
+        return dataToPlot(hv, vv, plot);
+    };
+    for (const auto &t : tracks_)
+        p.drawPixmap(trackPos(t) - QPointF(SPRITE_SIZE / 2.0, SPRITE_SIZE / 2.0),
+                     trackSprite(t.status == 1));
 
-        bool confirmed = (t.status == 1);
-        QColor col = confirmed ? QColor(255, 80, 80) : QColor(100, 160, 255);
-
-        p.setPen(QPen(col, 2));
-        p.setBrush(Qt::NoBrush);
+    QFont idFont("Arial", 7);
+    p.setFont(idFont);
+    const double ascent = QFontMetricsF(idFont).ascent();   // drawStaticText takes the top left
+    for (bool confirmed : {false, true}) {
+        p.setPen(trackColor(confirmed));
         double sz = confirmed ? 7.0 : 5.0;
-        p.drawLine(QPointF(sp.x() - sz, sp.y()), QPointF(sp.x() + sz, sp.y()));
-        p.drawLine(QPointF(sp.x(), sp.y() - sz), QPointF(sp.x(), sp.y() + sz));
-
-        p.setFont(QFont("Arial", 7));
-        p.setPen(col);
-        p.drawText(QPointF(sp.x() + sz + 1, sp.y() + 4),
-                   QString("#%1").arg(t.trackId));
+        for (const auto &t : tracks_) {
+            if ((t.status == 1) != confirmed) continue;
+            QPointF sp = trackPos(t);
+            p.drawStaticText(QPointF(sp.x() + sz + 1, sp.y() + 4 - ascent), trackLabel(t.trackId));
+        }
     }
 
     // Title
@@ -182,8 +257,14 @@ void ScopeWidget::paintEvent(QPaintEvent *)
     p.setFont(QFont("Arial", 8));
     QString title = (mode_ == BScope)
         ? QString("B-Scope (Range vs Az) — %1 dets  %2 tracks")
-              .arg(dets_.detections.size()).arg(tracks_.size())
+              .arg(detData_.size()).arg(tracks_.size())
         : QString("C-Scope (El vs Az) — %1 dets  %2 tracks")
-              .arg(dets_.detections.size()).arg(tracks_.size());
+              .arg(detData_.size()).arg(tracks_.size());
     p.drawText(QPointF(50, 22), title);
 }
+
+void ScopeWidget::resizeEvent(QResizeEvent *)
+{
+    backgroundValid_ = false;
+    update();
+}
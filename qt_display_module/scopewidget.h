@@ -1,9 +1,13 @@
 #ifndef SCOPEWIDGET_H
 #define SCOPEWIDGET_H
 
-#include "udpreceiver.h"
+#include "displayreceiver.h"
 #include <QWidget>
 #include <QVector>
+#include <QPolygonF>
+#include <QPixmap>
+#include <QHash>
+#include <QStaticText>
 
 class ScopeWidget : public QWidget
 {
@@ -19,16 +23,33 @@ public slots:
 
 protected:
     void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
 
 private:
+    QRectF plotRect() const;
+    void growRange(double range);
     void drawGrid(QPainter &p, const QRectF &plot) const;
     void drawAxesLabels(QPainter &p, const QRectF &plot) const;
     QPointF dataToPlot(double hVal, double vVal, const QRectF &plot) const;
 
+    // Border, grid and axis labels, drawn once into background_ and blitted
+    // on every repaint until a resize or (B-scope) range change.
+    void renderBackground(const QRectF &plot);
+    // Track crosses, pre-rendered at the screen's pixel ratio.
+    const QPixmap &trackSprite(bool confirmed);
+    const QStaticText &trackLabel(uint32_t trackId);
+
     Mode mode_;
-    RawDetectionFrame dets_;
+    QVector<QPointF>   detData_;     // (azimuth deg, range m or elevation deg)
+    QPolygonF          detScreen_;   // paintEvent scratch
     QVector<TrackData> tracks_;
 
+    QPixmap background_;
+    bool    backgroundValid_ = false;
+    QPixmap sprites_[2];             // tentative/coasting, confirmed
+    qreal   spriteDpr_ = 0.0;
+    QHash<uint32_t, QStaticText> labels_;
+
     double maxRange_ = 5000.0; // for B-scope Y axis
 };
 
@@ -0,0 +1,237 @@
+#include "tablemodels.h"
+#include <tuple>
+
+static constexpr double RAD2DEG = 180.0 / 3.14159265358979323846;
+static constexpr uint32_t NO_ID = 0xFFFFFFFFu;
+
+// ---------------------------------------------------------------------------
+// Status / classification string helpers
+// ---------------------------------------------------------------------------
+static QString statusStr(uint32_t s)
+{
+    switch (s) {
+    case 0:  return QStringLiteral("TENT");
+    case 1:  return QStringLiteral("CONF");
+    case 2:  return QStringLiteral("COAST");
+    case 3:  return QStringLiteral("DEL");
+    default: return QStringLiteral("???");
+    }
+}
+
+static QString classStr(uint32_t c)
+{
+    switch (c) {
+    case 0:  return QStringLiteral("Unknown");
+    case 1:  return QStringLiteral("Drone-R");
+    case 2:  return QStringLiteral("Drone-F");
+    case 3:  return QStringLiteral("Bird");
+    case 4:  return QStringLiteral("Clutter");
+    default: return QStringLiteral("???");
+    }
+}
+
+// ---------------------------------------------------------------------------
+// KeyedTableModelBase
+// ---------------------------------------------------------------------------
+KeyedTableModelBase::KeyedTableModelBase(const QVector<Column> &columns, QObject *parent)
+    : QAbstractTableModel(parent), columns_(columns)
+{
+}
+
+int KeyedTableModelBase::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : columns_.size();
+}
+
+QVariant KeyedTableModelBase::headerData(int section, Qt::Orientation orientation,
+                                         int role) const
+{
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole
+        && section >= 0 && section < columns_.size())
+        return columns_[section].title;
+    return QVariant();
+}
+
+QVariant KeyedTableModelBase::format(const QVariant &value, int col) const
+{
+    if (!value.isValid())
+        return QStringLiteral("—");
+    if (value.type() == QVariant::Double)
+        return QString::number(value.toDouble(), 'f', columns_[col].decimals);
+    return value.toString();
+}
+
+Qt::Alignment KeyedTableModelBase::alignment(int /*col*/) const
+{
+    return Qt::AlignRight | Qt::AlignVCenter;
+}
+
+// ---------------------------------------------------------------------------
+// Tracks
+// ---------------------------------------------------------------------------
+TrackTableModel::TrackTableModel(QObject *parent)
+    : KeyedTableModel<TrackData>({
+        {"ID", 0}, {"Status", 0}, {"Class", 0},
+        {"Range(m)", 1}, {"Az(°)", 2}, {"El(°)", 2}, {"Rdot(m/s)", 1},
+        {"X(m)", 1}, {"Y(m)", 1}, {"Z(m)", 1},
+        {"Vx", 1}, {"Vy", 1}, {"Vz", 1},
+        {"Quality", 2}, {"Hits", 0}, {"Miss", 0}, {"Age", 0}
+      }, parent)
+{
+}
+
+QVariant TrackTableModel::value(const TrackData &t, int col) const
+{
+    switch (col) {
+    case 0:  return t.trackId;
+    case 1:  return statusStr(t.status);
+    case 2:  return classStr(t.classification);
+    case 3:  return t.range;
+    case 4:  return t.azimuth * RAD2DEG;
+    case 5:  return t.elevation * RAD2DEG;
+    case 6:  return t.rangeRate;
+    case 7:  return t.x;
+    case 8:  return t.y;
+    case 9:  return t.z;
+    case 10: return t.vx;
+    case 11: return t.vy;
+    case 12: return t.vz;
+    case 13: return t.trackQuality;
+    case 14: return t.hitCount;
+    case 15: return t.missCount;
+    case 16: return t.age;
+    default: return QVariant();
+    }
+}
+
+// Shown fields only: a new timestamp alone does not repaint the row.
+bool TrackTableModel::same(const TrackData &a, const TrackData &b) const
+{
+    return std::tie(a.status, a.classification, a.range, a.azimuth, a.elevation,
+                    a.rangeRate, a.x, a.y, a.z, a.vx, a.vy, a.vz, a.trackQuality,
+                    a.hitCount, a.missCount, a.age)
+        == std::tie(b.status, b.classification, b.range, b.azimuth, b.elevation,
+                    b.rangeRate, b.x, b.y, b.z, b.vx, b.vy, b.vz, b.trackQuality,
+                    b.hitCount, b.missCount, b.age);
+}
+
+// ---------------------------------------------------------------------------
+// Clusters
+// ---------------------------------------------------------------------------
+ClusterTableModel::ClusterTableModel(QObject *parent)
+    : KeyedTableModel<ClusterData>({
+        {"ID", 0}, {"#Dets", 0},
+        {"Range(m)", 1}, {"Az(°)", 2}, {"El(°)", 2},
+        {"Str(dBm)", 1}, {"SNR(dB)", 1}, {"RCS", 2},
+        {"X(m)", 1}, {"Y(m)", 1}, {"Z(m)", 1}
+      }, parent)
+{
+}
+
+QVariant ClusterTableModel::value(const ClusterData &c, int col) const
+{
+    switch (col) {
+    case 0:  return c.clusterId;
+    case 1:  return c.numDetections;
+    case 2:  return c.range;
+    case 3:  return c.azimuth * RAD2DEG;
+    case 4:  return c.elevation * RAD2DEG;
+    case 5:  return c.strength;
+    case 6:  return c.snr;
+    case 7:  return c.rcs;
+    case 8:  return c.x;
+    case 9:  return c.y;
+    case 10: return c.z;
+    default: return QVariant();
+    }
+}
+
+bool ClusterTableModel::same(const ClusterData &a, const ClusterData &b) const
+{
+    return std::tie(a.numDetections, a.range, a.azimuth, a.elevation,
+                    a.strength, a.snr, a.rcs, a.x, a.y, a.z)
+        == std::tie(b.numDetections, b.range, b.azimuth, b.elevation,
+                    b.strength, b.snr, b.rcs, b.x, b.y, b.z);
+}
+
+// ---------------------------------------------------------------------------
+// Association
+// ---------------------------------------------------------------------------
+AssocTableModel::AssocTableModel(QObject *parent)
+    : KeyedTableModel<AssocEntry>({
+        {"Track ID", 0}, {"Cluster ID", 0}, {"Distance", 3}, {"Status", 0}
+      }, parent)
+{
+}
+
+QVariant AssocTableModel::value(const AssocEntry &e, int col) const
+{
+    switch (col) {
+    case 0:  return e.trackId   == NO_ID ? QVariant() : QVariant(e.trackId);
+    case 1:  return e.clusterId == NO_ID ? QVariant() : QVariant(e.clusterId);
+    case 2:  return e.distance < 0 ? QVariant() : QVariant(e.distance);
+    case 3:  return e.matched ? tr("Matched") : tr("Unmatched");
+    default: return QVariant();
+    }
+}
+
+bool AssocTableModel::same(const AssocEntry &a, const AssocEntry &b) const
+{
+    return a.distance == b.distance && a.matched == b.matched;
+}
+
+Qt::Alignment AssocTableModel::alignment(int col) const
+{
+    return col == 3 ? Qt::AlignLeft | Qt::AlignVCenter
+                    : KeyedTableModel<AssocEntry>::alignment(col);
+}
+
+// ---------------------------------------------------------------------------
+// Predicted state
+// ---------------------------------------------------------------------------
+PredictedTableModel::PredictedTableModel(QObject *parent)
+    : KeyedTableModel<PredictedEntry>({
+        {"Track ID", 0}, {"Status", 0},
+        {"Range(m)", 1}, {"Az(°)", 2}, {"El(°)", 2},
+        {"X(m)", 1}, {"Y(m)", 1}, {"Z(m)", 1},
+        {"Vx", 2}, {"Vy", 2}, {"Vz", 2},
+        {"CovX", 1}, {"CovY", 1}, {"CovZ", 1},
+        {"CV", 3}, {"CA1", 3}, {"CA2", 3}, {"CTR1", 3}, {"CTR2", 3}
+      }, parent)
+{
+}
+
+QVariant PredictedTableModel::value(const PredictedEntry &e, int col) const
+{
+    switch (col) {
+    case 0:  return e.trackId;
+    case 1:  return statusStr(e.trackStatus);
+    case 2:  return e.range;
+    case 3:  return e.azimuth * RAD2DEG;
+    case 4:  return e.elevation * RAD2DEG;
+    case 5:  return e.x;
+    case 6:  return e.y;
+    case 7:  return e.z;
+    case 8:  return e.vx;
+    case 9:  return e.vy;
+    case 10: return e.vz;
+    case 11: return e.covX;
+    case 12: return e.covY;
+    case 13: return e.covZ;
+    case 14: case 15: case 16: case 17: case 18:
+             return e.modelProb[col - 14];
+    default: return QVariant();
+    }
+}
+
+bool PredictedTableModel::same(const PredictedEntry &a, const PredictedEntry &b) const
+{
+    return std::tie(a.trackStatus, a.range, a.azimuth, a.elevation,
+                    a.x, a.y, a.z, a.vx, a.vy, a.vz, a.covX, a.covY, a.covZ,
+                    a.modelProb[0], a.modelProb[1], a.modelProb[2],
+                    a.modelProb[3], a.modelProb[4])
+        == std::tie(b.trackStatus, b.range, b.azimuth, b.elevation,
+                    b.x, b.y, b.z, b.vx, b.vy, b.vz, b.covX, b.covY, b.covZ,
+                    b.modelProb[0], b.modelProb[1], b.modelProb[2],
+                    b.modelProb[3], b.modelProb[4]);
+}
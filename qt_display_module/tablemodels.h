@@ -0,0 +1,182 @@
+#ifndef TABLEMODELS_H
+#define TABLEMODELS_H
+
+#include "displayreceiver.h"
+#include <QAbstractTableModel>
+#include <QHash>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+
+// ---------------------------------------------------------------------------
+// KeyedTableModelBase  – columns and roles shared by the keyed table models
+//
+// DisplayRole is the formatted cell text; SortRole is the raw value, so a
+// QSortFilterProxyModel sorts numerically.  Invalid values (unmatched ids,
+// no distance) show as "—" and sort first.
+// ---------------------------------------------------------------------------
+class KeyedTableModelBase : public QAbstractTableModel {
+public:
+    enum { SortRole = Qt::UserRole };
+
+    struct Column {
+        QString title;
+        int     decimals;   // for double values
+    };
+
+    int      columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+protected:
+    KeyedTableModelBase(const QVector<Column> &columns, QObject *parent);
+
+    QVariant format(const QVariant &value, int col) const;
+    virtual Qt::Alignment alignment(int col) const;
+
+    QVector<Column> columns_;
+};
+
+// ---------------------------------------------------------------------------
+// KeyedTableModel  – one row per key (trackId, clusterId, ...)
+//
+// update() diffs a new frame against the rows held: rows whose key is gone
+// are removed, new keys are appended, and dataChanged is emitted only for
+// runs of rows whose contents changed.  Views keep their selection and
+// scroll position, and nothing is reallocated per cell.  Row order is
+// arrival order; sorting is left to a proxy model.
+// ---------------------------------------------------------------------------
+template <typename Row>
+class KeyedTableModel : public KeyedTableModelBase {
+public:
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        return parent.isValid() ? 0 : rows_.size();
+    }
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override
+    {
+        if (!index.isValid() || index.row() >= rows_.size()) return QVariant();
+        const Row &r = rows_[index.row()];
+        switch (role) {
+        case Qt::DisplayRole:       return format(value(r, index.column()), index.column());
+        case SortRole:              return value(r, index.column());
+        case Qt::TextAlignmentRole: return int(alignment(index.column()));
+        default:                    return QVariant();
+        }
+    }
+
+    void update(const QVector<Row> &rows);
+
+protected:
+    using KeyedTableModelBase::KeyedTableModelBase;
+
+    virtual quint64  key(const Row &r) const = 0;
+    // Raw cell value: a number, a string, or invalid for "none".
+    virtual QVariant value(const Row &r, int col) const = 0;
+    virtual bool     same(const Row &a, const Row &b) const = 0;
+
+private:
+    void rowsChanged(int first, int last)
+    {
+        emit dataChanged(index(first, 0), index(last, columns_.size() - 1),
+                         {Qt::DisplayRole, SortRole});
+    }
+
+    QVector<Row>       rows_;
+    QHash<quint64, int> incoming_;   // update() scratch: key -> index in frame
+};
+
+template <typename Row>
+void KeyedTableModel<Row>::update(const QVector<Row> &rows)
+{
+    incoming_.clear();
+    incoming_.reserve(rows.size());
+    for (int i = 0; i < rows.size(); ++i) {
+        const quint64 k = key(rows[i]);
+        if (!incoming_.contains(k)) incoming_.insert(k, i);
+    }
+
+    // Deaths: remove runs of rows whose key is gone, last run first.
+    for (int r = rows_.size() - 1; r >= 0; --r) {
+        if (incoming_.contains(key(rows_[r]))) continue;
+        const int last = r;
+        while (r > 0 && !incoming_.contains(key(rows_[r - 1]))) --r;
+        beginRemoveRows(QModelIndex(), r, last);
+        rows_.remove(r, last - r + 1);
+        endRemoveRows();
+    }
+
+    // Survivors: overwrite in place, signalling runs of changed rows.
+    int run = -1;
+    for (int r = 0; r < rows_.size(); ++r) {
+        const Row &n = rows[incoming_.take(key(rows_[r]))];
+        const bool changed = !same(rows_[r], n);
+        if (changed) {
+            rows_[r] = n;
+            if (run < 0) run = r;
+        } else if (run >= 0) {
+            rowsChanged(run, r - 1);
+            run = -1;
+        }
+    }
+    if (run >= 0) rowsChanged(run, rows_.size() - 1);
+
+    // Births: what is left in incoming_, in frame order.
+    if (!incoming_.isEmpty()) {
+        const int first = rows_.size();
+        beginInsertRows(QModelIndex(), first, first + incoming_.size() - 1);
+        for (int i = 0; i < rows.size(); ++i) {
+            auto it = incoming_.constFind(key(rows[i]));
+            if (it != incoming_.constEnd() && it.value() == i) rows_.append(rows[i]);
+        }
+        endInsertRows();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Concrete models, one per table tab
+// ---------------------------------------------------------------------------
+class TrackTableModel : public KeyedTableModel<TrackData> {
+public:
+    explicit TrackTableModel(QObject *parent = nullptr);
+protected:
+    quint64  key(const TrackData &t) const override { return t.trackId; }
+    QVariant value(const TrackData &t, int col) const override;
+    bool     same(const TrackData &a, const TrackData &b) const override;
+};
+
+class ClusterTableModel : public KeyedTableModel<ClusterData> {
+public:
+    explicit ClusterTableModel(QObject *parent = nullptr);
+protected:
+    quint64  key(const ClusterData &c) const override { return c.clusterId; }
+    QVariant value(const ClusterData &c, int col) const override;
+    bool     same(const ClusterData &a, const ClusterData &b) const override;
+};
+
+// Keyed by the (trackId, clusterId) pair: an unmatched track or cluster
+// has the other id set to 0xFFFFFFFF, so every entry of a frame is unique.
+class AssocTableModel : public KeyedTableModel<AssocEntry> {
+public:
+    explicit AssocTableModel(QObject *parent = nullptr);
+protected:
+    quint64  key(const AssocEntry &e) const override
+    {
+        return (quint64(e.trackId) << 32) | e.clusterId;
+    }
+    QVariant value(const AssocEntry &e, int col) const override;
+    bool     same(const AssocEntry &a, const AssocEntry &b) const override;
+    Qt::Alignment alignment(int col) const override;
+};
+
+class PredictedTableModel : public KeyedTableModel<PredictedEntry> {
+public:
+    explicit PredictedTableModel(QObject *parent = nullptr);
+protected:
+    quint64  key(const PredictedEntry &e) const override { return e.trackId; }
+    QVariant value(const PredictedEntry &e, int col) const override;
+    bool     same(const PredictedEntry &a, const PredictedEntry &b) const override;
+};
+
+#endif // TABLEMODELS_H
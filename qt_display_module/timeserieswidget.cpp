@@ -3,11 +3,85 @@
 #include <QPainter>
 #include <QHBoxLayout>
 #include <QLabel>
+#include <QPair>
+#include <algorithm>
 #include <cmath>
 
 static constexpr double PI = 3.14159265358979323846;
 static constexpr double RAD2DEG = 180.0 / PI;
 
+// ---------------------------------------------------------------------------
+// MinMaxRing
+// ---------------------------------------------------------------------------
+static_assert((MinMaxRing::CAPACITY & (MinMaxRing::CAPACITY - 1)) == 0,
+              "MinMaxRing::CAPACITY must be a power of two");
+static_assert(MinMaxRing::CAPACITY % 256 == 0,
+              "MinMaxRing::CAPACITY must be a multiple of the coarse block");
+
+MinMaxRing::MinMaxRing()
+    : raw_(CAPACITY)
+    , min1_(CAPACITY / L1), max1_(CAPACITY / L1)
+    , min2_(CAPACITY / L2), max2_(CAPACITY / L2)
+{
+}
+
+void MinMaxRing::push(double v)
+{
+    const quint64 i = total_++;
+    raw_[static_cast<int>(i & (CAPACITY - 1))] = v;
+
+    // A block's slot is reset by its first sample; the ring wraps on block
+    // boundaries, so an evicted block is always overwritten whole.
+    const int b1 = static_cast<int>((i / L1) & (CAPACITY / L1 - 1));
+    const int b2 = static_cast<int>((i / L2) & (CAPACITY / L2 - 1));
+    if (i % L1 == 0) { min1_[b1] = v; max1_[b1] = v; }
+    else             { min1_[b1] = std::min(min1_[b1], v); max1_[b1] = std::max(max1_[b1], v); }
+    if (i % L2 == 0) { min2_[b2] = v; max2_[b2] = v; }
+    else             { min2_[b2] = std::min(min2_[b2], v); max2_[b2] = std::max(max2_[b2], v); }
+}
+
+int MinMaxRing::size() const
+{
+    return static_cast<int>(std::min<quint64>(total_, CAPACITY));
+}
+
+double MinMaxRing::at(int k) const
+{
+    const quint64 i = total_ - static_cast<quint64>(size()) + static_cast<quint64>(k);
+    return raw_[static_cast<int>(i & (CAPACITY - 1))];
+}
+
+void MinMaxRing::extent(int from, int to, double &mn, double &mx) const
+{
+    const quint64 first = total_ - static_cast<quint64>(size());
+    quint64       i     = first + static_cast<quint64>(from);
+    const quint64 end   = first + static_cast<quint64>(to);
+
+    mn = at(from);
+    mx = mn;
+    // Take the coarsest whole block that starts at i and ends within the
+    // span, else a single raw sample.
+    while (i < end) {
+        if (i % L2 == 0 && i + L2 <= end) {
+            const int b = static_cast<int>((i / L2) & (CAPACITY / L2 - 1));
+            mn = std::min(mn, min2_[b]); mx = std::max(mx, max2_[b]);
+            i += L2;
+        } else if (i % L1 == 0 && i + L1 <= end) {
+            const int b = static_cast<int>((i / L1) & (CAPACITY / L1 - 1));
+            mn = std::min(mn, min1_[b]); mx = std::max(mx, max1_[b]);
+            i += L1;
+        } else {
+            const double v = raw_[static_cast<int>(i & (CAPACITY - 1))];
+            mn = std::min(mn, v); mx = std::max(mx, v);
+            ++i;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// TimeSeriesWidget
+// ---------------------------------------------------------------------------
+
 TimeSeriesWidget::TimeSeriesWidget(QWidget *parent)
     : QWidget(parent)
 {
@@ -32,50 +106,35 @@ TimeSeriesWidget::TimeSeriesWidget(QWidget *parent)
 
 void TimeSeriesWidget::updateTracks(const QVector<TrackData> &tracks)
 {
-    // Update history for each received track
-    for (const auto &t : tracks) {
-        auto &h = history_[t.trackId];
-        double spd = std::sqrt(t.vx*t.vx + t.vy*t.vy + t.vz*t.vz);
-        h.range.push_back(t.range);
-        h.azimuth.push_back(t.azimuth * RAD2DEG);
-        h.elevation.push_back(t.elevation * RAD2DEG);
-        h.rangeRate.push_back(t.rangeRate);
-        h.quality.push_back(t.trackQuality);
-        h.speed.push_back(spd);
-        h.timestamps.push_back(t.timestamp);
-        while (static_cast<int>(h.range.size())     > MAX_HISTORY) h.range.pop_front();
-        while (static_cast<int>(h.azimuth.size())   > MAX_HISTORY) h.azimuth.pop_front();
-        while (static_cast<int>(h.elevation.size()) > MAX_HISTORY) h.elevation.pop_front();
-        while (static_cast<int>(h.rangeRate.size()) > MAX_HISTORY) h.rangeRate.pop_front();
-        while (static_cast<int>(h.quality.size())   > MAX_HISTORY) h.quality.pop_front();
-        while (static_cast<int>(h.speed.size())     > MAX_HISTORY) h.speed.pop_front();
-        while (static_cast<int>(h.timestamps.size())> MAX_HISTORY) h.timestamps.pop_front();
-    }
-
-    // Sync combo box: add new tracks
-    QSet<uint32_t> activeIds;
-    for (const auto &t : tracks) activeIds.insert(t.trackId);
+    ++updateSeq_;
 
+    // Update history for each received track
     for (const auto &t : tracks) {
-        bool found = false;
-        for (int i = 0; i < trackCombo_->count(); ++i) {
-            if (trackCombo_->itemData(i).toUInt() == t.trackId) { found = true; break; }
-        }
-        if (!found) {
+        auto it = history_.find(t.trackId);
+        if (it == history_.end()) {
+            it = history_.insert(t.trackId, TrackHistory());
             trackCombo_->addItem(QString("Track #%1").arg(t.trackId), t.trackId);
         }
+        TrackHistory &h = *it;
+        double spd = std::sqrt(t.vx*t.vx + t.vy*t.vy + t.vz*t.vz);
+        h.range.push(t.range);
+        h.azimuth.push(t.azimuth * RAD2DEG);
+        h.elevation.push(t.elevation * RAD2DEG);
+        h.rangeRate.push(t.rangeRate);
+        h.quality.push(t.trackQuality);
+        h.speed.push(spd);
+        h.lastSeen = updateSeq_;
+        h.deleted  = (t.status == 3);
     }
 
+    evictHistory();
+
     // If no track selected and there are some, auto-select first confirmed
     if (selectedTrackId_ == 0 && !history_.isEmpty()) {
         for (const auto &t : tracks) {
             if (t.status == 1) {
-                for (int i = 0; i < trackCombo_->count(); ++i) {
-                    if (trackCombo_->itemData(i).toUInt() == t.trackId) {
-                        trackCombo_->setCurrentIndex(i);
-                        break;
-                    }
-                }
+                int i = trackCombo_->findData(t.trackId);
+                if (i >= 0) trackCombo_->setCurrentIndex(i);
                 break;
             }
         }
@@ -84,6 +143,39 @@ void TimeSeriesWidget::updateTracks(const QVector<TrackData> &tracks)
     update();
 }
 
+void TimeSeriesWidget::evictHistory()
+{
+    QVector<QPair<quint64, uint32_t>> dead, live;   // (lastSeen, trackId)
+    for (auto it = history_.cbegin(); it != history_.cend(); ++it) {
+        if (it.key() == selectedTrackId_) continue;
+        const bool isDead = it->deleted || updateSeq_ - it->lastSeen > STALE_UPDATES;
+        (isDead ? dead : live).append(qMakePair(it->lastSeen, it.key()));
+    }
+    if (dead.size() <= MAX_DEAD_TRACKS && history_.size() <= MAX_TRACKS)
+        return;
+
+    std::sort(dead.begin(), dead.end());
+    std::sort(live.begin(), live.end());
+
+    // Oldest dead first, down to MAX_DEAD_TRACKS; then, while still over
+    // MAX_TRACKS, the remaining dead and finally the oldest live tracks.
+    QVector<uint32_t> victims;
+    int d = 0;
+    for (; d < dead.size() - MAX_DEAD_TRACKS; ++d)
+        victims.append(dead[d].second);
+    int over = history_.size() - victims.size() - MAX_TRACKS;
+    for (; over > 0 && d < dead.size(); ++d, --over)
+        victims.append(dead[d].second);
+    for (int l = 0; over > 0 && l < live.size(); ++l, --over)
+        victims.append(live[l].second);
+
+    for (uint32_t id : victims) {
+        history_.remove(id);
+        int i = trackCombo_->findData(id);
+        if (i >= 0) trackCombo_->removeItem(i);
+    }
+}
+
 void TimeSeriesWidget::onTrackChanged(int index)
 {
     selectedTrackId_ = trackCombo_->itemData(index).toUInt();
@@ -92,7 +184,7 @@ void TimeSeriesWidget::onTrackChanged(int index)
 
 // Draw one channel in a sub-rect with label and autoscaled Y
 void TimeSeriesWidget::drawChannel(QPainter &p, const QRectF &rect,
-                                    const std::deque<double> &data,
+                                    const MinMaxRing &data,
                                     const QString &label,
                                     const QColor &color) const
 {
@@ -101,7 +193,8 @@ void TimeSeriesWidget::drawChannel(QPainter &p, const QRectF &rect,
     p.setPen(QColor(50, 80, 50));
     p.drawRect(rect);
 
-    if (data.empty()) {
+    const int n = data.size();
+    if (n == 0) {
         p.setPen(QColor(100, 100, 100));
         p.setFont(QFont("Consolas", 8));
         p.drawText(rect, Qt::AlignCenter, label + "\n(no data)");
@@ -109,8 +202,8 @@ void TimeSeriesWidget::drawChannel(QPainter &p, const QRectF &rect,
     }
 
     // Find min/max
-    double mn = data[0], mx = data[0];
-    for (const auto &v : data) { mn = std::min(mn, v); mx = std::max(mx, v); }
+    double mn, mx;
+    data.extent(0, n, mn, mx);
     if (mx - mn < 1e-6) mx = mn + 1.0;
 
     // Plot area with a small left margin for labels
@@ -134,18 +227,34 @@ void TimeSeriesWidget::drawChannel(QPainter &p, const QRectF &rect,
     p.setFont(QFont("Arial", 8, QFont::Bold));
     p.drawText(QPointF(rect.left() + 1, rect.top() + 12), label);
 
-    // Data line
-    int n = static_cast<int>(data.size());
-    QPolygonF poly;
-    poly.reserve(n);
-    for (int i = 0; i < n; ++i) {
-        double px = plot.left() + (double)i / (MAX_HISTORY - 1) * plot.width();
-        double py = plot.bottom() - (data[i] - mn) / (mx - mn) * plot.height();
-        poly << QPointF(px, py);
+    // Data line.  The x axis spans the ring's capacity, so a new track
+    // grows from the left.  Once there are more samples than pixel columns,
+    // each column is drawn as its min/max pair, so the cost follows the
+    // plot width rather than the history length.
+    const double xScale = plot.width() / (MinMaxRing::CAPACITY - 1);
+    const int    cols   = static_cast<int>(plot.width());
+    auto yOf = [&](double v) { return plot.bottom() - (v - mn) / (mx - mn) * plot.height(); };
+
+    poly_.clear();
+    if (n <= 2 * cols) {
+        for (int i = 0; i < n; ++i)
+            poly_ << QPointF(plot.left() + i * xScale, yOf(data.at(i)));
+    } else {
+        const double perCol = static_cast<double>(MinMaxRing::CAPACITY) / cols;
+        for (int c = 0; c < cols; ++c) {
+            const int a = static_cast<int>(c * perCol);
+            const int b = std::min(n, static_cast<int>((c + 1) * perCol));
+            if (a >= n) break;
+            if (b <= a) continue;
+            double lo, hi;
+            data.extent(a, b, lo, hi);
+            const double px = plot.left() + a * xScale;
+            poly_ << QPointF(px, yOf(hi)) << QPointF(px, yOf(lo));
+        }
     }
     p.setPen(QPen(color, 1.5));
     p.setBrush(Qt::NoBrush);
-    p.drawPolyline(poly);
+    p.drawPolyline(poly_);
 
     // Current value
     p.setPen(Qt::white);
@@ -186,7 +295,7 @@ void TimeSeriesWidget::paintEvent(QPaintEvent *)
     int availH = height() - topY - 4;
     int chH    = availH / 6;
 
-    struct Channel { const std::deque<double> *data; QString label; QColor color; };
+    struct Channel { const MinMaxRing *data; QString label; QColor color; };
     Channel channels[] = {
         { &h.range,     "Range (m)",   QColor(80, 200, 80)   },
         { &h.azimuth,   "Az (deg)",    QColor(80, 160, 255)  },
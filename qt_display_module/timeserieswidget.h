@@ -1,17 +1,44 @@
 #ifndef TIMESERIESWIDGET_H
 #define TIMESERIESWIDGET_H
 
-#include "udpreceiver.h"
+#include "displayreceiver.h"
 #include <QWidget>
 #include <QVector>
 #include <QMap>
 #include <QComboBox>
 #include <QLabel>
-#include <deque>
+#include <QPolygonF>
+
+// Fixed-capacity sample ring.  Alongside the raw samples it keeps min/max
+// per aligned block of 16 and of 256 samples, so the extent of any span is
+// found from at most ~30 raw samples plus one entry per 256.
+class MinMaxRing {
+public:
+    static constexpr int CAPACITY = 2048;   // power of two, multiple of 256
+
+    MinMaxRing();
+
+    void   push(double v);
+    int    size() const;
+    double at(int k) const;                 // k-th oldest retained sample
+    double back() const { return at(size() - 1); }
+    // Min and max over retained samples [from, to), oldest-relative.
+    void   extent(int from, int to, double &mn, double &mx) const;
+
+private:
+    static constexpr int L1 = 16;
+    static constexpr int L2 = 256;
+
+    QVector<double> raw_;
+    QVector<double> min1_, max1_;           // CAPACITY / L1 blocks
+    QVector<double> min2_, max2_;           // CAPACITY / L2 blocks
+    quint64         total_ = 0;             // samples ever pushed
+};
 
 struct TrackHistory {
-    std::deque<double>  range, azimuth, elevation, rangeRate, quality, speed;
-    std::deque<quint64> timestamps;
+    MinMaxRing range, azimuth, elevation, rangeRate, quality, speed;
+    quint64    lastSeen = 0;    // updateSeq_ of the latest sample
+    bool       deleted  = false;
 };
 
 class TimeSeriesWidget : public QWidget
@@ -34,13 +61,22 @@ private slots:
 
 private:
     void drawChannel(QPainter &p, const QRectF &rect,
-                     const std::deque<double> &data,
+                     const MinMaxRing &data,
                      const QString &label, const QColor &color) const;
+    void evictHistory();
 
     QMap<uint32_t, TrackHistory> history_;
     uint32_t selectedTrackId_ = 0;
+    quint64  updateSeq_       = 0;
+    mutable QPolygonF poly_;        // drawChannel scratch
 
-    static constexpr int MAX_HISTORY = 200;
+    // A track is dead once reported Deleted or silent for STALE_UPDATES
+    // updates.  Dead histories beyond MAX_DEAD_TRACKS, and any history
+    // beyond MAX_TRACKS, are evicted least recently seen first; the
+    // selected track is never evicted.
+    static constexpr int     MAX_TRACKS      = 64;
+    static constexpr int     MAX_DEAD_TRACKS = 8;
+    static constexpr quint64 STALE_UPDATES   = 600;
 
     // Controls embedded in the tab header
     QWidget   *controls_;
@@ -1,6 +1,6 @@
 #include "udpreceiver.h"
 
-#include <QNetworkDatagram>
+#include <QUdpSocket>
 #include <cstring>
 
 // ---------------------------------------------------------------------------
@@ -39,47 +39,121 @@ static constexpr int ASSOC_SIZE   = 24;
 static constexpr int PRED_SIZE    = 168;
 
 // ---------------------------------------------------------------------------
-// Low-level readers (safe on unaligned data)
+// Low-level readers (safe on unaligned data; each memcpy compiles to a
+// single load, so fields are read straight from the datagram buffer)
 // ---------------------------------------------------------------------------
 static inline uint32_t rd32(const char *s) { uint32_t v; std::memcpy(&v,s,4); return v; }
 static inline uint64_t rd64(const char *s) { uint64_t v; std::memcpy(&v,s,8); return v; }
 static inline double   rdD (const char *s) { double   v; std::memcpy(&v,s,8); return v; }
 
+// ---------------------------------------------------------------------------
+// Decoder  – lives on UdpReceiver::thread_ and owns the socket
+// ---------------------------------------------------------------------------
+class UdpReceiver::Decoder : public QObject {
+public:
+    explicit Decoder(UdpReceiver &owner) : owner_(owner) {}
+
+    bool    bind(quint16 port);
+    QString errorString() const { return socket_ ? socket_->errorString() : QString(); }
+    void    close();
+
+private:
+    void onReadyRead();
+    void dispatchMessage     (const char *p, int len);
+    void decodeDetections    (const char *p, int len);
+    void decodeTrackTable    (const char *p, int len);
+    void decodeSingleTrack   (const char *p, int len);
+    void decodeClusterTable  (const char *p, int len);
+    void decodeAssocTable    (const char *p, int len);
+    void decodePredictedTable(const char *p, int len);
+
+    UdpReceiver &owner_;
+    QUdpSocket  *socket_ = nullptr;
+    QByteArray   datagram_;         // reused receive buffer
+
+    // Decode targets; each publish*() swaps in a recycled buffer.
+    RawDetectionFrame       detections_;
+    QVector<TrackData>      tracks_;
+    QVector<ClusterData>    clusters_;
+    QVector<AssocEntry>     assoc_;
+    QVector<PredictedEntry> predicted_;
+};
+
+bool UdpReceiver::Decoder::bind(quint16 port)
+{
+    if (!socket_) {
+        socket_ = new QUdpSocket(this);
+        connect(socket_, &QUdpSocket::readyRead, this, [this] { onReadyRead(); });
+    }
+    return socket_->bind(QHostAddress::Any, port);
+}
+
+void UdpReceiver::Decoder::close()
+{
+    delete socket_;
+    socket_ = nullptr;
+}
+
 // ---------------------------------------------------------------------------
 // Construction
 // ---------------------------------------------------------------------------
 UdpReceiver::UdpReceiver(quint16 port, QObject *parent)
-    : QObject(parent)
-    , socket_(new QUdpSocket(this))
+    : DisplayReceiver(parent)
+    , decoder_(new Decoder(*this))
     , port_(port)
 {
-    connect(socket_, &QUdpSocket::readyRead, this, &UdpReceiver::onReadyRead);
+    decoder_->moveToThread(&thread_);
+    thread_.setObjectName(QStringLiteral("UdpReceiver"));
+    thread_.start();
+}
+
+UdpReceiver::~UdpReceiver()
+{
+    stopRenderTick();
+    QMetaObject::invokeMethod(decoder_, [this] { decoder_->close(); },
+                              Qt::BlockingQueuedConnection);
+    thread_.quit();
+    thread_.wait();
+    delete decoder_;
 }
 
-bool UdpReceiver::bind()
+bool UdpReceiver::start()
 {
-    return socket_->bind(QHostAddress::Any, port_);
+    bool ok = false;
+    QMetaObject::invokeMethod(decoder_, [this] { return decoder_->bind(port_); },
+                              Qt::BlockingQueuedConnection, &ok);
+    if (ok)
+        startRenderTick();
+    else
+        QMetaObject::invokeMethod(decoder_, [this] { return decoder_->errorString(); },
+                                  Qt::BlockingQueuedConnection, &error_);
+    return ok;
+}
+
+QString UdpReceiver::endpoint() const
+{
+    return tr("UDP port %1").arg(port_);
 }
 
 // ---------------------------------------------------------------------------
-// Incoming datagram dispatch
+// Incoming datagram dispatch (worker thread)
 // ---------------------------------------------------------------------------
-void UdpReceiver::onReadyRead()
+void UdpReceiver::Decoder::onReadyRead()
 {
     while (socket_->hasPendingDatagrams()) {
-        QByteArray data = socket_->receiveDatagram().data();
-        if (data.size() >= 4)
-            dispatchMessage(data);
+        const qint64 size = socket_->pendingDatagramSize();
+        if (size < 0) break;
+        if (datagram_.size() < size)
+            datagram_.resize(static_cast<int>(size));
+        const qint64 n = socket_->readDatagram(datagram_.data(), size);
+        if (n >= 4)
+            dispatchMessage(datagram_.constData(), static_cast<int>(n));
     }
 }
 
-void UdpReceiver::dispatchMessage(const QByteArray &data)
+void UdpReceiver::Decoder::dispatchMessage(const char *p, int n)
 {
-    uint32_t msgId = rd32(data.constData());
-    const char *p  = data.constData();
-    int         n  = data.size();
-
-    switch (msgId) {
+    switch (rd32(p)) {
     case MSG_SP_DETECTION:    decodeDetections(p, n);     break;
     case MSG_TRACK_UPDATE:    decodeSingleTrack(p, n);    break;
     case MSG_TRACK_TABLE:     decodeTrackTable(p, n);     break;
@@ -95,16 +169,16 @@ void UdpReceiver::dispatchMessage(const QByteArray &data)
 // Header: msgId(4) dwellCount(4) timestamp(8) numDets(4)  = 20 bytes
 // Detection: range az el strength noise snr rcs microDoppler  (8 doubles, 64 bytes)
 // ---------------------------------------------------------------------------
-void UdpReceiver::decodeDetections(const char *p, int len)
+void UdpReceiver::Decoder::decodeDetections(const char *p, int len)
 {
     if (len < 20) return;
 
-    RawDetectionFrame frame;
+    uint32_t n = rd32(p + 16);
+    if (len < 20 + static_cast<int>(n) * DET_SIZE) return;
+
+    RawDetectionFrame &frame = detections_;
     frame.dwellCount = rd32(p + 4);
     frame.timestamp  = rd64(p + 8);
-    uint32_t n       = rd32(p + 16);
-
-    if (len < 20 + static_cast<int>(n) * DET_SIZE) return;
 
     frame.detections.resize(static_cast<int>(n));
     for (uint32_t i = 0; i < n; ++i) {
@@ -119,7 +193,7 @@ void UdpReceiver::decodeDetections(const char *p, int len)
         d.rcs          = rdD(dp + 48);
         d.microDoppler = rdD(dp + 56);
     }
-    emit rawDetectionsReceived(frame);
+    owner_.publishDetections(frame);
 }
 
 // ---------------------------------------------------------------------------
@@ -153,29 +227,29 @@ static void readTrackEntry(const char *ep, TrackData &t)
 // Header: msgId(4) timestamp(8) numTracks(4) = 16 bytes
 // Entry:  TrackUpdateMessage = 128 bytes each
 // ---------------------------------------------------------------------------
-void UdpReceiver::decodeTrackTable(const char *p, int len)
+void UdpReceiver::Decoder::decodeTrackTable(const char *p, int len)
 {
     if (len < 16) return;
     uint32_t n = rd32(p + 12);
 
     if (len < 16 + static_cast<int>(n) * TRACK_SIZE) return;
 
-    QVector<TrackData> tracks(static_cast<int>(n));
+    QVector<TrackData> &tracks = tracks_;
+    tracks.resize(static_cast<int>(n));
     for (uint32_t i = 0; i < n; ++i)
         readTrackEntry(p + 16 + i * TRACK_SIZE, tracks[static_cast<int>(i)]);
-
-    emit tracksReceived(tracks);
+    owner_.publishTracks(tracks);
 }
 
 // ---------------------------------------------------------------------------
 // MSG_TRACK_UPDATE (0x0002)  – bare TrackUpdateMessage, 128 bytes
 // ---------------------------------------------------------------------------
-void UdpReceiver::decodeSingleTrack(const char *p, int len)
+void UdpReceiver::Decoder::decodeSingleTrack(const char *p, int len)
 {
     if (len < TRACK_SIZE) return;
     TrackData t;
     readTrackEntry(p, t);
-    emit tracksReceived({t});
+    owner_.mergeTrack(t);
 }
 
 // ---------------------------------------------------------------------------
@@ -183,16 +257,15 @@ void UdpReceiver::decodeSingleTrack(const char *p, int len)
 // Header: msgId(4) timestamp(8) dwellCount(4) numItems(4) = 20 bytes
 // ClusterWire (packed): clusterId u32, numDets u32, range az el str snr rcs md x y z (10×d8) = 88 bytes
 // ---------------------------------------------------------------------------
-void UdpReceiver::decodeClusterTable(const char *p, int len)
+void UdpReceiver::Decoder::decodeClusterTable(const char *p, int len)
 {
     if (len < 20) return;
-    quint64  ts         = rd64(p +  4);
-    quint32  dwellCount = rd32(p + 12);
-    uint32_t n          = rd32(p + 16);
+    uint32_t n = rd32(p + 16);
 
     if (len < 20 + static_cast<int>(n) * CLUSTER_SIZE) return;
 
-    QVector<ClusterData> clusters(static_cast<int>(n));
+    QVector<ClusterData> &clusters = clusters_;
+    clusters.resize(static_cast<int>(n));
     for (uint32_t i = 0; i < n; ++i) {
         const char *cp = p + 20 + i * CLUSTER_SIZE;
         ClusterData &c = clusters[static_cast<int>(i)];
@@ -209,7 +282,7 @@ void UdpReceiver::decodeClusterTable(const char *p, int len)
         c.y             = rdD (cp + 72);
         c.z             = rdD (cp + 80);
     }
-    emit clustersReceived(clusters, ts, dwellCount);
+    owner_.publishClusters(clusters, rd64(p + 4), rd32(p + 12));
 }
 
 // ---------------------------------------------------------------------------
@@ -217,15 +290,15 @@ void UdpReceiver::decodeClusterTable(const char *p, int len)
 // Header: msgId(4) timestamp(8) numItems(4) = 16 bytes
 // AssocEntryWire (packed): trackId u32, clusterId u32, distance d8, matched u32, pad u32 = 24 bytes
 // ---------------------------------------------------------------------------
-void UdpReceiver::decodeAssocTable(const char *p, int len)
+void UdpReceiver::Decoder::decodeAssocTable(const char *p, int len)
 {
     if (len < 16) return;
-    quint64  ts = rd64(p + 4);
-    uint32_t n  = rd32(p + 12);
+    uint32_t n = rd32(p + 12);
 
     if (len < 16 + static_cast<int>(n) * ASSOC_SIZE) return;
 
-    QVector<AssocEntry> entries(static_cast<int>(n));
+    QVector<AssocEntry> &entries = assoc_;
+    entries.resize(static_cast<int>(n));
     for (uint32_t i = 0; i < n; ++i) {
         const char *ep = p + 16 + i * ASSOC_SIZE;
         AssocEntry  &e = entries[static_cast<int>(i)];
@@ -235,7 +308,7 @@ void UdpReceiver::decodeAssocTable(const char *p, int len)
         e.matched   = rd32(ep + 16);
         // ep+20 is the wire pad field – skip
     }
-    emit assocReceived(entries, ts);
+    owner_.publishAssoc(entries, rd64(p + 4));
 }
 
 // ---------------------------------------------------------------------------
@@ -247,15 +320,15 @@ void UdpReceiver::decodeAssocTable(const char *p, int len)
 //   range az el (3×d8), covX covY covZ (3×d8), modelProb[5] (5×d8)
 //   total: 8 + 20×8 = 168 bytes
 // ---------------------------------------------------------------------------
-void UdpReceiver::decodePredictedTable(const char *p, int len)
+void UdpReceiver::Decoder::decodePredictedTable(const char *p, int len)
 {
     if (len < 16) return;
-    quint64  ts = rd64(p + 4);
-    uint32_t n  = rd32(p + 12);
+    uint32_t n = rd32(p + 12);
 
     if (len < 16 + static_cast<int>(n) * PRED_SIZE) return;
 
-    QVector<PredictedEntry> entries(static_cast<int>(n));
+    QVector<PredictedEntry> &entries = predicted_;
+    entries.resize(static_cast<int>(n));
     for (uint32_t i = 0; i < n; ++i) {
         const char     *ep = p + 16 + i * PRED_SIZE;
         PredictedEntry  &e = entries[static_cast<int>(i)];
@@ -273,5 +346,5 @@ void UdpReceiver::decodePredictedTable(const char *p, int len)
         for (int m = 0; m < 5; ++m)
             e.modelProb[m] = rdD(ep + 128 + m * 8);
     }
-    emit predictedReceived(entries, ts);
+    owner_.publishPredicted(entries, rd64(p + 4));
 }
@@ -0,0 +1,784 @@
+/*
+ * Tracker Microbenchmarks
+ *
+ * Times the tracker's hot kernels in isolation, each at a range of sizes:
+ * the matrix_ops kernels, IMMFilter predict/update, IMMBatch predict, every
+ * motion model, every clusterer at 100 / 1k / 10k detections, every
+ * associator at growing track x cluster counts,
+ * TrackInitiator::processCandidates and BinaryLogger record writes.  Inputs are synthetic and seeded, so runs are comparable across
+ * builds and machines.
+ *
+ * The harness follows Google Benchmark: each benchmark's iteration count is
+ * raised until a run lasts --benchmark_min_time, and the flags and the JSON
+ * report (--benchmark_format=json, --benchmark_out) use its names and layout,
+ * so compare.py and the usual dashboards read the output as is.
+ *
+ * Usage: cuas_bench [options]
+ *   --benchmark_filter=REGEX   : run only the benchmarks whose name matches
+ *   --benchmark_min_time=SEC   : minimum time per benchmark (default 0.5)
+ *   --benchmark_format=FMT     : console (default) or json on stdout
+ *   --benchmark_out=FILE       : also write the JSON report to FILE
+ *   --benchmark_list_tests     : print the benchmark names and exit
+ *   --config=FILE              : tracker_config.json (default: config/tracker_config.json)
+ */
+
+#include "common/types.h"
+#include "common/config.h"
+#include "common/logger.h"
+#include "common/matrix_ops.h"
+#include "prediction/imm_filter.h"
+#include "prediction/imm_batch.h"
+#include "prediction/cv_model.h"
+#include "clustering/cluster_engine.h"
+#include "clustering/sector_clusterer.h"
+#include "association/gnn_associator.h"
+#include "association/jpda_associator.h"
+#include "association/mht_associator.h"
+#include "association/mahalanobis_associator.h"
+#include "track_management/track_initiator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace cuas;
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Harness
+// ---------------------------------------------------------------------------
+// Keeps the compiler from discarding a result the benchmark never reads.
+template<typename T>
+inline void doNotOptimize(T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : "+m"(value) : : "memory");
+#else
+    static volatile char sink;
+    sink = *reinterpret_cast<volatile char*>(&value);
+#endif
+}
+
+// Passed to each benchmark: its arguments, and the timed loop
+//     setup ...;  while (state.keepRunning()) { kernel ...; }
+// The clock starts at the first keepRunning() call and stops at the last.
+class BenchState {
+public:
+    BenchState(const std::vector<int64_t>& args, uint64_t iterations)
+        : args_(args), iterations_(iterations) {}
+
+    int64_t  range(size_t i) const { return args_[i]; }
+    uint64_t iterations() const    { return iterations_; }
+
+    bool keepRunning() {
+        if (done_ == 0 && !started_) {
+            started_ = true;
+            resumeTiming();
+        }
+        if (done_ < iterations_) { ++done_; return true; }
+        pauseTiming();
+        return false;
+    }
+
+    // Untimed work inside the loop (draining, resetting).
+    void pauseTiming() {
+        wallSec_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart_).count();
+        cpuSec_  += static_cast<double>(std::clock() - cpuStart_) / CLOCKS_PER_SEC;
+    }
+    void resumeTiming() {
+        wallStart_ = std::chrono::steady_clock::now();
+        cpuStart_  = std::clock();
+    }
+
+    // Work per iteration (detections, records, ...), reported as items/s.
+    void setItemsPerIteration(double n) { itemsPerIteration_ = n; }
+    // Extra result columns, reported as set (not divided by iterations).
+    std::map<std::string, double> counters;
+
+    double wallSec() const           { return wallSec_; }
+    double cpuSec() const            { return cpuSec_; }
+    double itemsPerIteration() const { return itemsPerIteration_; }
+
+private:
+    std::vector<int64_t> args_;
+    uint64_t iterations_;
+    uint64_t done_    = 0;
+    bool     started_ = false;
+    std::chrono::steady_clock::time_point wallStart_;
+    std::clock_t cpuStart_ = 0;
+    double wallSec_ = 0.0, cpuSec_ = 0.0, itemsPerIteration_ = 0.0;
+};
+
+struct Benchmark {
+    std::string                     name;     // "family/arg0/arg1"
+    std::vector<int64_t>            args;
+    std::function<void(BenchState&)> fn;
+};
+
+struct BenchResult {
+    std::string name;
+    uint64_t    iterations = 0;
+    double      realNs = 0.0, cpuNs = 0.0;    // per iteration
+    double      itemsPerSecond = 0.0;
+    std::map<std::string, double> counters;
+};
+
+std::vector<Benchmark>& registry() {
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+// One benchmark per argument list: "family/a/b".
+void add(const std::string& family, std::function<void(BenchState&)> fn,
+         const std::vector<std::vector<int64_t>>& argLists = {{}}) {
+    for (const auto& args : argLists) {
+        std::string name = family;
+        for (int64_t a : args) name += "/" + std::to_string(a);
+        registry().push_back({name, args, fn});
+    }
+}
+
+// Runs with 1 iteration, then with more until the run lasts minTime: each
+// step aims for 1.4x minTime from the last run's rate, at most 10x more
+// iterations.
+BenchResult run(const Benchmark& b, double minTime) {
+    uint64_t iterations = 1;
+    for (;;) {
+        BenchState s(b.args, iterations);
+        b.fn(s);
+        const double sec = s.wallSec();
+        if (sec >= minTime || iterations >= (uint64_t(1) << 40)) {
+            BenchResult r;
+            r.name       = b.name;
+            r.iterations = iterations;
+            r.realNs     = sec * 1e9 / iterations;
+            r.cpuNs      = s.cpuSec() * 1e9 / iterations;
+            if (s.itemsPerIteration() > 0.0 && sec > 0.0)
+                r.itemsPerSecond = s.itemsPerIteration() * iterations / sec;
+            r.counters = s.counters;
+            return r;
+        }
+        double next = sec > 1e-9 ? iterations * 1.4 * minTime / sec : iterations * 10.0;
+        next = std::min(next, iterations * 10.0);
+        iterations = std::max(iterations + 1, static_cast<uint64_t>(next));
+    }
+}
+
+std::string jsonEscape(const std::string& s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+void writeJson(std::ostream& os, const std::vector<BenchResult>& results, const char* argv0) {
+    char date[32];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    os << "{\n  \"context\": {\n";
+    os << "    \"date\": \"" << date << "\",\n";
+    os << "    \"executable\": \"" << jsonEscape(argv0) << "\",\n";
+    os << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+    os << "    \"kernel_isa\": \"" << mat::kernelIsa() << "\",\n";
+#ifdef NDEBUG
+    os << "    \"library_build_type\": \"release\"\n";
+#else
+    os << "    \"library_build_type\": \"debug\"\n";
+#endif
+    os << "  },\n  \"benchmarks\": [\n";
+    char num[64];
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        os << "    {\n";
+        os << "      \"name\": \"" << jsonEscape(r.name) << "\",\n";
+        os << "      \"run_name\": \"" << jsonEscape(r.name) << "\",\n";
+        os << "      \"run_type\": \"iteration\",\n";
+        os << "      \"repetitions\": 1,\n";
+        os << "      \"repetition_index\": 0,\n";
+        os << "      \"threads\": 1,\n";
+        os << "      \"iterations\": " << r.iterations << ",\n";
+        std::snprintf(num, sizeof(num), "%.6e", r.realNs);
+        os << "      \"real_time\": " << num << ",\n";
+        std::snprintf(num, sizeof(num), "%.6e", r.cpuNs);
+        os << "      \"cpu_time\": " << num << ",\n";
+        if (r.itemsPerSecond > 0.0) {
+            std::snprintf(num, sizeof(num), "%.6e", r.itemsPerSecond);
+            os << "      \"items_per_second\": " << num << ",\n";
+        }
+        for (const auto& c : r.counters) {
+            std::snprintf(num, sizeof(num), "%.6e", c.second);
+            os << "      \"" << jsonEscape(c.first) << "\": " << num << ",\n";
+        }
+        os << "      \"time_unit\": \"ns\"\n";
+        os << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    os << "  ]\n}\n";
+}
+
+void printRow(const BenchResult& r) {
+    char line[256];
+    int n = std::snprintf(line, sizeof(line), "%-44s %14.1f ns %14.1f ns %12llu",
+                          r.name.c_str(), r.realNs, r.cpuNs,
+                          static_cast<unsigned long long>(r.iterations));
+    std::string extra;
+    if (r.itemsPerSecond > 0.0) {
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), " items/s=%.3g", r.itemsPerSecond);
+        extra += buf;
+    }
+    for (const auto& c : r.counters) {
+        char buf[96];
+        std::snprintf(buf, sizeof(buf), " %s=%.4g", c.first.c_str(), c.second);
+        extra += buf;
+    }
+    std::cout << std::string(line, static_cast<size_t>(n)) << extra << std::endl;
+}
+
+// ---------------------------------------------------------------------------
+// Inputs
+// ---------------------------------------------------------------------------
+TrackerConfig g_cfg;
+
+double uniform(std::mt19937_64& rng, double lo, double hi) {
+    return std::uniform_real_distribution<double>(lo, hi)(rng);
+}
+
+SymStateMatrix randomSPD(std::mt19937_64& rng) {
+    StateMatrix A, P = matZero();
+    for (auto& row : A)
+        for (double& v : row) v = uniform(rng, -1.0, 1.0);
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = 0; j < STATE_DIM; ++j) {
+            for (int k = 0; k < STATE_DIM; ++k) P[i][j] += A[i][k] * A[j][k];
+            if (i == j) P[i][j] += STATE_DIM;
+        }
+    return symFromMatrix(P);
+}
+
+StateVector randomState(std::mt19937_64& rng) {
+    StateVector x;
+    for (int a = 0; a < 3; ++a) {
+        x[a * AXIS_DIM]     = uniform(rng, -5000.0, 5000.0);
+        x[a * AXIS_DIM + 1] = uniform(rng, -30.0, 30.0);
+        x[a * AXIS_DIM + 2] = uniform(rng, -3.0, 3.0);
+    }
+    return x;
+}
+
+// A maneuvering track's IMM state, every model at (x, P).
+IMMState makeImmState(std::mt19937_64& rng) {
+    IMMState s;
+    const StateVector    x = randomState(rng);
+    const SymStateMatrix P = randomSPD(rng);
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        s.modelStates[m]       = x;
+        s.modelCovariances[m]  = P;
+        s.modeProbabilities[m] = g_cfg.prediction.imm.initialModeProbabilities[m];
+    }
+    IMMFilter::mergeEstimates(s);
+    return s;
+}
+
+MeasMatrix measurementNoise() {
+    MeasMatrix R{};
+    for (int i = 0; i < MEAS_DIM; ++i) R[i][i] = 625.0;
+    return R;
+}
+
+// One dwell: 5-detection targets making up a tenth of the detections, the
+// rest clutter over the whole field of view.
+std::vector<Detection> makeDetections(size_t n, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<Detection> dets;
+    dets.reserve(n);
+    while (dets.size() < n) {
+        Detection d;
+        if (dets.size() % 50 == 0) {
+            const double r = uniform(rng, 500.0, 15000.0), az = uniform(rng, -M_PI, M_PI);
+            const double el = uniform(rng, 0.0, 0.3);
+            for (int k = 0; k < 5 && dets.size() < n; ++k) {
+                d.range     = r + uniform(rng, -2.0, 2.0);
+                d.azimuth   = az + uniform(rng, -0.002, 0.002);
+                d.elevation = el + uniform(rng, -0.002, 0.002);
+                d.strength  = uniform(rng, -70.0, -40.0);
+                d.snr       = uniform(rng, 15.0, 40.0);
+                dets.push_back(d);
+            }
+            continue;
+        }
+        d.range     = uniform(rng, 500.0, 15000.0);
+        d.azimuth   = uniform(rng, -M_PI, M_PI);
+        d.elevation = uniform(rng, 0.0, 0.3);
+        d.strength  = uniform(rng, -90.0, -60.0);
+        d.snr       = uniform(rng, 10.0, 20.0);
+        dets.push_back(d);
+    }
+    return dets;
+}
+
+Cluster clusterAt(double r, double az, double el, double snr) {
+    Cluster c;
+    c.range     = r;
+    c.azimuth   = az;
+    c.elevation = el;
+    c.snr       = snr;
+    c.cartesian = sphericalToCartesian(r, az, el);
+    c.numDetections = 1;
+    return c;
+}
+
+// nTracks targets 30 m apart with 25 m measurement sigma, so gates overlap,
+// 90% detected, and clutter up to nClusters clusters in all.
+void makeScene(size_t nTracks, size_t nClusters, uint64_t seed,
+               std::vector<InnovationStats>& tracks, std::vector<Cluster>& clusters) {
+    std::mt19937_64 rng(seed);
+    std::normal_distribution<double> noise(0.0, 25.0);
+    const size_t side = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(nTracks))));
+    InnovationStats inn;
+    inn.valid = true;
+    MeasMatrix S{};
+    for (int m = 0; m < MEAS_DIM; ++m) S[m][m] = inn.sDiag[m] = 2.0 * 625.0;
+    mat::invertSPD3(S, inn.Sinv, inn.logDetS);
+
+    tracks.clear();
+    clusters.clear();
+    for (size_t t = 0; t < nTracks; ++t) {
+        inn.zPred = {2000.0 + 30.0 * (t % side), 1000.0 + 30.0 * (t / side), 100.0};
+        tracks.push_back(inn);
+        if (uniform(rng, 0.0, 1.0) < 0.9 && clusters.size() < nClusters) {
+            Cluster c;
+            c.cartesian = {inn.zPred[0] + noise(rng), inn.zPred[1] + noise(rng), inn.zPred[2] + noise(rng)};
+            clusters.push_back(c);
+        }
+    }
+    while (clusters.size() < nClusters) {
+        Cluster c;
+        c.cartesian = {2000.0 + uniform(rng, 0.0, 30.0 * side), 1000.0 + uniform(rng, 0.0, 30.0 * side),
+                       100.0 + uniform(rng, -50.0, 50.0)};
+        clusters.push_back(c);
+    }
+    std::shuffle(clusters.begin(), clusters.end(), rng);
+    for (size_t i = 0; i < clusters.size(); ++i) clusters[i].clusterId = static_cast<uint32_t>(i + 1);
+}
+
+// ---------------------------------------------------------------------------
+// Benchmarks
+// ---------------------------------------------------------------------------
+void registerMatrixOps() {
+    auto withInputs = [](std::function<void(BenchState&, std::mt19937_64&)> body) {
+        return [body](BenchState& s) { std::mt19937_64 rng(1); body(s, rng); };
+    };
+    add("matrix/multiply", withInputs([](BenchState& s, std::mt19937_64& rng) {
+        StateMatrix A = symToMatrix(randomSPD(rng)), B = symToMatrix(randomSPD(rng));
+        while (s.keepRunning()) { StateMatrix C = mat::multiply(A, B); doNotOptimize(C); }
+    }));
+    add("matrix/multiplyMV", withInputs([](BenchState& s, std::mt19937_64& rng) {
+        StateMatrix A = symToMatrix(randomSPD(rng));
+        StateVector x = randomState(rng);
+        while (s.keepRunning()) { StateVector y = mat::multiplyMV(A, x); doNotOptimize(y); }
+    }));
+    add("matrix/outerProduct", withInputs([](BenchState& s, std::mt19937_64& rng) {
+        StateVector a = randomState(rng), b = randomState(rng);
+        while (s.keepRunning()) { StateMatrix C = mat::outerProduct(a, b); doNotOptimize(C); }
+    }));
+    add("matrix/accumulateMoment", withInputs([](BenchState& s, std::mt19937_64& rng) {
+        SymStateMatrix acc{}, P = randomSPD(rng);
+        StateVector d = randomState(rng);
+        while (s.keepRunning()) { mat::accumulateMoment(acc, 0.2, P, d); doNotOptimize(acc); }
+    }));
+    add("matrix/propagateAxisBlocks", withInputs([](BenchState& s, std::mt19937_64& rng) {
+        CVModel cv(g_cfg.prediction.cv);
+        StateMatrix F = cv.getTransitionMatrix(0.1, StateVector{}), Q = symToMatrix(randomSPD(rng));
+        SymStateMatrix P = randomSPD(rng);
+        while (s.keepRunning()) { SymStateMatrix R = mat::propagateAxisBlocks(F, P, Q); doNotOptimize(R); }
+    }));
+    add("matrix/propagateDense", withInputs([](BenchState& s, std::mt19937_64& rng) {
+        StateMatrix F = symToMatrix(randomSPD(rng)), Q = symToMatrix(randomSPD(rng));
+        SymStateMatrix P = randomSPD(rng);
+        while (s.keepRunning()) { SymStateMatrix R = mat::propagateDense(F, P, Q); doNotOptimize(R); }
+    }));
+    add("matrix/invertState", withInputs([](BenchState& s, std::mt19937_64& rng) {
+        StateMatrix A = symToMatrix(randomSPD(rng)), Ainv;
+        while (s.keepRunning()) { bool ok = mat::invertState(A, Ainv); doNotOptimize(ok); doNotOptimize(Ainv); }
+    }));
+    add("matrix/krkt", withInputs([](BenchState& s, std::mt19937_64& rng) {
+        StateMeasMatrix K;
+        for (auto& row : K)
+            for (double& v : row) v = uniform(rng, -1.0, 1.0);
+        const MeasMatrix R = measurementNoise();
+        while (s.keepRunning()) { SymStateMatrix P = mat::krkt(K, R); doNotOptimize(P); }
+    }));
+    add("matrix/udFactor", withInputs([](BenchState& s, std::mt19937_64& rng) {
+        SymStateMatrix P = randomSPD(rng);
+        mat::UDFactors f;
+        while (s.keepRunning()) { bool ok = mat::udFactor(P, f); doNotOptimize(ok); doNotOptimize(f); }
+    }));
+    add("matrix/udCompose", withInputs([](BenchState& s, std::mt19937_64& rng) {
+        mat::UDFactors f;
+        mat::udFactor(randomSPD(rng), f);
+        while (s.keepRunning()) { SymStateMatrix P = mat::udCompose(f); doNotOptimize(P); }
+    }));
+}
+
+// Each iteration copies a fresh state in, so the covariance does not grow
+// over the run; the copy (~2.5 kB) is part of the time.
+void registerPrediction() {
+    add("imm/predict", [](BenchState& s) {
+        IMMFilter filter(g_cfg.prediction);
+        filter.prepare(0.1);
+        std::mt19937_64 rng(2);
+        const IMMState base = makeImmState(rng);
+        while (s.keepRunning()) { IMMState st = base; filter.predict(0.1, st); doNotOptimize(st); }
+    });
+    add("imm/update", [](BenchState& s) {
+        IMMFilter filter(g_cfg.prediction);
+        filter.prepare(0.1);
+        std::mt19937_64 rng(3);
+        IMMState base = makeImmState(rng);
+        filter.predict(0.1, base);
+        const MeasVector z = {base.mergedState[0] + 20.0, base.mergedState[3] - 15.0,
+                              base.mergedState[6] + 5.0};
+        const MeasMatrix R = measurementNoise();
+        while (s.keepRunning()) { IMMState st = base; filter.update(st, z, R); doNotOptimize(st); }
+    });
+
+    // The tracker's predict: every track of a dwell through IMMBatch, one
+    // thread.  The states are stored back untimed after each dwell.
+    add("imm/batchPredict", [](BenchState& s) {
+        IMMFilter filter(g_cfg.prediction);
+        filter.prepare(0.1);
+        std::unique_ptr<IMMBatch> batch = IMMBatch::create(filter);
+        WorkerPool workers(1);
+        std::mt19937_64 rng(5);
+        std::vector<IMMState> base;
+        for (int64_t i = 0; i < s.range(0); ++i) {
+            base.push_back(makeImmState(rng));
+            batch->allocate(base.back().mergedState, base.back().mergedCovariance,
+                            base.back().modeProbabilities);
+        }
+        while (s.keepRunning()) {
+            batch->predict(0.1, workers);
+            s.pauseTiming();
+            for (uint32_t i = 0; i < base.size(); ++i) batch->store(i, base[i]);
+            s.resumeTiming();
+        }
+        s.setItemsPerIteration(static_cast<double>(base.size()));
+    }, {{100}, {1000}});
+
+    // IMMFilter's models, in its order; the state turns, so CTR runs dense.
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        const std::string name = IMMFilter(g_cfg.prediction).model(m).name();
+        add("model/" + name + "/predict", [m](BenchState& s) {
+            IMMFilter filter(g_cfg.prediction);
+            filter.prepare(0.1);
+            const IMotionModel& model = filter.model(m);
+            std::mt19937_64 rng(4);
+            const StateVector    x = randomState(rng);
+            const SymStateMatrix P = randomSPD(rng);
+            StateVector    xOut;
+            SymStateMatrix POut;
+            while (s.keepRunning()) {
+                model.predict(x, P, 0.1, xOut, POut);
+                doNotOptimize(xOut);
+                doNotOptimize(POut);
+            }
+        });
+    }
+}
+
+void registerClustering() {
+    const std::vector<std::vector<int64_t>> sizes = {{100}, {1000}, {10000}};
+    const std::pair<const char*, ClusterMethod> methods[] = {
+        {"dbscan", ClusterMethod::DBSCAN},
+        {"range", ClusterMethod::RangeBased},
+        {"rangeStrength", ClusterMethod::RangeStrengthBased},
+        {"components", ClusterMethod::ConnectedComponents},
+    };
+    for (const auto& method : methods) {
+        const ClusterMethod kind = method.second;
+        add(std::string("cluster/") + method.first, [kind](BenchState& s) {
+            ClusterConfig cfg = g_cfg.clustering;
+            cfg.method = kind;
+            std::unique_ptr<IClusterer> clusterer = makeClusterer(cfg);
+            const std::vector<Detection> dets = makeDetections(static_cast<size_t>(s.range(0)), 5);
+            std::vector<Cluster> out;
+            while (s.keepRunning()) { clusterer->cluster(dets, out); doNotOptimize(out); }
+            s.setItemsPerIteration(static_cast<double>(dets.size()));
+            s.counters["clusters"] = static_cast<double>(out.size());
+        }, sizes);
+    }
+    // The configured method over azimuth sectors, one thread each.
+    add("cluster/sectors", [](BenchState& s) {
+        ClusterConfig cfg = g_cfg.clustering;
+        cfg.sectors = std::max(cfg.sectors, 4);
+        SectorClusterer clusterer(cfg);
+        const std::vector<Detection> dets = makeDetections(static_cast<size_t>(s.range(0)), 5);
+        std::vector<Cluster> out;
+        while (s.keepRunning()) { clusterer.cluster(dets, out); doNotOptimize(out); }
+        s.setItemsPerIteration(static_cast<double>(dets.size()));
+        s.counters["clusters"] = static_cast<double>(out.size());
+    }, sizes);
+}
+
+void registerAssociation() {
+    // tracks x clusters.  MHT stops at 100 tracks: its hypothesis tree over
+    // the 1000-track scene takes tens of seconds a dwell.
+    const std::vector<std::vector<int64_t>> sizes    = {{10, 10}, {100, 100}, {100, 1000}, {1000, 1000}};
+    const std::vector<std::vector<int64_t>> mhtSizes = {{10, 10}, {100, 100}, {100, 1000}};
+    const AssociationConfig& a = g_cfg.association;
+    const std::pair<const char*, std::function<std::unique_ptr<IAssociator>()>> methods[] = {
+        {"mahalanobis", [a] { return std::make_unique<MahalanobisAssociator>(a.mahalanobis, a.gatingThreshold); }},
+        {"gnn",         [a] { return std::make_unique<GNNAssociator>(a.gnn, a.gatingThreshold); }},
+        {"jpda",        [a] { return std::make_unique<JPDAAssociator>(a.jpda, a.gatingThreshold); }},
+        {"mht",         [a] { return std::make_unique<MHTAssociator>(a.mht, a.gatingThreshold); }},
+    };
+    for (const auto& method : methods) {
+        auto make = method.second;
+        add(std::string("assoc/") + method.first, [make](BenchState& s) {
+            std::unique_ptr<IAssociator> associator = make();
+            std::vector<InnovationStats> tracks;
+            std::vector<Cluster> clusters;
+            makeScene(static_cast<size_t>(s.range(0)), static_cast<size_t>(s.range(1)), 6,
+                      tracks, clusters);
+            std::vector<uint32_t> ids(tracks.size());
+            for (size_t i = 0; i < ids.size(); ++i) ids[i] = static_cast<uint32_t>(i + 1);
+            const std::vector<MeasMatrix> R(ids.size(), measurementNoise());
+            AssociationOutput out;
+            while (s.keepRunning()) {
+                associator->setDwellContext(ids, R);
+                associator->associate(tracks, clusters, out);
+                doNotOptimize(out);
+            }
+            s.counters["matched"] = static_cast<double>(out.matched.size());
+        }, std::string(method.first) == "mht" ? mhtSizes : sizes);
+    }
+}
+
+// A dwell sequence of clusters per dwell: a tenth steady targets (so some
+// candidates qualify), the rest fresh clutter, every cluster unmatched.
+void registerInitiation() {
+    add("initiator/processCandidates", [](BenchState& s) {
+        const size_t n = static_cast<size_t>(s.range(0));
+        const int DWELLS = 64;
+        std::mt19937_64 rng(7);
+        std::vector<std::vector<Cluster>> dwells(DWELLS);
+        std::vector<Cluster> targets;
+        for (size_t t = 0; t < n / 10; ++t)
+            targets.push_back(clusterAt(uniform(rng, 1000.0, 12000.0), uniform(rng, -M_PI, M_PI),
+                                        uniform(rng, 0.0, 0.3), uniform(rng, 15.0, 40.0)));
+        for (auto& dwell : dwells) {
+            for (const Cluster& t : targets)
+                dwell.push_back(clusterAt(t.range + uniform(rng, -5.0, 5.0), t.azimuth,
+                                          t.elevation, t.snr));
+            while (dwell.size() < n)
+                dwell.push_back(clusterAt(uniform(rng, 500.0, 15000.0), uniform(rng, -M_PI, M_PI),
+                                          uniform(rng, 0.0, 0.3), uniform(rng, 10.0, 20.0)));
+        }
+        std::vector<int> unmatched(n);
+        for (size_t i = 0; i < n; ++i) unmatched[i] = static_cast<int>(i);
+
+        const TrackManagementConfig& tmc = g_cfg.trackManagement;
+        TrackInitiator initiator(tmc.initiation, tmc.initialCovariance, g_cfg.prediction);
+        std::vector<Track> newTracks;
+        uint32_t dwell = 0;
+        uint64_t initiated = 0;
+        while (s.keepRunning()) {
+            ++dwell;
+            initiator.processCandidates(dwells[dwell % DWELLS], unmatched,
+                                        static_cast<Timestamp>(dwell) * 100000, dwell, newTracks);
+            initiator.purgeStaleCandidates(dwell);
+            initiated += newTracks.size();
+        }
+        s.setItemsPerIteration(static_cast<double>(n));
+        s.counters["candidates"] = static_cast<double>(initiator.numCandidates());
+        s.counters["initiated_per_dwell"] = dwell > 0 ? static_cast<double>(initiated) / dwell : 0.0;
+    }, {{100}, {1000}});
+}
+
+// Producer-side cost of a log* call: serialization into the ring.  Records
+// go in batches of a quarter of the ring; between batches the clock is
+// paused and the log closed (draining the ring) and reopened, so no record
+// is dropped and the drop path is never what gets timed.
+void registerLogger() {
+    using Writer = std::function<void(BinaryLogger&, uint64_t)>;
+    auto withLogger = [](size_t recordBytes, std::function<Writer()> makeWriter) {
+        return [recordBytes, makeWriter](BenchState& s) {
+            LogOptions options;
+            options.ringBytes    = size_t(64) << 20;
+            options.combinedText = CombinedTextMode::Offline;
+            options.blockBytes   = s.range(0) ? 1024 * 1024 : 0;
+            const uint64_t batch = options.ringBytes / 4 / (recordBytes + 64);
+            const Writer   write = makeWriter();
+
+            BinaryLogger logger;
+            uint64_t dropped = 0;
+            auto reopen = [&]() {
+                if (logger.isOpen()) {
+                    logger.close();
+                    dropped += logger.droppedRecords();
+                    std::remove(logger.getLogPath().c_str());
+                }
+                return logger.open(g_cfg.system.logDirectory, "cuas_bench", std::string(), options);
+            };
+            if (!reopen()) {
+                std::cerr << "ERROR: cannot open a log in " << g_cfg.system.logDirectory << std::endl;
+                while (s.keepRunning()) {}
+                return;
+            }
+            uint64_t i = 0;
+            while (s.keepRunning()) {
+                write(logger, ++i);
+                if (i % batch == 0) {
+                    s.pauseTiming();
+                    reopen();
+                    s.resumeTiming();
+                }
+            }
+            logger.close();
+            dropped += logger.droppedRecords();
+            std::remove(logger.getLogPath().c_str());
+            s.setItemsPerIteration(1.0);
+            s.counters["dropped"] = static_cast<double>(dropped);
+        };
+    };
+    const std::vector<std::vector<int64_t>> versions = {{0}, {1}};   // v1, v2 (LZ4 blocks)
+
+    add("logger/rawDetections", withLogger(20 + 100 * sizeof(Detection), []() -> Writer {
+        auto msg = std::make_shared<SPDetectionMessage>();
+        msg->detections    = makeDetections(100, 8);
+        msg->numDetections = static_cast<uint32_t>(msg->detections.size());
+        return [msg](BinaryLogger& logger, uint64_t i) {
+            msg->dwellCount = static_cast<uint32_t>(i);
+            logger.logRawDetections(i, *msg);
+        };
+    }), versions);
+    add("logger/clustered", withLogger(4 + 20 * 120, []() -> Writer {
+        auto clusters = std::make_shared<std::vector<Cluster>>();
+        for (uint32_t c = 0; c < 20; ++c) {
+            clusters->push_back(clusterAt(1000.0 + 100.0 * c, 0.01 * c, 0.05, 20.0));
+            clusters->back().clusterId = c + 1;
+            clusters->back().detectionIndices = {c * 5, c * 5 + 1, c * 5 + 2};
+        }
+        return [clusters](BinaryLogger& logger, uint64_t i) { logger.logClustered(i, *clusters); };
+    }), versions);
+    add("logger/trackUpdated", withLogger(4 + sizeof(StateVector) + 4, []() -> Writer {
+        std::mt19937_64 rng(9);
+        const StateVector x = randomState(rng);
+        return [x](BinaryLogger& logger, uint64_t i) {
+            logger.logTrackUpdated(i, 1001, x, TrackStatus::TRACK_CONFIRMED);
+        };
+    }), versions);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string filter     = ".";
+    double      minTime    = 0.5;
+    bool        json       = false;
+    bool        list       = false;
+    std::string outPath;
+    std::string configPath = "config/tracker_config.json";
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&](const char* flag, std::string& out) {
+            const std::string prefix = std::string(flag) + "=";
+            if (arg.compare(0, prefix.size(), prefix) != 0) return false;
+            out = arg.substr(prefix.size());
+            return true;
+        };
+        std::string v;
+        if (value("--benchmark_filter", v))             filter = v;
+        else if (value("--benchmark_min_time", v))      minTime = std::stod(v);   // "0.5" or "0.5s"
+        else if (value("--benchmark_format", v))        json = v == "json";
+        else if (value("--benchmark_out", v))           outPath = v;
+        else if (value("--benchmark_out_format", v))    { /* json only */ }
+        else if (value("--config", v))                  configPath = v;
+        else if (arg == "--benchmark_list_tests")       list = true;
+        else {
+            std::cerr << "Counter-UAS Radar Tracker - Microbenchmarks" << std::endl;
+            std::cerr << std::endl;
+            std::cerr << "Usage: " << argv[0] << " [options]" << std::endl;
+            std::cerr << "  --benchmark_filter=REGEX   Run the benchmarks whose name matches" << std::endl;
+            std::cerr << "  --benchmark_min_time=SEC   Minimum time per benchmark (default 0.5)" << std::endl;
+            std::cerr << "  --benchmark_format=FMT     console or json" << std::endl;
+            std::cerr << "  --benchmark_out=FILE       Also write the JSON report to FILE" << std::endl;
+            std::cerr << "  --benchmark_list_tests     List the benchmarks and exit" << std::endl;
+            std::cerr << "  --config=FILE              tracker_config.json (default: config/tracker_config.json)" << std::endl;
+            std::cerr << std::endl;
+            std::cerr << "Example:" << std::endl;
+            std::cerr << "  " << argv[0] << " --benchmark_filter='^assoc/gnn' --benchmark_out=gnn.json" << std::endl;
+            return 1;
+        }
+    }
+
+    ConsoleLogger::instance().setLevel(ConsoleLogger::WARN);
+    g_cfg = loadConfig(configPath);
+
+    registerMatrixOps();
+    registerPrediction();
+    registerClustering();
+    registerAssociation();
+    registerInitiation();
+    registerLogger();
+
+    std::regex pattern;
+    try {
+        pattern = std::regex(filter);
+    } catch (const std::regex_error&) {
+        std::cerr << "ERROR: bad --benchmark_filter: " << filter << std::endl;
+        return 1;
+    }
+    std::vector<const Benchmark*> selected;
+    for (const Benchmark& b : registry())
+        if (std::regex_search(b.name, pattern)) selected.push_back(&b);
+    if (list) {
+        for (const Benchmark* b : selected) std::cout << b->name << std::endl;
+        return 0;
+    }
+    if (selected.empty()) {
+        std::cerr << "ERROR: no benchmark matches " << filter << std::endl;
+        return 1;
+    }
+
+    if (!json) {
+        std::cout << "Kernels: " << mat::kernelIsa() << ", " << std::thread::hardware_concurrency()
+                  << " CPUs" << std::endl;
+        char header[160];
+        std::snprintf(header, sizeof(header), "%-44s %17s %17s %12s",
+                      "Benchmark", "Time", "CPU", "Iterations");
+        std::cout << header << std::endl << std::string(92, '-') << std::endl;
+    }
+    std::vector<BenchResult> results;
+    for (const Benchmark* b : selected) {
+        results.push_back(run(*b, minTime));
+        if (!json) printRow(results.back());
+    }
+
+    if (json) writeJson(std::cout, results, argv[0]);
+    if (!outPath.empty()) {
+        std::ofstream out(outPath);
+        if (!out) {
+            std::cerr << "ERROR: cannot write " << outPath << std::endl;
+            return 1;
+        }
+        writeJson(out, results, argv[0]);
+    }
+    return 0;
+}
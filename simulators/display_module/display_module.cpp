@@ -2,8 +2,9 @@
  * Display Module Simulator  —  Multi-Mode Radar Display
  *
  * Subscribes to all DDS topics published by the tracker (domain 0):
- *   "SPDetection"    — raw dwell detections
+ *   "SPDetectionDisplay" — raw dwell detections (tracker display.rawDetectionEvery)
  *   "TrackTable"     — confirmed/active track batch
+ *   "TrackUpdate"    — per-track keyed instances (tracker display.deltaPublish)
  *   "ClusterTable"   — post-clustering debug
  *   "AssocTable"     — association debug
  *   "PredictedTable" — prediction debug
@@ -11,14 +12,24 @@
  * All types are IDL-generated (CounterUAS namespace).  No hand-written
  * deserialization code exists here.
  *
+ * Track samples carry the LatencyTrace of the dwell they came from; the
+ * Latency view histograms track age (DSP timestamp to display) and each
+ * hop of the tracker.  Cross-host figures need synced clocks.
+ *
+ * Listeners hand each topic's latest frame to the render loop through a
+ * triple buffer, so neither side waits on or copies the other's data.
+ * Track history is kept per track for HISTORY_LEN samples and dropped
+ * when the tracker deletes the track.
+ *
  * Keyboard: 1=RawDets 2=Clusters 3=Assoc 4=Predicted 5=Tracks
- *           6=TrkFilter 7=PPI 8=BScope 9=CScope 0=TimeSeries Q=Quit
+ *           6=TrkFilter 7=PPI 8=BScope 9=CScope 0=TimeSeries L=Latency Q=Quit
  */
 
 #include "common/types.h"
 #include "common/dds_participant.h"
 #include "common/constants.h"
 #include "common/logger.h"
+#include "common/latency_histogram.h"
 
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
 #include <fastdds/dds/subscriber/DataReader.hpp>
@@ -37,6 +48,7 @@
 #include <atomic>
 #include <cmath>
 #include <mutex>
+#include <cstdio>
 #include <cstring>
 #include <limits>
 
@@ -56,7 +68,7 @@ void signalHandler(int) { g_running.store(false); }
 // ---------------------------------------------------------------------------
 enum class DisplayMode {
     RawDetections = 0, Clusters, Association, Predicted,
-    AllTracks, TrackFilter, PPI, BScope, CScope, TimeSeries
+    AllTracks, TrackFilter, PPI, BScope, CScope, TimeSeries, Latency
 };
 
 static const char* modeName(DisplayMode m) {
@@ -71,56 +83,182 @@ static const char* modeName(DisplayMode m) {
         case DisplayMode::BScope:        return "B-Scope (Rng vs Az)";
         case DisplayMode::CScope:        return "C-Scope (Az vs El)";
         case DisplayMode::TimeSeries:    return "Time Series";
+        case DisplayMode::Latency:       return "Latency";
         default: return "?";
     }
 }
 
 static constexpr int HISTORY_LEN = 80;
+// No sensor: a TrackUpdate (delta mode) instance, which carries no sensorId
+// and is only forgotten when disposed.
+static constexpr uint32_t NO_SENSOR = 0xFFFFFFFFu;
 struct TrackHistory {
     std::deque<double> range, azimuthDeg, elevationDeg, rangeRate, quality;
+    uint32_t sensorId = NO_SENSOR;   // TrackTable face that last reported it
+};
+
+// ---------------------------------------------------------------------------
+// TripleBuffer — one producer hands frames to one consumer without either
+// waiting for the other.  The producer fills back() and publish()es it,
+// which trades it for the middle slot; the consumer's acquire() trades its
+// front() for the middle slot if a newer frame is there.  A frame the
+// consumer never acquired is simply reused.  Slots are recycled, so their
+// vectors keep their capacity.
+// ---------------------------------------------------------------------------
+template <typename T>
+class TripleBuffer {
+public:
+    T&       back()        { return slots_[back_]; }
+    const T& front() const { return slots_[front_]; }
+
+    void publish() {
+        back_ = middle_.exchange(back_ | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+    // True if front() now holds a newer frame.
+    bool acquire() {
+        if (!(middle_.load(std::memory_order_relaxed) & FRESH)) return false;
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+private:
+    static constexpr unsigned INDEX = 3u;
+    static constexpr unsigned FRESH = 4u;
+    T                     slots_[3];
+    unsigned              back_   = 0;   // producer only
+    unsigned              front_  = 1;   // consumer only
+    std::atomic<unsigned> middle_{2};
+};
+
+struct ClusterFrame {
+    std::vector<CounterUAS::ClusterData> clusters;
+    uint32_t                             dwellCount = 0;
 };
 
 // ---------------------------------------------------------------------------
-// Global state — updated by DDS listeners, read by the render loop.
-// Protected by g_mutex.
+// Global state.  Each topic's listener publishes frames through its
+// TripleBuffer; the render loop reads the fronts without a lock.  The
+// three track listeners (TrackTable, TrackTableFrame, TrackUpdate) share
+// one buffer, so they take g_trackMutex among themselves; it also guards
+// the track history and latency trace, which the render loop copies only
+// for the tracks it shows.
 // ---------------------------------------------------------------------------
-static std::mutex g_mutex;
+static TripleBuffer<CounterUAS::SPDetectionMessage>              g_dets;
+static TripleBuffer<ClusterFrame>                                g_clusters;
+static TripleBuffer<std::vector<CounterUAS::AssocEntry>>         g_assoc;
+static TripleBuffer<std::vector<CounterUAS::PredictedEntry>>     g_predicted;
+static TripleBuffer<std::vector<CounterUAS::TrackUpdateMessage>> g_tracks;
 
-static CounterUAS::SPDetectionMessage              g_latestDets;
-static std::vector<CounterUAS::ClusterData>        g_latestClusters;
-static std::vector<CounterUAS::AssocEntry>         g_latestAssoc;
-static std::vector<CounterUAS::PredictedEntry>     g_latestPredicted;
-static std::vector<CounterUAS::TrackUpdateMessage> g_latestTracks;
+static std::atomic<uint64_t> g_detMsgCount{0};
+static std::atomic<uint64_t> g_clusterMsgCount{0};
+static std::atomic<uint64_t> g_assocMsgCount{0};
+static std::atomic<uint64_t> g_predMsgCount{0};
+static std::atomic<uint64_t> g_trackMsgCount{0};
 
-static uint64_t g_detMsgCount     = 0;
-static uint64_t g_clusterMsgCount = 0;
-static uint64_t g_assocMsgCount   = 0;
-static uint64_t g_predMsgCount    = 0;
-static uint64_t g_trackMsgCount   = 0;
-static uint32_t g_lastDwellCount  = 0;
+static std::mutex g_trackMutex;
+// Delta mode: live instances by trackId; the track frame is rebuilt from it.
+static std::map<uint32_t, CounterUAS::TrackUpdateMessage> g_deltaTracks;
+static std::map<uint32_t, TrackHistory> g_trackHistory;
 
+// Keyboard state: main thread only.
 static DisplayMode g_mode            = DisplayMode::AllTracks;
 static uint32_t    g_filterTrackId   = 0;
 static bool        g_filterInputMode = false;
 static std::string g_filterInput;
 
-static std::map<uint32_t, TrackHistory> g_trackHistory;
+// Latency view: one histogram per LatencyTrace interval, per track sample
+// (per table in TrackTable mode).
+enum LatencySpan {
+    SPAN_AGE = 0,     // sensorTime    -> display
+    SPAN_TRACKER,     // receiveTime   -> display
+    SPAN_QUEUE,       // receiveTime   -> dequeueTime
+    SPAN_PROCESS,     // dequeueTime   -> processedTime
+    SPAN_PUBLISH,     // processedTime -> publishTime
+    SPAN_TRANSPORT,   // publishTime   -> display
+    NUM_SPANS
+};
+static const char* const kSpanNames[NUM_SPANS] = {
+    "age (sensor->display)", "tracker->display", "ingest queue",
+    "processing", "publish", "DDS transport"
+};
+static cuas::LatencyHistogram g_latency[NUM_SPANS];
+static uint64_t g_latencyUntraced = 0;   // samples from a tracker without tracing
+static uint64_t g_latencySkewed   = 0;   // intervals < 0: clocks out of sync
+static CounterUAS::LatencyTrace g_lastTrace;
+
+// Caller holds g_trackMutex.  A DELETED sample ends the track's history.
+static void recordHistory(const CounterUAS::TrackUpdateMessage& t,
+                          uint32_t sensorId = NO_SENSOR) {
+    if (t.status() == CounterUAS::TRACK_DELETED) {
+        g_trackHistory.erase(t.trackId());
+        return;
+    }
+    auto& h = g_trackHistory[t.trackId()];
+    h.sensorId = sensorId;
+    h.range.push_back(t.range());
+    h.azimuthDeg.push_back(t.azimuth() * cuas::RAD2DEG);
+    h.elevationDeg.push_back(t.elevation() * cuas::RAD2DEG);
+    h.rangeRate.push_back(t.rangeRate());
+    h.quality.push_back(t.trackQuality());
+    if ((int)h.range.size()        > HISTORY_LEN) h.range.pop_front();
+    if ((int)h.azimuthDeg.size()   > HISTORY_LEN) h.azimuthDeg.pop_front();
+    if ((int)h.elevationDeg.size() > HISTORY_LEN) h.elevationDeg.pop_front();
+    if ((int)h.rangeRate.size()    > HISTORY_LEN) h.rangeRate.pop_front();
+    if ((int)h.quality.size()      > HISTORY_LEN) h.quality.pop_front();
+}
+
+// Caller holds g_trackMutex.  A TrackTable lists every live track of its
+// face, so that face's tracks missing from it have been dropped.
+static void recordTable(const std::vector<CounterUAS::TrackUpdateMessage>& tracks,
+                        uint32_t sensorId) {
+    static std::vector<uint32_t> listed;     // under g_trackMutex
+    listed.clear();
+    for (const auto& t : tracks) {
+        recordHistory(t, sensorId);
+        listed.push_back(t.trackId());
+    }
+    std::sort(listed.begin(), listed.end());
+    for (auto it = g_trackHistory.begin(); it != g_trackHistory.end();) {
+        if (it->second.sensorId == sensorId &&
+            !std::binary_search(listed.begin(), listed.end(), it->first))
+            it = g_trackHistory.erase(it);
+        else
+            ++it;
+    }
+}
+
+// Caller holds g_trackMutex.
+static void recordLatency(const CounterUAS::LatencyTrace& tr) {
+    if (tr.publishTime() == 0) { ++g_latencyUntraced; return; }
+    const uint64_t now = cuas::nowMicros();
+    auto span = [](LatencySpan s, uint64_t from, uint64_t to) {
+        if (from == 0) return;
+        if (to < from) { ++g_latencySkewed; return; }
+        g_latency[s].record((to - from) * 1000);
+    };
+    span(SPAN_AGE,       tr.sensorTime(),    now);
+    span(SPAN_TRACKER,   tr.receiveTime(),   now);
+    span(SPAN_QUEUE,     tr.receiveTime(),   tr.dequeueTime());
+    span(SPAN_PROCESS,   tr.dequeueTime(),   tr.processedTime());
+    span(SPAN_PUBLISH,   tr.processedTime(), tr.publishTime());
+    span(SPAN_TRANSPORT, tr.publishTime(),   now);
+    g_lastTrace = tr;
+}
 
 // ---------------------------------------------------------------------------
-// DDS listeners — one per topic
+// DDS listeners — one per topic.  Samples are taken straight into the
+// buffer's back slot (or swapped into it), so nothing is deep-copied.
 // ---------------------------------------------------------------------------
 class SPDetectionListener
     : public eprosima::fastdds::dds::DataReaderListener {
 public:
     void on_data_available(
             eprosima::fastdds::dds::DataReader* reader) override {
-        CounterUAS::SPDetectionMessage msg;
         eprosima::fastdds::dds::SampleInfo info;
         while (eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK ==
-               reader->take_next_sample(&msg, &info)) {
+               reader->take_next_sample(&g_dets.back(), &info)) {
             if (!info.valid_data) continue;
-            std::lock_guard<std::mutex> lk(g_mutex);
-            g_latestDets = msg;
+            g_dets.publish();
             ++g_detMsgCount;
         }
     }
@@ -131,28 +269,81 @@ class TrackTableListener
 public:
     void on_data_available(
             eprosima::fastdds::dds::DataReader* reader) override {
-        CounterUAS::TrackTableMessage msg;
         eprosima::fastdds::dds::SampleInfo info;
         while (eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK ==
-               reader->take_next_sample(&msg, &info)) {
+               reader->take_next_sample(&msg_, &info)) {
             if (!info.valid_data) continue;
-            std::lock_guard<std::mutex> lk(g_mutex);
-            g_latestTracks = msg.tracks();
+            std::lock_guard<std::mutex> lk(g_trackMutex);
+            auto& tracks = g_tracks.back();
+            std::swap(tracks, msg_.tracks());
+            recordTable(tracks, msg_.sensorId());
+            recordLatency(msg_.trace());
+            g_tracks.publish();
             ++g_trackMsgCount;
-            for (const auto& t : g_latestTracks) {
-                auto& h = g_trackHistory[t.trackId()];
-                h.range.push_back(t.range());
-                h.azimuthDeg.push_back(t.azimuth() * cuas::RAD2DEG);
-                h.elevationDeg.push_back(t.elevation() * cuas::RAD2DEG);
-                h.rangeRate.push_back(t.rangeRate());
-                h.quality.push_back(t.trackQuality());
-                if ((int)h.range.size()        > HISTORY_LEN) h.range.pop_front();
-                if ((int)h.azimuthDeg.size()   > HISTORY_LEN) h.azimuthDeg.pop_front();
-                if ((int)h.elevationDeg.size() > HISTORY_LEN) h.elevationDeg.pop_front();
-                if ((int)h.rangeRate.size()    > HISTORY_LEN) h.rangeRate.pop_front();
-                if ((int)h.quality.size()      > HISTORY_LEN) h.quality.pop_front();
+        }
+    }
+private:
+    CounterUAS::TrackTableMessage msg_;   // its tracks vector is recycled
+};
+
+// TrackTable sent as a plain frame (tracker network.dds.zeroCopy), read
+// in place through loans.
+class TrackTableFrameListener
+    : public eprosima::fastdds::dds::DataReaderListener {
+public:
+    void on_data_available(
+            eprosima::fastdds::dds::DataReader* reader) override {
+        cuas::takeLoaned<CounterUAS::TrackTableFrame>(reader,
+            [](const CounterUAS::TrackTableFrame& frame,
+               const eprosima::fastdds::dds::SampleInfo&) {
+                const uint32_t n = std::min(frame.numTracks(), CounterUAS::FRAME_MAX_TRACKS);
+                std::lock_guard<std::mutex> lk(g_trackMutex);
+                auto& tracks = g_tracks.back();
+                tracks.clear();
+                for (uint32_t i = 0; i < n; ++i)
+                    tracks.push_back(cuas::toTrackUpdate(frame.tracks()[i], frame.trace()));
+                recordTable(tracks, frame.sensorId());
+                recordLatency(frame.trace());
+                g_tracks.publish();
+                ++g_trackMsgCount;
+            });
+    }
+};
+
+class TrackUpdateListener
+    : public eprosima::fastdds::dds::DataReaderListener {
+public:
+    void on_data_available(
+            eprosima::fastdds::dds::DataReader* reader) override {
+        CounterUAS::TrackUpdateMessage msg;
+        eprosima::fastdds::dds::SampleInfo info;
+        std::lock_guard<std::mutex> lk(g_trackMutex);
+        bool changed = false;
+        while (eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK ==
+               reader->take_next_sample(&msg, &info)) {
+            if (!info.valid_data) {
+                // Disposed: the tracker dropped this track.
+                if (info.instance_state ==
+                        eprosima::fastdds::dds::NOT_ALIVE_DISPOSED_INSTANCE_STATE &&
+                    reader->get_key_value(&msg, info.instance_handle) ==
+                        eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK) {
+                    g_deltaTracks.erase(msg.trackId());
+                    g_trackHistory.erase(msg.trackId());
+                    changed = true;
+                }
+            } else {
+                g_deltaTracks[msg.trackId()] = msg;
+                recordHistory(msg);
+                recordLatency(msg.trace());
+                ++g_trackMsgCount;
+                changed = true;
             }
         }
+        if (!changed) return;
+        auto& tracks = g_tracks.back();
+        tracks.clear();
+        for (const auto& kv : g_deltaTracks) tracks.push_back(kv.second);
+        g_tracks.publish();
     }
 };
 
@@ -161,17 +352,19 @@ class ClusterTableListener
 public:
     void on_data_available(
             eprosima::fastdds::dds::DataReader* reader) override {
-        CounterUAS::ClusterTableMessage msg;
         eprosima::fastdds::dds::SampleInfo info;
         while (eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK ==
-               reader->take_next_sample(&msg, &info)) {
+               reader->take_next_sample(&msg_, &info)) {
             if (!info.valid_data) continue;
-            std::lock_guard<std::mutex> lk(g_mutex);
-            g_latestClusters = msg.clusters();
-            g_lastDwellCount = msg.dwellCount();
+            ClusterFrame& f = g_clusters.back();
+            std::swap(f.clusters, msg_.clusters());
+            f.dwellCount = msg_.dwellCount();
+            g_clusters.publish();
             ++g_clusterMsgCount;
         }
     }
+private:
+    CounterUAS::ClusterTableMessage msg_;
 };
 
 class AssocTableListener
@@ -179,16 +372,17 @@ class AssocTableListener
 public:
     void on_data_available(
             eprosima::fastdds::dds::DataReader* reader) override {
-        CounterUAS::AssocTableMessage msg;
         eprosima::fastdds::dds::SampleInfo info;
         while (eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK ==
-               reader->take_next_sample(&msg, &info)) {
+               reader->take_next_sample(&msg_, &info)) {
             if (!info.valid_data) continue;
-            std::lock_guard<std::mutex> lk(g_mutex);
-            g_latestAssoc = msg.entries();
+            std::swap(g_assoc.back(), msg_.entries());
+            g_assoc.publish();
             ++g_assocMsgCount;
         }
     }
+private:
+    CounterUAS::AssocTableMessage msg_;
 };
 
 class PredictedTableListener
@@ -196,16 +390,17 @@ class PredictedTableListener
 public:
     void on_data_available(
             eprosima::fastdds::dds::DataReader* reader) override {
-        CounterUAS::PredictedTableMessage msg;
         eprosima::fastdds::dds::SampleInfo info;
         while (eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK ==
-               reader->take_next_sample(&msg, &info)) {
+               reader->take_next_sample(&msg_, &info)) {
             if (!info.valid_data) continue;
-            std::lock_guard<std::mutex> lk(g_mutex);
-            g_latestPredicted = msg.entries();
+            std::swap(g_predicted.back(), msg_.entries());
+            g_predicted.publish();
             ++g_predMsgCount;
         }
     }
+private:
+    CounterUAS::PredictedTableMessage msg_;
 };
 
 // ---------------------------------------------------------------------------
@@ -311,7 +506,7 @@ static void printTimeSeries(const std::string& label,
 }
 
 // ---------------------------------------------------------------------------
-// Render functions — all access global state under g_mutex snapshot
+// Render functions — all take the frames they draw by reference
 // ---------------------------------------------------------------------------
 static void printModeBar(DisplayMode mode, const std::string& extra = "") {
     std::cout << "\033[2J\033[H";
@@ -319,7 +514,7 @@ static void printModeBar(DisplayMode mode, const std::string& extra = "") {
               << "  |  [" << modeName(mode) << "]"
               << (extra.empty() ? "" : "  " + extra) << " ===\n";
     std::cout << " 1=RawDets  2=Clusters  3=Assoc  4=Predicted  5=Tracks"
-                 "  6=TrkFilter  7=PPI  8=BScope  9=CScope  0=TimeSeries  Q=Quit\n";
+                 "  6=TrkFilter  7=PPI  8=BScope  9=CScope  0=TimeSeries  L=Latency  Q=Quit\n";
     std::cout << std::string(82, '-') << "\n";
 }
 
@@ -651,17 +846,13 @@ static void renderCScope(
     printGrid(grid);
 }
 
+// `hist` holds only the tracks to plot; `histTotal` is how many have history.
 static void renderTimeSeries(
-        const std::map<uint32_t, TrackHistory>& hist,
-        const std::vector<CounterUAS::TrackUpdateMessage>& tracks) {
+        const std::vector<uint32_t>& ids,
+        const std::map<uint32_t, TrackHistory>& hist, size_t histTotal) {
     printModeBar(DisplayMode::TimeSeries,
                  "Time Series  last " + std::to_string(HISTORY_LEN) + " samples");
-    if (hist.empty()) { std::cout << "  (no track history yet)\n"; return; }
-    std::vector<uint32_t> ids;
-    for (const auto& t : tracks)
-        if (t.status() == CounterUAS::TRACK_CONFIRMED) ids.push_back(t.trackId());
-    if (ids.empty()) for (const auto& kv : hist) ids.push_back(kv.first);
-    if (ids.size() > 3) ids.resize(3);
+    if (histTotal == 0) { std::cout << "  (no track history yet)\n"; return; }
     for (uint32_t tid : ids) {
         auto it = hist.find(tid);
         if (it == hist.end()) continue;
@@ -672,61 +863,97 @@ static void renderTimeSeries(
         printTimeSeries("El (deg)",   h.elevationDeg, PLOT_W, 3);
         printTimeSeries("Rdot (m/s)", h.rangeRate,    PLOT_W, 3);
     }
-    if (ids.size() < hist.size())
-        std::cout << "  (showing " << ids.size() << "/" << hist.size()
+    if (ids.size() < histTotal)
+        std::cout << "  (showing " << ids.size() << "/" << histTotal
                   << " tracks — use Track Filter [6] for details)\n";
 }
 
 // ---------------------------------------------------------------------------
-// Render dispatcher — takes a snapshot of global state under mutex
+static void renderLatency() {
+    CounterUAS::LatencyTrace last;
+    uint64_t untraced, skewed;
+    {
+        std::lock_guard<std::mutex> lk(g_trackMutex);
+        last     = g_lastTrace;
+        untraced = g_latencyUntraced;
+        skewed   = g_latencySkewed;
+    }
+    printModeBar(DisplayMode::Latency, "Last dwell:" + std::to_string(last.dwellCount()));
+    std::cout << "  Interval (ms)              count       p50       p99     p99.9       max\n"
+              << std::string(82, '-') << "\n";
+    for (int i = 0; i < NUM_SPANS; ++i) {
+        const cuas::LatencySummary l = g_latency[i].summary();
+        char line[128];
+        std::snprintf(line, sizeof(line), "  %-22s %10lu %9.2f %9.2f %9.2f %9.2f\n",
+                      kSpanNames[i], static_cast<unsigned long>(l.count),
+                      l.p50Us / 1000.0, l.p99Us / 1000.0, l.p999Us / 1000.0, l.maxUs / 1000.0);
+        std::cout << line;
+    }
+    std::cout << std::string(82, '-') << "\n";
+    std::cout << "Untraced samples: " << untraced << "   Negative intervals (clock skew): "
+              << skewed << "\n";
+    if (last.publishTime() != 0) {
+        const uint64_t now = cuas::nowMicros();
+        std::cout << "Last trace: dwell " << last.dwellCount()
+                  << "  age " << std::fixed << std::setprecision(2)
+                  << (now > last.sensorTime() ? (now - last.sensorTime()) / 1000.0 : 0.0)
+                  << " ms at render\n";
+    }
+}
+
+// Render dispatcher — reads the latest frame of each topic in place
 // ---------------------------------------------------------------------------
+static constexpr size_t TIME_SERIES_TRACKS = 3;
+
 static void render() {
-    // Snapshot the state to avoid holding the mutex during rendering.
-    CounterUAS::SPDetectionMessage              dets;
-    std::vector<CounterUAS::ClusterData>        clusters;
-    std::vector<CounterUAS::AssocEntry>         assoc;
-    std::vector<CounterUAS::PredictedEntry>     preds;
-    std::vector<CounterUAS::TrackUpdateMessage> tracks;
-    std::map<uint32_t, TrackHistory>            hist;
-    uint64_t detM=0, clM=0, asM=0, prM=0, trM=0;
-    uint32_t dwellCnt=0;
-    DisplayMode mode;
-    uint32_t filterId;
-    bool filterInput;
-    std::string filterBuf;
+    g_dets.acquire();
+    g_clusters.acquire();
+    g_assoc.acquire();
+    g_predicted.acquire();
+    g_tracks.acquire();
+    const CounterUAS::SPDetectionMessage&              dets   = g_dets.front();
+    const ClusterFrame&                                cl     = g_clusters.front();
+    const std::vector<CounterUAS::TrackUpdateMessage>& tracks = g_tracks.front();
 
-    {
-        std::lock_guard<std::mutex> lk(g_mutex);
-        dets     = g_latestDets;
-        clusters = g_latestClusters;
-        assoc    = g_latestAssoc;
-        preds    = g_latestPredicted;
-        tracks   = g_latestTracks;
-        hist     = g_trackHistory;
-        detM     = g_detMsgCount;
-        clM      = g_clusterMsgCount;
-        asM      = g_assocMsgCount;
-        prM      = g_predMsgCount;
-        trM      = g_trackMsgCount;
-        dwellCnt = g_lastDwellCount;
-        mode        = g_mode;
-        filterId    = g_filterTrackId;
-        filterInput = g_filterInputMode;
-        filterBuf   = g_filterInput;
-    }
-
-    switch (mode) {
-        case DisplayMode::RawDetections: renderRawDetections(dets, detM);              break;
-        case DisplayMode::Clusters:      renderClusters(clusters, dwellCnt, clM);      break;
-        case DisplayMode::Association:   renderAssociation(assoc, asM);                break;
-        case DisplayMode::Predicted:     renderPredicted(preds, prM);                  break;
-        case DisplayMode::AllTracks:     renderAllTracks(tracks, trM);                 break;
+    // History is copied only for the tracks this mode plots.
+    std::vector<uint32_t>            ids;
+    std::map<uint32_t, TrackHistory> hist;
+    size_t                           histTotal = 0;
+    if (g_mode == DisplayMode::TrackFilter && !g_filterInputMode) {
+        ids.push_back(g_filterTrackId);
+    } else if (g_mode == DisplayMode::TimeSeries) {
+        for (const auto& t : tracks)
+            if (t.status() == CounterUAS::TRACK_CONFIRMED) ids.push_back(t.trackId());
+    }
+    if (!ids.empty() || g_mode == DisplayMode::TimeSeries) {
+        std::lock_guard<std::mutex> lk(g_trackMutex);
+        histTotal = g_trackHistory.size();
+        if (ids.empty())
+            for (const auto& kv : g_trackHistory) {
+                if (ids.size() == TIME_SERIES_TRACKS) break;
+                ids.push_back(kv.first);
+            }
+        if (ids.size() > TIME_SERIES_TRACKS) ids.resize(TIME_SERIES_TRACKS);
+        for (uint32_t tid : ids) {
+            auto it = g_trackHistory.find(tid);
+            if (it != g_trackHistory.end()) hist.emplace(tid, it->second);
+        }
+    }
+
+    switch (g_mode) {
+        case DisplayMode::RawDetections: renderRawDetections(dets, g_detMsgCount);    break;
+        case DisplayMode::Clusters:
+            renderClusters(cl.clusters, cl.dwellCount, g_clusterMsgCount);            break;
+        case DisplayMode::Association:   renderAssociation(g_assoc.front(), g_assocMsgCount); break;
+        case DisplayMode::Predicted:     renderPredicted(g_predicted.front(), g_predMsgCount); break;
+        case DisplayMode::AllTracks:     renderAllTracks(tracks, g_trackMsgCount);     break;
         case DisplayMode::TrackFilter:
-            renderTrackFilter(tracks, hist, filterId, filterInput, filterBuf);          break;
+            renderTrackFilter(tracks, hist, g_filterTrackId, g_filterInputMode, g_filterInput); break;
         case DisplayMode::PPI:           renderPPI(dets, tracks);                      break;
         case DisplayMode::BScope:        renderBScope(dets, tracks);                   break;
         case DisplayMode::CScope:        renderCScope(dets, tracks);                   break;
-        case DisplayMode::TimeSeries:    renderTimeSeries(hist, tracks);               break;
+        case DisplayMode::TimeSeries:    renderTimeSeries(ids, hist, histTotal);       break;
+        case DisplayMode::Latency:       renderLatency();                              break;
     }
     std::cout << std::flush;
 }
@@ -734,8 +961,8 @@ static void render() {
 // ---------------------------------------------------------------------------
 // Keyboard handling
 // ---------------------------------------------------------------------------
+// Runs on the render thread, so the keyboard state needs no lock.
 static void handleKey(int ch) {
-    std::lock_guard<std::mutex> lk(g_mutex);
     if (g_filterInputMode) {
         if (ch == '\r' || ch == '\n') {
             if (!g_filterInput.empty())
@@ -760,6 +987,7 @@ static void handleKey(int ch) {
         case '8': g_mode = DisplayMode::BScope;        break;
         case '9': g_mode = DisplayMode::CScope;        break;
         case '0': g_mode = DisplayMode::TimeSeries;    break;
+        case 'l': case 'L': g_mode = DisplayMode::Latency; break;
         case 'q': case 'Q': g_running.store(false);    break;
         default: break;
     }
@@ -781,26 +1009,34 @@ int main(int /*argc*/, char* /*argv*/[]) {
         "================================================================\n"
         "  Counter-UAS Radar Tracker  —  Multi-Mode Display (DDS)\n"
         "  Subscribing on domain 0 to topics:\n"
-        "    " << cuas::TOPIC_SP_DETECTION    << "  "
-               << cuas::TOPIC_TRACK_TABLE     << "\n"
+        "    " << cuas::TOPIC_SP_DETECTION_DISPLAY << "  "
+               << cuas::TOPIC_TRACK_TABLE     << "  "
+               << cuas::TOPIC_TRACK_UPDATE    << "  "
+               << cuas::TOPIC_TRACK_TABLE_FRAME << "\n"
         "    " << cuas::TOPIC_CLUSTER_TABLE   << "  "
                << cuas::TOPIC_ASSOC_TABLE     << "  "
                << cuas::TOPIC_PREDICTED_TABLE << "\n"
-        "  Keys: 1-9,0=mode  6+ID+Enter=filter  Q=quit\n"
+        "  Keys: 1-9,0=mode  L=latency  6+ID+Enter=filter  Q=quit\n"
         "================================================================\n\n";
 
     // Create DDS participant and subscribe to all topics.
     SPDetectionListener    spListener;
     TrackTableListener     trackListener;
+    TrackTableFrameListener trackFrameListener;
+    TrackUpdateListener    trackUpdateListener;
     ClusterTableListener   clusterListener;
     AssocTableListener     assocListener;
     PredictedTableListener predListener;
 
     cuas::CuasDdsParticipant participant;
     participant.makeReader<CounterUAS::SPDetectionMessage>(
-        cuas::TOPIC_SP_DETECTION, &spListener);
+        cuas::TOPIC_SP_DETECTION_DISPLAY, &spListener);
     participant.makeReader<CounterUAS::TrackTableMessage>(
         cuas::TOPIC_TRACK_TABLE, &trackListener);
+    participant.makeReader<CounterUAS::TrackTableFrame>(
+        cuas::TOPIC_TRACK_TABLE_FRAME, &trackFrameListener);
+    participant.makeReader<CounterUAS::TrackUpdateMessage>(
+        cuas::TOPIC_TRACK_UPDATE, &trackUpdateListener);
     participant.makeReader<CounterUAS::ClusterTableMessage>(
         cuas::TOPIC_CLUSTER_TABLE, &clusterListener);
     participant.makeReader<CounterUAS::AssocTableMessage>(
@@ -822,13 +1058,8 @@ int main(int /*argc*/, char* /*argv*/[]) {
     restoreMode();
 #endif
 
-    uint64_t detM, trM, clM, asM, prM;
-    {
-        std::lock_guard<std::mutex> lk(g_mutex);
-        detM = g_detMsgCount; trM = g_trackMsgCount;
-        clM  = g_clusterMsgCount; asM = g_assocMsgCount; prM = g_predMsgCount;
-    }
-    std::cerr << "\nExiting.  Det=" << detM << "  Tracks=" << trM
-              << "  Clusters=" << clM << "  Assoc=" << asM << "  Pred=" << prM << "\n";
+    std::cerr << "\nExiting.  Det=" << g_detMsgCount << "  Tracks=" << g_trackMsgCount
+              << "  Clusters=" << g_clusterMsgCount << "  Assoc=" << g_assocMsgCount
+              << "  Pred=" << g_predMsgCount << "\n";
     return 0;
 }
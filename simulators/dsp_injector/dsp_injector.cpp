@@ -9,9 +9,24 @@
  * Radar specs (per antenna wall, 4 walls): Azimuth FoV ±60°, Elevation FoV 90°,
  * Range accuracy 1 m, Angular accuracy 0.3° (az/el), Max range 30 km.
  *
- * Usage: dsp_injector [num_targets] [duration_sec] [rate_ms]
+ * Besides independent drones a scenario can hold swarms flying in
+ * formation, pairs of targets set to cross mid-run, Poisson clutter per
+ * range-azimuth cell and clutter bursts, at dwell rates up to 1 kHz:
+ * dwells are paced against an absolute schedule (sleep, then spin to the
+ * deadline) rather than a sleep per dwell.  Generation is split into
+ * fixed work units (blocks of targets, clutter sectors), each with its own
+ * random stream, spread over --threads; the dwells depend only on the
+ * scenario and its seed, never on the thread count.  --save writes the
+ * scenario, seed included, and --scenario loads it, so a load is
+ * repeatable; --record also logs every dwell to a binary log for
+ * log_replay.  --zero-copy publishes each dwell that fits as a plain
+ * SPDetectionFrame (topic "SPDetectionFrame") built in a loaned sample, for
+ * a tracker on the same host running with network.dds.zeroCopy.
+ *
+ * Usage: dsp_injector [num_targets] [duration_sec] [rate_ms] [sensor_id] [options]
  */
 
+#include "dsp_simulator.h"
 #include "common/types.h"
 #include "common/dds_participant.h"
 #include "common/constants.h"
@@ -22,7 +37,6 @@
 #include <algorithm>
 #include <iostream>
 #include <cmath>
-#include <random>
 #include <chrono>
 #include <thread>
 #include <vector>
@@ -33,196 +47,94 @@
 static std::atomic<bool> g_running{true};
 void signalHandler(int) { g_running.store(false); }
 
-namespace RadarSpecs {
-    constexpr double AZ_HALF_FOV_RAD    = 60.0 * cuas::DEG2RAD;
-    constexpr double EL_FOV_MAX_RAD     = 90.0 * cuas::DEG2RAD;
-    constexpr double EL_FOV_MIN_RAD     = 0.0;
-    constexpr double RANGE_ACCURACY_M   = 1.0;
-    constexpr double ANGULAR_ACCURACY_RAD = 0.3 * cuas::DEG2RAD;
-    constexpr double MAX_RANGE_M        = 30000.0;
+static void printUsage(const char* argv0) {
+    std::cerr << "Usage: " << argv0 << " [num_targets] [duration_sec] [rate_ms] [sensor_id] [options]\n"
+        "\n"
+        "Scenario (also the keys of a --scenario / --save file):\n"
+        "  --targets N             Independent drones (default 1)\n"
+        "  --swarms N              Formations of --swarm-size drones (default 0)\n"
+        "  --swarm-size N          Drones per formation (default 10)\n"
+        "  --swarm-spacing M       Metres between formation neighbours (default 15)\n"
+        "  --crossing-pairs N      Target pairs whose paths cross mid-run (default 0)\n"
+        "  --clutter-density D     Mean false alarms per range-az cell per dwell (default 0)\n"
+        "  --cell-range M          Clutter cell depth in metres (default 150)\n"
+        "  --cell-az DEG           Clutter cell width in degrees (default 1)\n"
+        "  --clutter-max-range M   Clutter out to this range (default 10000)\n"
+        "  --burst-prob P          Chance a dwell is a clutter burst (default 0)\n"
+        "  --burst-factor F        Clutter multiplier in a burst (default 10)\n"
+        "  --rate-hz R             Dwells per second, up to 1000 (default 10);\n"
+        "                          0 = as fast as possible, 0.1 s simulated per dwell\n"
+        "  --duration S            Seconds to run (default 60)\n"
+        "  --sensor N              Radar face (default 0)\n"
+        "  --seed N                Random seed; 0 = from the clock\n"
+        "\n"
+        "Run:\n"
+        "  --scenario FILE         Load a scenario; later options override it\n"
+        "  --save FILE             Write the scenario, seed included\n"
+        "  --threads N             Generation threads; 0 = all cores (default 1)\n"
+        "  --record DIR            Also log every dwell to a binary log (for log_replay)\n"
+        "  --dry-run               Generate (and record) without publishing\n"
+        "  --zero-copy             Publish dwells of up to 256 detections as loaned\n"
+        "                          SPDetectionFrame samples (tracker network.dds.zeroCopy)\n";
 }
 
-struct SimTarget {
-    double range, azimuth, elevation;
-    double speed, heading, climbRate, turnRate;
-    double rcs, microDoppler;
-    bool   active;
-};
-
-class DSPSimulator {
-public:
-    DSPSimulator(int numTargets, double noiseFloor, unsigned seed)
-        : rng_(seed), noiseFloor_(noiseFloor) {
-        initTargets(numTargets);
-    }
-
-    void initTargets(int n) {
-        std::uniform_real_distribution<> rangeDist(500.0, std::min(8000.0, RadarSpecs::MAX_RANGE_M - 500.0));
-        std::uniform_real_distribution<> azDist(-RadarSpecs::AZ_HALF_FOV_RAD, RadarSpecs::AZ_HALF_FOV_RAD);
-        std::uniform_real_distribution<> elDist(RadarSpecs::EL_FOV_MIN_RAD + 0.02, RadarSpecs::EL_FOV_MAX_RAD * 0.5);
-        std::uniform_real_distribution<> speedDist(5.0, 40.0);
-        std::uniform_real_distribution<> headingDist(-cuas::PI, cuas::PI);
-        std::uniform_real_distribution<> turnDist(-0.05, 0.05);
-        std::uniform_real_distribution<> rcsDist(-15.0, 5.0);
-        std::uniform_real_distribution<> microDist(50.0, 500.0);
-
-        targets_.clear();
-        for (int i = 0; i < n; ++i) {
-            SimTarget t;
-            t.range        = rangeDist(rng_);
-            t.azimuth      = azDist(rng_);
-            t.elevation    = elDist(rng_);
-            t.speed        = speedDist(rng_);
-            t.heading      = headingDist(rng_);
-            t.climbRate    = 0.5;
-            t.turnRate     = turnDist(rng_);
-            t.rcs          = rcsDist(rng_);
-            t.microDoppler = microDist(rng_);
-            t.active       = true;
-            targets_.push_back(t);
-        }
-    }
-
-    void updateTargets(double dt) {
-        std::normal_distribution<> accelNoise(0.0, 0.5);
-        std::normal_distribution<> turnNoise(0.0, 0.005);
-
-        for (auto& t : targets_) {
-            if (!t.active) continue;
-
-            double x = t.range * std::cos(t.elevation) * std::cos(t.azimuth);
-            double y = t.range * std::cos(t.elevation) * std::sin(t.azimuth);
-            double z = t.range * std::sin(t.elevation);
-
-            x += t.speed * std::cos(t.heading) * dt;
-            y += t.speed * std::sin(t.heading) * dt;
-            z += t.climbRate * dt;
-
-            t.heading   += t.turnRate * dt + turnNoise(rng_) * dt;
-            t.speed     += accelNoise(rng_) * dt;
-            t.climbRate += accelNoise(rng_) * 0.1 * dt;
-
-            if (t.speed < 2.0)  t.speed = 2.0;
-            if (t.speed > 60.0) t.speed = 60.0;
-            if (z < 10.0)    { z = 10.0;    t.climbRate =  std::abs(t.climbRate); }
-            if (z > 3000.0)  { t.climbRate = -std::abs(t.climbRate); }
-
-            t.range     = std::sqrt(x*x + y*y + z*z);
-            t.azimuth   = std::atan2(y, x);
-            t.elevation = std::asin(z / std::max(t.range, 1.0));
-
-            if (t.range > RadarSpecs::MAX_RANGE_M || t.range < 30.0)
-                t.active = false;
-            if (t.azimuth < -RadarSpecs::AZ_HALF_FOV_RAD ||
-                t.azimuth >  RadarSpecs::AZ_HALF_FOV_RAD)
-                t.active = false;
-            if (t.elevation < RadarSpecs::EL_FOV_MIN_RAD ||
-                t.elevation > RadarSpecs::EL_FOV_MAX_RAD)
-                t.active = false;
+int main(int argc, char* argv[]) {
+    Scenario    sc;
+    sc.durationSec = 60.0;
+    std::string savePath, recordDir;
+    int         threads = 1;
+    bool        dryRun  = false;
+    bool        zeroCopy = false;
+
+    // Positional arguments first, as before: targets, duration, rate_ms, sensor.
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 0;
         }
-    }
-
-    // Build an IDL-typed SPDetectionMessage — no hand-rolled serialization.
-    CounterUAS::SPDetectionMessage generateDwell(uint32_t dwellCount) {
-        CounterUAS::SPDetectionMessage msg;
-        msg.messageId(cuas::MSG_ID_SP_DETECTION);
-        msg.dwellCount(dwellCount);
-        msg.timestamp(cuas::nowMicros());
-
-        std::normal_distribution<> rangeNoise(0.0,  RadarSpecs::RANGE_ACCURACY_M);
-        std::normal_distribution<> azNoise(0.0,     RadarSpecs::ANGULAR_ACCURACY_RAD);
-        std::normal_distribution<> elNoise(0.0,     RadarSpecs::ANGULAR_ACCURACY_RAD);
-        std::normal_distribution<> strNoise(0.0,    3.0);
-        std::uniform_int_distribution<> numFalseAlarms(0, 3);
-        std::uniform_real_distribution<> probDetect(0.0, 1.0);
-        std::uniform_int_distribution<> extraDets(0, 2);
-
-        std::vector<CounterUAS::DetectionData> dets;
-
-        // Target returns
-        for (const auto& t : targets_) {
-            if (!t.active) continue;
-
-            double pd = 0.95 - (t.range / RadarSpecs::MAX_RANGE_M);
-            if (probDetect(rng_) > pd) continue;
-
-            CounterUAS::DetectionData det;
-            det.range(std::max(0.0, std::min(RadarSpecs::MAX_RANGE_M,
-                               t.range + rangeNoise(rng_))));
-            det.azimuth(std::max(-RadarSpecs::AZ_HALF_FOV_RAD,
-                         std::min( RadarSpecs::AZ_HALF_FOV_RAD,
-                                   t.azimuth + azNoise(rng_))));
-            det.elevation(std::max(RadarSpecs::EL_FOV_MIN_RAD,
-                           std::min(RadarSpecs::EL_FOV_MAX_RAD,
-                                    t.elevation + elNoise(rng_))));
-            det.rcs(t.rcs + strNoise(rng_) * 0.5);
-            det.microDoppler(t.microDoppler + strNoise(rng_) * 10.0);
-
-            double pathLoss = 40.0 * std::log10(std::max(det.range(), 1.0));
-            det.strength(-30.0 + det.rcs() - pathLoss + 100.0 + strNoise(rng_));
-            det.noise(noiseFloor_ + strNoise(rng_) * 0.5);
-            det.snr(det.strength() - det.noise());
-
-            int numDets = 1 + extraDets(rng_);
-            for (int d = 0; d < numDets; ++d) {
-                CounterUAS::DetectionData extra = det;
-                if (d > 0) {
-                    extra.range(std::max(0.0, std::min(RadarSpecs::MAX_RANGE_M,
-                                extra.range() + rangeNoise(rng_) * 2.0)));
-                    extra.azimuth(std::max(-RadarSpecs::AZ_HALF_FOV_RAD,
-                                  std::min( RadarSpecs::AZ_HALF_FOV_RAD,
-                                            extra.azimuth() + azNoise(rng_) * 2.0)));
-                    extra.elevation(std::max(RadarSpecs::EL_FOV_MIN_RAD,
-                                    std::min(RadarSpecs::EL_FOV_MAX_RAD,
-                                             extra.elevation() + elNoise(rng_) * 2.0)));
-                    extra.strength(extra.strength() - 3.0 - std::abs(strNoise(rng_)));
-                    extra.snr(extra.strength() - extra.noise());
+        if (arg.rfind("--", 0) != 0) {
+            try {
+                switch (positional++) {
+                    case 0: sc.targets     = std::stoi(arg); break;
+                    case 1: sc.durationSec = std::stod(arg); break;
+                    case 2: sc.rateHz      = 1000.0 / std::max(std::stod(arg), 1e-3); break;
+                    case 3: sc.sensorId    = static_cast<uint32_t>(std::stoul(arg)); break;
+                    default: throw std::invalid_argument(arg);
                 }
-                dets.push_back(extra);
+            } catch (const std::exception&) {
+                std::cerr << "Bad argument: " << arg << "\n";
+                printUsage(argv[0]);
+                return 1;
             }
+            continue;
         }
-
-        // False alarms
-        int nFA = numFalseAlarms(rng_);
-        std::uniform_real_distribution<> faRange(100.0, RadarSpecs::MAX_RANGE_M);
-        std::uniform_real_distribution<> faAz(-RadarSpecs::AZ_HALF_FOV_RAD, RadarSpecs::AZ_HALF_FOV_RAD);
-        std::uniform_real_distribution<> faEl(RadarSpecs::EL_FOV_MIN_RAD, RadarSpecs::EL_FOV_MAX_RAD * 0.5);
-
-        for (int i = 0; i < nFA; ++i) {
-            CounterUAS::DetectionData fa;
-            fa.range(faRange(rng_));      fa.azimuth(faAz(rng_));  fa.elevation(faEl(rng_));
-            fa.strength(noiseFloor_ + 5.0 + strNoise(rng_));
-            fa.noise(noiseFloor_);        fa.snr(fa.strength() - fa.noise());
-            fa.rcs(-20.0 + strNoise(rng_));
-            fa.microDoppler(strNoise(rng_) * 5.0);
-            dets.push_back(fa);
+        const std::string key = arg.substr(2);
+        if (key == "dry-run")   { dryRun = true; continue; }
+        if (key == "zero-copy") { zeroCopy = true; continue; }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << "\n";
+            return 1;
+        }
+        const std::string value = argv[++i];
+        if (key == "scenario") {
+            if (!loadScenario(value, sc)) {
+                std::cerr << "Cannot read scenario " << value << "\n";
+                return 1;
+            }
+        } else if (key == "save")    savePath  = value;
+        else if (key == "record")    recordDir = value;
+        else if (key == "threads")   threads   = std::stoi(value);
+        else if (!setScenarioKey(sc, key, value)) {
+            std::cerr << "Unknown option or bad value: " << arg << " " << value << "\n";
+            printUsage(argv[0]);
+            return 1;
         }
-
-        msg.numDetections(static_cast<uint32_t>(dets.size()));
-        msg.detections(dets);
-        return msg;
-    }
-
-    int activeTargets() const {
-        int c = 0;
-        for (const auto& t : targets_) if (t.active) ++c;
-        return c;
     }
-
-private:
-    std::mt19937 rng_;
-    double noiseFloor_;
-    std::vector<SimTarget> targets_;
-};
-
-int main(int argc, char* argv[]) {
-    int numTargets  = 1;
-    int durationSec = 60;
-    int rateMs      = 100;
-
-    if (argc > 1) numTargets  = std::stoi(argv[1]);
-    if (argc > 2) durationSec = std::stoi(argv[2]);
-    if (argc > 3) rateMs      = std::stoi(argv[3]);
+    sc.rateHz = std::min(sc.rateHz, 1000.0);
+    if (sc.seed == 0)
+        sc.seed = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
 
     std::signal(SIGINT,  signalHandler);
 #ifndef _WIN32
@@ -231,47 +143,163 @@ int main(int argc, char* argv[]) {
 
     cuas::ConsoleLogger::instance().setLevel(cuas::ConsoleLogger::INFO);
 
+    if (!savePath.empty()) {
+        if (!saveScenario(savePath, sc)) {
+            std::cerr << "Cannot write scenario " << savePath << "\n";
+            return 1;
+        }
+        LOG_INFO("DSPInjector", "Scenario saved to %s", savePath.c_str());
+    }
+
     std::cerr <<
         "================================================================\n"
         "  DSP Data Injector Simulator (DDS)\n"
-        "  Topic: " << cuas::TOPIC_SP_DETECTION << "  Domain: 0\n"
-        "  Targets: " << numTargets << "  Duration: " << durationSec << "s"
-        "  Rate: " << rateMs << "ms\n"
+        "  Topic: " << (zeroCopy ? cuas::TOPIC_SP_DETECTION_FRAME : cuas::TOPIC_SP_DETECTION)
+                    << "  Domain: 0\n"
+        "  Targets: " << sc.targets << " + " << sc.swarms << "x" << sc.swarmSize << " swarm + "
+                     << sc.crossingPairs << " crossing pairs\n"
+        "  Clutter: " << sc.clutterDensity << "/cell  Bursts: " << sc.burstProb << " x" << sc.burstFactor << "\n"
+        "  Duration: " << sc.durationSec << "s  Rate: " << sc.rateHz << " Hz  Sensor: " << sc.sensorId
+                     << "  Seed: " << sc.seed << "\n"
         "================================================================\n";
 
-    // One DDS participant publishes on "SPDetection".
-    cuas::CuasDdsParticipant participant;
-    auto* writer = participant.makeWriter<CounterUAS::SPDetectionMessage>(
-                       cuas::TOPIC_SP_DETECTION);
-
-    unsigned seed = static_cast<unsigned>(
-        std::chrono::steady_clock::now().time_since_epoch().count());
-    DSPSimulator sim(numTargets, -90.0, seed);
-
-    double   dt         = rateMs * 0.001;
-    uint32_t dwellCount = 0;
-    auto startTime = std::chrono::steady_clock::now();
+    // One DDS participant publishes on "SPDetection" (and "SPDetectionFrame").
+    cuas::DdsConfig dds;
+    dds.zeroCopy = zeroCopy;
+    cuas::CuasDdsParticipant participant(0, 0, dds);
+    auto* writer = dryRun ? nullptr
+                          : participant.makeWriter<CounterUAS::SPDetectionMessage>(
+                                cuas::TOPIC_SP_DETECTION);
+    auto* frameWriter = dryRun || !zeroCopy
+                          ? nullptr
+                          : participant.makeWriter<CounterUAS::SPDetectionFrame>(
+                                cuas::TOPIC_SP_DETECTION_FRAME);
+
+    cuas::BinaryLogger recorder;
+    if (!recordDir.empty()) {
+        cuas::LogOptions opts;
+        opts.combinedText = cuas::CombinedTextMode::Offline;
+        opts.blockBytes   = size_t(1) << 20;
+        opts.ringBytes    = size_t(64) << 20;     // a 1 kHz swarm is ~100 MB/s
+        if (!recorder.open(recordDir, "injector_s" + std::to_string(sc.sensorId),
+                           std::string(), opts)) {
+            std::cerr << "Cannot open a log in " << recordDir << "\n";
+            return 1;
+        }
+    }
 
-    while (g_running.load()) {
-        auto elapsed = std::chrono::steady_clock::now() - startTime;
-        if (std::chrono::duration_cast<std::chrono::seconds>(elapsed).count() >= durationSec)
-            break;
+    DSPSimulator sim(sc, -90.0, threads);
 
-        sim.updateTargets(dt);
-        auto msg = sim.generateDwell(dwellCount);
+    // Simulated time advances a fixed period per dwell whatever the pacing.
+    const bool     paced  = sc.rateHz > 0.0;
+    const double   dt     = paced ? 1.0 / sc.rateHz : 0.1;
+    const auto     period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double>(dt));
+    const uint64_t total  = static_cast<uint64_t>(std::llround(sc.durationSec / dt));
+    const auto     spin   = std::chrono::microseconds(200);   // sleep to here, then spin
 
-        // DDS write — CDR serialization is handled by the generated PubSubType.
-        writer->write(&msg);
+    CounterUAS::SPDetectionMessage          msg;
+    cuas::SPDetectionMessage                internal;
+    std::vector<cuas::Detection>            dets;
+    std::vector<CounterUAS::DetectionData>  wire;
+    uint32_t dwellCount = 0;
+    uint64_t late = 0, bursts = 0, sentDets = 0, frames = 0;
+    double   maxLateUs = 0.0, genSec = 0.0;
+
+    // Dwells are stamped on the schedule, not when they go out, so the
+    // tracker sees exactly the simulated dt even when a dwell is late.
+    const cuas::Timestamp epoch = cuas::nowMicros();
+    const auto startTime = std::chrono::steady_clock::now();
+    auto       deadline  = startTime;
+    auto       lastReport = startTime;
+
+    while (g_running.load() && dwellCount < total) {
+        const auto genStart = std::chrono::steady_clock::now();
+        sim.generateDwell(dt, dets);
+        genSec += std::chrono::duration<double>(std::chrono::steady_clock::now() - genStart).count();
+        bursts += sim.lastWasBurst();
+
+        if (paced) {
+            // Absolute schedule: a slow dwell is caught up on, never drifts.
+            if (std::chrono::steady_clock::now() < deadline - spin)
+                std::this_thread::sleep_until(deadline - spin);
+            while (std::chrono::steady_clock::now() < deadline) {}
+            const double lateUs = std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - deadline).count();
+            maxLateUs = std::max(maxLateUs, lateUs);
+            if (lateUs > 1e6 * dt) ++late;
+            deadline += period;
+        }
 
-        if (dwellCount % 50 == 0) {
-            LOG_INFO("DSPInjector", "Dwell %u: %u detections, %d active targets",
-                     dwellCount, msg.numDetections(), sim.activeTargets());
+        const cuas::Timestamp ts = epoch + static_cast<cuas::Timestamp>(std::llround(dwellCount * dt * 1e6));
+        // Zero copy: the dwell is written straight into a loaned frame.
+        bool sent = false;
+        if (frameWriter && dets.size() <= CounterUAS::FRAME_MAX_DETECTIONS) {
+            if (auto* frame = cuas::loanSample<CounterUAS::SPDetectionFrame>(frameWriter)) {
+                frame->messageId(cuas::MSG_ID_SP_DETECTION);
+                frame->dwellCount(dwellCount);
+                frame->timestamp(ts);
+                frame->numDetections(static_cast<uint32_t>(dets.size()));
+                frame->sensorId(sc.sensorId);
+                for (size_t i = 0; i < dets.size(); ++i)
+                    frame->detections()[i] = cuas::toIDL(dets[i]);
+                frameWriter->write(frame);
+                sent = true;
+                ++frames;
+            }
+        }
+        if (writer && !sent) {
+            wire.clear();
+            wire.reserve(dets.size());
+            for (const auto& d : dets) wire.push_back(cuas::toIDL(d));
+            msg.messageId(cuas::MSG_ID_SP_DETECTION);
+            msg.dwellCount(dwellCount);
+            msg.timestamp(ts);
+            msg.numDetections(static_cast<uint32_t>(dets.size()));
+            msg.detections(wire);
+            msg.sensorId(sc.sensorId);
+
+            // DDS write — CDR serialization is handled by the generated PubSubType.
+            writer->write(&msg);
+        }
+        if (recorder.isOpen()) {
+            internal.messageId     = cuas::MSG_ID_SP_DETECTION;
+            internal.dwellCount    = dwellCount;
+            internal.timestamp     = ts;
+            internal.numDetections = static_cast<uint32_t>(dets.size());
+            internal.detections.swap(dets);
+            internal.sensorId      = sc.sensorId;
+            recorder.logRawDetections(ts, internal);
+            internal.detections.swap(dets);
+        }
+        sentDets += dets.size();
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now - lastReport >= std::chrono::seconds(1)) {
+            const double elapsed = std::chrono::duration<double>(now - startTime).count();
+            LOG_INFO("DSPInjector", "Dwell %u: %zu detections, %d active targets, %.1f dwells/s, "
+                     "max lateness %.0f us",
+                     dwellCount, dets.size(), sim.activeTargets(), (dwellCount + 1) / elapsed, maxLateUs);
+            lastReport = now;
         }
 
         ++dwellCount;
-        std::this_thread::sleep_for(std::chrono::milliseconds(rateMs));
     }
 
-    LOG_INFO("DSPInjector", "Finished. Total dwells: %u", dwellCount);
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    recorder.close();
+    LOG_INFO("DSPInjector", "Finished. Total dwells: %u (%.1f dwells/s, %.1f detections/dwell)",
+             dwellCount, dwellCount / std::max(elapsed, 1e-9),
+             dwellCount ? static_cast<double>(sentDets) / dwellCount : 0.0);
+    LOG_INFO("DSPInjector", "Generation %.1f us/dwell on %d threads; %llu bursts; %llu dwells "
+             "more than a period late (max %.0f us)",
+             dwellCount ? 1e6 * genSec / dwellCount : 0.0, sim.threads(),
+             static_cast<unsigned long long>(bursts), static_cast<unsigned long long>(late), maxLateUs);
+    if (frameWriter)
+        LOG_INFO("DSPInjector", "%llu of %u dwells sent as zero-copy frames",
+                 static_cast<unsigned long long>(frames), dwellCount);
+    if (recorder.droppedRecords() > 0)
+        LOG_WARN("DSPInjector", "%llu dwells not recorded (log ring full)",
+                 static_cast<unsigned long long>(recorder.droppedRecords()));
     return 0;
 }
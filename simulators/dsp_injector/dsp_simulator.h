@@ -0,0 +1,417 @@
+#pragma once
+
+/*
+ * DSPSimulator — the dsp_injector's scenario and dwell generator, shared
+ * with the scenario regression test so both see the same seeded targets.
+ *
+ * A Scenario is everything that determines the generated dwells; it reads
+ * and writes as `key value` lines (dsp_injector --save / --scenario).
+ * DSPSimulator::generateDwell() advances the targets and builds one dwell;
+ * targets() is the ground truth of that dwell.
+ */
+
+#include "common/types.h"
+#include "common/constants.h"
+#include "common/logger.h"
+#include "common/worker_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace RadarSpecs {
+    constexpr double AZ_HALF_FOV_RAD    = 60.0 * cuas::DEG2RAD;
+    constexpr double EL_FOV_MAX_RAD     = 90.0 * cuas::DEG2RAD;
+    constexpr double EL_FOV_MIN_RAD     = 0.0;
+    constexpr double RANGE_ACCURACY_M   = 1.0;
+    constexpr double ANGULAR_ACCURACY_RAD = 0.3 * cuas::DEG2RAD;
+    constexpr double MAX_RANGE_M        = 30000.0;
+}
+
+// Everything that determines the generated dwells.
+struct Scenario {
+    int      targets         = 1;       // independent drones
+    int      swarms          = 0;       // formations
+    int      swarmSize       = 10;      // drones per formation
+    double   swarmSpacing    = 15.0;    // m between neighbours
+    int      crossingPairs   = 0;       // pairs whose paths cross mid-run
+    double   clutterDensity  = 0.0;     // mean false alarms per range-az cell per dwell
+    double   cellRange       = 150.0;   // clutter cell, m
+    double   cellAzDeg       = 1.0;     // clutter cell, degrees
+    double   clutterMaxRange = 10000.0; // clutter fills [100 m, this]
+    double   burstProb       = 0.0;     // chance a dwell is a clutter burst
+    double   burstFactor     = 10.0;    // clutter multiplier in a burst
+    double   rateHz          = 10.0;    // dwells per second; <= 0 = unpaced
+    double   durationSec     = 60.0;
+    uint32_t sensorId        = 0;       // radar face; match pipeline.sensorIds
+    uint64_t seed            = 0;       // 0 = from the clock
+};
+
+// `key value` lines, as written by saveScenario(); also the --key options.
+inline bool setScenarioKey(Scenario& s, const std::string& key, const std::string& value) {
+    try {
+        if      (key == "targets")           s.targets         = std::stoi(value);
+        else if (key == "swarms")            s.swarms          = std::stoi(value);
+        else if (key == "swarm-size")        s.swarmSize       = std::stoi(value);
+        else if (key == "swarm-spacing")     s.swarmSpacing    = std::stod(value);
+        else if (key == "crossing-pairs")    s.crossingPairs   = std::stoi(value);
+        else if (key == "clutter-density")   s.clutterDensity  = std::stod(value);
+        else if (key == "cell-range")        s.cellRange       = std::stod(value);
+        else if (key == "cell-az")           s.cellAzDeg       = std::stod(value);
+        else if (key == "clutter-max-range") s.clutterMaxRange = std::stod(value);
+        else if (key == "burst-prob")        s.burstProb       = std::stod(value);
+        else if (key == "burst-factor")      s.burstFactor     = std::stod(value);
+        else if (key == "rate-hz")           s.rateHz          = std::stod(value);
+        else if (key == "duration")          s.durationSec     = std::stod(value);
+        else if (key == "sensor")            s.sensorId        = static_cast<uint32_t>(std::stoul(value));
+        else if (key == "seed")              s.seed            = std::stoull(value);
+        else return false;
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+inline bool loadScenario(const std::string& path, Scenario& s) {
+    std::ifstream in(path);
+    if (!in.is_open()) return false;
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream ls(line);
+        std::string key, value;
+        if (!(ls >> key) || key[0] == '#') continue;
+        ls >> value;
+        if (!setScenarioKey(s, key, value))
+            LOG_WARN("DSPInjector", "%s: ignoring '%s'", path.c_str(), line.c_str());
+    }
+    return true;
+}
+
+inline bool saveScenario(const std::string& path, const Scenario& s) {
+    std::ofstream out(path);
+    if (!out.is_open()) return false;
+    out << "# dsp_injector scenario; run it again with --scenario " << path << "\n"
+        << "targets "           << s.targets         << "\n"
+        << "swarms "            << s.swarms          << "\n"
+        << "swarm-size "        << s.swarmSize       << "\n"
+        << "swarm-spacing "     << s.swarmSpacing    << "\n"
+        << "crossing-pairs "    << s.crossingPairs   << "\n"
+        << "clutter-density "   << s.clutterDensity  << "\n"
+        << "cell-range "        << s.cellRange       << "\n"
+        << "cell-az "           << s.cellAzDeg       << "\n"
+        << "clutter-max-range " << s.clutterMaxRange << "\n"
+        << "burst-prob "        << s.burstProb       << "\n"
+        << "burst-factor "      << s.burstFactor     << "\n"
+        << "rate-hz "           << s.rateHz          << "\n"
+        << "duration "          << s.durationSec     << "\n"
+        << "sensor "            << s.sensorId        << "\n"
+        << "seed "              << s.seed            << "\n";
+    return out.good();
+}
+
+struct SimTarget {
+    double x, y, z;                     // m, radar frame
+    double speed, heading, climbRate, turnRate;
+    double rcs, microDoppler;
+    int    swarm    = -1;               // formation member: index of its centre
+    double dx = 0.0, dy = 0.0, dz = 0.0;  // offset from the centre: along, across, up
+    bool   straight = false;            // crossing target: no manoeuvres
+    bool   active   = true;
+};
+
+class DSPSimulator {
+public:
+    // Targets are generated in blocks of TARGET_BLOCK and clutter in
+    // CLUTTER_SECTORS azimuth sectors; each unit owns a random stream.
+    static constexpr size_t TARGET_BLOCK    = 64;
+    static constexpr size_t CLUTTER_SECTORS = 16;
+
+    DSPSimulator(const Scenario& sc, double noiseFloor, int threads)
+        : sc_(sc), rng_(sc.seed), noiseFloor_(noiseFloor), pool_(threads) {
+        initTargets();
+        const size_t units = blocks() + CLUTTER_SECTORS;
+        unitRng_.reserve(units);
+        for (size_t u = 0; u < units; ++u) {
+            std::seed_seq seq{static_cast<uint32_t>(sc.seed), static_cast<uint32_t>(sc.seed >> 32),
+                              static_cast<uint32_t>(u)};
+            unitRng_.emplace_back(seq);
+        }
+        unitDets_.resize(units);
+    }
+
+    void initTargets() {
+        std::uniform_real_distribution<> rangeDist(500.0, std::min(8000.0, RadarSpecs::MAX_RANGE_M - 500.0));
+        std::uniform_real_distribution<> azDist(-RadarSpecs::AZ_HALF_FOV_RAD, RadarSpecs::AZ_HALF_FOV_RAD);
+        std::uniform_real_distribution<> elDist(RadarSpecs::EL_FOV_MIN_RAD + 0.02, RadarSpecs::EL_FOV_MAX_RAD * 0.5);
+        std::uniform_real_distribution<> speedDist(5.0, 40.0);
+        std::uniform_real_distribution<> headingDist(-cuas::PI, cuas::PI);
+        std::uniform_real_distribution<> turnDist(-0.05, 0.05);
+        std::uniform_real_distribution<> rcsDist(-15.0, 5.0);
+        std::uniform_real_distribution<> microDist(50.0, 500.0);
+        std::uniform_real_distribution<> unit(0.0, 1.0);
+
+        auto place = [](SimTarget& t, double range, double az, double el) {
+            t.x = range * std::cos(el) * std::cos(az);
+            t.y = range * std::cos(el) * std::sin(az);
+            t.z = range * std::sin(el);
+        };
+
+        targets_.clear();
+        for (int i = 0; i < sc_.targets; ++i) {
+            SimTarget t;
+            place(t, rangeDist(rng_), azDist(rng_), elDist(rng_));
+            t.speed        = speedDist(rng_);
+            t.heading      = headingDist(rng_);
+            t.climbRate    = 0.5;
+            t.turnRate     = turnDist(rng_);
+            t.rcs          = rcsDist(rng_);
+            t.microDoppler = microDist(rng_);
+            targets_.push_back(t);
+        }
+
+        // Swarms: inbound formations, members on a grid around the centre.
+        centres_.clear();
+        for (int s = 0; s < sc_.swarms; ++s) {
+            SimTarget c;
+            const double az = azDist(rng_) * (2.0 / 3.0);
+            place(c, 2000.0 + 6000.0 * unit(rng_), az, (2.0 + 13.0 * unit(rng_)) * cuas::DEG2RAD);
+            c.speed     = 10.0 + 20.0 * unit(rng_);
+            c.heading   = az + cuas::PI + (unit(rng_) - 0.5);
+            c.climbRate = 0.0;
+            c.turnRate  = turnDist(rng_) * 0.5;
+            c.rcs = c.microDoppler = 0.0;
+            centres_.push_back(c);
+
+            const int cols = std::max(1, static_cast<int>(std::ceil(std::sqrt(sc_.swarmSize))));
+            for (int m = 0; m < sc_.swarmSize; ++m) {
+                SimTarget t = c;
+                t.swarm        = s;
+                t.dx           = (m / cols - (sc_.swarmSize - 1) / cols * 0.5) * sc_.swarmSpacing;
+                t.dy           = (m % cols - (cols - 1) * 0.5) * sc_.swarmSpacing;
+                t.dz           = (unit(rng_) - 0.5) * sc_.swarmSpacing * 0.3;
+                t.rcs          = rcsDist(rng_) - 5.0;
+                t.microDoppler = microDist(rng_);
+                targets_.push_back(t);
+            }
+        }
+
+        // Crossing pairs: both reach the same point at the same time, at
+        // the middle of the run (at most 30 s in), then fly on.
+        const double tc = std::min(sc_.durationSec * 0.5, 30.0);
+        for (int p = 0; p < sc_.crossingPairs; ++p) {
+            SimTarget meet;
+            place(meet, 2000.0 + 4000.0 * unit(rng_), azDist(rng_) * 0.5,
+                  (1.0 + 9.0 * unit(rng_)) * cuas::DEG2RAD);
+            const double h0    = headingDist(rng_);
+            const double cross = (60.0 + 60.0 * unit(rng_)) * cuas::DEG2RAD;
+            for (int k = 0; k < 2; ++k) {
+                SimTarget t = meet;
+                t.speed        = 15.0 + 20.0 * unit(rng_);
+                t.heading      = h0 + k * cross;
+                t.climbRate    = 0.0;
+                t.turnRate     = 0.0;
+                t.straight     = true;
+                t.rcs          = rcsDist(rng_);
+                t.microDoppler = microDist(rng_);
+                t.x -= t.speed * std::cos(t.heading) * tc;
+                t.y -= t.speed * std::sin(t.heading) * tc;
+                targets_.push_back(t);
+            }
+        }
+    }
+
+    // Advances every target by dt and builds one dwell's detections into
+    // `out` (reused), target returns block by block, then the clutter.
+    void generateDwell(double dt, std::vector<cuas::Detection>& out) {
+        for (auto& c : centres_) move(c, dt, rng_);
+
+        // Dwell-wide draws come from the main stream, before the fan-out.
+        std::uniform_int_distribution<> numFalseAlarms(0, 3);
+        std::uniform_real_distribution<> unit(0.0, 1.0);
+        falseAlarms_  = numFalseAlarms(rng_);
+        clutterScale_ = unit(rng_) < sc_.burstProb ? sc_.burstFactor : 1.0;
+        burst_        = clutterScale_ > 1.0;
+
+        const size_t nBlocks = blocks();
+        pool_.parallelFor(nBlocks + CLUTTER_SECTORS, 1, [&](size_t begin, size_t end) {
+            for (size_t u = begin; u < end; ++u) {
+                unitDets_[u].clear();
+                if (u < nBlocks) targetBlock(u, dt);
+                else             clutterSector(u - nBlocks);
+            }
+        });
+
+        out.clear();
+        for (const auto& d : unitDets_) out.insert(out.end(), d.begin(), d.end());
+
+        // Thermal false alarms anywhere in the field of view.
+        std::normal_distribution<> strNoise(0.0, 3.0);
+        std::uniform_real_distribution<> faRange(100.0, RadarSpecs::MAX_RANGE_M);
+        std::uniform_real_distribution<> faAz(-RadarSpecs::AZ_HALF_FOV_RAD, RadarSpecs::AZ_HALF_FOV_RAD);
+        std::uniform_real_distribution<> faEl(RadarSpecs::EL_FOV_MIN_RAD, RadarSpecs::EL_FOV_MAX_RAD * 0.5);
+        for (int i = 0; i < falseAlarms_; ++i)
+            out.push_back(falseAlarm(faRange(rng_), faAz(rng_), faEl(rng_), strNoise(rng_), rng_));
+    }
+
+    int activeTargets() const {
+        int c = 0;
+        for (const auto& t : targets_) if (t.active) ++c;
+        return c;
+    }
+    bool lastWasBurst() const { return burst_; }
+    // Ground truth after the last generateDwell(): positions are the
+    // dwell's, and targets that left the field of view are !active.
+    const std::vector<SimTarget>& targets() const { return targets_; }
+    int  threads()      const { return pool_.numThreads(); }
+
+private:
+    size_t blocks() const { return (targets_.size() + TARGET_BLOCK - 1) / TARGET_BLOCK; }
+
+    void move(SimTarget& t, double dt, std::mt19937_64& rng) const {
+        std::normal_distribution<> accelNoise(0.0, 0.5);
+        std::normal_distribution<> turnNoise(0.0, 0.005);
+
+        t.x += t.speed * std::cos(t.heading) * dt;
+        t.y += t.speed * std::sin(t.heading) * dt;
+        t.z += t.climbRate * dt;
+        if (t.straight) return;
+
+        t.heading   += t.turnRate * dt + turnNoise(rng) * dt;
+        t.speed     += accelNoise(rng) * dt;
+        t.climbRate += accelNoise(rng) * 0.1 * dt;
+
+        if (t.speed < 2.0)  t.speed = 2.0;
+        if (t.speed > 60.0) t.speed = 60.0;
+        if (t.z < 10.0)    { t.z = 10.0;   t.climbRate =  std::abs(t.climbRate); }
+        if (t.z > 3000.0)  { t.climbRate = -std::abs(t.climbRate); }
+    }
+
+    void targetBlock(size_t block, double dt) {
+        std::mt19937_64& rng = unitRng_[block];
+        std::vector<cuas::Detection>& dets = unitDets_[block];
+        const size_t end = std::min(targets_.size(), (block + 1) * TARGET_BLOCK);
+        for (size_t i = block * TARGET_BLOCK; i < end; ++i) {
+            SimTarget& t = targets_[i];
+            if (!t.active) continue;
+            if (t.swarm >= 0) {
+                // Formation keeping: the member holds its slot around the centre.
+                const SimTarget& c = centres_[static_cast<size_t>(t.swarm)];
+                const double ch = std::cos(c.heading), sh = std::sin(c.heading);
+                t.x       = c.x + t.dx * ch - t.dy * sh;
+                t.y       = c.y + t.dx * sh + t.dy * ch;
+                t.z       = c.z + t.dz;
+                t.heading = c.heading;
+                t.speed   = c.speed;
+            } else {
+                move(t, dt, rng);
+            }
+
+            const double range     = std::sqrt(t.x * t.x + t.y * t.y + t.z * t.z);
+            const double azimuth   = std::atan2(t.y, t.x);
+            const double elevation = std::asin(t.z / std::max(range, 1.0));
+            if (range > RadarSpecs::MAX_RANGE_M || range < 30.0 ||
+                azimuth < -RadarSpecs::AZ_HALF_FOV_RAD || azimuth > RadarSpecs::AZ_HALF_FOV_RAD ||
+                elevation < RadarSpecs::EL_FOV_MIN_RAD || elevation > RadarSpecs::EL_FOV_MAX_RAD) {
+                t.active = false;
+                continue;
+            }
+            targetReturns(t, range, azimuth, elevation, rng, dets);
+        }
+    }
+
+    void targetReturns(const SimTarget& t, double range, double azimuth, double elevation,
+                       std::mt19937_64& rng, std::vector<cuas::Detection>& dets) const {
+        std::normal_distribution<> rangeNoise(0.0,  RadarSpecs::RANGE_ACCURACY_M);
+        std::normal_distribution<> azNoise(0.0,     RadarSpecs::ANGULAR_ACCURACY_RAD);
+        std::normal_distribution<> elNoise(0.0,     RadarSpecs::ANGULAR_ACCURACY_RAD);
+        std::normal_distribution<> strNoise(0.0,    3.0);
+        std::uniform_real_distribution<> probDetect(0.0, 1.0);
+        std::uniform_int_distribution<> extraDets(0, 2);
+
+        double pd = 0.95 - (range / RadarSpecs::MAX_RANGE_M);
+        if (probDetect(rng) > pd) return;
+
+        cuas::Detection det;
+        det.range     = std::max(0.0, std::min(RadarSpecs::MAX_RANGE_M, range + rangeNoise(rng)));
+        det.azimuth   = std::max(-RadarSpecs::AZ_HALF_FOV_RAD,
+                        std::min( RadarSpecs::AZ_HALF_FOV_RAD, azimuth + azNoise(rng)));
+        det.elevation = std::max(RadarSpecs::EL_FOV_MIN_RAD,
+                        std::min(RadarSpecs::EL_FOV_MAX_RAD, elevation + elNoise(rng)));
+        det.rcs          = t.rcs + strNoise(rng) * 0.5;
+        det.microDoppler = t.microDoppler + strNoise(rng) * 10.0;
+
+        double pathLoss = 40.0 * std::log10(std::max(det.range, 1.0));
+        det.strength = -30.0 + det.rcs - pathLoss + 100.0 + strNoise(rng);
+        det.noise    = noiseFloor_ + strNoise(rng) * 0.5;
+        det.snr      = det.strength - det.noise;
+
+        int numDets = 1 + extraDets(rng);
+        for (int d = 0; d < numDets; ++d) {
+            cuas::Detection extra = det;
+            if (d > 0) {
+                extra.range     = std::max(0.0, std::min(RadarSpecs::MAX_RANGE_M,
+                                  extra.range + rangeNoise(rng) * 2.0));
+                extra.azimuth   = std::max(-RadarSpecs::AZ_HALF_FOV_RAD,
+                                  std::min( RadarSpecs::AZ_HALF_FOV_RAD,
+                                            extra.azimuth + azNoise(rng) * 2.0));
+                extra.elevation = std::max(RadarSpecs::EL_FOV_MIN_RAD,
+                                  std::min(RadarSpecs::EL_FOV_MAX_RAD,
+                                           extra.elevation + elNoise(rng) * 2.0));
+                extra.strength  = extra.strength - 3.0 - std::abs(strNoise(rng));
+                extra.snr       = extra.strength - extra.noise;
+            }
+            dets.push_back(extra);
+        }
+    }
+
+    // Poisson clutter: independent per range-az cell is the same as a
+    // Poisson count over the sector, placed uniformly.  Low elevation only.
+    void clutterSector(size_t sector) {
+        if (sc_.clutterDensity <= 0.0) return;
+        std::mt19937_64& rng = unitRng_[blocks() + sector];
+        std::vector<cuas::Detection>& dets = unitDets_[blocks() + sector];
+
+        const double minRange  = 100.0;
+        const double maxRange  = std::max(minRange, std::min(sc_.clutterMaxRange, RadarSpecs::MAX_RANGE_M));
+        const double width     = 2.0 * RadarSpecs::AZ_HALF_FOV_RAD / CLUTTER_SECTORS;
+        const double azFrom    = -RadarSpecs::AZ_HALF_FOV_RAD + sector * width;
+        const double cells     = (maxRange - minRange) / std::max(sc_.cellRange, 1.0) *
+                                 (width / std::max(sc_.cellAzDeg * cuas::DEG2RAD, 1e-6));
+        std::poisson_distribution<int> count(sc_.clutterDensity * clutterScale_ * cells);
+        std::uniform_real_distribution<> r(minRange, maxRange);
+        std::uniform_real_distribution<> az(azFrom, azFrom + width);
+        std::uniform_real_distribution<> el(RadarSpecs::EL_FOV_MIN_RAD, 10.0 * cuas::DEG2RAD);
+        std::normal_distribution<> strNoise(0.0, 3.0);
+        for (int n = count(rng); n > 0; --n)
+            dets.push_back(falseAlarm(r(rng), az(rng), el(rng), strNoise(rng), rng));
+    }
+
+    cuas::Detection falseAlarm(double range, double azimuth, double elevation, double excess,
+                               std::mt19937_64& rng) const {
+        std::normal_distribution<> strNoise(0.0, 3.0);
+        cuas::Detection fa;
+        fa.range = range;  fa.azimuth = azimuth;  fa.elevation = elevation;
+        fa.strength     = noiseFloor_ + 5.0 + excess;
+        fa.noise        = noiseFloor_;
+        fa.snr          = fa.strength - fa.noise;
+        fa.rcs          = -20.0 + strNoise(rng);
+        fa.microDoppler = strNoise(rng) * 5.0;
+        return fa;
+    }
+
+    Scenario                 sc_;
+    std::mt19937_64          rng_;          // initial layout and dwell-wide draws
+    double                   noiseFloor_;
+    cuas::WorkerPool         pool_;
+    std::vector<SimTarget>   targets_;
+    std::vector<SimTarget>   centres_;      // one per swarm
+    std::vector<std::mt19937_64>              unitRng_;
+    std::vector<std::vector<cuas::Detection>> unitDets_;   // scratch, per work unit
+    int    falseAlarms_  = 0;
+    double clutterScale_ = 1.0;
+    bool   burst_        = false;
+};
@@ -0,0 +1,185 @@
+/*
+ * IMM Precision Check
+ *
+ * Replays the clustered dwells of a tracker binary log through two track
+ * managers, one with prediction.imm.precision = "double" and one with
+ * "float", and reports how far the float tracks drift from the double ones.
+ * Use it on representative recordings before enabling float in production.
+ *
+ * Usage: imm_precision_check <logfile> [config] [--max-pos m] [--max-vel m/s]
+ *   config   : tracker_config.json (default: config/tracker_config.json)
+ *   --max-pos: fail (exit 1) if any matched track's position differs by more
+ *   --max-vel: fail (exit 1) if any matched track's velocity differs by more
+ */
+
+#include "common/types.h"
+#include "common/config.h"
+#include "common/logger.h"
+#include "common/log_reader.h"
+#include "track_management/track_manager.h"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cmath>
+
+namespace {
+
+struct Divergence {
+    double   maxPos     = 0.0;
+    double   maxVel     = 0.0;
+    double   sumPos2    = 0.0;
+    double   sumVel2    = 0.0;
+    uint64_t samples    = 0;
+    uint64_t onlyDouble = 0;    // track-dwells present in one run only
+    uint64_t onlyFloat  = 0;
+};
+
+bool decodeClusters(const cuas::LogPayload& payload, std::vector<cuas::Cluster>& out) {
+    const uint8_t* p   = payload.data();
+    const uint8_t* end = p + payload.size();
+    auto take = [&](void* dst, size_t n) {
+        if (static_cast<size_t>(end - p) < n) return false;
+        std::memcpy(dst, p, n); p += n;
+        return true;
+    };
+
+    uint32_t n = 0;
+    if (!take(&n, 4)) return false;
+    out.clear();
+    out.reserve(n);
+    for (uint32_t i = 0; i < n; ++i) {
+        cuas::Cluster c;
+        uint32_t ni = 0;
+        if (!take(&c.clusterId, 4)    || !take(&c.range, 8)       ||
+            !take(&c.azimuth, 8)      || !take(&c.elevation, 8)   ||
+            !take(&c.strength, 8)     || !take(&c.snr, 8)         ||
+            !take(&c.rcs, 8)          || !take(&c.microDoppler, 8) ||
+            !take(&c.numDetections, 4) || !take(&c.cartesian.x, 8) ||
+            !take(&c.cartesian.y, 8)  || !take(&c.cartesian.z, 8) ||
+            !take(&ni, 4))
+            return false;
+        c.detectionIndices.resize(ni);
+        for (uint32_t k = 0; k < ni; ++k)
+            if (!take(&c.detectionIndices[k], 4)) return false;
+        out.push_back(std::move(c));
+    }
+    return true;
+}
+
+void compareTracks(const cuas::TrackManager& dbl, const cuas::TrackManager& flt,
+                   Divergence& d) {
+    const cuas::TrackStore& dblTracks = dbl.tracks();
+    const cuas::TrackStore& fltTracks = flt.tracks();
+    size_t matched = 0;
+
+    for (size_t i = 0; i < dblTracks.size(); ++i) {
+        long j = fltTracks.find(dblTracks[i].id());
+        if (j < 0) { ++d.onlyDouble; continue; }
+        const cuas::StateVector& a = dblTracks[i].state();
+        const cuas::StateVector& b = fltTracks[j].state();
+        double dp = std::sqrt((a[0]-b[0])*(a[0]-b[0]) + (a[3]-b[3])*(a[3]-b[3]) +
+                              (a[6]-b[6])*(a[6]-b[6]));
+        double dv = std::sqrt((a[1]-b[1])*(a[1]-b[1]) + (a[4]-b[4])*(a[4]-b[4]) +
+                              (a[7]-b[7])*(a[7]-b[7]));
+        d.maxPos   = std::max(d.maxPos, dp);
+        d.maxVel   = std::max(d.maxVel, dv);
+        d.sumPos2 += dp * dp;
+        d.sumVel2 += dv * dv;
+        ++d.samples;
+        ++matched;
+    }
+    d.onlyFloat += fltTracks.size() - matched;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Counter-UAS Radar Tracker - IMM Precision Check" << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "Usage: " << argv[0]
+                  << " <logfile> [config] [--max-pos m] [--max-vel m/s]" << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "Replays the logged clusters through a double- and a float-precision" << std::endl;
+        std::cerr << "IMM and reports the per-track state divergence." << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "Example:" << std::endl;
+        std::cerr << "  " << argv[0] << " tracker_log.bin config/tracker_config.json --max-pos 0.5" << std::endl;
+        return 1;
+    }
+
+    std::string filename   = argv[1];
+    std::string configPath = "config/tracker_config.json";
+    double maxPosLimit = -1.0;
+    double maxVelLimit = -1.0;
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--max-pos" && i + 1 < argc)      maxPosLimit = std::stod(argv[++i]);
+        else if (arg == "--max-vel" && i + 1 < argc) maxVelLimit = std::stod(argv[++i]);
+        else configPath = arg;
+    }
+
+    cuas::LogReader file;
+    if (!file.open(filename)) {
+        std::cerr << "ERROR: Cannot open log file: " << filename << std::endl;
+        return 1;
+    }
+
+    cuas::ConsoleLogger::instance().setLevel(cuas::ConsoleLogger::WARN);
+    cuas::TrackerConfig cfg = cuas::loadConfig(configPath);
+    cfg.system.logEnabled = false;
+    cuas::TrackerConfig dblCfg = cfg;
+    cuas::TrackerConfig fltCfg = cfg;
+    dblCfg.prediction.imm.precision = cuas::IMMPrecision::Double;
+    fltCfg.prediction.imm.precision = cuas::IMMPrecision::Float;
+
+    cuas::TrackManager dbl(dblCfg);
+    cuas::TrackManager flt(fltCfg);
+
+    Divergence div;
+    cuas::LogRecordHeader hdr;
+    cuas::LogPayload payload;
+    std::vector<cuas::Cluster> clusters;
+    uint32_t dwellCount = 0;
+    uint64_t dwells = 0;
+
+    while (file.next(hdr, payload)) {
+        auto type = static_cast<cuas::LogRecordType>(hdr.recordType);
+        if (type == cuas::LogRecordType::RawDetection && payload.size() >= 8) {
+            std::memcpy(&dwellCount, payload.data() + 4, 4);
+        } else if (type == cuas::LogRecordType::Clustered) {
+            if (!decodeClusters(payload, clusters)) continue;
+            dbl.trackDwell(clusters, hdr.timestamp, dwellCount);
+            flt.trackDwell(clusters, hdr.timestamp, dwellCount);
+            compareTracks(dbl, flt, div);
+            ++dwells;
+        }
+    }
+
+    double rmsPos = div.samples ? std::sqrt(div.sumPos2 / div.samples) : 0.0;
+    double rmsVel = div.samples ? std::sqrt(div.sumVel2 / div.samples) : 0.0;
+
+    std::cout << "=== IMM Precision Check: " << filename << " ===" << std::endl;
+    std::cout << "Dwells replayed      : " << dwells << std::endl;
+    std::cout << "Track-dwells matched : " << div.samples << std::endl;
+    std::cout << "Only in double run   : " << div.onlyDouble << std::endl;
+    std::cout << "Only in float run    : " << div.onlyFloat << std::endl;
+    std::cout << std::scientific << std::setprecision(3);
+    std::cout << "Position diff (m)    : max " << div.maxPos << "  rms " << rmsPos << std::endl;
+    std::cout << "Velocity diff (m/s)  : max " << div.maxVel << "  rms " << rmsVel << std::endl;
+
+    bool fail = false;
+    if (maxPosLimit >= 0.0 && div.maxPos > maxPosLimit) {
+        std::cerr << "FAIL: position divergence exceeds " << maxPosLimit << " m" << std::endl;
+        fail = true;
+    }
+    if (maxVelLimit >= 0.0 && div.maxVel > maxVelLimit) {
+        std::cerr << "FAIL: velocity divergence exceeds " << maxVelLimit << " m/s" << std::endl;
+        fail = true;
+    }
+    return fail ? 1 : 0;
+}
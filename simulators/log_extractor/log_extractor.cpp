@@ -5,14 +5,22 @@
  * 1. Extract and print human-readable summaries
  * 2. Replay logged detections to the tracker via UDP
  * 3. Export data to CSV format
+ * 4. Export per-stage .dat text files or typed Arrow (Feather) tables
  *
- * Usage: log_extractor <logfile> [mode] [options]
- *   mode: extract (default) | replay | csv
+ * Reads v1 (plain records) and v2 (LZ4 block) logs alike.  csv and dat
+ * split the log into record-aligned chunks and format them in parallel.
+ *
+ * Usage: log_extractor <logfile> [mode] [options] [range] [--threads N]
+ *   mode: extract (default) | replay | csv | dat | arrow | index
  *   replay options: [target_ip] [target_port] [speed_factor]
+ *   range: --from-dwell N --to-dwell N --from-time US
  */
 
 #include "common/types.h"
 #include "common/logger.h"
+#include "common/log_reader.h"
+#include "common/arrow_ipc.h"
+#include "common/worker_pool.h"
 #include "common/constants.h"
 #include "common/dds_participant.h"
 
@@ -30,6 +38,8 @@
 #include <csignal>
 #include <atomic>
 #include <map>
+#include <memory>
+#include <algorithm>
 #include <filesystem>
 
 static std::atomic<bool> g_running{true};
@@ -52,6 +62,69 @@ const char* recordTypeName(cuas::LogRecordType type) {
     }
 }
 
+// --from-dwell / --to-dwell / --from-time, common to every reading mode.
+struct LogRange {
+    uint32_t        fromDwell = 0;
+    uint32_t        toDwell   = UINT32_MAX;
+    cuas::Timestamp fromTime  = 0;
+    bool            set       = false;
+};
+
+// Opens `filename` and seeks to `range` through the log's block index or
+// .idx sidecar, if it has either.
+bool openLog(cuas::LogReader& file, const std::string& filename, const LogRange& range) {
+    if (!file.open(filename)) {
+        std::cerr << "ERROR: Cannot open file: " << filename << std::endl;
+        return false;
+    }
+    if (range.set) {
+        if (file.index().empty() && file.sidecar().empty())
+            std::cerr << "NOTE: " << filename << " has no index; scanning from the start."
+                      << std::endl;
+        file.setRange(range.fromDwell, range.toDwell, range.fromTime);
+    }
+    return true;
+}
+
+// Smallest chunk worth handing to a thread.
+constexpr uint64_t MIN_CHUNK_BYTES = 4ull << 20;
+
+void append(std::ostream& out, std::stringstream& chunk) {
+    // Streaming an empty buffer would set failbit on `out`.
+    if (chunk.tellp() > 0) out << chunk.rdbuf();
+}
+
+// Splits the log open in `file` into record-aligned chunks, formats each
+// into a fresh Chunk on `threads` threads with format(reader, chunk, index),
+// and hands the chunks to emit() in file order.  Chunks are formatted a
+// window at a time so memory stays bounded by a few chunks per thread.
+template <typename Chunk, typename Format, typename Emit>
+void forEachChunk(const std::string& filename, const cuas::LogReader& file, int threads,
+                  Format format, Emit emit) {
+    cuas::WorkerPool pool(threads);
+    const uint64_t fileBytes = std::filesystem::file_size(filename);
+    const size_t   target    = static_cast<size_t>(std::clamp<uint64_t>(
+        fileBytes / MIN_CHUNK_BYTES, 1, static_cast<uint64_t>(pool.numThreads()) * 8));
+    const std::vector<uint64_t> bounds = file.split(target);
+    const size_t n      = bounds.size() - 1;
+    const size_t window = static_cast<size_t>(pool.numThreads()) * 2;
+
+    std::vector<std::unique_ptr<Chunk>> chunks(window);
+    for (size_t first = 0; first < n && g_running.load(); first += window) {
+        const size_t count = std::min(window, n - first);
+        pool.parallelFor(count, 1, [&](size_t begin, size_t end) {
+            for (size_t k = begin; k < end; ++k) {
+                chunks[k] = std::make_unique<Chunk>();
+                cuas::LogReader reader;   // each thread its own mapping and position
+                if (!reader.open(filename)) continue;
+                reader.setByteRange(bounds[first + k], bounds[first + k + 1]);
+                format(reader, *chunks[k], first + k);
+            }
+        });
+        for (size_t k = 0; k < count; ++k) emit(*chunks[k]);
+    }
+}
+
 struct LogStats {
     std::map<cuas::LogRecordType, uint64_t> counts;
     uint64_t totalRecords = 0;
@@ -61,7 +134,7 @@ struct LogStats {
 };
 
 void printExtractedRecord(const cuas::LogRecordHeader& hdr,
-                           const std::vector<uint8_t>& payload) {
+                           const cuas::LogPayload& payload) {
     auto type = static_cast<cuas::LogRecordType>(hdr.recordType);
 
     std::cout << "[" << std::setw(15) << hdr.timestamp << "] "
@@ -178,12 +251,9 @@ void printExtractedRecord(const cuas::LogRecordHeader& hdr,
     std::cout << std::endl;
 }
 
-int extractMode(const std::string& filename, bool verbose) {
-    std::ifstream file(filename, std::ios::binary);
-    if (!file.is_open()) {
-        std::cerr << "ERROR: Cannot open file: " << filename << std::endl;
-        return 1;
-    }
+int extractMode(const std::string& filename, const LogRange& range, bool verbose) {
+    cuas::LogReader file;
+    if (!openLog(file, filename, range)) return 1;
 
     LogStats stats;
     cuas::LogRecordHeader hdr;
@@ -191,23 +261,8 @@ int extractMode(const std::string& filename, bool verbose) {
     std::cout << "=== Log Extraction: " << filename << " ===" << std::endl;
     std::cout << std::string(80, '-') << std::endl;
 
-    uint64_t corruptedRecords = 0;
-    while (g_running.load()) {
-        if (!cuas::BinaryLogger::readHeader(file, hdr)) {
-            if (file.eof()) break;
-            // Bad SOM or I/O error — attempt to resync to the next record.
-            if (!cuas::BinaryLogger::resyncToNextRecord(file)) break;
-            ++corruptedRecords;
-            continue;
-        }
-
-        std::vector<uint8_t> payload;
-        if (!cuas::BinaryLogger::readPayload(file, hdr.payloadSize, payload)) {
-            // Missing or wrong EOM — attempt to resync and continue.
-            if (!cuas::BinaryLogger::resyncToNextRecord(file)) break;
-            ++corruptedRecords;
-            continue;
-        }
+    cuas::LogPayload payload;
+    while (g_running.load() && file.next(hdr, payload)) {
 
         auto type = static_cast<cuas::LogRecordType>(hdr.recordType);
         stats.counts[type]++;
@@ -222,13 +277,14 @@ int extractMode(const std::string& filename, bool verbose) {
             printExtractedRecord(hdr, payload);
         }
     }
-    if (corruptedRecords > 0) {
-        std::cerr << "WARNING: " << corruptedRecords
+    if (file.corrupted() > 0) {
+        std::cerr << "WARNING: " << file.corrupted()
                   << " corrupted/truncated record(s) skipped.\n";
     }
 
     std::cout << std::string(80, '-') << std::endl;
     std::cout << "=== Summary ===" << std::endl;
+    std::cout << "Log format:    v" << file.version() << std::endl;
     std::cout << "Total records: " << stats.totalRecords << std::endl;
     std::cout << "Total bytes:   " << stats.totalBytes << std::endl;
 
@@ -248,12 +304,9 @@ int extractMode(const std::string& filename, bool verbose) {
 }
 
 int replayMode(const std::string& filename, const std::string& /*targetIp*/,
-               int /*targetPort*/, double speedFactor) {
-    std::ifstream file(filename, std::ios::binary);
-    if (!file.is_open()) {
-        std::cerr << "ERROR: Cannot open file: " << filename << std::endl;
-        return 1;
-    }
+               int /*targetPort*/, double speedFactor, const LogRange& range) {
+    cuas::LogReader file;
+    if (!openLog(file, filename, range)) return 1;
 
     // Publish replayed detections on the DDS "SPDetection" topic.
     cuas::CuasDdsParticipant participant;
@@ -269,22 +322,13 @@ int replayMode(const std::string& filename, const std::string& /*targetIp*/,
     cuas::Timestamp prevTs = 0;
     uint64_t sentCount = 0;
 
-    while (g_running.load()) {
-        if (!cuas::BinaryLogger::readHeader(file, hdr)) {
-            if (file.eof()) break;
-            if (!cuas::BinaryLogger::resyncToNextRecord(file)) break;
-            continue;
-        }
-        std::vector<uint8_t> payload;
-        if (!cuas::BinaryLogger::readPayload(file, hdr.payloadSize, payload)) {
-            if (!cuas::BinaryLogger::resyncToNextRecord(file)) break;
-            continue;
-        }
-
+    cuas::LogPayload payload;
+    while (g_running.load() && file.next(hdr, payload)) {
         auto type = static_cast<cuas::LogRecordType>(hdr.recordType);
 
         // Only replay raw detection records
         if (type == cuas::LogRecordType::RawDetection) {
+
             // Timing
             if (prevTs > 0 && hdr.timestamp > prevTs) {
                 double delaySec = (hdr.timestamp - prevTs) * 1e-6 / speedFactor;
@@ -337,83 +381,341 @@ int replayMode(const std::string& filename, const std::string& /*targetIp*/,
     return 0;
 }
 
-int csvMode(const std::string& filename) {
-    std::ifstream file(filename, std::ios::binary);
-    if (!file.is_open()) {
-        std::cerr << "ERROR: Cannot open file: " << filename << std::endl;
-        return 1;
+// One csv line per TrackSent record.
+void csvRecord(std::ostream& out, const cuas::LogRecordHeader& hdr, const cuas::LogPayload& payload) {
+    auto type = static_cast<cuas::LogRecordType>(hdr.recordType);
+
+    if (type == cuas::LogRecordType::TrackSent && payload.size() >= 124u) {
+        // Layout: msgId(4) trkId(4) ts(8) stat(4) cls(4) range(8) az(8) el(8)
+        //         rr(8) x(8) y(8) z(8) vx(8) vy(8) vz(8) qual(8) hits(4) miss(4) age(4)
+        const uint8_t* pm = payload.data();
+        uint32_t trkId, stat, cls, hits, miss, age;
+        double range, az, el, rr, x, y, z, vx, vy, vz, qual;
+        pm+=4; std::memcpy(&trkId,pm,4);pm+=4; pm+=8;
+        std::memcpy(&stat,pm,4);pm+=4; std::memcpy(&cls,pm,4);pm+=4;
+        std::memcpy(&range,pm,8);pm+=8; std::memcpy(&az,pm,8);pm+=8;
+        std::memcpy(&el,pm,8);pm+=8;   std::memcpy(&rr,pm,8);pm+=8;
+        std::memcpy(&x,pm,8);pm+=8;    std::memcpy(&y,pm,8);pm+=8;
+        std::memcpy(&z,pm,8);pm+=8;    std::memcpy(&vx,pm,8);pm+=8;
+        std::memcpy(&vy,pm,8);pm+=8;   std::memcpy(&vz,pm,8);pm+=8;
+        std::memcpy(&qual,pm,8);pm+=8;
+        std::memcpy(&hits,pm,4);pm+=4; std::memcpy(&miss,pm,4);pm+=4;
+        std::memcpy(&age,pm,4);
+
+        out << hdr.timestamp << ","
+            << recordTypeName(type) << ","
+            << trkId << ","
+            << std::fixed << std::setprecision(2)
+            << range << ","
+            << az * cuas::RAD2DEG << ","
+            << el * cuas::RAD2DEG << ","
+            << rr << ","
+            << x << "," << y << "," << z << ","
+            << vx << "," << vy << "," << vz << ","
+            << qual << ","
+            << hits << ","
+            << miss << ","
+            << age << ","
+            << stat << ","
+            << cls
+            << '\n';
     }
+}
 
-    cuas::LogRecordHeader hdr;
+int csvMode(const std::string& filename, const LogRange& range, int threads) {
+    cuas::LogReader file;
+    if (!openLog(file, filename, range)) return 1;
 
     // CSV header for track sent records
     std::cout << "timestamp,record_type,track_id,range,azimuth_deg,elevation_deg,"
               << "range_rate,x,y,z,vx,vy,vz,quality,hits,misses,age,status,class"
               << std::endl;
 
-    while (g_running.load()) {
-        if (!cuas::BinaryLogger::readHeader(file, hdr)) {
-            if (file.eof()) break;
-            if (!cuas::BinaryLogger::resyncToNextRecord(file)) break;
-            continue;
-        }
-        std::vector<uint8_t> payload;
-        if (!cuas::BinaryLogger::readPayload(file, hdr.payloadSize, payload)) {
-            if (!cuas::BinaryLogger::resyncToNextRecord(file)) break;
-            continue;
-        }
+    cuas::LogRecordHeader hdr;
+    cuas::LogPayload payload;
+    if (range.set || threads == 1) {
+        while (g_running.load() && file.next(hdr, payload)) csvRecord(std::cout, hdr, payload);
+        return 0;
+    }
 
-        auto type = static_cast<cuas::LogRecordType>(hdr.recordType);
+    struct CsvChunk {
+        std::stringstream out;
+    };
+    forEachChunk<CsvChunk>(filename, file, threads,
+        [](cuas::LogReader& chunk, CsvChunk& c, size_t) {
+            cuas::LogRecordHeader h;
+            cuas::LogPayload      pl;
+            while (g_running.load() && chunk.next(h, pl)) csvRecord(c.out, h, pl);
+        },
+        [](CsvChunk& c) { append(std::cout, c.out); });
+    return 0;
+}
 
-        if (type == cuas::LogRecordType::TrackSent && payload.size() >= 108u) {
-            // Layout: msgId(4) trkId(4) ts(8) stat(4) cls(4) range(8) az(8) el(8)
-            //         rr(8) x(8) y(8) z(8) vx(8) vy(8) vz(8) qual(8) hits(4) miss(4) age(4)
-            const uint8_t* pm = payload.data();
+// Column header of combined_track_flow.dat, written on the first data
+// record (or after RunInfo).
+const char* const DAT_COMBINED_HEADER =
+    "step\tdwell\ttimestamp_us\tnum_detections\tdet_idx\trange_m\tazimuth_deg\televation_deg\trange_rate"
+    "\tstrength\tnoise\tsnr\trcs\tmicroDoppler\tcluster_id\tassoc_distance\ttrack_id\tstatus\tclassification"
+    "\tx_m\ty_m\tz_m\tvx\tvy\tvz\tax\tay\taz\tquality\thits\tmisses\tage\n";
+
+// Formats records into the per-stage .dat streams: the files themselves, or
+// the in-memory buffers of one chunk of a parallel export.
+struct DatWriter {
+    std::ostream& fRaw;
+    std::ostream& fPre;
+    std::ostream& fCluster;
+    std::ostream& fPred;
+    std::ostream& fAssoc;
+    std::ostream& fInit;
+    std::ostream& fUpd;
+    std::ostream& fDel;
+    std::ostream& fSent;
+    std::ostream& fCombined;
+    bool     combinedHeaderWritten = false;
+    uint64_t records = 0;
+
+    void write(const cuas::LogRecordHeader& hdr, const cuas::LogPayload& payload,
+               uint32_t currentDwell);
+};
+
+void DatWriter::write(const cuas::LogRecordHeader& hdr, const cuas::LogPayload& payload,
+                      uint32_t currentDwell) {
+    ++records;
+
+    auto type = static_cast<cuas::LogRecordType>(hdr.recordType);
+    const uint8_t* p = payload.data();
+
+    // Run info: write algo/model details at top of combined file, then column header
+    if (type == cuas::LogRecordType::RunInfo) {
+        std::string runInfo(payload.begin(), payload.end());
+        std::istringstream lines(runInfo);
+        std::string line;
+        while (std::getline(lines, line))
+            fCombined << "# " << line << "\n";
+        fCombined << "\n";
+        fCombined << DAT_COMBINED_HEADER;
+        combinedHeaderWritten = true;
+        return;
+    }
+
+    if (!combinedHeaderWritten) {
+        fCombined << DAT_COMBINED_HEADER;
+        combinedHeaderWritten = true;
+    }
+
+    switch (type) {
+        case cuas::LogRecordType::RawDetection: {
+            if (payload.size() < 20) break;
+            uint32_t msgId, dwellCount, numDets; uint64_t ts;
+            std::memcpy(&msgId,      p, 4); p += 4;
+            std::memcpy(&dwellCount, p, 4); p += 4;
+            std::memcpy(&ts,         p, 8); p += 8;
+            std::memcpy(&numDets,    p, 4); p += 4;
+            for (uint32_t i = 0; i < numDets && p + sizeof(cuas::Detection) <= payload.data() + payload.size(); ++i) {
+                cuas::Detection d;
+                std::memcpy(&d, p, sizeof(d)); p += sizeof(d);
+                fRaw << std::fixed << std::setprecision(4)
+                     << hdr.timestamp << "\t" << dwellCount << "\t" << numDets << "\t" << i
+                     << "\t" << d.range << "\t" << d.azimuth * cuas::RAD2DEG
+                     << "\t" << d.elevation * cuas::RAD2DEG
+                     << "\t" << d.strength << "\t" << d.noise
+                     << "\t" << d.snr << "\t" << d.rcs << "\t" << d.microDoppler << "\n";
+                fCombined << std::fixed << std::setprecision(4)
+                          << "raw\t" << currentDwell << "\t" << hdr.timestamp << "\t"
+                          << numDets << "\t" << i << "\t" << d.range << "\t" << d.azimuth * cuas::RAD2DEG
+                          << "\t" << d.elevation * cuas::RAD2DEG << "\t\t"
+                          << d.strength << "\t" << d.noise << "\t" << d.snr << "\t" << d.rcs << "\t" << d.microDoppler
+                          << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
+            }
+            break;
+        }
+        case cuas::LogRecordType::Preprocessed: {
+            if (payload.size() < 4) break;
+            uint32_t n; std::memcpy(&n, p, 4); p += 4;
+            for (uint32_t i = 0; i < n && p + sizeof(cuas::Detection) <= payload.data() + payload.size(); ++i) {
+                cuas::Detection d;
+                std::memcpy(&d, p, sizeof(d)); p += sizeof(d);
+                fPre << std::fixed << std::setprecision(4)
+                     << hdr.timestamp << "\t" << n << "\t" << i
+                     << "\t" << d.range << "\t" << d.azimuth * cuas::RAD2DEG
+                     << "\t" << d.elevation * cuas::RAD2DEG
+                     << "\t" << d.strength << "\t" << d.noise
+                     << "\t" << d.snr << "\t" << d.rcs << "\t" << d.microDoppler << "\n";
+                fCombined << std::fixed << std::setprecision(4)
+                          << "preprocessed\t" << currentDwell << "\t" << hdr.timestamp << "\t"
+                          << n << "\t" << i << "\t" << d.range << "\t" << d.azimuth * cuas::RAD2DEG
+                          << "\t" << d.elevation * cuas::RAD2DEG << "\t\t"
+                          << d.strength << "\t" << d.noise << "\t" << d.snr << "\t" << d.rcs << "\t" << d.microDoppler
+                          << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
+            }
+            break;
+        }
+        case cuas::LogRecordType::Clustered: {
+            if (payload.size() < 4) break;
+            uint32_t n; std::memcpy(&n, p, 4); p += 4;
+            for (uint32_t i = 0; i < n; ++i) {
+                if (p + 4 > payload.data() + payload.size()) break;
+                uint32_t cid; std::memcpy(&cid, p, 4); p += 4;
+                double r, az, el, str, snr, rcs, ud; uint32_t nd;
+                double cx, cy, cz;
+                std::memcpy(&r,   p, 8); p += 8;
+                std::memcpy(&az,  p, 8); p += 8;
+                std::memcpy(&el,  p, 8); p += 8;
+                std::memcpy(&str, p, 8); p += 8;
+                std::memcpy(&snr, p, 8); p += 8;
+                std::memcpy(&rcs, p, 8); p += 8;
+                std::memcpy(&ud,  p, 8); p += 8;
+                std::memcpy(&nd,  p, 4); p += 4;
+                std::memcpy(&cx,  p, 8); p += 8;
+                std::memcpy(&cy,  p, 8); p += 8;
+                std::memcpy(&cz,  p, 8); p += 8;
+                // Skip detectionIndices
+                uint32_t ni; std::memcpy(&ni, p, 4); p += 4;
+                p += ni * sizeof(uint32_t);
+                fCluster << std::fixed << std::setprecision(4)
+                         << hdr.timestamp << "\t" << cid << "\t" << nd
+                         << "\t" << r << "\t" << az * cuas::RAD2DEG
+                         << "\t" << el * cuas::RAD2DEG
+                         << "\t" << str << "\t" << snr << "\t" << rcs << "\t" << ud
+                         << "\t" << cx << "\t" << cy << "\t" << cz << "\n";
+                fCombined << std::fixed << std::setprecision(4)
+                          << "clustering\t" << currentDwell << "\t" << hdr.timestamp << "\t"
+                          << nd << "\t\t" << r << "\t" << az * cuas::RAD2DEG << "\t" << el * cuas::RAD2DEG << "\t\t"
+                          << str << "\t\t" << snr << "\t" << rcs << "\t" << ud << "\t"
+                          << cid << "\t\t\t\t\t\t"
+                          << cx << "\t" << cy << "\t" << cz << "\t\t\t\t\t\t\t\t\t\t\n";
+            }
+            break;
+        }
+        case cuas::LogRecordType::Predicted: {
+            if (payload.size() < 4 + cuas::STATE_DIM * 8) break;
+            uint32_t tid; std::memcpy(&tid, p, 4); p += 4;
+            double sv[cuas::STATE_DIM];
+            for (int i = 0; i < cuas::STATE_DIM; ++i) { std::memcpy(&sv[i], p, 8); p += 8; }
+            fPred << std::fixed << std::setprecision(4)
+                  << hdr.timestamp << "\t" << tid
+                  << "\t" << sv[0] << "\t" << sv[1] << "\t" << sv[2]
+                  << "\t" << sv[3] << "\t" << sv[4] << "\t" << sv[5]
+                  << "\t" << sv[6] << "\t" << sv[7] << "\t" << sv[8] << "\n";
+            fCombined << std::fixed << std::setprecision(4)
+                      << "prediction\t" << currentDwell << "\t" << hdr.timestamp << "\t"
+                      << "\t\t\t\t\t\t\t\t\t\t\t\t\t"
+                      << tid << "\t\t\t\t"
+                      << sv[0] << "\t" << sv[3] << "\t" << sv[6] << "\t"
+                      << sv[1] << "\t" << sv[4] << "\t" << sv[7] << "\t"
+                      << sv[2] << "\t" << sv[5] << "\t" << sv[8] << "\t\t\t\t\t\n";
+            break;
+        }
+        case cuas::LogRecordType::Associated: {
+            if (payload.size() < 16) break;
+            uint32_t tid, cid; double dist;
+            std::memcpy(&tid,  p, 4); p += 4;
+            std::memcpy(&cid,  p, 4); p += 4;
+            std::memcpy(&dist, p, 8);
+            fAssoc << std::fixed << std::setprecision(4)
+                   << hdr.timestamp << "\t" << tid << "\t" << cid << "\t" << dist << "\n";
+            fCombined << std::fixed << std::setprecision(4)
+                      << "association\t" << currentDwell << "\t" << hdr.timestamp << "\t"
+                      << "\t\t\t\t\t\t\t\t\t\t\t"
+                      << cid << "\t" << dist << "\t" << tid << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
+            break;
+        }
+        case cuas::LogRecordType::TrackInitiated: {
+            if (payload.size() < 4 + cuas::STATE_DIM * 8) break;
+            uint32_t tid; std::memcpy(&tid, p, 4); p += 4;
+            double sv[cuas::STATE_DIM];
+            for (int i = 0; i < cuas::STATE_DIM; ++i) { std::memcpy(&sv[i], p, 8); p += 8; }
+            fInit << std::fixed << std::setprecision(4)
+                  << hdr.timestamp << "\t" << tid
+                  << "\t" << sv[0] << "\t" << sv[1] << "\t" << sv[2]
+                  << "\t" << sv[3] << "\t" << sv[4] << "\t" << sv[5]
+                  << "\t" << sv[6] << "\t" << sv[7] << "\t" << sv[8] << "\n";
+            fCombined << std::fixed << std::setprecision(4)
+                      << "track_init\t" << currentDwell << "\t" << hdr.timestamp << "\t"
+                      << "\t\t\t\t\t\t\t\t\t\t\t\t\t"
+                      << tid << "\t\t\t\t"
+                      << sv[0] << "\t" << sv[3] << "\t" << sv[6] << "\t"
+                      << sv[1] << "\t" << sv[4] << "\t" << sv[7] << "\t"
+                      << sv[2] << "\t" << sv[5] << "\t" << sv[8] << "\t\t\t\t\t\n";
+            break;
+        }
+        case cuas::LogRecordType::TrackUpdated: {
+            if (payload.size() < 8 + cuas::STATE_DIM * 8) break;
+            uint32_t tid, status; std::memcpy(&tid, p, 4); p += 4;
+            std::memcpy(&status, p, 4); p += 4;
+            double sv[cuas::STATE_DIM];
+            for (int i = 0; i < cuas::STATE_DIM; ++i) { std::memcpy(&sv[i], p, 8); p += 8; }
+            fUpd << std::fixed << std::setprecision(4)
+                 << hdr.timestamp << "\t" << tid << "\t" << status
+                 << "\t" << sv[0] << "\t" << sv[1] << "\t" << sv[2]
+                 << "\t" << sv[3] << "\t" << sv[4] << "\t" << sv[5]
+                 << "\t" << sv[6] << "\t" << sv[7] << "\t" << sv[8] << "\n";
+            fCombined << std::fixed << std::setprecision(4)
+                      << "update\t" << currentDwell << "\t" << hdr.timestamp << "\t"
+                      << "\t\t\t\t\t\t\t\t\t\t\t\t\t"
+                      << tid << "\t" << status << "\t\t"
+                      << sv[0] << "\t" << sv[3] << "\t" << sv[6] << "\t"
+                      << sv[1] << "\t" << sv[4] << "\t" << sv[7] << "\t"
+                      << sv[2] << "\t" << sv[5] << "\t" << sv[8] << "\t\t\t\t\t\n";
+            break;
+        }
+        case cuas::LogRecordType::TrackDeleted: {
+            if (payload.size() < 4) break;
+            uint32_t tid; std::memcpy(&tid, p, 4);
+            fDel << hdr.timestamp << "\t" << tid << "\n";
+            fCombined << "track_delete\t" << currentDwell << "\t" << hdr.timestamp << "\t"
+                      << "\t\t\t\t\t\t\t\t\t\t\t\t\t" << tid << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
+            break;
+        }
+        case cuas::LogRecordType::TrackSent: {
+            if (payload.size() < 124u) break;
+            // Layout: msgId(4) trkId(4) ts(8) stat(4) cls(4)
+            //         range(8) az(8) el(8) rr(8) x(8) y(8) z(8)
+            //         vx(8) vy(8) vz(8) qual(8) hits(4) miss(4) age(4)
             uint32_t trkId, stat, cls, hits, miss, age;
-            double range, az, el, rr, x, y, z, vx, vy, vz, qual;
-            pm+=4; std::memcpy(&trkId,pm,4);pm+=4; pm+=8;
-            std::memcpy(&stat,pm,4);pm+=4; std::memcpy(&cls,pm,4);pm+=4;
-            std::memcpy(&range,pm,8);pm+=8; std::memcpy(&az,pm,8);pm+=8;
-            std::memcpy(&el,pm,8);pm+=8;   std::memcpy(&rr,pm,8);pm+=8;
-            std::memcpy(&x,pm,8);pm+=8;    std::memcpy(&y,pm,8);pm+=8;
-            std::memcpy(&z,pm,8);pm+=8;    std::memcpy(&vx,pm,8);pm+=8;
-            std::memcpy(&vy,pm,8);pm+=8;   std::memcpy(&vz,pm,8);pm+=8;
-            std::memcpy(&qual,pm,8);pm+=8;
-            std::memcpy(&hits,pm,4);pm+=4; std::memcpy(&miss,pm,4);pm+=4;
-            std::memcpy(&age,pm,4);
-
-            std::cout << hdr.timestamp << ","
-                      << recordTypeName(type) << ","
-                      << trkId << ","
-                      << std::fixed << std::setprecision(2)
-                      << range << ","
-                      << az * cuas::RAD2DEG << ","
-                      << el * cuas::RAD2DEG << ","
-                      << rr << ","
-                      << x << "," << y << "," << z << ","
-                      << vx << "," << vy << "," << vz << ","
-                      << qual << ","
-                      << hits << ","
-                      << miss << ","
-                      << age << ","
-                      << stat << ","
-                      << cls
-                      << std::endl;
+            double range, az, el, rr, mx, my, mz, mvx, mvy, mvz, qual;
+            p+=4; std::memcpy(&trkId,p,4);p+=4; p+=8;
+            std::memcpy(&stat,p,4);p+=4; std::memcpy(&cls,p,4);p+=4;
+            std::memcpy(&range,p,8);p+=8; std::memcpy(&az,p,8);p+=8;
+            std::memcpy(&el,p,8);p+=8;   std::memcpy(&rr,p,8);p+=8;
+            std::memcpy(&mx,p,8);p+=8;   std::memcpy(&my,p,8);p+=8;
+            std::memcpy(&mz,p,8);p+=8;   std::memcpy(&mvx,p,8);p+=8;
+            std::memcpy(&mvy,p,8);p+=8;  std::memcpy(&mvz,p,8);p+=8;
+            std::memcpy(&qual,p,8);p+=8;
+            std::memcpy(&hits,p,4);p+=4; std::memcpy(&miss,p,4);p+=4;
+            std::memcpy(&age,p,4);
+            fSent << std::fixed << std::setprecision(4)
+                  << hdr.timestamp << "\t" << trkId
+                  << "\t" << stat << "\t" << cls
+                  << "\t" << range
+                  << "\t" << az * cuas::RAD2DEG
+                  << "\t" << el * cuas::RAD2DEG
+                  << "\t" << rr
+                  << "\t" << mx << "\t" << my << "\t" << mz
+                  << "\t" << mvx << "\t" << mvy << "\t" << mvz
+                  << "\t" << qual
+                  << "\t" << hits << "\t" << miss << "\t" << age << "\n";
+            fCombined << std::fixed << std::setprecision(4)
+                      << "sender\t" << currentDwell << "\t" << hdr.timestamp << "\t"
+                      << "\t\t" << range << "\t" << az * cuas::RAD2DEG
+                      << "\t" << el * cuas::RAD2DEG << "\t" << rr << "\t\t\t\t\t\t\t\t\t\t"
+                      << trkId << "\t" << stat << "\t" << cls << "\t"
+                      << mx << "\t" << my << "\t" << mz << "\t"
+                      << mvx << "\t" << mvy << "\t" << mvz << "\t\t\t\t\t"
+                      << qual << "\t" << hits << "\t" << miss << "\t" << age << "\n";
+            break;
         }
+        default: break;
     }
-
-    return 0;
 }
 
 // ---------------------------------------------------------------------------
 // dat mode: export per-stage .dat files to an output directory
 // ---------------------------------------------------------------------------
-int datMode(const std::string& filename, const std::string& outDir) {
-    std::ifstream file(filename, std::ios::binary);
-    if (!file.is_open()) {
-        std::cerr << "ERROR: Cannot open file: " << filename << std::endl;
-        return 1;
-    }
+int datMode(const std::string& filename, const LogRange& range, const std::string& outDir,
+            int threads) {
+    cuas::LogReader file;
+    if (!openLog(file, filename, range)) return 1;
 
     // Create output directory (use filesystem::path for Windows compatibility)
     std::filesystem::path outPath(outDir);
@@ -455,99 +757,146 @@ int datMode(const std::string& filename, const std::string& outDir) {
     fSent    << "timestamp\ttrack_id\tstatus\tclassification\trange\tazimuth_deg\televation_deg"
              << "\trange_rate\tx\ty\tz\tvx\tvy\tvz\tquality\thits\tmisses\tage\n";
 
-    // Combined header written on first data record (or after RunInfo)
-    const char* combinedHeader =
-        "step\tdwell\ttimestamp_us\tnum_detections\tdet_idx\trange_m\tazimuth_deg\televation_deg\trange_rate"
-        "\tstrength\tnoise\tsnr\trcs\tmicroDoppler\tcluster_id\tassoc_distance\ttrack_id\tstatus\tclassification"
-        "\tx_m\ty_m\tz_m\tvx\tvy\tvz\tax\tay\taz\tquality\thits\tmisses\tage\n";
-    bool combinedHeaderWritten = false;
+    uint64_t records = 0, corrupted = 0;
+    if (range.set || threads == 1) {
+        DatWriter out{fRaw, fPre, fCluster, fPred, fAssoc, fInit, fUpd, fDel, fSent, fCombined};
+        cuas::LogRecordHeader hdr;
+        cuas::LogPayload payload;
+        while (g_running.load() && file.next(hdr, payload)) out.write(hdr, payload, file.dwell());
+        records   = out.records;
+        corrupted = file.corrupted();
+    } else {
+        struct DatChunk {
+            std::stringstream raw, pre, cluster, pred, assoc, init, upd, del, sent, combined;
+            DatWriter out{raw, pre, cluster, pred, assoc, init, upd, del, sent, combined};
+            uint64_t  corrupted = 0;
+        };
+        forEachChunk<DatChunk>(filename, file, threads,
+            [](cuas::LogReader& chunk, DatChunk& c, size_t index) {
+                // RunInfo, and so the combined header, only ever opens the first chunk.
+                c.out.combinedHeaderWritten = index > 0;
+                cuas::LogRecordHeader hdr;
+                cuas::LogPayload payload;
+                while (g_running.load() && chunk.next(hdr, payload))
+                    c.out.write(hdr, payload, chunk.dwell());
+                c.corrupted = chunk.corrupted();
+            },
+            [&](DatChunk& c) {
+                append(fRaw, c.raw);         append(fPre, c.pre);
+                append(fCluster, c.cluster); append(fPred, c.pred);
+                append(fAssoc, c.assoc);     append(fInit, c.init);
+                append(fUpd, c.upd);         append(fDel, c.del);
+                append(fSent, c.sent);       append(fCombined, c.combined);
+                records   += c.out.records;
+                corrupted += c.corrupted;
+            });
+    }
 
-    cuas::LogRecordHeader hdr;
-    uint64_t records = 0;
-    uint64_t corruptedDat = 0;
-    uint32_t currentDwell = 0;
-
-    while (g_running.load()) {
-        if (!cuas::BinaryLogger::readHeader(file, hdr)) {
-            if (file.eof()) break;
-            if (!cuas::BinaryLogger::resyncToNextRecord(file)) break;
-            ++corruptedDat;
-            continue;
-        }
-        std::vector<uint8_t> payload;
-        if (!cuas::BinaryLogger::readPayload(file, hdr.payloadSize, payload)) {
-            if (!cuas::BinaryLogger::resyncToNextRecord(file)) break;
-            ++corruptedDat;
-            continue;
-        }
-        ++records;
+    std::cout << "Exported " << records << " records to: " << outDir << std::endl;
+    std::cout << "  raw_detections.dat  preprocessed.dat  clusters.dat" << std::endl;
+    std::cout << "  predictions.dat     associations.dat" << std::endl;
+    std::cout << "  tracks_initiated.dat  tracks_updated.dat  tracks_deleted.dat  tracks_sent.dat" << std::endl;
+    std::cout << "  combined_track_flow.dat (all steps in dwell-wise order)" << std::endl;
+    if (corrupted > 0)
+        std::cerr << "WARNING: " << corrupted << " corrupted/truncated record(s) skipped.\n";
+    return 0;
+}
 
-        auto type = static_cast<cuas::LogRecordType>(hdr.recordType);
-        const uint8_t* p = payload.data();
-
-        // Run info: write algo/model details at top of combined file, then column header
-        if (type == cuas::LogRecordType::RunInfo) {
-            std::string runInfo(payload.begin(), payload.end());
-            std::istringstream lines(runInfo);
-            std::string line;
-            while (std::getline(lines, line))
-                fCombined << "# " << line << "\n";
-            fCombined << "\n";
-            fCombined << combinedHeader;
-            combinedHeaderWritten = true;
-            continue;
-        }
+// ---------------------------------------------------------------------------
+// arrow mode: export each record type as a typed Arrow IPC (Feather v2) table
+// ---------------------------------------------------------------------------
+int arrowMode(const std::string& filename, const LogRange& range, const std::string& outDir) {
+    cuas::LogReader file;
+    if (!openLog(file, filename, range)) return 1;
 
-        if (!combinedHeaderWritten) {
-            fCombined << combinedHeader;
-            combinedHeaderWritten = true;
+    std::filesystem::path outPath(outDir);
+    std::error_code ec;
+    std::filesystem::create_directories(outPath, ec);
+    if (ec) {
+        std::cerr << "ERROR: Cannot create output directory: " << outDir << " - " << ec.message() << std::endl;
+        return 1;
+    }
+
+    using cuas::ArrowType;
+    const std::vector<std::string> statusNames{"tentative", "confirmed", "coasting", "deleted"};
+    const std::vector<std::string> classNames{"unknown", "drone_rotary", "drone_fixed_wing",
+                                              "bird", "clutter"};
+    // timestamp and dwell lead every table, so tables join on either.
+    auto table = [](std::initializer_list<cuas::ArrowColumn> ints,
+                    std::initializer_list<const char*> doubles) {
+        std::vector<cuas::ArrowColumn> cols{{"timestamp", ArrowType::UInt64, {}},
+                                            {"dwell", ArrowType::UInt32, {}}};
+        cols.insert(cols.end(), ints);
+        for (const char* name : doubles) cols.push_back({name, ArrowType::Float64, {}});
+        return cols;
+    };
+    const cuas::ArrowColumn trackId{"track_id", ArrowType::UInt32, {}};
+    const cuas::ArrowColumn status{"status", ArrowType::Dictionary, statusNames};
+    const std::initializer_list<const char*> detection{
+        "range", "azimuth_deg", "elevation_deg", "strength", "noise", "snr", "rcs", "microDoppler"};
+    const std::initializer_list<const char*> state{"x", "vx", "ax", "y", "vy", "ay", "z", "vz", "az"};
+
+    const std::vector<std::pair<std::string, std::vector<cuas::ArrowColumn>>> tables{
+        {"raw_detections", table({{"num_detections", ArrowType::UInt32, {}},
+                                  {"det_idx", ArrowType::UInt32, {}}}, detection)},
+        {"preprocessed", table({{"num_detections", ArrowType::UInt32, {}},
+                                {"det_idx", ArrowType::UInt32, {}}}, detection)},
+        {"clusters", table({{"cluster_id", ArrowType::UInt32, {}},
+                            {"num_detections", ArrowType::UInt32, {}}},
+                           {"range", "azimuth_deg", "elevation_deg", "strength", "snr", "rcs",
+                            "microDoppler", "x", "y", "z"})},
+        {"predictions", table({trackId}, state)},
+        {"associations", table({trackId, {"cluster_id", ArrowType::UInt32, {}}}, {"distance"})},
+        {"tracks_initiated", table({trackId}, state)},
+        {"tracks_updated", table({trackId, status}, state)},
+        {"tracks_deleted", table({trackId}, {})},
+        {"tracks_sent", table({trackId, status, {"classification", ArrowType::Dictionary, classNames},
+                               {"hits", ArrowType::UInt32, {}}, {"misses", ArrowType::UInt32, {}},
+                               {"age", ArrowType::UInt32, {}}},
+                              {"range", "azimuth_deg", "elevation_deg", "range_rate",
+                               "x", "y", "z", "vx", "vy", "vz", "quality"})},
+    };
+    cuas::ArrowFileWriter out[9];
+    for (size_t i = 0; i < tables.size(); ++i) {
+        const std::string path = (outPath / (tables[i].first + ".arrow")).string();
+        if (!out[i].open(path, tables[i].second)) {
+            std::cerr << "ERROR: Cannot create " << path << std::endl;
+            return 1;
         }
+    }
+    cuas::ArrowFileWriter& fRaw     = out[0];
+    cuas::ArrowFileWriter& fPre     = out[1];
+    cuas::ArrowFileWriter& fCluster = out[2];
+    cuas::ArrowFileWriter& fPred    = out[3];
+    cuas::ArrowFileWriter& fAssoc   = out[4];
+    cuas::ArrowFileWriter& fInit    = out[5];
+    cuas::ArrowFileWriter& fUpd     = out[6];
+    cuas::ArrowFileWriter& fDel     = out[7];
+    cuas::ArrowFileWriter& fSent    = out[8];
 
-        switch (type) {
-            case cuas::LogRecordType::RawDetection: {
-                if (payload.size() < 20) break;
-                uint32_t msgId, dwellCount, numDets; uint64_t ts;
-                std::memcpy(&msgId,      p, 4); p += 4;
-                std::memcpy(&dwellCount, p, 4); p += 4;
-                currentDwell = dwellCount;
-                std::memcpy(&ts,         p, 8); p += 8;
-                std::memcpy(&numDets,    p, 4); p += 4;
-                for (uint32_t i = 0; i < numDets && p + sizeof(cuas::Detection) <= payload.data() + payload.size(); ++i) {
-                    cuas::Detection d;
-                    std::memcpy(&d, p, sizeof(d)); p += sizeof(d);
-                    fRaw << std::fixed << std::setprecision(4)
-                         << hdr.timestamp << "\t" << dwellCount << "\t" << numDets << "\t" << i
-                         << "\t" << d.range << "\t" << d.azimuth * cuas::RAD2DEG
-                         << "\t" << d.elevation * cuas::RAD2DEG
-                         << "\t" << d.strength << "\t" << d.noise
-                         << "\t" << d.snr << "\t" << d.rcs << "\t" << d.microDoppler << "\n";
-                    fCombined << std::fixed << std::setprecision(4)
-                              << "raw\t" << currentDwell << "\t" << hdr.timestamp << "\t"
-                              << numDets << "\t" << i << "\t" << d.range << "\t" << d.azimuth * cuas::RAD2DEG
-                              << "\t" << d.elevation * cuas::RAD2DEG << "\t\t"
-                              << d.strength << "\t" << d.noise << "\t" << d.snr << "\t" << d.rcs << "\t" << d.microDoppler
-                              << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                }
-                break;
-            }
+    cuas::LogRecordHeader hdr;
+    cuas::LogPayload payload;
+    uint64_t records = 0;
+    while (g_running.load() && file.next(hdr, payload)) {
+        ++records;
+        const uint64_t ts    = hdr.timestamp;
+        const uint32_t dwell = file.dwell();
+        const uint8_t* p     = payload.data();
+        const uint8_t* end   = payload.data() + payload.size();
+
+        switch (static_cast<cuas::LogRecordType>(hdr.recordType)) {
+            case cuas::LogRecordType::RawDetection:
             case cuas::LogRecordType::Preprocessed: {
-                if (payload.size() < 4) break;
+                const bool raw = hdr.recordType == static_cast<uint32_t>(cuas::LogRecordType::RawDetection);
+                if (payload.size() < (raw ? 20u : 4u)) break;
+                if (raw) p += 16;          // msgId, dwellCount, timestamp
                 uint32_t n; std::memcpy(&n, p, 4); p += 4;
-                for (uint32_t i = 0; i < n && p + sizeof(cuas::Detection) <= payload.data() + payload.size(); ++i) {
+                for (uint32_t i = 0; i < n && p + sizeof(cuas::Detection) <= end; ++i) {
                     cuas::Detection d;
                     std::memcpy(&d, p, sizeof(d)); p += sizeof(d);
-                    fPre << std::fixed << std::setprecision(4)
-                         << hdr.timestamp << "\t" << n << "\t" << i
-                         << "\t" << d.range << "\t" << d.azimuth * cuas::RAD2DEG
-                         << "\t" << d.elevation * cuas::RAD2DEG
-                         << "\t" << d.strength << "\t" << d.noise
-                         << "\t" << d.snr << "\t" << d.rcs << "\t" << d.microDoppler << "\n";
-                    fCombined << std::fixed << std::setprecision(4)
-                              << "preprocessed\t" << currentDwell << "\t" << hdr.timestamp << "\t"
-                              << n << "\t" << i << "\t" << d.range << "\t" << d.azimuth * cuas::RAD2DEG
-                              << "\t" << d.elevation * cuas::RAD2DEG << "\t\t"
-                              << d.strength << "\t" << d.noise << "\t" << d.snr << "\t" << d.rcs << "\t" << d.microDoppler
-                              << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
+                    (raw ? fRaw : fPre).append({ts, dwell, n, i, d.range, d.azimuth * cuas::RAD2DEG,
+                                                d.elevation * cuas::RAD2DEG, d.strength, d.noise,
+                                                d.snr, d.rcs, d.microDoppler});
                 }
                 break;
             }
@@ -555,56 +904,29 @@ int datMode(const std::string& filename, const std::string& outDir) {
                 if (payload.size() < 4) break;
                 uint32_t n; std::memcpy(&n, p, 4); p += 4;
                 for (uint32_t i = 0; i < n; ++i) {
-                    if (p + 4 > payload.data() + payload.size()) break;
-                    uint32_t cid; std::memcpy(&cid, p, 4); p += 4;
-                    double r, az, el, str, snr, rcs, ud; uint32_t nd;
-                    double cx, cy, cz;
-                    std::memcpy(&r,   p, 8); p += 8;
-                    std::memcpy(&az,  p, 8); p += 8;
-                    std::memcpy(&el,  p, 8); p += 8;
-                    std::memcpy(&str, p, 8); p += 8;
-                    std::memcpy(&snr, p, 8); p += 8;
-                    std::memcpy(&rcs, p, 8); p += 8;
-                    std::memcpy(&ud,  p, 8); p += 8;
-                    std::memcpy(&nd,  p, 4); p += 4;
-                    std::memcpy(&cx,  p, 8); p += 8;
-                    std::memcpy(&cy,  p, 8); p += 8;
-                    std::memcpy(&cz,  p, 8); p += 8;
-                    // Skip detectionIndices
-                    uint32_t ni; std::memcpy(&ni, p, 4); p += 4;
+                    // cid, 7 doubles, numDetections, x y z, then the detection indices
+                    if (p + 4 + 7 * 8 + 4 + 3 * 8 + 4 > end) break;
+                    uint32_t cid, nd, ni;
+                    double v[10];
+                    std::memcpy(&cid, p, 4); p += 4;
+                    std::memcpy(v, p, 7 * 8); p += 7 * 8;
+                    std::memcpy(&nd, p, 4); p += 4;
+                    std::memcpy(v + 7, p, 3 * 8); p += 3 * 8;
+                    std::memcpy(&ni, p, 4); p += 4;
                     p += ni * sizeof(uint32_t);
-                    fCluster << std::fixed << std::setprecision(4)
-                             << hdr.timestamp << "\t" << cid << "\t" << nd
-                             << "\t" << r << "\t" << az * cuas::RAD2DEG
-                             << "\t" << el * cuas::RAD2DEG
-                             << "\t" << str << "\t" << snr << "\t" << rcs << "\t" << ud
-                             << "\t" << cx << "\t" << cy << "\t" << cz << "\n";
-                    fCombined << std::fixed << std::setprecision(4)
-                              << "clustering\t" << currentDwell << "\t" << hdr.timestamp << "\t"
-                              << nd << "\t\t" << r << "\t" << az * cuas::RAD2DEG << "\t" << el * cuas::RAD2DEG << "\t\t"
-                              << str << "\t\t" << snr << "\t" << rcs << "\t" << ud << "\t"
-                              << cid << "\t\t\t\t\t\t"
-                              << cx << "\t" << cy << "\t" << cz << "\t\t\t\t\t\t\t\t\t\t\t\n";
+                    fCluster.append({ts, dwell, cid, nd, v[0], v[1] * cuas::RAD2DEG, v[2] * cuas::RAD2DEG,
+                                     v[3], v[4], v[5], v[6], v[7], v[8], v[9]});
                 }
                 break;
             }
-            case cuas::LogRecordType::Predicted: {
+            case cuas::LogRecordType::Predicted:
+            case cuas::LogRecordType::TrackInitiated: {
                 if (payload.size() < 4 + cuas::STATE_DIM * 8) break;
                 uint32_t tid; std::memcpy(&tid, p, 4); p += 4;
                 double sv[cuas::STATE_DIM];
-                for (int i = 0; i < cuas::STATE_DIM; ++i) { std::memcpy(&sv[i], p, 8); p += 8; }
-                fPred << std::fixed << std::setprecision(4)
-                      << hdr.timestamp << "\t" << tid
-                      << "\t" << sv[0] << "\t" << sv[1] << "\t" << sv[2]
-                      << "\t" << sv[3] << "\t" << sv[4] << "\t" << sv[5]
-                      << "\t" << sv[6] << "\t" << sv[7] << "\t" << sv[8] << "\n";
-                fCombined << std::fixed << std::setprecision(4)
-                          << "prediction\t" << currentDwell << "\t" << hdr.timestamp << "\t"
-                          << "\t\t\t\t\t\t\t\t\t\t\t\t\t"
-                          << tid << "\t\t\t\t"
-                          << sv[0] << "\t" << sv[3] << "\t" << sv[6] << "\t"
-                          << sv[1] << "\t" << sv[4] << "\t" << sv[7] << "\t"
-                          << sv[2] << "\t" << sv[5] << "\t" << sv[8] << "\t\t\t\t\t\n";
+                std::memcpy(sv, p, sizeof(sv));
+                (hdr.recordType == static_cast<uint32_t>(cuas::LogRecordType::Predicted) ? fPred : fInit)
+                    .append({ts, dwell, tid, sv[0], sv[1], sv[2], sv[3], sv[4], sv[5], sv[6], sv[7], sv[8]});
                 break;
             }
             case cuas::LogRecordType::Associated: {
@@ -613,110 +935,97 @@ int datMode(const std::string& filename, const std::string& outDir) {
                 std::memcpy(&tid,  p, 4); p += 4;
                 std::memcpy(&cid,  p, 4); p += 4;
                 std::memcpy(&dist, p, 8);
-                fAssoc << std::fixed << std::setprecision(4)
-                       << hdr.timestamp << "\t" << tid << "\t" << cid << "\t" << dist << "\n";
-                fCombined << std::fixed << std::setprecision(4)
-                          << "association\t" << currentDwell << "\t" << hdr.timestamp << "\t"
-                          << "\t\t\t\t\t\t\t\t\t\t\t"
-                          << cid << "\t" << dist << "\t" << tid << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
-                break;
-            }
-            case cuas::LogRecordType::TrackInitiated: {
-                if (payload.size() < 4 + cuas::STATE_DIM * 8) break;
-                uint32_t tid; std::memcpy(&tid, p, 4); p += 4;
-                double sv[cuas::STATE_DIM];
-                for (int i = 0; i < cuas::STATE_DIM; ++i) { std::memcpy(&sv[i], p, 8); p += 8; }
-                fInit << std::fixed << std::setprecision(4)
-                      << hdr.timestamp << "\t" << tid
-                      << "\t" << sv[0] << "\t" << sv[1] << "\t" << sv[2]
-                      << "\t" << sv[3] << "\t" << sv[4] << "\t" << sv[5]
-                      << "\t" << sv[6] << "\t" << sv[7] << "\t" << sv[8] << "\n";
-                fCombined << std::fixed << std::setprecision(4)
-                          << "track_init\t" << currentDwell << "\t" << hdr.timestamp << "\t"
-                          << "\t\t\t\t\t\t\t\t\t\t\t\t\t"
-                          << tid << "\t\t\t\t"
-                          << sv[0] << "\t" << sv[3] << "\t" << sv[6] << "\t"
-                          << sv[1] << "\t" << sv[4] << "\t" << sv[7] << "\t"
-                          << sv[2] << "\t" << sv[5] << "\t" << sv[8] << "\t\t\t\t\t\n";
+                fAssoc.append({ts, dwell, tid, cid, dist});
                 break;
             }
             case cuas::LogRecordType::TrackUpdated: {
                 if (payload.size() < 8 + cuas::STATE_DIM * 8) break;
-                uint32_t tid, status; std::memcpy(&tid, p, 4); p += 4;
-                std::memcpy(&status, p, 4); p += 4;
+                uint32_t tid, stat;
+                std::memcpy(&tid,  p, 4); p += 4;
+                std::memcpy(&stat, p, 4); p += 4;
                 double sv[cuas::STATE_DIM];
-                for (int i = 0; i < cuas::STATE_DIM; ++i) { std::memcpy(&sv[i], p, 8); p += 8; }
-                fUpd << std::fixed << std::setprecision(4)
-                     << hdr.timestamp << "\t" << tid << "\t" << status
-                     << "\t" << sv[0] << "\t" << sv[1] << "\t" << sv[2]
-                     << "\t" << sv[3] << "\t" << sv[4] << "\t" << sv[5]
-                     << "\t" << sv[6] << "\t" << sv[7] << "\t" << sv[8] << "\n";
-                fCombined << std::fixed << std::setprecision(4)
-                          << "update\t" << currentDwell << "\t" << hdr.timestamp << "\t"
-                          << "\t\t\t\t\t\t\t\t\t\t\t\t\t"
-                          << tid << "\t" << status << "\t\t"
-                          << sv[0] << "\t" << sv[3] << "\t" << sv[6] << "\t"
-                          << sv[1] << "\t" << sv[4] << "\t" << sv[7] << "\t"
-                          << sv[2] << "\t" << sv[5] << "\t" << sv[8] << "\t\t\t\t\t\n";
+                std::memcpy(sv, p, sizeof(sv));
+                fUpd.append({ts, dwell, tid, stat, sv[0], sv[1], sv[2], sv[3], sv[4], sv[5], sv[6], sv[7], sv[8]});
                 break;
             }
             case cuas::LogRecordType::TrackDeleted: {
                 if (payload.size() < 4) break;
                 uint32_t tid; std::memcpy(&tid, p, 4);
-                fDel << hdr.timestamp << "\t" << tid << "\n";
-                fCombined << "track_delete\t" << currentDwell << "\t" << hdr.timestamp << "\t"
-                          << "\t\t\t\t\t\t\t\t\t\t\t\t\t" << tid << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\n";
+                fDel.append({ts, dwell, tid});
                 break;
             }
             case cuas::LogRecordType::TrackSent: {
-                if (payload.size() < 108u) break;
+                if (payload.size() < 124u) break;
                 // Layout: msgId(4) trkId(4) ts(8) stat(4) cls(4)
-                //         range(8) az(8) el(8) rr(8) x(8) y(8) z(8)
-                //         vx(8) vy(8) vz(8) qual(8) hits(4) miss(4) age(4)
+                //         range az el rr x y z vx vy vz qual (8 each) hits(4) miss(4) age(4)
                 uint32_t trkId, stat, cls, hits, miss, age;
-                double range, az, el, rr, mx, my, mz, mvx, mvy, mvz, qual;
-                p+=4; std::memcpy(&trkId,p,4);p+=4; p+=8;
-                std::memcpy(&stat,p,4);p+=4; std::memcpy(&cls,p,4);p+=4;
-                std::memcpy(&range,p,8);p+=8; std::memcpy(&az,p,8);p+=8;
-                std::memcpy(&el,p,8);p+=8;   std::memcpy(&rr,p,8);p+=8;
-                std::memcpy(&mx,p,8);p+=8;   std::memcpy(&my,p,8);p+=8;
-                std::memcpy(&mz,p,8);p+=8;   std::memcpy(&mvx,p,8);p+=8;
-                std::memcpy(&mvy,p,8);p+=8;  std::memcpy(&mvz,p,8);p+=8;
-                std::memcpy(&qual,p,8);p+=8;
-                std::memcpy(&hits,p,4);p+=4; std::memcpy(&miss,p,4);p+=4;
-                std::memcpy(&age,p,4);
-                fSent << std::fixed << std::setprecision(4)
-                      << hdr.timestamp << "\t" << trkId
-                      << "\t" << stat << "\t" << cls
-                      << "\t" << range
-                      << "\t" << az * cuas::RAD2DEG
-                      << "\t" << el * cuas::RAD2DEG
-                      << "\t" << rr
-                      << "\t" << mx << "\t" << my << "\t" << mz
-                      << "\t" << mvx << "\t" << mvy << "\t" << mvz
-                      << "\t" << qual
-                      << "\t" << hits << "\t" << miss << "\t" << age << "\n";
-                fCombined << std::fixed << std::setprecision(4)
-                          << "sender\t" << currentDwell << "\t" << hdr.timestamp << "\t"
-                          << "\t\t" << range << "\t" << az * cuas::RAD2DEG
-                          << "\t" << el * cuas::RAD2DEG << "\t" << rr << "\t\t\t\t\t\t\t\t\t\t"
-                          << trkId << "\t" << stat << "\t" << cls << "\t"
-                          << mx << "\t" << my << "\t" << mz << "\t"
-                          << mvx << "\t" << mvy << "\t" << mvz << "\t\t\t\t\t"
-                          << qual << "\t" << hits << "\t" << miss << "\t" << age << "\n";
+                double v[11];
+                p += 4; std::memcpy(&trkId, p, 4); p += 4; p += 8;
+                std::memcpy(&stat, p, 4); p += 4;
+                std::memcpy(&cls,  p, 4); p += 4;
+                std::memcpy(v, p, sizeof(v)); p += sizeof(v);
+                std::memcpy(&hits, p, 4); p += 4;
+                std::memcpy(&miss, p, 4); p += 4;
+                std::memcpy(&age,  p, 4);
+                fSent.append({ts, dwell, trkId, stat, cls, hits, miss, age, v[0], v[1] * cuas::RAD2DEG,
+                              v[2] * cuas::RAD2DEG, v[3], v[4], v[5], v[6], v[7], v[8], v[9], v[10]});
                 break;
             }
             default: break;
         }
     }
 
+    bool ok = true;
     std::cout << "Exported " << records << " records to: " << outDir << std::endl;
-    std::cout << "  raw_detections.dat  preprocessed.dat  clusters.dat" << std::endl;
-    std::cout << "  predictions.dat     associations.dat" << std::endl;
-    std::cout << "  tracks_initiated.dat  tracks_updated.dat  tracks_deleted.dat  tracks_sent.dat" << std::endl;
-    std::cout << "  combined_track_flow.dat (all steps in dwell-wise order)" << std::endl;
-    if (corruptedDat > 0)
-        std::cerr << "WARNING: " << corruptedDat << " corrupted/truncated record(s) skipped.\n";
+    for (size_t i = 0; i < tables.size(); ++i) {
+        const uint64_t rows = out[i].rows();
+        ok = out[i].close() && ok;
+        std::cout << "  " << std::left << std::setw(24) << (tables[i].first + ".arrow")
+                  << std::right << rows << " rows" << std::endl;
+    }
+    if (file.corrupted() > 0)
+        std::cerr << "WARNING: " << file.corrupted() << " corrupted/truncated record(s) skipped.\n";
+    if (!ok) {
+        std::cerr << "ERROR: Writing the Arrow tables failed." << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// ---------------------------------------------------------------------------
+// index mode: print the v2 block index, or else the .idx sidecar
+// ---------------------------------------------------------------------------
+int indexMode(const std::string& filename) {
+    cuas::LogReader file;
+    if (!openLog(file, filename, LogRange{})) return 1;
+    if (file.index().empty()) {
+        if (file.sidecar().empty()) {
+            std::cerr << "No index: " << filename
+                      << " has neither a block index nor a .idx sidecar." << std::endl;
+            return 1;
+        }
+        std::cout << "entry\toffset\tdwell\ttimestamp\n";
+        for (size_t i = 0; i < file.sidecar().size(); ++i) {
+            const cuas::LogSidecarEntry& e = file.sidecar()[i];
+            std::cout << i << "\t" << e.offset << "\t" << e.dwell << "\t" << e.timestamp << "\n";
+        }
+        std::cout << file.sidecar().size() << " sidecar entries" << std::endl;
+        return 0;
+    }
+
+    std::cout << "block\toffset\tfirst_dwell\tlast_dwell\tfirst_ts\tlast_ts\trecords\traw_bytes\n";
+    uint64_t records = 0, rawBytes = 0;
+    for (size_t i = 0; i < file.index().size(); ++i) {
+        const cuas::LogBlockIndexEntry& e = file.index()[i];
+        std::cout << i << "\t" << e.offset << "\t" << e.firstDwell << "\t" << e.lastDwell
+                  << "\t" << e.firstTs << "\t" << e.lastTs << "\t" << e.records
+                  << "\t" << e.rawBytes << "\n";
+        records  += e.records;
+        rawBytes += e.rawBytes;
+    }
+    const auto fileBytes = std::filesystem::file_size(filename);
+    std::cout << file.index().size() << " block(s), " << records << " records, "
+              << rawBytes << " bytes unpacked in " << fileBytes << " on disk" << std::endl;
     return 0;
 }
 
@@ -727,13 +1036,21 @@ int main(int argc, char* argv[]) {
     if (argc < 2) {
         std::cerr << "Counter-UAS Radar Tracker - Log Extractor & Replay Tool" << std::endl;
         std::cerr << std::endl;
-        std::cerr << "Usage: " << argv[0] << " <logfile> [mode] [options]" << std::endl;
+        std::cerr << "Usage: " << argv[0] << " <logfile> [mode] [options] [range]" << std::endl;
         std::cerr << std::endl;
         std::cerr << "Modes:" << std::endl;
         std::cerr << "  extract [verbose]              - Extract and print log contents" << std::endl;
         std::cerr << "  replay [ip] [port] [speed]     - Replay detections via UDP" << std::endl;
         std::cerr << "  csv                            - Export track data as CSV" << std::endl;
         std::cerr << "  dat [output_dir]               - Export per-stage .dat files" << std::endl;
+        std::cerr << "  arrow [output_dir]             - Export typed Arrow (Feather) tables" << std::endl;
+        std::cerr << "  index                          - Print the block index or .idx sidecar" << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "Range (any mode but index; seeks via the log's index when it has one):" << std::endl;
+        std::cerr << "  --from-dwell N  --to-dwell N  --from-time US" << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "  --threads N     - csv/dat worker threads (default: all cores;" << std::endl;
+        std::cerr << "                    a range is always read on one thread)" << std::endl;
         std::cerr << std::endl;
         std::cerr << "Examples:" << std::endl;
         std::cerr << "  " << argv[0] << " tracker_log.bin extract" << std::endl;
@@ -741,6 +1058,8 @@ int main(int argc, char* argv[]) {
         std::cerr << "  " << argv[0] << " tracker_log.bin replay 127.0.0.1 50000 2.0" << std::endl;
         std::cerr << "  " << argv[0] << " tracker_log.bin csv > tracks.csv" << std::endl;
         std::cerr << "  " << argv[0] << " tracker_log.bin dat ./exported_data" << std::endl;
+        std::cerr << "  " << argv[0] << " tracker_log.bin arrow ./tables" << std::endl;
+        std::cerr << "  " << argv[0] << " tracker_log.bin dat ./incident --from-dwell 216000 --to-dwell 216600" << std::endl;
         std::cerr << std::endl;
         std::cerr << "Note: Provide a log file path (e.g. ./logs/tracker_log.bin) from a previous tracker run." << std::endl;
         return 1;
@@ -751,8 +1070,34 @@ int main(int argc, char* argv[]) {
     std::signal(SIGTERM, signalHandler);
 #endif
 
-    std::string filename = argv[1];
-    std::string mode     = (argc > 2) ? argv[2] : "extract";
+    // Pull the range options out; the rest are positional.
+    LogRange range;
+    int threads = 0;
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; ++i) {
+        const std::string a = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (a == "--from-dwell" && hasValue) {
+            range.fromDwell = static_cast<uint32_t>(std::stoul(argv[++i]));
+            range.set = true;
+        } else if (a == "--to-dwell" && hasValue) {
+            range.toDwell = static_cast<uint32_t>(std::stoul(argv[++i]));
+            range.set = true;
+        } else if (a == "--from-time" && hasValue) {
+            range.fromTime = std::stoull(argv[++i]);
+            range.set = true;
+        } else if (a == "--threads" && hasValue) {
+            threads = std::max(1, std::stoi(argv[++i]));
+        } else {
+            args.push_back(a);
+        }
+    }
+    auto arg = [&args](size_t i, const char* def) {
+        return i < args.size() ? args[i] : std::string(def);
+    };
+
+    std::string filename = arg(0, "");
+    std::string mode     = arg(1, "extract");
 
     // Check log file exists before proceeding
     if (!std::ifstream(filename, std::ios::binary).good()) {
@@ -762,18 +1107,23 @@ int main(int argc, char* argv[]) {
     }
 
     if (mode == "extract") {
-        bool verbose = (argc > 3 && std::string(argv[3]) == "verbose");
-        return extractMode(filename, verbose);
+        bool verbose = arg(2, "") == "verbose";
+        return extractMode(filename, range, verbose);
     } else if (mode == "replay") {
-        std::string targetIp = (argc > 3) ? argv[3] : "127.0.0.1";
-        int targetPort       = (argc > 4) ? std::stoi(argv[4]) : 50000;
-        double speedFactor   = (argc > 5) ? std::stod(argv[5]) : 1.0;
-        return replayMode(filename, targetIp, targetPort, speedFactor);
+        std::string targetIp = arg(2, "127.0.0.1");
+        int targetPort       = std::stoi(arg(3, "50000"));
+        double speedFactor   = std::stod(arg(4, "1.0"));
+        return replayMode(filename, targetIp, targetPort, speedFactor, range);
     } else if (mode == "csv") {
-        return csvMode(filename);
+        return csvMode(filename, range, threads);
     } else if (mode == "dat") {
-        std::string outDir = (argc > 3) ? argv[3] : "./dat_export";
-        return datMode(filename, outDir);
+        std::string outDir = arg(2, "./dat_export");
+        return datMode(filename, range, outDir, threads);
+    } else if (mode == "arrow") {
+        std::string outDir = arg(2, "./arrow_export");
+        return arrowMode(filename, range, outDir);
+    } else if (mode == "index") {
+        return indexMode(filename);
     } else {
         std::cerr << "Unknown mode: " << mode << std::endl;
         return 1;
@@ -0,0 +1,273 @@
+/*
+ * Log Replay
+ *
+ * Feeds the raw detection records of a tracker binary log straight into a
+ * TrackManager, in log order and with their original timestamps, as fast
+ * as the CPU allows: no DDS, no sleeping.  The dwells are decoded into
+ * memory first, so the timed loop is processDwell() alone.  The same log
+ * and config always give the same tracks; the track digest printed at the
+ * end (FNV-1a over every dwell's track ids, statuses and states) makes that
+ * checkable across builds.  Use it to reproduce field issues and to measure
+ * performance changes.
+ *
+ * Usage: log_replay <logfile> [config] [options]
+ *   config          : tracker_config.json (default: config/tracker_config.json)
+ *   --sensor N      : radar face the log was recorded on (track ID block)
+ *   --from-dwell N  : first dwell to replay
+ *   --to-dwell N    : last dwell to replay
+ *   --log           : write a binary log of the replay (system.logDirectory)
+ *   --expect-digest : fail (exit 1) unless the track digest matches (hex)
+ *   --max-allocs N  : fail (exit 1) if the steady state allocates more than
+ *                     N times per dwell (CUAS_ALLOC_STATS builds only)
+ *
+ * CUAS_ALLOC_STATS builds also report heap allocations per dwell for each
+ * stage, and for the steady state: the dwells after the first tenth, once
+ * pools, rings and vectors have reached their working size.
+ */
+
+#include "common/types.h"
+#include "common/config.h"
+#include "common/logger.h"
+#include "common/log_reader.h"
+#include "common/latency_histogram.h"
+#include "track_management/track_manager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+bool decodeRawDetections(const cuas::LogPayload& payload, cuas::SPDetectionMessage& msg) {
+    const uint8_t* p = payload.data();
+    if (payload.size() < 20) return false;
+    std::memcpy(&msg.messageId,     p,      4);
+    std::memcpy(&msg.dwellCount,    p + 4,  4);
+    std::memcpy(&msg.timestamp,     p + 8,  8);
+    std::memcpy(&msg.numDetections, p + 16, 4);
+    const size_t fit = (payload.size() - 20) / sizeof(cuas::Detection);
+    if (msg.numDetections > fit) msg.numDetections = static_cast<uint32_t>(fit);
+    msg.detections.resize(msg.numDetections);
+    if (msg.numDetections > 0)
+        std::memcpy(msg.detections.data(), p + 20, msg.numDetections * sizeof(cuas::Detection));
+    return true;
+}
+
+// Allocations so far, every stage together.
+cuas::AllocCounts totalAllocs() {
+    cuas::AllocCounts t;
+    for (size_t i = 0; i < cuas::StageTimings::NUM_STAGES; ++i) {
+        const cuas::AllocCounts a = cuas::stageAllocCounts(static_cast<cuas::PipelineStage>(i));
+        t.count += a.count;
+        t.bytes += a.bytes;
+    }
+    return t;
+}
+
+// FNV-1a, 64-bit.
+struct Digest {
+    uint64_t h = 14695981039346656037ull;
+    void add(const void* data, size_t n) {
+        const uint8_t* b = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < n; ++i) h = (h ^ b[i]) * 1099511628211ull;
+    }
+};
+
+void addTracks(const cuas::TrackManager& tm, Digest& d) {
+    const cuas::TrackStore& tracks = tm.tracks();
+    const uint64_t n = tracks.size();
+    d.add(&n, sizeof(n));
+    for (size_t i = 0; i < tracks.size(); ++i) {
+        const uint32_t id     = tracks[i].id();
+        const uint32_t status = static_cast<uint32_t>(tracks.status(i));
+        d.add(&id, sizeof(id));
+        d.add(&status, sizeof(status));
+        d.add(tracks[i].state().data(), sizeof(cuas::StateVector));
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Counter-UAS Radar Tracker - Log Replay" << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "Usage: " << argv[0] << " <logfile> [config] [options]" << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "Replays the logged detections through the tracker in-process, as fast" << std::endl;
+        std::cerr << "as possible, and reports dwells/s, per-stage latency and a track digest." << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "Options:" << std::endl;
+        std::cerr << "  --sensor N            Radar face the log was recorded on (default 0)" << std::endl;
+        std::cerr << "  --from-dwell N        First dwell to replay" << std::endl;
+        std::cerr << "  --to-dwell N          Last dwell to replay" << std::endl;
+        std::cerr << "  --log                 Write a binary log of the replay" << std::endl;
+        std::cerr << "  --expect-digest HEX   Exit 1 unless the track digest matches" << std::endl;
+        std::cerr << "  --max-allocs N        Exit 1 if the steady state allocates more than N" << std::endl;
+        std::cerr << "                        times per dwell (CUAS_ALLOC_STATS builds)" << std::endl;
+        std::cerr << std::endl;
+        std::cerr << "Example:" << std::endl;
+        std::cerr << "  " << argv[0] << " tracker_log.bin config/tracker_config.json --to-dwell 5000" << std::endl;
+        return 1;
+    }
+
+    std::string filename   = argv[1];
+    std::string configPath = "config/tracker_config.json";
+    uint32_t    sensorId   = 0;
+    uint32_t    fromDwell  = 0;
+    uint32_t    toDwell    = UINT32_MAX;
+    bool        writeLog   = false;
+    std::string expectDigest;
+    double      maxAllocs  = -1.0;
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--sensor" && i + 1 < argc)              sensorId  = static_cast<uint32_t>(std::stoul(argv[++i]));
+        else if (arg == "--from-dwell" && i + 1 < argc)     fromDwell = static_cast<uint32_t>(std::stoul(argv[++i]));
+        else if (arg == "--to-dwell" && i + 1 < argc)       toDwell   = static_cast<uint32_t>(std::stoul(argv[++i]));
+        else if (arg == "--log")                            writeLog  = true;
+        else if (arg == "--expect-digest" && i + 1 < argc)  expectDigest = argv[++i];
+        else if (arg == "--max-allocs" && i + 1 < argc)     maxAllocs = std::stod(argv[++i]);
+        else configPath = arg;
+    }
+
+    cuas::LogReader file;
+    if (!file.open(filename)) {
+        std::cerr << "ERROR: Cannot open log file: " << filename << std::endl;
+        return 1;
+    }
+    if (fromDwell > 0 || toDwell != UINT32_MAX) file.setRange(fromDwell, toDwell);
+
+    // Decode every dwell up front so the timed loop is the tracker alone.
+    const auto loadStart = std::chrono::steady_clock::now();
+    std::vector<cuas::SPDetectionMessage> dwells;
+    cuas::LogRecordHeader hdr;
+    cuas::LogPayload payload;
+    uint64_t detections = 0;
+    while (file.next(hdr, payload)) {
+        if (hdr.recordType != static_cast<uint32_t>(cuas::LogRecordType::RawDetection)) continue;
+        cuas::SPDetectionMessage msg;
+        if (!decodeRawDetections(payload, msg)) continue;
+        msg.sensorId = sensorId;
+        detections += msg.numDetections;
+        dwells.push_back(std::move(msg));
+    }
+    const double loadSec = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - loadStart).count();
+    if (dwells.empty()) {
+        std::cerr << "ERROR: No raw detection records in " << filename << std::endl;
+        return 1;
+    }
+
+    cuas::ConsoleLogger::instance().setLevel(cuas::ConsoleLogger::WARN);
+    cuas::TrackerConfig cfg = cuas::loadConfig(configPath);
+    cfg.system.logEnabled         = writeLog;
+    cfg.system.checkpoint.enabled = false;      // start from no tracks, every time
+
+    cuas::StageTimings timings;
+    cuas::TrackManager tm(cfg, &timings, sensorId);
+    tm.setDebugTables(0);       // nothing subscribes to them here
+    Digest digest;
+
+    const size_t warmUp = std::max<size_t>(1, dwells.size() / 10);
+    cuas::AllocCounts warmAllocs;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < dwells.size(); ++i) {
+        const auto& msg = dwells[i];
+        if (i == warmUp) warmAllocs = totalAllocs();
+        {
+            cuas::StageTimer timer(&timings, cuas::PipelineStage::Dwell);
+            tm.processDwell(msg);
+        }
+        addTracks(tm, digest);
+    }
+    const double runSec = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+    const cuas::AllocCounts endAllocs = totalAllocs();
+    const std::string logPath = writeLog ? tm.logger().getLogPath() : std::string();
+    tm.logger().close();
+
+    const double spanSec = dwells.back().timestamp > dwells.front().timestamp
+        ? (dwells.back().timestamp - dwells.front().timestamp) * 1e-6 : 0.0;
+    char digestHex[17];
+    std::snprintf(digestHex, sizeof(digestHex), "%016llx",
+                  static_cast<unsigned long long>(digest.h));
+
+    std::cout << "=== Log Replay: " << filename << " ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Dwells replayed      : " << dwells.size() << " (dwell "
+              << dwells.front().dwellCount << " to " << dwells.back().dwellCount << ")" << std::endl;
+    std::cout << "Detections           : " << detections << std::endl;
+    std::cout << "Decode time (s)      : " << loadSec << std::endl;
+    std::cout << "Replay time (s)      : " << runSec << std::endl;
+    std::cout << std::setprecision(1);
+    std::cout << "Dwells/s             : " << dwells.size() / runSec << std::endl;
+    if (spanSec > 0.0)
+        std::cout << "Faster than real time: " << spanSec / runSec << "x (log spans "
+                  << spanSec << " s)" << std::endl;
+    std::cout << "Final tracks         : " << tm.numActiveTracks() << " active, "
+              << tm.numConfirmedTracks() << " confirmed" << std::endl;
+    std::cout << "Track digest         : " << digestHex << std::endl;
+    if (!logPath.empty())
+        std::cout << "Replay log           : " << logPath << std::endl;
+
+    std::cout << std::endl;
+    std::cout << "Stage latency (us):        count       p50       p99     p99.9       max" << std::endl;
+    for (size_t i = 0; i < cuas::StageTimings::NUM_STAGES; ++i) {
+        const auto stage = static_cast<cuas::PipelineStage>(i);
+        const cuas::LatencySummary l = timings[stage].summary();
+        if (l.count == 0) continue;
+        char line[128];
+        std::snprintf(line, sizeof(line), "  %-22s %10lu %9.1f %9.1f %9.1f %9.1f",
+                      cuas::pipelineStageName(stage), static_cast<unsigned long>(l.count),
+                      l.p50Us, l.p99Us, l.p999Us, l.maxUs);
+        std::cout << line << std::endl;
+    }
+
+    double steadyAllocs = 0.0;
+    if (cuas::ALLOC_STATS_ENABLED) {
+        const double n = static_cast<double>(dwells.size());
+        std::cout << std::endl;
+        std::cout << "Heap allocations per dwell:          allocs       bytes" << std::endl;
+        for (size_t i = 0; i < cuas::StageTimings::NUM_STAGES; ++i) {
+            const auto stage = static_cast<cuas::PipelineStage>(i);
+            const cuas::AllocCounts a = cuas::stageAllocCounts(stage);
+            if (a.count == 0) continue;
+            char line[128];
+            std::snprintf(line, sizeof(line), "  %-22s %16.2f %11.0f",
+                          cuas::pipelineStageName(stage), a.count / n, a.bytes / n);
+            std::cout << line << std::endl;
+        }
+        if (dwells.size() > warmUp) {
+            const double steadyN = static_cast<double>(dwells.size() - warmUp);
+            steadyAllocs = (endAllocs.count - warmAllocs.count) / steadyN;
+            char line[128];
+            std::snprintf(line, sizeof(line), "  %-22s %16.2f %11.0f", "steady state",
+                          steadyAllocs, (endAllocs.bytes - warmAllocs.bytes) / steadyN);
+            std::cout << line << "   (after dwell " << dwells[warmUp - 1].dwellCount << ")" << std::endl;
+        }
+    }
+
+    if (maxAllocs >= 0.0) {
+        if (!cuas::ALLOC_STATS_ENABLED) {
+            std::cerr << "FAIL: --max-allocs needs a CUAS_ALLOC_STATS build" << std::endl;
+            return 1;
+        }
+        if (steadyAllocs > maxAllocs) {
+            std::cerr << "FAIL: " << steadyAllocs << " allocations per steady-state dwell > "
+                      << maxAllocs << std::endl;
+            return 1;
+        }
+    }
+
+    if (!expectDigest.empty() && expectDigest != digestHex) {
+        std::cerr << "FAIL: track digest " << digestHex << " != expected " << expectDigest << std::endl;
+        return 1;
+    }
+    return 0;
+}
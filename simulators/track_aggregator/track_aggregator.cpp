@@ -0,0 +1,244 @@
+/*
+ * Track Aggregator
+ *
+ * Merges the track tables of the nodes of a distributed deployment
+ * (distributed.enabled) into one picture for displays and C2.  Each node
+ * publishes "TrackTable" (or "TrackTableFrame") per radar face; the
+ * aggregator keeps the latest table of every (writer, sensorId) pair, drops
+ * a table once it is older than --stale-ms (its node stopped or lost the
+ * face), and every --period-ms publishes the union on
+ * "AggregatedTrackTable" as a TrackTableMessage with sensorId 0xFFFFFFFF.
+ *
+ * Near a sector boundary two nodes may hold a track on one target for a
+ * dwell or two until the handover lands; of tracks from different tables
+ * closer than distributed.dedupGateM the one with more hits is kept, as in
+ * TrackManager::acceptHandover.  Track IDs need no remapping: every node
+ * numbers from its own block (TRACK_ID_BLOCK_PER_NODE).
+ *
+ * Usage: track_aggregator [config] [options]
+ *   config         : tracker_config.json (default: config/tracker_config.json)
+ *   --period-ms N  : publish interval (default 100)
+ *   --stale-ms N   : drop a node's table after this long without one (default 1000)
+ */
+
+#include "common/types.h"
+#include "common/config.h"
+#include "common/constants.h"
+#include "common/dds_participant.h"
+#include "common/logger.h"
+
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+static std::atomic<bool> g_running{true};
+void signalHandler(int) { g_running.store(false); }
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Key   = std::pair<eprosima::fastdds::dds::InstanceHandle_t, uint32_t>;   // writer, sensorId
+
+struct NodeTable {
+    std::vector<CounterUAS::TrackUpdateMessage> tracks;
+    Clock::time_point                           received;
+};
+
+std::mutex                 g_mutex;
+std::map<Key, NodeTable>   g_tables;
+std::atomic<uint64_t>      g_tablesReceived{0};
+
+void store(const eprosima::fastdds::dds::SampleInfo& info, uint32_t sensorId,
+           std::vector<CounterUAS::TrackUpdateMessage>& tracks) {
+    std::lock_guard<std::mutex> lk(g_mutex);
+    NodeTable& t = g_tables[{info.publication_handle, sensorId}];
+    t.tracks.swap(tracks);
+    t.received = Clock::now();
+    ++g_tablesReceived;
+}
+
+class TrackTableListener : public eprosima::fastdds::dds::DataReaderListener {
+public:
+    void on_data_available(eprosima::fastdds::dds::DataReader* reader) override {
+        eprosima::fastdds::dds::SampleInfo info;
+        while (eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK ==
+               reader->take_next_sample(&msg_, &info)) {
+            if (info.valid_data) store(info, msg_.sensorId(), msg_.tracks());
+        }
+    }
+
+private:
+    CounterUAS::TrackTableMessage msg_;
+};
+
+class TrackTableFrameListener : public eprosima::fastdds::dds::DataReaderListener {
+public:
+    void on_data_available(eprosima::fastdds::dds::DataReader* reader) override {
+        cuas::takeLoaned<CounterUAS::TrackTableFrame>(reader,
+            [this](const CounterUAS::TrackTableFrame& frame,
+                   const eprosima::fastdds::dds::SampleInfo& info) {
+                const uint32_t n = std::min(frame.numTracks(), CounterUAS::FRAME_MAX_TRACKS);
+                tracks_.clear();
+                for (uint32_t i = 0; i < n; ++i)
+                    tracks_.push_back(cuas::toTrackUpdate(frame.tracks()[i], frame.trace()));
+                store(info, frame.sensorId(), tracks_);
+            });
+    }
+
+private:
+    std::vector<CounterUAS::TrackUpdateMessage> tracks_;
+};
+
+double distance2(const CounterUAS::TrackUpdateMessage& a, const CounterUAS::TrackUpdateMessage& b) {
+    const double dx = a.x() - b.x(), dy = a.y() - b.y(), dz = a.z() - b.z();
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Kept tracks by cell of a grid with the dedup gate as its side, so a track
+// is only compared with those in its own cell and the 26 around it.  Far
+// cells may share a key; the distance test tells them apart.
+uint64_t cellKey(int64_t ix, int64_t iy, int64_t iz) {
+    constexpr uint64_t MASK = (uint64_t(1) << 21) - 1;
+    return (uint64_t(ix) & MASK) << 42 | (uint64_t(iy) & MASK) << 21 | (uint64_t(iz) & MASK);
+}
+
+// Union of the live tables, most-hit track first; a track within gate of
+// one already taken from another table is a duplicate.  A table's own
+// tracks are its TrackManager's to merge, never the aggregator's.  Returns
+// the number dropped as such.
+size_t merge(Clock::time_point now, Clock::duration stale, double gate,
+             std::vector<CounterUAS::TrackUpdateMessage>& out) {
+    std::vector<CounterUAS::TrackUpdateMessage> all;
+    std::vector<uint32_t> table;   // of each of all, by position in g_tables
+    {
+        std::lock_guard<std::mutex> lk(g_mutex);
+        uint32_t n = 0;
+        for (auto it = g_tables.begin(); it != g_tables.end();) {
+            if (now - it->second.received > stale) {
+                it = g_tables.erase(it);
+                continue;
+            }
+            all.insert(all.end(), it->second.tracks.begin(), it->second.tracks.end());
+            table.resize(all.size(), n++);
+            ++it;
+        }
+    }
+    std::vector<uint32_t> order(all.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&all](uint32_t a, uint32_t b) {
+        return all[a].hitCount() > all[b].hitCount();
+    });
+
+    out.clear();
+    const double gate2 = gate * gate;
+    const double cell  = gate > 0.0 ? gate : 1.0;
+    std::unordered_map<uint64_t, std::vector<uint32_t>> kept;
+    for (uint32_t i : order) {
+        const CounterUAS::TrackUpdateMessage& t = all[i];
+        const int64_t ix = static_cast<int64_t>(std::floor(t.x() / cell));
+        const int64_t iy = static_cast<int64_t>(std::floor(t.y() / cell));
+        const int64_t iz = static_cast<int64_t>(std::floor(t.z() / cell));
+        bool duplicate = false;
+        for (int64_t dx = -1; dx <= 1 && !duplicate; ++dx)
+            for (int64_t dy = -1; dy <= 1 && !duplicate; ++dy)
+                for (int64_t dz = -1; dz <= 1 && !duplicate; ++dz) {
+                    const auto c = kept.find(cellKey(ix + dx, iy + dy, iz + dz));
+                    if (c == kept.end()) continue;
+                    for (uint32_t k : c->second)
+                        if (table[k] != table[i] && distance2(t, all[k]) < gate2) {
+                            duplicate = true;
+                            break;
+                        }
+                }
+        if (duplicate) continue;
+        kept[cellKey(ix, iy, iz)].push_back(i);
+        out.push_back(t);
+    }
+    return all.size() - out.size();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string configPath = "config/tracker_config.json";
+    int         periodMs   = 100;
+    int         staleMs    = 1000;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--period-ms" && i + 1 < argc)     periodMs = std::max(1, std::stoi(argv[++i]));
+        else if (arg == "--stale-ms" && i + 1 < argc) staleMs  = std::max(1, std::stoi(argv[++i]));
+        else if (arg == "-h" || arg == "--help") {
+            std::cerr << "Counter-UAS Radar Tracker - Track Aggregator" << std::endl;
+            std::cerr << std::endl;
+            std::cerr << "Usage: " << argv[0] << " [config] [options]" << std::endl;
+            std::cerr << std::endl;
+            std::cerr << "Merges the track tables of every tracker node into one table on '"
+                      << cuas::TOPIC_AGGREGATED_TRACK_TABLE << "'." << std::endl;
+            std::cerr << std::endl;
+            std::cerr << "Options:" << std::endl;
+            std::cerr << "  --period-ms N         Publish interval (default 100)" << std::endl;
+            std::cerr << "  --stale-ms N          Drop a node's table after N ms without one (default 1000)" << std::endl;
+            return 1;
+        }
+        else configPath = arg;
+    }
+
+    std::signal(SIGINT,  signalHandler);
+    std::signal(SIGTERM, signalHandler);
+
+    cuas::TrackerConfig cfg = cuas::loadConfig(configPath);
+    const double gate = cfg.distributed.dedupGateM;
+
+    TrackTableListener      tableListener;
+    TrackTableFrameListener frameListener;
+
+    cuas::CuasDdsParticipant participant(0, 0, cfg.network.dds);
+    participant.makeReader<CounterUAS::TrackTableMessage>(cuas::TOPIC_TRACK_TABLE, &tableListener);
+    participant.makeReader<CounterUAS::TrackTableFrame>(cuas::TOPIC_TRACK_TABLE_FRAME, &frameListener);
+    auto* writer = participant.makeWriter<CounterUAS::TrackTableMessage>(
+        cuas::TOPIC_AGGREGATED_TRACK_TABLE);
+
+    LOG_INFO("Aggregator", "Merging '%s' / '%s' into '%s' every %d ms (dedup gate %.0f m)",
+             cuas::TOPIC_TRACK_TABLE, cuas::TOPIC_TRACK_TABLE_FRAME,
+             cuas::TOPIC_AGGREGATED_TRACK_TABLE, periodMs, gate);
+
+    CounterUAS::TrackTableMessage out;
+    out.messageId(cuas::MSG_ID_TRACK_TABLE);
+    out.sensorId(0xFFFFFFFFu);
+
+    uint64_t published  = 0;
+    uint64_t duplicates = 0;
+    auto next = Clock::now();
+    while (g_running.load()) {
+        next += std::chrono::milliseconds(periodMs);
+        std::this_thread::sleep_until(next);
+
+        duplicates += merge(Clock::now(), std::chrono::milliseconds(staleMs), gate, out.tracks());
+        out.timestamp(cuas::nowMicros());
+        out.numTracks(static_cast<uint32_t>(out.tracks().size()));
+        writer->write(&out);
+        ++published;
+    }
+
+    LOG_INFO("Aggregator", "Stopped: %lu tables received, %lu published, %lu duplicate tracks dropped",
+             static_cast<unsigned long>(g_tablesReceived.load()),
+             static_cast<unsigned long>(published),
+             static_cast<unsigned long>(duplicates));
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include "association/assignment.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+namespace cuas {
+
+void SparseAssignmentSolver::solve(const SparseCostMatrix& C, double missCost,
+                                   std::vector<int>& rowToCol) {
+    missCost_.assign(C.numRows(), missCost);
+    solve(C, missCost_, rowToCol);
+}
+
+void SparseAssignmentSolver::solve(const SparseCostMatrix& C,
+                                   const std::vector<double>& rowMissCost,
+                                   std::vector<int>& rowToCol) {
+    const double INF = std::numeric_limits<double>::infinity();
+    const int nRows = C.numRows();
+    const int nCols = C.numCols + nRows;   // row r's miss column is C.numCols + r
+
+    u_.assign(nRows, 0.0);
+    v_.assign(nCols, 0.0);
+    rowCol_.assign(nRows, -1);
+    colRow_.assign(nCols, -1);
+    shortest_.assign(nCols, INF);
+    pathRow_.assign(nCols, -1);
+    scanned_.assign(nCols, 0);
+
+    for (int cur = 0; cur < nRows; ++cur) {
+        touched_.clear();
+        scannedRows_.clear();
+        heap_.clear();
+
+        auto relax = [&](int i, int j, double c, double minVal) {
+            if (scanned_[j]) return;
+            double r = minVal + c - u_[i] - v_[j];
+            if (r < shortest_[j]) {
+                if (shortest_[j] == INF) touched_.push_back(j);
+                shortest_[j] = r;
+                pathRow_[j]  = i;
+                heap_.push_back({r, j});
+                std::push_heap(heap_.begin(), heap_.end(), std::greater<HeapEntry>());
+            }
+        };
+
+        // Dijkstra from `cur` until a free column is reached.  cur's own miss
+        // column is free and reachable, so the search always ends.
+        double minVal = 0.0;
+        int i = cur, sink = -1;
+        while (sink < 0) {
+            scannedRows_.push_back(i);
+            for (int e = C.rowStart[i]; e < C.rowStart[i + 1]; ++e)
+                relax(i, C.col[e], C.cost[e], minVal);
+            relax(i, C.numCols + i, rowMissCost[i], minVal);
+
+            int j = -1;
+            while (!heap_.empty()) {
+                std::pop_heap(heap_.begin(), heap_.end(), std::greater<HeapEntry>());
+                HeapEntry top = heap_.back();
+                heap_.pop_back();
+                if (!scanned_[top.col] && top.dist == shortest_[top.col]) { j = top.col; break; }
+            }
+            scanned_[j] = 1;
+            minVal = shortest_[j];
+            if (colRow_[j] < 0) sink = j;
+            else                i = colRow_[j];
+        }
+
+        // Dual update keeps every stored reduced cost non-negative.
+        u_[cur] += minVal;
+        for (int r : scannedRows_)
+            if (r != cur) u_[r] += minVal - shortest_[rowCol_[r]];
+        for (int j : touched_)
+            if (scanned_[j]) v_[j] -= minVal - shortest_[j];
+
+        // Augment along the path back to cur.
+        for (int j = sink;;) {
+            int r = pathRow_[j];
+            colRow_[j] = r;
+            std::swap(rowCol_[r], j);
+            if (r == cur) break;
+        }
+
+        for (int j : touched_) {
+            shortest_[j] = INF;
+            scanned_[j]  = 0;
+        }
+    }
+
+    rowToCol.resize(nRows);
+    for (int r = 0; r < nRows; ++r)
+        rowToCol[r] = rowCol_[r] < C.numCols ? rowCol_[r] : -1;
+}
+
+} // namespace cuas
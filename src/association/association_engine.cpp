@@ -2,45 +2,288 @@
 #include "association/mahalanobis_associator.h"
 #include "association/gnn_associator.h"
 #include "association/jpda_associator.h"
+#include "association/mht_associator.h"
+#include "common/matrix_ops.h"
 #include "common/logger.h"
+#include "common/profiling.h"
+#include <algorithm>
 
 namespace cuas {
 
-AssociationEngine::AssociationEngine(const AssociationConfig& cfg) : config_(cfg) {
-    switch (cfg.method) {
+// Tracks per WorkerPool chunk when gating for the decomposition.
+static constexpr size_t GATE_CHUNK = 64;
+
+// The associators only read cluster positions, so the per-component copies
+// leave detectionIndices behind (and never allocate for them).
+static void copyForLane(const Cluster& src, Cluster& dst) {
+    dst.clusterId     = src.clusterId;
+    dst.range         = src.range;
+    dst.azimuth       = src.azimuth;
+    dst.elevation     = src.elevation;
+    dst.strength      = src.strength;
+    dst.snr           = src.snr;
+    dst.rcs           = src.rcs;
+    dst.microDoppler  = src.microDoppler;
+    dst.numDetections = src.numDetections;
+    dst.cartesian     = src.cartesian;
+}
+
+AssociationEngine::AssociationEngine(const AssociationConfig& cfg) {
+    reconfigure(cfg);
+}
+
+void AssociationEngine::reconfigure(const AssociationConfig& cfg) {
+    config_     = cfg;
+    associator_ = makeAssociator(false);
+    fallback_   = makeAssociator(true);
+    lanes_.clear();     // per-thread associators of the old method
+    LOG_INFO("Association", "Initialized with method: %s", associator_->name().c_str());
+}
+
+std::unique_ptr<IAssociator> AssociationEngine::makeAssociator(bool fallback) const {
+    if (fallback) {
+        if (config_.method != AssociationMethod::JPDA &&
+            config_.method != AssociationMethod::MHT) return nullptr;
+        return std::make_unique<GNNAssociator>(config_.gnn, config_.gatingThreshold);
+    }
+    switch (config_.method) {
         case AssociationMethod::Mahalanobis:
-            associator_ = std::make_unique<MahalanobisAssociator>(
-                cfg.mahalanobis, cfg.gatingThreshold);
-            break;
+            return std::make_unique<MahalanobisAssociator>(
+                config_.mahalanobis, config_.gatingThreshold);
         case AssociationMethod::GNN:
-            associator_ = std::make_unique<GNNAssociator>(cfg.gnn, cfg.gatingThreshold);
-            break;
+            return std::make_unique<GNNAssociator>(config_.gnn, config_.gatingThreshold);
         case AssociationMethod::JPDA:
-            associator_ = std::make_unique<JPDAAssociator>(cfg.jpda, cfg.gatingThreshold);
-            break;
+            return std::make_unique<JPDAAssociator>(config_.jpda, config_.gatingThreshold);
+        case AssociationMethod::MHT:
+            return std::make_unique<MHTAssociator>(config_.mht, config_.gatingThreshold);
     }
-    LOG_INFO("Association", "Initialized with method: %s", associator_->name().c_str());
+    return nullptr;
 }
 
 AssociationOutput AssociationEngine::process(
-    const std::vector<Track>& tracks,
+    const std::vector<InnovationStats>& tracks,
     const std::vector<Cluster>& clusters,
-    const IMMFilter& imm,
-    const MeasMatrix& R) {
+    WorkerPool* workers) {
+    AssociationOutput out;
+    process(tracks, clusters, out, workers);
+    return out;
+}
 
+void AssociationEngine::process(const std::vector<InnovationStats>& tracks,
+                                const std::vector<Cluster>& clusters,
+                                AssociationOutput& out, WorkerPool* workers) {
     if (tracks.empty() || clusters.empty()) {
-        AssociationOutput out;
+        out.matched.clear();
+        out.unmatchedTracks.clear();
+        out.unmatchedClusters.clear();
         for (int i = 0; i < static_cast<int>(tracks.size()); ++i)
             out.unmatchedTracks.push_back(i);
         for (int i = 0; i < static_cast<int>(clusters.size()); ++i)
             out.unmatchedClusters.push_back(i);
-        return out;
+        return;
+    }
+
+    bool fallback = usingFallback();
+    IAssociator& active = fallback ? *fallback_ : *associator_;
+    if (config_.decompose && active.decomposable())
+        decomposed(tracks, clusters, fallback, workers, out);
+    else
+        active.associate(tracks, clusters, out);
+}
+
+double AssociationEngine::gate() const {
+    return (!usingFallback() && config_.method == AssociationMethod::JPDA)
+               ? config_.jpda.gateSize : config_.gatingThreshold;
+}
+
+bool AssociationEngine::associateSingle(const InnovationStats& track, double d2,
+                                        double& distance) const {
+    const IAssociator& active = usingFallback() ? *fallback_ : *associator_;
+    return d2 <= gate() && active.decomposable() && active.associateSingle(track, d2, distance);
+}
+
+void AssociationEngine::setDwellContext(const std::vector<uint32_t>& trackIds,
+                                        const std::vector<MeasMatrix>& R) {
+    associator_->setDwellContext(trackIds, R);
+    if (fallback_) fallback_->setDwellContext(trackIds, R);
+}
+
+int AssociationEngine::findRoot(int n) {
+    while (parent_[n] != n) {
+        parent_[n] = parent_[parent_[n]];
+        n = parent_[n];
+    }
+    return n;
+}
+
+void AssociationEngine::gatePairs(const std::vector<InnovationStats>& tracks,
+                                  const std::vector<Cluster>& clusters, double gate,
+                                  WorkerPool* workers) {
+    CUAS_PROFILE_ZONE("gate");
+    index_.build(tracks, clusters, gate);
+    const size_t nChunks = (tracks.size() + GATE_CHUNK - 1) / GATE_CHUNK;
+    if (chunkPairs_.size() < nChunks) chunkPairs_.resize(nChunks);
+    auto gateChunk = [&](size_t begin, size_t end) {
+        ChunkPairs& chunk = chunkPairs_[begin / GATE_CHUNK];
+        chunk.pairs.clear();
+        for (size_t t = begin; t < end; ++t) {
+            const InnovationStats& inn = tracks[t];
+            if (!inn.valid) continue;
+            index_.candidates(tracks[t], chunk.near);
+            for (int c : chunk.near) {
+                MeasVector z = {clusters[c].cartesian.x,
+                                clusters[c].cartesian.y,
+                                clusters[c].cartesian.z};
+                double d = mat::mahalanobisDistance(mat::measSub(z, inn.zPred), inn.Sinv);
+                if (d <= gate) chunk.pairs.push_back({static_cast<int>(t), c, d});
+            }
+        }
+    };
+    if (workers) workers->parallelFor(tracks.size(), GATE_CHUNK, gateChunk);
+    else         for (size_t b = 0; b < tracks.size(); b += GATE_CHUNK)
+                     gateChunk(b, std::min(tracks.size(), b + GATE_CHUNK));
+
+    pairs_.clear();
+    for (size_t k = 0; k < nChunks; ++k)
+        pairs_.insert(pairs_.end(), chunkPairs_[k].pairs.begin(), chunkPairs_[k].pairs.end());
+}
+
+void AssociationEngine::decomposed(
+    const std::vector<InnovationStats>& tracks,
+    const std::vector<Cluster>& clusters,
+    bool fallback, WorkerPool* workers, AssociationOutput& out) {
+    CUAS_PROFILE_ZONE("decomposed association");
+
+    const int nTracks   = static_cast<int>(tracks.size());
+    const int nClusters = static_cast<int>(clusters.size());
+    IAssociator& whole  = fallback ? *fallback_ : *associator_;
+    const double gate   = (!fallback && config_.method == AssociationMethod::JPDA)
+                              ? config_.jpda.gateSize : config_.gatingThreshold;
+
+    // Gated pairs, gathered per track chunk across the pool and joined in
+    // chunk order.
+    gatePairs(tracks, clusters, gate, workers);
+
+    // Union-find; nodes are tracks [0, nTracks) then clusters.
+    parent_.resize(nTracks + nClusters);
+    for (int n = 0; n < nTracks + nClusters; ++n) parent_[n] = n;
+    for (const auto& p : pairs_) {
+        int a = findRoot(p.track), b = findRoot(nTracks + p.cluster);
+        if (a != b) parent_[std::max(a, b)] = std::min(a, b);
+    }
+
+    // Number the components in order of their lowest node.
+    int nComponents = 0;
+    componentOf_.assign(nTracks + nClusters, -1);
+    for (int n = 0; n < nTracks + nClusters; ++n) {
+        int root = findRoot(n);
+        if (componentOf_[root] < 0) componentOf_[root] = nComponents++;
+        componentOf_[n] = componentOf_[root];
+    }
+    if (nComponents == 1) {
+        whole.associate(tracks, clusters, out);
+        return;
+    }
+
+    // Bucket the members by component (counting sort, so ascending).
+    auto bucket = [&](int first, int count, std::vector<int>& start, std::vector<int>& list) {
+        start.assign(nComponents + 1, 0);
+        for (int i = 0; i < count; ++i) ++start[componentOf_[first + i] + 1];
+        for (int k = 0; k < nComponents; ++k) start[k + 1] += start[k];
+        list.resize(count);
+        for (int i = 0; i < count; ++i) list[start[componentOf_[first + i]]++] = i;
+        for (int k = nComponents; k > 0; --k) start[k] = start[k - 1];
+        start[0] = 0;
+    };
+    bucket(0, nTracks, trackStart_, trackList_);
+    bucket(nTracks, nClusters, clusterStart_, clusterList_);
+    auto numTracks   = [&](int k) { return trackStart_[k + 1] - trackStart_[k]; };
+    auto numClusters = [&](int k) { return clusterStart_[k + 1] - clusterStart_[k]; };
+
+    // Single-pair components are decided here; tracks and clusters with no
+    // gated partner are simply never matched.  The rest are queued.
+    matched_.clear();
+    for (const auto& p : pairs_) {
+        int k = componentOf_[p.track];
+        if (numTracks(k) != 1 || numClusters(k) != 1) continue;
+        double distance;
+        if (whole.associateSingle(tracks[p.track], p.d2, distance))
+            matched_.push_back({p.track, p.cluster, distance});
+    }
+    order_.clear();
+    for (int k = 0; k < nComponents; ++k)
+        if (numTracks(k) > 0 && numClusters(k) > 0 && numTracks(k) + numClusters(k) > 2)
+            order_.push_back(k);
+    std::sort(order_.begin(), order_.end(), [&](int a, int b) {
+        long sa = static_cast<long>(numTracks(a)) * numClusters(a);
+        long sb = static_cast<long>(numTracks(b)) * numClusters(b);
+        return sa != sb ? sa > sb : a < b;
+    });
+    if (results_.size() < order_.size()) results_.resize(order_.size());
+
+    const size_t nLanes = std::min(order_.size(),
+                                   static_cast<size_t>(workers ? workers->numThreads() : 1));
+    while (lanes_.size() < nLanes) {
+        Lane lane;
+        lane.associator = makeAssociator(false);
+        lane.fallback   = makeAssociator(true);
+        lanes_.push_back(std::move(lane));
+    }
+
+    std::atomic<size_t> next{0};
+    auto runLane = [&](size_t begin, size_t end) {
+        for (size_t l = begin; l < end; ++l) {
+            Lane& lane = lanes_[l];
+            IAssociator& assoc = fallback ? *lane.fallback : *lane.associator;
+            for (size_t i; (i = next.fetch_add(1)) < order_.size();) {
+                const int  k        = order_[i];
+                const int* tIdx     = &trackList_[trackStart_[k]];
+                const int* cIdx     = &clusterList_[clusterStart_[k]];
+                lane.tracks.resize(numTracks(k));
+                lane.clusters.resize(numClusters(k));
+                for (int j = 0; j < numTracks(k); ++j)   lane.tracks[j] = tracks[tIdx[j]];
+                for (int j = 0; j < numClusters(k); ++j) copyForLane(clusters[cIdx[j]], lane.clusters[j]);
+
+                AssociationOutput& r = results_[i];
+                assoc.associate(lane.tracks, lane.clusters, r);
+                for (auto& m : r.matched) {
+                    m.trackIndex   = tIdx[m.trackIndex];
+                    m.clusterIndex = cIdx[m.clusterIndex];
+                }
+            }
+        }
+    };
+    if (workers && nLanes > 1) workers->parallelFor(nLanes, 1, runLane);
+    else                       runLane(0, nLanes);
+
+    for (size_t i = 0; i < order_.size(); ++i)
+        matched_.insert(matched_.end(), results_[i].matched.begin(), results_[i].matched.end());
+
+    // Every associator matches a track at most once and reports the tracks
+    // and clusters it did not match as the complement, so the output is
+    // rebuilt from the matches in track order.
+    out.matched.clear();
+    out.unmatchedTracks.clear();
+    out.unmatchedClusters.clear();
+    trackMatch_.assign(nTracks, -1);
+    clusterMatched_.assign(nClusters, 0);
+    for (int i = 0; i < static_cast<int>(matched_.size()); ++i) {
+        trackMatch_[matched_[i].trackIndex] = i;
+        clusterMatched_[matched_[i].clusterIndex] = 1;
+    }
+    for (int t = 0; t < nTracks; ++t) {
+        if (trackMatch_[t] >= 0) out.matched.push_back(matched_[trackMatch_[t]]);
+        else                     out.unmatchedTracks.push_back(t);
     }
+    for (int c = 0; c < nClusters; ++c)
+        if (!clusterMatched_[c]) out.unmatchedClusters.push_back(c);
 
-    return associator_->associate(tracks, clusters, imm, R);
+    LOG_DEBUG("Association", "%d components, %zu solved by %s, %zu gated pairs",
+              nComponents, order_.size(), whole.name().c_str(), pairs_.size());
 }
 
 std::string AssociationEngine::activeMethod() const {
+    if (usingFallback()) return fallback_->name();
     return associator_ ? associator_->name() : "None";
 }
 
@@ -0,0 +1,142 @@
+#include "association/cluster_index.h"
+#include <algorithm>
+#include <cmath>
+
+namespace cuas {
+
+namespace {
+
+// Half-widths of the gate box, padded so that rounding in the box test can
+// never drop a cluster the Mahalanobis test would accept.
+MeasVector gateHalfWidths(const InnovationStats& inn, double gate) {
+    MeasVector h;
+    for (int m = 0; m < MEAS_DIM; ++m)
+        h[m] = std::sqrt(gate * inn.sDiag[m]) * (1.0 + 1e-9) + 1e-9;
+    return h;
+}
+
+// Stats filled in without S's diagonal carry no box: every cluster is a
+// candidate.
+bool hasBox(const InnovationStats& inn) {
+    for (int m = 0; m < MEAS_DIM; ++m)
+        if (!(inn.sDiag[m] > 0.0) || !std::isfinite(inn.sDiag[m])) return false;
+    return true;
+}
+
+} // namespace
+
+int64_t ClusterIndex::cellOf(double v) const {
+    return static_cast<int64_t>(std::floor(v / cellSize_));
+}
+
+size_t ClusterIndex::bucketOf(int64_t ix, int64_t iy, int64_t iz) const {
+    uint64_t h = static_cast<uint64_t>(ix) * 73856093u ^
+                 static_cast<uint64_t>(iy) * 19349663u ^
+                 static_cast<uint64_t>(iz) * 83492791u;
+    return static_cast<size_t>(h) & bucketMask_;
+}
+
+void ClusterIndex::build(const std::vector<InnovationStats>& tracks,
+                         const std::vector<Cluster>& clusters, double gate) {
+    clusters_ = &clusters;
+    points_   = nullptr;
+    size_     = clusters.size();
+    buildIndex(tracks, gate);
+}
+
+void ClusterIndex::build(const std::vector<InnovationStats>& tracks,
+                         const std::vector<CartesianPos>& points, double gate) {
+    clusters_ = nullptr;
+    points_   = &points;
+    size_     = points.size();
+    buildIndex(tracks, gate);
+}
+
+void ClusterIndex::buildIndex(const std::vector<InnovationStats>& tracks, double gate) {
+    gate_    = gate;
+    indexed_ = false;
+    if (size_ < MIN_INDEXED_CLUSTERS) return;
+
+    widths_.clear();
+    for (const auto& inn : tracks) {
+        if (!inn.valid || !hasBox(inn)) continue;
+        MeasVector h = gateHalfWidths(inn, gate);
+        widths_.push_back(2.0 * std::max({h[0], h[1], h[2]}));
+    }
+    if (widths_.empty()) return;
+    std::nth_element(widths_.begin(), widths_.begin() + widths_.size() / 2, widths_.end());
+    cellSize_ = widths_[widths_.size() / 2];
+    if (!(cellSize_ > 0.0) || !std::isfinite(cellSize_)) return;
+
+    size_t buckets = 1;
+    while (buckets < 2 * size_) buckets <<= 1;
+    bucketMask_ = buckets - 1;
+
+    // Counting sort of the clusters by bucket.
+    bucketStart_.assign(buckets + 1, 0);
+    clusterBucket_.resize(size_);
+    for (size_t c = 0; c < size_; ++c) {
+        const CartesianPos& p = position(c);
+        size_t b = bucketOf(cellOf(p.x), cellOf(p.y), cellOf(p.z));
+        clusterBucket_[c] = b;
+        ++bucketStart_[b + 1];
+    }
+    for (size_t b = 0; b < buckets; ++b) bucketStart_[b + 1] += bucketStart_[b];
+    items_.resize(size_);
+    std::vector<uint32_t> fill(bucketStart_.begin(), bucketStart_.end() - 1);
+    for (size_t c = 0; c < size_; ++c)
+        items_[fill[clusterBucket_[c]]++] = static_cast<int>(c);
+
+    indexed_ = true;
+}
+
+void ClusterIndex::candidates(const InnovationStats& inn, std::vector<int>& out) const {
+    out.clear();
+    if (!inn.valid) return;
+
+    if (!indexed_ || !hasBox(inn)) {
+        for (size_t c = 0; c < size_; ++c) out.push_back(static_cast<int>(c));
+        return;
+    }
+
+    MeasVector h = gateHalfWidths(inn, gate_);
+    double cells = 1.0;
+    for (int m = 0; m < MEAS_DIM; ++m)
+        cells *= std::floor((inn.zPred[m] + h[m]) / cellSize_) -
+                 std::floor((inn.zPred[m] - h[m]) / cellSize_) + 1.0;
+
+    auto inBox = [&](int c) {
+        const CartesianPos& q = position(static_cast<size_t>(c));
+        const MeasVector p = {q.x, q.y, q.z};
+        for (int m = 0; m < MEAS_DIM; ++m)
+            if (std::abs(p[m] - inn.zPred[m]) > h[m]) return false;
+        return true;
+    };
+
+    // A gate much wider than a cell (e.g. a long-coasting track): scanning
+    // every cluster is cheaper than visiting the cells.
+    if (!(cells <= static_cast<double>(size_))) {
+        for (size_t c = 0; c < size_; ++c)
+            if (inBox(static_cast<int>(c))) out.push_back(static_cast<int>(c));
+        return;
+    }
+
+    int64_t lo[MEAS_DIM], hi[MEAS_DIM];
+    for (int m = 0; m < MEAS_DIM; ++m) {
+        lo[m] = cellOf(inn.zPred[m] - h[m]);
+        hi[m] = cellOf(inn.zPred[m] + h[m]);
+    }
+    for (int64_t ix = lo[0]; ix <= hi[0]; ++ix)
+        for (int64_t iy = lo[1]; iy <= hi[1]; ++iy)
+            for (int64_t iz = lo[2]; iz <= hi[2]; ++iz) {
+                size_t b = bucketOf(ix, iy, iz);
+                for (uint32_t k = bucketStart_[b]; k < bucketStart_[b + 1]; ++k)
+                    if (inBox(items_[k])) out.push_back(items_[k]);
+            }
+
+    // Cells sharing a bucket can yield the same cluster twice.
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+} // namespace cuas
@@ -1,9 +1,8 @@
 #include "association/gnn_associator.h"
-#include "track_management/track.h"
 #include "common/matrix_ops.h"
 #include "common/logger.h"
+#include "common/profiling.h"
 #include <algorithm>
-#include <set>
 #include <limits>
 #include <numeric>
 
@@ -12,9 +11,8 @@ namespace cuas {
 GNNAssociator::GNNAssociator(const GNNConfig& cfg, double gatingThreshold)
     : config_(cfg), gatingThreshold_(gatingThreshold) {}
 
-std::vector<int> GNNAssociator::hungarianAssignment(
-    const std::vector<std::vector<double>>& costMatrix,
-    int numTracks, int numClusters) const {
+void GNNAssociator::greedyAssignment(int numTracks, int numClusters,
+                                     std::vector<int>& assignment) {
 
     // Simplified auction/greedy assignment for rectangular cost matrix
     // Full Hungarian is O(n^3); this greedy approach is acceptable for typical track counts
@@ -22,30 +20,31 @@ std::vector<int> GNNAssociator::hungarianAssignment(
     const double INF = 1e30;
 
     // Pad cost matrix to square
-    std::vector<std::vector<double>> C(n, std::vector<double>(n, INF));
+    reduced_.assign(static_cast<size_t>(n) * n, INF);
+    auto C = [&](int i, int j) -> double& { return reduced_[static_cast<size_t>(i) * n + j]; };
     for (int i = 0; i < numTracks; ++i)
         for (int j = 0; j < numClusters; ++j)
-            C[i][j] = costMatrix[i][j];
+            C(i, j) = dense_[static_cast<size_t>(i) * numClusters + j];
 
     // Kuhn-Munkres (simplified row/column reduction + assignment)
     // Step 1: Row reduction
     for (int i = 0; i < n; ++i) {
-        double minVal = *std::min_element(C[i].begin(), C[i].end());
+        double minVal = *std::min_element(&C(i, 0), &C(i, 0) + n);
         if (minVal < INF)
-            for (int j = 0; j < n; ++j) C[i][j] -= minVal;
+            for (int j = 0; j < n; ++j) C(i, j) -= minVal;
     }
 
     // Step 2: Column reduction
     for (int j = 0; j < n; ++j) {
         double minVal = INF;
-        for (int i = 0; i < n; ++i) minVal = std::min(minVal, C[i][j]);
+        for (int i = 0; i < n; ++i) minVal = std::min(minVal, C(i, j));
         if (minVal < INF)
-            for (int i = 0; i < n; ++i) C[i][j] -= minVal;
+            for (int i = 0; i < n; ++i) C(i, j) -= minVal;
     }
 
     // Step 3: Greedy assignment on reduced cost
-    std::vector<int> assignment(numTracks, -1);
-    std::vector<bool> colUsed(n, false);
+    assignment.assign(numTracks, -1);
+    colUsed_.assign(n, 0);
 
     // Multiple passes for better assignment
     for (int pass = 0; pass < 3; ++pass) {
@@ -54,84 +53,127 @@ std::vector<int> GNNAssociator::hungarianAssignment(
             double bestCost = INF;
             int bestJ = -1;
             for (int j = 0; j < numClusters; ++j) {
-                if (colUsed[j]) continue;
-                if (C[i][j] < bestCost) {
-                    bestCost = C[i][j];
+                if (colUsed_[j]) continue;
+                if (C(i, j) < bestCost) {
+                    bestCost = C(i, j);
                     bestJ = j;
                 }
             }
-            if (bestJ >= 0 && costMatrix[i][bestJ] < config_.costThreshold) {
+            if (bestJ >= 0 &&
+                dense_[static_cast<size_t>(i) * numClusters + bestJ] < config_.costThreshold) {
                 assignment[i] = bestJ;
-                colUsed[bestJ] = true;
+                colUsed_[bestJ] = 1;
             }
         }
     }
+}
+
+void GNNAssociator::optimalAssignment(const std::vector<InnovationStats>& tracks,
+                                      const std::vector<Cluster>& clusters,
+                                      std::vector<int>& assignment,
+                                      std::vector<double>& cost) {
+    const int nClusters = static_cast<int>(clusters.size());
+    sparse_.reset(nClusters);
+    for (const auto& inn : tracks) {
+        if (inn.valid) {
+            index_.candidates(inn, near_);
+            for (int c : near_) {
+                MeasVector z = {clusters[c].cartesian.x,
+                               clusters[c].cartesian.y,
+                               clusters[c].cartesian.z};
+                MeasVector innov = mat::measSub(z, inn.zPred);
+                double d = mat::mahalanobisDistance(innov, inn.Sinv);
+                if (d <= gatingThreshold_ && d < config_.costThreshold) sparse_.add(c, d);
+            }
+        }
+        sparse_.endRow();
+    }
+
+    solver_.solve(sparse_, config_.costThreshold, assignment);
+
+    cost.assign(tracks.size(), 1e30);
+    for (size_t t = 0; t < tracks.size(); ++t) {
+        if (assignment[t] < 0) continue;
+        for (int e = sparse_.rowStart[t]; e < sparse_.rowStart[t + 1]; ++e)
+            if (sparse_.col[e] == assignment[t]) cost[t] = sparse_.cost[e];
+    }
+}
 
-    return assignment;
+bool GNNAssociator::associateSingle(const InnovationStats&, double d2,
+                                    double& distance) const {
+    // Both solvers take a pair only below costThreshold.
+    distance = d2;
+    return d2 < config_.costThreshold;
 }
 
-AssociationOutput GNNAssociator::associate(
-    const std::vector<Track>& tracks,
-    const std::vector<Cluster>& clusters,
-    const IMMFilter& imm,
-    const MeasMatrix& R) {
+void GNNAssociator::associate(const std::vector<InnovationStats>& tracks,
+                              const std::vector<Cluster>& clusters,
+                              AssociationOutput& out) {
+    CUAS_PROFILE_ZONE("GNN associate");
 
     int nTracks   = static_cast<int>(tracks.size());
     int nClusters = static_cast<int>(clusters.size());
     const double INF = 1e30;
 
-    MeasStateMatrix H = imm.getMeasurementMatrix();
-
-    // Build cost matrix based on Mahalanobis distance
-    std::vector<std::vector<double>> costMatrix(nTracks, std::vector<double>(nClusters, INF));
-
-    for (int t = 0; t < nTracks; ++t) {
-        const auto& state = tracks[t].immState();
-        MeasMatrix S = mat::measAddMat(mat::hpht(H, state.mergedCovariance), R);
-        MeasMatrix Sinv;
-        if (!mat::invertMeas(S, Sinv)) continue;
-
-        MeasVector zPred = mat::measFromState(H, state.mergedState);
-
-        for (int c = 0; c < nClusters; ++c) {
-            MeasVector z = {clusters[c].cartesian.x,
-                           clusters[c].cartesian.y,
-                           clusters[c].cartesian.z};
-            MeasVector innov = mat::measSub(z, zPred);
-            double d = mat::mahalanobisDistance(innov, Sinv);
-
-            if (d <= gatingThreshold_) {
-                costMatrix[t][c] = d;
+    std::vector<int>&    assignment = assignment_;
+    std::vector<double>& cost       = cost_;
+    cost.assign(nTracks, INF);
+
+    index_.build(tracks, clusters, gatingThreshold_);
+    if (config_.solver == GNNSolver::JonkerVolgenant) {
+        optimalAssignment(tracks, clusters, assignment, cost);
+    } else {
+        // Build cost matrix based on Mahalanobis distance
+        dense_.assign(static_cast<size_t>(nTracks) * nClusters, INF);
+
+        for (int t = 0; t < nTracks; ++t) {
+            const InnovationStats& inn = tracks[t];
+            if (!inn.valid) continue;
+
+            index_.candidates(inn, near_);
+            for (int c : near_) {
+                MeasVector z = {clusters[c].cartesian.x,
+                               clusters[c].cartesian.y,
+                               clusters[c].cartesian.z};
+                MeasVector innov = mat::measSub(z, inn.zPred);
+                double d = mat::mahalanobisDistance(innov, inn.Sinv);
+
+                if (d <= gatingThreshold_) {
+                    dense_[static_cast<size_t>(t) * nClusters + c] = d;
+                }
             }
         }
-    }
 
-    // Run assignment
-    std::vector<int> assignment = hungarianAssignment(costMatrix, nTracks, nClusters);
+        greedyAssignment(nTracks, nClusters, assignment);
+        for (int t = 0; t < nTracks; ++t)
+            if (assignment[t] >= 0)
+                cost[t] = dense_[static_cast<size_t>(t) * nClusters + assignment[t]];
+    }
 
-    AssociationOutput out;
-    std::set<int> matchedClusters;
+    out.matched.clear();
+    out.unmatchedTracks.clear();
+    out.unmatchedClusters.clear();
+    std::vector<char>& clusterMatched = clusterMatched_;
+    clusterMatched.assign(nClusters, 0);
 
     for (int t = 0; t < nTracks; ++t) {
         if (assignment[t] >= 0 && assignment[t] < nClusters) {
             AssociationResult res;
             res.trackIndex   = t;
             res.clusterIndex = assignment[t];
-            res.distance     = costMatrix[t][assignment[t]];
+            res.distance     = cost[t];
             out.matched.push_back(res);
-            matchedClusters.insert(assignment[t]);
+            clusterMatched[assignment[t]] = 1;
         } else {
             out.unmatchedTracks.push_back(t);
         }
     }
 
     for (int c = 0; c < nClusters; ++c)
-        if (!matchedClusters.count(c)) out.unmatchedClusters.push_back(c);
+        if (!clusterMatched[c]) out.unmatchedClusters.push_back(c);
 
     LOG_DEBUG("GNN", "Matched: %zu, Unmatched tracks: %zu, Unmatched clusters: %zu",
               out.matched.size(), out.unmatchedTracks.size(), out.unmatchedClusters.size());
-
-    return out;
 }
 
 } // namespace cuas
@@ -1,109 +1,244 @@
 #include "association/jpda_associator.h"
-#include "track_management/track.h"
 #include "common/matrix_ops.h"
 #include "common/logger.h"
+#include "common/profiling.h"
 #include <cmath>
 #include <algorithm>
-#include <set>
 
 namespace cuas {
 
+namespace {
+
+// Gaussian likelihood of a measurement at squared Mahalanobis distance d.
+double measurementLikelihood(double d, double logDetS) {
+    return std::exp(-0.5 * (d + logDetS + MEAS_DIM * std::log(2.0 * 3.14159265)));
+}
+
+} // namespace
+
 JPDAAssociator::JPDAAssociator(const JPDAConfig& cfg, double gatingThreshold)
     : config_(cfg), gatingThreshold_(gatingThreshold) {}
 
-std::vector<JPDAAssociator::JPDAWeights> JPDAAssociator::computeWeights(
-    const std::vector<Track>& tracks,
-    const std::vector<Cluster>& clusters,
-    const IMMFilter& imm,
-    const MeasMatrix& R) const {
+// Per-track approximation: each track's betas as if no other track shared
+// its gated measurements.
+void JPDAAssociator::marginalWeights(const std::vector<std::pair<int, double>>& gatedMeas,
+                                     JPDAWeights& w) const {
+    double pd = config_.detectionProbability;
+    double lambda = config_.clutterDensity;
 
-    int nTracks   = static_cast<int>(tracks.size());
-    int nClusters = static_cast<int>(clusters.size());
+    if (gatedMeas.empty()) {
+        w.betaZero = 1.0;
+        return;
+    }
 
-    MeasStateMatrix H = imm.getMeasurementMatrix();
-    std::vector<JPDAWeights> allWeights;
+    // Beta_0 (probability of no valid detection)
+    double sumLik = 0.0;
+    for (auto& [idx, lik] : gatedMeas) {
+        sumLik += pd * lik;
+    }
+    double denominator = (1.0 - pd) * lambda + sumLik;
 
-    for (int t = 0; t < nTracks; ++t) {
-        const auto& state = tracks[t].immState();
-        MeasMatrix S = mat::measAddMat(mat::hpht(H, state.mergedCovariance), R);
-        MeasMatrix Sinv;
-        if (!mat::invertMeas(S, Sinv)) {
-            JPDAWeights w;
-            w.trackIndex = t;
-            w.betaZero = 1.0;
-            allWeights.push_back(w);
-            continue;
+    if (denominator < 1e-30) {
+        w.betaZero = 1.0;
+    } else {
+        w.betaZero = (1.0 - pd) * lambda / denominator;
+        for (auto& [idx, lik] : gatedMeas) {
+            double beta = pd * lik / denominator;
+            w.clusterWeights.push_back({idx, beta});
         }
+    }
+}
+
+// Exact JPDA over one component.  A joint event gives every track either no
+// measurement or one of its gated measurements, each measurement used at
+// most once, with weight
+//
+//     prod over tracks of  (1 - Pd) * lambda            (missed)
+//                          Pd * N(z_j; zPred, S)        (assigned z_j)
+//
+// Events are enumerated depth-first, one track per level, carrying the
+// product of the prefix; each track's factors are scaled by their largest
+// value, which leaves the normalised betas unchanged and keeps the products
+// of long components away from underflow.  Returns false if every event has
+// zero weight.
+bool JPDAAssociator::exactWeights(const int* members, size_t n, size_t numClusters) const {
+    const double pd = config_.detectionProbability;
+    const double missWeight = (1.0 - pd) * config_.clutterDensity;
+
+    // options_[k] = (cluster or -1, scaled weight); option 0 is the miss.
+    if (options_.size() < n) options_.resize(n);
+    if (acc_.size() < n)     acc_.resize(n);
+    for (size_t k = 0; k < n; ++k) {
+        auto& opt = options_[k];
+        opt.clear();
+        opt.push_back({-1, missWeight});
+        for (const auto& [c, lik] : gated_[members[k]]) opt.push_back({c, pd * lik});
+        double scale = 0.0;
+        for (const auto& o : opt) scale = std::max(scale, o.second);
+        if (!(scale > 0.0)) return false;
+        for (auto& o : opt) o.second /= scale;
+        acc_[k].assign(opt.size(), 0.0);
+    }
 
-        double detS = mat::det3x3(S);
-        MeasVector zPred = mat::measFromState(H, state.mergedState);
+    choice_.assign(n, 0);
+    used_.assign(numClusters, 0);
+    double total = 0.0;
 
-        JPDAWeights w;
-        w.trackIndex = t;
+    auto descend = [&](auto& self, size_t depth, double prefix) -> void {
+        if (depth == n) {
+            total += prefix;
+            for (size_t k = 0; k < n; ++k) acc_[k][choice_[k]] += prefix;
+            return;
+        }
+        const auto& opt = options_[depth];
+        for (size_t o = 0; o < opt.size(); ++o) {
+            int c = opt[o].first;
+            if (c >= 0 && used_[c]) continue;
+            double p = prefix * opt[o].second;
+            if (p == 0.0) continue;
+            if (c >= 0) used_[c] = 1;
+            choice_[depth] = o;
+            self(self, depth + 1, p);
+            if (c >= 0) used_[c] = 0;
+        }
+    };
+    descend(descend, 0, 1.0);
+    if (!(total > 0.0)) return false;
 
-        double pd = config_.detectionProbability;
-        double lambda = config_.clutterDensity;
+    for (size_t k = 0; k < n; ++k) {
+        JPDAWeights& w = weights_[members[k]];
+        w.betaZero = acc_[k][0] / total;
+        for (size_t o = 1; o < options_[k].size(); ++o)
+            w.clusterWeights.push_back({options_[k][o].first, acc_[k][o] / total});
+    }
+    return true;
+}
+
+std::vector<JPDAAssociator::JPDAWeights> JPDAAssociator::computeWeights(
+    const std::vector<InnovationStats>& tracks,
+    const std::vector<Cluster>& clusters) const {
+    fillWeights(tracks, clusters);
+    return std::vector<JPDAWeights>(weights_.begin(), weights_.begin() + tracks.size());
+}
 
-        // Compute likelihoods for each gated measurement
-        std::vector<std::pair<int, double>> gatedMeas;
-        for (int c = 0; c < nClusters; ++c) {
+void JPDAAssociator::fillWeights(const std::vector<InnovationStats>& tracks,
+                                 const std::vector<Cluster>& clusters) const {
+
+    const int nTracks   = static_cast<int>(tracks.size());
+    const int nClusters = static_cast<int>(clusters.size());
+
+    // The per-track lists only ever grow, so their capacity is kept across
+    // dwells; entries past nTracks are stale.
+    if (static_cast<int>(weights_.size()) < nTracks) weights_.resize(nTracks);
+    if (static_cast<int>(gated_.size()) < nTracks)   gated_.resize(nTracks);
+    for (int t = 0; t < nTracks; ++t) {
+        weights_[t].trackIndex = t;
+        weights_[t].betaZero   = 0.0;
+        weights_[t].clusterWeights.clear();
+        gated_[t].clear();
+    }
+
+    // Likelihoods of each track's gated measurements.
+    index_.build(tracks, clusters, config_.gateSize);
+    for (int t = 0; t < nTracks; ++t) {
+        const InnovationStats& inn = tracks[t];
+        if (!inn.valid) continue;
+
+        index_.candidates(inn, near_);
+        for (int c : near_) {
             MeasVector z = {clusters[c].cartesian.x,
                            clusters[c].cartesian.y,
                            clusters[c].cartesian.z};
-            MeasVector innov = mat::measSub(z, zPred);
-            double d = mat::mahalanobisDistance(innov, Sinv);
+            MeasVector innov = mat::measSub(z, inn.zPred);
+            double d = mat::mahalanobisDistance(innov, inn.Sinv);
 
             if (d <= config_.gateSize) {
-                double lik = std::exp(-0.5 * d) /
-                             std::sqrt(std::pow(2.0 * 3.14159265, MEAS_DIM) * std::abs(detS));
-                gatedMeas.push_back({c, lik});
+                gated_[t].push_back({c, measurementLikelihood(d, inn.logDetS)});
             }
         }
+    }
 
-        if (gatedMeas.empty()) {
-            w.betaZero = 1.0;
-            allWeights.push_back(w);
-            continue;
+    // Tracks that share a gated measurement form a component (union-find).
+    parent_.resize(nTracks);
+    firstTrack_.assign(nClusters, -1);
+    for (int t = 0; t < nTracks; ++t) parent_[t] = t;
+    auto root = [&](int t) {
+        while (parent_[t] != t) t = parent_[t] = parent_[parent_[t]];
+        return t;
+    };
+    for (int t = 0; t < nTracks; ++t) {
+        for (const auto& [c, lik] : gated_[t]) {
+            if (firstTrack_[c] < 0) { firstTrack_[c] = t; continue; }
+            int a = root(t), b = root(firstTrack_[c]);
+            if (a != b) parent_[std::max(a, b)] = std::min(a, b);
         }
+    }
+    // Members of the component rooted at r: members_[start_[r] .. start_[r + 1]).
+    start_.assign(nTracks + 1, 0);
+    for (int t = 0; t < nTracks; ++t) ++start_[root(t) + 1];
+    for (int r = 0; r < nTracks; ++r) start_[r + 1] += start_[r];
+    members_.resize(nTracks);
+    for (int t = 0; t < nTracks; ++t) members_[start_[root(t)]++] = t;
+    for (int r = nTracks; r > 0; --r) start_[r] = start_[r - 1];
+    start_[0] = 0;
 
-        // Beta_0 (probability of no valid detection)
-        double sumLik = 0.0;
-        for (auto& [idx, lik] : gatedMeas) {
-            sumLik += pd * lik;
-        }
-        double denominator = (1.0 - pd) * lambda + sumLik;
+    // Exact weights for shared components whose event tree fits the budget
+    // (bounded by the product of 1 + gated count); the approximation
+    // otherwise.
+    for (int r = 0; r < nTracks; ++r) {
+        const int*   comp = members_.data() + start_[r];
+        const size_t size = start_[r + 1] - start_[r];
+        if (size == 0) continue;
 
-        if (denominator < 1e-30) {
-            w.betaZero = 1.0;
-        } else {
-            w.betaZero = (1.0 - pd) * lambda / denominator;
-            for (auto& [idx, lik] : gatedMeas) {
-                double beta = pd * lik / denominator;
-                w.clusterWeights.push_back({idx, beta});
-            }
+        double events = 1.0;
+        for (size_t k = 0; k < size; ++k) events *= 1.0 + gated_[comp[k]].size();
+        if (size > 1 && events <= config_.maxHypotheses &&
+            exactWeights(comp, size, nClusters))
+            continue;
+        if (size > 1)
+            LOG_DEBUG("JPDA", "Component of %zu tracks over budget (%.0f events), "
+                      "using per-track weights", size, events);
+        for (size_t k = 0; k < size; ++k) {
+            weights_[comp[k]].clusterWeights.clear();
+            marginalWeights(gated_[comp[k]], weights_[comp[k]]);
         }
-
-        allWeights.push_back(w);
     }
+}
+
+bool JPDAAssociator::associateSingle(const InnovationStats& track, double d2,
+                                     double& distance) const {
+    // computeWeights() and associate() for a lone gated measurement, for
+    // which exact and per-track weights agree.
+    double pd          = config_.detectionProbability;
+    double lambda      = config_.clutterDensity;
+    double lik         = pd * measurementLikelihood(d2, track.logDetS);
+    double denominator = (1.0 - pd) * lambda + lik;
+    if (denominator < 1e-30) return false;
 
-    return allWeights;
+    double beta = lik / denominator;
+    if ((1.0 - pd) * lambda / denominator > 0.5 || !(beta > 0.0)) return false;
+    distance = 1.0 - beta;
+    return true;
 }
 
-AssociationOutput JPDAAssociator::associate(
-    const std::vector<Track>& tracks,
-    const std::vector<Cluster>& clusters,
-    const IMMFilter& imm,
-    const MeasMatrix& R) {
+void JPDAAssociator::associate(const std::vector<InnovationStats>& tracks,
+                               const std::vector<Cluster>& clusters,
+                               AssociationOutput& out) {
+    CUAS_PROFILE_ZONE("JPDA associate");
 
-    auto weights = computeWeights(tracks, clusters, imm, R);
+    fillWeights(tracks, clusters);
 
-    AssociationOutput out;
-    std::set<int> matchedClusters;
+    int nClusters = static_cast<int>(clusters.size());
+    out.matched.clear();
+    out.unmatchedTracks.clear();
+    out.unmatchedClusters.clear();
+    matchedCluster_.assign(nClusters, 0);
 
     // For JPDA, each track gets its "best" measurement, but the real power
     // is in the weighted update. We report the strongest association for
     // the pipeline's matched/unmatched classification.
-    for (const auto& w : weights) {
+    for (size_t t = 0; t < tracks.size(); ++t) {
+        const JPDAWeights& w = weights_[t];
         if (w.clusterWeights.empty() || w.betaZero > 0.5) {
             out.unmatchedTracks.push_back(w.trackIndex);
             continue;
@@ -125,20 +260,17 @@ AssociationOutput JPDAAssociator::associate(
             res.clusterIndex = bestCluster;
             res.distance     = 1.0 - bestBeta; // Use complement as pseudo-distance
             out.matched.push_back(res);
-            matchedClusters.insert(bestCluster);
+            matchedCluster_[bestCluster] = 1;
         } else {
             out.unmatchedTracks.push_back(w.trackIndex);
         }
     }
 
-    int nClusters = static_cast<int>(clusters.size());
     for (int c = 0; c < nClusters; ++c)
-        if (!matchedClusters.count(c)) out.unmatchedClusters.push_back(c);
+        if (!matchedCluster_[c]) out.unmatchedClusters.push_back(c);
 
     LOG_DEBUG("JPDA", "Matched: %zu, Unmatched tracks: %zu, Unmatched clusters: %zu",
               out.matched.size(), out.unmatchedTracks.size(), out.unmatchedClusters.size());
-
-    return out;
 }
 
 } // namespace cuas
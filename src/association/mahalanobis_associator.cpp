@@ -1,9 +1,8 @@
 #include "association/mahalanobis_associator.h"
-#include "track_management/track.h"
 #include "common/matrix_ops.h"
 #include "common/logger.h"
+#include "common/profiling.h"
 #include <algorithm>
-#include <set>
 
 namespace cuas {
 
@@ -11,40 +10,42 @@ MahalanobisAssociator::MahalanobisAssociator(const MahalanobisConfig& cfg,
                                                double gatingThreshold)
     : config_(cfg), gatingThreshold_(gatingThreshold) {}
 
-AssociationOutput MahalanobisAssociator::associate(
-    const std::vector<Track>& tracks,
-    const std::vector<Cluster>& clusters,
-    const IMMFilter& imm,
-    const MeasMatrix& R) {
+bool MahalanobisAssociator::associateSingle(const InnovationStats&, double d2,
+                                            double& distance) const {
+    distance = d2;
+    return d2 <= config_.distanceThreshold;
+}
+
+void MahalanobisAssociator::associate(const std::vector<InnovationStats>& tracks,
+                                      const std::vector<Cluster>& clusters,
+                                      AssociationOutput& out) {
+    CUAS_PROFILE_ZONE("Mahalanobis associate");
 
     int nTracks   = static_cast<int>(tracks.size());
     int nClusters = static_cast<int>(clusters.size());
 
-    MeasStateMatrix H = imm.getMeasurementMatrix();
-    AssociationOutput out;
-    std::set<int> matchedTracks, matchedClusters;
+    out.matched.clear();
+    out.unmatchedTracks.clear();
+    out.unmatchedClusters.clear();
+    matchedTrack_.assign(nTracks, 0);
+    matchedCluster_.assign(nClusters, 0);
 
-    // Compute all distances
-    struct Candidate {
-        int trackIdx, clusterIdx;
-        double distance;
-    };
-    std::vector<Candidate> candidates;
+    // Compute distances for the clusters inside each track's gate box
+    std::vector<Candidate>& candidates = candidates_;
+    candidates.clear();
 
+    index_.build(tracks, clusters, gatingThreshold_);
     for (int t = 0; t < nTracks; ++t) {
-        const auto& state = tracks[t].immState();
-        MeasMatrix S = mat::measAddMat(mat::hpht(H, state.mergedCovariance), R);
-        MeasMatrix Sinv;
-        if (!mat::invertMeas(S, Sinv)) continue;
+        const InnovationStats& inn = tracks[t];
+        if (!inn.valid) continue;
 
-        MeasVector zPred = mat::measFromState(H, state.mergedState);
-
-        for (int c = 0; c < nClusters; ++c) {
+        index_.candidates(inn, near_);
+        for (int c : near_) {
             MeasVector z = {clusters[c].cartesian.x,
                            clusters[c].cartesian.y,
                            clusters[c].cartesian.z};
-            MeasVector innov = mat::measSub(z, zPred);
-            double d = mat::mahalanobisDistance(innov, Sinv);
+            MeasVector innov = mat::measSub(z, inn.zPred);
+            double d = mat::mahalanobisDistance(innov, inn.Sinv);
 
             if (d <= gatingThreshold_) {
                 candidates.push_back({t, c, d});
@@ -59,8 +60,7 @@ AssociationOutput MahalanobisAssociator::associate(
               });
 
     for (const auto& cand : candidates) {
-        if (matchedTracks.count(cand.trackIdx) ||
-            matchedClusters.count(cand.clusterIdx)) continue;
+        if (matchedTrack_[cand.trackIdx] || matchedCluster_[cand.clusterIdx]) continue;
 
         if (cand.distance <= config_.distanceThreshold) {
             AssociationResult res;
@@ -68,20 +68,18 @@ AssociationOutput MahalanobisAssociator::associate(
             res.clusterIndex = cand.clusterIdx;
             res.distance     = cand.distance;
             out.matched.push_back(res);
-            matchedTracks.insert(cand.trackIdx);
-            matchedClusters.insert(cand.clusterIdx);
+            matchedTrack_[cand.trackIdx]     = 1;
+            matchedCluster_[cand.clusterIdx] = 1;
         }
     }
 
     for (int t = 0; t < nTracks; ++t)
-        if (!matchedTracks.count(t)) out.unmatchedTracks.push_back(t);
+        if (!matchedTrack_[t]) out.unmatchedTracks.push_back(t);
     for (int c = 0; c < nClusters; ++c)
-        if (!matchedClusters.count(c)) out.unmatchedClusters.push_back(c);
+        if (!matchedCluster_[c]) out.unmatchedClusters.push_back(c);
 
     LOG_DEBUG("Mahalanobis", "Matched: %zu, Unmatched tracks: %zu, Unmatched clusters: %zu",
               out.matched.size(), out.unmatchedTracks.size(), out.unmatchedClusters.size());
-
-    return out;
 }
 
 } // namespace cuas
@@ -0,0 +1,378 @@
+#include "association/mht_associator.h"
+#include "common/matrix_ops.h"
+#include "common/logger.h"
+#include "common/profiling.h"
+#include <algorithm>
+#include <cmath>
+
+namespace cuas {
+
+namespace {
+
+// Offsets below this (metres) are treated as agreeing with the committed
+// estimate.
+constexpr double OFFSET_EPS = 1e-6;
+
+MeasVector position(const Cluster& c) {
+    return {c.cartesian.x, c.cartesian.y, c.cartesian.z};
+}
+
+MeasVector measAdd(const MeasVector& a, const MeasVector& b) {
+    return {a[0] + b[0], a[1] + b[1], a[2] + b[2]};
+}
+
+MeasVector matVec(const MeasMatrix& A, const MeasVector& v) {
+    MeasVector out{};
+    for (int i = 0; i < MEAS_DIM; ++i)
+        for (int j = 0; j < MEAS_DIM; ++j) out[i] += A[i][j] * v[j];
+    return out;
+}
+
+} // namespace
+
+MHTAssociator::MHTAssociator(const MHTConfig& cfg, double gatingThreshold)
+    : config_(cfg), gatingThreshold_(gatingThreshold),
+      nodes_(static_cast<size_t>(std::max(cfg.nodeBudget, 2))) {
+    config_.kBest         = std::max(config_.kBest, 1);
+    config_.nScan         = std::max(config_.nScan, 1);
+    config_.maxHypotheses = std::max(config_.maxHypotheses, 1);
+    offsets_[0].reserve(std::max(cfg.offsetBudget, 0));
+    offsets_[1].reserve(std::max(cfg.offsetBudget, 0));
+}
+
+void MHTAssociator::setDwellContext(const std::vector<uint32_t>& trackIds,
+                                    const std::vector<MeasMatrix>& R) {
+    trackIds_ = trackIds;
+    R_        = R;
+}
+
+bool MHTAssociator::associateSingle(const InnovationStats&, double d2,
+                                    double& distance) const {
+    distance = d2;
+    return d2 < config_.missCost;
+}
+
+void MHTAssociator::releaseNode(int node) {
+    while (node >= 0) {
+        if (--nodes_[node].refs > 0) return;
+        int parent = nodes_[node].parent;
+        nodes_.release(node);
+        node = parent;
+    }
+}
+
+int MHTAssociator::ancestor(int node, int steps) const {
+    while (steps-- > 0 && nodes_[node].parent >= 0) node = nodes_[node].parent;
+    return node;
+}
+
+void MHTAssociator::expandLeaf(int leaf, const std::vector<InnovationStats>& tracks,
+                               const std::vector<Cluster>& clusters) {
+    const Leaf& L  = leaves_[leaf];
+    const int   n  = static_cast<int>(tracks.size());
+    const int   m  = static_cast<int>(clusters.size());
+    const auto& offs = offsets_[cur_];
+
+    // Leaf-conditioned gating around zPred + offset.
+    for (int k = L.first; k < L.first + L.count; ++k) {
+        auto it = std::lower_bound(idToIndex_.begin(), idToIndex_.end(),
+                                   std::make_pair(offs[k].trackId, -1));
+        if (it != idToIndex_.end() && it->first == offs[k].trackId)
+            delta_[it->second] = offs[k].delta;
+    }
+    leafCost_.reset(m);
+    for (int i = 0; i < n; ++i) {
+        if (tracks[i].valid) {
+            InnovationStats shifted = tracks[i];
+            for (int d = 0; d < MEAS_DIM; ++d) shifted.zPred[d] += delta_[i][d];
+            index_.candidates(shifted, near_);
+            for (int c : near_) {
+                double d2 = mat::mahalanobisDistance(
+                    mat::measSub(position(clusters[c]), shifted.zPred), shifted.Sinv);
+                if (d2 <= gatingThreshold_ && d2 < config_.missCost) leafCost_.add(c, d2);
+            }
+        }
+        leafCost_.endRow();
+    }
+    for (auto& d : delta_) d = MeasVector{};
+
+    // Components of rows sharing a cluster.
+    parent_.resize(n);
+    for (int r = 0; r < n; ++r) parent_[r] = r;
+    auto root = [&](int r) {
+        while (parent_[r] != r) r = parent_[r] = parent_[parent_[r]];
+        return r;
+    };
+    firstRow_.assign(m, -1);
+    int missRows = 0;
+    for (int r = 0; r < n; ++r) {
+        if (leafCost_.rowStart[r] == leafCost_.rowStart[r + 1]) { ++missRows; continue; }
+        for (int e = leafCost_.rowStart[r]; e < leafCost_.rowStart[r + 1]; ++e) {
+            int c = leafCost_.col[e];
+            if (firstRow_[c] < 0) { firstRow_[c] = r; continue; }
+            int a = root(r), b = root(firstRow_[c]);
+            if (a != b) parent_[std::max(a, b)] = std::min(a, b);
+        }
+    }
+    // compRows_[compStart_[k] ..) are component k's rows, ascending.
+    compStart_.clear();
+    compRows_.clear();
+    std::vector<int>& compOf = firstRow_;   // reused: root row -> component
+    compOf.assign(n, -1);
+    int nComp = 0;
+    for (int r = 0; r < n; ++r)
+        if (leafCost_.rowStart[r] != leafCost_.rowStart[r + 1] && compOf[root(r)] < 0)
+            compOf[root(r)] = nComp++;
+    compStart_.assign(nComp + 1, 0);
+    for (int r = 0; r < n; ++r)
+        if (leafCost_.rowStart[r] != leafCost_.rowStart[r + 1]) ++compStart_[compOf[root(r)] + 1];
+    for (int k = 0; k < nComp; ++k) compStart_[k + 1] += compStart_[k];
+    compRows_.resize(compStart_[nComp]);
+    fill_.assign(compStart_.begin(), compStart_.end() - 1);
+    for (int r = 0; r < n; ++r)
+        if (leafCost_.rowStart[r] != leafCost_.rowStart[r + 1])
+            compRows_[fill_[compOf[root(r)]]++] = r;
+
+    // k-best per component.
+    if (static_cast<int>(compBest_.size()) < nComp) compBest_.resize(nComp);
+    colLocal_.assign(m, -1);
+    std::vector<int>& localCols = localCols_;
+    for (int k = 0; k < nComp; ++k) {
+        localCols.clear();
+        for (int i = compStart_[k]; i < compStart_[k + 1]; ++i) {
+            int r = compRows_[i];
+            for (int e = leafCost_.rowStart[r]; e < leafCost_.rowStart[r + 1]; ++e) {
+                int c = leafCost_.col[e];
+                if (colLocal_[c] < 0) {
+                    colLocal_[c] = static_cast<int>(localCols.size());
+                    localCols.push_back(c);
+                }
+            }
+        }
+        compCost_.reset(static_cast<int>(localCols.size()));
+        for (int i = compStart_[k]; i < compStart_[k + 1]; ++i) {
+            int r = compRows_[i];
+            for (int e = leafCost_.rowStart[r]; e < leafCost_.rowStart[r + 1]; ++e)
+                compCost_.add(colLocal_[leafCost_.col[e]], leafCost_.cost[e]);
+            compCost_.endRow();
+        }
+        murty_.solve(compCost_, config_.missCost, config_.kBest, compBest_[k]);
+        // Back to global columns.
+        for (auto& ra : compBest_[k])
+            for (int& c : ra.rowToCol)
+                if (c >= 0) c = localCols[c];
+        for (int c : localCols) colLocal_[c] = -1;
+    }
+
+    // The kBest cheapest joint picks; a pick tuple is only ever advanced at
+    // or after the component it was last advanced at, so each is generated
+    // once.
+    double base = missRows * config_.missCost;
+    for (int k = 0; k < nComp; ++k) base += compBest_[k][0].cost;
+
+    std::vector<Combo>& combos = combos_;
+    std::vector<int>&   picks  = picks_;
+    std::vector<int>&   heap   = heap_;
+    auto cheaper = [&](int a, int b) { return combos[a].cost > combos[b].cost; };
+    combos.assign(1, {base, 0, 0});
+    picks.assign(nComp, 0);
+    heap.assign(1, 0);
+
+    for (int emitted = 0; emitted < config_.kBest && !heap.empty(); ++emitted) {
+        std::pop_heap(heap.begin(), heap.end(), cheaper);
+        const int ci = heap.back();
+        heap.pop_back();
+        const Combo combo = combos[ci];
+
+        const int assign = static_cast<int>(childAssign_.size());
+        childAssign_.insert(childAssign_.end(), n, -1);
+        childDist_.insert(childDist_.end(), n, 0.0);
+        for (int k = 0; k < nComp; ++k) {
+            const RankedAssignment& ra = compBest_[k][picks[combo.picks + k]];
+            for (int i = compStart_[k]; i < compStart_[k + 1]; ++i) {
+                const int r = compRows_[i];
+                const int c = ra.rowToCol[i - compStart_[k]];
+                if (c < 0) continue;
+                childAssign_[assign + r] = c;
+                for (int e = leafCost_.rowStart[r]; e < leafCost_.rowStart[r + 1]; ++e)
+                    if (leafCost_.col[e] == c) childDist_[assign + r] = leafCost_.cost[e];
+            }
+        }
+        children_.push_back({leaf, L.cost + combo.cost, assign});
+
+        for (int k = combo.last; k < nComp; ++k) {
+            const int p = picks[combo.picks + k];
+            if (p + 1 >= static_cast<int>(compBest_[k].size())) continue;
+            const int next = static_cast<int>(picks.size());
+            for (int j = 0; j < nComp; ++j) picks.push_back(picks[combo.picks + j]);
+            ++picks[next + k];
+            combos.push_back({combo.cost + compBest_[k][p + 1].cost - compBest_[k][p].cost,
+                              k, next});
+            heap.push_back(static_cast<int>(combos.size()) - 1);
+            std::push_heap(heap.begin(), heap.end(), cheaper);
+        }
+    }
+}
+
+void MHTAssociator::associate(const std::vector<InnovationStats>& tracks,
+                              const std::vector<Cluster>& clusters,
+                              AssociationOutput& out) {
+    CUAS_PROFILE_ZONE("MHT associate");
+
+    const int n = static_cast<int>(tracks.size());
+    const int m = static_cast<int>(clusters.size());
+
+    // Without ids (no dwell context) every dwell starts a fresh tree.
+    const bool haveIds = static_cast<int>(trackIds_.size()) == n;
+    idToIndex_.resize(n);
+    for (int i = 0; i < n; ++i)
+        idToIndex_[i] = {haveIds ? trackIds_[i] : static_cast<uint32_t>(i), i};
+    std::sort(idToIndex_.begin(), idToIndex_.end());
+    if (!haveIds) {
+        for (const auto& l : leaves_) releaseNode(l.node);
+        leaves_.clear();
+    }
+
+    // Without a dwell context R is taken as zero.
+    const bool haveR = static_cast<int>(R_.size()) == n;
+    delta_.assign(n, MeasVector{});
+    gain_.resize(n);
+    for (int i = 0; i < n; ++i) {
+        MeasMatrix W{};
+        if (tracks[i].valid)
+            for (int r = 0; r < MEAS_DIM; ++r)
+                for (int c = 0; c < MEAS_DIM; ++c) {
+                    double rs = 0.0;
+                    if (haveR)
+                        for (int k = 0; k < MEAS_DIM; ++k) rs += R_[i][r][k] * tracks[i].Sinv[k][c];
+                    W[r][c] = (r == c ? 1.0 : 0.0) - rs;
+                }
+        gain_[i] = W;
+    }
+
+    if (leaves_.empty()) {
+        int node = nodes_.acquire();
+        nodes_[node].refs = 1;
+        offsets_[cur_].clear();
+        leaves_.push_back({node, 0.0, 0, 0});
+    }
+
+    index_.build(tracks, clusters, gatingThreshold_);
+    children_.clear();
+    childAssign_.clear();
+    childDist_.clear();
+    for (int l = 0; l < static_cast<int>(leaves_.size()); ++l)
+        expandLeaf(l, tracks, clusters);
+
+    order_.resize(children_.size());
+    for (size_t i = 0; i < order_.size(); ++i) order_[i] = static_cast<int>(i);
+    std::sort(order_.begin(), order_.end(), [&](int a, int b) {
+        return children_[a].cost != children_[b].cost ? children_[a].cost < children_[b].cost
+                                                      : a < b;
+    });
+    const Child best     = children_[order_[0]];
+    const int*  commit   = childAssign_.data() + best.assign;
+    const int   anchor   = ancestor(leaves_[best.leaf].node, config_.nScan - 1);
+
+    // Survivors, cheapest first, with offsets from the committed estimate.
+    const int nb = 1 - cur_;
+    offsets_[nb].clear();
+    nextLeaves_.clear();
+    const auto& offs = offsets_[cur_];
+    for (int ci : order_) {
+        if (static_cast<int>(nextLeaves_.size()) >= config_.maxHypotheses) break;
+        const Child& ch = children_[ci];
+        const Leaf&  parent = leaves_[ch.leaf];
+        if (ancestor(parent.node, config_.nScan - 1) != anchor) continue;
+
+        for (int k = parent.first; k < parent.first + parent.count; ++k) {
+            auto it = std::lower_bound(idToIndex_.begin(), idToIndex_.end(),
+                                       std::make_pair(offs[k].trackId, -1));
+            if (it != idToIndex_.end() && it->first == offs[k].trackId)
+                delta_[it->second] = offs[k].delta;
+        }
+        candidate_.clear();
+        const int* assign = childAssign_.data() + ch.assign;
+        for (const auto& [id, i] : idToIndex_) {
+            const MeasVector& zPred = tracks[i].zPred;
+            MeasVector xh = measAdd(zPred, delta_[i]);
+            MeasVector xc = zPred;
+            if (assign[i] >= 0)
+                xh = measAdd(xh, matVec(gain_[i], mat::measSub(position(clusters[assign[i]]), xh)));
+            if (commit[i] >= 0)
+                xc = measAdd(xc, matVec(gain_[i], mat::measSub(position(clusters[commit[i]]), xc)));
+            MeasVector d = mat::measSub(xh, xc);
+            if (std::abs(d[0]) > OFFSET_EPS || std::abs(d[1]) > OFFSET_EPS ||
+                std::abs(d[2]) > OFFSET_EPS)
+                candidate_.push_back({id, d});
+        }
+        for (auto& d : delta_) d = MeasVector{};
+
+        // Same offsets as a cheaper survivor: the same future.
+        bool duplicate = false;
+        for (const auto& nl : nextLeaves_) {
+            if (nl.count != static_cast<int>(candidate_.size())) continue;
+            bool same = true;
+            for (int k = 0; k < nl.count && same; ++k) {
+                const TrackOffset& a = offsets_[nb][nl.first + k];
+                const TrackOffset& b = candidate_[k];
+                same = a.trackId == b.trackId &&
+                       std::abs(a.delta[0] - b.delta[0]) <= OFFSET_EPS &&
+                       std::abs(a.delta[1] - b.delta[1]) <= OFFSET_EPS &&
+                       std::abs(a.delta[2] - b.delta[2]) <= OFFSET_EPS;
+            }
+            if (same) { duplicate = true; break; }
+        }
+        if (duplicate) continue;
+        if (offsets_[nb].size() + candidate_.size() > offsets_[nb].capacity()) continue;
+
+        int node = nodes_.acquire();
+        if (node < 0) break;
+        nodes_[node].parent = parent.node;
+        nodes_[node].refs   = 1;
+        ++nodes_[parent.node].refs;
+        const int first = static_cast<int>(offsets_[nb].size());
+        offsets_[nb].insert(offsets_[nb].end(), candidate_.begin(), candidate_.end());
+        nextLeaves_.push_back({node, ch.cost - best.cost, first,
+                               static_cast<int>(candidate_.size())});
+    }
+
+    for (const auto& l : leaves_) releaseNode(l.node);
+    leaves_.swap(nextLeaves_);
+    cur_ = nb;
+
+    // Nothing older than nScan dwells is ever compared: cut the chains there.
+    for (const auto& l : leaves_) {
+        int a = ancestor(l.node, config_.nScan);
+        int p = nodes_[a].parent;
+        if (a != l.node && p >= 0) {
+            nodes_[a].parent = -1;
+            releaseNode(p);
+        }
+    }
+
+    out.matched.clear();
+    out.unmatchedTracks.clear();
+    out.unmatchedClusters.clear();
+    std::vector<char>& clusterMatched = clusterMatched_;
+    clusterMatched.assign(m, 0);
+    for (int t = 0; t < n; ++t) {
+        if (commit[t] >= 0) {
+            AssociationResult res;
+            res.trackIndex   = t;
+            res.clusterIndex = commit[t];
+            res.distance     = childDist_[best.assign + t];
+            out.matched.push_back(res);
+            clusterMatched[commit[t]] = 1;
+        } else {
+            out.unmatchedTracks.push_back(t);
+        }
+    }
+    for (int c = 0; c < m; ++c)
+        if (!clusterMatched[c]) out.unmatchedClusters.push_back(c);
+
+    LOG_DEBUG("MHT", "Matched: %zu, leaves: %zu, nodes: %zu/%zu",
+              out.matched.size(), leaves_.size(), nodes_.inUse(), nodes_.capacity());
+}
+
+} // namespace cuas
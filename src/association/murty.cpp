@@ -0,0 +1,126 @@
+#include "association/murty.h"
+#include <algorithm>
+
+namespace cuas {
+
+namespace {
+
+// Miss cost of a row whose miss is excluded; a solution using it is rejected.
+constexpr double EXCLUDED = 1e12;
+constexpr int    FREE     = -2;   // forcedCol_: row not forced
+
+} // namespace
+
+bool KBestAssignmentSolver::solveNode(const SparseCostMatrix& C, double missCost,
+                                      int first, int count, double& cost,
+                                      std::vector<int>& rowToCol) {
+    const int nRows = C.numRows();
+    forcedCol_.assign(nRows, FREE);
+    colForcedBy_.assign(C.numCols, -1);
+    missExcluded_.assign(nRows, 0);
+    for (int i = first; i < first + count; ++i) {
+        const Constraint& k = constraints_[i];
+        if (!k.forced)        continue;
+        forcedCol_[k.row] = k.col;
+        if (k.col >= 0) colForcedBy_[k.col] = k.row;
+    }
+
+    // Excluded pairs are few; scan them per row.
+    sub_.reset(C.numCols);
+    subMiss_.assign(nRows, missCost);
+    for (int r = 0; r < nRows; ++r) {
+        const int f = forcedCol_[r];
+        if (f != FREE && f >= 0) subMiss_[r] = EXCLUDED;
+        for (int e = C.rowStart[r]; e < C.rowStart[r + 1]; ++e) {
+            const int c = C.col[e];
+            if (f != FREE ? c != f : colForcedBy_[c] >= 0) continue;
+            bool excluded = false;
+            for (int i = first; i < first + count && !excluded; ++i)
+                excluded = !constraints_[i].forced && constraints_[i].row == r &&
+                           constraints_[i].col == c;
+            if (!excluded) sub_.add(c, C.cost[e]);
+        }
+        sub_.endRow();
+    }
+    for (int i = first; i < first + count; ++i)
+        if (!constraints_[i].forced && constraints_[i].col < 0)
+            subMiss_[constraints_[i].row] = EXCLUDED;
+
+    solver_.solve(sub_, subMiss_, rowToCol);
+
+    cost = 0.0;
+    for (int r = 0; r < nRows; ++r) {
+        if (rowToCol[r] < 0) {
+            if (subMiss_[r] >= EXCLUDED) return false;
+            cost += missCost;
+            continue;
+        }
+        for (int e = sub_.rowStart[r]; e < sub_.rowStart[r + 1]; ++e)
+            if (sub_.col[e] == rowToCol[r]) { cost += sub_.cost[e]; break; }
+    }
+    return true;
+}
+
+void KBestAssignmentSolver::solve(const SparseCostMatrix& C, double missCost, int k,
+                                  std::vector<RankedAssignment>& out) {
+    constraints_.clear();
+    nodes_.clear();
+    open_.clear();
+    solutions_.clear();
+    if (k <= 0) { out.clear(); return; }
+
+    // out's entries are overwritten in place so their rowToCol capacity is
+    // kept; only the surplus is dropped at the end.
+    const int nRows = C.numRows();
+    size_t produced = 0;
+
+    auto cheaper = [&](int a, int b) { return nodes_[a].cost > nodes_[b].cost; };
+    auto push = [&](int first, int count) {
+        double cost;
+        if (!solveNode(C, missCost, first, count, cost, sol_)) return;
+        const int solution = static_cast<int>(solutions_.size());
+        solutions_.insert(solutions_.end(), sol_.begin(), sol_.begin() + nRows);
+        nodes_.push_back({cost, first, count, solution});
+        open_.push_back(static_cast<int>(nodes_.size()) - 1);
+        std::push_heap(open_.begin(), open_.end(), cheaper);
+    };
+
+    push(0, 0);
+    while (!open_.empty() && static_cast<int>(produced) < k) {
+        std::pop_heap(open_.begin(), open_.end(), cheaper);
+        const Node node = nodes_[open_.back()];
+        open_.pop_back();
+        if (produced == out.size()) out.emplace_back();
+        RankedAssignment& ranked = out[produced++];
+        ranked.cost = node.cost;
+        ranked.rowToCol.assign(solutions_.begin() + node.solution,
+                               solutions_.begin() + node.solution + nRows);
+        if (static_cast<int>(produced) == k) break;
+
+        // Partition the rest of this node's space over its free rows.
+        forced_.assign(nRows, 0);
+        for (int i = node.first; i < node.first + node.count; ++i)
+            if (constraints_[i].forced) forced_[constraints_[i].row] = 1;
+
+        forcedSoFar_.clear();
+        for (int r = 0; r < nRows; ++r) {
+            if (forced_[r]) continue;
+            // A row with no pairs can only miss: excluding that is infeasible.
+            if (C.rowStart[r] != C.rowStart[r + 1]) {
+                const int first = static_cast<int>(constraints_.size());
+                for (int i = node.first; i < node.first + node.count; ++i) {
+                    Constraint inherited = constraints_[i];
+                    constraints_.push_back(inherited);
+                }
+                for (int fr : forcedSoFar_)
+                    constraints_.push_back({fr, solutions_[node.solution + fr], true});
+                constraints_.push_back({r, solutions_[node.solution + r], false});
+                push(first, static_cast<int>(constraints_.size()) - first);
+            }
+            forcedSoFar_.push_back(r);
+        }
+    }
+    out.resize(produced);
+}
+
+} // namespace cuas
@@ -2,41 +2,264 @@
 #include "clustering/dbscan_clusterer.h"
 #include "clustering/range_clusterer.h"
 #include "clustering/range_strength_clusterer.h"
+#include "clustering/component_clusterer.h"
+#include "clustering/sector_clusterer.h"
 #include "common/logger.h"
+#include "common/profiling.h"
+#include "common/matrix_ops.h"
+#include <algorithm>
+#include <cmath>
 
 namespace cuas {
 
-ClusterEngine::ClusterEngine(const ClusterConfig& cfg) : config_(cfg) {
+std::unique_ptr<IClusterer> makeClusterer(const ClusterConfig& cfg) {
     switch (cfg.method) {
         case ClusterMethod::DBSCAN:
-            clusterer_ = std::make_unique<DBScanClusterer>(cfg.dbscan);
-            break;
+            return std::make_unique<DBScanClusterer>(cfg.dbscan);
         case ClusterMethod::RangeBased:
-            clusterer_ = std::make_unique<RangeClusterer>(cfg.rangeBased);
-            break;
+            return std::make_unique<RangeClusterer>(cfg.rangeBased);
         case ClusterMethod::RangeStrengthBased:
-            clusterer_ = std::make_unique<RangeStrengthClusterer>(cfg.rangeStrength);
-            break;
+            return std::make_unique<RangeStrengthClusterer>(cfg.rangeStrength);
+        case ClusterMethod::ConnectedComponents:
+            return std::make_unique<ComponentClusterer>(cfg.connectedComponents);
     }
+    return nullptr;
+}
+
+ClusterEngine::ClusterEngine(const ClusterConfig& cfg) {
+    reconfigure(cfg);
+}
+
+void ClusterEngine::reconfigure(const ClusterConfig& cfg) {
+    config_ = cfg;
+    if (cfg.sectors > 1)
+        clusterer_ = std::make_unique<SectorClusterer>(cfg);
+    else
+        clusterer_ = makeClusterer(cfg);
+    local_.reset();
     LOG_INFO("ClusterEngine", "Initialized with method: %s", clusterer_->name().c_str());
 }
 
-std::vector<Cluster> ClusterEngine::process(const std::vector<Detection>& dets) {
-    if (dets.empty()) return {};
+Cluster& IClusterer::clusterSlot(std::vector<Cluster>& out, size_t i) {
+    if (i < out.size()) {
+        std::vector<uint32_t> indices = std::move(out[i].detectionIndices);
+        out[i] = Cluster{};
+        out[i].detectionIndices = std::move(indices);
+    } else {
+        out.emplace_back();
+        if (!spareIndices_.empty()) {
+            out.back().detectionIndices = std::move(spareIndices_.back());
+            spareIndices_.pop_back();
+        }
+    }
+    out[i].detectionIndices.clear();
+    return out[i];
+}
+
+void IClusterer::trimClusters(std::vector<Cluster>& out, size_t n) {
+    while (out.size() > n) {
+        spareIndices_.push_back(std::move(out.back().detectionIndices));
+        out.pop_back();
+    }
+}
+
+void IClusterer::buildCluster(const std::vector<Detection>& dets, const int* indices,
+                               size_t count, uint32_t id, Cluster& c) {
+    // 10^(dB/10) as one exp per detection.
+    static constexpr double DB_TO_NEPER = 0.23025850929940458;   // ln(10) / 10
 
-    auto clusters = clusterer_->cluster(dets);
+    c.clusterId = id;
+    c.numDetections = static_cast<uint32_t>(count);
+    c.detectionIndices.resize(count);
+    linStrength_.resize(count);
 
-    for (auto& c : clusters) {
+    double linStrengthSum = 0.0;
+    double totalStrength  = 0.0;
+    for (size_t k = 0; k < count; ++k) {
+        const Detection& d = dets[indices[k]];
+        c.detectionIndices[k] = static_cast<uint32_t>(indices[k]);
+        linStrength_[k] = std::exp(DB_TO_NEPER * d.strength);
+        linStrengthSum += linStrength_[k];
+        totalStrength  += d.strength;
+    }
+
+    // Strength-weighted centroid
+    double range = 0.0, azimuth = 0.0, elevation = 0.0;
+    double snr = 0.0, rcs = 0.0, microDoppler = 0.0;
+    for (size_t k = 0; k < count; ++k) {
+        const Detection& d = dets[indices[k]];
+        const double w = linStrength_[k];
+        range        += w * d.range;
+        azimuth      += w * d.azimuth;
+        elevation    += w * d.elevation;
+        snr          += w * d.snr;
+        rcs          += w * d.rcs;
+        microDoppler += w * d.microDoppler;
+    }
+    const double inv = 1.0 / linStrengthSum;
+    c.range        = range * inv;
+    c.azimuth      = azimuth * inv;
+    c.elevation    = elevation * inv;
+    c.snr          = snr * inv;
+    c.rcs          = rcs * inv;
+    c.microDoppler = microDoppler * inv;
+    c.strength     = totalStrength / count;
+}
+
+void ClusterEngine::process(const std::vector<Detection>& dets, std::vector<Cluster>& out) {
+    CUAS_PROFILE_ZONE("ClusterEngine::process");
+    clusterer_->cluster(dets, out);
+
+    for (auto& c : out) {
         c.clusterId = nextClusterId_++;
         c.cartesian = sphericalToCartesian(c.range, c.azimuth, c.elevation);
     }
 
     LOG_DEBUG("ClusterEngine", "Input dets: %zu, Output clusters: %zu",
-              dets.size(), clusters.size());
+              dets.size(), out.size());
+}
 
+std::vector<Cluster> ClusterEngine::process(const std::vector<Detection>& dets) {
+    std::vector<Cluster> clusters;
+    process(dets, clusters);
     return clusters;
 }
 
+void ClusterEngine::clusterGroup(IClusterer& clusterer, const std::vector<Detection>& dets,
+                                 const uint32_t* indices, size_t count,
+                                 std::vector<Cluster>& out) {
+    group_.resize(count);
+    for (size_t k = 0; k < count; ++k) group_[k] = dets[indices[k]];
+    clusterer.cluster(group_, out);
+    for (auto& c : out)
+        for (uint32_t& i : c.detectionIndices) i = indices[i];
+}
+
+bool ClusterEngine::isolated(const std::vector<Detection>& dets, int track,
+                             const uint32_t* indices, size_t count) const {
+    const double reach = local_->linkRange();
+    for (size_t k = 0; k < count; ++k) {
+        const Detection& a = dets[indices[k]];
+        auto it = std::lower_bound(byRange_.begin(), byRange_.end(), a.range - reach,
+                                   [&dets](uint32_t d, double r) { return dets[d].range < r; });
+        for (; it != byRange_.end() && dets[*it].range <= a.range + reach; ++it)
+            if (claim_[*it] != track && local_->linked(a, dets[*it])) return false;
+    }
+    return true;
+}
+
+void ClusterEngine::processAided(const std::vector<Detection>& dets,
+                                 const std::vector<InnovationStats>& gates,
+                                 const std::vector<uint8_t>& aiding, double gate,
+                                 std::vector<Cluster>& out, std::vector<Cluster>& aided,
+                                 std::vector<int>& owner) {
+    CUAS_PROFILE_ZONE("ClusterEngine::processAided");
+    if (!local_) local_ = makeClusterer(config_);
+    const size_t nDets   = dets.size();
+    const size_t nTracks = gates.size();
+
+    positions_.resize(nDets);
+    for (size_t d = 0; d < nDets; ++d)
+        positions_[d] = sphericalToCartesian(dets[d].range, dets[d].azimuth, dets[d].elevation);
+
+    // Claims.  Only the aiding gates are searched: an aiding track takes the
+    // detections in its gate ahead of any other track, and a detection two
+    // of them gate is left for the association to decide.
+    index_.build(gates, positions_, gate);
+    claim_.assign(nDets, -1);
+    shared_.assign(nTracks, 0);
+    for (size_t t = 0; t < nTracks; ++t) {
+        const InnovationStats& inn = gates[t];
+        if (!inn.valid || !aiding[t]) continue;
+        index_.candidates(inn, near_);
+        for (int d : near_) {
+            const MeasVector z = {positions_[d].x, positions_[d].y, positions_[d].z};
+            const double d2 = mat::mahalanobisDistance(mat::measSub(z, inn.zPred), inn.Sinv);
+            if (d2 > gate) continue;
+            if (claim_[d] == -1) {
+                claim_[d] = static_cast<int>(t);
+            } else {
+                if (claim_[d] >= 0) shared_[claim_[d]] = 1;
+                shared_[t] = 1;
+                claim_[d]  = -2;
+            }
+        }
+    }
+
+    // Counting sort of the claimed detections by track; after the fill,
+    // track t's run ends at trackStart_[t].
+    trackStart_.assign(nTracks + 1, 0);
+    blind_.clear();
+    for (size_t d = 0; d < nDets; ++d) {
+        const int t = claim_[d];
+        if (t >= 0 && !shared_[t]) ++trackStart_[t + 1];
+        else                       blind_.push_back(static_cast<uint32_t>(d));
+    }
+    for (size_t t = 0; t < nTracks; ++t) trackStart_[t + 1] += trackStart_[t];
+    byTrack_.resize(trackStart_[nTracks]);
+    for (size_t d = 0; d < nDets; ++d) {
+        const int t = claim_[d];
+        if (t >= 0 && !shared_[t]) byTrack_[trackStart_[t]++] = static_cast<uint32_t>(d);
+    }
+
+    // The dwell in range order, for the closure test below.
+    if (!byTrack_.empty()) {
+        byRange_.resize(nDets);
+        for (size_t d = 0; d < nDets; ++d) byRange_[d] = static_cast<uint32_t>(d);
+        std::sort(byRange_.begin(), byRange_.end(), [&dets](uint32_t a, uint32_t b) {
+            return dets[a].range < dets[b].range;
+        });
+    }
+
+    // A track keeps its detections only if they form one cluster inside
+    // its gate, and none of them is linked to a detection outside the
+    // group: the blind clusterer then forms that very cluster, so the
+    // dwell's clusters are the blind ones.  A split or joined group (a
+    // second target, clutter) goes back to the blind detections for the
+    // association to sort out.  Slots are swapped, not copied, so member
+    // lists keep their capacity.
+    size_t nAided = 0;
+    owner.clear();
+    const size_t nBlind = blind_.size();
+    for (size_t t = 0, begin = 0; t < nTracks; begin = trackStart_[t++]) {
+        const size_t end = trackStart_[t];
+        if (end == begin) continue;
+
+        bool kept = isolated(dets, static_cast<int>(t), byTrack_.data() + begin, end - begin);
+        if (kept) {
+            clusterGroup(*local_, dets, byTrack_.data() + begin, end - begin, localOut_);
+            kept = localOut_.size() == 1;
+        }
+        if (kept) {
+            Cluster& c = localOut_[0];
+            c.cartesian = sphericalToCartesian(c.range, c.azimuth, c.elevation);
+            const MeasVector z = {c.cartesian.x, c.cartesian.y, c.cartesian.z};
+            kept = mat::mahalanobisDistance(mat::measSub(z, gates[t].zPred), gates[t].Sinv) <= gate;
+        }
+        if (kept) {
+            if (nAided == aided.size()) aided.emplace_back();
+            std::swap(aided[nAided++], localOut_[0]);
+            owner.push_back(static_cast<int>(t));
+        } else {
+            blind_.insert(blind_.end(), byTrack_.begin() + begin, byTrack_.begin() + end);
+        }
+    }
+    aided.resize(nAided);
+    if (blind_.size() != nBlind) std::sort(blind_.begin(), blind_.end());
+
+    if (blind_.size() == nDets) clusterer_->cluster(dets, out);
+    else                        clusterGroup(*clusterer_, dets, blind_.data(), blind_.size(), out);
+
+    for (auto& c : out) {
+        c.clusterId = nextClusterId_++;
+        c.cartesian = sphericalToCartesian(c.range, c.azimuth, c.elevation);
+    }
+    for (auto& c : aided) c.clusterId = nextClusterId_++;
+
+    LOG_DEBUG("ClusterEngine", "Input dets: %zu (%zu blind), clusters: %zu blind, %zu track-aided",
+              nDets, blind_.size(), out.size(), aided.size());
+}
+
 std::string ClusterEngine::activeMethod() const {
     return clusterer_ ? clusterer_->name() : "None";
 }
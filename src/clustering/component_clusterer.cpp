@@ -0,0 +1,85 @@
+#include "clustering/component_clusterer.h"
+#include "common/logger.h"
+#include "common/profiling.h"
+#include <algorithm>
+
+namespace cuas {
+
+ComponentClusterer::ComponentClusterer(const ConnectedComponentsConfig& cfg) : config_(cfg) {}
+
+bool ComponentClusterer::inGate(const Detection& a, const Detection& b) const {
+    double dr = (a.range - b.range) / config_.rangeGateSize;
+    double da = (a.azimuth - b.azimuth) / config_.azimuthGateSize;
+    double de = (a.elevation - b.elevation) / config_.elevationGateSize;
+    return dr * dr + da * da + de * de <= 1.0;
+}
+
+int ComponentClusterer::find(int i) {
+    // Path halving: every visited node skips to its grandparent.
+    while (parent_[i] != i) {
+        parent_[i] = parent_[parent_[i]];
+        i = parent_[i];
+    }
+    return i;
+}
+
+void ComponentClusterer::unite(int a, int b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) return;
+    if (rank_[a] < rank_[b]) std::swap(a, b);
+    parent_[b] = a;
+    if (rank_[a] == rank_[b]) ++rank_[a];
+}
+
+void ComponentClusterer::cluster(const std::vector<Detection>& dets, std::vector<Cluster>& out) {
+    CUAS_PROFILE_ZONE("component cluster");
+    int n = static_cast<int>(dets.size());
+    if (n == 0) { trimClusters(out, 0); return; }
+
+    sortedIdx_.resize(n);
+    parent_.resize(n);
+    for (int i = 0; i < n; ++i) sortedIdx_[i] = parent_[i] = i;
+    rank_.assign(n, 0);
+    std::sort(sortedIdx_.begin(), sortedIdx_.end(), [&](int a, int b) {
+        return dets[a].range < dets[b].range;
+    });
+
+    // Every pair within rangeGateSize in range is tested once.
+    for (int si = 0; si < n; ++si) {
+        const Detection& a = dets[sortedIdx_[si]];
+        for (int sj = si + 1; sj < n; ++sj) {
+            const Detection& b = dets[sortedIdx_[sj]];
+            if (b.range - a.range > config_.rangeGateSize) break;
+            if (inGate(a, b)) unite(sortedIdx_[si], sortedIdx_[sj]);
+        }
+    }
+
+    // Label components in order of their lowest detection index, as DBSCAN
+    // numbers clusters, then group the detections by label, ascending.
+    labels_.assign(n, -1);
+    int numClusters = 0;
+    for (int i = 0; i < n; ++i) {
+        int root = find(i);
+        if (labels_[root] < 0) labels_[root] = numClusters++;
+        labels_[i] = labels_[root];
+    }
+
+    start_.assign(numClusters + 1, 0);
+    for (int i = 0; i < n; ++i) ++start_[labels_[i] + 1];
+    for (int k = 0; k < numClusters; ++k) start_[k + 1] += start_[k];
+    members_.resize(n);
+    for (int i = 0; i < n; ++i) members_[start_[labels_[i]]++] = i;
+    for (int k = numClusters; k > 0; --k) start_[k] = start_[k - 1];
+    start_[0] = 0;
+
+    for (int k = 0; k < numClusters; ++k)
+        buildCluster(dets, members_.data() + start_[k], start_[k + 1] - start_[k],
+                     static_cast<uint32_t>(k), clusterSlot(out, k));
+    trimClusters(out, numClusters);
+
+    LOG_TRACE("ComponentClusterer", "Formed %zu clusters from %d detections",
+              out.size(), n);
+}
+
+} // namespace cuas
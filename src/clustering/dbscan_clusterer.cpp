@@ -1,131 +1,144 @@
 #include "clustering/dbscan_clusterer.h"
 #include "common/logger.h"
+#include "common/profiling.h"
 #include <algorithm>
 #include <numeric>
 #include <cmath>
-#include <map>
 
 namespace cuas {
 
 DBScanClusterer::DBScanClusterer(const DBScanConfig& cfg) : config_(cfg) {}
 
-double DBScanClusterer::distance(const Detection& a, const Detection& b) const {
+namespace {
+
+int64_t cellOf(double v, double epsilon) {
+    double u = std::floor(v / epsilon);
+    return std::isfinite(u) ? static_cast<int64_t>(u) : 0;
+}
+
+} // namespace
+
+double DBScanClusterer::distanceSq(const Detection& a, const Detection& b) const {
     double dr = (a.range - b.range) / config_.epsilonRange;
     double da = (a.azimuth - b.azimuth) / config_.epsilonAzimuth;
     double de = (a.elevation - b.elevation) / config_.epsilonElevation;
-    return std::sqrt(dr * dr + da * da + de * de);
+    return dr * dr + da * da + de * de;
 }
 
-void DBScanClusterer::rangeQuery(const std::vector<Detection>& dets, int idx,
-                                  std::vector<int>& neighbors) const {
-    neighbors.clear();
-    for (int i = 0; i < static_cast<int>(dets.size()); ++i) {
-        if (distance(dets[idx], dets[i]) <= 1.0) {
-            neighbors.push_back(i);
-        }
-    }
+size_t DBScanClusterer::bucketOf(int64_t ir, int64_t ia, int64_t ie) const {
+    uint64_t h = static_cast<uint64_t>(ir) * 73856093u ^
+                 static_cast<uint64_t>(ia) * 19349663u ^
+                 static_cast<uint64_t>(ie) * 83492791u;
+    return static_cast<size_t>(h) & bucketMask_;
 }
 
-Cluster DBScanClusterer::buildCluster(const std::vector<Detection>& dets,
-                                       const std::vector<int>& indices, uint32_t id) const {
-    Cluster c;
-    c.clusterId = id;
-    c.numDetections = static_cast<uint32_t>(indices.size());
-
-    double totalStrength = 0.0;
-    double linStrengthSum = 0.0;
-
-    for (int idx : indices) {
-        double linStr = std::pow(10.0, dets[idx].strength / 10.0);
-        linStrengthSum += linStr;
-        c.detectionIndices.push_back(static_cast<uint32_t>(idx));
-    }
-
-    // Strength-weighted centroid
-    for (int idx : indices) {
-        double linStr = std::pow(10.0, dets[idx].strength / 10.0);
-        double w = linStr / linStrengthSum;
-        c.range     += w * dets[idx].range;
-        c.azimuth   += w * dets[idx].azimuth;
-        c.elevation += w * dets[idx].elevation;
-        c.snr       += w * dets[idx].snr;
-        c.rcs       += w * dets[idx].rcs;
-        c.microDoppler += w * dets[idx].microDoppler;
-        totalStrength += dets[idx].strength;
+void DBScanClusterer::buildGrid(const std::vector<Detection>& dets) {
+    const size_t n = dets.size();
+    size_t buckets = 1;
+    while (buckets < 2 * n) buckets <<= 1;
+    bucketMask_ = buckets - 1;
+
+    // Counting sort of the detections by bucket.
+    cell_.resize(n);
+    bucketStart_.assign(buckets + 1, 0);
+    for (size_t i = 0; i < n; ++i) {
+        cell_[i] = {cellOf(dets[i].range,     config_.epsilonRange),
+                    cellOf(dets[i].azimuth,   config_.epsilonAzimuth),
+                    cellOf(dets[i].elevation, config_.epsilonElevation)};
+        ++bucketStart_[bucketOf(cell_[i][0], cell_[i][1], cell_[i][2]) + 1];
     }
+    for (size_t b = 0; b < buckets; ++b) bucketStart_[b + 1] += bucketStart_[b];
+    gridItems_.resize(n);
+    bucketFill_.assign(bucketStart_.begin(), bucketStart_.end() - 1);
+    for (size_t i = 0; i < n; ++i)
+        gridItems_[bucketFill_[bucketOf(cell_[i][0], cell_[i][1], cell_[i][2])]++] =
+            static_cast<int>(i);
+}
 
-    c.strength = totalStrength / indices.size();
-    return c;
+void DBScanClusterer::rangeQuery(const std::vector<Detection>& dets, int idx,
+                                  std::vector<int>& neighbors) const {
+    // Neighbours come out grouped by cell rather than by index; the expansion
+    // only asks which points are reachable, so the clusters are unchanged.
+    neighbors.clear();
+    const std::array<int64_t, 3>& c = cell_[idx];
+    for (int64_t ir = c[0] - 1; ir <= c[0] + 1; ++ir)
+        for (int64_t ia = c[1] - 1; ia <= c[1] + 1; ++ia)
+            for (int64_t ie = c[2] - 1; ie <= c[2] + 1; ++ie) {
+                size_t b = bucketOf(ir, ia, ie);
+                for (uint32_t k = bucketStart_[b]; k < bucketStart_[b + 1]; ++k) {
+                    int i = gridItems_[k];
+                    const std::array<int64_t, 3>& ci = cell_[i];
+                    if (ci[0] != ir || ci[1] != ia || ci[2] != ie) continue;
+                    if (distanceSq(dets[idx], dets[i]) <= 1.0) neighbors.push_back(i);
+                }
+            }
 }
 
-std::vector<Cluster> DBScanClusterer::cluster(const std::vector<Detection>& dets) {
+void DBScanClusterer::cluster(const std::vector<Detection>& dets, std::vector<Cluster>& out) {
+    CUAS_PROFILE_ZONE("DBSCAN cluster");
     int n = static_cast<int>(dets.size());
-    if (n == 0) return {};
+    if (n == 0) { trimClusters(out, 0); return; }
 
-    std::vector<int> labels(n, -1);       // -1 = undefined
+    buildGrid(dets);
+    labels_.assign(n, -1);                // -1 = undefined
     static constexpr int NOISE = -2;
     int clusterLabel = 0;
 
     for (int i = 0; i < n; ++i) {
-        if (labels[i] != -1) continue;
+        if (labels_[i] != -1) continue;
 
-        std::vector<int> neighbors;
-        rangeQuery(dets, i, neighbors);
+        rangeQuery(dets, i, neighbors_);
 
-        if (static_cast<int>(neighbors.size()) < config_.minPoints) {
-            labels[i] = NOISE;
+        if (static_cast<int>(neighbors_.size()) < config_.minPoints) {
+            labels_[i] = NOISE;
             continue;
         }
 
         int currentLabel = clusterLabel++;
-        labels[i] = currentLabel;
+        labels_[i] = currentLabel;
 
-        std::vector<int> seedSet(neighbors.begin(), neighbors.end());
-        for (size_t si = 0; si < seedSet.size(); ++si) {
-            int q = seedSet[si];
-            if (labels[q] == NOISE) {
-                labels[q] = currentLabel;
+        seeds_.assign(neighbors_.begin(), neighbors_.end());
+        for (size_t si = 0; si < seeds_.size(); ++si) {
+            int q = seeds_[si];
+            if (labels_[q] == NOISE) {
+                labels_[q] = currentLabel;
             }
-            if (labels[q] != -1) continue;
+            if (labels_[q] != -1) continue;
 
-            labels[q] = currentLabel;
+            labels_[q] = currentLabel;
 
-            std::vector<int> qNeighbors;
-            rangeQuery(dets, q, qNeighbors);
-            if (static_cast<int>(qNeighbors.size()) >= config_.minPoints) {
-                for (int nn : qNeighbors) {
-                    if (labels[nn] == -1 || labels[nn] == NOISE) {
-                        seedSet.push_back(nn);
+            rangeQuery(dets, q, qNeighbors_);
+            if (static_cast<int>(qNeighbors_.size()) >= config_.minPoints) {
+                for (int nn : qNeighbors_) {
+                    if (labels_[nn] == -1 || labels_[nn] == NOISE) {
+                        seeds_.push_back(nn);
                     }
                 }
             }
         }
     }
 
-    // Build clusters from labels
-    std::map<int, std::vector<int>> clusterMap;
-    for (int i = 0; i < n; ++i) {
-        if (labels[i] >= 0) {
-            clusterMap[labels[i]].push_back(i);
-        }
-    }
-
     // Noise points become single-detection clusters
     for (int i = 0; i < n; ++i) {
-        if (labels[i] == NOISE) {
-            clusterMap[clusterLabel++] = {i};
-        }
+        if (labels_[i] == NOISE) labels_[i] = clusterLabel++;
     }
 
-    std::vector<Cluster> result;
-    result.reserve(clusterMap.size());
-    for (auto& [label, indices] : clusterMap) {
-        result.push_back(buildCluster(dets, indices, static_cast<uint32_t>(label)));
-    }
+    // Group the detections by label, ascending within each cluster.
+    start_.assign(clusterLabel + 1, 0);
+    for (int i = 0; i < n; ++i) ++start_[labels_[i] + 1];
+    for (int k = 0; k < clusterLabel; ++k) start_[k + 1] += start_[k];
+    members_.resize(n);
+    for (int i = 0; i < n; ++i) members_[start_[labels_[i]]++] = i;
+    for (int k = clusterLabel; k > 0; --k) start_[k] = start_[k - 1];
+    start_[0] = 0;
+
+    for (int k = 0; k < clusterLabel; ++k)
+        buildCluster(dets, members_.data() + start_[k], start_[k + 1] - start_[k],
+                     static_cast<uint32_t>(k), clusterSlot(out, k));
+    trimClusters(out, clusterLabel);
 
     LOG_TRACE("DBScan", "Formed %zu clusters from %d detections",
-              result.size(), n);
-    return result;
+              out.size(), n);
 }
 
 } // namespace cuas
@@ -1,5 +1,6 @@
 #include "clustering/range_strength_clusterer.h"
 #include "common/logger.h"
+#include "common/profiling.h"
 #include <algorithm>
 #include <cmath>
 
@@ -14,74 +15,46 @@ bool RangeStrengthClusterer::inGate(const Detection& a, const Detection& b) cons
            std::abs(a.strength - b.strength) <= config_.strengthGateSize;
 }
 
-Cluster RangeStrengthClusterer::buildCluster(const std::vector<Detection>& dets,
-                                              const std::vector<int>& indices,
-                                              uint32_t id) const {
-    Cluster c;
-    c.clusterId = id;
-    c.numDetections = static_cast<uint32_t>(indices.size());
-
-    double linStrengthSum = 0.0;
-    for (int idx : indices) {
-        double linStr = std::pow(10.0, dets[idx].strength / 10.0);
-        linStrengthSum += linStr;
-        c.detectionIndices.push_back(static_cast<uint32_t>(idx));
-    }
-
-    double totalStrength = 0.0;
-    for (int idx : indices) {
-        double linStr = std::pow(10.0, dets[idx].strength / 10.0);
-        double w = linStr / linStrengthSum;
-        c.range     += w * dets[idx].range;
-        c.azimuth   += w * dets[idx].azimuth;
-        c.elevation += w * dets[idx].elevation;
-        c.snr       += w * dets[idx].snr;
-        c.rcs       += w * dets[idx].rcs;
-        c.microDoppler += w * dets[idx].microDoppler;
-        totalStrength += dets[idx].strength;
-    }
-    c.strength = totalStrength / indices.size();
-    return c;
-}
-
-std::vector<Cluster> RangeStrengthClusterer::cluster(const std::vector<Detection>& dets) {
+void RangeStrengthClusterer::cluster(const std::vector<Detection>& dets, std::vector<Cluster>& out) {
+    CUAS_PROFILE_ZONE("range-strength cluster");
     int n = static_cast<int>(dets.size());
-    if (n == 0) return {};
-
-    // Sort by range
-    std::vector<int> sortedIdx(n);
-    for (int i = 0; i < n; ++i) sortedIdx[i] = i;
-    std::sort(sortedIdx.begin(), sortedIdx.end(), [&](int a, int b) {
-        return dets[a].range < dets[b].range;
+    if (n == 0) { trimClusters(out, 0); return; }
+
+    // Sort by range, ties by index so the seeds do not depend on the sort
+    sortedIdx_.resize(n);
+    for (int i = 0; i < n; ++i) sortedIdx_[i] = i;
+    std::sort(sortedIdx_.begin(), sortedIdx_.end(), [&](int a, int b) {
+        return dets[a].range < dets[b].range ||
+               (dets[a].range == dets[b].range && a < b);
     });
 
-    std::vector<bool> assigned(n, false);
-    std::vector<Cluster> result;
+    assigned_.assign(n, 0);
     uint32_t cid = 0;
 
     for (int si = 0; si < n; ++si) {
-        int i = sortedIdx[si];
-        if (assigned[i]) continue;
+        int i = sortedIdx_[si];
+        if (assigned_[i]) continue;
 
-        std::vector<int> group = {i};
-        assigned[i] = true;
+        group_.assign(1, i);
+        assigned_[i] = 1;
 
         for (int sj = si + 1; sj < n; ++sj) {
-            int j = sortedIdx[sj];
-            if (assigned[j]) continue;
+            int j = sortedIdx_[sj];
+            if (assigned_[j]) continue;
             if (dets[j].range - dets[i].range > config_.rangeGateSize) break;
             if (inGate(dets[i], dets[j])) {
-                group.push_back(j);
-                assigned[j] = true;
+                group_.push_back(j);
+                assigned_[j] = 1;
             }
         }
 
-        result.push_back(buildCluster(dets, group, cid++));
+        buildCluster(dets, group_.data(), group_.size(), cid, clusterSlot(out, cid));
+        ++cid;
     }
+    trimClusters(out, cid);
 
     LOG_TRACE("RangeStrength", "Formed %zu clusters from %d detections",
-              result.size(), n);
-    return result;
+              out.size(), n);
 }
 
 } // namespace cuas
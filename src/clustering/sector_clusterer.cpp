@@ -0,0 +1,285 @@
+#include "clustering/sector_clusterer.h"
+#include "common/logger.h"
+#include "common/profiling.h"
+#include <algorithm>
+
+namespace cuas {
+
+// Below this many detections a dwell is clustered serially: the slicing and
+// the fork/join would cost more than they save.
+static constexpr size_t MIN_SECTOR_DETECTIONS = 256;
+
+SectorClusterer::SectorClusterer(const ClusterConfig& cfg)
+    : numSectors_(std::max(1, cfg.sectors)),
+      greedy_(cfg.method == ClusterMethod::RangeBased ||
+              cfg.method == ClusterMethod::RangeStrengthBased),
+      pool_(std::max(1, cfg.sectors)) {
+    switch (cfg.method) {
+        case ClusterMethod::DBSCAN:
+            epsRange_     = cfg.dbscan.epsilonRange;
+            epsAzimuth_   = cfg.dbscan.epsilonAzimuth;
+            epsElevation_ = cfg.dbscan.epsilonElevation;
+            minPoints_    = cfg.dbscan.minPoints;
+            break;
+        case ClusterMethod::ConnectedComponents:
+            epsRange_     = cfg.connectedComponents.rangeGateSize;
+            epsAzimuth_   = cfg.connectedComponents.azimuthGateSize;
+            epsElevation_ = cfg.connectedComponents.elevationGateSize;
+            break;
+        case ClusterMethod::RangeBased:
+            azimuthGate_ = cfg.rangeBased.azimuthGateSize;
+            break;
+        case ClusterMethod::RangeStrengthBased:
+            azimuthGate_ = cfg.rangeStrength.azimuthGateSize;
+            break;
+    }
+
+    serial_.resize(greedy_ ? numSectors_ : 1);
+    for (auto& c : serial_) c = makeClusterer(cfg);
+    sectors_.resize(numSectors_);
+}
+
+std::string SectorClusterer::name() const {
+    return serial_[0]->name() + " x" + std::to_string(numSectors_) + " sectors";
+}
+
+void SectorClusterer::cluster(const std::vector<Detection>& dets, std::vector<Cluster>& out) {
+    CUAS_PROFILE_ZONE("sector cluster");
+    if (numSectors_ == 1 || dets.size() < MIN_SECTOR_DETECTIONS) {
+        serial_[0]->cluster(dets, out);
+        return;
+    }
+    sortByAzimuth(dets);
+    if (greedy_) clusterSlices(dets, out);
+    else         clusterGraph(dets, out);
+}
+
+void SectorClusterer::sortByAzimuth(const std::vector<Detection>& dets) {
+    const int n = static_cast<int>(dets.size());
+    azOrder_.resize(n);
+    for (int i = 0; i < n; ++i) azOrder_[i] = i;
+    std::sort(azOrder_.begin(), azOrder_.end(), [&](int a, int b) {
+        return dets[a].azimuth < dets[b].azimuth ||
+               (dets[a].azimuth == dets[b].azimuth && a < b);
+    });
+}
+
+double SectorClusterer::distanceSq(const Detection& a, const Detection& b) const {
+    double dr = (a.range - b.range) / epsRange_;
+    double da = (a.azimuth - b.azimuth) / epsAzimuth_;
+    double de = (a.elevation - b.elevation) / epsElevation_;
+    return dr * dr + da * da + de * de;
+}
+
+int SectorClusterer::find(int i) {
+    while (parent_[i] != i) {
+        parent_[i] = parent_[parent_[i]];
+        i = parent_[i];
+    }
+    return i;
+}
+
+void SectorClusterer::unite(int a, int b) {
+    a = find(a);
+    b = find(b);
+    if (a == b) return;
+    if (rank_[a] < rank_[b]) std::swap(a, b);
+    parent_[b] = a;
+    if (rank_[a] == rank_[b]) ++rank_[a];
+}
+
+// ---------------------------------------------------------------------------
+// Gate graph (DBSCAN, ConnectedComponents)
+// ---------------------------------------------------------------------------
+
+void SectorClusterer::findPairs(const std::vector<Detection>& dets, int s) {
+    Sector& sec = sectors_[s];
+    sec.pairs.clear();
+
+    // Every neighbour of an owned detection is within one epsilon in
+    // azimuth of the owned span; the tests use distanceSq's own quotient,
+    // so no neighbour is lost to rounding.
+    const double lo = dets[azOrder_[sec.begin]].azimuth;
+    const double hi = dets[azOrder_[sec.end - 1]].azimuth;
+    auto first = std::partition_point(azOrder_.begin(), azOrder_.begin() + sec.begin, [&](int i) {
+        return (dets[i].azimuth - lo) / epsAzimuth_ < -1.0;
+    });
+    auto last = std::partition_point(azOrder_.begin() + sec.end, azOrder_.end(), [&](int i) {
+        return (dets[i].azimuth - hi) / epsAzimuth_ <= 1.0;
+    });
+    sec.window.assign(first, last);
+    std::sort(sec.window.begin(), sec.window.end(), [&](int a, int b) {
+        return dets[a].range < dets[b].range;
+    });
+
+    const size_t w = sec.window.size();
+    for (size_t a = 0; a < w; ++a) {
+        const int i = sec.window[a];
+        const bool ownI = sectorOf_[i] == s;
+        for (size_t b = a + 1; b < w; ++b) {
+            const int j = sec.window[b];
+            if ((dets[j].range - dets[i].range) / epsRange_ > 1.0) break;
+            const bool ownJ = sectorOf_[j] == s;
+            if (!(ownI || ownJ) || distanceSq(dets[i], dets[j]) > 1.0) continue;
+            if (ownI) ++count_[i];
+            if (ownJ) ++count_[j];
+            sec.pairs.emplace_back(i, j);
+        }
+    }
+}
+
+void SectorClusterer::clusterGraph(const std::vector<Detection>& dets, std::vector<Cluster>& out) {
+    const int n = static_cast<int>(dets.size());
+    const int k = numSectors_;
+
+    sectorOf_.resize(n);
+    for (int s = 0; s < k; ++s) {
+        Sector& sec = sectors_[s];
+        sec.begin = static_cast<size_t>(n) * s / k;
+        sec.end   = static_cast<size_t>(n) * (s + 1) / k;
+        for (size_t p = sec.begin; p < sec.end; ++p) sectorOf_[azOrder_[p]] = s;
+    }
+    count_.assign(n, 1);          // a detection is its own neighbour
+    parent_.resize(n);
+    for (int i = 0; i < n; ++i) parent_[i] = i;
+    rank_.assign(n, 0);
+
+    // Each slice writes only the counts, parents and labels of the
+    // detections it owns.
+    pool_.parallelFor(k, 1, [&](size_t b, size_t e) {
+        for (size_t s = b; s < e; ++s) findPairs(dets, static_cast<int>(s));
+    });
+
+    core_.resize(n);
+    for (int i = 0; i < n; ++i) core_[i] = count_[i] >= minPoints_;
+
+    pool_.parallelFor(k, 1, [&](size_t b, size_t e) {
+        for (size_t s = b; s < e; ++s) {
+            Sector& sec = sectors_[s];
+            sec.seams.clear();
+            for (const auto& p : sec.pairs) {
+                if (!core_[p.first] || !core_[p.second]) continue;
+                const int sa = sectorOf_[p.first], sb = sectorOf_[p.second];
+                if (sa == sb) unite(p.first, p.second);
+                else if (std::max(sa, sb) > static_cast<int>(s)) sec.seams.push_back(p);
+            }
+        }
+    });
+
+    // Seam pass, then number the core components by their lowest index.
+    for (int s = 0; s < k; ++s)
+        for (const auto& p : sectors_[s].seams) unite(p.first, p.second);
+
+    labels_.assign(n, -1);
+    int numClusters = 0;
+    for (int i = 0; i < n; ++i) {
+        if (!core_[i]) continue;
+        int root = find(i);
+        if (labels_[root] < 0) labels_[root] = numClusters++;
+        labels_[i] = labels_[root];
+    }
+
+    // A border point joins the lowest-numbered cluster among its core
+    // neighbours: the first to reach it in DBSCAN's expansion.
+    pool_.parallelFor(k, 1, [&](size_t b, size_t e) {
+        for (size_t s = b; s < e; ++s)
+            for (const auto& p : sectors_[s].pairs) {
+                if (core_[p.first] == core_[p.second]) continue;
+                const int border = core_[p.first] ? p.second : p.first;
+                const int label  = labels_[core_[p.first] ? p.first : p.second];
+                if (sectorOf_[border] == static_cast<int>(s) &&
+                    (labels_[border] < 0 || label < labels_[border]))
+                    labels_[border] = label;
+            }
+    });
+    for (int i = 0; i < n; ++i)
+        if (labels_[i] < 0) labels_[i] = numClusters++;
+
+    start_.assign(numClusters + 1, 0);
+    for (int i = 0; i < n; ++i) ++start_[labels_[i] + 1];
+    for (int c = 0; c < numClusters; ++c) start_[c + 1] += start_[c];
+    members_.resize(n);
+    for (int i = 0; i < n; ++i) members_[start_[labels_[i]]++] = i;
+    for (int c = numClusters; c > 0; --c) start_[c] = start_[c - 1];
+    start_[0] = 0;
+
+    for (int c = 0; c < numClusters; ++c)
+        buildCluster(dets, members_.data() + start_[c], start_[c + 1] - start_[c],
+                     static_cast<uint32_t>(c), clusterSlot(out, c));
+    trimClusters(out, numClusters);
+
+    LOG_TRACE("SectorClusterer", "Formed %zu clusters from %d detections in %d sectors",
+              out.size(), n, k);
+}
+
+// ---------------------------------------------------------------------------
+// Greedy gating (RangeBased, RangeStrength)
+// ---------------------------------------------------------------------------
+
+void SectorClusterer::clusterSlices(const std::vector<Detection>& dets, std::vector<Cluster>& out) {
+    const int n = static_cast<int>(dets.size());
+
+    // Positions p where a gap wider than the gate precedes azOrder_[p].
+    cuts_.clear();
+    for (int p = 1; p < n; ++p)
+        if (dets[azOrder_[p]].azimuth - dets[azOrder_[p - 1]].azimuth > azimuthGate_)
+            cuts_.push_back(p);
+
+    // Cut at the gap nearest each equal-count boundary.
+    int numSlices = 0;
+    size_t begin = 0;
+    for (int s = 1; s < numSectors_ && !cuts_.empty(); ++s) {
+        const int target = static_cast<int>(static_cast<size_t>(n) * s / numSectors_);
+        auto it = std::lower_bound(cuts_.begin(), cuts_.end(), target);
+        if (it == cuts_.end() || (it != cuts_.begin() && target - *(it - 1) < *it - target)) --it;
+        if (static_cast<size_t>(*it) <= begin) continue;
+        sectors_[numSlices].begin = begin;
+        sectors_[numSlices].end   = *it;
+        begin = *it;
+        ++numSlices;
+    }
+    sectors_[numSlices].begin = begin;
+    sectors_[numSlices].end   = n;
+    ++numSlices;
+
+    pool_.parallelFor(numSlices, 1, [&](size_t b, size_t e) {
+        for (size_t s = b; s < e; ++s) {
+            Sector& sec = sectors_[s];
+            // Index order within the slice keeps the serial tie-breaks.
+            sec.index.assign(azOrder_.begin() + sec.begin, azOrder_.begin() + sec.end);
+            std::sort(sec.index.begin(), sec.index.end());
+            sec.dets.resize(sec.index.size());
+            for (size_t i = 0; i < sec.index.size(); ++i) sec.dets[i] = dets[sec.index[i]];
+
+            serial_[s]->cluster(sec.dets, sec.clusters);
+            for (auto& c : sec.clusters)
+                for (auto& idx : c.detectionIndices) idx = sec.index[idx];
+        }
+    });
+
+    // Seam pass: the serial clusterer numbers clusters in its seeds' range
+    // order, and each cluster lists its seed first.
+    order_.clear();
+    for (int s = 0; s < numSlices; ++s)
+        for (size_t c = 0; c < sectors_[s].clusters.size(); ++c)
+            order_.emplace_back(s, static_cast<int>(c));
+    auto seed = [&](const std::pair<int, int>& sc) {
+        return sectors_[sc.first].clusters[sc.second].detectionIndices[0];
+    };
+    std::sort(order_.begin(), order_.end(), [&](const auto& a, const auto& b) {
+        const uint32_t sa = seed(a), sb = seed(b);
+        return dets[sa].range < dets[sb].range || (dets[sa].range == dets[sb].range && sa < sb);
+    });
+
+    for (size_t c = 0; c < order_.size(); ++c) {
+        Cluster& dst = clusterSlot(out, c);
+        std::swap(dst, sectors_[order_[c].first].clusters[order_[c].second]);
+        dst.clusterId = static_cast<uint32_t>(c);
+    }
+    trimClusters(out, order_.size());
+
+    LOG_TRACE("SectorClusterer", "Formed %zu clusters from %d detections in %d slices",
+              out.size(), n, numSlices);
+}
+
+} // namespace cuas
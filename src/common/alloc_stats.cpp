@@ -0,0 +1,101 @@
+// Built only with CUAS_ALLOC_STATS (see alloc_stats.h).  Replaces the
+// throwing operator new, scalar and array, plain and over-aligned; the
+// nothrow forms and every operator delete are the library's, which forward
+// to these and free what they return.
+
+#include "common/alloc_stats.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace cuas {
+
+namespace {
+
+struct StageCounters {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> bytes{0};
+};
+
+StageCounters g_counters[ALLOC_MAX_STAGES];
+
+thread_local uint32_t t_stage = ALLOC_NO_STAGE;
+
+inline void account(std::size_t size) {
+    const uint32_t stage = t_stage;
+    if (stage >= ALLOC_MAX_STAGES) return;
+    g_counters[stage].count.fetch_add(1, std::memory_order_relaxed);
+    g_counters[stage].bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+void* allocate(std::size_t size) {
+    if (size == 0) size = 1;
+    for (;;) {
+        if (void* p = std::malloc(size)) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+// Matches the library's aligned operator delete: _aligned_free on Windows,
+// free elsewhere.
+void* allocateAligned(std::size_t size, std::size_t alignment) {
+    if (size == 0) size = 1;
+    if (alignment < sizeof(void*)) alignment = sizeof(void*);
+    for (;;) {
+#ifdef _WIN32
+        void* p = _aligned_malloc(size, alignment);
+#else
+        void* p = nullptr;
+        if (posix_memalign(&p, alignment, size) != 0) p = nullptr;
+#endif
+        if (p) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+} // namespace
+
+uint32_t exchangeAllocStage(uint32_t stage) {
+    const uint32_t prev = t_stage;
+    t_stage = stage;
+    return prev;
+}
+
+AllocCounts allocCounts(uint32_t stage) {
+    AllocCounts c;
+    if (stage >= ALLOC_MAX_STAGES) return c;
+    c.count = g_counters[stage].count.load(std::memory_order_relaxed);
+    c.bytes = g_counters[stage].bytes.load(std::memory_order_relaxed);
+    return c;
+}
+
+} // namespace cuas
+
+void* operator new(std::size_t size) {
+    cuas::account(size);
+    return cuas::allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    cuas::account(size);
+    return cuas::allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    cuas::account(size);
+    return cuas::allocateAligned(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    cuas::account(size);
+    return cuas::allocateAligned(size, static_cast<std::size_t>(alignment));
+}
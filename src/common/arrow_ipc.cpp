@@ -0,0 +1,384 @@
+#include "common/arrow_ipc.h"
+#include <algorithm>
+#include <cstring>
+
+namespace cuas {
+
+namespace {
+
+// Arrow format enums (Schema.fbs, Message.fbs).
+constexpr int16_t METADATA_V5          = 4;
+constexpr uint8_t TYPE_INT             = 2;
+constexpr uint8_t TYPE_FLOATING_POINT  = 3;
+constexpr uint8_t TYPE_UTF8            = 5;
+constexpr int16_t PRECISION_DOUBLE     = 2;
+constexpr uint8_t HEADER_SCHEMA        = 1;
+constexpr uint8_t HEADER_DICTIONARY    = 2;
+constexpr uint8_t HEADER_RECORD_BATCH  = 3;
+
+constexpr char MAGIC[8] = {'A', 'R', 'R', 'O', 'W', '1', 0, 0};
+
+size_t pad8(size_t n) { return (n + 7) & ~size_t{7}; }
+
+// Minimal FlatBuffers builder for the Arrow metadata.  Like the reference
+// builder it writes back to front, so a table's children are built before
+// the table; a Ref is an object's distance from the end of the buffer.
+class FlatBuilder {
+public:
+    using Ref = uint32_t;
+
+    Ref size() const { return static_cast<Ref>(buf_.size()); }
+
+    Ref string(const std::string& s) {
+        align(4, s.size() + 1);
+        pad(1);
+        buf_.insert(buf_.begin(), s.begin(), s.end());
+        push<uint32_t>(static_cast<uint32_t>(s.size()));
+        return size();
+    }
+
+    // Vector of tables or strings.
+    Ref refs(const std::vector<Ref>& items) {
+        align(4, items.size() * 4);
+        for (auto it = items.rbegin(); it != items.rend(); ++it) pushRef(*it);
+        push<uint32_t>(static_cast<uint32_t>(items.size()));
+        return size();
+    }
+
+    // Vector of structs, each `bytes` long and 8-byte aligned.
+    Ref structs(const void* data, size_t count, size_t bytes) {
+        align(8, count * bytes);
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        buf_.insert(buf_.begin(), p, p + count * bytes);
+        push<uint32_t>(static_cast<uint32_t>(count));
+        return size();
+    }
+
+    void startTable() {
+        fields_.clear();
+        tableStart_ = size();
+    }
+    template <typename T> void field(int slot, T v) {
+        align(sizeof(T));
+        push(v);
+        fields_.push_back({slot, size()});
+    }
+    void fieldRef(int slot, Ref r) {
+        align(4);
+        pushRef(r);
+        fields_.push_back({slot, size()});
+    }
+    Ref endTable() {
+        align(4);
+        push<int32_t>(0);                           // vtable offset, patched below
+        const Ref table = size();
+
+        int slots = 0;
+        for (const auto& f : fields_) slots = std::max(slots, f.slot + 1);
+        std::vector<uint16_t> offsets(static_cast<size_t>(slots), 0);
+        for (const auto& f : fields_) offsets[static_cast<size_t>(f.slot)] = static_cast<uint16_t>(table - f.ref);
+        for (auto it = offsets.rbegin(); it != offsets.rend(); ++it) push<uint16_t>(*it);
+        push<uint16_t>(static_cast<uint16_t>(table - tableStart_));
+        push<uint16_t>(static_cast<uint16_t>((offsets.size() + 2) * 2));
+
+        const int32_t toVtable = static_cast<int32_t>(size() - table);
+        std::memcpy(&buf_[buf_.size() - table], &toVtable, sizeof(toVtable));
+        return table;
+    }
+
+    std::vector<uint8_t> finish(Ref root) {
+        align(minAlign_, 4);
+        pushRef(root);
+        return buf_;
+    }
+
+private:
+    struct Field {
+        int slot;
+        Ref ref;
+    };
+
+    void pad(size_t n) { buf_.insert(buf_.begin(), n, 0); }
+    // Pads so that the next `extra` bytes end `size`-aligned.
+    void align(size_t size, size_t extra = 0) {
+        minAlign_ = std::max(minAlign_, size);
+        pad((size - (buf_.size() + extra) % size) % size);
+    }
+    template <typename T> void push(T v) {
+        uint8_t bytes[sizeof(T)];
+        std::memcpy(bytes, &v, sizeof(T));
+        buf_.insert(buf_.begin(), bytes, bytes + sizeof(T));
+    }
+    void pushRef(Ref r) { push<uint32_t>(size() + 4 - r); }
+
+    std::vector<uint8_t> buf_;
+    std::vector<Field>   fields_;
+    Ref                  tableStart_ = 0;
+    size_t               minAlign_   = 8;
+};
+
+using Ref = FlatBuilder::Ref;
+
+// FieldNode and Buffer structs of a RecordBatch.
+struct Pair {
+    int64_t a;
+    int64_t b;
+};
+
+Ref intType(FlatBuilder& fb, int32_t bits, bool isSigned) {
+    fb.startTable();
+    fb.field<int32_t>(0, bits);
+    fb.field<uint8_t>(1, isSigned ? 1 : 0);
+    return fb.endTable();
+}
+
+Ref schemaTable(FlatBuilder& fb, const std::vector<ArrowColumn>& columns) {
+    std::vector<Ref> fields;
+    for (size_t i = 0; i < columns.size(); ++i) {
+        const ArrowColumn& c = columns[i];
+        const Ref name = fb.string(c.name);
+        Ref     type     = 0;
+        uint8_t typeType = 0;
+        Ref     dict     = 0;
+        switch (c.type) {
+            case ArrowType::UInt32:
+                type     = intType(fb, 32, false);
+                typeType = TYPE_INT;
+                break;
+            case ArrowType::UInt64:
+                type     = intType(fb, 64, false);
+                typeType = TYPE_INT;
+                break;
+            case ArrowType::Float64:
+                fb.startTable();
+                fb.field<int16_t>(0, PRECISION_DOUBLE);
+                type     = fb.endTable();
+                typeType = TYPE_FLOATING_POINT;
+                break;
+            case ArrowType::Dictionary: {
+                fb.startTable();
+                type     = fb.endTable();
+                typeType = TYPE_UTF8;
+                const Ref index = intType(fb, 8, true);
+                fb.startTable();
+                fb.field<int64_t>(0, static_cast<int64_t>(i));   // dictionary id = column
+                fb.fieldRef(1, index);
+                dict = fb.endTable();
+                break;
+            }
+        }
+        const Ref children = fb.refs({});
+        fb.startTable();
+        fb.fieldRef(0, name);
+        fb.field<uint8_t>(1, c.type == ArrowType::Dictionary ? 1 : 0);   // nullable
+        fb.field<uint8_t>(2, typeType);
+        fb.fieldRef(3, type);
+        if (dict) fb.fieldRef(4, dict);
+        fb.fieldRef(5, children);
+        fields.push_back(fb.endTable());
+    }
+    const Ref fieldVec = fb.refs(fields);
+    fb.startTable();
+    fb.field<int16_t>(0, 0);                        // little-endian
+    fb.fieldRef(1, fieldVec);
+    return fb.endTable();
+}
+
+Ref recordBatchTable(FlatBuilder& fb, int64_t rows, const std::vector<Pair>& nodes,
+                     const std::vector<Pair>& buffers) {
+    const Ref nodeVec   = fb.structs(nodes.data(), nodes.size(), sizeof(Pair));
+    const Ref bufferVec = fb.structs(buffers.data(), buffers.size(), sizeof(Pair));
+    fb.startTable();
+    fb.field<int64_t>(0, rows);
+    fb.fieldRef(1, nodeVec);
+    fb.fieldRef(2, bufferVec);
+    return fb.endTable();
+}
+
+std::vector<uint8_t> message(FlatBuilder& fb, uint8_t headerType, Ref header, int64_t bodyLength) {
+    fb.startTable();
+    fb.field<int16_t>(0, METADATA_V5);
+    fb.field<uint8_t>(1, headerType);
+    fb.fieldRef(2, header);
+    fb.field<int64_t>(3, bodyLength);
+    return fb.finish(fb.endTable());
+}
+
+// Appends `n` bytes to a message body as one 8-byte aligned buffer.
+void addBuffer(std::vector<uint8_t>& body, std::vector<Pair>& buffers, const void* data, size_t n) {
+    buffers.push_back({static_cast<int64_t>(body.size()), static_cast<int64_t>(n)});
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    body.insert(body.end(), p, p + n);
+    body.resize(pad8(body.size()), 0);
+}
+
+} // namespace
+
+ArrowFileWriter::~ArrowFileWriter() {
+    close();
+}
+
+bool ArrowFileWriter::open(const std::string& path, std::vector<ArrowColumn> columns,
+                           size_t batchRows) {
+    close();
+    for (const auto& c : columns)
+        if (c.type == ArrowType::Dictionary && c.dictionary.size() > 127) return false;
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    if (!out_.is_open()) return false;
+
+    columns_.clear();
+    for (auto& c : columns) columns_.push_back({std::move(c), {}, {}, 0});
+    batchRows_ = std::max<size_t>(batchRows, 1);
+    batchFill_ = 0;
+    rows_      = 0;
+    dictionaryBlocks_.clear();
+    batchBlocks_.clear();
+
+    out_.write(MAGIC, sizeof(MAGIC));
+    pos_ = sizeof(MAGIC);
+
+    std::vector<ArrowColumn> defs;
+    for (const auto& c : columns_) defs.push_back(c.def);
+    {
+        FlatBuilder fb;
+        const Ref schema = schemaTable(fb, defs);
+        writeMessage(message(fb, HEADER_SCHEMA, schema, 0), {}, nullptr);
+    }
+
+    // Each dictionary: a one-column utf8 batch (no validity, offsets, bytes).
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        const ArrowColumn& c = columns_[i].def;
+        if (c.type != ArrowType::Dictionary) continue;
+        std::vector<int32_t> offsets{0};
+        std::string          chars;
+        for (const auto& s : c.dictionary) {
+            chars += s;
+            offsets.push_back(static_cast<int32_t>(chars.size()));
+        }
+        std::vector<uint8_t> body;
+        std::vector<Pair>    buffers;
+        addBuffer(body, buffers, nullptr, 0);
+        addBuffer(body, buffers, offsets.data(), offsets.size() * sizeof(int32_t));
+        addBuffer(body, buffers, chars.data(), chars.size());
+        const int64_t n = static_cast<int64_t>(c.dictionary.size());
+
+        FlatBuilder fb;
+        const Ref data = recordBatchTable(fb, n, {{n, 0}}, buffers);
+        fb.startTable();
+        fb.field<int64_t>(0, static_cast<int64_t>(i));
+        fb.fieldRef(1, data);
+        const Ref dict = fb.endTable();
+        writeMessage(message(fb, HEADER_DICTIONARY, dict, static_cast<int64_t>(body.size())),
+                     body, &dictionaryBlocks_);
+    }
+    return out_.good();
+}
+
+void ArrowFileWriter::append(std::initializer_list<ArrowValue> values) {
+    if (!out_.is_open()) return;
+    auto v = values.begin();
+    for (auto& c : columns_) {
+        const ArrowValue cell = v != values.end() ? *v++ : ArrowValue(0u);
+        const uint64_t   u    = cell.isDouble ? static_cast<uint64_t>(cell.d) : cell.u;
+        switch (c.def.type) {
+            case ArrowType::UInt32: {
+                const uint32_t x = static_cast<uint32_t>(u);
+                c.values.insert(c.values.end(), reinterpret_cast<const uint8_t*>(&x),
+                                reinterpret_cast<const uint8_t*>(&x) + sizeof(x));
+                break;
+            }
+            case ArrowType::UInt64:
+                c.values.insert(c.values.end(), reinterpret_cast<const uint8_t*>(&u),
+                                reinterpret_cast<const uint8_t*>(&u) + sizeof(u));
+                break;
+            case ArrowType::Float64: {
+                const double x = cell.isDouble ? cell.d : static_cast<double>(cell.u);
+                c.values.insert(c.values.end(), reinterpret_cast<const uint8_t*>(&x),
+                                reinterpret_cast<const uint8_t*>(&x) + sizeof(x));
+                break;
+            }
+            case ArrowType::Dictionary: {
+                const bool valid = u < c.def.dictionary.size();
+                c.values.push_back(valid ? static_cast<uint8_t>(u) : 0);
+                if (batchFill_ % 8 == 0) c.validity.push_back(0);
+                if (valid) c.validity.back() |= static_cast<uint8_t>(1u << (batchFill_ % 8));
+                else       ++c.nulls;
+                break;
+            }
+        }
+    }
+    ++rows_;
+    if (++batchFill_ == batchRows_) writeBatch();
+}
+
+void ArrowFileWriter::writeBatch() {
+    if (batchFill_ == 0) return;
+    const int64_t n = static_cast<int64_t>(batchFill_);
+
+    std::vector<uint8_t> body;
+    std::vector<Pair>    nodes, buffers;
+    for (auto& c : columns_) {
+        nodes.push_back({n, c.nulls});
+        if (c.nulls > 0) addBuffer(body, buffers, c.validity.data(), c.validity.size());
+        else             addBuffer(body, buffers, nullptr, 0);
+        addBuffer(body, buffers, c.values.data(), c.values.size());
+        c.values.clear();
+        c.validity.clear();
+        c.nulls = 0;
+    }
+
+    FlatBuilder fb;
+    const Ref batch = recordBatchTable(fb, n, nodes, buffers);
+    writeMessage(message(fb, HEADER_RECORD_BATCH, batch, static_cast<int64_t>(body.size())),
+                 body, &batchBlocks_);
+    batchFill_ = 0;
+}
+
+void ArrowFileWriter::writeMessage(const std::vector<uint8_t>& meta,
+                                   const std::vector<uint8_t>& body, std::vector<Block>* blocks) {
+    // Encapsulated message: continuation marker, padded metadata length,
+    // metadata, padding to 8 bytes, body.
+    const uint32_t marker  = 0xFFFFFFFFu;
+    const int32_t  metaLen = static_cast<int32_t>(pad8(meta.size() + 8) - 8);
+    static const char zeros[8] = {};
+    if (blocks) blocks->push_back({pos_, metaLen + 8, 0, static_cast<int64_t>(body.size())});
+    out_.write(reinterpret_cast<const char*>(&marker), sizeof(marker));
+    out_.write(reinterpret_cast<const char*>(&metaLen), sizeof(metaLen));
+    out_.write(reinterpret_cast<const char*>(meta.data()), static_cast<std::streamsize>(meta.size()));
+    out_.write(zeros, static_cast<std::streamsize>(static_cast<size_t>(metaLen) - meta.size()));
+    out_.write(reinterpret_cast<const char*>(body.data()), static_cast<std::streamsize>(body.size()));
+    pos_ += 8 + metaLen + static_cast<int64_t>(body.size());
+}
+
+bool ArrowFileWriter::close() {
+    if (!out_.is_open()) return true;
+    writeBatch();
+
+    // End-of-stream marker, then the footer indexing every message.
+    const uint32_t eos[2] = {0xFFFFFFFFu, 0};
+    out_.write(reinterpret_cast<const char*>(eos), sizeof(eos));
+
+    std::vector<ArrowColumn> defs;
+    for (const auto& c : columns_) defs.push_back(c.def);
+    FlatBuilder fb;
+    const Ref schema  = schemaTable(fb, defs);
+    const Ref dicts   = fb.structs(dictionaryBlocks_.data(), dictionaryBlocks_.size(), sizeof(Block));
+    const Ref batches = fb.structs(batchBlocks_.data(), batchBlocks_.size(), sizeof(Block));
+    fb.startTable();
+    fb.field<int16_t>(0, METADATA_V5);
+    fb.fieldRef(1, schema);
+    fb.fieldRef(2, dicts);
+    fb.fieldRef(3, batches);
+    const std::vector<uint8_t> footer = fb.finish(fb.endTable());
+    const int32_t footerLen = static_cast<int32_t>(footer.size());
+    out_.write(reinterpret_cast<const char*>(footer.data()), static_cast<std::streamsize>(footer.size()));
+    out_.write(reinterpret_cast<const char*>(&footerLen), sizeof(footerLen));
+    out_.write(MAGIC, 6);
+
+    const bool ok = out_.good();
+    out_.close();
+    columns_.clear();
+    return ok;
+}
+
+} // namespace cuas
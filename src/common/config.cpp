@@ -8,6 +8,7 @@
 #include <vector>
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 
 namespace cuas {
 
@@ -176,6 +177,51 @@ private:
 
 } // anonymous namespace
 
+std::map<std::string, DdsQosProfile> defaultDdsQosProfiles() {
+    DdsQosProfile latest;              // debug tables: only the newest matters
+    latest.reliable     = false;
+    latest.historyDepth = 1;
+
+    DdsQosProfile detections;          // tracker input: no dwell may be lost
+    detections.historyDepth = 8;
+
+    DdsQosProfile tables;              // TrackTable / PipelineStats / TrackerHealth
+    tables.historyDepth = 4;
+
+    DdsQosProfile updates;             // keyed per track: one sample per track id
+    updates.historyDepth          = 1;
+    updates.maxInstances          = 4096;
+    updates.maxSamplesPerInstance = 1;
+    updates.maxSamples            = 4096;
+
+    DdsQosProfile frames = detections; // plain frames: loans over data sharing
+    frames.preallocate = true;
+    frames.dataSharing = true;
+
+    DdsQosProfile handovers;           // a lost handover is a lost track
+    handovers.historyDepth = 0;        // KEEP_ALL
+
+    DdsQosProfile trackFrames = tables;
+    trackFrames.preallocate = true;
+    trackFrames.dataSharing = true;
+
+    return {
+        { TOPIC_SP_DETECTION,         detections },
+        { TOPIC_SP_DETECTION_FRAME,   frames },
+        { TOPIC_TRACK_TABLE_FRAME,    trackFrames },
+        { TOPIC_SP_DETECTION_DISPLAY, latest },
+        { TOPIC_CLUSTER_TABLE,        latest },
+        { TOPIC_ASSOC_TABLE,          latest },
+        { TOPIC_PREDICTED_TABLE,      latest },
+        { TOPIC_TRACK_TABLE,          tables },
+        { TOPIC_TRACK_UPDATE,         updates },
+        { TOPIC_PIPELINE_STATS,       tables },
+        { TOPIC_TRACKER_HEALTH,       tables },
+        { TOPIC_TRACK_HANDOVER,       handovers },
+        { TOPIC_AGGREGATED_TRACK_TABLE, tables },
+    };
+}
+
 TrackerConfig loadConfig(const std::string& filepath) {
     std::ifstream file(filepath);
     if (!file.is_open()) {
@@ -200,6 +246,88 @@ TrackerConfig loadConfig(const std::string& filepath) {
         cfg.system.logDirectory         = s["logDirectory"].asString();
         cfg.system.logEnabled           = s["logEnabled"].asBool();
         cfg.system.logLevel             = s["logLevel"].asInt();
+        if (s.has("consoleAsync"))
+            cfg.system.consoleAsync     = s["consoleAsync"].asBool();
+        if (s.has("logRingKB"))
+            cfg.system.logRingKB        = s["logRingKB"].asInt();
+        if (s.has("logBlockKB"))
+            cfg.system.logBlockKB       = s["logBlockKB"].asInt();
+        if (s.has("logIndexRecords"))
+            cfg.system.logIndexRecords  = s["logIndexRecords"].asInt();
+        if (s.has("combinedText"))
+            cfg.system.combinedText     = s["combinedText"].asString() == "offline"
+                                              ? CombinedTextMode::Offline
+                                              : CombinedTextMode::Live;
+        if (s.has("logSegmentMB"))
+            cfg.system.logSegmentMB     = s["logSegmentMB"].asInt();
+        if (s.has("logSegmentSeconds"))
+            cfg.system.logSegmentSeconds = s["logSegmentSeconds"].asInt();
+        if (s.has("logPreallocateMB"))
+            cfg.system.logPreallocateMB = s["logPreallocateMB"].asInt();
+        if (s.has("logSync")) {
+            const std::string m = s["logSync"].asString();
+            cfg.system.logSync = m == "periodic" ? LogSyncMode::Periodic
+                               : m == "direct"   ? LogSyncMode::Direct
+                                                 : LogSyncMode::None;
+        }
+        if (s.has("logSyncMs"))
+            cfg.system.logSyncMs        = s["logSyncMs"].asInt();
+        if (s.has("workerThreads"))
+            cfg.system.workerThreads    = s["workerThreads"].asInt();
+        if (s.has("realtime")) {
+            auto& r  = s["realtime"];
+            auto& rt = cfg.system.realtime;
+            if (r.has("pipelineCpus"))
+                for (const auto& c : r["pipelineCpus"].asArray()) rt.pipelineCpus.push_back(c.asInt());
+            if (r.has("ddsCpus"))
+                for (const auto& c : r["ddsCpus"].asArray()) rt.ddsCpus.push_back(c.asInt());
+            if (r.has("schedFifo"))      rt.schedFifo      = r["schedFifo"].asBool();
+            if (r.has("schedPriority"))  rt.schedPriority  = r["schedPriority"].asInt();
+            if (r.has("lockMemory"))     rt.lockMemory     = r["lockMemory"].asBool();
+            if (r.has("prefaultHeapMB")) rt.prefaultHeapMB = r["prefaultHeapMB"].asInt();
+        }
+        if (s.has("checkpoint")) {
+            auto& c  = s["checkpoint"];
+            auto& ck = cfg.system.checkpoint;
+            if (c.has("enabled"))      ck.enabled      = c["enabled"].asBool();
+            if (c.has("directory"))    ck.directory    = c["directory"].asString();
+            if (c.has("periodDwells")) ck.periodDwells = c["periodDwells"].asInt();
+            if (c.has("maxAgeMs"))     ck.maxAgeMs     = c["maxAgeMs"].asInt();
+        }
+    }
+
+    // Pipeline
+    if (root.has("pipeline")) {
+        auto& p = root["pipeline"];
+        if (p.has("pipelined"))       cfg.pipeline.pipelined       = p["pipelined"].asBool();
+        if (p.has("stageQueueDepth")) cfg.pipeline.stageQueueDepth = p["stageQueueDepth"].asInt();
+        if (p.has("ingestQueueCapacity"))
+            cfg.pipeline.ingestQueueCapacity = p["ingestQueueCapacity"].asInt();
+        if (p.has("overloadPolicy")) {
+            std::string policy = p["overloadPolicy"].asString();
+            if (policy == "block") cfg.pipeline.overloadPolicy = OverloadPolicy::Block;
+            else if (policy == "drop_oldest") cfg.pipeline.overloadPolicy = OverloadPolicy::DropOldest;
+            else if (policy == "drop_newest") cfg.pipeline.overloadPolicy = OverloadPolicy::DropNewest;
+            else if (policy == "coalesce_latest") cfg.pipeline.overloadPolicy = OverloadPolicy::CoalesceLatest;
+        }
+        if (p.has("catchUpThreshold"))
+            cfg.pipeline.catchUpThreshold = p["catchUpThreshold"].asInt();
+        if (p.has("loadShed")) {
+            auto& l = p["loadShed"];
+            auto& ls = cfg.pipeline.loadShed;
+            if (l.has("enabled"))            ls.enabled            = l["enabled"].asBool();
+            if (l.has("maxLevel"))           ls.maxLevel           = l["maxLevel"].asInt();
+            if (l.has("overrunRatio"))       ls.overrunRatio       = l["overrunRatio"].asNumber();
+            if (l.has("recoverRatio"))       ls.recoverRatio       = l["recoverRatio"].asNumber();
+            if (l.has("queueDepthHigh"))     ls.queueDepthHigh     = l["queueDepthHigh"].asInt();
+            if (l.has("degradeAfterDwells")) ls.degradeAfterDwells = l["degradeAfterDwells"].asInt();
+            if (l.has("recoverAfterDwells")) ls.recoverAfterDwells = l["recoverAfterDwells"].asInt();
+            if (l.has("degradedMinSNR"))     ls.degradedMinSNR     = l["degradedMinSNR"].asNumber();
+        }
+        if (p.has("sensorIds")) {
+            for (const auto& id : p["sensorIds"].asArray())
+                cfg.pipeline.sensorIds.push_back(static_cast<uint32_t>(id.asInt()));
+        }
     }
 
     // Network
@@ -211,6 +339,41 @@ TrackerConfig loadConfig(const std::string& filepath) {
         cfg.network.senderPort       = n["senderPort"].asInt();
         cfg.network.receiveBufferSize = n["receiveBufferSize"].asInt();
         cfg.network.sendBufferSize   = n["sendBufferSize"].asInt();
+        if (n.has("ingest")) {
+            std::string ingest = n["ingest"].asString();
+            if (ingest == "dds")      cfg.network.ingest = IngestBackend::Dds;
+            else if (ingest == "udp") cfg.network.ingest = IngestBackend::Udp;
+        }
+        if (n.has("udp")) {
+            auto& u = n["udp"];
+            UdpIngestConfig& udp = cfg.network.udp;
+            if (u.has("batch"))    udp.batch    = u["batch"].asInt();
+            if (u.has("threads"))  udp.threads  = u["threads"].asInt();
+            if (u.has("sensorId")) udp.sensorId = static_cast<uint32_t>(u["sensorId"].asInt());
+        }
+        if (n.has("dds")) {
+            auto& d = n["dds"];
+            DdsConfig& dds = cfg.network.dds;
+            if (d.has("sharedMemory")) dds.sharedMemory = d["sharedMemory"].asBool();
+            if (d.has("shmSegmentKB")) dds.shmSegmentKB = d["shmSegmentKB"].asInt();
+            if (d.has("dataSharing"))  dds.dataSharing  = d["dataSharing"].asBool();
+            if (d.has("zeroCopy"))     dds.zeroCopy     = d["zeroCopy"].asBool();
+            if (d.has("qos")) {
+                // Each entry overrides fields of the built-in profile of that name.
+                for (const auto& kv : d["qos"].asObject()) {
+                    auto& q = kv.second;
+                    DdsQosProfile& p = dds.qos[kv.first];
+                    if (q.has("reliable"))     p.reliable     = q["reliable"].asBool();
+                    if (q.has("historyDepth")) p.historyDepth = q["historyDepth"].asInt();
+                    if (q.has("maxSamples"))   p.maxSamples   = q["maxSamples"].asInt();
+                    if (q.has("maxInstances")) p.maxInstances = q["maxInstances"].asInt();
+                    if (q.has("maxSamplesPerInstance"))
+                        p.maxSamplesPerInstance = q["maxSamplesPerInstance"].asInt();
+                    if (q.has("preallocate"))  p.preallocate  = q["preallocate"].asBool();
+                    if (q.has("dataSharing"))  p.dataSharing  = q["dataSharing"].asBool();
+                }
+            }
+        }
     }
 
     // Preprocessing
@@ -228,6 +391,17 @@ TrackerConfig loadConfig(const std::string& filepath) {
         cfg.preprocessing.maxRCS       = p["maxRCS"].asNumber();
         cfg.preprocessing.minStrength  = p["minStrength"].asNumber();
         cfg.preprocessing.maxStrength  = p["maxStrength"].asNumber();
+        if (p.has("clutterMap")) {
+            auto& m  = p["clutterMap"];
+            auto& cm = cfg.preprocessing.clutterMap;
+            if (m.has("enabled"))       cm.enabled       = m["enabled"].asBool();
+            if (m.has("rangeCell"))     cm.rangeCell     = m["rangeCell"].asNumber();
+            if (m.has("azimuthCell"))   cm.azimuthCell   = m["azimuthCell"].asNumber();
+            if (m.has("elevationCell")) cm.elevationCell = m["elevationCell"].asNumber();
+            if (m.has("maxElevation"))  cm.maxElevation  = m["maxElevation"].asNumber();
+            if (m.has("alpha"))         cm.alpha         = m["alpha"].asNumber();
+            if (m.has("threshold"))     cm.threshold     = m["threshold"].asNumber();
+        }
     }
 
     // Clustering
@@ -237,6 +411,9 @@ TrackerConfig loadConfig(const std::string& filepath) {
         if (method == "dbscan") cfg.clustering.method = ClusterMethod::DBSCAN;
         else if (method == "range_based") cfg.clustering.method = ClusterMethod::RangeBased;
         else if (method == "range_strength") cfg.clustering.method = ClusterMethod::RangeStrengthBased;
+        else if (method == "connected_components") cfg.clustering.method = ClusterMethod::ConnectedComponents;
+        if (c.has("sectors")) cfg.clustering.sectors = c["sectors"].asInt();
+        if (c.has("trackAided")) cfg.clustering.trackAided = c["trackAided"].asBool();
 
         if (c.has("dbscan")) {
             auto& d = c["dbscan"];
@@ -258,6 +435,12 @@ TrackerConfig loadConfig(const std::string& filepath) {
             cfg.clustering.rangeStrength.elevationGateSize = r["elevationGateSize"].asNumber();
             cfg.clustering.rangeStrength.strengthGateSize  = r["strengthGateSize"].asNumber();
         }
+        if (c.has("connectedComponents")) {
+            auto& r = c["connectedComponents"];
+            cfg.clustering.connectedComponents.rangeGateSize     = r["rangeGateSize"].asNumber();
+            cfg.clustering.connectedComponents.azimuthGateSize   = r["azimuthGateSize"].asNumber();
+            cfg.clustering.connectedComponents.elevationGateSize = r["elevationGateSize"].asNumber();
+        }
     }
 
     // Prediction
@@ -275,6 +458,22 @@ TrackerConfig loadConfig(const std::string& filepath) {
                 for (size_t j = 0; j < row.size() && j < IMM_NUM_MODELS; ++j)
                     cfg.prediction.imm.transitionMatrix[i][j] = row[j].asNumber();
             }
+            if (imm.has("precision")) {
+                std::string precision = imm["precision"].asString();
+                if (precision == "double")     cfg.prediction.imm.precision = IMMPrecision::Double;
+                else if (precision == "float") cfg.prediction.imm.precision = IMMPrecision::Float;
+            }
+            if (imm.has("covarianceUpdate")) {
+                std::string form = imm["covarianceUpdate"].asString();
+                if (form == "joseph")       cfg.prediction.imm.covarianceUpdate = CovarianceUpdate::Joseph;
+                else if (form == "bierman") cfg.prediction.imm.covarianceUpdate = CovarianceUpdate::Bierman;
+            }
+            if (imm.has("pruneFloor"))
+                cfg.prediction.imm.pruneFloor = imm["pruneFloor"].asNumber();
+            if (imm.has("reactivatePrior"))
+                cfg.prediction.imm.reactivatePrior = imm["reactivatePrior"].asNumber();
+            if (imm.has("reactivateGate"))
+                cfg.prediction.imm.reactivateGate = imm["reactivateGate"].asNumber();
         }
         if (p.has("cv")) {
             cfg.prediction.cv.processNoiseStd = p["cv"]["processNoiseStd"].asNumber();
@@ -304,8 +503,17 @@ TrackerConfig loadConfig(const std::string& filepath) {
         if (method == "mahalanobis") cfg.association.method = AssociationMethod::Mahalanobis;
         else if (method == "gnn") cfg.association.method = AssociationMethod::GNN;
         else if (method == "jpda") cfg.association.method = AssociationMethod::JPDA;
+        else if (method == "mht") cfg.association.method = AssociationMethod::MHT;
 
         cfg.association.gatingThreshold = a["gatingThreshold"].asNumber();
+        if (a.has("decompose")) cfg.association.decompose = a["decompose"].asBool();
+        if (a.has("measurementNoise")) {
+            auto& n = a["measurementNoise"];
+            if (n.has("rangeSigma")) cfg.association.measurementNoise.rangeSigma = n["rangeSigma"].asNumber();
+            if (n.has("angleSigma")) cfg.association.measurementNoise.angleSigma = n["angleSigma"].asNumber();
+            if (n.has("minCrossRangeSigma"))
+                cfg.association.measurementNoise.minCrossRangeSigma = n["minCrossRangeSigma"].asNumber();
+        }
 
         if (a.has("mahalanobis")) {
             cfg.association.mahalanobis.distanceThreshold =
@@ -313,12 +521,29 @@ TrackerConfig loadConfig(const std::string& filepath) {
         }
         if (a.has("gnn")) {
             cfg.association.gnn.costThreshold = a["gnn"]["costThreshold"].asNumber();
+            if (a["gnn"].has("solver")) {
+                std::string solver = a["gnn"]["solver"].asString();
+                if (solver == "jv")          cfg.association.gnn.solver = GNNSolver::JonkerVolgenant;
+                else if (solver == "greedy") cfg.association.gnn.solver = GNNSolver::Greedy;
+            }
         }
         if (a.has("jpda")) {
             auto& j = a["jpda"];
             cfg.association.jpda.gateSize             = j["gateSize"].asNumber();
             cfg.association.jpda.clutterDensity       = j["clutterDensity"].asNumber();
             cfg.association.jpda.detectionProbability  = j["detectionProbability"].asNumber();
+            if (j.has("maxHypotheses"))
+                cfg.association.jpda.maxHypotheses = j["maxHypotheses"].asNumber();
+        }
+        if (a.has("mht")) {
+            auto& m = a["mht"];
+            auto& mc = cfg.association.mht;
+            if (m.has("kBest"))         mc.kBest         = static_cast<int>(m["kBest"].asNumber());
+            if (m.has("nScan"))         mc.nScan         = static_cast<int>(m["nScan"].asNumber());
+            if (m.has("maxHypotheses")) mc.maxHypotheses = static_cast<int>(m["maxHypotheses"].asNumber());
+            if (m.has("nodeBudget"))    mc.nodeBudget    = static_cast<int>(m["nodeBudget"].asNumber());
+            if (m.has("offsetBudget"))  mc.offsetBudget  = static_cast<int>(m["offsetBudget"].asNumber());
+            if (m.has("missCost"))      mc.missCost      = m["missCost"].asNumber();
         }
     }
 
@@ -354,6 +579,13 @@ TrackerConfig loadConfig(const std::string& filepath) {
             cfg.trackManagement.initialCovariance.velocityStd     = ic["velocityStd"].asNumber();
             cfg.trackManagement.initialCovariance.accelerationStd = ic["accelerationStd"].asNumber();
         }
+        if (t.has("lazyPrediction")) {
+            auto& l = t["lazyPrediction"];
+            LazyPredictionConfig& lp = cfg.trackManagement.lazyPrediction;
+            if (l.has("enabled"))     lp.enabled     = l["enabled"].asBool();
+            if (l.has("afterMisses")) lp.afterMisses = l["afterMisses"].asInt();
+            if (l.has("maxAccel"))    lp.maxAccel    = l["maxAccel"].asNumber();
+        }
     }
 
     // Display
@@ -361,12 +593,93 @@ TrackerConfig loadConfig(const std::string& filepath) {
         auto& d = root["display"];
         cfg.display.updateRateMs      = d["updateRateMs"].asInt();
         cfg.display.sendDeletedTracks = d["sendDeletedTracks"].asBool();
+        if (d.has("asyncPublish")) cfg.display.asyncPublish = d["asyncPublish"].asBool();
+        if (d.has("deltaPublish"))     cfg.display.deltaPublish     = d["deltaPublish"].asBool();
+        if (d.has("deltaPositionM"))   cfg.display.deltaPositionM   = d["deltaPositionM"].asNumber();
+        if (d.has("deltaVelocityMps")) cfg.display.deltaVelocityMps = d["deltaVelocityMps"].asNumber();
+        if (d.has("rawDetectionEvery")) cfg.display.rawDetectionEvery = d["rawDetectionEvery"].asInt();
+    }
+
+    // Distributed
+    if (root.has("distributed")) {
+        auto& d = root["distributed"];
+        DistributedConfig& dc = cfg.distributed;
+        if (d.has("enabled"))    dc.enabled    = d["enabled"].asBool();
+        if (d.has("nodeId"))     dc.nodeId     = static_cast<uint32_t>(d["nodeId"].asInt());
+        if (d.has("overlapM"))   dc.overlapM   = d["overlapM"].asNumber();
+        if (d.has("handoverM"))  dc.handoverM  = d["handoverM"].asNumber();
+        if (d.has("dedupGateM")) dc.dedupGateM = d["dedupGateM"].asNumber();
+        if (d.has("contentFilter")) dc.contentFilter = d["contentFilter"].asBool();
+        if (d.has("sectors")) {
+            for (const auto& e : d["sectors"].asArray()) {
+                SectorConfig sc;
+                if (e.has("nodeId"))   sc.nodeId   = static_cast<uint32_t>(e["nodeId"].asInt());
+                if (e.has("azMinDeg")) sc.azMinDeg = e["azMinDeg"].asNumber();
+                if (e.has("azMaxDeg")) sc.azMaxDeg = e["azMaxDeg"].asNumber();
+                if (e.has("minRange")) sc.minRange = e["minRange"].asNumber();
+                if (e.has("maxRange")) sc.maxRange = e["maxRange"].asNumber();
+                dc.sectors.push_back(sc);
+            }
+        }
     }
 
     LOG_INFO("Config", "Configuration loaded from %s", filepath.c_str());
     return cfg;
 }
 
+std::string validateConfig(const TrackerConfig& cfg) {
+    const auto& pp = cfg.preprocessing;
+    if (pp.minRange >= pp.maxRange)         return "preprocessing: minRange >= maxRange";
+    if (pp.minAzimuth >= pp.maxAzimuth)     return "preprocessing: minAzimuth >= maxAzimuth";
+    if (pp.minElevation >= pp.maxElevation) return "preprocessing: minElevation >= maxElevation";
+
+    const auto& cl = cfg.clustering;
+    if (cl.sectors < 1) return "clustering.sectors < 1";
+    if (cl.dbscan.epsilonRange <= 0 || cl.dbscan.epsilonAzimuth <= 0 ||
+        cl.dbscan.epsilonElevation <= 0 || cl.dbscan.minPoints < 1)
+        return "clustering.dbscan: gates must be > 0 and minPoints >= 1";
+
+    const auto& imm = cfg.prediction.imm;
+    double muSum = 0.0;
+    for (int i = 0; i < IMM_NUM_MODELS; ++i) {
+        double rowSum = 0.0;
+        for (int j = 0; j < IMM_NUM_MODELS; ++j) {
+            if (imm.transitionMatrix[i][j] < 0.0) return "prediction.imm.transitionMatrix: negative entry";
+            rowSum += imm.transitionMatrix[i][j];
+        }
+        if (std::fabs(rowSum - 1.0) > 1e-6) return "prediction.imm.transitionMatrix: row does not sum to 1";
+        if (imm.initialModeProbabilities[i] < 0.0)
+            return "prediction.imm.initialModeProbabilities: negative entry";
+        muSum += imm.initialModeProbabilities[i];
+    }
+    if (std::fabs(muSum - 1.0) > 1e-6) return "prediction.imm.initialModeProbabilities do not sum to 1";
+
+    const auto& as = cfg.association;
+    if (as.gatingThreshold <= 0) return "association.gatingThreshold <= 0";
+    if (as.measurementNoise.rangeSigma <= 0 || as.measurementNoise.angleSigma <= 0)
+        return "association.measurementNoise: sigmas must be > 0";
+    if (as.mht.kBest < 1 || as.mht.nScan < 1 || as.mht.maxHypotheses < 1)
+        return "association.mht: kBest, nScan and maxHypotheses must be >= 1";
+
+    const auto& tm = cfg.trackManagement;
+    if (tm.initiation.m < 1 || tm.initiation.n < tm.initiation.m)
+        return "trackManagement.initiation: need 1 <= m <= n";
+    if (tm.maintenance.confirmHits < 1) return "trackManagement.maintenance.confirmHits < 1";
+    if (tm.initialCovariance.positionStd <= 0 || tm.initialCovariance.velocityStd <= 0 ||
+        tm.initialCovariance.accelerationStd <= 0)
+        return "trackManagement.initialCovariance: standard deviations must be > 0";
+    if (tm.lazyPrediction.afterMisses < 1 || tm.lazyPrediction.maxAccel < 0)
+        return "trackManagement.lazyPrediction: need afterMisses >= 1 and maxAccel >= 0";
+
+    // Each sensor and node numbers its tracks from its own ID block.
+    for (uint32_t id : cfg.pipeline.sensorIds)
+        if (id >= TRACK_ID_SENSORS_PER_NODE)
+            return "pipeline.sensorIds: IDs must be < " + std::to_string(TRACK_ID_SENSORS_PER_NODE);
+    if (cfg.distributed.enabled && cfg.distributed.nodeId > TRACK_ID_MAX_NODE)
+        return "distributed.nodeId must be <= " + std::to_string(TRACK_ID_MAX_NODE);
+    return {};
+}
+
 std::string getRunInfoString(const TrackerConfig& cfg) {
     std::ostringstream os;
     os << "=== Tracker run: algorithms and models ===\n";
@@ -391,8 +704,15 @@ std::string getRunInfoString(const TrackerConfig& cfg) {
                << " rad, elevationGate=" << cfg.clustering.rangeStrength.elevationGateSize
                << " rad, strengthGate=" << cfg.clustering.rangeStrength.strengthGateSize << ")";
             break;
+        case ClusterMethod::ConnectedComponents:
+            os << "ConnectedComponents (rangeGate=" << cfg.clustering.connectedComponents.rangeGateSize
+               << " m, azimuthGate=" << cfg.clustering.connectedComponents.azimuthGateSize
+               << " rad, elevationGate=" << cfg.clustering.connectedComponents.elevationGateSize << " rad)";
+            break;
         default: os << "unknown"; break;
     }
+    if (cfg.clustering.sectors > 1) os << ", " << cfg.clustering.sectors << " azimuth sectors";
+    if (cfg.clustering.trackAided) os << ", track-aided";
     os << "\n";
 
     // Association
@@ -404,21 +724,38 @@ std::string getRunInfoString(const TrackerConfig& cfg) {
             break;
         case AssociationMethod::GNN:
             os << "GNN (gatingThreshold=" << cfg.association.gatingThreshold
-               << ", costThreshold=" << cfg.association.gnn.costThreshold << ")";
+               << ", costThreshold=" << cfg.association.gnn.costThreshold
+               << ", solver=" << (cfg.association.gnn.solver == GNNSolver::Greedy ? "greedy" : "jv")
+               << ")";
             break;
         case AssociationMethod::JPDA:
             os << "JPDA (gatingThreshold=" << cfg.association.gatingThreshold
                << ", gateSize=" << cfg.association.jpda.gateSize
                << ", clutterDensity=" << cfg.association.jpda.clutterDensity
-               << ", detectionProbability=" << cfg.association.jpda.detectionProbability << ")";
+               << ", detectionProbability=" << cfg.association.jpda.detectionProbability
+               << ", maxHypotheses=" << cfg.association.jpda.maxHypotheses << ")";
+            break;
+        case AssociationMethod::MHT:
+            os << "MHT (gatingThreshold=" << cfg.association.gatingThreshold
+               << ", kBest=" << cfg.association.mht.kBest
+               << ", nScan=" << cfg.association.mht.nScan
+               << ", maxHypotheses=" << cfg.association.mht.maxHypotheses
+               << ", nodeBudget=" << cfg.association.mht.nodeBudget
+               << ", missCost=" << cfg.association.mht.missCost << ")";
             break;
         default: os << "unknown"; break;
     }
-    os << "\n";
+    os << ", decompose=" << (cfg.association.decompose ? "yes" : "no")
+       << ", noise sigma " << cfg.association.measurementNoise.rangeSigma << " m / "
+       << cfg.association.measurementNoise.angleSigma << " rad\n";
 
     // Prediction (IMM)
     os << "Prediction: IMM filter, numModels=" << cfg.prediction.imm.numModels
-       << " (CV, CA1, CA2, CTR1, CTR2); "
+       << " (CV, CA1, CA2, CTR1, CTR2), "
+       << (cfg.prediction.imm.precision == IMMPrecision::Float ? "float" : "double")
+       << " batch predict, "
+       << (cfg.prediction.imm.covarianceUpdate == CovarianceUpdate::Bierman ? "Bierman UD" : "Joseph")
+       << " update, pruneFloor=" << cfg.prediction.imm.pruneFloor << "; "
        << "CV processNoiseStd=" << cfg.prediction.cv.processNoiseStd << "; "
        << "CA1 processNoiseStd=" << cfg.prediction.ca1.processNoiseStd << " accelDecayRate=" << cfg.prediction.ca1.accelDecayRate << "; "
        << "CA2 processNoiseStd=" << cfg.prediction.ca2.processNoiseStd << "; "
@@ -438,11 +775,72 @@ std::string getRunInfoString(const TrackerConfig& cfg) {
     os << "Track deletion: maxCoastingDwells=" << cfg.trackManagement.deletion.maxCoastingDwells
        << ", minQuality=" << cfg.trackManagement.deletion.minQuality
        << ", maxRange=" << cfg.trackManagement.deletion.maxRange << " m\n";
+    if (cfg.trackManagement.lazyPrediction.enabled)
+        os << "Lazy prediction: afterMisses=" << cfg.trackManagement.lazyPrediction.afterMisses
+           << ", maxAccel=" << cfg.trackManagement.lazyPrediction.maxAccel << " m/s^2\n";
+
+    const char* policyName = "drop_oldest";
+    switch (cfg.pipeline.overloadPolicy) {
+        case OverloadPolicy::Block:          policyName = "block";           break;
+        case OverloadPolicy::DropOldest:     policyName = "drop_oldest";     break;
+        case OverloadPolicy::DropNewest:     policyName = "drop_newest";     break;
+        case OverloadPolicy::CoalesceLatest: policyName = "coalesce_latest"; break;
+    }
+    os << "Pipeline: " << (cfg.pipeline.pipelined ? "pipelined" : "sequential")
+       << " (stageQueueDepth=" << cfg.pipeline.stageQueueDepth
+       << ", ingestQueueCapacity=" << cfg.pipeline.ingestQueueCapacity
+       << ", overloadPolicy=" << policyName
+       << ", catchUpThreshold=" << cfg.pipeline.catchUpThreshold << ")\n";
+    if (!cfg.pipeline.sensorIds.empty()) {
+        os << "Sensors:";
+        for (uint32_t id : cfg.pipeline.sensorIds) os << " " << id;
+        os << " (one TrackManager lane each)\n";
+    }
+    if (cfg.pipeline.loadShed.enabled) {
+        const auto& ls = cfg.pipeline.loadShed;
+        os << "Load shedding: maxLevel=" << ls.maxLevel
+           << ", overrunRatio=" << ls.overrunRatio << ", recoverRatio=" << ls.recoverRatio
+           << ", queueDepthHigh=" << ls.queueDepthHigh
+           << ", degradeAfter=" << ls.degradeAfterDwells
+           << ", recoverAfter=" << ls.recoverAfterDwells
+           << ", degradedMinSNR=" << ls.degradedMinSNR << " dB\n";
+    }
+
+    if (cfg.distributed.enabled) {
+        const auto& dc = cfg.distributed;
+        os << "Distributed: node " << dc.nodeId << " of " << dc.sectors.size() << " sector(s)";
+        for (const auto& sc : dc.sectors)
+            if (sc.nodeId == dc.nodeId)
+                os << ", az [" << sc.azMinDeg << "," << sc.azMaxDeg << "] deg, range ["
+                   << sc.minRange << "," << sc.maxRange << "] m";
+        os << ", overlap=" << dc.overlapM << " m, handover=" << dc.handoverM
+           << " m, dedupGate=" << dc.dedupGateM << " m, contentFilter="
+           << (dc.contentFilter ? "on" : "off") << "\n";
+    }
+
+    if (cfg.network.ingest == IngestBackend::Udp)
+        os << "Ingest: UDP " << cfg.network.receiverIp << ":" << cfg.network.receiverPort
+           << ", batch=" << cfg.network.udp.batch << ", threads=" << cfg.network.udp.threads
+           << ", rcvbuf=" << cfg.network.receiveBufferSize << "\n";
+    else
+        os << "Ingest: DDS " << TOPIC_SP_DETECTION << "\n";
+    os << "DDS: " << (cfg.network.dds.sharedMemory ? "SHM+UDPv4" : "UDPv4")
+       << ", dataSharing=" << (cfg.network.dds.dataSharing ? "on" : "off")
+       << ", zeroCopy=" << (cfg.network.dds.zeroCopy ? "on" : "off")
+       << ", " << cfg.network.dds.qos.size() << " QoS profiles\n";
 
     // Preprocessing (brief)
     os << "Preprocessing: range [" << cfg.preprocessing.minRange << "," << cfg.preprocessing.maxRange
        << "] m, SNR [" << cfg.preprocessing.minSNR << "," << cfg.preprocessing.maxSNR
        << "], RCS [" << cfg.preprocessing.minRCS << "," << cfg.preprocessing.maxRCS << "] dB\n";
+    os << "Budgets: maxDetectionsPerDwell=" << cfg.system.maxDetectionsPerDwell
+       << " (highest SNR kept), maxTracks=" << cfg.system.maxTracks << "\n";
+    if (cfg.preprocessing.clutterMap.enabled) {
+        const ClutterMapConfig& cm = cfg.preprocessing.clutterMap;
+        os << "Clutter map: cells " << cm.rangeCell << " m x " << cm.azimuthCell << " rad x "
+           << cm.elevationCell << " rad below " << cm.maxElevation << " rad, alpha="
+           << cm.alpha << ", threshold=" << cm.threshold << "\n";
+    }
 
     os << "==========================================\n";
     return os.str();
@@ -1,15 +1,124 @@
 #include "common/dds_participant.h"
 #include "common/logger.h"
+#include <fastrtps/config.h>
+#include <fastdds/rtps/resources/ResourceManagement.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+#include <algorithm>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 
+// Built with fastddsgen -typeobject (CMake defines CUAS_DDS_TYPEOBJECT):
+// registering the TypeObjects lets ContentFilteredTopic parse filter
+// expressions against the IDL types.
+#ifdef CUAS_DDS_TYPEOBJECT
+    #include "messagesTypeObject.h"
+#endif
+
+#if FASTRTPS_VERSION_MAJOR > 2 || (FASTRTPS_VERSION_MAJOR == 2 && FASTRTPS_VERSION_MINOR >= 12)
+    #define CUAS_DDS_THREAD_SETTINGS 1
+    #include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#endif
+
 namespace cuas {
 
-CuasDdsParticipant::CuasDdsParticipant(uint8_t domainId) {
+namespace {
+
+// Shared by DataWriterQos and DataReaderQos, which have the same policies.
+template <typename Qos>
+void applyProfile(Qos& qos, const std::string& name, const DdsQosProfile& p, bool dataSharing) {
+    dataSharing = dataSharing || p.dataSharing;
+    using namespace eprosima::fastdds::dds;
+    qos.reliability().kind = p.reliable ? RELIABLE_RELIABILITY_QOS : BEST_EFFORT_RELIABILITY_QOS;
+    if (p.historyDepth > 0) {
+        qos.history().kind  = KEEP_LAST_HISTORY_QOS;
+        qos.history().depth = p.historyDepth;
+    } else {
+        qos.history().kind  = KEEP_ALL_HISTORY_QOS;
+    }
+
+    // KEEP_LAST needs max_samples >= max_samples_per_instance >= depth, or
+    // entity creation fails; raise the limits rather than lose the topic.
+    ResourceLimitsQosPolicy& rl = qos.resource_limits();
+    if (p.maxInstances > 0) rl.max_instances = p.maxInstances;
+    if (p.maxSamplesPerInstance > 0) rl.max_samples_per_instance = p.maxSamplesPerInstance;
+    if (p.maxSamples > 0) rl.max_samples = p.maxSamples;
+    if (p.historyDepth > 0 && rl.max_samples_per_instance > 0 &&
+        rl.max_samples_per_instance < p.historyDepth) {
+        LOG_WARN("DDS", "%s: maxSamplesPerInstance %d < historyDepth %d; raised",
+                 name.c_str(), rl.max_samples_per_instance, p.historyDepth);
+        rl.max_samples_per_instance = p.historyDepth;
+    }
+    if (rl.max_samples > 0 && rl.max_samples < rl.max_samples_per_instance) {
+        LOG_WARN("DDS", "%s: maxSamples %d < maxSamplesPerInstance %d; raised",
+                 name.c_str(), rl.max_samples, rl.max_samples_per_instance);
+        rl.max_samples = rl.max_samples_per_instance;
+    }
+
+    // Preallocated history: no allocation per sample once the entity exists.
+    if (p.preallocate) {
+        rl.allocated_samples = rl.max_samples > 0 ? rl.max_samples : std::max(p.historyDepth, 1);
+        qos.endpoint().history_memory_policy =
+            eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+    }
+
+    // Data sharing only engages for bounded types and same-host peers;
+    // automatic() falls back to the transports otherwise.
+    if (dataSharing) qos.data_sharing().automatic();
+    else             qos.data_sharing().off();
+}
+
+} // anonymous namespace
+
+CuasDdsParticipant::CuasDdsParticipant(uint8_t domainId, uint64_t threadAffinityMask,
+                                       const DdsConfig& dds)
+    : dds_(dds) {
     auto factory = eprosima::fastdds::dds::DomainParticipantFactory::get_instance();
 
-    participant_ = factory->create_participant(
-        domainId,
-        eprosima::fastdds::dds::PARTICIPANT_QOS_DEFAULT);
+#ifdef CUAS_DDS_TYPEOBJECT
+    static std::once_flag typesRegistered;
+    std::call_once(typesRegistered, [] { registermessagesTypes(); });
+#endif
+
+    eprosima::fastdds::dds::DomainParticipantQos qos =
+        eprosima::fastdds::dds::PARTICIPANT_QOS_DEFAULT;
+
+    // Explicit transports instead of the built-in pair, so SHM can be sized
+    // or left out and the receive threads can be pinned.
+    std::shared_ptr<eprosima::fastdds::rtps::SharedMemTransportDescriptor> shm;
+    auto udp = std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>();
+    if (dds_.sharedMemory) {
+        shm = std::make_shared<eprosima::fastdds::rtps::SharedMemTransportDescriptor>();
+        if (dds_.shmSegmentKB > 0)
+            shm->segment_size(static_cast<uint32_t>(dds_.shmSegmentKB) * 1024u);
+    }
+
+    if (threadAffinityMask != 0) {
+#ifdef CUAS_DDS_THREAD_SETTINGS
+        eprosima::fastdds::rtps::ThreadSettings ts;
+        ts.affinity = threadAffinityMask;
+        qos.timed_events_thread(ts);
+        qos.builtin_controllers_sender_thread(ts);
+        qos.discovery_server_thread(ts);
+        qos.typelookup_service_thread(ts);
+
+        // Receive threads belong to the transports.
+        if (shm) shm->default_reception_threads(ts);
+        udp->default_reception_threads(ts);
+        LOG_INFO("DDS", "DDS threads pinned to CPU mask 0x%llx",
+                 static_cast<unsigned long long>(threadAffinityMask));
+#else
+        LOG_WARN("DDS", "DDS thread pinning needs Fast DDS 2.12 or later (have %d.%d); ignored",
+                 FASTRTPS_VERSION_MAJOR, FASTRTPS_VERSION_MINOR);
+#endif
+    }
+
+    qos.transport().use_builtin_transports = false;
+    if (shm) qos.transport().user_transports.push_back(shm);
+    qos.transport().user_transports.push_back(udp);
+
+    participant_ = factory->create_participant(domainId, qos);
     if (!participant_)
         throw std::runtime_error("DDS: failed to create DomainParticipant");
 
@@ -23,7 +132,43 @@ CuasDdsParticipant::CuasDdsParticipant(uint8_t domainId) {
     if (!subscriber_)
         throw std::runtime_error("DDS: failed to create Subscriber");
 
-    LOG_INFO("DDS", "DomainParticipant created on domain %u", domainId);
+    LOG_INFO("DDS", "DomainParticipant created on domain %u (%s, data sharing %s)", domainId,
+             shm ? "SHM+UDPv4" : "UDPv4", dds_.dataSharing ? "on" : "off");
+}
+
+eprosima::fastdds::dds::DataWriterQos CuasDdsParticipant::writerQos(const std::string& profile) const {
+    eprosima::fastdds::dds::DataWriterQos qos = eprosima::fastdds::dds::DATAWRITER_QOS_DEFAULT;
+    applyProfile(qos, profile, dds_.profile(profile), dds_.dataSharing);
+    return qos;
+}
+
+eprosima::fastdds::dds::DataReaderQos CuasDdsParticipant::readerQos(const std::string& profile) const {
+    eprosima::fastdds::dds::DataReaderQos qos = eprosima::fastdds::dds::DATAREADER_QOS_DEFAULT;
+    applyProfile(qos, profile, dds_.profile(profile), dds_.dataSharing);
+    return qos;
+}
+
+eprosima::fastdds::dds::ContentFilteredTopic* CuasDdsParticipant::filteredTopic(
+        eprosima::fastdds::dds::Topic* topic, const std::string& expression,
+        const std::vector<std::string>& parameters) {
+#ifndef CUAS_DDS_TYPEOBJECT
+    (void)parameters;
+    LOG_WARN("DDS", "%s: content filter \"%s\" needs the fastddsgen -typeobject types, "
+             "which this build lacks; reading the whole topic",
+             topic->get_name().c_str(), expression.c_str());
+    return nullptr;
+#else
+    const std::string name = topic->get_name() + "_filtered" + std::to_string(numFiltered_++);
+    auto* cft = participant_->create_contentfilteredtopic(name, topic, expression, parameters);
+    if (cft) {
+        LOG_INFO("DDS", "%s: content filter \"%s\"", topic->get_name().c_str(),
+                 expression.c_str());
+    } else {
+        LOG_WARN("DDS", "%s: content filter \"%s\" rejected; reading the whole topic",
+                 topic->get_name().c_str(), expression.c_str());
+    }
+    return cft;
+#endif
 }
 
 CuasDdsParticipant::~CuasDdsParticipant() {
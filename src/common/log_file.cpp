@@ -0,0 +1,212 @@
+#include "common/log_file.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <malloc.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace cuas {
+
+namespace {
+
+constexpr size_t ALIGN    = 4096;                  // O_DIRECT block and buffer alignment
+constexpr size_t CAPACITY = size_t(1) << 20;       // flushed when this full
+
+uint8_t* allocBuffer() {
+#ifdef _WIN32
+    return static_cast<uint8_t*>(_aligned_malloc(CAPACITY, ALIGN));
+#else
+    void* p = nullptr;
+    return posix_memalign(&p, ALIGN, CAPACITY) == 0 ? static_cast<uint8_t*>(p) : nullptr;
+#endif
+}
+
+void freeBuffer(uint8_t* p) {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+} // namespace
+
+LogFile::~LogFile() {
+    close();
+}
+
+bool LogFile::open(const std::string& path, LogSyncMode sync, uint64_t preallocate) {
+    close();
+    buf_ = allocBuffer();
+    if (!buf_) return false;
+    sync_   = sync;
+    direct_ = false;
+
+#ifdef _WIN32
+    const DWORD flags = sync == LogSyncMode::Direct ? FILE_FLAG_WRITE_THROUGH : FILE_ATTRIBUTE_NORMAL;
+    HANDLE h = CreateFileA(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                           flags, nullptr);
+    if (h == INVALID_HANDLE_VALUE) {
+        freeBuffer(buf_);
+        buf_ = nullptr;
+        return false;
+    }
+    handle_ = h;
+#else
+    int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef __linux__
+    if (sync == LogSyncMode::Direct) {
+        fd_ = ::open(path.c_str(), flags | O_DIRECT, 0644);
+        direct_ = fd_ >= 0;     // tmpfs and some others refuse O_DIRECT
+    }
+#endif
+    if (fd_ < 0) fd_ = ::open(path.c_str(), flags, 0644);
+    if (fd_ < 0) {
+        freeBuffer(buf_);
+        buf_ = nullptr;
+        return false;
+    }
+#endif
+
+    open_        = true;
+    bufLen_      = 0;
+    bufStart_    = 0;
+    preallocate_ = preallocate;
+    reserved_    = 0;
+    reserve(preallocate_);
+    return true;
+}
+
+bool LogFile::write(const void* data, size_t n) {
+    if (!open_) return false;
+    bool ok = true;
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    while (n > 0) {
+        const size_t take = std::min(n, CAPACITY - bufLen_);
+        std::memcpy(buf_ + bufLen_, p, take);
+        bufLen_ += take;
+        p       += take;
+        n       -= take;
+        if (bufLen_ == CAPACITY) ok = flush() && ok;
+    }
+    return ok;
+}
+
+bool LogFile::flush() {
+    if (!open_ || bufLen_ == 0) return true;
+    if (size() + ALIGN > reserved_ && preallocate_ > 0) reserve(size() + preallocate_);
+
+    if (!direct_) {
+        const bool ok = writeAt(buf_, bufLen_, bufStart_);
+        if (!ok) lostBytes_ += bufLen_;
+        bufStart_ += bufLen_;
+        bufLen_    = 0;
+        return ok;
+    }
+
+    // Whole blocks, the last one zero-padded; keep the partial block so the
+    // next flush rewrites it with more data.
+    const size_t padded = (bufLen_ + ALIGN - 1) / ALIGN * ALIGN;
+    std::memset(buf_ + bufLen_, 0, padded - bufLen_);
+    const bool   ok   = writeAt(buf_, padded, bufStart_);
+    const size_t full = bufLen_ / ALIGN * ALIGN;
+    if (!ok) lostBytes_ += full;
+    std::memmove(buf_, buf_ + full, bufLen_ - full);
+    bufStart_ += full;
+    bufLen_   -= full;
+    return ok;
+}
+
+bool LogFile::sync() {
+    if (!open_) return false;
+    bool ok = flush();
+    if (sync_ == LogSyncMode::None) return ok;
+#if defined(_WIN32)
+    ok = FlushFileBuffers(static_cast<HANDLE>(handle_)) != 0 && ok;
+#elif defined(__linux__)
+    ok = fdatasync(fd_) == 0 && ok;
+#else
+    ok = fsync(fd_) == 0 && ok;
+#endif
+    return ok;
+}
+
+void LogFile::close() {
+    if (!open_) return;
+    flush();
+    if (sync_ != LogSyncMode::None) sync();
+    const uint64_t end = size();
+#ifdef _WIN32
+    // Drop the reservation and any padding past the data.
+    HANDLE h = static_cast<HANDLE>(handle_);
+    LARGE_INTEGER li;
+    li.QuadPart = static_cast<LONGLONG>(end);
+    if (SetFilePointerEx(h, li, nullptr, FILE_BEGIN)) SetEndOfFile(h);
+    CloseHandle(h);
+    handle_ = nullptr;
+#else
+    // Drops the direct-mode padding and releases the reservation past the data.
+    if (ftruncate(fd_, static_cast<off_t>(end)) != 0) { /* the data is intact either way */ }
+    ::close(fd_);
+    fd_ = -1;
+#endif
+    freeBuffer(buf_);
+    buf_    = nullptr;
+    bufLen_ = 0;
+    open_   = false;
+}
+
+bool LogFile::writeAt(const uint8_t* data, size_t n, uint64_t at) {
+#ifdef _WIN32
+    HANDLE h = static_cast<HANDLE>(handle_);
+    while (n > 0) {
+        OVERLAPPED ov{};
+        ov.Offset     = static_cast<DWORD>(at);
+        ov.OffsetHigh = static_cast<DWORD>(at >> 32);
+        DWORD done = 0;
+        const DWORD chunk = static_cast<DWORD>(std::min<size_t>(n, size_t(1) << 30));
+        if (!WriteFile(h, data, chunk, &done, &ov) || done == 0) return false;
+        data += done;
+        at   += done;
+        n    -= done;
+    }
+    return true;
+#else
+    while (n > 0) {
+        const ssize_t done = pwrite(fd_, data, n, static_cast<off_t>(at));
+        if (done < 0 && errno == EINTR) continue;
+        if (done <= 0) return false;
+        data += done;
+        at   += static_cast<uint64_t>(done);
+        n    -= static_cast<size_t>(done);
+    }
+    return true;
+#endif
+}
+
+void LogFile::reserve(uint64_t upTo) {
+    if (preallocate_ == 0 || upTo <= reserved_) return;
+#if defined(_WIN32)
+    FILE_ALLOCATION_INFO info;
+    info.AllocationSize.QuadPart = static_cast<LONGLONG>(upTo);
+    if (SetFileInformationByHandle(static_cast<HANDLE>(handle_), FileAllocationInfo, &info, sizeof(info)))
+        reserved_ = upTo;
+#elif defined(__linux__)
+    if (fallocate(fd_, FALLOC_FL_KEEP_SIZE, static_cast<off_t>(reserved_),
+                  static_cast<off_t>(upTo - reserved_)) == 0)
+        reserved_ = upTo;
+    else
+        preallocate_ = 0;   // unsupported or out of space: plain writes from here on
+#else
+    reserved_ = upTo;
+#endif
+}
+
+} // namespace cuas
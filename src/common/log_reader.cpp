@@ -0,0 +1,322 @@
+#include "common/log_reader.h"
+#include "common/logger.h"
+#include "common/lz4_block.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace cuas {
+
+LogReader::~LogReader() {
+    unmap();
+}
+
+bool LogReader::open(const std::string& path) {
+    if (!map(path)) return false;
+    open_ = true;
+    loadIndex();
+    const size_t dot = path.rfind(".bin");
+    loadSidecar((dot != std::string::npos ? path.substr(0, dot) : path) + ".idx");
+    return true;
+}
+
+bool LogReader::map(const std::string& path) {
+    unmap();
+#ifdef _WIN32
+    HANDLE f = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                           nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (f == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER sz;
+    if (!GetFileSizeEx(f, &sz)) {
+        CloseHandle(f);
+        return false;
+    }
+    size_ = static_cast<uint64_t>(sz.QuadPart);
+    if (size_ > 0) {
+        HANDLE m = CreateFileMappingA(f, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void*  v = m ? MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!v) {
+            if (m) CloseHandle(m);
+            CloseHandle(f);
+            return false;
+        }
+        mapping_ = m;
+        base_    = static_cast<const uint8_t*>(v);
+    }
+    CloseHandle(f);     // the mapping keeps the file open
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+    size_ = static_cast<uint64_t>(st.st_size);
+    if (size_ > 0) {
+        void* v = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (v == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        madvise(v, size_, MADV_SEQUENTIAL);
+        base_ = static_cast<const uint8_t*>(v);
+    }
+    ::close(fd);        // the mapping keeps the file open
+#endif
+    pos_ = 0;
+    end_ = size_;
+    return true;
+}
+
+void LogReader::unmap() {
+    if (base_) {
+#ifdef _WIN32
+        UnmapViewOfFile(base_);
+        CloseHandle(static_cast<HANDLE>(mapping_));
+        mapping_ = nullptr;
+#else
+        munmap(const_cast<uint8_t*>(base_), size_);
+#endif
+    }
+    base_ = nullptr;
+    size_ = 0;
+    open_ = false;
+}
+
+void LogReader::loadIndex() {
+    // The file ends with the index record's offset and its EOM.
+    if (size_ < sizeof(LogRecordHeader) + sizeof(uint64_t) + sizeof(uint32_t)) return;
+    uint64_t offset = 0;
+    uint32_t eom    = 0;
+    std::memcpy(&offset, base_ + size_ - sizeof(eom) - sizeof(offset), sizeof(offset));
+    std::memcpy(&eom,    base_ + size_ - sizeof(eom), sizeof(eom));
+    if (eom != LOG_EOM || offset + sizeof(LogRecordHeader) > size_) return;
+
+    LogRecordHeader hdr;
+    std::memcpy(&hdr, base_ + offset, sizeof(hdr));
+    if (hdr.magic != LOG_MAGIC ||
+        hdr.recordType != static_cast<uint32_t>(LogRecordType::BlockIndex) ||
+        hdr.payloadSize < sizeof(uint64_t) ||
+        (hdr.payloadSize - sizeof(uint64_t)) % sizeof(LogBlockIndexEntry) != 0 ||
+        offset + sizeof(hdr) + hdr.payloadSize + sizeof(eom) != size_)
+        return;
+
+    index_.resize((hdr.payloadSize - sizeof(uint64_t)) / sizeof(LogBlockIndexEntry));
+    if (!index_.empty())
+        std::memcpy(index_.data(), base_ + offset + sizeof(hdr),
+                    index_.size() * sizeof(LogBlockIndexEntry));
+    version_ = 2;
+}
+
+void LogReader::loadSidecar(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) return;
+
+    // A crash can leave a partial last entry; an entry past the end of the
+    // .bin points at records that never reached the disk.
+    LogSidecarEntry e;
+    while (in.read(reinterpret_cast<char*>(&e), sizeof(e))) {
+        if (e.offset >= size_ || (!sidecar_.empty() && e.offset <= sidecar_.back().offset)) break;
+        sidecar_.push_back(e);
+    }
+}
+
+std::vector<uint64_t> LogReader::split(size_t n) const {
+    std::vector<uint64_t> bounds{0};
+    for (size_t k = 1; k < n; ++k) {
+        LogRecordHeader hdr;
+        uint64_t at = std::max(size_ / n * k, bounds.back() + 1);
+        while ((at = findSom(at)) < size_) {
+            if (!framed(at, hdr)) {
+                ++at;
+                continue;
+            }
+            if (hdr.recordType == static_cast<uint32_t>(LogRecordType::RawDetection) ||
+                hdr.recordType == static_cast<uint32_t>(LogRecordType::Block))
+                break;
+            at += sizeof(hdr) + hdr.payloadSize + sizeof(uint32_t);
+        }
+        if (at >= size_) break;
+        bounds.push_back(at);
+    }
+    bounds.push_back(size_);
+    return bounds;
+}
+
+void LogReader::setByteRange(uint64_t begin, uint64_t end) {
+    seekOffset(std::min(begin, size_));
+    end_ = std::min(end, size_);
+}
+
+void LogReader::setRange(uint32_t fromDwell, uint32_t toDwell, Timestamp fromTime) {
+    ranged_    = true;
+    inRange_   = false;
+    fromDwell_ = fromDwell;
+    toDwell_   = toDwell;
+    fromTime_  = fromTime;
+    if (fromDwell > 0 || fromTime > 0) seek(fromDwell, fromTime);
+}
+
+bool LogReader::next(LogRecordHeader& hdr, LogPayload& payload) {
+    for (;;) {
+        if (!nextRecord(hdr, payload)) return false;
+        if (!ranged_ || hdr.recordType == static_cast<uint32_t>(LogRecordType::RunInfo))
+            return true;
+        // A range starts and ends on dwell boundaries: the raw detections.
+        if (hdr.recordType == static_cast<uint32_t>(LogRecordType::RawDetection) &&
+            payload.size() >= 8) {
+            if (dwell_ > toDwell_) return false;
+            if (!inRange_ && dwell_ >= fromDwell_ && hdr.timestamp >= fromTime_) inRange_ = true;
+        }
+        if (inRange_) return true;
+    }
+}
+
+bool LogReader::nextRecord(LogRecordHeader& hdr, LogPayload& payload) {
+    for (;;) {
+        if (blockPos_ < block_.size()) {
+            const size_t left = block_.size() - blockPos_;
+            if (left >= sizeof(hdr)) std::memcpy(&hdr, block_.data() + blockPos_, sizeof(hdr));
+            if (left < sizeof(hdr) || hdr.magic != LOG_MAGIC ||
+                left - sizeof(hdr) < static_cast<size_t>(hdr.payloadSize) + sizeof(uint32_t)) {
+                // Checksummed, so only a writer bug gets here.
+                ++corrupted_;
+                block_.clear();
+                blockPos_ = 0;
+                continue;
+            }
+            payload = LogPayload(block_.data() + blockPos_ + sizeof(hdr), hdr.payloadSize);
+            blockPos_ += sizeof(hdr) + hdr.payloadSize + sizeof(uint32_t);
+        } else {
+            if (!readRecord(hdr, payload)) return false;
+            if (hdr.recordType == static_cast<uint32_t>(LogRecordType::Block)) {
+                version_ = 2;
+                if (!unpackBlock(payload)) ++corrupted_;
+                continue;
+            }
+            if (hdr.recordType == static_cast<uint32_t>(LogRecordType::BlockIndex)) {
+                version_ = 2;
+                continue;
+            }
+        }
+        if (hdr.recordType == static_cast<uint32_t>(LogRecordType::RawDetection) &&
+            payload.size() >= 8)
+            std::memcpy(&dwell_, payload.data() + 4, 4);
+        return true;
+    }
+}
+
+bool LogReader::readRecord(LogRecordHeader& hdr, LogPayload& payload) {
+    while (pos_ < end_) {
+        if (framed(pos_, hdr)) {
+            payload = LogPayload(base_ + pos_ + sizeof(hdr), hdr.payloadSize);
+            pos_   += sizeof(hdr) + hdr.payloadSize + sizeof(uint32_t);
+            return true;
+        }
+        // Bad SOM, EOM or size.  A record cut off by the end of the file
+        // finds nothing to resync to and ends the read uncounted.
+        if (!resync(pos_ + 1)) return false;
+        ++corrupted_;
+    }
+    return false;
+}
+
+bool LogReader::framed(uint64_t at, LogRecordHeader& hdr) const {
+    if (at + sizeof(hdr) > size_) return false;
+    std::memcpy(&hdr, base_ + at, sizeof(hdr));
+    const uint64_t eomAt = at + sizeof(hdr) + hdr.payloadSize;
+    uint32_t eom = 0;
+    if (hdr.magic != LOG_MAGIC || hdr.payloadSize > LOG_MAX_PAYLOAD ||
+        eomAt + sizeof(eom) > size_)
+        return false;
+    std::memcpy(&eom, base_ + eomAt, sizeof(eom));
+    return eom == LOG_EOM;
+}
+
+bool LogReader::resync(uint64_t from) {
+    pos_ = findSom(from);
+    return pos_ < end_;
+}
+
+uint64_t LogReader::findSom(uint64_t from) const {
+    // memchr for the SOM's first byte runs at memory bandwidth; check the rest there.
+    const uint8_t  first = static_cast<uint8_t>(LOG_MAGIC & 0xFFu);
+    const uint8_t* p     = base_ + std::min(from, size_);
+    const uint8_t* end   = base_ + size_;
+    while (end - p >= 4) {
+        p = static_cast<const uint8_t*>(std::memchr(p, first, static_cast<size_t>(end - p) - 3));
+        if (!p) break;
+        uint32_t magic;
+        std::memcpy(&magic, p, sizeof(magic));
+        if (magic == LOG_MAGIC) return static_cast<uint64_t>(p - base_);
+        ++p;
+    }
+    return size_;
+}
+
+bool LogReader::unpackBlock(const LogPayload& payload) {
+    block_.clear();
+    blockPos_ = 0;
+    LogBlockHeader bh;
+    if (payload.size() < sizeof(bh)) return false;
+    std::memcpy(&bh, payload.data(), sizeof(bh));
+    if (bh.rawBytes > LOG_MAX_PAYLOAD) return false;
+    dwell_ = bh.firstDwell;
+
+    const uint8_t* body = payload.data() + sizeof(bh);
+    const size_t   n    = payload.size() - sizeof(bh);
+    block_.resize(bh.rawBytes);
+    bool ok = false;
+    switch (static_cast<LogCodec>(bh.codec)) {
+        case LogCodec::None:
+            ok = n == bh.rawBytes;
+            if (ok && n) std::memcpy(block_.data(), body, n);
+            break;
+        case LogCodec::LZ4:
+            ok = lz4Decompress(body, n, block_.data(), bh.rawBytes);
+            break;
+    }
+    if (!ok || BinaryLogger::blockChecksum(block_.data(), block_.size()) != bh.checksum) {
+        block_.clear();
+        return false;
+    }
+    return true;
+}
+
+bool LogReader::seekOffset(uint64_t offset) {
+    if (offset > size_) return false;
+    block_.clear();
+    blockPos_ = 0;
+    pos_      = offset;
+    return true;
+}
+
+bool LogReader::seek(uint32_t dwell, Timestamp ts) {
+    // The v2 block index knows where each block ends: take the first that reaches both.
+    if (!index_.empty()) {
+        auto it = std::find_if(index_.begin(), index_.end(), [=](const LogBlockIndexEntry& e) {
+            return e.lastDwell >= dwell && e.lastTs >= ts;
+        });
+        return it != index_.end() && seekOffset(it->offset);
+    }
+    // Sidecar entries mark starts: take the last at or before both.
+    if (sidecar_.empty()) return false;
+    uint64_t offset = 0;
+    for (const LogSidecarEntry& e : sidecar_) {
+        if ((dwell > 0 && e.dwell > dwell) || (ts > 0 && e.timestamp > ts)) break;
+        offset = e.offset;
+    }
+    return seekOffset(offset);
+}
+
+} // namespace cuas
@@ -1,8 +1,15 @@
 #include "common/logger.h"
 #include "common/constants.h"
+#include "common/lz4_block.h"
+#include "common/profiling.h"
 #include <cstdarg>
 #include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <algorithm>
+#include <charconv>
 #include <cstring>
+#include <type_traits>
 #include <chrono>
 #include <iomanip>
 #include <sstream>
@@ -22,6 +29,57 @@ namespace cuas {
 // BinaryLogger
 // ---------------------------------------------------------------------------
 
+namespace {
+
+// Ring entry header; the entry's bytes follow it.
+struct EntryHeader {
+    uint32_t kind;
+    uint32_t bytes;
+};
+
+constexpr size_t WRITE_BATCH = size_t(1) << 20;       // bytes per write() call
+constexpr auto   FLUSH_INTERVAL = std::chrono::milliseconds(20);
+constexpr auto   BLOCK_MAX_AGE  = std::chrono::seconds(1);      // v2: bounds what a crash loses
+
+// Non-allocating line builder for combined_track_flow.dat.  Doubles print
+// as std::fixed with four decimals, like the ostream formatting in
+// log_extractor's dat mode; a field that does not fit is left out.
+class TextLine {
+public:
+    TextLine() = default;
+    TextLine(const TextLine&)            = delete;
+    TextLine& operator=(const TextLine&) = delete;
+
+    TextLine& operator<<(const char* s) {
+        const size_t n = std::min(std::strlen(s), static_cast<size_t>(end() - pos_));
+        std::memcpy(pos_, s, n);
+        pos_ += n;
+        return *this;
+    }
+    TextLine& operator<<(double v) {
+        const auto r = std::to_chars(pos_, end(), v, std::chars_format::fixed, 4);
+        if (r.ec == std::errc()) pos_ = r.ptr;
+        return *this;
+    }
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    TextLine& operator<<(T v) {
+        const auto r = std::to_chars(pos_, end(), v);
+        if (r.ec == std::errc()) pos_ = r.ptr;
+        return *this;
+    }
+
+    const char* data() const { return buf_; }
+    size_t      size() const { return static_cast<size_t>(pos_ - buf_); }
+
+private:
+    char* end() { return buf_ + sizeof(buf_); }
+
+    char  buf_[1024];
+    char* pos_ = buf_;
+};
+
+} // namespace
+
 BinaryLogger::BinaryLogger() = default;
 
 BinaryLogger::~BinaryLogger() {
@@ -29,7 +87,7 @@ BinaryLogger::~BinaryLogger() {
 }
 
 bool BinaryLogger::open(const std::string& directory, const std::string& prefix,
-                        const std::string& runInfo) {
+                        const std::string& runInfo, const LogOptions& options) {
     std::lock_guard<std::mutex> lock(mutex_);
     if (open_) return true;
 
@@ -46,255 +104,684 @@ bool BinaryLogger::open(const std::string& directory, const std::string& prefix,
 
     std::ostringstream fname;
     fname << directory << "/" << prefix << "_"
-          << std::put_time(&tm, "%Y%m%d_%H%M%S") << ".bin";
+          << std::put_time(&tm, "%Y%m%d_%H%M%S");
+
+    options_       = options;
+    runInfo_       = runInfo;
+    stem_          = fname.str();
+    blockBytes_    = std::min(options.blockBytes, static_cast<size_t>(LOG_MAX_PAYLOAD / 2));
+    lastDwellSeen_ = 0;
+    if (blockBytes_ > 0) {
+        block_.reserve(blockBytes_ + WRITE_BATCH);
+        packed_.reserve(lz4CompressBound(blockBytes_ + WRITE_BATCH));
+    }
+    indexEvery_   = options.indexEvery;
+    segment_      = 0;
+    lostBase_     = file_.lostBytes() + combinedDat_.lostBytes();
+    lostReported_ = 0;
+    writeFailing_ = false;
+    if (!openSegment()) return false;
+    combinedOpen_ = combinedDat_.isOpen();
+    lastSync_     = segmentStarted_;
+
+    size_t bytes = 16 * CHUNK;
+    while (bytes < options.ringBytes) bytes *= 2;
+    const size_t chunks = bytes / CHUNK;
+    ring_.reset(new uint8_t[bytes]);
+    seq_.reset(new std::atomic<uint64_t>[chunks]);
+    for (size_t i = 0; i < chunks; ++i) seq_[i].store(0, std::memory_order_relaxed);
+    chunkMask_ = chunks - 1;
+    byteMask_  = bytes - 1;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    stop_ = false;
 
-    file_.open(fname.str(), std::ios::binary | std::ios::out);
-    if (!file_.is_open()) return false;
+    const std::string path = logPath_;
+    open_ = true;
+    writer_ = std::thread(&BinaryLogger::writerLoop, this);
+    LOG_INFO("BinaryLogger", "Opened log file: %s (%zu KB ring, %s)", path.c_str(), bytes >> 10,
+             blockBytes_ > 0 ? "v2 LZ4 blocks" : "v1");
+    if (options.combinedText == CombinedTextMode::Offline)
+        LOG_INFO("BinaryLogger", "combined_track_flow.dat is offline; rebuild it with "
+                 "'log_extractor %s dat <dir>'", path.c_str());
+    return true;
+}
 
-    logPath_ = fname.str();
+bool BinaryLogger::openSegment() {
+    // The first segment keeps the plain name; later ones are <stem>_NNN.
+    std::string base = stem_;
+    if (const uint32_t n = segment_.load(std::memory_order_relaxed); n > 0) {
+        char suffix[16];
+        std::snprintf(suffix, sizeof(suffix), "_%03u", n);
+        base += suffix;
+    }
+    if (!file_.open(base + ".bin", options_.sync, options_.preallocateBytes)) return false;
+    {
+        std::lock_guard<std::mutex> lock(pathMutex_);
+        logPath_ = base + ".bin";
+    }
 
-    if (!runInfo.empty()) {
+    fileOffset_ = 0;
+    if (!runInfo_.empty()) {
         LogRecordHeader hdr;
         hdr.magic       = LOG_MAGIC;
         hdr.recordType  = static_cast<uint32_t>(LogRecordType::RunInfo);
         hdr.timestamp   = 0;
-        hdr.payloadSize = static_cast<uint32_t>(runInfo.size());
-        file_.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
-        file_.write(runInfo.data(), static_cast<std::streamsize>(runInfo.size()));
+        hdr.payloadSize = static_cast<uint32_t>(runInfo_.size());
         const uint32_t eom = LOG_EOM;
-        file_.write(reinterpret_cast<const char*>(&eom), sizeof(eom));
-    }
-
-    std::string combinedPath = fname.str();
-    size_t dot = combinedPath.rfind(".bin");
-    if (dot != std::string::npos)
-        combinedPath = combinedPath.substr(0, dot) + "_combined_track_flow.dat";
-    else
-        combinedPath += "_combined_track_flow.dat";
-    combinedDat_.open(combinedPath, std::ios::out);
-    if (combinedDat_.is_open()) {
-        if (!runInfo.empty()) {
-            std::istringstream lines(runInfo);
+        file_.write(&hdr, sizeof(hdr));
+        file_.write(runInfo_.data(), runInfo_.size());
+        file_.write(&eom, sizeof(eom));
+        fileOffset_ = sizeof(hdr) + runInfo_.size() + sizeof(eom);
+    }
+    segmentHeader_  = fileOffset_;
+    segmentStarted_ = std::chrono::steady_clock::now();
+    block_.clear();
+    blockIndex_.clear();
+
+    sinceIndexed_ = indexEvery_;
+    if (indexEvery_ > 0) {
+        sidecar_.open(base + ".idx", std::ios::binary | std::ios::out);
+        if (!sidecar_.is_open())
+            LOG_WARN("BinaryLogger", "Cannot create %s.idx; logging without it", base.c_str());
+    }
+
+    if (options_.combinedText == CombinedTextMode::Live &&
+        combinedDat_.open(base + "_combined_track_flow.dat", options_.sync, options_.preallocateBytes / 4)) {
+        std::string header;
+        if (!runInfo_.empty()) {
+            std::istringstream lines(runInfo_);
             std::string line;
             while (std::getline(lines, line))
-                combinedDat_ << "# " << line << "\n";
-            combinedDat_ << "\n";
+                header += "# " + line + "\n";
+            header += "\n";
         }
-        combinedDat_ << "step\tdwell\ttimestamp_us\tnum_detections\tdet_idx\trange_m\tazimuth_deg\televation_deg\trange_rate"
-                    << "\tstrength\tnoise\tsnr\trcs\tmicroDoppler\tcluster_id\tassoc_distance\ttrack_id\tstatus\tclassification"
-                    << "\tx_m\ty_m\tz_m\tvx\tvy\tvz\tax\tay\taz\tquality\thits\tmisses\tage\n";
+        header += "step\tdwell\ttimestamp_us\tnum_detections\tdet_idx\trange_m\tazimuth_deg\televation_deg\trange_rate"
+                  "\tstrength\tnoise\tsnr\trcs\tmicroDoppler\tcluster_id\tassoc_distance\ttrack_id\tstatus\tclassification"
+                  "\tx_m\ty_m\tz_m\tvx\tvy\tvz\tax\tay\taz\tquality\thits\tmisses\tage\n";
+        combinedDat_.write(header.data(), header.size());
     }
-
-    open_ = true;
-    LOG_INFO("BinaryLogger", "Opened log file: %s", fname.str().c_str());
     return true;
 }
 
+void BinaryLogger::closeSegment() {
+    if (blockBytes_ > 0 && file_.isOpen()) {
+        sealBlock();
+        writeBlockIndex();
+    }
+    file_.close();
+    if (sidecar_.is_open()) sidecar_.close();
+    combinedDat_.close();
+}
+
+void BinaryLogger::rotateSegment() {
+    const std::string done = getLogPath();
+    closeSegment();
+    segment_.fetch_add(1, std::memory_order_relaxed);
+    if (!openSegment()) {
+        // Retried at the next raw detection record; until then nothing is written.
+        segment_.fetch_sub(1, std::memory_order_relaxed);
+        if (!writeFailing_)
+            LOG_WARN("BinaryLogger", "Cannot open the next log segment after %s; retrying", done.c_str());
+        writeFailing_ = true;
+        return;
+    }
+    lastSync_ = segmentStarted_;
+    LOG_INFO("BinaryLogger", "Log segment %s closed; continuing in %s", done.c_str(),
+             getLogPath().c_str());
+}
+
+uint64_t BinaryLogger::lostBytes() const {
+    return file_.lostBytes() + combinedDat_.lostBytes() - lostBase_;
+}
+
+void BinaryLogger::checkWrites() {
+    const uint64_t lost = lostBytes();
+    if (lost > lostReported_) {
+        if (!writeFailing_)
+            LOG_WARN("BinaryLogger", "Log writes failing (disk full?): %s; dropping log data until they succeed",
+                     getLogPath().c_str());
+        writeFailing_ = true;
+    } else if (writeFailing_ && file_.isOpen()) {
+        LOG_INFO("BinaryLogger", "Log writes succeeding again: %s", getLogPath().c_str());
+        writeFailing_ = false;
+    }
+    lostReported_ = lost;
+}
+
 void BinaryLogger::close() {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (open_) {
-        file_.flush();
-        file_.close();
-        if (combinedDat_.is_open()) {
+    if (!open_) return;
+    open_ = false;
+    {
+        std::lock_guard<std::mutex> wl(wakeMutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    writer_.join();
+
+    closeSegment();
+    combinedOpen_ = false;
+
+    if (droppedRecords() > 0)
+        LOG_WARN("BinaryLogger", "%llu log records (%llu bytes) dropped on a full ring: %s",
+                 static_cast<unsigned long long>(droppedRecords()),
+                 static_cast<unsigned long long>(droppedBytes()), logPath_.c_str());
+    if (lostBytes() > 0)
+        LOG_WARN("BinaryLogger", "%llu bytes of log data lost to failed writes: %s",
+                 static_cast<unsigned long long>(lostBytes()), logPath_.c_str());
+}
+
+bool BinaryLogger::isOpen() const { return open_; }
+
+// ---------------------------------------------------------------------------
+// Record ring
+// ---------------------------------------------------------------------------
+
+bool BinaryLogger::reserve(EntryKind kind, size_t bytes, Entry& e) {
+    const uint64_t chunks = (sizeof(EntryHeader) + bytes + CHUNK - 1) / CHUNK;
+    uint64_t h = head_.load(std::memory_order_relaxed);
+    do {
+        if (h + chunks - tail_.load(std::memory_order_acquire) > chunkMask_ + 1) {
+            droppedRecords_.fetch_add(1, std::memory_order_relaxed);
+            droppedBytes_.fetch_add(bytes, std::memory_order_relaxed);
+            return false;
+        }
+    } while (!head_.compare_exchange_weak(h, h + chunks, std::memory_order_relaxed));
+
+    e.chunk  = h;
+    e.cursor = h * CHUNK;
+    const EntryHeader eh{kind, static_cast<uint32_t>(bytes)};
+    put(e, &eh, sizeof(eh));
+    return true;
+}
+
+void BinaryLogger::put(Entry& e, const void* data, size_t n) {
+    if (n == 0) return;
+    const size_t off   = static_cast<size_t>(e.cursor & byteMask_);
+    const size_t first = std::min(n, static_cast<size_t>(byteMask_ + 1) - off);
+    std::memcpy(ring_.get() + off, data, first);
+    if (first < n)
+        std::memcpy(ring_.get(), static_cast<const uint8_t*>(data) + first, n - first);
+    e.cursor += n;
+}
+
+void BinaryLogger::commit(const Entry& e) {
+    seq_[e.chunk & chunkMask_].store(e.chunk + 1, std::memory_order_release);
+    // Past half full, don't wait out the flush interval.
+    const uint64_t used = head_.load(std::memory_order_relaxed) -
+                          tail_.load(std::memory_order_relaxed);
+    if (used > (chunkMask_ + 1) / 2 && !wakeRequested_.load(std::memory_order_relaxed) &&
+        !wakeRequested_.exchange(true))
+        wake_.notify_one();
+}
+
+void BinaryLogger::get(uint64_t cursor, void* out, size_t n) const {
+    if (n == 0) return;
+    const size_t off   = static_cast<size_t>(cursor & byteMask_);
+    const size_t first = std::min(n, static_cast<size_t>(byteMask_ + 1) - off);
+    std::memcpy(out, ring_.get() + off, first);
+    if (first < n)
+        std::memcpy(static_cast<uint8_t*>(out) + first, ring_.get(), n - first);
+}
+
+bool BinaryLogger::drain(std::vector<uint8_t>& binary, std::string& text, size_t limit) {
+    // Stops at the first entry still being written, so each file keeps
+    // the order in which space was claimed.
+    const bool segmented = options_.segmentBytes > 0 || options_.segmentAge.count() > 0;
+    const bool aged      = options_.segmentAge.count() > 0 &&
+                           std::chrono::steady_clock::now() - segmentStarted_ >= options_.segmentAge;
+    bool rotate = false;
+    uint64_t t = tail_.load(std::memory_order_relaxed);
+    while (binary.size() + text.size() < limit &&
+           seq_[t & chunkMask_].load(std::memory_order_acquire) == t + 1) {
+        EntryHeader eh;
+        get(t * CHUNK, &eh, sizeof(eh));
+        const uint64_t from = t * CHUNK + sizeof(eh);
+        if (segmented && eh.kind == ENTRY_BINARY) {
+            // A segment ends just before a raw detection record, so each one
+            // starts on a dwell.
+            LogRecordHeader hdr;
+            get(from, &hdr, sizeof(hdr));
+            const uint64_t bytes = fileOffset_ + block_.size() + binary.size();
+            if (hdr.recordType == static_cast<uint32_t>(LogRecordType::RawDetection) &&
+                bytes > segmentHeader_ &&
+                (aged || (options_.segmentBytes > 0 && bytes >= options_.segmentBytes))) {
+                rotate = true;
+                break;
+            }
+        }
+        if (eh.kind == ENTRY_TEXT) {
+            const size_t old = text.size();
+            text.resize(old + eh.bytes);
+            get(from, &text[old], eh.bytes);
+        } else {
+            const size_t old = binary.size();
+            binary.resize(old + eh.bytes);
+            get(from, binary.data() + old, eh.bytes);
+        }
+        t += (sizeof(eh) + eh.bytes + CHUNK - 1) / CHUNK;
+    }
+    // Hand the space back before the (possibly slow) file writes.
+    tail_.store(t, std::memory_order_release);
+    return rotate;
+}
+
+void BinaryLogger::writerLoop() {
+    CUAS_PROFILE_THREAD("binary log");
+    std::vector<uint8_t> binary;
+    std::string          text;
+    binary.reserve(WRITE_BATCH);
+    text.reserve(WRITE_BATCH);
+
+    for (;;) {
+        bool stopping;
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            wake_.wait_for(lock, FLUSH_INTERVAL, [this] {
+                return stop_ || wakeRequested_.load(std::memory_order_relaxed);
+            });
+            stopping = stop_;
+        }
+        wakeRequested_.store(false, std::memory_order_relaxed);
+
+        bool wrote = false;
+        for (;;) {
+            CUAS_PROFILE_ZONE("log write");
+            const bool rotate = drain(binary, text, WRITE_BATCH);
+            if (binary.empty() && text.empty() && !rotate) break;
+            if (!binary.empty()) writeBinary(binary);
+            if (!text.empty() && combinedOpen_) combinedDat_.write(text.data(), text.size());
+            binary.clear();
+            text.clear();
+            if (rotate) rotateSegment();
+            wrote = true;
+        }
+        // On stop, close() seals the last block and writes the block index.
+        if (blockBytes_ > 0 && !block_.empty() &&
+            std::chrono::steady_clock::now() - blockStarted_ >= BLOCK_MAX_AGE) {
+            sealBlock();
+            wrote = true;
+        }
+        if (wrote) {
+            CUAS_PROFILE_ZONE("log flush");
+            file_.flush();
+            if (sidecar_.is_open()) sidecar_.flush();
             combinedDat_.flush();
-            combinedDat_.close();
+            checkWrites();
+        }
+        if (options_.sync != LogSyncMode::None &&
+            std::chrono::steady_clock::now() - lastSync_ >= options_.syncInterval) {
+            CUAS_PROFILE_ZONE("log sync");
+            file_.sync();
+            combinedDat_.sync();
+            lastSync_ = std::chrono::steady_clock::now();
         }
-        open_ = false;
+        if (stopping) return;
     }
 }
 
-bool BinaryLogger::isOpen() const { return open_; }
+void BinaryLogger::writeBinary(const std::vector<uint8_t>& binary) {
+    if (blockBytes_ > 0) {
+        packRecords(binary);
+        return;
+    }
+    if (sidecar_.is_open()) {
+        // A binary batch is whole records back to back.
+        for (size_t pos = 0; pos + sizeof(LogRecordHeader) <= binary.size();) {
+            LogRecordHeader hdr;
+            std::memcpy(&hdr, binary.data() + pos, sizeof(hdr));
+            if (hdr.recordType == static_cast<uint32_t>(LogRecordType::RawDetection) &&
+                hdr.payloadSize >= 8 && sinceIndexed_ >= indexEvery_) {
+                uint32_t dwell;
+                std::memcpy(&dwell, binary.data() + pos + sizeof(hdr) + 4, 4);
+                writeSidecar(dwell, hdr.timestamp, fileOffset_ + pos);
+            }
+            ++sinceIndexed_;
+            pos += sizeof(hdr) + hdr.payloadSize + sizeof(uint32_t);
+        }
+    }
+    file_.write(binary.data(), binary.size());
+    fileOffset_ += binary.size();
+}
 
-void BinaryLogger::writeCombinedLine(const char* step, Timestamp ts, const std::string& payload) {
-    if (!combinedDat_.is_open()) return;
-    std::lock_guard<std::mutex> lock(mutex_);
-    combinedDat_ << step << "\t" << currentDwell_ << "\t" << ts << "\t" << payload << "\n";
+void BinaryLogger::writeSidecar(uint32_t dwell, Timestamp ts, uint64_t offset) {
+    LogSidecarEntry e;
+    e.dwell     = dwell;
+    e.timestamp = ts;
+    e.offset    = offset;
+    sidecar_.write(reinterpret_cast<const char*>(&e), sizeof(e));
+    sinceIndexed_ = 0;
 }
 
-void BinaryLogger::writeRecord(LogRecordType type, Timestamp ts,
-                                const void* data, uint32_t size) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!open_) return;
+// ---------------------------------------------------------------------------
+// v2 container
+// ---------------------------------------------------------------------------
+
+uint32_t BinaryLogger::blockChecksum(const uint8_t* data, size_t n) {
+    uint32_t h = 2166136261u;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        uint32_t w;
+        std::memcpy(&w, data + i, 4);
+        h = (h ^ w) * 16777619u;
+    }
+    for (; i < n; ++i) h = (h ^ data[i]) * 16777619u;
+    return h;
+}
+
+void BinaryLogger::packRecords(const std::vector<uint8_t>& binary) {
+    // A binary batch is whole records back to back.
+    size_t pos = 0;
+    while (pos + sizeof(LogRecordHeader) <= binary.size()) {
+        LogRecordHeader hdr;
+        std::memcpy(&hdr, binary.data() + pos, sizeof(hdr));
+        const size_t bytes = sizeof(hdr) + hdr.payloadSize + sizeof(uint32_t);
+        // Only raw detections carry the dwell; the rest belong to the latest one.
+        if (hdr.recordType == static_cast<uint32_t>(LogRecordType::RawDetection) &&
+            hdr.payloadSize >= 8)
+            std::memcpy(&lastDwellSeen_, binary.data() + pos + sizeof(hdr) + 4, 4);
+
+        if (block_.empty()) {
+            blockMeta_ = LogBlockHeader{};
+            blockMeta_.firstDwell = blockMeta_.lastDwell = lastDwellSeen_;
+            blockMeta_.firstTs    = blockMeta_.lastTs    = hdr.timestamp;
+            blockStarted_ = std::chrono::steady_clock::now();
+        }
+        block_.insert(block_.end(), binary.begin() + pos, binary.begin() + pos + bytes);
+        ++blockMeta_.records;
+        blockMeta_.firstDwell = std::min(blockMeta_.firstDwell, lastDwellSeen_);
+        blockMeta_.lastDwell  = std::max(blockMeta_.lastDwell,  lastDwellSeen_);
+        blockMeta_.firstTs    = std::min(blockMeta_.firstTs, hdr.timestamp);
+        blockMeta_.lastTs     = std::max(blockMeta_.lastTs,  hdr.timestamp);
+        pos += bytes;
+
+        if (block_.size() >= blockBytes_) sealBlock();
+    }
+}
+
+void BinaryLogger::sealBlock() {
+    if (block_.empty()) return;
+
+    LogBlockHeader bh = blockMeta_;
+    bh.rawBytes = static_cast<uint32_t>(block_.size());
+    bh.checksum = blockChecksum(block_.data(), block_.size());
+
+    packed_.resize(lz4CompressBound(block_.size()));
+    size_t n = lz4Compress(block_.data(), block_.size(), packed_.data());
+    const uint8_t* body = packed_.data();
+    bh.codec = static_cast<uint32_t>(LogCodec::LZ4);
+    if (n >= block_.size()) {
+        body     = block_.data();
+        n        = block_.size();
+        bh.codec = static_cast<uint32_t>(LogCodec::None);
+    }
+
+    LogRecordHeader hdr;
+    hdr.magic       = LOG_MAGIC;
+    hdr.recordType  = static_cast<uint32_t>(LogRecordType::Block);
+    hdr.timestamp   = bh.firstTs;
+    hdr.payloadSize = static_cast<uint32_t>(sizeof(bh) + n);
+    const uint32_t eom = LOG_EOM;
+    file_.write(&hdr, sizeof(hdr));
+    file_.write(&bh, sizeof(bh));
+    file_.write(body, n);
+    file_.write(&eom, sizeof(eom));
+
+    LogBlockIndexEntry ie;
+    ie.offset     = fileOffset_;
+    ie.firstDwell = bh.firstDwell;
+    ie.lastDwell  = bh.lastDwell;
+    ie.firstTs    = bh.firstTs;
+    ie.lastTs     = bh.lastTs;
+    ie.records    = bh.records;
+    ie.rawBytes   = bh.rawBytes;
+    blockIndex_.push_back(ie);
+    if (sidecar_.is_open()) writeSidecar(bh.firstDwell, bh.firstTs, fileOffset_);
+
+    fileOffset_ += sizeof(hdr) + hdr.payloadSize + sizeof(eom);
+    block_.clear();
+}
+
+void BinaryLogger::writeBlockIndex() {
+    const size_t entries = blockIndex_.size() * sizeof(LogBlockIndexEntry);
+    LogRecordHeader hdr;
+    hdr.magic       = LOG_MAGIC;
+    hdr.recordType  = static_cast<uint32_t>(LogRecordType::BlockIndex);
+    hdr.timestamp   = blockIndex_.empty() ? 0 : blockIndex_.back().lastTs;
+    hdr.payloadSize = static_cast<uint32_t>(entries + sizeof(uint64_t));
+    const uint32_t eom = LOG_EOM;
+    file_.write(&hdr, sizeof(hdr));
+    file_.write(blockIndex_.data(), entries);
+    file_.write(&fileOffset_, sizeof(fileOffset_));
+    file_.write(&eom, sizeof(eom));
+    fileOffset_ += sizeof(hdr) + hdr.payloadSize + sizeof(eom);
+}
+
+// ---------------------------------------------------------------------------
+// Records
+// ---------------------------------------------------------------------------
+
+bool BinaryLogger::beginRecord(LogRecordType type, Timestamp ts, uint32_t size, Entry& e) {
+    if (!open_.load(std::memory_order_relaxed)) return false;
+    if (!reserve(ENTRY_BINARY, sizeof(LogRecordHeader) + size + sizeof(uint32_t), e))
+        return false;
 
     LogRecordHeader hdr;
     hdr.magic       = LOG_MAGIC;
     hdr.recordType  = static_cast<uint32_t>(type);
     hdr.timestamp   = ts;
     hdr.payloadSize = size;
+    put(e, &hdr, sizeof(hdr));
+    return true;
+}
 
-    file_.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
-    if (size > 0 && data)
-        file_.write(reinterpret_cast<const char*>(data), size);
+void BinaryLogger::endRecord(Entry& e) {
     const uint32_t eom = LOG_EOM;
-    file_.write(reinterpret_cast<const char*>(&eom), sizeof(eom));
+    put(e, &eom, sizeof(eom));
+    commit(e);
 }
 
 void BinaryLogger::writeRecord(LogRecordType type, Timestamp ts,
-                                const std::vector<uint8_t>& data) {
-    writeRecord(type, ts, data.data(), static_cast<uint32_t>(data.size()));
+                                const void* data, uint32_t size) {
+    Entry e;
+    if (!beginRecord(type, ts, size, e)) return;
+    put(e, data, size);
+    endRecord(e);
+}
+
+void BinaryLogger::writeCombinedLine(const char* step, Timestamp ts, const char* text, size_t n) {
+    if (!open_.load(std::memory_order_relaxed)) return;
+    char prefix[64];
+    const int k = std::snprintf(prefix, sizeof(prefix), "%s\t%u\t%llu\t", step, currentDwell_,
+                                static_cast<unsigned long long>(ts));
+    const size_t len = std::min(static_cast<size_t>(k), sizeof(prefix) - 1);
+    Entry e;
+    if (!reserve(ENTRY_TEXT, len + n + 1, e)) return;
+    put(e, prefix, len);
+    put(e, text, n);
+    put(e, "\n", 1);
+    commit(e);
 }
 
 void BinaryLogger::logRawDetections(Timestamp ts, const SPDetectionMessage& msg) {
+    StageTimer timer(timings_, PipelineStage::BinaryLog);
     currentDwell_ = msg.dwellCount;
-    std::vector<uint8_t> buf;
     uint32_t n = msg.numDetections;
-    size_t sz = sizeof(uint32_t) * 3 + sizeof(Timestamp) + n * sizeof(Detection);
-    buf.resize(sz);
-    uint8_t* p = buf.data();
-    std::memcpy(p, &msg.messageId,    4); p += 4;
-    std::memcpy(p, &msg.dwellCount,   4); p += 4;
-    std::memcpy(p, &msg.timestamp,    8); p += 8;
-    std::memcpy(p, &n,                4); p += 4;
-    for (uint32_t i = 0; i < n; ++i) {
-        std::memcpy(p, &msg.detections[i], sizeof(Detection));
-        p += sizeof(Detection);
+    Entry e;
+    if (beginRecord(LogRecordType::RawDetection, ts,
+                    static_cast<uint32_t>(sizeof(uint32_t) * 3 + sizeof(Timestamp) +
+                                          n * sizeof(Detection)), e)) {
+        put(e, &msg.messageId,  4);
+        put(e, &msg.dwellCount, 4);
+        put(e, &msg.timestamp,  8);
+        put(e, &n,              4);
+        put(e, msg.detections.data(), n * sizeof(Detection));
+        endRecord(e);
     }
-    writeRecord(LogRecordType::RawDetection, ts, buf);
+    if (!combinedTextActive()) return;
     for (uint32_t i = 0; i < n; ++i) {
         const Detection& d = msg.detections[i];
-        std::ostringstream pl;
-        pl << std::fixed << std::setprecision(4) << n << "\t" << i << "\t" << d.range
+        TextLine pl;
+        pl << n << "\t" << i << "\t" << d.range
            << "\t" << (d.azimuth * RAD2DEG) << "\t" << (d.elevation * RAD2DEG) << "\t\t"
            << d.strength << "\t" << d.noise << "\t" << d.snr << "\t" << d.rcs << "\t" << d.microDoppler
            << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t";
-        writeCombinedLine("raw", ts, pl.str());
+        writeCombinedLine("raw", ts, pl.data(), pl.size());
     }
 }
 
 void BinaryLogger::logPreprocessed(Timestamp ts, const std::vector<Detection>& dets) {
+    StageTimer timer(timings_, PipelineStage::BinaryLog);
     uint32_t n = static_cast<uint32_t>(dets.size());
-    std::vector<uint8_t> buf(sizeof(uint32_t) + n * sizeof(Detection));
-    uint8_t* p = buf.data();
-    std::memcpy(p, &n, 4); p += 4;
-    for (auto& d : dets) {
-        std::memcpy(p, &d, sizeof(Detection));
-        p += sizeof(Detection);
-    }
-    writeRecord(LogRecordType::Preprocessed, ts, buf);
+    Entry e;
+    if (beginRecord(LogRecordType::Preprocessed, ts,
+                    static_cast<uint32_t>(sizeof(uint32_t) + n * sizeof(Detection)), e)) {
+        put(e, &n, 4);
+        put(e, dets.data(), n * sizeof(Detection));
+        endRecord(e);
+    }
+    if (!combinedTextActive()) return;
     for (uint32_t i = 0; i < n; ++i) {
         const Detection& d = dets[i];
-        std::ostringstream pl;
-        pl << std::fixed << std::setprecision(4) << n << "\t" << i << "\t" << d.range
+        TextLine pl;
+        pl << n << "\t" << i << "\t" << d.range
            << "\t" << (d.azimuth * RAD2DEG) << "\t" << (d.elevation * RAD2DEG) << "\t\t"
            << d.strength << "\t" << d.noise << "\t" << d.snr << "\t" << d.rcs << "\t" << d.microDoppler
            << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t";
-        writeCombinedLine("preprocessed", ts, pl.str());
+        writeCombinedLine("preprocessed", ts, pl.data(), pl.size());
     }
 }
 
-void BinaryLogger::logClustered(Timestamp ts, const std::vector<Cluster>& clusters) {
-    uint32_t n = static_cast<uint32_t>(clusters.size());
+void BinaryLogger::logClustered(Timestamp ts, const std::vector<Cluster>& clusters,
+                                const std::vector<Cluster>& aided) {
+    StageTimer timer(timings_, PipelineStage::BinaryLog);
+    auto forEach = [&](auto&& f) {
+        for (auto& c : clusters) f(c);
+        for (auto& c : aided)    f(c);
+    };
+    uint32_t n = static_cast<uint32_t>(clusters.size() + aided.size());
     size_t sz = sizeof(uint32_t);
-    for (auto& c : clusters)
+    forEach([&](const Cluster& c) {
         sz += sizeof(uint32_t) + 7*sizeof(double) + sizeof(uint32_t)
               + 3*sizeof(double) + sizeof(uint32_t)
               + c.detectionIndices.size() * sizeof(uint32_t);
-    std::vector<uint8_t> buf(sz);
-    uint8_t* p = buf.data();
-    std::memcpy(p, &n, 4); p += 4;
-    for (auto& c : clusters) {
-        std::memcpy(p, &c.clusterId,     4); p += 4;
-        std::memcpy(p, &c.range,         8); p += 8;
-        std::memcpy(p, &c.azimuth,       8); p += 8;
-        std::memcpy(p, &c.elevation,     8); p += 8;
-        std::memcpy(p, &c.strength,      8); p += 8;
-        std::memcpy(p, &c.snr,           8); p += 8;
-        std::memcpy(p, &c.rcs,           8); p += 8;
-        std::memcpy(p, &c.microDoppler,  8); p += 8;
-        std::memcpy(p, &c.numDetections, 4); p += 4;
-        std::memcpy(p, &c.cartesian.x,   8); p += 8;
-        std::memcpy(p, &c.cartesian.y,   8); p += 8;
-        std::memcpy(p, &c.cartesian.z,   8); p += 8;
-        uint32_t ni = static_cast<uint32_t>(c.detectionIndices.size());
-        std::memcpy(p, &ni, 4); p += 4;
-        for (auto idx : c.detectionIndices) { std::memcpy(p, &idx, 4); p += 4; }
-    }
-    writeRecord(LogRecordType::Clustered, ts, buf);
-    for (const auto& c : clusters) {
-        std::ostringstream pl;
-        pl << std::fixed << std::setprecision(4) << c.numDetections << "\t\t" << c.range
+    });
+    Entry e;
+    if (beginRecord(LogRecordType::Clustered, ts, static_cast<uint32_t>(sz), e)) {
+        put(e, &n, 4);
+        forEach([&](const Cluster& c) {
+            put(e, &c.clusterId,     4);
+            put(e, &c.range,         8);
+            put(e, &c.azimuth,       8);
+            put(e, &c.elevation,     8);
+            put(e, &c.strength,      8);
+            put(e, &c.snr,           8);
+            put(e, &c.rcs,           8);
+            put(e, &c.microDoppler,  8);
+            put(e, &c.numDetections, 4);
+            put(e, &c.cartesian.x,   8);
+            put(e, &c.cartesian.y,   8);
+            put(e, &c.cartesian.z,   8);
+            uint32_t ni = static_cast<uint32_t>(c.detectionIndices.size());
+            put(e, &ni, 4);
+            put(e, c.detectionIndices.data(), ni * sizeof(uint32_t));
+        });
+        endRecord(e);
+    }
+    if (!combinedTextActive()) return;
+    forEach([&](const Cluster& c) {
+        TextLine pl;
+        pl << c.numDetections << "\t\t" << c.range
            << "\t" << (c.azimuth * RAD2DEG) << "\t" << (c.elevation * RAD2DEG) << "\t\t"
            << c.strength << "\t\t" << c.snr << "\t" << c.rcs << "\t" << c.microDoppler
            << "\t" << c.clusterId << "\t\t\t\t\t\t"
            << c.cartesian.x << "\t" << c.cartesian.y << "\t" << c.cartesian.z
            << "\t\t\t\t\t\t\t\t\t\t";
-        writeCombinedLine("clustering", ts, pl.str());
-    }
+        writeCombinedLine("clustering", ts, pl.data(), pl.size());
+    });
 }
 
 void BinaryLogger::logPredicted(Timestamp ts, uint32_t trackId, const StateVector& state) {
-    std::vector<uint8_t> buf(sizeof(uint32_t) + STATE_DIM * sizeof(double));
-    uint8_t* p = buf.data();
+    StageTimer timer(timings_, PipelineStage::BinaryLog);
+    uint8_t buf[sizeof(uint32_t) + STATE_DIM * sizeof(double)];
+    uint8_t* p = buf;
     std::memcpy(p, &trackId, 4); p += 4;
     for (int i = 0; i < STATE_DIM; ++i) { std::memcpy(p, &state[i], 8); p += 8; }
-    writeRecord(LogRecordType::Predicted, ts, buf);
-    std::ostringstream pl;
-    pl << std::fixed << std::setprecision(4)
-       << "\t\t\t\t\t\t\t\t\t\t\t\t\t" << trackId << "\t\t\t\t"
+    writeRecord(LogRecordType::Predicted, ts, buf, sizeof(buf));
+    if (!combinedTextActive()) return;
+    TextLine pl;
+    pl << "\t\t\t\t\t\t\t\t\t\t\t\t\t" << trackId << "\t\t\t\t"
        << state[0] << "\t" << state[3] << "\t" << state[6] << "\t"
        << state[1] << "\t" << state[4] << "\t" << state[7] << "\t"
        << state[2] << "\t" << state[5] << "\t" << state[8] << "\t\t\t\t\t";
-    writeCombinedLine("prediction", ts, pl.str());
+    writeCombinedLine("prediction", ts, pl.data(), pl.size());
 }
 
 void BinaryLogger::logAssociated(Timestamp ts, uint32_t trackId,
                                   uint32_t clusterId, double distance) {
-    std::vector<uint8_t> buf(sizeof(uint32_t) * 2 + sizeof(double));
-    uint8_t* p = buf.data();
+    StageTimer timer(timings_, PipelineStage::BinaryLog);
+    uint8_t buf[sizeof(uint32_t) * 2 + sizeof(double)];
+    uint8_t* p = buf;
     std::memcpy(p, &trackId,   4); p += 4;
     std::memcpy(p, &clusterId, 4); p += 4;
     std::memcpy(p, &distance,  8); p += 8;
-    writeRecord(LogRecordType::Associated, ts, buf);
-    std::ostringstream pl;
-    pl << std::fixed << std::setprecision(4)
-       << "\t\t\t\t\t\t\t\t\t\t\t" << clusterId << "\t" << distance << "\t"
+    writeRecord(LogRecordType::Associated, ts, buf, sizeof(buf));
+    if (!combinedTextActive()) return;
+    TextLine pl;
+    pl << "\t\t\t\t\t\t\t\t\t\t\t" << clusterId << "\t" << distance << "\t"
        << trackId << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t";
-    writeCombinedLine("association", ts, pl.str());
+    writeCombinedLine("association", ts, pl.data(), pl.size());
 }
 
 void BinaryLogger::logTrackInitiated(Timestamp ts, uint32_t trackId,
                                       const StateVector& state) {
-    std::vector<uint8_t> buf(sizeof(uint32_t) + STATE_DIM * sizeof(double));
-    uint8_t* p = buf.data();
+    StageTimer timer(timings_, PipelineStage::BinaryLog);
+    uint8_t buf[sizeof(uint32_t) + STATE_DIM * sizeof(double)];
+    uint8_t* p = buf;
     std::memcpy(p, &trackId, 4); p += 4;
     for (int i = 0; i < STATE_DIM; ++i) { std::memcpy(p, &state[i], 8); p += 8; }
-    writeRecord(LogRecordType::TrackInitiated, ts, buf);
-    std::ostringstream pl;
-    pl << std::fixed << std::setprecision(4)
-       << "\t\t\t\t\t\t\t\t\t\t\t\t\t" << trackId << "\t\t\t\t"
+    writeRecord(LogRecordType::TrackInitiated, ts, buf, sizeof(buf));
+    if (!combinedTextActive()) return;
+    TextLine pl;
+    pl << "\t\t\t\t\t\t\t\t\t\t\t\t\t" << trackId << "\t\t\t\t"
        << state[0] << "\t" << state[3] << "\t" << state[6] << "\t"
        << state[1] << "\t" << state[4] << "\t" << state[7] << "\t"
        << state[2] << "\t" << state[5] << "\t" << state[8] << "\t\t\t\t\t";
-    writeCombinedLine("track_init", ts, pl.str());
+    writeCombinedLine("track_init", ts, pl.data(), pl.size());
 }
 
 void BinaryLogger::logTrackUpdated(Timestamp ts, uint32_t trackId,
                                     const StateVector& state, TrackStatus status) {
-    std::vector<uint8_t> buf(sizeof(uint32_t) * 2 + STATE_DIM * sizeof(double));
-    uint8_t* p = buf.data();
+    StageTimer timer(timings_, PipelineStage::BinaryLog);
+    uint8_t buf[sizeof(uint32_t) * 2 + STATE_DIM * sizeof(double)];
+    uint8_t* p = buf;
     std::memcpy(p, &trackId, 4); p += 4;
     uint32_t s = static_cast<uint32_t>(status);
     std::memcpy(p, &s, 4); p += 4;
     for (int i = 0; i < STATE_DIM; ++i) { std::memcpy(p, &state[i], 8); p += 8; }
-    writeRecord(LogRecordType::TrackUpdated, ts, buf);
-    std::ostringstream pl;
-    pl << std::fixed << std::setprecision(4)
-       << "\t\t\t\t\t\t\t\t\t\t\t\t\t" << trackId << "\t" << s << "\t\t"
+    writeRecord(LogRecordType::TrackUpdated, ts, buf, sizeof(buf));
+    if (!combinedTextActive()) return;
+    TextLine pl;
+    pl << "\t\t\t\t\t\t\t\t\t\t\t\t\t" << trackId << "\t" << s << "\t\t"
        << state[0] << "\t" << state[3] << "\t" << state[6] << "\t"
        << state[1] << "\t" << state[4] << "\t" << state[7] << "\t"
        << state[2] << "\t" << state[5] << "\t" << state[8] << "\t\t\t\t\t";
-    writeCombinedLine("update", ts, pl.str());
+    writeCombinedLine("update", ts, pl.data(), pl.size());
 }
 
 void BinaryLogger::logTrackDeleted(Timestamp ts, uint32_t trackId) {
+    StageTimer timer(timings_, PipelineStage::BinaryLog);
     writeRecord(LogRecordType::TrackDeleted, ts, &trackId, sizeof(uint32_t));
-    std::ostringstream pl;
+    if (!combinedTextActive()) return;
+    TextLine pl;
     pl << "\t\t\t\t\t\t\t\t\t\t\t\t\t" << trackId << "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t";
-    writeCombinedLine("track_delete", ts, pl.str());
+    writeCombinedLine("track_delete", ts, pl.data(), pl.size());
 }
 
 // logTrackSent now receives the IDL-generated CounterUAS::TrackUpdateMessage.
 void BinaryLogger::logTrackSent(Timestamp ts, const CounterUAS::TrackUpdateMessage& msg) {
+    StageTimer timer(timings_, PipelineStage::BinaryLog);
     // Serialise field-by-field (IDL class has getter methods, not flat layout).
     uint32_t msgId = msg.messageId();
     uint32_t trkId = msg.trackId();
@@ -312,9 +799,8 @@ void BinaryLogger::logTrackSent(Timestamp ts, const CounterUAS::TrackUpdateMessa
     uint32_t miss  = msg.missCount();
     uint32_t age   = msg.age();
 
-    size_t sz = 4+4+8+4+4 + 9*8 + 3*4;
-    std::vector<uint8_t> buf(sz);
-    uint8_t* p = buf.data();
+    uint8_t buf[4+4+8+4+4 + 11*8 + 3*4];
+    uint8_t* p = buf;
     auto copy4  = [&p](const void* v){ std::memcpy(p,v,4); p+=4; };
     auto copy8  = [&p](const void* v){ std::memcpy(p,v,8); p+=8; };
     copy4(&msgId); copy4(&trkId); copy8(&tstamp); copy4(&stat); copy4(&cls);
@@ -322,17 +808,17 @@ void BinaryLogger::logTrackSent(Timestamp ts, const CounterUAS::TrackUpdateMessa
     copy8(&x);     copy8(&y);   copy8(&z);
     copy8(&vx);    copy8(&vy);  copy8(&vz);   copy8(&qual);
     copy4(&hits);  copy4(&miss); copy4(&age);
-    writeRecord(LogRecordType::TrackSent, ts, buf);
+    writeRecord(LogRecordType::TrackSent, ts, buf, sizeof(buf));
+    if (!combinedTextActive()) return;
 
-    std::ostringstream pl;
-    pl << std::fixed << std::setprecision(4)
-       << "\t\t" << range << "\t" << (az * RAD2DEG) << "\t" << (el * RAD2DEG)
+    TextLine pl;
+    pl << "\t\t" << range << "\t" << (az * RAD2DEG) << "\t" << (el * RAD2DEG)
        << "\t" << rr << "\t\t\t\t\t\t\t\t\t\t"
        << trkId << "\t" << stat << "\t" << cls << "\t"
        << x << "\t" << y << "\t" << z << "\t"
        << vx << "\t" << vy << "\t" << vz << "\t\t\t\t\t"
        << qual << "\t" << hits << "\t" << miss << "\t" << age;
-    writeCombinedLine("sender", ts, pl.str());
+    writeCombinedLine("sender", ts, pl.data(), pl.size());
 }
 
 bool BinaryLogger::readHeader(std::ifstream& in, LogRecordHeader& hdr) {
@@ -377,22 +863,24 @@ bool BinaryLogger::resyncToNextRecord(std::ifstream& in) {
     return false;
 }
 
-std::string BinaryLogger::getLogPath() const { return logPath_; }
+std::string BinaryLogger::getLogPath() const {
+    std::lock_guard<std::mutex> lock(pathMutex_);
+    return logPath_;
+}
 
 // ---------------------------------------------------------------------------
 // ConsoleLogger
 // ---------------------------------------------------------------------------
 ConsoleLogger& ConsoleLogger::instance() {
-    static ConsoleLogger inst;
-    return inst;
+    // Never destroyed, so objects torn down during exit can still log.
+    static ConsoleLogger* inst = new ConsoleLogger();
+    return *inst;
 }
 
-void ConsoleLogger::setLevel(Level lvl) { level_ = lvl; }
-
-void ConsoleLogger::log(Level lvl, const char* module, const char* fmt, va_list args) {
-    if (lvl > level_) return;
-    std::lock_guard<std::mutex> lock(mutex_);
+void ConsoleLogger::setLevel(Level lvl) { level_.store(lvl, std::memory_order_relaxed); }
 
+size_t ConsoleLogger::format(char* buf, size_t size, Level lvl, const char* module,
+                             const char* fmt, va_list args) {
     auto now = std::chrono::system_clock::now();
     auto tt  = std::chrono::system_clock::to_time_t(now);
     auto ms  = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -405,13 +893,138 @@ void ConsoleLogger::log(Level lvl, const char* module, const char* fmt, va_list
 #endif
 
     static const char* levelNames[] = {"ERROR", "WARN ", "INFO ", "DEBUG", "TRACE"};
-    char timeBuf[32];
-    std::snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d:%02d.%03d",
-                  tm.tm_hour, tm.tm_min, tm.tm_sec, static_cast<int>(ms));
-    char msgBuf[2048];
-    std::vsnprintf(msgBuf, sizeof(msgBuf), fmt, args);
-    std::fprintf(stderr, "[%s] [%s] [%-16s] %s\n",
-                 timeBuf, levelNames[static_cast<int>(lvl)], module, msgBuf);
+    int n = std::snprintf(buf, size, "[%02d:%02d:%02d.%03d] [%s] [%-16s] ",
+                          tm.tm_hour, tm.tm_min, tm.tm_sec, static_cast<int>(ms),
+                          levelNames[static_cast<int>(lvl)], module);
+    size_t len = std::min(static_cast<size_t>(std::max(n, 0)), size - 2);
+    n = std::vsnprintf(buf + len, size - len - 1, fmt, args);
+    len = std::min(len + static_cast<size_t>(std::max(n, 0)), size - 2);
+    buf[len++] = '\n';
+    buf[len]   = '\0';
+    return len;
+}
+
+size_t ConsoleLogger::formatLine(char* buf, size_t size, Level lvl, const char* module,
+                                 const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    const size_t n = format(buf, size, lvl, module, fmt, args);
+    va_end(args);
+    return n;
+}
+
+void ConsoleLogger::log(Level lvl, const char* module, const char* fmt, va_list args) {
+    if (static_cast<int>(lvl) > level_.load(std::memory_order_relaxed)) return;
+    // A full ring drops INFO and below; errors and warnings are written
+    // synchronously instead, possibly ahead of queued lines.
+    if (async_.load(std::memory_order_acquire) && (enqueue(lvl, module, fmt, args) || lvl > WARN))
+        return;
+
+    char line[2048];
+    const size_t n = format(line, sizeof(line), lvl, module, fmt, args);
+    CUAS_PROFILE_LOCK(mutex_, "console mutex_ wait");
+    std::lock_guard<std::mutex> lock(mutex_, std::adopt_lock);
+    std::fwrite(line, 1, n, stderr);
+}
+
+bool ConsoleLogger::enqueue(Level lvl, const char* module, const char* fmt, va_list args) {
+    uint64_t pos = head_.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+        slot = &slots_[pos & (NUM_SLOTS - 1)];
+        const uint64_t seq = slot->seq.load(std::memory_order_acquire);
+        const int64_t  diff = static_cast<int64_t>(seq - pos);
+        if (diff == 0) {
+            if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            if (lvl > WARN) dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;   // full
+        } else {
+            pos = head_.load(std::memory_order_relaxed);
+        }
+    }
+    slot->len = static_cast<uint32_t>(format(slot->text, sizeof(slot->text), lvl, module, fmt, args));
+    slot->seq.store(pos + 1, std::memory_order_release);
+    // A burst would fill the ring long before the writer's next poll: wake
+    // it every half ring.  notify_one takes no lock.
+    if ((pos & (NUM_SLOTS / 2 - 1)) == 0) wake_.notify_one();
+    return true;
+}
+
+size_t ConsoleLogger::drain(std::string& out) {
+    size_t lines = 0;
+    for (;;) {
+        Slot& slot = slots_[tail_ & (NUM_SLOTS - 1)];
+        if (slot.seq.load(std::memory_order_acquire) != tail_ + 1) break;
+        out.append(slot.text, slot.len);
+        slot.seq.store(tail_ + NUM_SLOTS, std::memory_order_release);
+        ++tail_;
+        ++lines;
+    }
+    const uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped != droppedReported_) {
+        char note[160];
+        out.append(note, formatLine(note, sizeof(note), WARN, "Console",
+                                    "%lu log lines dropped (ring full)",
+                                    static_cast<unsigned long>(dropped - droppedReported_)));
+        droppedReported_ = dropped;
+    }
+    return lines;
+}
+
+void ConsoleLogger::writerLoop() {
+    CUAS_PROFILE_THREAD("console log");
+    std::string out;
+    out.reserve(64 * 1024);
+    for (;;) {
+        out.clear();
+        drain(out);
+        if (!out.empty()) {
+            CUAS_PROFILE_ZONE("console write");
+            CUAS_PROFILE_LOCK(mutex_, "console mutex_ wait");
+            std::lock_guard<std::mutex> lock(mutex_, std::adopt_lock);
+            std::fwrite(out.data(), 1, out.size(), stderr);
+            continue;
+        }
+        // Producers never signal (that would take a lock); poll instead.
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        if (stop_) return;
+        wake_.wait_for(lock, std::chrono::milliseconds(20));
+    }
+}
+
+void ConsoleLogger::setAsync(bool on) {
+    if (on == async_.load()) return;
+    if (on) {
+        if (!slots_) {
+            slots_.reset(new Slot[NUM_SLOTS]);
+            for (size_t i = 0; i < NUM_SLOTS; ++i)
+                slots_[i].seq.store(i, std::memory_order_relaxed);
+            // Flushes whatever is queued when the process exits normally.
+            std::atexit([] { ConsoleLogger::instance().setAsync(false); });
+        }
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            stop_ = false;
+        }
+        writer_ = std::thread([this] { writerLoop(); });
+        async_.store(true, std::memory_order_release);
+        return;
+    }
+
+    async_.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        stop_ = true;
+    }
+    wake_.notify_one();
+    if (writer_.joinable()) writer_.join();
+    // Lines published by producers that saw async_ just before it cleared.
+    std::string out;
+    drain(out);
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::fwrite(out.data(), 1, out.size(), stderr);
+    std::fflush(stderr);
 }
 
 void ConsoleLogger::error(const char* module, const char* fmt, ...) {
@@ -0,0 +1,143 @@
+#include "common/lz4_block.h"
+#include <cstring>
+
+namespace cuas {
+
+namespace {
+
+constexpr size_t MIN_MATCH     = 4;
+constexpr size_t LAST_LITERALS = 5;    // a block always ends in literals
+constexpr size_t MF_LIMIT      = 12;   // no match starts this close to the end
+constexpr size_t MAX_OFFSET    = 65535;
+constexpr int    HASH_LOG      = 14;
+
+uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+uint32_t hash4(uint32_t v) {
+    return (v * 2654435761u) >> (32 - HASH_LOG);
+}
+
+uint8_t* putLength(uint8_t* op, size_t len) {
+    for (; len >= 255; len -= 255) *op++ = 255;
+    *op++ = static_cast<uint8_t>(len);
+    return op;
+}
+
+uint8_t* putLiterals(uint8_t* op, uint8_t* token, const uint8_t* lit, size_t n) {
+    if (n >= 15) {
+        *token = 15 << 4;
+        op = putLength(op, n - 15);
+    } else {
+        *token = static_cast<uint8_t>(n << 4);
+    }
+    std::memcpy(op, lit, n);
+    return op + n;
+}
+
+} // namespace
+
+size_t lz4Compress(const uint8_t* src, size_t n, uint8_t* dst) {
+    uint8_t*       op     = dst;
+    const uint8_t* anchor = src;
+    const uint8_t* end    = src + n;
+
+    if (n > MF_LIMIT) {
+        const uint8_t* mfLimit    = end - MF_LIMIT;
+        const uint8_t* matchLimit = end - LAST_LITERALS;
+        uint32_t table[1u << HASH_LOG] = {};   // position of the last 4-byte sequence seen
+
+        const uint8_t* ip = src;
+        while (ip < mfLimit) {
+            const uint32_t seq = read32(ip);
+            const uint32_t h   = hash4(seq);
+            const uint8_t* ref = src + table[h];
+            table[h] = static_cast<uint32_t>(ip - src);
+            if (ref >= ip || static_cast<size_t>(ip - ref) > MAX_OFFSET || read32(ref) != seq) {
+                // Step faster through incompressible runs.
+                ip += 1 + (static_cast<size_t>(ip - anchor) >> 6);
+                continue;
+            }
+
+            while (ip > anchor && ref > src && ip[-1] == ref[-1]) { --ip; --ref; }
+            const uint8_t* p = ip + MIN_MATCH;
+            const uint8_t* q = ref + MIN_MATCH;
+            while (p < matchLimit && *p == *q) { ++p; ++q; }
+
+            uint8_t* token = op++;
+            op = putLiterals(op, token, anchor, static_cast<size_t>(ip - anchor));
+            const size_t offset = static_cast<size_t>(ip - ref);
+            *op++ = static_cast<uint8_t>(offset);
+            *op++ = static_cast<uint8_t>(offset >> 8);
+            const size_t matchLen = static_cast<size_t>(p - ip) - MIN_MATCH;
+            if (matchLen >= 15) {
+                *token |= 15;
+                op = putLength(op, matchLen - 15);
+            } else {
+                *token |= static_cast<uint8_t>(matchLen);
+            }
+
+            ip = anchor = p;
+            if (ip < mfLimit)
+                table[hash4(read32(ip - 2))] = static_cast<uint32_t>(ip - 2 - src);
+        }
+    }
+
+    uint8_t* token = op++;
+    op = putLiterals(op, token, anchor, static_cast<size_t>(end - anchor));
+    return static_cast<size_t>(op - dst);
+}
+
+bool lz4Decompress(const uint8_t* src, size_t n, uint8_t* dst, size_t outBytes) {
+    const uint8_t* ip   = src;
+    const uint8_t* iend = src + n;
+    uint8_t*       op   = dst;
+    uint8_t*       oend = dst + outBytes;
+
+    auto length = [&](size_t& len) {
+        uint8_t b;
+        do {
+            if (ip >= iend) return false;
+            b = *ip++;
+            len += b;
+        } while (b == 255);
+        return true;
+    };
+
+    while (ip < iend) {
+        const uint8_t token = *ip++;
+
+        size_t lit = token >> 4;
+        if (lit == 15 && !length(lit)) return false;
+        if (lit > static_cast<size_t>(iend - ip) || lit > static_cast<size_t>(oend - op))
+            return false;
+        std::memcpy(op, ip, lit);
+        op += lit;
+        ip += lit;
+        if (ip == iend) break;                  // last sequence: literals only
+
+        if (iend - ip < 2) return false;
+        const size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) return false;
+
+        size_t len = token & 15;
+        if (len == 15 && !length(len)) return false;
+        len += MIN_MATCH;
+        if (len > static_cast<size_t>(oend - op)) return false;
+
+        const uint8_t* m = op - offset;
+        if (offset >= len) {
+            std::memcpy(op, m, len);
+        } else {
+            for (size_t i = 0; i < len; ++i) op[i] = m[i];   // overlapping run
+        }
+        op += len;
+    }
+    return op == oend;
+}
+
+} // namespace cuas
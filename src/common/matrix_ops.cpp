@@ -0,0 +1,125 @@
+#include "common/matrix_ops.h"
+
+// ---------------------------------------------------------------------------
+// Dense 9x9 kernels, compiled once per ISA (CUAS_MATH_KERNEL).
+// ---------------------------------------------------------------------------
+// On x86-64 Linux each kernel is built for AVX-512, AVX2 and
+// baseline x86-64, and the loader picks the widest one the CPU supports
+// (ifunc).  Elsewhere a single, auto-vectorised build is used; on AArch64
+// that is NEON, which is part of the baseline ISA.  The loops put the
+// contiguous column index innermost with no data-dependent branches, so
+// every clone computes the same sums in the same order; with FMA contraction
+// disabled for this file (CMakeLists.txt) the ISAs agree bit for bit.
+
+namespace cuas { namespace mat {
+
+CUAS_MATH_KERNEL
+StateMatrix multiply(const StateMatrix& A, const StateMatrix& B) {
+    StateMatrix R;
+    for (int i = 0; i < STATE_DIM; ++i) {
+        double row[STATE_DIM] = {};
+        for (int k = 0; k < STATE_DIM; ++k) {
+            double a = A[i][k];
+            for (int j = 0; j < STATE_DIM; ++j)
+                row[j] += a * B[k][j];
+        }
+        for (int j = 0; j < STATE_DIM; ++j) R[i][j] = row[j];
+    }
+    return R;
+}
+
+CUAS_MATH_KERNEL
+StateVector multiplyMV(const StateMatrix& A, const StateVector& v) {
+    StateVector r;
+    for (int i = 0; i < STATE_DIM; ++i) {
+        double s = 0.0;
+        for (int j = 0; j < STATE_DIM; ++j)
+            s += A[i][j] * v[j];
+        r[i] = s;
+    }
+    return r;
+}
+
+CUAS_MATH_KERNEL
+StateMatrix outerProduct(const StateVector& a, const StateVector& b) {
+    StateMatrix R;
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = 0; j < STATE_DIM; ++j)
+            R[i][j] = a[i] * b[j];
+    return R;
+}
+
+CUAS_MATH_KERNEL
+SymStateMatrix krkt(const StateMeasMatrix& K, const MeasMatrix& R) {
+    // Step 1: KR = K * R  (STATE_DIM x MEAS_DIM)
+    StateMeasMatrix KR;
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = 0; j < MEAS_DIM; ++j) {
+            double s = 0.0;
+            for (int k = 0; k < MEAS_DIM; ++k) s += K[i][k] * R[k][j];
+            KR[i][j] = s;
+        }
+    // Step 2: (KR) * K^T, upper triangle only; K^T[k][j] = K[j][k]
+    SymStateMatrix result;
+    for (int i = 0, e = 0; i < STATE_DIM; ++i)
+        for (int j = i; j < STATE_DIM; ++j, ++e) {
+            double s = 0.0;
+            for (int k = 0; k < MEAS_DIM; ++k) s += KR[i][k] * K[j][k];
+            result.v[e] = s;
+        }
+    return result;
+}
+
+CUAS_MATH_KERNEL
+void accumulateMoment(SymStateMatrix& acc, double w, const SymStateMatrix& P,
+                      const StateVector& d) {
+    for (int i = 0, e = 0; i < STATE_DIM; ++i) {
+        double di = d[i];
+        for (int j = i; j < STATE_DIM; ++j, ++e)
+            acc.v[e] += (P.v[e] + di * d[j]) * w;
+    }
+}
+
+// Column by column from the last: D_j and column j of U only depend on the
+// columns to their right.
+bool udFactor(const SymStateMatrix& P, UDFactors& f) {
+    for (int j = STATE_DIM - 1; j >= 0; --j) {
+        double d = P(j, j);
+        for (int k = j + 1; k < STATE_DIM; ++k) d -= f.D[k] * f.u(j, k) * f.u(j, k);
+        if (!(d > 0.0)) return false;
+        f.D[j] = d;
+        f.u(j, j) = 1.0;
+        for (int i = 0; i < j; ++i) {
+            double s = P(i, j);
+            for (int k = j + 1; k < STATE_DIM; ++k) s -= f.D[k] * f.u(i, k) * f.u(j, k);
+            f.u(i, j) = s / d;
+        }
+    }
+    return true;
+}
+
+SymStateMatrix udCompose(const UDFactors& f) {
+    SymStateMatrix P;
+    for (int i = 0, e = 0; i < STATE_DIM; ++i)
+        for (int j = i; j < STATE_DIM; ++j, ++e) {
+            double s = 0.0;
+            for (int k = j; k < STATE_DIM; ++k) s += f.u(i, k) * f.D[k] * f.u(j, k);
+            P.v[e] = s;
+        }
+    return P;
+}
+
+const char* kernelIsa() {
+#if CUAS_MATH_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return "avx512f";
+    if (__builtin_cpu_supports("avx2"))    return "avx2";
+    return "x86-64";
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    return "neon";
+#else
+    return "generic";
+#endif
+}
+
+}} // namespace cuas::mat
@@ -0,0 +1,122 @@
+#include "common/realtime.h"
+#include "common/logger.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <sched.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+    #ifdef __GLIBC__
+        #include <malloc.h>
+    #endif
+#endif
+
+namespace cuas {
+
+bool setThreadAffinity(std::thread& t, int cpu, const std::string& name) {
+#if defined(_WIN32)
+    if (cpu < 0 || cpu >= 64) {
+        LOG_WARN("Realtime", "%s: CPU %d out of range", name.c_str(), cpu);
+        return false;
+    }
+    if (SetThreadAffinityMask(t.native_handle(), DWORD_PTR(1) << cpu) == 0) {
+        LOG_WARN("Realtime", "%s: SetThreadAffinityMask(CPU %d) failed (error %lu)",
+                 name.c_str(), cpu, static_cast<unsigned long>(GetLastError()));
+        return false;
+    }
+    return true;
+#elif defined(__linux__)
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        LOG_WARN("Realtime", "%s: CPU %d out of range", name.c_str(), cpu);
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    int rc = pthread_setaffinity_np(t.native_handle(), sizeof(set), &set);
+    if (rc != 0) {
+        LOG_WARN("Realtime", "%s: pinning to CPU %d failed: %s",
+                 name.c_str(), cpu, std::strerror(rc));
+        return false;
+    }
+    return true;
+#else
+    (void)t;
+    LOG_WARN("Realtime", "%s: CPU affinity not supported on this platform (CPU %d)",
+             name.c_str(), cpu);
+    return false;
+#endif
+}
+
+bool setThreadRealtime(std::thread& t, int priority, const std::string& name) {
+#ifdef _WIN32
+    (void)priority;
+    if (!SetThreadPriority(t.native_handle(), THREAD_PRIORITY_TIME_CRITICAL)) {
+        LOG_WARN("Realtime", "%s: SetThreadPriority failed (error %lu)",
+                 name.c_str(), static_cast<unsigned long>(GetLastError()));
+        return false;
+    }
+    return true;
+#else
+    sched_param param{};
+    param.sched_priority = priority;
+    int rc = pthread_setschedparam(t.native_handle(), SCHED_FIFO, &param);
+    if (rc != 0) {
+        LOG_WARN("Realtime", "%s: SCHED_FIFO priority %d failed: %s",
+                 name.c_str(), priority, std::strerror(rc));
+        return false;
+    }
+    return true;
+#endif
+}
+
+bool lockProcessMemory(size_t prefaultHeapBytes) {
+#ifdef _WIN32
+    (void)prefaultHeapBytes;
+    LOG_WARN("Realtime", "Memory locking not supported on this platform");
+    return false;
+#else
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        LOG_WARN("Realtime", "mlockall failed: %s (check RLIMIT_MEMLOCK / CAP_IPC_LOCK)",
+                 std::strerror(errno));
+        return false;
+    }
+
+#ifdef __GLIBC__
+    // Keep freed memory in the arena so the pre-faulted pages are reused.
+    mallopt(M_TRIM_THRESHOLD, -1);
+    mallopt(M_MMAP_MAX, 0);
+#endif
+    if (prefaultHeapBytes > 0) {
+        // Write one byte per page through a volatile pointer so the stores
+        // cannot be optimised away; freeing returns the pages to the arena
+        // (not the OS, per the mallopt calls above).
+        volatile char* touch = static_cast<volatile char*>(std::malloc(prefaultHeapBytes));
+        if (!touch) {
+            LOG_WARN("Realtime", "Heap prefault: malloc(%zu) failed", prefaultHeapBytes);
+            return true;
+        }
+        const long   pageSize = sysconf(_SC_PAGESIZE);
+        const size_t step     = pageSize > 0 ? static_cast<size_t>(pageSize) : 4096;
+        for (size_t i = 0; i < prefaultHeapBytes; i += step) touch[i] = 0;
+        touch[prefaultHeapBytes - 1] = 0;
+        std::free(const_cast<char*>(touch));
+    }
+    return true;
+#endif
+}
+
+uint64_t cpuMask(const std::vector<int>& cpus) {
+    uint64_t mask = 0;
+    for (int cpu : cpus)
+        if (cpu >= 0 && cpu < 64) mask |= uint64_t(1) << cpu;
+    return mask;
+}
+
+} // namespace cuas
@@ -1,5 +1,7 @@
 #include "common/udp_socket.h"
 #include "common/logger.h"
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
 
 #ifdef _WIN32
@@ -92,6 +94,25 @@ bool UdpSocket::setBufferSize(int recvSize, int sendSize) {
     return true;
 }
 
+bool UdpSocket::setReusePort(bool on) {
+    if (sock_ == INVALID_SOCK) return false;
+#ifdef SO_REUSEPORT
+    int v = on ? 1 : 0;
+    return setsockopt(sock_, SOL_SOCKET, SO_REUSEPORT,
+                      reinterpret_cast<const char*>(&v), sizeof(v)) == 0;
+#else
+    return !on;
+#endif
+}
+
+int UdpSocket::receiveBufferSize() const {
+    if (sock_ == INVALID_SOCK) return 0;
+    int size = 0;
+    socklen_t len = sizeof(size);
+    getsockopt(sock_, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char*>(&size), &len);
+    return size;
+}
+
 int UdpSocket::receive(uint8_t* buffer, int maxLen) {
     if (sock_ == INVALID_SOCK) return -1;
     int n = ::recvfrom(sock_, reinterpret_cast<char*>(buffer), maxLen, 0,
@@ -115,6 +136,45 @@ int UdpSocket::receive(uint8_t* buffer, int maxLen,
     return n;
 }
 
+int UdpSocket::receiveBatch(uint8_t* buffers, int stride, int count, int* lengths) {
+    if (sock_ == INVALID_SOCK) return -1;
+    count = std::min(count, MAX_BATCH);
+    if (count <= 0) return 0;
+#ifdef __linux__
+    mmsghdr msgs[MAX_BATCH];
+    iovec   iov[MAX_BATCH];
+    std::memset(msgs, 0, sizeof(mmsghdr) * count);
+    for (int i = 0; i < count; ++i) {
+        iov[i].iov_base = buffers + static_cast<size_t>(i) * stride;
+        iov[i].iov_len  = static_cast<size_t>(stride);
+        msgs[i].msg_hdr.msg_iov    = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    int n = ::recvmmsg(sock_, msgs, static_cast<unsigned>(count), MSG_WAITFORONE, nullptr);
+    if (n < 0) return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+    for (int i = 0; i < n; ++i)
+        lengths[i] = (msgs[i].msg_hdr.msg_flags & MSG_TRUNC)
+                         ? -1 : static_cast<int>(msgs[i].msg_len);
+    return n;
+#else
+    int n = 0;
+    for (; n < count; ++n) {
+        int flags = 0;
+    #ifdef MSG_DONTWAIT
+        if (n > 0) flags = MSG_DONTWAIT;
+    #endif
+        int len = ::recvfrom(sock_, reinterpret_cast<char*>(buffers + static_cast<size_t>(n) * stride),
+                             stride, flags, nullptr, nullptr);
+        if (len < 0) break;
+        lengths[n] = len;
+    #ifndef MSG_DONTWAIT
+        break;      // no non-blocking peek: one datagram per call
+    #endif
+    }
+    return n;
+#endif
+}
+
 bool UdpSocket::send(const uint8_t* data, int len) {
     if (sock_ == INVALID_SOCK || !destSet_) return false;
     int sent = ::sendto(sock_, reinterpret_cast<const char*>(data), len, 0,
@@ -0,0 +1,83 @@
+#include "common/worker_pool.h"
+#include "common/profiling.h"
+
+#include <algorithm>
+
+namespace cuas {
+
+WorkerPool::WorkerPool(int numThreads) {
+    if (numThreads <= 0)
+        numThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    workers_.reserve(static_cast<size_t>(numThreads - 1));
+    for (int i = 1; i < numThreads; ++i)
+        workers_.emplace_back(&WorkerPool::workerLoop, this);
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    startCV_.notify_all();
+    for (auto& t : workers_)
+        if (t.joinable()) t.join();
+}
+
+void WorkerPool::parallelFor(size_t n, size_t chunk, RangeFn fn) {
+    if (n == 0) return;
+    if (chunk == 0) chunk = 1;
+    if (workers_.empty() || n <= chunk) {
+        fn(0, n);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fn_    = &fn;
+        n_     = n;
+        chunk_ = chunk;
+        next_.store(0, std::memory_order_relaxed);
+        busy_  = workers_.size();
+        ++generation_;
+    }
+    startCV_.notify_all();
+
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCV_.wait(lock, [this] { return busy_ == 0; });
+    fn_ = nullptr;
+}
+
+void WorkerPool::runChunks() {
+    CUAS_PROFILE_ZONE("parallelFor chunks");
+    for (;;) {
+        size_t begin = next_.fetch_add(chunk_, std::memory_order_relaxed);
+        if (begin >= n_) break;
+        (*fn_)(begin, std::min(begin + chunk_, n_));
+    }
+}
+
+void WorkerPool::workerLoop() {
+    CUAS_PROFILE_THREAD("worker");
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            startCV_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+            if (stopping_) return;
+            seen = generation_;
+        }
+
+        runChunks();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busy_ > 0) continue;
+        }
+        doneCV_.notify_one();
+    }
+}
+
+} // namespace cuas
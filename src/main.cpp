@@ -16,12 +16,31 @@
 #endif
 
 static std::atomic<bool> g_running{true};
+static std::atomic<bool> g_reload{false};
 
 void signalHandler(int sig) {
     (void)sig;
     g_running.store(false);
 }
 
+#ifndef _WIN32
+void reloadHandler(int sig) {
+    (void)sig;
+    g_reload.store(true);
+}
+#endif
+
+// Re-reads the config file on the main thread, off the data path; the lanes
+// pick the new settings up between dwells.
+static void reloadConfig(cuas::TrackerPipeline& pipeline, const std::string& configPath) {
+    LOG_INFO("Main", "Reloading configuration from: %s", configPath.c_str());
+    try {
+        pipeline.reloadConfig(cuas::loadConfig(configPath));
+    } catch (const std::exception& e) {
+        LOG_ERROR("Main", "Configuration reload failed, keeping current settings: %s", e.what());
+    }
+}
+
 static std::string getExecutableDir() {
 #ifdef _WIN32
     char buf[MAX_PATH];
@@ -95,6 +114,7 @@ int main(int argc, char* argv[]) {
     std::signal(SIGINT, signalHandler);
 #ifndef _WIN32
     std::signal(SIGTERM, signalHandler);
+    std::signal(SIGHUP,  reloadHandler);
 #endif
 
     try {
@@ -103,9 +123,19 @@ int main(int argc, char* argv[]) {
         configPath = resolveConfigPath(configPath);
         LOG_INFO("Main", "Loading configuration from: %s", configPath.c_str());
         cuas::TrackerConfig config = cuas::loadConfig(configPath);
+        const std::string problem = cuas::validateConfig(config);
+        if (!problem.empty()) {
+            LOG_ERROR("Main", "Invalid configuration: %s", problem.c_str());
+            return 1;
+        }
 
         cuas::ConsoleLogger::instance().setLevel(
             static_cast<cuas::ConsoleLogger::Level>(config.system.logLevel));
+        if (config.system.logLevel > CUAS_LOG_COMPILE_LEVEL)
+            LOG_WARN("Main", "system.logLevel %d is above this build's CUAS_LOG_LEVEL (%d); "
+                     "those messages were compiled out", config.system.logLevel,
+                     CUAS_LOG_COMPILE_LEVEL);
+        cuas::ConsoleLogger::instance().setAsync(config.system.consoleAsync);
 
         cuas::TrackerPipeline pipeline(config);
 
@@ -114,10 +144,11 @@ int main(int argc, char* argv[]) {
             return 1;
         }
 
-        LOG_INFO("Main", "Tracker running. Press Ctrl+C to stop.");
+        LOG_INFO("Main", "Tracker running. Press Ctrl+C to stop, send SIGHUP to reload the configuration.");
 
         while (g_running.load()) {
             std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            if (g_reload.exchange(false)) reloadConfig(pipeline, configPath);
         }
 
         LOG_INFO("Main", "Shutting down...");
@@ -0,0 +1,39 @@
+#include "pipeline/load_shed_controller.h"
+#include <algorithm>
+
+namespace cuas {
+
+LoadShedController::LoadShedController(const LoadShedConfig& cfg, int cyclePeriodMs)
+    : config_(cfg), periodMs_(std::max(1, cyclePeriodMs)) {
+    config_.maxLevel           = std::max(0, std::min(config_.maxLevel, 4));
+    config_.degradeAfterDwells = std::max(1, config_.degradeAfterDwells);
+    config_.recoverAfterDwells = std::max(1, config_.recoverAfterDwells);
+}
+
+bool LoadShedController::update(double cycleMs, uint32_t queueDepth) {
+    bool overloaded = cycleMs > config_.overrunRatio * periodMs_ ||
+                      queueDepth >= static_cast<uint32_t>(std::max(1, config_.queueDepthHigh));
+    bool healthy    = cycleMs < config_.recoverRatio * periodMs_ && queueDepth == 0;
+
+    if (overloaded) {
+        healthyStreak_ = 0;
+        if (++overloadStreak_ >= config_.degradeAfterDwells && level_ < config_.maxLevel) {
+            ++level_;
+            overloadStreak_ = 0;
+            return true;
+        }
+    } else if (healthy) {
+        overloadStreak_ = 0;
+        if (++healthyStreak_ >= config_.recoverAfterDwells && level_ > 0) {
+            --level_;
+            healthyStreak_ = 0;
+            return true;
+        }
+    } else {
+        overloadStreak_ = 0;
+        healthyStreak_  = 0;
+    }
+    return false;
+}
+
+} // namespace cuas
@@ -0,0 +1,120 @@
+#include "pipeline/sector_handover.h"
+#include "common/constants.h"
+#include "common/logger.h"
+
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+
+#include <algorithm>
+#include <string>
+
+namespace cuas {
+
+static_assert(CounterUAS::HANDOVER_STATE_DIM  == STATE_DIM,      "IDL HANDOVER_STATE_DIM mismatch");
+static_assert(CounterUAS::HANDOVER_SYM_DIM    == SYM_DIM,        "IDL HANDOVER_SYM_DIM mismatch");
+static_assert(CounterUAS::HANDOVER_NUM_MODELS == IMM_NUM_MODELS, "IDL HANDOVER_NUM_MODELS mismatch");
+static_assert(CounterUAS::HANDOVER_MODEL_STATES == IMM_NUM_MODELS * STATE_DIM,
+              "IDL HANDOVER_MODEL_STATES mismatch");
+static_assert(CounterUAS::HANDOVER_MODEL_COVARIANCES == IMM_NUM_MODELS * SYM_DIM,
+              "IDL HANDOVER_MODEL_COVARIANCES mismatch");
+
+namespace {
+
+void toIDL(const CheckpointTrack& c, CounterUAS::TrackHandoverMessage& m) {
+    m.trackId(c.id);
+    m.status(static_cast<CounterUAS::TrackStatus>(c.status));
+    m.classification(static_cast<CounterUAS::TrackClassification>(c.classification));
+    m.hitCount(c.hitCount);
+    m.consecutiveMisses(c.consecutiveMisses);
+    m.missCount(c.missCount);
+    m.age(c.age);
+    m.reserved(0);
+    m.initiationTime(c.initiationTime);
+    m.lastUpdateTime(c.lastUpdateTime);
+    m.quality(c.quality);
+    std::copy(c.state.begin(), c.state.end(), m.state().begin());
+    std::copy(c.covariance.v.begin(), c.covariance.v.end(), m.covariance().begin());
+    std::copy(c.imm.modeProbabilities.begin(), c.imm.modeProbabilities.end(),
+              m.modeProbabilities().begin());
+    for (int k = 0; k < IMM_NUM_MODELS; ++k) {
+        std::copy(c.imm.modelStates[k].begin(), c.imm.modelStates[k].end(),
+                  m.modelStates().begin() + k * STATE_DIM);
+        std::copy(c.imm.modelCovariances[k].v.begin(), c.imm.modelCovariances[k].v.end(),
+                  m.modelCovariances().begin() + k * SYM_DIM);
+    }
+}
+
+void toInternal(const CounterUAS::TrackHandoverMessage& m, CheckpointTrack& c) {
+    c.id                = m.trackId();
+    c.status            = static_cast<uint32_t>(m.status());
+    c.classification    = static_cast<uint32_t>(m.classification());
+    c.hitCount          = m.hitCount();
+    c.consecutiveMisses = m.consecutiveMisses();
+    c.missCount         = m.missCount();
+    c.age               = m.age();
+    c.initiationTime    = m.initiationTime();
+    c.lastUpdateTime    = m.lastUpdateTime();
+    c.stateTime         = m.timestamp();
+    c.quality           = m.quality();
+    std::copy(m.state().begin(), m.state().end(), c.state.begin());
+    std::copy(m.covariance().begin(), m.covariance().end(), c.covariance.v.begin());
+    std::copy(m.modeProbabilities().begin(), m.modeProbabilities().end(),
+              c.imm.modeProbabilities.begin());
+    for (int k = 0; k < IMM_NUM_MODELS; ++k) {
+        std::copy_n(m.modelStates().begin() + k * STATE_DIM, STATE_DIM,
+                    c.imm.modelStates[k].begin());
+        std::copy_n(m.modelCovariances().begin() + k * SYM_DIM, SYM_DIM,
+                    c.imm.modelCovariances[k].v.begin());
+    }
+    c.modeProbs            = c.imm.modeProbabilities;
+    c.imm.mergedState      = c.state;
+    c.imm.mergedCovariance = c.covariance;
+}
+
+} // namespace
+
+SectorHandover::SectorHandover(CuasDdsParticipant& participant, const DistributedConfig& cfg,
+                               Callback onTrack)
+    : nodeId_(cfg.nodeId), onTrack_(std::move(onTrack)) {
+    writer_ = participant.makeWriter<CounterUAS::TrackHandoverMessage>(TOPIC_TRACK_HANDOVER);
+
+    bool filtered = false;
+    participant.makeFilteredReader<CounterUAS::TrackHandoverMessage>(
+        TOPIC_TRACK_HANDOVER, cfg.contentFilter ? "toNode = %0" : "",
+        {std::to_string(nodeId_)}, this, &filtered);
+    LOG_INFO("Handover", "Node %u handover on topic '%s'%s", nodeId_, TOPIC_TRACK_HANDOVER,
+             filtered ? " (content filtered)" : "");
+}
+
+void SectorHandover::send(uint32_t sensorId, const TrackManager::Handover& handover) {
+    CounterUAS::TrackHandoverMessage msg;
+    msg.messageId(MSG_ID_TRACK_HANDOVER);
+    msg.fromNode(nodeId_);
+    msg.toNode(handover.toNode);
+    msg.sensorId(sensorId);
+    msg.timestamp(handover.track.stateTime);
+    toIDL(handover.track, msg);
+    if (writer_->write(&msg) != eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK) {
+        LOG_ERROR("Handover", "Track %u to node %u: write failed", handover.track.id,
+                  handover.toNode);
+        return;
+    }
+    sent_.fetch_add(1);
+    LOG_INFO("Handover", "Track %u handed to node %u", handover.track.id, handover.toNode);
+}
+
+void SectorHandover::on_data_available(eprosima::fastdds::dds::DataReader* reader) {
+    eprosima::fastdds::dds::SampleInfo info;
+    while (eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK ==
+           reader->take_next_sample(&in_, &info)) {
+        if (!info.valid_data) continue;
+        if (in_.toNode() != nodeId_ || in_.fromNode() == nodeId_) continue;
+
+        toInternal(in_, track_);
+        received_.fetch_add(1);
+        LOG_DEBUG("Handover", "Track %u from node %u (sensor %u)",
+                  in_.trackId(), in_.fromNode(), in_.sensorId());
+        if (onTrack_) onTrack_(in_.sensorId(), track_);
+    }
+}
+
+} // namespace cuas
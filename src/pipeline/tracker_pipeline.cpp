@@ -1,10 +1,18 @@
 #include "pipeline/tracker_pipeline.h"
 #include "common/constants.h"
 #include "common/logger.h"
+#include "common/profiling.h"
+#include "common/realtime.h"
+#include <algorithm>
 #include <chrono>
 
 namespace cuas {
 
+static double elapsedMs(std::chrono::high_resolution_clock::time_point since) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::high_resolution_clock::now() - since).count() / 1000.0;
+}
+
 TrackerPipeline::TrackerPipeline(const TrackerConfig& cfg) : config_(cfg) {}
 
 TrackerPipeline::~TrackerPipeline() {
@@ -14,123 +22,643 @@ TrackerPipeline::~TrackerPipeline() {
 bool TrackerPipeline::start() {
     LOG_INFO("Pipeline", "Starting tracker pipeline...");
 
+    // Lock memory first so everything allocated below, thread stacks
+    // included, is resident before the first dwell arrives.
+    const RealtimeConfig& rt = config_.system.realtime;
+    if (rt.lockMemory &&
+        lockProcessMemory(static_cast<size_t>(std::max(0, rt.prefaultHeapMB)) << 20))
+        LOG_INFO("Pipeline", "Process memory locked (%d MB heap pre-faulted)",
+                 rt.prefaultHeapMB);
+
+    // One lane per configured radar face; no list means a single lane that
+    // takes every dwell, as on single-face sites.
+    std::vector<uint32_t> sensorIds;
+    for (uint32_t id : config_.pipeline.sensorIds) {
+        if (std::find(sensorIds.begin(), sensorIds.end(), id) != sensorIds.end()) {
+            LOG_WARN("Pipeline", "Sensor %u listed twice in pipeline.sensorIds, ignoring", id);
+            continue;
+        }
+        sensorIds.push_back(id);
+    }
+    routeBySensor_ = !sensorIds.empty();
+    if (sensorIds.empty()) sensorIds.push_back(0);
+
     // Shared DDS participant for all topics in this process.
-    participant_  = std::make_unique<CuasDdsParticipant>();
+    for (int cpu : rt.ddsCpus)
+        if (cpu < 0 || cpu >= 64)
+            LOG_WARN("Pipeline", "DDS CPU %d out of range for the affinity mask, ignored", cpu);
+    participant_  = std::make_unique<CuasDdsParticipant>(0, cpuMask(rt.ddsCpus),
+                                                         config_.network.dds);
 
-    trackManager_ = std::make_unique<TrackManager>(config_);
+    timings_      = std::make_unique<StageTimings>();
 
-    sender_       = std::make_unique<TrackSender>(*participant_, config_.display);
+    sender_       = std::make_unique<TrackSender>(*participant_, config_.display,
+                                                   timings_.get(), sensorIds.size());
 
-    // DetectionReceiver subscribes on the DDS thread; it enqueues messages
-    // so the processing loop handles them on the pipeline thread.
-    receiver_     = std::make_unique<DetectionReceiver>(*participant_,
-                                                         TOPIC_SP_DETECTION);
-    receiver_->setCallback([this](const SPDetectionMessage& msg) {
-        onDetectionReceived(msg);
-    });
+    for (uint32_t id : sensorIds) {
+        auto lane = std::make_unique<SensorLane>();
+        lane->sensorId     = id;
+        lane->index        = lanes_.size();
+        lane->trackManager = std::make_unique<TrackManager>(config_, timings_.get(), id);
+        lane->ingest       = std::make_unique<IngestRing<SPDetectionMessage>>(
+                                 static_cast<size_t>(std::max(1, config_.pipeline.ingestQueueCapacity)),
+                                 config_.pipeline.overloadPolicy);
+        lane->lastStatsTime = std::chrono::steady_clock::now();
+        if (config_.pipeline.loadShed.enabled)
+            lane->loadShed = std::make_unique<LoadShedController>(config_.pipeline.loadShed,
+                                                                  config_.system.cyclePeriodMs);
+        lanes_.push_back(std::move(lane));
+    }
+
+    // The ingest backend (DDS listener or raw UDP threads) routes each dwell
+    // to its lane's ring so tracking happens on the lane threads.
+    auto onDwell = [this](SPDetectionMessage& msg) { onDetectionReceived(msg); };
+    if (config_.network.ingest == IngestBackend::Udp) {
+        receiver_ = std::make_unique<UdpDetectionReceiver>(config_.network, onDwell);
+    } else {
+        // A node of a distributed deployment asks DDS for its own faces only.
+        std::vector<uint32_t> filter;
+        if (config_.distributed.enabled && config_.distributed.contentFilter && routeBySensor_)
+            filter = sensorIds;
+        auto dds = std::make_unique<DetectionReceiver>(*participant_, TOPIC_SP_DETECTION, filter);
+        dds->setCallback(onDwell);
+        receiver_ = std::move(dds);
+    }
+
+    if (config_.distributed.enabled)
+        handover_ = std::make_unique<SectorHandover>(
+            *participant_, config_.distributed,
+            [this](uint32_t sensorId, const CheckpointTrack& t) { onHandoverReceived(sensorId, t); });
 
     running_.store(true);
-    processingThread_ = std::thread(&TrackerPipeline::processingLoop, this);
+    for (auto& lane : lanes_) {
+        SensorLane* l = lane.get();
+        if (config_.pipeline.pipelined) {
+            size_t depth = static_cast<size_t>(std::max(1, config_.pipeline.stageQueueDepth));
+            l->clusterQueue     = std::make_unique<StageQueue<DwellWork>>(depth);
+            l->publishQueue     = std::make_unique<StageQueue<DwellWork>>(depth);
+            l->publishThread    = std::thread([this, l] { publishStageLoop(*l); });
+            l->trackThread      = std::thread([this, l] { trackStageLoop(*l); });
+            l->processingThread = std::thread([this, l] { ingestStageLoop(*l); });
+        } else {
+            l->processingThread = std::thread([this, l] { processingLoop(*l); });
+        }
+    }
+    applyThreadPlacement();
 
-    LOG_INFO("Pipeline", "Tracker pipeline started successfully");
+    LOG_INFO("Pipeline", "Tracker pipeline started successfully (%s, %zu sensor lane(s))",
+             config_.pipeline.pipelined ? "pipelined" : "sequential", lanes_.size());
     return true;
 }
 
 void TrackerPipeline::stop() {
     running_.store(false);
-    queueCV_.notify_all();
+    for (auto& lane : lanes_)
+        if (lane->ingest) lane->ingest->close();
 
-    if (processingThread_.joinable()) processingThread_.join();
+    for (auto& lane : lanes_) {
+        if (lane->processingThread.joinable()) lane->processingThread.join();
+
+        // Pipelined mode: close each hand-off after its producer has exited so
+        // downstream stages drain the dwells already in flight, then stop.
+        if (lane->clusterQueue) lane->clusterQueue->close();
+        if (lane->trackThread.joinable()) lane->trackThread.join();
+        if (lane->publishQueue) lane->publishQueue->close();
+        if (lane->publishThread.joinable()) lane->publishThread.join();
+    }
 
     // Destroy DDS entities in reverse order.
+    handover_.reset();
     sender_.reset();
     receiver_.reset();
     participant_.reset();
 
     LOG_INFO("Pipeline", "Tracker pipeline stopped. Total cycles: %lu",
-             static_cast<unsigned long>(cycleCount_));
+             static_cast<unsigned long>(cycleCount_.load()));
     printStats();
 }
 
-void TrackerPipeline::onDetectionReceived(const SPDetectionMessage& msg) {
+void TrackerPipeline::onDetectionReceived(SPDetectionMessage& msg) {
+    // Runs on the ingest thread (one at a time: UdpDetectionReceiver serialises
+    // its receive threads); never takes a lock on the data path.
+    // The dwell is swapped into its lane's ring, not copied.
+    CUAS_PROFILE_ZONE("enqueue");
+    if (!routeBySensor_) {
+        lanes_.front()->ingest->push(msg);
+        return;
+    }
+    for (auto& lane : lanes_) {
+        if (lane->sensorId == msg.sensorId) {
+            lane->ingest->push(msg);
+            return;
+        }
+    }
+    uint64_t n = unroutedDwells_.fetch_add(1) + 1;
+    if (n == 1 || n % 1000 == 0)
+        LOG_WARN("Pipeline", "Dropping dwell %u from unconfigured sensor %u (%lu so far)",
+                 msg.dwellCount, msg.sensorId, static_cast<unsigned long>(n));
+}
+
+void TrackerPipeline::onHandoverReceived(uint32_t sensorId, const CheckpointTrack& track) {
+    // Runs on the DDS thread; lanes_ is fixed once start() returns.
+    SensorLane* target = routeBySensor_ ? nullptr : lanes_.front().get();
+    for (auto& lane : lanes_)
+        if (routeBySensor_ && lane->sensorId == sensorId) target = lane.get();
+    if (!target) {
+        LOG_WARN("Pipeline", "Dropping handover of track %u: sensor %u not tracked here",
+                 track.id, sensorId);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(target->handoverMutex);
+    target->handoverInbox.push_back(track);
+    target->handoverPending.store(true, std::memory_order_release);
+}
+
+void TrackerPipeline::acceptHandovers(SensorLane& lane) {
+    if (!lane.handoverPending.load(std::memory_order_acquire)) return;
+    std::vector<CheckpointTrack> tracks;
     {
-        std::lock_guard<std::mutex> lock(queueMutex_);
-        messageQueue_.push(msg);
+        std::lock_guard<std::mutex> lock(lane.handoverMutex);
+        tracks.swap(lane.handoverInbox);
+        lane.handoverPending.store(false, std::memory_order_relaxed);
     }
-    queueCV_.notify_one();
+    for (const CheckpointTrack& t : tracks)
+        lane.trackManager->acceptHandover(t);
 }
 
-void TrackerPipeline::processingLoop() {
-    LOG_INFO("Pipeline", "Processing loop started");
+void TrackerPipeline::sendHandovers(SensorLane& lane) {
+    if (!handover_) return;
+    for (const TrackManager::Handover& h : lane.trackManager->handovers())
+        handover_->send(lane.sensorId, h);
+}
 
-    while (running_.load()) {
-        SPDetectionMessage msg;
-        {
-            std::unique_lock<std::mutex> lock(queueMutex_);
-            queueCV_.wait_for(lock, std::chrono::milliseconds(config_.system.cyclePeriodMs),
-                              [this] { return !messageQueue_.empty() || !running_.load(); });
+bool TrackerPipeline::reloadConfig(const TrackerConfig& cfg) {
+    std::string problem = validateConfig(cfg);
+    if (!problem.empty()) {
+        LOG_ERROR("Pipeline", "Configuration reload rejected: %s", problem.c_str());
+        return false;
+    }
 
-            if (!running_.load()) break;
-            if (messageQueue_.empty()) continue;
+    // Only the tuning sections change; config_ itself is never written after
+    // start() since the lane threads read it unlocked.
+    TrackerConfig next     = config_;
+    next.preprocessing     = cfg.preprocessing;
+    next.clustering        = cfg.clustering;
+    next.prediction        = cfg.prediction;
+    next.association       = cfg.association;
+    next.trackManagement   = cfg.trackManagement;
+    auto shared = std::make_shared<const TrackerConfig>(std::move(next));
 
-            msg = std::move(messageQueue_.front());
-            messageQueue_.pop();
-        }
+    // A lane that has not picked up the previous reload just takes this one.
+    for (auto& lane : lanes_)
+        std::atomic_store(&lane->pendingConfig, shared);
+    LOG_INFO("Pipeline", "Configuration reload queued for %zu sensor lane(s)", lanes_.size());
+    return true;
+}
+
+std::shared_ptr<const TrackerConfig> TrackerPipeline::takePendingConfig(SensorLane& lane) {
+    if (!std::atomic_load(&lane.pendingConfig)) return nullptr;
+    return std::atomic_exchange(&lane.pendingConfig, std::shared_ptr<const TrackerConfig>());
+}
+
+bool TrackerPipeline::waitForMessage(SensorLane& lane, SPDetectionMessage& msg) {
+    maybePublishStats(lane);
+
+    if (!lane.ingest->waitPop(msg, std::chrono::milliseconds(config_.system.cyclePeriodMs)))
+        return false;
+    msg.dequeuedAt = nowMicros();
+    return running_.load();
+}
+
+void TrackerPipeline::maybePublishStats(SensorLane& lane) {
+    auto now = std::chrono::steady_clock::now();
+    if (now - lane.lastStatsTime < std::chrono::seconds(1)) return;
+    lane.lastStatsTime = now;
+
+    IngestStats s = lane.ingest->stats();
+    if (s.dropped != lane.lastReportedDrops) {
+        LOG_WARN("Pipeline", "Sensor %u ingest overload: %lu dwells dropped in the last second "
+                 "(depth %u/%u, high-water %u)",
+                 lane.sensorId,
+                 static_cast<unsigned long>(s.dropped - lane.lastReportedDrops),
+                 s.depth, s.capacity, s.highWater);
+        lane.lastReportedDrops = s.dropped;
+    }
+
+    if (lane.index != 0) return;
+
+    // Ingest counters summed over lanes; high-water is the worst lane's.
+    IngestStats total;
+    for (const auto& l : lanes_) {
+        IngestStats ls = l->ingest->stats();
+        total.capacity  += ls.capacity;
+        total.depth     += ls.depth;
+        total.highWater  = std::max(total.highWater, ls.highWater);
+        total.pushed    += ls.pushed;
+        total.dropped   += ls.dropped;
+        total.coalesced += ls.coalesced;
+    }
+
+    CounterUAS::PipelineStatsMessage msg;
+    msg.timestamp(nowMicros());
+    msg.cycleCount(cycleCount_.load());
+    msg.messagesReceived(receiver_->totalMessagesReceived());
+    msg.ingestCapacity(total.capacity);
+    msg.ingestDepth(total.depth);
+    msg.ingestHighWater(total.highWater);
+    msg.ingestDropped(total.dropped);
+    msg.ingestCoalesced(total.coalesced);
+    sender_->sendPipelineStats(msg);
+
+    CounterUAS::TrackerHealthMessage health;
+    health.timestamp(msg.timestamp());
+    health.cycleCount(msg.cycleCount());
+    std::vector<CounterUAS::StageLatency> stages;
+    stages.reserve(StageTimings::NUM_STAGES);
+    for (size_t i = 0; i < StageTimings::NUM_STAGES; ++i) {
+        auto stage = static_cast<PipelineStage>(i);
+        LatencySummary l = (*timings_)[stage].summary();
+        CounterUAS::StageLatency e;
+        e.stageId(static_cast<uint32_t>(i));
+        e.name(pipelineStageName(stage));
+        e.count(l.count);
+        e.p50Us(l.p50Us);   e.p99Us(l.p99Us);
+        e.p999Us(l.p999Us); e.maxUs(l.maxUs);
+        AllocCounts a = stageAllocCounts(stage);
+        e.allocCount(a.count);
+        e.allocBytes(a.bytes);
+        stages.push_back(e);
+    }
+    health.stages(stages);
+    sender_->sendTrackerHealth(health);
+}
+
+void TrackerPipeline::processingLoop(SensorLane& lane) {
+    LOG_INFO("Pipeline", "Processing loop started for sensor %u", lane.sensorId);
+    CUAS_PROFILE_THREAD(("sensor " + std::to_string(lane.sensorId) + " processing").c_str());
 
+    TrackManager& tm = *lane.trackManager;
+
+    // Declared outside the loop so their buffers are recycled through the
+    // ingest ring and TrackSender instead of reallocated every dwell.
+    SPDetectionMessage msg;
+    DwellOutputs       outputs;
+    while (running_.load()) {
+        if (!waitForMessage(lane, msg)) continue;
+        CUAS_PROFILE_ZONE("dwell");
+
+        // Allocations outside the finer stages count against the dwell.
+        AllocStageScope allocs(static_cast<uint32_t>(PipelineStage::Dwell));
         auto cycleStart = std::chrono::high_resolution_clock::now();
+        bool fastForward = updateCatchUp(lane);
+        if (auto cfg = takePendingConfig(lane)) tm.reconfigure(*cfg);
 
-        // Forward raw detections to the display (re-publish on SPDetection topic).
-        sender_->sendRawDetections(msg);
+        // Forward raw detections to the display (on SPDetectionDisplay
+        // topic).  In async mode they travel with the dwell snapshot instead.
+        outputs.hasRaw = config_.display.asyncPublish;
+        if (fastForward || !sender_->wantsRawDetections(msg.dwellCount))
+            outputs.hasRaw = false;
+        else if (outputs.hasRaw) outputs.raw = msg;
+        else                     sender_->sendRawDetections(msg);
 
         // Run the tracking pipeline.
-        trackManager_->processDwell(msg);
+        tm.setDebugTables(debugTables(lane, fastForward));
+        acceptHandovers(lane);
+        tm.processDwell(msg);
+        const Timestamp processedAt = nowMicros();
+        sendHandovers(lane);   // catch-up too: the tracks have left this node
 
         Timestamp ts = msg.timestamp > 0 ? msg.timestamp : nowMicros();
 
-        // Publish intermediate pipeline stages to debug topics.
-        sender_->sendClusterTable(trackManager_->lastClusters(), ts,
-                                   trackManager_->lastDwellCount());
-        sender_->sendPredictedTable(trackManager_->lastPredicted(), ts);
-        sender_->sendAssocTable(trackManager_->lastAssoc(), ts);
-
-        // Publish track table.
-        auto updates = trackManager_->getTrackUpdates();
-        if (!updates.empty()) {
-            sender_->sendTrackUpdates(updates, ts);
-            for (const auto& u : updates)
-                trackManager_->logger().logTrackSent(ts, u);
+        if (fastForward) {
+            ++cycleCount_;
+            continue;
         }
 
-        ++cycleCount_;
+        // Snapshot intermediate stages and the track table, then publish.
+        outputs.ts         = ts;
+        outputs.dwellCount = tm.lastDwellCount();
+        outputs.sensorId   = lane.sensorId;
+        outputs.lane       = lane.index;
+        outputs.trace.dwellCount(msg.dwellCount);
+        outputs.trace.sensorTime(msg.timestamp);
+        outputs.trace.receiveTime(msg.receivedAt);
+        outputs.trace.dequeueTime(msg.dequeuedAt);
+        outputs.trace.processedTime(processedAt);
+        if (lane.shedLevel.load() >= 1) {
+            outputs.clusters.clear();
+            outputs.predicted.clear();
+            outputs.assoc.clear();
+        } else {
+            outputs.clusters  = tm.lastClusters();
+            outputs.predicted = tm.lastPredicted();
+            outputs.assoc     = tm.lastAssoc();
+        }
+        outputs.updates    = tm.getTrackUpdates();
+        for (const auto& u : outputs.updates)
+            tm.logger().logTrackSent(ts, u);
+        sender_->publish(outputs);
+
+        uint64_t cycle = ++cycleCount_;
 
         auto cycleEnd = std::chrono::high_resolution_clock::now();
-        auto cycleMs  = std::chrono::duration_cast<std::chrono::microseconds>(
-                            cycleEnd - cycleStart).count() / 1000.0;
-
-        if (cycleCount_ % 100 == 0) {
-            LOG_INFO("Pipeline", "Cycle %lu: %u tracks (%u confirmed), %.2f ms",
-                     static_cast<unsigned long>(cycleCount_),
-                     trackManager_->numActiveTracks(),
-                     trackManager_->numConfirmedTracks(),
+        auto cycleNs  = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            cycleEnd - cycleStart).count();
+        (*timings_)[PipelineStage::Dwell].record(static_cast<uint64_t>(cycleNs));
+        auto cycleMs  = cycleNs / 1e6;
+        onDwellCompleted(lane, cycleMs);
+
+        if (cycle % 100 == 0) {
+            LOG_INFO("Pipeline", "Cycle %lu: sensor %u, %u tracks (%u confirmed), %.2f ms",
+                     static_cast<unsigned long>(cycle), lane.sensorId,
+                     tm.numActiveTracks(),
+                     tm.numConfirmedTracks(),
                      cycleMs);
         }
     }
 }
 
+// ---------------------------------------------------------------------------
+// Pipelined mode
+// ---------------------------------------------------------------------------
+// Stage groups are joined by bounded StageQueues, so clustering of dwell N+1
+// overlaps association of dwell N and publishing of dwell N-1.  Dwell order
+// is preserved because each stage group is a single thread per lane.
+
+void TrackerPipeline::ingestStageLoop(SensorLane& lane) {
+    LOG_INFO("Pipeline", "Ingest stage started for sensor %u", lane.sensorId);
+    CUAS_PROFILE_THREAD(("sensor " + std::to_string(lane.sensorId) + " ingest").c_str());
+
+    SPDetectionMessage msg;
+    while (running_.load()) {
+        if (!waitForMessage(lane, msg)) continue;
+        CUAS_PROFILE_ZONE("ingest stage");
+
+        AllocStageScope allocs(static_cast<uint32_t>(PipelineStage::Dwell));
+        DwellWork work;
+        work.start      = std::chrono::high_resolution_clock::now();
+        work.dwellCount = msg.dwellCount;
+        work.ts         = msg.timestamp > 0 ? msg.timestamp : nowMicros();
+        work.catchUp    = updateCatchUp(lane);
+        work.reconfigure = takePendingConfig(lane);
+        if (work.reconfigure) lane.trackManager->reconfigureClustering(*work.reconfigure);
+
+        if (!work.catchUp) sender_->sendRawDetections(msg);
+
+        work.clusters         = lane.trackManager->clusterDwell(msg, work.ts);
+        work.out.ts           = work.ts;
+        work.out.dwellCount   = work.dwellCount;
+        work.out.sensorId     = lane.sensorId;
+        work.out.lane         = lane.index;
+        work.out.trace.dwellCount(msg.dwellCount);
+        work.out.trace.sensorTime(msg.timestamp);
+        work.out.trace.receiveTime(msg.receivedAt);
+        work.out.trace.dequeueTime(msg.dequeuedAt);
+        if (debugTables(lane, work.catchUp) & DEBUG_TABLE_CLUSTERS)
+            work.out.clusters = TrackManager::toClusterTable(work.clusters);
+        work.busiestStageMs   = elapsedMs(work.start);
+
+        if (!lane.clusterQueue->push(std::move(work))) break;
+    }
+}
+
+void TrackerPipeline::trackStageLoop(SensorLane& lane) {
+    LOG_INFO("Pipeline", "Tracking stage started for sensor %u", lane.sensorId);
+    CUAS_PROFILE_THREAD(("sensor " + std::to_string(lane.sensorId) + " track").c_str());
+
+    TrackManager& tm = *lane.trackManager;
+
+    DwellWork work;
+    while (lane.clusterQueue->pop(work)) {
+        CUAS_PROFILE_ZONE("track stage");
+        AllocStageScope allocs(static_cast<uint32_t>(PipelineStage::Dwell));
+        auto stageStart = std::chrono::high_resolution_clock::now();
+        if (work.reconfigure) tm.reconfigureTracking(*work.reconfigure);
+        tm.setDebugTables(debugTables(lane, work.catchUp));
+        acceptHandovers(lane);
+        tm.trackDwell(work.clusters, work.ts, work.dwellCount);
+        work.out.trace.processedTime(nowMicros());
+        sendHandovers(lane);
+
+        if (!work.catchUp) {
+            work.out.predicted = tm.lastPredicted();
+            work.out.assoc     = tm.lastAssoc();
+            work.out.updates   = tm.getTrackUpdates();
+        }
+        work.numActive    = tm.numActiveTracks();
+        work.numConfirmed = tm.numConfirmedTracks();
+        work.busiestStageMs = std::max(work.busiestStageMs, elapsedMs(stageStart));
+
+        if (!lane.publishQueue->push(std::move(work))) break;
+    }
+}
+
+void TrackerPipeline::publishStageLoop(SensorLane& lane) {
+    LOG_INFO("Pipeline", "Publish stage started for sensor %u", lane.sensorId);
+    CUAS_PROFILE_THREAD(("sensor " + std::to_string(lane.sensorId) + " publish").c_str());
+
+    DwellWork work;
+    while (lane.publishQueue->pop(work)) {
+        CUAS_PROFILE_ZONE("publish stage");
+        AllocStageScope allocs(static_cast<uint32_t>(PipelineStage::Dwell));
+        publishDwell(lane, work);
+    }
+}
+
+void TrackerPipeline::publishDwell(SensorLane& lane, DwellWork& work) {
+    if (work.catchUp) {
+        ++cycleCount_;
+        return;
+    }
+
+    auto stageStart = std::chrono::high_resolution_clock::now();
+
+    if (lane.shedLevel.load() >= 1) {
+        work.out.clusters.clear();
+        work.out.predicted.clear();
+        work.out.assoc.clear();
+    }
+    for (const auto& u : work.out.updates)
+        lane.trackManager->logger().logTrackSent(work.ts, u);
+    sender_->publish(work.out);
+    onDwellCompleted(lane, std::max(work.busiestStageMs, elapsedMs(stageStart)));
+
+    uint64_t cycle = ++cycleCount_;
+
+    auto latencyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::high_resolution_clock::now() - work.start).count();
+    (*timings_)[PipelineStage::Dwell].record(static_cast<uint64_t>(latencyNs));
+
+    if (cycle % 100 == 0) {
+        auto latencyMs = latencyNs / 1e6;
+        LOG_INFO("Pipeline", "Cycle %lu: sensor %u, %u tracks (%u confirmed), %.2f ms end-to-end",
+                 static_cast<unsigned long>(cycle), lane.sensorId,
+                 work.numActive, work.numConfirmed, latencyMs);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Real-time placement
+// ---------------------------------------------------------------------------
+
+void TrackerPipeline::applyThreadPlacement() {
+    const RealtimeConfig& rt = config_.system.realtime;
+    if (rt.pipelineCpus.empty() && !rt.schedFifo) return;
+
+    // Each pipeline thread takes the next CPU, so lanes and stage groups
+    // land on separate cores when enough are listed.
+    size_t nextCpu = 0;
+    for (auto& lane : lanes_) {
+        std::pair<std::thread*, const char*> threads[] = {
+            { &lane->processingThread, config_.pipeline.pipelined ? "ingest" : "processing" },
+            { &lane->trackThread,      "track"   },
+            { &lane->publishThread,    "publish" },
+        };
+        for (auto& t : threads) {
+            if (!t.first->joinable()) continue;
+            std::string name = "sensor " + std::to_string(lane->sensorId) + " " + t.second;
+            if (!rt.pipelineCpus.empty()) {
+                int cpu = rt.pipelineCpus[nextCpu++ % rt.pipelineCpus.size()];
+                if (setThreadAffinity(*t.first, cpu, name))
+                    LOG_INFO("Pipeline", "%s thread pinned to CPU %d", name.c_str(), cpu);
+            }
+            if (rt.schedFifo && setThreadRealtime(*t.first, rt.schedPriority, name))
+                LOG_INFO("Pipeline", "%s thread running SCHED_FIFO priority %d",
+                         name.c_str(), rt.schedPriority);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Catch-up
+// ---------------------------------------------------------------------------
+
+bool TrackerPipeline::updateCatchUp(SensorLane& lane) {
+    int threshold = config_.pipeline.catchUpThreshold;
+    if (threshold <= 0) return false;
+
+    size_t backlog = lane.ingest->size();
+    if (!lane.catchingUp && backlog >= static_cast<size_t>(threshold)) {
+        lane.catchingUp       = true;
+        lane.catchUpRunDwells = 0;
+        LOG_WARN("Pipeline", "Catch-up: sensor %u has %zu dwells queued, fast-forwarding",
+                 lane.sensorId, backlog);
+    }
+    if (!lane.catchingUp) return false;
+
+    if (backlog == 0) {
+        lane.catchingUp = false;
+        LOG_INFO("Pipeline", "Catch-up: sensor %u back in real time after %lu fast-forwarded dwells",
+                 lane.sensorId, static_cast<unsigned long>(lane.catchUpRunDwells));
+        return false;
+    }
+
+    ++lane.catchUpRunDwells;
+    fastForwarded_.fetch_add(1);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Load shedding
+// ---------------------------------------------------------------------------
+
+void TrackerPipeline::onDwellCompleted(SensorLane& lane, double cycleMs) {
+    if (!lane.loadShed) return;
+
+    int before = lane.loadShed->level();
+    uint32_t depth = static_cast<uint32_t>(lane.ingest->size());
+    if (!lane.loadShed->update(cycleMs, depth)) return;
+
+    int after = lane.loadShed->level();
+    if (after > before)
+        LOG_WARN("Pipeline", "Load shedding: sensor %u level %d -> %d "
+                 "(cycle %.2f ms, ingest depth %u)",
+                 lane.sensorId, before, after, cycleMs, depth);
+    else
+        LOG_INFO("Pipeline", "Load shedding: sensor %u level %d -> %d (recovered)",
+                 lane.sensorId, before, after);
+    applyLoadShedLevel(lane, after);
+}
+
+uint32_t TrackerPipeline::debugTables(const SensorLane& lane, bool catchUp) const {
+    if (catchUp || lane.shedLevel.load() >= 1) return 0;
+    return sender_->debugTables();
+}
+
+void TrackerPipeline::applyLoadShedLevel(SensorLane& lane, int level) {
+    TrackManager& tm = *lane.trackManager;
+    lane.shedLevel.store(level);   // level 1: debug tables neither built nor sent
+    tm.logger().setCombinedTextEnabled(level < 2);
+    tm.setAssociationFallback(level >= 3);
+    tm.setMinSNRFloor(level >= 4 ? config_.pipeline.loadShed.degradedMinSNR : -1e30);
+}
+
 void TrackerPipeline::printStats() const {
     if (receiver_) {
         LOG_INFO("Pipeline", "Receiver stats: %lu messages, %lu detections",
                  static_cast<unsigned long>(receiver_->totalMessagesReceived()),
                  static_cast<unsigned long>(receiver_->totalDetectionsReceived()));
     }
+    if (unroutedDwells_.load() > 0) {
+        LOG_INFO("Pipeline", "Unrouted dwells (sensorId not configured): %lu",
+                 static_cast<unsigned long>(unroutedDwells_.load()));
+    }
+    for (const auto& lane : lanes_) {
+        IngestStats s = lane->ingest->stats();
+        LOG_INFO("Pipeline", "Sensor %u ingest ring: depth %u/%u, high-water %u, "
+                 "%lu dropped, %lu coalesced",
+                 lane->sensorId, s.depth, s.capacity, s.highWater,
+                 static_cast<unsigned long>(s.dropped),
+                 static_cast<unsigned long>(s.coalesced));
+        if (lane->loadShed) {
+            LOG_INFO("Pipeline", "Sensor %u load shedding level: %d",
+                     lane->sensorId, lane->loadShed->level());
+        }
+    }
+    if (config_.pipeline.catchUpThreshold > 0) {
+        LOG_INFO("Pipeline", "Catch-up: %lu dwells fast-forwarded",
+                 static_cast<unsigned long>(fastForwarded_.load()));
+    }
+    if (handover_) {
+        LOG_INFO("Pipeline", "Handover stats: %lu tracks sent, %lu received",
+                 static_cast<unsigned long>(handover_->totalSent()),
+                 static_cast<unsigned long>(handover_->totalReceived()));
+    }
     if (sender_) {
-        LOG_INFO("Pipeline", "Sender stats: %lu messages",
-                 static_cast<unsigned long>(sender_->totalMessagesSent()));
+        LOG_INFO("Pipeline", "Sender stats: %lu messages, %lu snapshots superseded",
+                 static_cast<unsigned long>(sender_->totalMessagesSent()),
+                 static_cast<unsigned long>(sender_->totalSnapshotsSuperseded()));
+    }
+    if (timings_) {
+        LOG_INFO("Pipeline", "Stage latency (us):        count       p50       p99     p99.9       max");
+        for (size_t i = 0; i < StageTimings::NUM_STAGES; ++i) {
+            auto stage = static_cast<PipelineStage>(i);
+            LatencySummary l = (*timings_)[stage].summary();
+            if (l.count == 0) continue;
+            LOG_INFO("Pipeline", "  %-22s %10lu %9.1f %9.1f %9.1f %9.1f",
+                     pipelineStageName(stage), static_cast<unsigned long>(l.count),
+                     l.p50Us, l.p99Us, l.p999Us, l.maxUs);
+        }
+        if (ALLOC_STATS_ENABLED) {
+            const uint64_t dwells = std::max<uint64_t>(1, (*timings_)[PipelineStage::Dwell].count());
+            LOG_INFO("Pipeline", "Heap allocations per dwell (%lu dwells):   allocs     bytes",
+                     static_cast<unsigned long>(dwells));
+            for (size_t i = 0; i < StageTimings::NUM_STAGES; ++i) {
+                auto stage = static_cast<PipelineStage>(i);
+                AllocCounts a = stageAllocCounts(stage);
+                if (a.count == 0) continue;
+                LOG_INFO("Pipeline", "  %-22s %20.2f %9.0f",
+                         pipelineStageName(stage),
+                         static_cast<double>(a.count) / dwells,
+                         static_cast<double>(a.bytes) / dwells);
+            }
+        }
     }
-    if (trackManager_) {
-        LOG_INFO("Pipeline", "Final tracks: %u active, %u confirmed",
-                 trackManager_->numActiveTracks(),
-                 trackManager_->numConfirmedTracks());
+    for (const auto& lane : lanes_) {
+        LOG_INFO("Pipeline", "Sensor %u final tracks: %u active, %u confirmed",
+                 lane->sensorId,
+                 lane->trackManager->numActiveTracks(),
+                 lane->trackManager->numConfirmedTracks());
     }
 }
 
@@ -6,7 +6,7 @@ namespace cuas {
 CAModel::CAModel(const CAConfig& cfg, const std::string& label)
     : config_(cfg), label_(label) {}
 
-StateMatrix CAModel::getTransitionMatrix(double dt, const StateVector& /*x*/) const {
+StateMatrix CAModel::buildTransition(double dt) const {
     // State: [x, vx, ax, y, vy, ay, z, vz, az]
     // CA: full constant-acceleration model
     StateMatrix F = matIdentity();
@@ -34,7 +34,7 @@ StateMatrix CAModel::getTransitionMatrix(double dt, const StateVector& /*x*/) co
     return F;
 }
 
-StateMatrix CAModel::getProcessNoise(double dt) const {
+StateMatrix CAModel::buildProcessNoise(double dt) const {
     double q = config_.processNoiseStd * config_.processNoiseStd;
     double dt2 = dt * dt;
     double dt3 = dt2 * dt;
@@ -59,16 +59,19 @@ StateMatrix CAModel::getProcessNoise(double dt) const {
     return Q;
 }
 
-void CAModel::predict(const StateVector& xIn, const StateMatrix& PIn,
-                       double dt,
-                       StateVector& xOut, StateMatrix& POut) const {
-    StateMatrix F = getTransitionMatrix(dt, xIn);
-    StateMatrix Q = getProcessNoise(dt);
+void CAModel::prepare(double dt) {
+    IMotionModel::prepare(dt);
+    dwellF_ = buildTransition(dt);
+}
 
-    xOut = mat::multiplyMV(F, xIn);
+void CAModel::predict(const StateVector& xIn, const SymStateMatrix& PIn,
+                       double dt,
+                       StateVector& xOut, SymStateMatrix& POut) const {
+    StateMatrix Fs, Qs;
+    const StateMatrix& F = prepared(dt) ? dwellF_ : (Fs = buildTransition(dt));
+    const StateMatrix& Q = processNoise(dt, Qs);
 
-    StateMatrix Ft = mat::transpose(F);
-    POut = mat::addMat(mat::multiply(mat::multiply(F, PIn), Ft), Q);
+    propagate(structure(xIn), F, Q, xIn, PIn, xOut, POut);
 }
 
 } // namespace cuas
@@ -5,7 +5,7 @@ namespace cuas {
 
 CVModel::CVModel(const CVConfig& cfg) : config_(cfg) {}
 
-StateMatrix CVModel::getTransitionMatrix(double dt, const StateVector& /*x*/) const {
+StateMatrix CVModel::buildTransition(double dt) const {
     // State: [x, vx, ax, y, vy, ay, z, vz, az]
     // CV: position updates with velocity, velocity constant, acceleration forced to zero
     StateMatrix F = matIdentity();
@@ -22,7 +22,7 @@ StateMatrix CVModel::getTransitionMatrix(double dt, const StateVector& /*x*/) co
     return F;
 }
 
-StateMatrix CVModel::getProcessNoise(double dt) const {
+StateMatrix CVModel::buildProcessNoise(double dt) const {
     double q = config_.processNoiseStd * config_.processNoiseStd;
     double dt2 = dt * dt;
     double dt3 = dt2 * dt / 2.0;
@@ -43,21 +43,24 @@ StateMatrix CVModel::getProcessNoise(double dt) const {
     return Q;
 }
 
-void CVModel::predict(const StateVector& xIn, const StateMatrix& PIn,
+void CVModel::prepare(double dt) {
+    IMotionModel::prepare(dt);
+    dwellF_ = buildTransition(dt);
+}
+
+void CVModel::predict(const StateVector& xIn, const SymStateMatrix& PIn,
                        double dt,
-                       StateVector& xOut, StateMatrix& POut) const {
-    StateMatrix F = getTransitionMatrix(dt, xIn);
-    StateMatrix Q = getProcessNoise(dt);
+                       StateVector& xOut, SymStateMatrix& POut) const {
+    StateMatrix Fs, Qs;
+    const StateMatrix& F = prepared(dt) ? dwellF_ : (Fs = buildTransition(dt));
+    const StateMatrix& Q = processNoise(dt, Qs);
 
-    xOut = mat::multiplyMV(F, xIn);
+    propagate(structure(xIn), F, Q, xIn, PIn, xOut, POut);
 
     // Force acceleration to zero in CV model
     xOut[2] = 0.0;
     xOut[5] = 0.0;
     xOut[8] = 0.0;
-
-    StateMatrix Ft = mat::transpose(F);
-    POut = mat::addMat(mat::multiply(mat::multiply(F, PIn), Ft), Q);
 }
 
 } // namespace cuas
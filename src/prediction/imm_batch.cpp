@@ -0,0 +1,457 @@
+#include "prediction/imm_batch.h"
+#include "common/matrix_ops.h"
+#include "common/logger.h"
+#include "common/profiling.h"
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace cuas {
+
+// ---------------------------------------------------------------------------
+// Transition-matrix sparsity pattern
+// ---------------------------------------------------------------------------
+// Union of the non-zeros of every model's F: the three 3x3 axis blocks plus
+// the CTR x-y velocity coupling (F[0][4], F[1][4], F[3][1], F[4][1]).  Row i
+// lists its columns in ascending order, matching the summation order of the
+// scalar kernels; the extra terms for CV/CA are exact zeros and leave the
+// sums unchanged.
+namespace {
+
+constexpr int PATTERN_MAX = 4;
+
+struct PatternRow {
+    int n;
+    int col[PATTERN_MAX];
+};
+
+constexpr PatternRow PATTERN[STATE_DIM] = {
+    {4, {0, 1, 2, 4}}, {4, {0, 1, 2, 4}}, {3, {0, 1, 2}},
+    {4, {1, 3, 4, 5}}, {4, {1, 3, 4, 5}}, {3, {3, 4, 5}},
+    {3, {6, 7, 8}},    {3, {6, 7, 8}},    {3, {6, 7, 8}},
+};
+
+bool fitsPattern(const StateMatrix& F) {
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = 0; j < STATE_DIM; ++j) {
+            if (F[i][j] == 0.0) continue;
+            bool inRow = false;
+            for (int n = 0; n < PATTERN[i].n; ++n) inRow |= PATTERN[i].col[n] == j;
+            if (!inRow) return false;
+        }
+    return true;
+}
+
+// Per-dwell inputs of one model, shared by every Block.
+struct ModelStep {
+    StateMatrix Q;
+    StateMatrix F;            // valid when !perLane
+    bool perLane = false;     // F depends on the state: built per lane
+    bool fits    = true;      // F fits the batch kernel's sparsity pattern
+};
+
+using ModelSteps = std::array<ModelStep, IMM_NUM_MODELS>;
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// IMMBatchOf<Real>: the store for one scalar type
+// ---------------------------------------------------------------------------
+template<typename Real>
+class IMMBatchOf final : public IMMBatch {
+public:
+    static constexpr int LANES = 64 / sizeof(Real);   // tracks per Block (one AVX-512 register)
+
+    explicit IMMBatchOf(const IMMFilter& filter);
+
+    uint32_t allocate(const StateVector& x0, const SymStateMatrix& P0,
+                      const std::array<double, IMM_NUM_MODELS>& modeProbs) override;
+    void     release(uint32_t slot) override;
+    uint32_t relocate(uint32_t slot) override;
+    void     predict(double dt, WorkerPool& workers) override;
+    void     load(uint32_t slot, IMMState& out) const override;
+    void     store(uint32_t slot, const IMMState& in) override;
+    void     merged(uint32_t slot, StateVector& x, SymStateMatrix& P,
+                    std::array<double, IMM_NUM_MODELS>& modeProbs) const override;
+
+    size_t numLive() const override { return slotLive_.size() - freeSlots_.size(); }
+    IMMPrecision precision() const override {
+        return sizeof(Real) == sizeof(float) ? IMMPrecision::Float : IMMPrecision::Double;
+    }
+
+private:
+    using Lanes      = std::array<Real, LANES>;
+    using LaneVector = std::array<Lanes, STATE_DIM>;
+    using LaneMatrix = std::array<LaneVector, STATE_DIM>;
+    using LaneSym    = std::array<Lanes, SYM_DIM>;      // packed as SymStateMatrix
+
+    struct alignas(64) Block {
+        std::array<LaneVector, IMM_NUM_MODELS> x;
+        std::array<LaneSym, IMM_NUM_MODELS>    P;
+        std::array<Lanes, IMM_NUM_MODELS>      mu;
+        LaneVector xMerged;
+        LaneSym    PMerged;
+    };
+
+    CUAS_MATH_KERNEL
+    void predictBlock(Block& blk, uint32_t firstSlot, double dt, const ModelSteps& steps) const;
+    void clearLane(uint32_t slot);
+    void copyLane(uint32_t from, uint32_t to);
+
+    const IMMFilter& filter_;
+
+    std::vector<Block>    blocks_;
+    std::vector<uint8_t>  slotLive_;
+    std::vector<uint32_t> freeSlots_;    // min-heap
+};
+
+std::unique_ptr<IMMBatch> IMMBatch::create(const IMMFilter& filter) {
+    if (filter.config().imm.precision == IMMPrecision::Float)
+        return std::make_unique<IMMBatchOf<float>>(filter);
+    return std::make_unique<IMMBatchOf<double>>(filter);
+}
+
+template<typename Real>
+IMMBatchOf<Real>::IMMBatchOf(const IMMFilter& filter) : filter_(filter) {
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        const IMotionModel& model = filter_.model(m);
+        if (!model.transitionDependsOnState() &&
+            !fitsPattern(model.getTransitionMatrix(0.1, stateZero())))
+            LOG_WARN("IMMBatch", "%s transition matrix does not fit the batch "
+                     "kernel; it will be predicted per track", model.name().c_str());
+    }
+    LOG_INFO("IMMBatch", "%s precision, %d tracks per block",
+             sizeof(Real) == sizeof(float) ? "float" : "double", LANES);
+}
+
+// ---------------------------------------------------------------------------
+// Slot management
+// ---------------------------------------------------------------------------
+template<typename Real>
+uint32_t IMMBatchOf<Real>::allocate(const StateVector& x0, const SymStateMatrix& P0,
+                                    const std::array<double, IMM_NUM_MODELS>& modeProbs) {
+    uint32_t slot;
+    if (!freeSlots_.empty()) {
+        std::pop_heap(freeSlots_.begin(), freeSlots_.end(), std::greater<uint32_t>());
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(slotLive_.size());
+        slotLive_.push_back(0);
+        if (slot % LANES == 0) blocks_.emplace_back();
+    }
+
+    Block& blk = blocks_[slot / LANES];
+    const int l = slot % LANES;
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        for (int i = 0; i < STATE_DIM; ++i) blk.x[m][i][l] = static_cast<Real>(x0[i]);
+        for (int e = 0; e < SYM_DIM; ++e)   blk.P[m][e][l] = static_cast<Real>(P0.v[e]);
+        blk.mu[m][l] = static_cast<Real>(modeProbs[m]);
+    }
+    for (int i = 0; i < STATE_DIM; ++i) blk.xMerged[i][l] = static_cast<Real>(x0[i]);
+    for (int e = 0; e < SYM_DIM; ++e)   blk.PMerged[e][l] = static_cast<Real>(P0.v[e]);
+    slotLive_[slot] = 1;
+    return slot;
+}
+
+template<typename Real>
+void IMMBatchOf<Real>::release(uint32_t slot) {
+    clearLane(slot);
+    slotLive_[slot] = 0;
+    freeSlots_.push_back(slot);
+    std::push_heap(freeSlots_.begin(), freeSlots_.end(), std::greater<uint32_t>());
+}
+
+template<typename Real>
+uint32_t IMMBatchOf<Real>::relocate(uint32_t slot) {
+    if (freeSlots_.empty() || freeSlots_.front() > slot) return slot;
+    std::pop_heap(freeSlots_.begin(), freeSlots_.end(), std::greater<uint32_t>());
+    const uint32_t to = freeSlots_.back();
+    freeSlots_.pop_back();
+    copyLane(slot, to);
+    slotLive_[to] = 1;
+    release(slot);
+    return to;
+}
+
+// Free lanes hold zeros: with all mode probabilities zero the interaction
+// falls back to identity mixing, so they stay finite while predict() runs
+// over them.
+template<typename Real>
+void IMMBatchOf<Real>::clearLane(uint32_t slot) {
+    Block& blk = blocks_[slot / LANES];
+    const int l = slot % LANES;
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        for (int i = 0; i < STATE_DIM; ++i) blk.x[m][i][l] = 0;
+        for (int e = 0; e < SYM_DIM; ++e)   blk.P[m][e][l] = 0;
+        blk.mu[m][l] = 0;
+    }
+    for (int i = 0; i < STATE_DIM; ++i) blk.xMerged[i][l] = 0;
+    for (int e = 0; e < SYM_DIM; ++e)   blk.PMerged[e][l] = 0;
+}
+
+template<typename Real>
+void IMMBatchOf<Real>::copyLane(uint32_t from, uint32_t to) {
+    const Block& src = blocks_[from / LANES];
+    Block&       dst = blocks_[to / LANES];
+    const int ls = from % LANES, ld = to % LANES;
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        for (int i = 0; i < STATE_DIM; ++i) dst.x[m][i][ld] = src.x[m][i][ls];
+        for (int e = 0; e < SYM_DIM; ++e)   dst.P[m][e][ld] = src.P[m][e][ls];
+        dst.mu[m][ld] = src.mu[m][ls];
+    }
+    for (int i = 0; i < STATE_DIM; ++i) dst.xMerged[i][ld] = src.xMerged[i][ls];
+    for (int e = 0; e < SYM_DIM; ++e)   dst.PMerged[e][ld] = src.PMerged[e][ls];
+}
+
+template<typename Real>
+void IMMBatchOf<Real>::load(uint32_t slot, IMMState& out) const {
+    const Block& blk = blocks_[slot / LANES];
+    const int l = slot % LANES;
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        for (int i = 0; i < STATE_DIM; ++i) out.modelStates[m][i] = blk.x[m][i][l];
+        for (int e = 0; e < SYM_DIM; ++e)   out.modelCovariances[m].v[e] = blk.P[m][e][l];
+        out.modeProbabilities[m] = blk.mu[m][l];
+    }
+    for (int i = 0; i < STATE_DIM; ++i) out.mergedState[i] = blk.xMerged[i][l];
+    for (int e = 0; e < SYM_DIM; ++e)   out.mergedCovariance.v[e] = blk.PMerged[e][l];
+}
+
+template<typename Real>
+void IMMBatchOf<Real>::store(uint32_t slot, const IMMState& in) {
+    Block& blk = blocks_[slot / LANES];
+    const int l = slot % LANES;
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        for (int i = 0; i < STATE_DIM; ++i)
+            blk.x[m][i][l] = static_cast<Real>(in.modelStates[m][i]);
+        for (int e = 0; e < SYM_DIM; ++e)
+            blk.P[m][e][l] = static_cast<Real>(in.modelCovariances[m].v[e]);
+        blk.mu[m][l] = static_cast<Real>(in.modeProbabilities[m]);
+    }
+    for (int i = 0; i < STATE_DIM; ++i)
+        blk.xMerged[i][l] = static_cast<Real>(in.mergedState[i]);
+    for (int e = 0; e < SYM_DIM; ++e)
+        blk.PMerged[e][l] = static_cast<Real>(in.mergedCovariance.v[e]);
+}
+
+template<typename Real>
+void IMMBatchOf<Real>::merged(uint32_t slot, StateVector& x, SymStateMatrix& P,
+                              std::array<double, IMM_NUM_MODELS>& modeProbs) const {
+    const Block& blk = blocks_[slot / LANES];
+    const int l = slot % LANES;
+    for (int i = 0; i < STATE_DIM; ++i) x[i] = blk.xMerged[i][l];
+    for (int e = 0; e < SYM_DIM; ++e)   P.v[e] = blk.PMerged[e][l];
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) modeProbs[m] = blk.mu[m][l];
+}
+
+// ---------------------------------------------------------------------------
+// Batched predict
+// ---------------------------------------------------------------------------
+template<typename Real>
+void IMMBatchOf<Real>::predict(double dt, WorkerPool& workers) {
+    CUAS_PROFILE_ZONE("IMMBatch::predict");
+    // Q never depends on the state, and F only does for CTR: evaluate the
+    // rest once for every track.
+    ModelSteps steps;
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        const IMotionModel& model = filter_.model(m);
+        ModelStep& s = steps[m];
+        s.Q       = model.getProcessNoise(dt);
+        s.perLane = model.transitionDependsOnState();
+        if (!s.perLane) {
+            s.F    = model.getTransitionMatrix(dt, stateZero());
+            s.fits = fitsPattern(s.F);
+        }
+    }
+
+    workers.parallelFor(blocks_.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; ++b)
+            predictBlock(blocks_[b], static_cast<uint32_t>(b * LANES), dt, steps);
+    });
+}
+
+// Same arithmetic as IMMFilter::interaction / modelPredictions /
+// mergeEstimates, lane by lane, in Real.  F, Q and the model transition
+// probabilities are rounded to Real on use.  (CV's explicit zeroing of the
+// acceleration states is implied by its all-zero F rows.)
+template<typename Real>
+CUAS_MATH_KERNEL
+void IMMBatchOf<Real>::predictBlock(Block& blk, uint32_t firstSlot, double dt,
+                                    const ModelSteps& steps) const {
+    const auto& T = filter_.transitionMatrix();
+
+    uint32_t liveMask = 0;
+    for (int l = 0; l < LANES; ++l) {
+        size_t slot = firstSlot + l;
+        if (slot < slotLive_.size() && slotLive_[slot]) liveMask |= 1u << l;
+    }
+    if (!liveMask) return;   // free lanes hold zeros, which predict to zeros
+
+    // Lanes in which each model is active (IMMFilter::activeModels).  A
+    // model frozen in every lane is skipped; in a partly frozen Block it is
+    // computed for all lanes and the frozen ones keep their stored values.
+    std::array<uint32_t, IMM_NUM_MODELS> modelLanes;
+    modelLanes.fill(liveMask);
+    const bool pruning = filter_.config().imm.pruneFloor > 0.0;
+    if (pruning) {
+        modelLanes.fill(0);
+        for (int l = 0; l < LANES; ++l) {
+            if (!(liveMask & (1u << l))) continue;
+            std::array<double, IMM_NUM_MODELS> mu;
+            for (int m = 0; m < IMM_NUM_MODELS; ++m) mu[m] = blk.mu[m][l];
+            uint32_t active = filter_.activeModels(mu);
+            for (int m = 0; m < IMM_NUM_MODELS; ++m)
+                if (active & (1u << m)) modelLanes[m] |= 1u << l;
+        }
+    }
+
+    // --- Interaction: mixing probabilities mu_{i|j} -----------------------
+    std::array<std::array<Lanes, IMM_NUM_MODELS>, IMM_NUM_MODELS> mix;
+    for (int j = 0; j < IMM_NUM_MODELS; ++j) {
+        Lanes cBar{};
+        for (int i = 0; i < IMM_NUM_MODELS; ++i) {
+            const Real t = static_cast<Real>(T[i][j]);
+            for (int l = 0; l < LANES; ++l) cBar[l] += t * blk.mu[i][l];
+        }
+        for (int i = 0; i < IMM_NUM_MODELS; ++i) {
+            const Real t = static_cast<Real>(T[i][j]);
+            for (int l = 0; l < LANES; ++l)
+                mix[i][j][l] = cBar[l] > Real(1e-15) ? t * blk.mu[i][l] / cBar[l]
+                                                     : Real(i == j ? 1 : 0);
+        }
+    }
+
+    // --- Mixed initial conditions ----------------------------------------
+    std::array<LaneVector, IMM_NUM_MODELS> x0;
+    std::array<LaneSym, IMM_NUM_MODELS>    P0;
+    for (int j = 0; j < IMM_NUM_MODELS; ++j) {
+        if (!modelLanes[j]) continue;
+        x0[j] = {};
+        for (int i = 0; i < IMM_NUM_MODELS; ++i)
+            for (int k = 0; k < STATE_DIM; ++k)
+                for (int l = 0; l < LANES; ++l)
+                    x0[j][k][l] += blk.x[i][k][l] * mix[i][j][l];
+    }
+    for (int j = 0; j < IMM_NUM_MODELS; ++j) {
+        if (!modelLanes[j]) continue;
+        P0[j] = {};
+        for (int i = 0; i < IMM_NUM_MODELS; ++i) {
+            LaneVector d;
+            for (int k = 0; k < STATE_DIM; ++k)
+                for (int l = 0; l < LANES; ++l) d[k][l] = blk.x[i][k][l] - x0[j][k][l];
+            for (int a = 0, e = 0; a < STATE_DIM; ++a)
+                for (int b = a; b < STATE_DIM; ++b, ++e)
+                    for (int l = 0; l < LANES; ++l)
+                        P0[j][e][l] += (blk.P[i][e][l] + d[a][l] * d[b][l]) * mix[i][j][l];
+        }
+    }
+
+    // --- Model predictions: x = F x0, P = F P0 F^T + Q -------------------
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        const uint32_t lanes = modelLanes[m];
+        if (!lanes) continue;
+        const ModelStep& step = steps[m];
+
+        // Writes the lanes this model is active in (all of them unless
+        // pruning froze it in some).
+        std::array<bool, LANES> on;
+        for (int l = 0; l < LANES; ++l) on[l] = !pruning || (lanes & (1u << l));
+        auto put = [&](Lanes& dst, const Lanes& src) {
+            if (!pruning) { dst = src; return; }
+            for (int l = 0; l < LANES; ++l) dst[l] = on[l] ? src[l] : dst[l];
+        };
+
+        // F coefficients on PATTERN, per lane.
+        std::array<std::array<Lanes, PATTERN_MAX>, STATE_DIM> c{};
+        uint32_t scalarMask = 0;
+        if (!step.perLane) {
+            if (!step.fits) scalarMask = lanes;
+            for (int i = 0; i < STATE_DIM; ++i)
+                for (int n = 0; n < PATTERN[i].n; ++n)
+                    c[i][n].fill(static_cast<Real>(step.F[i][PATTERN[i].col[n]]));
+        } else {
+            // Per track: dispatched on the concrete model (CTR), inlined.
+            filter_.visitModel(m, [&](const auto& model) {
+                for (int l = 0; l < LANES; ++l) {
+                    if (!(lanes & (1u << l))) continue;
+                    StateVector xl;
+                    for (int k = 0; k < STATE_DIM; ++k) xl[k] = x0[m][k][l];
+                    StateMatrix F = model.getTransitionMatrix(dt, xl);
+                    if (!fitsPattern(F)) scalarMask |= 1u << l;
+                    for (int i = 0; i < STATE_DIM; ++i)
+                        for (int n = 0; n < PATTERN[i].n; ++n)
+                            c[i][n][l] = static_cast<Real>(F[i][PATTERN[i].col[n]]);
+                }
+            });
+        }
+
+        for (int i = 0; i < STATE_DIM; ++i) {
+            Lanes s{};
+            for (int n = 0; n < PATTERN[i].n; ++n) {
+                const int k = PATTERN[i].col[n];
+                for (int l = 0; l < LANES; ++l) s[l] += c[i][n][l] * x0[m][k][l];
+            }
+            put(blk.x[m][i], s);
+        }
+
+        LaneMatrix FP;
+        for (int i = 0; i < STATE_DIM; ++i)
+            for (int j = 0; j < STATE_DIM; ++j) {
+                Lanes s{};
+                for (int n = 0; n < PATTERN[i].n; ++n) {
+                    const int k = PATTERN[i].col[n];
+                    const Lanes& p = P0[m][symIndex(k, j)];
+                    for (int l = 0; l < LANES; ++l) s[l] += c[i][n][l] * p[l];
+                }
+                FP[i][j] = s;
+            }
+
+        // Upper triangle of FP F^T only.
+        for (int i = 0, e = 0; i < STATE_DIM; ++i)
+            for (int j = i; j < STATE_DIM; ++j, ++e) {
+                Lanes s{};
+                for (int n = 0; n < PATTERN[j].n; ++n) {
+                    const int k = PATTERN[j].col[n];
+                    for (int l = 0; l < LANES; ++l) s[l] += FP[i][k][l] * c[j][n][l];
+                }
+                const Real q = static_cast<Real>(step.Q[i][j]);
+                for (int l = 0; l < LANES; ++l) s[l] += q;
+                put(blk.P[m][e], s);
+            }
+
+        // Lanes whose F the pattern cannot represent.
+        for (int l = 0; l < LANES; ++l) {
+            if (!(scalarMask & (1u << l))) continue;
+            StateVector    xl, xOut;
+            SymStateMatrix Pl, POut;
+            for (int i = 0; i < STATE_DIM; ++i) xl[i] = x0[m][i][l];
+            for (int e = 0; e < SYM_DIM; ++e)   Pl.v[e] = P0[m][e][l];
+            filter_.visitModel(m, [&](const auto& model) { model.predict(xl, Pl, dt, xOut, POut); });
+            for (int i = 0; i < STATE_DIM; ++i) blk.x[m][i][l] = static_cast<Real>(xOut[i]);
+            for (int e = 0; e < SYM_DIM; ++e)   blk.P[m][e][l] = static_cast<Real>(POut.v[e]);
+        }
+    }
+
+    // --- Merge -----------------------------------------------------------
+    for (int k = 0; k < STATE_DIM; ++k) {
+        Lanes s{};
+        for (int m = 0; m < IMM_NUM_MODELS; ++m)
+            for (int l = 0; l < LANES; ++l) s[l] += blk.x[m][k][l] * blk.mu[m][l];
+        blk.xMerged[k] = s;
+    }
+    blk.PMerged = {};
+    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        LaneVector d;
+        for (int k = 0; k < STATE_DIM; ++k)
+            for (int l = 0; l < LANES; ++l) d[k][l] = blk.x[m][k][l] - blk.xMerged[k][l];
+        for (int a = 0, e = 0; a < STATE_DIM; ++a)
+            for (int b = a; b < STATE_DIM; ++b, ++e)
+                for (int l = 0; l < LANES; ++l)
+                    blk.PMerged[e][l] += (blk.P[m][e][l] + d[a][l] * d[b][l]) * blk.mu[m][l];
+    }
+}
+
+template class IMMBatchOf<double>;
+template class IMMBatchOf<float>;
+
+} // namespace cuas
@@ -4,46 +4,33 @@
 #include "prediction/ctr_model.h"
 #include "common/matrix_ops.h"
 #include "common/logger.h"
+#include "common/profiling.h"
 #include <cmath>
 #include <algorithm>
 #include <numeric>
+#include <limits>
 
 namespace cuas {
 
-IMMFilter::IMMFilter(const PredictionConfig& cfg) : config_(cfg) {
-    models_[0] = std::make_unique<CVModel>(cfg.cv);
-    models_[1] = std::make_unique<CAModel>(cfg.ca1, "CA1");
-    models_[2] = std::make_unique<CAModel>(cfg.ca2, "CA2");
-    models_[3] = std::make_unique<CTRModel>(cfg.ctr1, "CTR1");
-    models_[4] = std::make_unique<CTRModel>(cfg.ctr2, "CTR2");
-
+IMMFilter::IMMFilter(const PredictionConfig& cfg)
+    : config_(cfg),
+      cv_(cfg.cv),
+      ca1_(cfg.ca1, "CA1"), ca2_(cfg.ca2, "CA2"),
+      ctr1_(cfg.ctr1, "CTR1"), ctr2_(cfg.ctr2, "CTR2") {
     for (int i = 0; i < IMM_NUM_MODELS; ++i)
         for (int j = 0; j < IMM_NUM_MODELS; ++j)
             transMatrix_[i][j] = cfg.imm.transitionMatrix[i][j];
 
-    LOG_INFO("IMMFilter", "Initialized with %d models: CV, CA1, CA2, CTR1, CTR2",
-             IMM_NUM_MODELS);
+    LOG_INFO("IMMFilter", "Initialized with %d models: CV, CA1, CA2, CTR1, CTR2 (%s kernels)",
+             IMM_NUM_MODELS, mat::kernelIsa());
 }
 
-void IMMFilter::init(const StateVector& x0, const StateMatrix& P0) {
+void IMMFilter::init(const StateVector& x0, const SymStateMatrix& P0) {
     // Unused here; Track construction handles init
     (void)x0; (void)P0;
 }
 
-MeasStateMatrix IMMFilter::getMeasurementMatrix() const {
-    // Measurement is Cartesian position [x, y, z]
-    // H maps state [x, vx, ax, y, vy, ay, z, vz, az] -> [x, y, z]
-    MeasStateMatrix H{};
-    for (int i = 0; i < MEAS_DIM; ++i)
-        for (int j = 0; j < STATE_DIM; ++j)
-            H[i][j] = 0.0;
-    H[0][0] = 1.0; // x
-    H[1][3] = 1.0; // y
-    H[2][6] = 1.0; // z
-    return H;
-}
-
-void IMMFilter::interaction(IMMState& state) const {
+void IMMFilter::interaction(IMMState& state, uint32_t active) const {
     // Compute mixing probabilities
     std::array<double, IMM_NUM_MODELS> cBar;
     cBar.fill(0.0);
@@ -61,45 +48,65 @@ void IMMFilter::interaction(IMMState& state) const {
                 mixProb[i][j] = (i == j) ? 1.0 : 0.0;
         }
 
-    // Mixed initial conditions for each model
+    // Mixed initial conditions for each active model.  A frozen source has
+    // zero weight, so with pruning on its (stale) terms are skipped.
+    const bool pruning = config_.imm.pruneFloor > 0.0;
     std::array<StateVector, IMM_NUM_MODELS> x0j;
-    std::array<StateMatrix, IMM_NUM_MODELS> P0j;
+    std::array<SymStateMatrix, IMM_NUM_MODELS> P0j;
 
     for (int j = 0; j < IMM_NUM_MODELS; ++j) {
+        if (!(active & (1u << j))) continue;
         x0j[j] = stateZero();
         for (int i = 0; i < IMM_NUM_MODELS; ++i) {
-            x0j[j] = mat::add(x0j[j], mat::scale(state.modelStates[i], mixProb[i][j]));
+            if (pruning && mixProb[i][j] == 0.0) continue;
+            for (int k = 0; k < STATE_DIM; ++k)
+                x0j[j][k] += state.modelStates[i][k] * mixProb[i][j];
         }
     }
 
     for (int j = 0; j < IMM_NUM_MODELS; ++j) {
-        P0j[j] = matZero();
+        if (!(active & (1u << j))) continue;
+        P0j[j] = SymStateMatrix{};
         for (int i = 0; i < IMM_NUM_MODELS; ++i) {
+            if (pruning && mixProb[i][j] == 0.0) continue;
             StateVector diff = mat::sub(state.modelStates[i], x0j[j]);
-            StateMatrix spread = mat::outerProduct(diff, diff);
-            StateMatrix weighted = mat::addMat(state.modelCovariances[i], spread);
-            P0j[j] = mat::addMat(P0j[j], mat::scaleMat(weighted, mixProb[i][j]));
+            mat::accumulateMoment(P0j[j], mixProb[i][j], state.modelCovariances[i], diff);
         }
     }
 
-    state.modelStates = x0j;
-    state.modelCovariances = P0j;
+    for (int j = 0; j < IMM_NUM_MODELS; ++j) {
+        if (!(active & (1u << j))) continue;
+        state.modelStates[j] = x0j[j];
+        state.modelCovariances[j] = P0j[j];
+    }
 }
 
-void IMMFilter::modelPredictions(double dt, IMMState& state) const {
+void IMMFilter::modelPredictions(double dt, IMMState& state, uint32_t active) const {
     for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+        if (!(active & (1u << m))) continue;
         StateVector xPred;
-        StateMatrix PPred;
-        models_[m]->predict(state.modelStates[m], state.modelCovariances[m],
-                            dt, xPred, PPred);
+        SymStateMatrix PPred;
+        visitModel(m, [&](const auto& model) {
+            model.predict(state.modelStates[m], state.modelCovariances[m], dt, xPred, PPred);
+        });
         state.modelStates[m] = xPred;
         state.modelCovariances[m] = PPred;
     }
 }
 
+void IMMFilter::prepare(double dt) {
+    cv_.prepare(dt);
+    ca1_.prepare(dt);
+    ca2_.prepare(dt);
+    ctr1_.prepare(dt);
+    ctr2_.prepare(dt);
+}
+
 void IMMFilter::predict(double dt, IMMState& state) const {
-    interaction(state);
-    modelPredictions(dt, state);
+    CUAS_PROFILE_ZONE("IMMFilter::predict");
+    const uint32_t active = activeModels(state.modeProbabilities);
+    interaction(state, active);
+    modelPredictions(dt, state, active);
     mergeEstimates(state);
 
     LOG_TRACE("IMMFilter", "Predict dt=%.4f, probs=[%.3f,%.3f,%.3f,%.3f,%.3f]",
@@ -109,32 +116,59 @@ void IMMFilter::predict(double dt, IMMState& state) const {
               state.modeProbabilities[4]);
 }
 
-double IMMFilter::modelLikelihood(int modelIdx, const IMMState& state,
-                                   const MeasVector& z, const MeasMatrix& R) const {
-    MeasStateMatrix H = getMeasurementMatrix();
-    MeasVector zPred = mat::measFromState(H, state.modelStates[modelIdx]);
-    MeasVector innov = mat::measSub(z, zPred);
-    MeasMatrix S = mat::measAddMat(mat::hpht(H, state.modelCovariances[modelIdx]), R);
-
-    double detS = mat::det3x3(S);
-    if (detS < 1e-30) return 1e-30;
+// Gaussian log-likelihood of an innovation with Mahalanobis distance d2
+// under S; stays finite where the likelihood itself would underflow.
+double IMMFilter::logLikelihood(const InnovationStats& s, double d2) {
+    return -0.5 * (MEAS_DIM * std::log(2.0 * 3.14159265358979) + s.logDetS + d2);
+}
 
-    MeasMatrix Sinv;
-    if (!mat::invertMeas(S, Sinv)) return 1e-30;
+uint32_t IMMFilter::activeModels(const std::array<double, IMM_NUM_MODELS>& modeProbs) const {
+    constexpr uint32_t ALL = (1u << IMM_NUM_MODELS) - 1;
+    if (!(config_.imm.pruneFloor > 0.0)) return ALL;
 
-    double d = mat::mahalanobisDistance(innov, Sinv);
-    double logLik = -0.5 * (MEAS_DIM * std::log(2.0 * 3.14159265358979) +
-                            std::log(detS) + d);
-    return std::exp(logLik);
+    uint32_t active = 0;
+    for (int j = 0; j < IMM_NUM_MODELS; ++j) {
+        if (modeProbs[j] > 0.0) { active |= 1u << j; continue; }
+        double cBar = 0.0;
+        for (int i = 0; i < IMM_NUM_MODELS; ++i)
+            cBar += transMatrix_[i][j] * modeProbs[i];
+        if (cBar >= config_.imm.reactivatePrior) active |= 1u << j;
+    }
+    return active;
 }
 
-void IMMFilter::updateModeProbabilities(IMMState& state, const MeasVector& z,
-                                         const MeasMatrix& R) const {
-    std::array<double, IMM_NUM_MODELS> likelihoods;
-    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
-        likelihoods[m] = modelLikelihood(m, state, z, R);
+// Freezes the models whose updated probability fell under the floor (the
+// most probable model never is), then, if even the best-fitting active
+// model's innovation failed the reactivation gate, thaws every frozen model
+// at the floor, re-seeded from the merged estimate so its stale state does
+// not enter the next mixing.  Called after mergeEstimates(); a model placed
+// at the merged estimate leaves the merge unchanged.
+void IMMFilter::pruneModes(IMMState& state, double bestD2) const {
+    const double floor = config_.imm.pruneFloor;
+    auto& mu = state.modeProbabilities;
+    int best = static_cast<int>(std::max_element(mu.begin(), mu.end()) - mu.begin());
+
+    double total = 0.0;
+    for (int j = 0; j < IMM_NUM_MODELS; ++j) {
+        if (j != best && mu[j] < floor) mu[j] = 0.0;
+        total += mu[j];
     }
 
+    if (bestD2 > config_.imm.reactivateGate) {
+        for (int j = 0; j < IMM_NUM_MODELS; ++j) {
+            if (mu[j] > 0.0) continue;
+            mu[j] = floor;
+            total += floor;
+            state.modelStates[j] = state.mergedState;
+            state.modelCovariances[j] = state.mergedCovariance;
+        }
+    }
+
+    for (int j = 0; j < IMM_NUM_MODELS; ++j) mu[j] /= total;
+}
+
+void IMMFilter::updateModeProbabilities(IMMState& state,
+                                         const std::array<double, IMM_NUM_MODELS>& logLik) const {
     // Predicted mode probabilities
     std::array<double, IMM_NUM_MODELS> cBar;
     cBar.fill(0.0);
@@ -142,15 +176,23 @@ void IMMFilter::updateModeProbabilities(IMMState& state, const MeasVector& z,
         for (int i = 0; i < IMM_NUM_MODELS; ++i)
             cBar[j] += transMatrix_[i][j] * state.modeProbabilities[i];
 
-    double totalLik = 0.0;
+    // mu_j ~ L_j * cBar_j, normalised in the log domain.
+    std::array<double, IMM_NUM_MODELS> logW;
+    double maxLogW = -std::numeric_limits<double>::infinity();
     for (int j = 0; j < IMM_NUM_MODELS; ++j) {
-        state.modeProbabilities[j] = likelihoods[j] * cBar[j];
-        totalLik += state.modeProbabilities[j];
+        logW[j] = cBar[j] > 0.0 ? logLik[j] + std::log(cBar[j])
+                                : -std::numeric_limits<double>::infinity();
+        maxLogW = std::max(maxLogW, logW[j]);
     }
 
-    if (totalLik > 1e-30) {
+    if (std::isfinite(maxLogW)) {
+        double total = 0.0;
+        for (int j = 0; j < IMM_NUM_MODELS; ++j) {
+            state.modeProbabilities[j] = std::exp(logW[j] - maxLogW);
+            total += state.modeProbabilities[j];
+        }
         for (int j = 0; j < IMM_NUM_MODELS; ++j)
-            state.modeProbabilities[j] /= totalLik;
+            state.modeProbabilities[j] /= total;
     } else {
         for (int j = 0; j < IMM_NUM_MODELS; ++j)
             state.modeProbabilities[j] = 1.0 / IMM_NUM_MODELS;
@@ -158,37 +200,54 @@ void IMMFilter::updateModeProbabilities(IMMState& state, const MeasVector& z,
 }
 
 void IMMFilter::update(IMMState& state, const MeasVector& z, const MeasMatrix& R) const {
-    MeasStateMatrix H = getMeasurementMatrix();
+    CUAS_PROFILE_ZONE("IMMFilter::update");
+    // Each model's innovation statistics are taken from its prediction once
+    // and shared by the Kalman gain and the mode likelihood.  A model whose
+    // S is not positive definite keeps its prediction and gets the floor
+    // likelihood.
+    static constexpr double LOG_LIK_FLOOR = -69.07755278982137;   // log(1e-30)
+    std::array<double, IMM_NUM_MODELS> logLik;
+    const uint32_t active = activeModels(state.modeProbabilities);
+    double bestD2 = std::numeric_limits<double>::infinity();
 
-    // Update each model with standard Kalman update
     for (int m = 0; m < IMM_NUM_MODELS; ++m) {
-        MeasVector zPred = mat::measFromState(H, state.modelStates[m]);
-        MeasVector innov = mat::measSub(z, zPred);
+        if (!(active & (1u << m))) {
+            logLik[m] = -std::numeric_limits<double>::infinity();   // frozen: stays at 0
+            continue;
+        }
+        InnovationStats inn = innovationStats(state.modelStates[m],
+                                              state.modelCovariances[m], R);
+        if (!inn.valid) {
+            logLik[m] = LOG_LIK_FLOOR;
+            continue;
+        }
+        MeasVector innov = mat::measSub(z, inn.zPred);
+        double d2 = mat::mahalanobisDistance(innov, inn.Sinv);
+        bestD2 = std::min(bestD2, d2);
+        logLik[m] = logLikelihood(inn, d2);
 
-        MeasMatrix S = mat::measAddMat(mat::hpht(H, state.modelCovariances[m]), R);
-        MeasMatrix Sinv;
-        if (!mat::invertMeas(S, Sinv)) continue;
+        // Falls through to the Joseph form if P has lost definiteness.
+        if (config_.imm.covarianceUpdate == CovarianceUpdate::Bierman &&
+            Measurement::biermanUpdate(state.modelStates[m], state.modelCovariances[m], z, R))
+            continue;
 
-        auto PHt = mat::pht(state.modelCovariances[m], H);
-        auto K = mat::kalmanGain(PHt, Sinv);
+        auto PHt = Measurement::pht(state.modelCovariances[m]);
+        auto K = mat::kalmanGain(PHt, inn.Sinv);
 
         StateVector correction = mat::kalmanCorrection(K, innov);
         state.modelStates[m] = mat::add(state.modelStates[m], correction);
 
-        StateMatrix KH = mat::kh(K, H);
-        StateMatrix IminKH = mat::subMat(matIdentity(), KH);
         // Joseph form: P = (I-KH) P (I-KH)^T + K R K^T
         // Prevents P losing positive-definiteness under repeated sequential
         // updates (a common failure mode of the simplified (I-KH)P form).
-        StateMatrix IminKHt = mat::transpose(IminKH);
-        StateMatrix term1 = mat::multiply(
-            mat::multiply(IminKH, state.modelCovariances[m]), IminKHt);
-        StateMatrix term2 = mat::krkt(K, R);
-        state.modelCovariances[m] = mat::addMat(term1, term2);
+        // H only selects positions, so this runs as two rank-3 corrections.
+        state.modelCovariances[m] =
+            Measurement::josephUpdate(state.modelCovariances[m], K, R);
     }
 
-    updateModeProbabilities(state, z, R);
+    updateModeProbabilities(state, logLik);
     mergeEstimates(state);
+    if (config_.imm.pruneFloor > 0.0) pruneModes(state, bestD2);
 
     LOG_TRACE("IMMFilter", "Update probs=[%.3f,%.3f,%.3f,%.3f,%.3f]",
               state.modeProbabilities[0], state.modeProbabilities[1],
@@ -196,35 +255,36 @@ void IMMFilter::update(IMMState& state, const MeasVector& z, const MeasMatrix& R
               state.modeProbabilities[4]);
 }
 
-MeasMatrix IMMFilter::getInnovationCovariance(const IMMState& state,
+MeasMatrix IMMFilter::getInnovationCovariance(const SymStateMatrix& P,
                                                const MeasMatrix& R) const {
-    MeasStateMatrix H = getMeasurementMatrix();
-    MeasMatrix S = mat::measAddMat(mat::hpht(H, state.mergedCovariance), R);
-    return S;
+    return mat::measAddMat(Measurement::hpht(P), R);
 }
 
-MeasVector IMMFilter::getInnovation(const IMMState& state, const MeasVector& z) const {
-    MeasStateMatrix H = getMeasurementMatrix();
-    MeasVector zPred = mat::measFromState(H, state.mergedState);
-    return mat::measSub(z, zPred);
+MeasVector IMMFilter::getInnovation(const StateVector& x, const MeasVector& z) const {
+    return mat::measSub(z, Measurement::predict(x));
+}
+
+InnovationStats IMMFilter::innovationStats(const StateVector& x, const SymStateMatrix& P,
+                                           const MeasMatrix& R) const {
+    InnovationStats s;
+    s.zPred = Measurement::predict(x);
+    MeasMatrix S = getInnovationCovariance(P, R);
+    for (int m = 0; m < MEAS_DIM; ++m) s.sDiag[m] = S[m][m];
+    s.valid = mat::invertSPD3(S, s.Sinv, s.logDetS);
+    return s;
 }
 
 void IMMFilter::mergeEstimates(IMMState& state) {
     state.mergedState = stateZero();
-    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
-        state.mergedState = mat::add(state.mergedState,
-                                     mat::scale(state.modelStates[m],
-                                                state.modeProbabilities[m]));
-    }
+    for (int m = 0; m < IMM_NUM_MODELS; ++m)
+        for (int k = 0; k < STATE_DIM; ++k)
+            state.mergedState[k] += state.modelStates[m][k] * state.modeProbabilities[m];
 
-    state.mergedCovariance = matZero();
+    state.mergedCovariance = SymStateMatrix{};
     for (int m = 0; m < IMM_NUM_MODELS; ++m) {
         StateVector diff = mat::sub(state.modelStates[m], state.mergedState);
-        StateMatrix spread = mat::outerProduct(diff, diff);
-        StateMatrix weighted = mat::addMat(state.modelCovariances[m], spread);
-        state.mergedCovariance = mat::addMat(state.mergedCovariance,
-                                              mat::scaleMat(weighted,
-                                                            state.modeProbabilities[m]));
+        mat::accumulateMoment(state.mergedCovariance, state.modeProbabilities[m],
+                              state.modelCovariances[m], diff);
     }
 }
 
@@ -0,0 +1,94 @@
+#include "preprocessing/clutter_map.h"
+#include "common/logger.h"
+#include <algorithm>
+#include <cmath>
+
+namespace cuas {
+
+namespace {
+
+// Grids beyond this many cells are refused (8 bytes each).
+constexpr size_t MAX_CELLS = size_t(1) << 24;
+
+int cellCount(double lo, double hi, double cell) {
+    if (!(cell > 0.0) || !(hi > lo)) return 0;
+    return static_cast<int>(std::ceil((hi - lo) / cell));
+}
+
+} // namespace
+
+ClutterMap::ClutterMap(const PreprocessConfig& cfg)
+    : config_(cfg.clutterMap),
+      minRange_(cfg.minRange), minAzimuth_(cfg.minAzimuth), minElevation_(cfg.minElevation) {
+    const double maxElevation = std::min(cfg.maxElevation, config_.maxElevation);
+    numRange_     = cellCount(cfg.minRange, cfg.maxRange, config_.rangeCell);
+    numAzimuth_   = cellCount(cfg.minAzimuth, cfg.maxAzimuth, config_.azimuthCell);
+    numElevation_ = cellCount(cfg.minElevation, maxElevation, config_.elevationCell);
+
+    const size_t cells = size_t(numRange_) * numAzimuth_ * numElevation_;
+    if (cells > MAX_CELLS) {
+        LOG_WARN("ClutterMap", "%dx%dx%d cells exceeds %zu; clutter map disabled",
+                 numRange_, numAzimuth_, numElevation_, MAX_CELLS);
+        numRange_ = numAzimuth_ = numElevation_ = 0;
+    }
+    cells_.assign(size_t(numRange_) * numAzimuth_ * numElevation_, Cell{});
+
+    const double keep = 1.0 - config_.alpha;
+    for (double w = 1.0; w > 1e-6 && decay_.size() < 100000; w *= keep)
+        decay_.push_back(static_cast<float>(w));
+
+    LOG_INFO("ClutterMap", "%dx%dx%d cells (%.1f MB), alpha %.3f, threshold %.2f",
+             numRange_, numAzimuth_, numElevation_,
+             cells_.size() * sizeof(Cell) / (1024.0 * 1024.0), config_.alpha,
+             config_.threshold);
+}
+
+int64_t ClutterMap::cellOf(const Detection& d) const {
+    const double r = (d.range - minRange_) / config_.rangeCell;
+    const double a = (d.azimuth - minAzimuth_) / config_.azimuthCell;
+    const double e = (d.elevation - minElevation_) / config_.elevationCell;
+    // Negated tests so NaN fields fall outside the map.
+    if (!(r >= 0.0 && r < numRange_ && a >= 0.0 && a < numAzimuth_ &&
+          e >= 0.0 && e < numElevation_))
+        return -1;
+    return (static_cast<int64_t>(r) * numAzimuth_ + static_cast<int64_t>(a)) * numElevation_ +
+           static_cast<int64_t>(e);
+}
+
+float ClutterMap::history(const Cell& c) const {
+    // Dwells since the update, before this one, had no hit.
+    const uint32_t misses = ((dwell_ - c.lastDwell) & DWELL_MASK) - 1;
+    return misses < decay_.size() ? c.density * decay_[misses] : 0.0f;
+}
+
+void ClutterMap::filter(std::vector<Detection>& dets) {
+    if (cells_.empty()) return;
+    dwell_ = (dwell_ + 1) & DWELL_MASK;
+
+    size_t kept = 0;
+    for (size_t i = 0; i < dets.size(); ++i) {
+        const int64_t idx = cellOf(dets[i]);
+        bool clutter = false;
+        if (idx >= 0) {
+            Cell& c = cells_[idx];
+            // Several detections in one cell count as one hit per dwell;
+            // the cell is judged on the dwells before this one.
+            if (c.lastDwell != dwell_) {
+                const float prior = history(c);
+                c.clutter   = prior >= config_.threshold;
+                c.density   = prior + static_cast<float>(config_.alpha) * (1.0f - prior);
+                c.lastDwell = dwell_;
+            }
+            clutter = c.clutter;
+        }
+        dets[kept] = dets[i];
+        kept += !clutter;
+    }
+
+    suppressed_ += dets.size() - kept;
+    LOG_DEBUG("ClutterMap", "Dwell %u: %zu of %zu detections in clutter cells",
+              dwell_, dets.size() - kept, dets.size());
+    dets.resize(kept);
+}
+
+} // namespace cuas
@@ -0,0 +1,50 @@
+#include "preprocessing/detection_budget.h"
+#include "common/logger.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace cuas {
+
+DetectionBudget::DetectionBudget(size_t maxDetections) : limit_(maxDetections) {}
+
+namespace {
+
+// NaN would break nth_element's ordering; rank it below everything.
+inline double rankable(double v) {
+    return std::isnan(v) ? -std::numeric_limits<double>::infinity() : v;
+}
+
+} // namespace
+
+void DetectionBudget::apply(std::vector<Detection>& dets) {
+    const size_t n = dets.size();
+    if (n <= limit_) return;
+
+    keys_.resize(n);
+    for (size_t i = 0; i < n; ++i)
+        keys_[i] = {rankable(dets[i].snr), rankable(dets[i].strength),
+                    static_cast<uint32_t>(i)};
+    std::nth_element(keys_.begin(), keys_.begin() + limit_, keys_.end(),
+                     [](const Key& a, const Key& b) {
+                         if (a.snr != b.snr)           return a.snr > b.snr;
+                         if (a.strength != b.strength) return a.strength > b.strength;
+                         return a.index < b.index;
+                     });
+
+    keep_.assign(n, 0);
+    for (size_t k = 0; k < limit_; ++k) keep_[keys_[k].index] = 1;
+
+    size_t kept = 0;
+    for (size_t i = 0; i < n; ++i) {
+        dets[kept] = dets[i];
+        kept += keep_[i];
+    }
+    dets.resize(kept);
+
+    dropped_ += n - kept;
+    LOG_DEBUG("DetectionBudget", "Dwell over budget: kept %zu of %zu detections",
+              kept, n);
+}
+
+} // namespace cuas
@@ -1,41 +1,65 @@
 #include "preprocessing/preprocessor.h"
 #include "common/logger.h"
+#include "common/matrix_ops.h"
 
 namespace cuas {
 
 Preprocessor::Preprocessor(const PreprocessConfig& cfg)
     : config_(cfg) {}
 
-bool Preprocessor::isValid(const Detection& d) const {
-    if (d.range < config_.minRange || d.range > config_.maxRange) return false;
-    if (d.azimuth < config_.minAzimuth || d.azimuth > config_.maxAzimuth) return false;
-    if (d.elevation < config_.minElevation || d.elevation > config_.maxElevation) return false;
-    if (d.snr < config_.minSNR || d.snr > config_.maxSNR) return false;
-    if (d.rcs < config_.minRCS || d.rcs > config_.maxRCS) return false;
-    if (d.strength < config_.minStrength || d.strength > config_.maxStrength) return false;
-    return true;
+namespace {
+
+// !(v < lo) & !(v > hi) rather than (v >= lo) & (v <= hi): a NaN field
+// passes, as it always has with the early-out comparisons.
+inline uint8_t within(double v, double lo, double hi) {
+    return static_cast<uint8_t>(!(v < lo) & !(v > hi));
 }
 
-std::vector<Detection> Preprocessor::process(const std::vector<Detection>& raw) const {
-    std::vector<Detection> filtered;
-    filtered.reserve(raw.size());
+// Branchless gate, one mask byte per detection; compiled per ISA so the
+// loop runs gathered over the AoS records.
+CUAS_MATH_KERNEL
+void gate(const Detection* d, size_t n, const PreprocessConfig& cfg, double snrFloor,
+          uint8_t* keep) {
+    for (size_t i = 0; i < n; ++i) {
+        keep[i] = within(d[i].range,     cfg.minRange,     cfg.maxRange) &
+                  within(d[i].azimuth,   cfg.minAzimuth,   cfg.maxAzimuth) &
+                  within(d[i].elevation, cfg.minElevation, cfg.maxElevation) &
+                  within(d[i].snr,       cfg.minSNR,       cfg.maxSNR) &
+                  static_cast<uint8_t>(!(d[i].snr < snrFloor)) &
+                  within(d[i].rcs,       cfg.minRCS,       cfg.maxRCS) &
+                  within(d[i].strength,  cfg.minStrength,  cfg.maxStrength);
+    }
+}
 
-    uint64_t rejectedInThisBatch = 0;
+} // namespace
 
-    for (const auto& d : raw) {
-        if (isValid(d)) {
-            filtered.push_back(d);
-        } else {
-            ++rejectedInThisBatch;
-        }
+void Preprocessor::process(DetectionView raw, std::vector<Detection>& filtered) const {
+    const size_t n = raw.size;
+    keep_.resize(n);
+    selected_.resize(n);
+    gate(raw.data, n, config_, snrFloor_.load(std::memory_order_relaxed), keep_.data());
+
+    // Compact to an index list without a data-dependent branch, then copy
+    // the survivors once.
+    size_t passed = 0;
+    for (size_t i = 0; i < n; ++i) {
+        selected_[passed] = static_cast<uint32_t>(i);
+        passed += keep_[i];
     }
+    filtered.resize(passed);
+    for (size_t k = 0; k < passed; ++k) filtered[k] = raw.data[selected_[k]];
 
+    uint64_t rejectedInThisBatch = n - passed;
     rejected_ += rejectedInThisBatch;
 
     LOG_DEBUG("Preprocessor", "Input: %zu, Passed: %zu, Rejected: %lu",
-              raw.size(), filtered.size(),
+              raw.size, filtered.size(),
               static_cast<unsigned long>(rejectedInThisBatch));
+}
 
+std::vector<Detection> Preprocessor::process(const std::vector<Detection>& raw) const {
+    std::vector<Detection> filtered;
+    process(DetectionView(raw), filtered);
     return filtered;
 }
 
@@ -1,43 +1,87 @@
 #include "receiver/detection_receiver.h"
 #include "common/constants.h"
 #include "common/logger.h"
+#include "common/profiling.h"
 
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
 
+#include <string>
+
 namespace cuas {
 
 DetectionReceiver::DetectionReceiver(CuasDdsParticipant& participant,
-                                     const std::string& topicName) {
+                                     const std::string& topicName,
+                                     const std::vector<uint32_t>& sensorIds) {
+    // "sensorId = %0 OR sensorId = %1 ..." over the lane sensor IDs; empty
+    // (no filter) when every sensor is wanted.
+    std::string expression;
+    std::vector<std::string> parameters;
+    for (uint32_t id : sensorIds) {
+        if (!expression.empty()) expression += " OR ";
+        expression += "sensorId = %" + std::to_string(parameters.size());
+        parameters.push_back(std::to_string(id));
+    }
+
     // Register the SPDetectionMessage type and create the DataReader.
     // The listener (this) will be invoked on the DDS thread whenever
-    // new data arrives on the topic.
-    participant.makeReader<CounterUAS::SPDetectionMessage>(topicName, this);
-    LOG_INFO("Receiver", "DDS subscriber created on topic '%s'", topicName.c_str());
+    // new data arrives on the topic.  The frame reader gets its listener
+    // last, so on_data_available() always sees frameReader_ set.
+    if (participant.config().zeroCopy)
+        frameReader_ = participant.makeFilteredReader<CounterUAS::SPDetectionFrame>(
+            TOPIC_SP_DETECTION_FRAME, expression, parameters);
+    bool filtered = false;
+    participant.makeFilteredReader<CounterUAS::SPDetectionMessage>(
+        topicName, expression, parameters, this, &filtered);
+    LOG_INFO("Receiver", "DDS subscriber created on topic '%s'%s", topicName.c_str(),
+             filtered ? " (filtered by sensorId)" : "");
+    if (frameReader_) {
+        frameReader_->set_listener(this);
+        LOG_INFO("Receiver", "Zero-copy subscriber created on topic '%s'",
+                 TOPIC_SP_DETECTION_FRAME);
+    }
 }
 
 void DetectionReceiver::on_data_available(
     eprosima::fastdds::dds::DataReader* reader) {
+    CUAS_PROFILE_ZONE("receive (DDS)");
+
+    std::unique_lock<std::mutex> lock(readMutex_, std::defer_lock);
+    if (frameReader_) lock.lock();
+
+    if (reader == frameReader_) {
+        takeLoaned<CounterUAS::SPDetectionFrame>(reader,
+            [this](const CounterUAS::SPDetectionFrame& frame,
+                   const eprosima::fastdds::dds::SampleInfo&) {
+                toInternal(frame, msg_);
+                deliver();
+            });
+        return;
+    }
 
-    CounterUAS::SPDetectionMessage idlMsg;
     eprosima::fastdds::dds::SampleInfo info;
 
     while (eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK ==
-           reader->take_next_sample(&idlMsg, &info)) {
+           reader->take_next_sample(&idlMsg_, &info)) {
 
         if (!info.valid_data) continue;
 
-        // Convert from IDL wire type to internal pipeline type.
-        SPDetectionMessage msg = toInternal(idlMsg);
+        // Convert from IDL wire type to internal pipeline type, in place.
+        toInternal(idlMsg_, msg_);
+        deliver();
+    }
+}
+
+void DetectionReceiver::deliver() {
+    msg_.receivedAt = nowMicros();
 
-        msgCount_.fetch_add(1);
-        detCount_.fetch_add(msg.numDetections);
+    msgCount_.fetch_add(1);
+    detCount_.fetch_add(msg_.numDetections);
 
-        LOG_DEBUG("Receiver", "Dwell %u: %u detections (DDS topic)",
-                  msg.dwellCount, msg.numDetections);
+    LOG_DEBUG("Receiver", "Dwell %u: %u detections (DDS topic)",
+              msg_.dwellCount, msg_.numDetections);
 
-        if (callback_) {
-            callback_(msg);
-        }
+    if (callback_) {
+        callback_(msg_);
     }
 }
 
@@ -0,0 +1,116 @@
+#include "receiver/udp_detection_receiver.h"
+#include "common/logger.h"
+#include "common/profiling.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace cuas {
+
+static_assert(sizeof(Detection) == 64, "legacy UDP dwell layout assumes 8 packed doubles");
+
+// Short enough that the threads notice shutdown promptly.
+static constexpr int RECEIVE_TIMEOUT_MS = 100;
+
+UdpDetectionReceiver::UdpDetectionReceiver(const NetworkConfig& cfg, Callback callback)
+    : callback_(std::move(callback)), udp_(cfg.udp) {
+    udp_.batch   = std::max(1, std::min(udp_.batch, UdpSocket::MAX_BATCH));
+    udp_.threads = std::max(1, udp_.threads);
+
+    for (int i = 0; i < udp_.threads; ++i) {
+        auto sock = std::make_unique<UdpSocket>();
+        if (udp_.threads > 1 && !sock->setReusePort(true)) {
+            LOG_WARN("UdpReceiver", "SO_REUSEPORT unavailable, using one receive thread");
+            if (i > 0) break;
+            udp_.threads = 1;
+        }
+        sock->setBufferSize(cfg.receiveBufferSize, cfg.sendBufferSize);
+        sock->setReceiveTimeout(RECEIVE_TIMEOUT_MS);
+        if (!sock->bindSocket(cfg.receiverIp, cfg.receiverPort)) {
+            if (i == 0)
+                throw std::runtime_error("UDP ingest: cannot bind " + cfg.receiverIp + ":" +
+                                         std::to_string(cfg.receiverPort));
+            break;
+        }
+        if (sock->receiveBufferSize() < cfg.receiveBufferSize)
+            LOG_WARN("UdpReceiver", "SO_RCVBUF is %d bytes, %d asked (raise net.core.rmem_max)",
+                     sock->receiveBufferSize(), cfg.receiveBufferSize);
+        sockets_.push_back(std::move(sock));
+    }
+
+    running_.store(true);
+    for (size_t i = 0; i < sockets_.size(); ++i)
+        threads_.emplace_back(&UdpDetectionReceiver::receiveLoop, this, i);
+
+    LOG_INFO("UdpReceiver", "UDP ingest on %s:%d: %zu thread(s), %d datagrams per call, sensor %u",
+             cfg.receiverIp.c_str(), cfg.receiverPort, sockets_.size(), udp_.batch,
+             udp_.sensorId);
+}
+
+UdpDetectionReceiver::~UdpDetectionReceiver() {
+    running_.store(false);
+    for (auto& t : threads_)
+        if (t.joinable()) t.join();
+    if (rejected_.load() > 0)
+        LOG_WARN("UdpReceiver", "%lu malformed datagram(s) dropped",
+                 static_cast<unsigned long>(rejected_.load()));
+}
+
+bool UdpDetectionReceiver::parse(const uint8_t* data, size_t size, SPDetectionMessage& msg) {
+    if (size < HEADER_BYTES) return false;
+    uint32_t n = 0;
+    std::memcpy(&n, data + 16, 4);
+    if ((size - HEADER_BYTES) / sizeof(Detection) != n ||
+        (size - HEADER_BYTES) % sizeof(Detection) != 0) return false;
+
+    std::memcpy(&msg.messageId,  data,     4);
+    std::memcpy(&msg.dwellCount, data + 4, 4);
+    std::memcpy(&msg.timestamp,  data + 8, 8);
+    msg.numDetections = n;
+    msg.detections.resize(n);
+    if (n > 0)
+        std::memcpy(msg.detections.data(), data + HEADER_BYTES, n * sizeof(Detection));
+    return true;
+}
+
+void UdpDetectionReceiver::receiveLoop(size_t index) {
+    UdpSocket& sock = *sockets_[index];
+    CUAS_PROFILE_THREAD("udp receive");
+
+    // Per-thread, reused for every batch: the datagram slots and the dwell
+    // the callback swaps out (leaving a drained buffer to parse into next).
+    std::vector<uint8_t> slots(static_cast<size_t>(udp_.batch) * DATAGRAM_BYTES);
+    std::vector<int>     lengths(static_cast<size_t>(udp_.batch));
+    SPDetectionMessage   msg;
+
+    while (running_.load(std::memory_order_relaxed)) {
+        int n = sock.receiveBatch(slots.data(), DATAGRAM_BYTES, udp_.batch, lengths.data());
+        if (n < 0) {
+            LOG_ERROR("UdpReceiver", "Receive failed on thread %zu, stopping it", index);
+            return;
+        }
+        for (int i = 0; i < n; ++i) {
+            CUAS_PROFILE_ZONE("receive (UDP)");
+            const uint8_t* data = slots.data() + static_cast<size_t>(i) * DATAGRAM_BYTES;
+            if (lengths[i] < 0 || !parse(data, static_cast<size_t>(lengths[i]), msg)) {
+                if (rejected_.fetch_add(1) == 0)
+                    LOG_WARN("UdpReceiver", "Malformed datagram (%d bytes) dropped", lengths[i]);
+                continue;
+            }
+            msg.sensorId   = udp_.sensorId;
+            msg.receivedAt = nowMicros();
+
+            msgCount_.fetch_add(1);
+            detCount_.fetch_add(msg.numDetections);
+            LOG_DEBUG("UdpReceiver", "Dwell %u: %u detections (UDP)",
+                      msg.dwellCount, msg.numDetections);
+
+            CUAS_PROFILE_LOCK(deliverMutex_, "deliverMutex_ wait");
+            std::lock_guard<std::mutex> lock(deliverMutex_, std::adopt_lock);
+            callback_(msg);
+        }
+    }
+}
+
+} // namespace cuas
@@ -1,49 +1,180 @@
 #include "sender/track_sender.h"
 #include "common/constants.h"
 #include "common/logger.h"
+#include "common/profiling.h"
+#include <fastdds/dds/topic/Topic.hpp>
+#include <algorithm>
+#include <cmath>
 
 namespace cuas {
 
 TrackSender::TrackSender(CuasDdsParticipant& participant,
-                         const DisplayConfig& dispCfg)
-    : dispConfig_(dispCfg) {
+                         const DisplayConfig& dispCfg,
+                         StageTimings* timings,
+                         size_t numLanes)
+    : dispConfig_(dispCfg), timings_(timings),
+      delta_(std::max<size_t>(1, numLanes)),
+      pending_(std::max<size_t>(1, numLanes)) {
     writerTrackTable_     = participant.makeWriter<CounterUAS::TrackTableMessage>(
                                 TOPIC_TRACK_TABLE);
-    writerSPDetection_    = participant.makeWriter<CounterUAS::SPDetectionMessage>(
-                                TOPIC_SP_DETECTION);
+    // Raw forward and debug tables: this listener counts their readers, so
+    // nothing is built for a topic without one.
+    writerRawDisplay_     = participant.makeWriter<CounterUAS::SPDetectionMessage>(
+                                TOPIC_SP_DETECTION_DISPLAY, std::string(), this);
     writerClusterTable_   = participant.makeWriter<CounterUAS::ClusterTableMessage>(
-                                TOPIC_CLUSTER_TABLE);
+                                TOPIC_CLUSTER_TABLE, std::string(), this);
     writerAssocTable_     = participant.makeWriter<CounterUAS::AssocTableMessage>(
-                                TOPIC_ASSOC_TABLE);
+                                TOPIC_ASSOC_TABLE, std::string(), this);
     writerPredictedTable_ = participant.makeWriter<CounterUAS::PredictedTableMessage>(
-                                TOPIC_PREDICTED_TABLE);
+                                TOPIC_PREDICTED_TABLE, std::string(), this);
+    writerPipelineStats_  = participant.makeWriter<CounterUAS::PipelineStatsMessage>(
+                                TOPIC_PIPELINE_STATS);
+    writerTrackerHealth_  = participant.makeWriter<CounterUAS::TrackerHealthMessage>(
+                                TOPIC_TRACKER_HEALTH);
+    if (participant.config().zeroCopy) {
+        writerTrackFrame_ = participant.makeWriter<CounterUAS::TrackTableFrame>(
+                                TOPIC_TRACK_TABLE_FRAME);
+        LOG_INFO("TrackSender", "Zero-copy track tables on '%s' (up to %u tracks)",
+                 TOPIC_TRACK_TABLE_FRAME, CounterUAS::FRAME_MAX_TRACKS);
+    }
+    if (dispConfig_.deltaPublish) {
+        writerTrackUpdate_ = participant.makeWriter<CounterUAS::TrackUpdateMessage>(
+                                 TOPIC_TRACK_UPDATE);
+        LOG_INFO("TrackSender", "Delta track publishing on '%s' (%.1f m, %.1f m/s, refresh %d ms)",
+                 TOPIC_TRACK_UPDATE, dispConfig_.deltaPositionM,
+                 dispConfig_.deltaVelocityMps, dispConfig_.updateRateMs);
+    }
+
+    LOG_INFO("TrackSender", "DDS publishers created on topics: %s, %s, %s, %s, %s, %s, %s",
+             TOPIC_TRACK_TABLE, TOPIC_SP_DETECTION_DISPLAY,
+             TOPIC_CLUSTER_TABLE, TOPIC_ASSOC_TABLE, TOPIC_PREDICTED_TABLE,
+             TOPIC_PIPELINE_STATS, TOPIC_TRACKER_HEALTH);
+
+    if (dispConfig_.asyncPublish) {
+        publisherThread_ = std::thread(&TrackSender::publisherLoop, this);
+        LOG_INFO("TrackSender", "Asynchronous publishing enabled");
+    }
+}
 
-    LOG_INFO("TrackSender", "DDS publishers created on topics: %s, %s, %s, %s, %s",
-             TOPIC_TRACK_TABLE, TOPIC_SP_DETECTION,
-             TOPIC_CLUSTER_TABLE, TOPIC_ASSOC_TABLE, TOPIC_PREDICTED_TABLE);
+TrackSender::~TrackSender() {
+    if (publisherThread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(asyncMutex_);
+            stopping_ = true;
+        }
+        asyncCV_.notify_one();
+        publisherThread_.join();
+    }
+    // The writers outlive this object until the participant goes.
+    writerRawDisplay_->set_listener(nullptr);
+    writerClusterTable_->set_listener(nullptr);
+    writerAssocTable_->set_listener(nullptr);
+    writerPredictedTable_->set_listener(nullptr);
+}
+
+uint32_t TrackSender::debugTables() const {
+    uint32_t tables = 0;
+    if (clusterReaders_.load(std::memory_order_relaxed) > 0)   tables |= DEBUG_TABLE_CLUSTERS;
+    if (predictedReaders_.load(std::memory_order_relaxed) > 0) tables |= DEBUG_TABLE_PREDICTED;
+    if (assocReaders_.load(std::memory_order_relaxed) > 0)     tables |= DEBUG_TABLE_ASSOC;
+    return tables;
+}
+
+void TrackSender::on_publication_matched(
+    eprosima::fastdds::dds::DataWriter* writer,
+    const eprosima::fastdds::dds::PublicationMatchedStatus& info) {
+    // May fire before create_datawriter() has returned, so the writer is
+    // known by its topic rather than compared with the writer_ members.
+    const std::string& topic = writer->get_topic()->get_name();
+    std::atomic<int32_t>* readers = nullptr;
+    if (topic == TOPIC_SP_DETECTION_DISPLAY) readers = &rawReaders_;
+    else if (topic == TOPIC_CLUSTER_TABLE)   readers = &clusterReaders_;
+    else if (topic == TOPIC_PREDICTED_TABLE) readers = &predictedReaders_;
+    else if (topic == TOPIC_ASSOC_TABLE)     readers = &assocReaders_;
+    if (!readers) return;
+    readers->store(info.current_count, std::memory_order_relaxed);
+    LOG_INFO("TrackSender", "'%s': %d matched reader(s)", topic.c_str(), info.current_count);
+}
+
+void TrackSender::publish(DwellOutputs& out) {
+    if (!publisherThread_.joinable()) {
+        publishNow(out);
+        return;
+    }
+
+    {
+        CUAS_PROFILE_LOCK(asyncMutex_, "sender asyncMutex_ wait");
+        std::lock_guard<std::mutex> lock(asyncMutex_, std::adopt_lock);
+        PendingSlot& slot = pending_[out.lane];
+        if (slot.full) superseded_.fetch_add(1);
+        else           ++numPending_;
+        std::swap(slot.out, out);
+        slot.full = true;
+    }
+    asyncCV_.notify_one();
+}
+
+void TrackSender::publisherLoop() {
+    CUAS_PROFILE_THREAD("publisher");
+    DwellOutputs working;
+    size_t next = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(asyncMutex_);
+            asyncCV_.wait(lock, [this] { return stopping_ || numPending_ > 0; });
+            // Drain the last snapshots before exiting so no dwell is lost.
+            if (numPending_ == 0) return;
+            // Round-robin so a busy face cannot starve the others.
+            while (!pending_[next].full) next = (next + 1) % pending_.size();
+            std::swap(pending_[next].out, working);
+            pending_[next].full = false;
+            --numPending_;
+            next = (next + 1) % pending_.size();
+        }
+        publishNow(working);
+    }
+}
+
+void TrackSender::publishNow(const DwellOutputs& out) {
+    CUAS_PROFILE_ZONE("publish");
+    if (out.hasRaw) sendRawDetections(out.raw);
+    sendClusterTable(out.clusters, out.ts, out.dwellCount);
+    sendPredictedTable(out.predicted, out.ts);
+    sendAssocTable(out.assoc, out.ts);
+
+    CounterUAS::LatencyTrace trace = out.trace;
+    trace.publishTime(nowMicros());
+    if (writerTrackUpdate_) sendTrackDeltas(out.updates, out.ts, out.lane, trace);
+    else                    sendTrackUpdates(out.updates, out.ts, out.sensorId, trace);
 }
 
 void TrackSender::sendTrackUpdates(
     const std::vector<CounterUAS::TrackUpdateMessage>& updates,
-    Timestamp ts) {
+    Timestamp ts, uint32_t sensorId, const CounterUAS::LatencyTrace& trace) {
+    StageTimer timer(timings_, PipelineStage::SendTrackTable);
 
     if (updates.empty()) return;
+    if (writerTrackFrame_ && sendTrackFrame(updates, ts, sensorId, trace)) return;
 
     // Build the TrackTableMessage from the vector, filtering deleted if needed.
     CounterUAS::TrackTableMessage tableMsg;
     tableMsg.messageId(MSG_ID_TRACK_TABLE);
     tableMsg.timestamp(ts);
+    tableMsg.sensorId(sensorId);
+    tableMsg.trace(trace);
 
-    std::vector<CounterUAS::TrackUpdateMessage> toSend;
+    // Filter straight into the message's sequence (one copy, not two).
+    auto& toSend = tableMsg.tracks();
+    toSend.reserve(updates.size());
     for (const auto& u : updates) {
         if (!dispConfig_.sendDeletedTracks &&
             u.status() == CounterUAS::TRACK_DELETED) continue;
         toSend.push_back(u);
+        toSend.back().trace(trace);
     }
     if (toSend.empty()) return;
 
     tableMsg.numTracks(static_cast<uint32_t>(toSend.size()));
-    tableMsg.tracks(toSend);
 
     writerTrackTable_->write(&tableMsg);
     msgCount_.fetch_add(1);
@@ -52,29 +183,141 @@ void TrackSender::sendTrackUpdates(
               toSend.size(), TOPIC_TRACK_TABLE);
 }
 
+bool TrackSender::sendTrackFrame(
+    const std::vector<CounterUAS::TrackUpdateMessage>& updates,
+    Timestamp ts, uint32_t sensorId, const CounterUAS::LatencyTrace& trace) {
+    size_t n = 0;
+    for (const auto& u : updates)
+        if (dispConfig_.sendDeletedTracks || u.status() != CounterUAS::TRACK_DELETED) ++n;
+    if (n > CounterUAS::FRAME_MAX_TRACKS) return false;
+    if (n == 0) return true;
+
+    // Filled in place: the loaned sample is what the readers see.
+    auto* frame = loanSample<CounterUAS::TrackTableFrame>(writerTrackFrame_);
+    if (!frame) return false;
+    frame->messageId(MSG_ID_TRACK_TABLE);
+    frame->numTracks(static_cast<uint32_t>(n));
+    frame->sensorId(sensorId);
+    frame->reserved(0);
+    frame->timestamp(ts);
+    frame->trace(trace);
+    size_t i = 0;
+    for (const auto& u : updates) {
+        if (!dispConfig_.sendDeletedTracks &&
+            u.status() == CounterUAS::TRACK_DELETED) continue;
+        toFrameEntry(u, frame->tracks()[i++]);
+    }
+
+    writerTrackFrame_->write(frame);
+    msgCount_.fetch_add(1);
+
+    LOG_DEBUG("TrackSender", "Published %zu track updates on '%s'", n, TOPIC_TRACK_TABLE_FRAME);
+    return true;
+}
+
+bool TrackSender::changed(const CounterUAS::TrackUpdateMessage& last,
+                          const CounterUAS::TrackUpdateMessage& now) const {
+    if (last.status() != now.status() || last.classification() != now.classification())
+        return true;
+    double dx = now.x() - last.x(), dy = now.y() - last.y(), dz = now.z() - last.z();
+    if (std::sqrt(dx * dx + dy * dy + dz * dz) > dispConfig_.deltaPositionM) return true;
+    double dvx = now.vx() - last.vx(), dvy = now.vy() - last.vy(), dvz = now.vz() - last.vz();
+    return std::sqrt(dvx * dvx + dvy * dvy + dvz * dvz) > dispConfig_.deltaVelocityMps;
+}
+
+void TrackSender::sendTrackDeltas(
+    const std::vector<CounterUAS::TrackUpdateMessage>& updates,
+    Timestamp ts, size_t lane, const CounterUAS::LatencyTrace& trace) {
+    StageTimer timer(timings_, PipelineStage::SendTrackTable);
+
+    DeltaLane& dl = delta_[lane];
+    const uint64_t epoch = ++dl.epoch;
+    const bool refresh = !dl.refreshed || dispConfig_.updateRateMs <= 0 ||
+                         ts < dl.lastRefresh ||
+                         ts - dl.lastRefresh >= static_cast<Timestamp>(dispConfig_.updateRateMs) * 1000;
+    if (refresh) {
+        dl.lastRefresh = ts;
+        dl.refreshed   = true;
+    }
+
+    size_t written = 0;
+    for (const auto& u : updates) {
+        if (!dispConfig_.sendDeletedTracks &&
+            u.status() == CounterUAS::TRACK_DELETED) continue;
+        auto it = dl.sent.find(u.trackId());
+        if (it == dl.sent.end()) {
+            it = dl.sent.emplace(u.trackId(), SentTrack{u, epoch}).first;
+        } else {
+            it->second.seen = epoch;
+            if (!refresh && !changed(it->second.msg, u)) {
+                trackSamplesSuppressed_.fetch_add(1);
+                continue;
+            }
+            it->second.msg = u;
+        }
+        it->second.msg.trace(trace);
+        writerTrackUpdate_->write(&it->second.msg);
+        ++written;
+    }
+
+    // Tracks the manager no longer reports: close their instances.
+    size_t disposed = 0;
+    for (auto it = dl.sent.begin(); it != dl.sent.end();) {
+        if (it->second.seen == epoch) { ++it; continue; }
+        CounterUAS::TrackUpdateMessage& last = it->second.msg;
+        if (dispConfig_.sendDeletedTracks) {
+            last.status(CounterUAS::TRACK_DELETED);
+            last.timestamp(ts);
+            last.trace(trace);
+            writerTrackUpdate_->write(&last);
+            ++written;
+        }
+        writerTrackUpdate_->dispose(&last, eprosima::fastdds::dds::HANDLE_NIL);
+        ++disposed;
+        it = dl.sent.erase(it);
+    }
+
+    trackSamplesSent_.fetch_add(written);
+    if (written > 0) msgCount_.fetch_add(1);
+
+    LOG_DEBUG("TrackSender", "Published %zu of %zu track updates on '%s'%s, %zu disposed",
+              written, updates.size(), TOPIC_TRACK_UPDATE, refresh ? " (refresh)" : "",
+              disposed);
+}
+
+bool TrackSender::wantsRawDetections(uint32_t dwellCount) const {
+    const int every = dispConfig_.rawDetectionEvery;
+    if (every <= 0 || rawReaders_.load(std::memory_order_relaxed) <= 0) return false;
+    return dwellCount % static_cast<uint32_t>(every) == 0;
+}
+
 void TrackSender::sendRawDetections(const SPDetectionMessage& msg) {
-    // Convert internal type to IDL wire type and re-publish.
+    if (!wantsRawDetections(msg.dwellCount)) return;
+    StageTimer timer(timings_, PipelineStage::SendRawDetections);
+    // Convert internal type to IDL wire type and forward.
     CounterUAS::SPDetectionMessage idlMsg;
     idlMsg.messageId(msg.messageId);
     idlMsg.dwellCount(msg.dwellCount);
     idlMsg.timestamp(msg.timestamp);
     idlMsg.numDetections(msg.numDetections);
+    idlMsg.sensorId(msg.sensorId);
 
-    std::vector<CounterUAS::DetectionData> dets;
+    // Straight into the message's sequence (one copy, not two).
+    auto& dets = idlMsg.detections();
     dets.reserve(msg.detections.size());
     for (const auto& d : msg.detections)
         dets.push_back(toIDL(d));
-    idlMsg.detections(dets);
 
-    writerSPDetection_->write(&idlMsg);
+    writerRawDisplay_->write(&idlMsg);
 
-    LOG_DEBUG("TrackSender", "Re-published dwell %u (%u detections) on '%s'",
-              msg.dwellCount, msg.numDetections, TOPIC_SP_DETECTION);
+    LOG_DEBUG("TrackSender", "Forwarded dwell %u (%u detections) on '%s'",
+              msg.dwellCount, msg.numDetections, TOPIC_SP_DETECTION_DISPLAY);
 }
 
 void TrackSender::sendClusterTable(
     const std::vector<CounterUAS::ClusterData>& clusters,
     Timestamp ts, uint32_t dwellCount) {
+    StageTimer timer(timings_, PipelineStage::SendClusterTable);
 
     if (clusters.empty()) return;
 
@@ -93,6 +336,7 @@ void TrackSender::sendClusterTable(
 void TrackSender::sendAssocTable(
     const std::vector<CounterUAS::AssocEntry>& entries,
     Timestamp ts) {
+    StageTimer timer(timings_, PipelineStage::SendAssocTable);
 
     if (entries.empty()) return;
 
@@ -110,6 +354,7 @@ void TrackSender::sendAssocTable(
 void TrackSender::sendPredictedTable(
     const std::vector<CounterUAS::PredictedEntry>& entries,
     Timestamp ts) {
+    StageTimer timer(timings_, PipelineStage::SendPredictedTable);
 
     if (entries.empty()) return;
 
@@ -124,4 +369,24 @@ void TrackSender::sendPredictedTable(
               entries.size(), TOPIC_PREDICTED_TABLE);
 }
 
+void TrackSender::sendPipelineStats(const CounterUAS::PipelineStatsMessage& stats) {
+    CounterUAS::PipelineStatsMessage msg = stats;
+    msg.messageId(MSG_ID_PIPELINE_STATS);
+
+    writerPipelineStats_->write(&msg);
+    LOG_DEBUG("TrackSender", "Published pipeline stats (depth %u, dropped %lu) on '%s'",
+              msg.ingestDepth(), static_cast<unsigned long>(msg.ingestDropped()),
+              TOPIC_PIPELINE_STATS);
+}
+
+void TrackSender::sendTrackerHealth(const CounterUAS::TrackerHealthMessage& health) {
+    CounterUAS::TrackerHealthMessage msg = health;
+    msg.messageId(MSG_ID_TRACKER_HEALTH);
+    msg.numStages(static_cast<uint32_t>(msg.stages().size()));
+
+    writerTrackerHealth_->write(&msg);
+    LOG_DEBUG("TrackSender", "Published %u stage latencies on '%s'",
+              msg.numStages(), TOPIC_TRACKER_HEALTH);
+}
+
 } // namespace cuas
@@ -0,0 +1,75 @@
+#include "track_management/sector_map.h"
+#include "common/constants.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace cuas {
+
+namespace {
+
+constexpr double TWO_PI = 2.0 * PI;
+
+// Into [0, 2π).
+inline double wrapPositive(double a) {
+    a = std::fmod(a, TWO_PI);
+    return a < 0.0 ? a + TWO_PI : a;
+}
+
+} // namespace
+
+SectorMap::SectorMap(const std::vector<SectorConfig>& sectors) {
+    sectors_.reserve(sectors.size());
+    for (const SectorConfig& c : sectors) {
+        Sector s;
+        s.nodeId   = c.nodeId;
+        s.azMin    = wrapPositive(c.azMinDeg * DEG2RAD);
+        // 360° (or an empty interval) is the whole circle.
+        s.width    = wrapPositive((c.azMaxDeg - c.azMinDeg) * DEG2RAD);
+        if (s.width == 0.0) s.width = TWO_PI;
+        s.minRange = c.minRange;
+        s.maxRange = c.maxRange;
+        sectors_.push_back(s);
+    }
+}
+
+const SectorMap::Sector* SectorMap::find(uint32_t nodeId) const {
+    for (const Sector& s : sectors_)
+        if (s.nodeId == nodeId) return &s;
+    return nullptr;
+}
+
+double SectorMap::outside(const Sector& s, double range, double azimuth) {
+    double dr = 0.0;
+    if (range < s.minRange)      dr = s.minRange - range;
+    else if (range > s.maxRange) dr = range - s.maxRange;
+
+    double da = 0.0;
+    const double offset = wrapPositive(azimuth - s.azMin);
+    if (offset > s.width)
+        da = std::min(offset - s.width, TWO_PI - offset);
+
+    const double arc = da * std::max(range, 0.0);
+    return dr == 0.0 ? arc : std::hypot(dr, arc);
+}
+
+double SectorMap::outside(uint32_t nodeId, double range, double azimuth) const {
+    const Sector* s = find(nodeId);
+    return s ? outside(*s, range, azimuth) : std::numeric_limits<double>::infinity();
+}
+
+uint32_t SectorMap::owner(double range, double azimuth) const {
+    uint32_t best  = NO_NODE;
+    double   bestD = std::numeric_limits<double>::infinity();
+    for (const Sector& s : sectors_) {
+        const double d = outside(s, range, azimuth);
+        if (d < bestD) {
+            best  = s.nodeId;
+            bestD = d;
+            if (d == 0.0) break;
+        }
+    }
+    return best;
+}
+
+} // namespace cuas
@@ -3,32 +3,24 @@
 
 namespace cuas {
 
-Track::Track(uint32_t id, const StateVector& x0, const StateMatrix& P0,
+Track::Track(uint32_t id, const StateVector& x0, const SymStateMatrix& P0,
              const PredictionConfig& predCfg, Timestamp initTime)
-    : id_(id), initiationTime_(initTime), lastUpdateTime_(initTime) {
-
-    // Initialize all models with the same state
-    for (int m = 0; m < IMM_NUM_MODELS; ++m) {
-        immState_.modelStates[m] = x0;
-        immState_.modelCovariances[m] = P0;
-    }
-    immState_.modeProbabilities = predCfg.imm.initialModeProbabilities;
-    immState_.mergedState = x0;
-    immState_.mergedCovariance = P0;
-
-    hitCount_ = 1;
+    : id_(id), state_(x0), covariance_(P0),
+      modeProbs_(predCfg.imm.initialModeProbabilities),
+      initiationTime_(initTime), lastUpdateTime_(initTime) {
+    // Every IMM model starts from (x0, P0) once TrackManager assigns a slot.
 }
 
 CartesianPos Track::position() const {
-    return {immState_.mergedState[0],
-            immState_.mergedState[3],
-            immState_.mergedState[6]};
+    return {state_[0],
+            state_[3],
+            state_[6]};
 }
 
 CartesianPos Track::velocity() const {
-    return {immState_.mergedState[1],
-            immState_.mergedState[4],
-            immState_.mergedState[7]};
+    return {state_[1],
+            state_[4],
+            state_[7]};
 }
 
 SphericalPos Track::sphericalPosition() const {
@@ -44,34 +36,29 @@ double Track::rangeRate() const {
     return (p.x * v.x + p.y * v.y + p.z * v.z) / r;
 }
 
-void Track::recordHit() {
-    ++hitCount_;
-    consecutiveMisses_ = 0;
+void Track::markUpdated() {
     lastUpdateTime_ = nowMicros();
 }
 
 void Track::recordMiss() {
     ++missCount_;
-    ++consecutiveMisses_;
 }
 
 void Track::incrementAge() {
     ++age_;
 }
 
-CounterUAS::TrackUpdateMessage Track::toUpdateMessage() const {
-    CounterUAS::TrackUpdateMessage msg;
+void Track::toUpdateMessage(const SphericalPos& sph, TrackStatus status, double quality,
+                            uint32_t hitCount, CounterUAS::TrackUpdateMessage& msg) const {
     msg.messageId(MSG_ID_TRACK_UPDATE);
     msg.trackId(id_);
     msg.timestamp(lastUpdateTime_);
-    msg.status(status_);
+    msg.status(status);
     msg.classification(classification_);
 
-    auto sph = sphericalPosition();
     msg.range(sph.range);
     msg.azimuth(sph.azimuth);
     msg.elevation(sph.elevation);
-    msg.rangeRate(rangeRate());
 
     auto pos = position();
     msg.x(pos.x);
@@ -82,12 +69,13 @@ CounterUAS::TrackUpdateMessage Track::toUpdateMessage() const {
     msg.vx(vel.x);
     msg.vy(vel.y);
     msg.vz(vel.z);
+    msg.rangeRate(sph.range < 1e-9 ? 0.0
+                                   : (pos.x * vel.x + pos.y * vel.y + pos.z * vel.z) / sph.range);
 
-    msg.trackQuality(quality_);
-    msg.hitCount(hitCount_);
+    msg.trackQuality(quality);
+    msg.hitCount(hitCount);
     msg.missCount(missCount_);
     msg.age(age_);
-    return msg;
 }
 
 } // namespace cuas
@@ -0,0 +1,285 @@
+#include "track_management/track_checkpoint.h"
+#include "common/logger.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <direct.h>
+    #define MKDIR(d) _mkdir(d)
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #define MKDIR(d) mkdir(d, 0755)
+#endif
+
+namespace cuas {
+
+namespace {
+
+constexpr uint64_t MAGIC        = 0x31504B4353415543ull;   // "CUASCKP1"
+constexpr uint32_t VERSION      = 1;
+constexpr uint32_t NO_SLOT      = 2;
+constexpr uint64_t HEADER_BYTES = 4096;
+constexpr uint64_t MIN_SLOT     = 64 * 1024;
+
+struct Slot {
+    uint64_t offset   = 0;
+    uint64_t capacity = 0;
+    uint64_t bytes    = 0;
+    uint64_t sequence = 0;
+    uint64_t checksum = 0;
+};
+
+struct FileHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t newest;       // slot holding the newest image, or NO_SLOT
+    Slot     slots[2];
+};
+
+struct ImageHeader {
+    uint32_t sensorId, dwellCount, nextTrackId, ringSize;
+    uint64_t lastDwellTime, nextSerial;
+    uint64_t numTracks, numCandidates;
+    // Layout guard.
+    uint32_t stateDim, numModels;
+    uint32_t trackBytes, candidateBytes, detectionBytes, reserved;
+};
+
+static_assert(sizeof(FileHeader) <= HEADER_BYTES, "checkpoint header overflows its page");
+
+// FNV-1a over 64-bit words, then the tail bytes.
+uint64_t checksum(const uint8_t* p, uint64_t n) {
+    uint64_t h = 1469598103934665603ull;
+    uint64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        std::memcpy(&w, p + i, 8);
+        h = (h ^ w) * 1099511628211ull;
+    }
+    for (; i < n; ++i) h = (h ^ p[i]) * 1099511628211ull;
+    return h;
+}
+
+template <typename T>
+uint8_t* put(uint8_t* p, const T* src, size_t n) {
+    if (n) std::memcpy(p, src, n * sizeof(T));
+    return p + n * sizeof(T);
+}
+
+template <typename T>
+const uint8_t* take(const uint8_t* p, std::vector<T>& dst, size_t n) {
+    dst.resize(n);
+    if (n) std::memcpy(dst.data(), p, n * sizeof(T));
+    return p + n * sizeof(T);
+}
+
+} // namespace
+
+TrackCheckpoint::TrackCheckpoint(const std::string& directory, const std::string& fileName)
+    : path_(directory + "/" + fileName) {
+    MKDIR(directory.c_str());
+
+#ifdef _WIN32
+    HANDLE f = CreateFileA(path_.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+                           nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (f == INVALID_HANDLE_VALUE) {
+        LOG_WARN("Checkpoint", "Cannot open %s (error %lu)", path_.c_str(), GetLastError());
+        return;
+    }
+    file_ = f;
+    LARGE_INTEGER sz;
+    uint64_t size = GetFileSizeEx(f, &sz) ? static_cast<uint64_t>(sz.QuadPart) : 0;
+#else
+    fd_ = open(path_.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        LOG_WARN("Checkpoint", "Cannot open %s: %s", path_.c_str(), std::strerror(errno));
+        return;
+    }
+    struct stat st;
+    uint64_t size = fstat(fd_, &st) == 0 ? static_cast<uint64_t>(st.st_size) : 0;
+#endif
+
+    if (!map(std::max(size, HEADER_BYTES))) return;
+
+    auto* fh = reinterpret_cast<FileHeader*>(base_);
+    if (size < HEADER_BYTES || fh->magic != MAGIC || fh->version != VERSION) {
+        if (size > 0)
+            LOG_WARN("Checkpoint", "%s is not a checkpoint of this version; starting a new one",
+                     path_.c_str());
+        std::memset(base_, 0, HEADER_BYTES);
+        fh->magic   = MAGIC;
+        fh->version = VERSION;
+        fh->newest  = NO_SLOT;
+    }
+}
+
+TrackCheckpoint::~TrackCheckpoint() {
+    unmap();
+#ifdef _WIN32
+    if (file_) CloseHandle(static_cast<HANDLE>(file_));
+#else
+    if (fd_ >= 0) close(fd_);
+#endif
+}
+
+bool TrackCheckpoint::map(uint64_t size) {
+    unmap();
+#ifdef _WIN32
+    LARGE_INTEGER sz;
+    sz.QuadPart = static_cast<LONGLONG>(size);
+    HANDLE f = static_cast<HANDLE>(file_);
+    if (!SetFilePointerEx(f, sz, nullptr, FILE_BEGIN) || !SetEndOfFile(f)) {
+        LOG_WARN("Checkpoint", "Cannot size %s (error %lu)", path_.c_str(), GetLastError());
+        return false;
+    }
+    HANDLE m = CreateFileMappingA(f, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+    void*  v = m ? MapViewOfFile(m, FILE_MAP_ALL_ACCESS, 0, 0, 0) : nullptr;
+    if (!v) {
+        LOG_WARN("Checkpoint", "Cannot map %s (error %lu)", path_.c_str(), GetLastError());
+        if (m) CloseHandle(m);
+        return false;
+    }
+    mapping_ = m;
+    base_    = static_cast<uint8_t*>(v);
+#else
+    if (ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+        LOG_WARN("Checkpoint", "Cannot size %s: %s", path_.c_str(), std::strerror(errno));
+        return false;
+    }
+    void* v = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (v == MAP_FAILED) {
+        LOG_WARN("Checkpoint", "Cannot map %s: %s", path_.c_str(), std::strerror(errno));
+        return false;
+    }
+    base_ = static_cast<uint8_t*>(v);
+#endif
+    size_ = size;
+    return true;
+}
+
+void TrackCheckpoint::unmap() {
+    if (!base_) return;
+#ifdef _WIN32
+    UnmapViewOfFile(base_);
+    CloseHandle(static_cast<HANDLE>(mapping_));
+    mapping_ = nullptr;
+#else
+    munmap(base_, size_);
+#endif
+    base_ = nullptr;
+    size_ = 0;
+}
+
+bool TrackCheckpoint::save(const CheckpointImage& img) {
+    if (!base_) return false;
+
+    const uint64_t bytes = sizeof(ImageHeader) +
+                           img.tracks.size()     * sizeof(CheckpointTrack) +
+                           img.candidates.size() * sizeof(InitiationCandidate) +
+                           img.history.size()    * sizeof(TentativeDetection);
+
+    auto* fh = reinterpret_cast<FileHeader*>(base_);
+    const uint32_t newest = fh->newest;
+    const uint32_t target = newest == 0 ? 1 : 0;
+    Slot s = fh->slots[target];
+
+    // A slot that has outgrown its space moves to the end of the file, so
+    // the newest image stays where the header says it is.
+    if (s.capacity < bytes) {
+        const uint64_t cap = (std::max(bytes + bytes / 2, MIN_SLOT) + 4095) & ~uint64_t(4095);
+        const uint64_t offset = size_;
+        if (!map(size_ + cap)) return false;
+        fh = reinterpret_cast<FileHeader*>(base_);
+        s.offset   = offset;
+        s.capacity = cap;
+    }
+
+    ImageHeader ih{};
+    ih.sensorId      = img.sensorId;
+    ih.dwellCount    = img.dwellCount;
+    ih.nextTrackId   = img.nextTrackId;
+    ih.ringSize      = img.ringSize;
+    ih.lastDwellTime = img.lastDwellTime;
+    ih.nextSerial    = img.nextSerial;
+    ih.numTracks     = img.tracks.size();
+    ih.numCandidates = img.candidates.size();
+    ih.stateDim       = STATE_DIM;
+    ih.numModels      = IMM_NUM_MODELS;
+    ih.trackBytes     = sizeof(CheckpointTrack);
+    ih.candidateBytes = sizeof(InitiationCandidate);
+    ih.detectionBytes = sizeof(TentativeDetection);
+
+    uint8_t* p = base_ + s.offset;
+    uint8_t* q = put(p, &ih, 1);
+    q = put(q, img.tracks.data(),     img.tracks.size());
+    q = put(q, img.candidates.data(), img.candidates.size());
+    put(q, img.history.data(), img.history.size());
+
+    s.bytes    = bytes;
+    s.sequence = (newest == NO_SLOT ? 0 : fh->slots[newest].sequence) + 1;
+    s.checksum = checksum(p, bytes);
+    fh->slots[target] = s;
+    fh->newest = target;
+
+    // Start write-back without waiting for it.
+#ifdef _WIN32
+    FlushViewOfFile(base_, 0);
+#else
+    msync(base_, size_, MS_ASYNC);
+#endif
+    return true;
+}
+
+bool TrackCheckpoint::load(CheckpointImage& img) const {
+    if (!base_) return false;
+    const auto* fh = reinterpret_cast<const FileHeader*>(base_);
+    if (fh->newest == NO_SLOT) return false;
+    if (loadSlot(fh->newest, img)) return true;
+    LOG_WARN("Checkpoint", "Newest image in %s is damaged; trying the previous one",
+             path_.c_str());
+    return loadSlot(fh->newest == 0 ? 1 : 0, img);
+}
+
+bool TrackCheckpoint::loadSlot(uint32_t slot, CheckpointImage& img) const {
+    const Slot& s = reinterpret_cast<const FileHeader*>(base_)->slots[slot];
+    if (s.sequence == 0 || s.bytes < sizeof(ImageHeader) ||
+        s.offset < HEADER_BYTES || s.offset + s.bytes > size_)
+        return false;
+
+    const uint8_t* p = base_ + s.offset;
+    if (checksum(p, s.bytes) != s.checksum) return false;
+
+    ImageHeader ih;
+    std::memcpy(&ih, p, sizeof(ih));
+    if (ih.stateDim != STATE_DIM || ih.numModels != IMM_NUM_MODELS ||
+        ih.trackBytes != sizeof(CheckpointTrack) ||
+        ih.candidateBytes != sizeof(InitiationCandidate) ||
+        ih.detectionBytes != sizeof(TentativeDetection)) {
+        LOG_WARN("Checkpoint", "%s was written by an incompatible build", path_.c_str());
+        return false;
+    }
+    const uint64_t expect = sizeof(ImageHeader) +
+                            ih.numTracks * sizeof(CheckpointTrack) +
+                            ih.numCandidates * sizeof(InitiationCandidate) +
+                            ih.numCandidates * ih.ringSize * sizeof(TentativeDetection);
+    if (expect != s.bytes) return false;
+
+    img.sensorId      = ih.sensorId;
+    img.dwellCount    = ih.dwellCount;
+    img.nextTrackId   = ih.nextTrackId;
+    img.ringSize      = ih.ringSize;
+    img.lastDwellTime = ih.lastDwellTime;
+    img.nextSerial    = ih.nextSerial;
+    const uint8_t* q = p + sizeof(ImageHeader);
+    q = take(q, img.tracks,     ih.numTracks);
+    q = take(q, img.candidates, ih.numCandidates);
+    take(q, img.history, ih.numCandidates * ih.ringSize);
+    return true;
+}
+
+} // namespace cuas
@@ -5,135 +5,329 @@
 
 namespace cuas {
 
+namespace {
+
+// Candidate gates: |dAz|, |dEl| < ANGLE_GATE and |dR| < velocityGate * dt +
+// RANGE_MARGIN.  The grid's azimuth cells are one angle gate wide.
+constexpr double ANGLE_GATE   = 0.1;    // rad
+constexpr double RANGE_MARGIN = 100.0;  // m
+
+// Query bounds are widened by this fraction so that rounding in the cell
+// arithmetic cannot hide a candidate the gate test would pass.
+constexpr double CELL_SLACK = 1e-6;
+
+int64_t cellOf(double v, double cell) {
+    double u = std::floor(v / cell);
+    return std::isfinite(u) ? static_cast<int64_t>(u) : 0;
+}
+
+} // namespace
+
 TrackInitiator::TrackInitiator(const InitiationConfig& initCfg,
                                 const InitialCovarianceConfig& covCfg,
                                 const PredictionConfig& predCfg)
-    : initCfg_(initCfg), covCfg_(covCfg), predCfg_(predCfg) {}
+    : initCfg_(initCfg), covCfg_(covCfg), predCfg_(predCfg),
+      ringSize_(static_cast<size_t>(std::max(initCfg.n, 2))),
+      // One range cell spans the gate of a candidate last seen 1 s ago.
+      rangeCell_(RANGE_MARGIN + std::max(0.0, initCfg.velocityGate)),
+      buckets_(64, -1) {}
+
+void TrackInitiator::reconfigure(const InitiationConfig& initCfg,
+                                 const InitialCovarianceConfig& covCfg,
+                                 const PredictionConfig& predCfg) {
+    initCfg_ = initCfg;
+    covCfg_  = covCfg;
+    predCfg_ = predCfg;
+
+    const size_t ringSize = static_cast<size_t>(std::max(initCfg.n, 2));
+    if (ringSize != ringSize_) {
+        ringSize_ = ringSize;
+        candidates_.clear();
+        history_.clear();
+        oldestLatest_ = UINT64_MAX;
+        newestLatest_ = 0;
+    }
+    rangeCell_ = RANGE_MARGIN + std::max(0.0, initCfg.velocityGate);
+    rehash(buckets_.size());
+}
 
 uint32_t TrackInitiator::nextTrackId() {
     return nextId_++;
 }
 
-StateVector TrackInitiator::initState(const Cluster& c) const {
+StateVector TrackInitiator::initState(const TentativeDetection& d) const {
     StateVector x = stateZero();
-    x[0] = c.cartesian.x;
-    x[3] = c.cartesian.y;
-    x[6] = c.cartesian.z;
+    x[0] = d.cartesian.x;
+    x[3] = d.cartesian.y;
+    x[6] = d.cartesian.z;
     return x;
 }
 
-StateVector TrackInitiator::initStateWithVelocity(const Cluster& c0,
-                                                    const Cluster& c1,
+StateVector TrackInitiator::initStateWithVelocity(const TentativeDetection& d0,
+                                                    const TentativeDetection& d1,
                                                     double dt) const {
     StateVector x = stateZero();
-    x[0] = c1.cartesian.x;
-    x[3] = c1.cartesian.y;
-    x[6] = c1.cartesian.z;
+    x[0] = d1.cartesian.x;
+    x[3] = d1.cartesian.y;
+    x[6] = d1.cartesian.z;
     if (dt > 1e-6) {
-        x[1] = (c1.cartesian.x - c0.cartesian.x) / dt;
-        x[4] = (c1.cartesian.y - c0.cartesian.y) / dt;
-        x[7] = (c1.cartesian.z - c0.cartesian.z) / dt;
+        x[1] = (d1.cartesian.x - d0.cartesian.x) / dt;
+        x[4] = (d1.cartesian.y - d0.cartesian.y) / dt;
+        x[7] = (d1.cartesian.z - d0.cartesian.z) / dt;
     }
     return x;
 }
-
-StateMatrix TrackInitiator::initCovariance() const {
-    StateMatrix P = matZero();
+SymStateMatrix TrackInitiator::initCovariance() const {
+    SymStateMatrix P;
     double sp2 = covCfg_.positionStd * covCfg_.positionStd;
     double sv2 = covCfg_.velocityStd * covCfg_.velocityStd;
     double sa2 = covCfg_.accelerationStd * covCfg_.accelerationStd;
 
     for (int axis = 0; axis < 3; ++axis) {
-        P[axis * 3][axis * 3]         = sp2;
-        P[axis * 3 + 1][axis * 3 + 1] = sv2;
-        P[axis * 3 + 2][axis * 3 + 2] = sa2;
+        P(axis * 3,     axis * 3)     = sp2;
+        P(axis * 3 + 1, axis * 3 + 1) = sv2;
+        P(axis * 3 + 2, axis * 3 + 2) = sa2;
     }
     return P;
 }
 
-std::vector<std::unique_ptr<Track>> TrackInitiator::processCandidates(
-    const std::vector<Cluster>& unmatched,
-    Timestamp ts, uint32_t dwellCount) {
+// ---------------------------------------------------------------------------
+// History ring and grid
+// ---------------------------------------------------------------------------
+
+const TentativeDetection& TrackInitiator::latest(size_t i) const {
+    return history_[i * ringSize_ + candidates_[i].head];
+}
+
+const TentativeDetection& TrackInitiator::previous(size_t i) const {
+    return history_[i * ringSize_ + (candidates_[i].head + ringSize_ - 1) % ringSize_];
+}
+
+void TrackInitiator::push(size_t i, const TentativeDetection& d) {
+    InitiationCandidate& c = candidates_[i];
+    c.head = static_cast<uint32_t>((c.head + 1) % ringSize_);
+    history_[i * ringSize_ + c.head] = d;
+    oldestLatest_ = std::min(oldestLatest_, d.timestamp);
+    newestLatest_ = std::max(newestLatest_, d.timestamp);
+}
+
+uint32_t TrackInitiator::bucketOf(int64_t ir, int64_t ia) const {
+    uint64_t h = static_cast<uint64_t>(ir) * 73856093u ^
+                 static_cast<uint64_t>(ia) * 19349663u;
+    return static_cast<uint32_t>(h & (buckets_.size() - 1));
+}
+
+void TrackInitiator::link(size_t i) {
+    InitiationCandidate& c = candidates_[i];
+    const TentativeDetection& d = latest(i);
+    c.bucket = bucketOf(cellOf(d.range, rangeCell_), cellOf(d.azimuth, ANGLE_GATE));
+    c.prev = -1;
+    c.next = buckets_[c.bucket];
+    if (c.next >= 0) candidates_[c.next].prev = static_cast<int32_t>(i);
+    buckets_[c.bucket] = static_cast<int32_t>(i);
+}
+
+void TrackInitiator::unlink(size_t i) {
+    const InitiationCandidate& c = candidates_[i];
+    if (c.prev >= 0) candidates_[c.prev].next = c.next;
+    else             buckets_[c.bucket] = c.next;
+    if (c.next >= 0) candidates_[c.next].prev = c.prev;
+}
+
+void TrackInitiator::rehash(size_t buckets) {
+    buckets_.assign(buckets, -1);
+    for (size_t i = 0; i < candidates_.size(); ++i) link(i);
+}
+
+void TrackInitiator::restore(const std::vector<InitiationCandidate>& candidates,
+                             const std::vector<TentativeDetection>& history,
+                             uint32_t nextId, uint64_t nextSerial) {
+    candidates_ = candidates;
+    history_    = history;
+    nextId_     = nextId;
+    nextSerial_ = nextSerial;
+
+    size_t buckets = 64;
+    while (buckets < candidates_.size()) buckets *= 2;
+    rehash(buckets);
+
+    oldestLatest_ = UINT64_MAX;
+    newestLatest_ = 0;
+    for (size_t i = 0; i < candidates_.size(); ++i) {
+        oldestLatest_ = std::min(oldestLatest_, latest(i).timestamp);
+        newestLatest_ = std::max(newestLatest_, latest(i).timestamp);
+    }
+}
+
+int TrackInitiator::findMatch(const TentativeDetection& d, Timestamp ts) const {
+    // The oldest gated candidate wins, as when candidates were scanned in
+    // creation order.
+    int best = -1;
+    auto consider = [&](int i) {
+        const InitiationCandidate& cand = candidates_[i];
+        if (cand.promoted) return;
+        if (best >= 0 && cand.serial >= candidates_[best].serial) return;
+
+        const TentativeDetection& last = latest(i);
+        double dr = std::abs(d.range - last.range);
+        double da = std::abs(d.azimuth - last.azimuth);
+        double de = std::abs(d.elevation - last.elevation);
+
+        double dt = (ts - last.timestamp) * 1e-6; // seconds
+        double maxRange = initCfg_.velocityGate * dt + RANGE_MARGIN;
+
+        if (dr < maxRange && da < ANGLE_GATE && de < ANGLE_GATE) best = i;
+    };
+
+    const int n = static_cast<int>(candidates_.size());
+    if (n == 0) return -1;
+
+    // Widest range gate of any candidate: the one seen longest ago.
+    const double gate = (initCfg_.velocityGate * ((ts - oldestLatest_) * 1e-6) +
+                         RANGE_MARGIN) * (1.0 + CELL_SLACK);
+    const double angle = ANGLE_GATE * (1.0 + CELL_SLACK);
+    const int64_t r0 = cellOf(d.range - gate, rangeCell_),  r1 = cellOf(d.range + gate, rangeCell_);
+    const int64_t a0 = cellOf(d.azimuth - angle, ANGLE_GATE), a1 = cellOf(d.azimuth + angle, ANGLE_GATE);
+    const double cells = (static_cast<double>(r1 - r0) + 1.0) * (static_cast<double>(a1 - a0) + 1.0);
+
+    // A timestamp behind a candidate's (dt wraps to a huge gate), a
+    // non-finite position, or a query wider than the table: scan it all.
+    if (ts < newestLatest_ || !std::isfinite(d.range + d.azimuth) || !(cells <= n)) {
+        for (int i = 0; i < n; ++i) consider(i);
+        return best;
+    }
+
+    // Cells sharing a bucket may visit a chain twice; consider() is idempotent.
+    for (int64_t ir = r0; ir <= r1; ++ir)
+        for (int64_t ia = a0; ia <= a1; ++ia)
+            for (int32_t i = buckets_[bucketOf(ir, ia)]; i >= 0; i = candidates_[i].next)
+                consider(i);
+    return best;
+}
+
+void TrackInitiator::removeAt(size_t i) {
+    unlink(i);
+    const size_t last = candidates_.size() - 1;
+    if (i != last) {
+        unlink(last);
+        candidates_[i] = candidates_[last];
+        std::copy_n(history_.begin() + last * ringSize_, ringSize_,
+                    history_.begin() + i * ringSize_);
+        link(i);
+    }
+    candidates_.pop_back();
+    history_.resize(candidates_.size() * ringSize_);
+}
+
+// ---------------------------------------------------------------------------
+// Initiation
+// ---------------------------------------------------------------------------
 
-    std::vector<std::unique_ptr<Track>> newTracks;
+void TrackInitiator::processCandidates(
+    const std::vector<Cluster>& clusters, const std::vector<int>& unmatched,
+    Timestamp ts, uint32_t dwellCount, std::vector<Track>& newTracks, size_t maxNew) {
 
-    for (const auto& cluster : unmatched) {
+    newTracks.clear();
+    qualified_.clear();
+
+    for (int cIdx : unmatched) {
+        const Cluster& cluster = clusters[cIdx];
         if (cluster.range > initCfg_.maxInitiationRange) continue;
 
+        TentativeDetection td{cluster.range, cluster.azimuth, cluster.elevation,
+                              cluster.snr, cluster.cartesian, ts, dwellCount};
+
         // Try to match with existing candidates
-        bool matched = false;
-        for (auto& cand : candidates_) {
-            if (cand.promoted) continue;
-            if (cand.history.empty()) continue;
-
-            const auto& last = cand.history.back();
-            double dr = std::abs(cluster.range - last.cluster.range);
-            double da = std::abs(cluster.azimuth - last.cluster.azimuth);
-            double de = std::abs(cluster.elevation - last.cluster.elevation);
-
-            double dt = (ts - last.timestamp) * 1e-6; // seconds
-            double maxRange = initCfg_.velocityGate * dt + 100.0;
-
-            if (dr < maxRange && da < 0.1 && de < 0.1) {
-                TentativeDetection td{cluster, ts, dwellCount};
-                cand.history.push_back(td);
-                cand.hits++;
-                cand.total++;
-
-                // M-of-N check
-                if (cand.hits >= static_cast<uint32_t>(initCfg_.m) &&
-                    cand.total <= static_cast<uint32_t>(initCfg_.n)) {
-                    cand.promoted = true;
-
-                    StateVector x;
-                    if (cand.history.size() >= 2) {
-                        auto& h0 = cand.history[cand.history.size() - 2];
-                        auto& h1 = cand.history[cand.history.size() - 1];
-                        double dtInit = (h1.timestamp - h0.timestamp) * 1e-6;
-                        x = initStateWithVelocity(h0.cluster, h1.cluster, dtInit);
-                    } else {
-                        x = initState(cluster);
-                    }
-
-                    StateMatrix P = initCovariance();
-                    uint32_t tid = nextTrackId();
-                    auto track = std::make_unique<Track>(tid, x, P, predCfg_, ts);
-
-                    LOG_INFO("Initiator", "New track %u at R=%.1f Az=%.3f El=%.3f",
-                             tid, cluster.range, cluster.azimuth, cluster.elevation);
-
-                    newTracks.push_back(std::move(track));
-                }
-                matched = true;
-                break;
-            }
-        }
+        int ci = findMatch(td, ts);
+        if (ci >= 0) {
+            InitiationCandidate& cand = candidates_[ci];
+            unlink(ci);
+            push(ci, td);
+            link(ci);
+            cand.hits++;
+            cand.total++;
 
-        if (!matched) {
+            // M-of-N check; promotion waits for the capacity cut below.
+            if (cand.hits >= static_cast<uint32_t>(initCfg_.m) &&
+                cand.total <= static_cast<uint32_t>(initCfg_.n)) {
+                cand.promoted = true;
+                qualified_.push_back(ci);
+            }
+        } else {
+            const size_t i = candidates_.size();
             InitiationCandidate cand;
-            TentativeDetection td{cluster, ts, dwellCount};
-            cand.history.push_back(td);
             cand.hits = 1;
             cand.total = 1;
-            candidates_.push_back(std::move(cand));
+            cand.head = static_cast<uint32_t>(ringSize_ - 1);   // push() wraps to 0
+            cand.firstDwell = dwellCount;
+            cand.serial = nextSerial_++;
+            candidates_.push_back(cand);
+            history_.resize(candidates_.size() * ringSize_);
+            push(i, td);
+            if (candidates_.size() > buckets_.size()) rehash(2 * buckets_.size());
+            else                                      link(i);
         }
     }
 
-    return newTracks;
+    // Over capacity, the candidates with the strongest latest detection win;
+    // the rest stay candidates and may qualify again while within N.
+    if (qualified_.size() > maxNew) {
+        auto snr = [&](size_t ci) { return latest(ci).snr; };
+        ranked_.assign(qualified_.begin(), qualified_.end());
+        std::nth_element(ranked_.begin(), ranked_.begin() + maxNew, ranked_.end(),
+                         [&](size_t a, size_t b) {
+                             return snr(a) > snr(b) || (snr(a) == snr(b) && a < b);
+                         });
+        for (size_t k = maxNew; k < ranked_.size(); ++k)
+            candidates_[ranked_[k]].promoted = false;
+        deferred_ += qualified_.size() - maxNew;
+        LOG_DEBUG("Initiator", "Track capacity: %zu of %zu qualified candidates initiated",
+                  maxNew, qualified_.size());
+        qualified_.erase(std::remove_if(qualified_.begin(), qualified_.end(),
+                                        [&](size_t ci) { return !candidates_[ci].promoted; }),
+                         qualified_.end());
+    }
+
+    for (size_t ci : qualified_) {
+        const auto& cand = candidates_[ci];
+        const TentativeDetection& d1 = latest(ci);
+
+        StateVector x;
+        if (cand.hits >= 2) {
+            const TentativeDetection& d0 = previous(ci);
+            double dtInit = (d1.timestamp - d0.timestamp) * 1e-6;
+            x = initStateWithVelocity(d0, d1, dtInit);
+        } else {
+            x = initState(d1);
+        }
+
+        SymStateMatrix P = initCovariance();
+        uint32_t tid = nextTrackId();
+        newTracks.emplace_back(tid, x, P, predCfg_, ts);
+
+        LOG_INFO("Initiator", "New track %u at R=%.1f Az=%.3f El=%.3f",
+                 tid, d1.range, d1.azimuth, d1.elevation);
+    }
 }
 
 void TrackInitiator::purgeStaleCandidates(uint32_t currentDwell) {
-    candidates_.erase(
-        std::remove_if(candidates_.begin(), candidates_.end(),
-                       [&](const InitiationCandidate& c) {
-                           if (c.promoted) return true;
-                           if (c.history.empty()) return true;
-                           if (c.total >= static_cast<uint32_t>(initCfg_.n) &&
-                               c.hits < static_cast<uint32_t>(initCfg_.m)) return true;
-                           uint32_t age = currentDwell - c.history.front().dwellCount;
-                           return age > static_cast<uint32_t>(initCfg_.n + 5);
-                       }),
-        candidates_.end());
+    // Swap-remove: each drop is O(1) and the grid links follow the move.
+    oldestLatest_ = UINT64_MAX;
+    newestLatest_ = 0;
+    for (size_t i = 0; i < candidates_.size();) {
+        const InitiationCandidate& c = candidates_[i];
+        bool stale = c.promoted ||
+                     (c.total >= static_cast<uint32_t>(initCfg_.n) &&
+                      c.hits < static_cast<uint32_t>(initCfg_.m)) ||
+                     currentDwell - c.firstDwell > static_cast<uint32_t>(initCfg_.n + 5);
+        if (stale) {
+            removeAt(i);
+            continue;
+        }
+        oldestLatest_ = std::min(oldestLatest_, latest(i).timestamp);
+        newestLatest_ = std::max(newestLatest_, latest(i).timestamp);
+        ++i;
+    }
 }
 
 } // namespace cuas
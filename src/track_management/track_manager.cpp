@@ -2,63 +2,306 @@
 #include "common/logger.h"
 #include "common/config.h"
 #include "common/constants.h"
+#include "common/profiling.h"
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 
 namespace cuas {
 
-TrackManager::TrackManager(const TrackerConfig& cfg) : config_(cfg) {
+// Tracks per WorkerPool chunk for the IMM predict/update fan-out.
+static constexpr size_t TRACK_CHUNK = 8;
+
+// Converted-measurement noise of a return expected at (r, az, el); the
+// angle sigmas are raised so neither cross-range axis falls below
+// minCrossRangeSigma.
+static MeasMatrix measurementNoiseAt(const MeasurementNoiseConfig& n,
+                                     double r, double az, double el) {
+    const double rAz   = std::max(r * std::cos(el), 1.0);
+    const double rEl   = std::max(r, 1.0);
+    const double sigAz = std::max(n.angleSigma, n.minCrossRangeSigma / rAz);
+    const double sigEl = std::max(n.angleSigma, n.minCrossRangeSigma / rEl);
+    return mat::sphericalNoise(r, az, el, n.rangeSigma, sigAz, sigEl);
+}
+
+// CV extrapolation of an estimate over t: positions advance by t times the
+// velocity, accelerations drop out, and each position variance grows by
+// (a t^2 / 2)^2 for a target accelerating at up to a.
+static void extrapolateCV(const StateVector& x0, const SymStateMatrix& P0, double t,
+                          double a, StateVector& x, SymStateMatrix& P) {
+    // State order is position, velocity, acceleration per axis.
+    x = {};
+    P = {};
+    for (int k = 0; k < STATE_DIM; k += 3) {
+        x[k]     = x0[k] + t * x0[k + 1];
+        x[k + 1] = x0[k + 1];
+    }
+    for (int i = 0; i < STATE_DIM; i += 3)
+        for (int j = i; j < STATE_DIM; j += 3) {
+            const double pp = P0(i, j), pv = P0(i, j + 1), vp = P0(i + 1, j),
+                         vv = P0(i + 1, j + 1);
+            P(i, j)         = pp + t * (pv + vp) + t * t * vv;
+            P(i, j + 1)     = pv + t * vv;
+            P(i + 1, j + 1) = vv;
+            if (j != i) P(i + 1, j) = vp + t * vv;
+        }
+    const double m = 0.5 * a * t * t;
+    for (int i = 0; i < STATE_DIM; i += 3) P(i, i) += m * m;
+}
+
+// Convert internal Cluster → IDL ClusterData for DDS forwarding.
+static void toClusterData(const Cluster& c, CounterUAS::ClusterData& cd) {
+    cd.clusterId(c.clusterId);
+    cd.numDetections(c.numDetections);
+    cd.range(c.range);   cd.azimuth(c.azimuth);   cd.elevation(c.elevation);
+    cd.strength(c.strength); cd.snr(c.snr);        cd.rcs(c.rcs);
+    cd.microDoppler(c.microDoppler);
+    cd.x(c.cartesian.x); cd.y(c.cartesian.y);     cd.z(c.cartesian.z);
+}
+
+TrackManager::TrackManager(const TrackerConfig& cfg, StageTimings* timings,
+                           uint32_t sensorId)
+    : config_(cfg), timings_(timings), sensorId_(sensorId) {
     preprocessor_      = std::make_unique<Preprocessor>(cfg.preprocessing);
+    if (cfg.preprocessing.clutterMap.enabled)
+        clutterMap_    = std::make_unique<ClutterMap>(cfg.preprocessing);
+    if (cfg.system.maxDetectionsPerDwell > 0)
+        budget_        = std::make_unique<DetectionBudget>(cfg.system.maxDetectionsPerDwell);
     clusterEngine_     = std::make_unique<ClusterEngine>(cfg.clustering);
     immFilter_         = std::make_unique<IMMFilter>(cfg.prediction);
+    immBatch_          = IMMBatch::create(*immFilter_);
+    catchUp_           = IMMBatch::create(*immFilter_);
     associationEngine_ = std::make_unique<AssociationEngine>(cfg.association);
     trackInitiator_    = std::make_unique<TrackInitiator>(
         cfg.trackManagement.initiation,
         cfg.trackManagement.initialCovariance,
         cfg.prediction);
+    uint32_t firstId = sensorId * TRACK_ID_BLOCK_PER_SENSOR + 1;
+    if (cfg.distributed.enabled) {
+        sectors_ = std::make_unique<SectorMap>(cfg.distributed.sectors);
+        if (!sectors_->hasSector(cfg.distributed.nodeId)) {
+            LOG_WARN("TrackManager", "Sensor %u: node %u has no entry in distributed.sectors; "
+                     "tracking without sector gating or handover",
+                     sensorId, cfg.distributed.nodeId);
+            sectors_.reset();
+        }
+        firstId += cfg.distributed.nodeId * TRACK_ID_BLOCK_PER_NODE;
+    }
+    trackInitiator_->setFirstTrackId(firstId);
+    if (cfg.clustering.trackAided && cfg.pipeline.pipelined)
+        LOG_WARN("TrackManager", "clustering.trackAided needs the serial pipeline; "
+                 "pipelined dwells are clustered blind");
+    workers_           = std::make_unique<WorkerPool>(cfg.system.workerThreads);
+    if (cfg.system.maxTracks > 0)
+        tracks_.reserve(static_cast<size_t>(cfg.system.maxTracks));
 
-    for (int i = 0; i < MEAS_DIM; ++i)
-        for (int j = 0; j < MEAS_DIM; ++j)
-            measurementNoise_[i][j] = (i == j) ? 625.0 : 0.0;
+    logger_.setStageTimings(timings_);
+    if (cfg.system.logEnabled) {
+        // Binary records carry no sensor field, so each face logs to its own file.
+        std::string prefix = sensorId == 0 ? "tracker"
+                                           : "tracker_s" + std::to_string(sensorId);
+        LogOptions opts;
+        opts.ringBytes    = static_cast<size_t>(std::max(cfg.system.logRingKB, 64)) << 10;
+        opts.combinedText = cfg.system.combinedText;
+        opts.blockBytes   = static_cast<size_t>(std::max(cfg.system.logBlockKB, 0)) << 10;
+        opts.indexEvery   = static_cast<uint32_t>(std::max(cfg.system.logIndexRecords, 0));
+        opts.segmentBytes = static_cast<uint64_t>(std::max(cfg.system.logSegmentMB, 0)) << 20;
+        opts.segmentAge   = std::chrono::seconds(std::max(cfg.system.logSegmentSeconds, 0));
+        opts.preallocateBytes = static_cast<uint64_t>(std::max(cfg.system.logPreallocateMB, 0)) << 20;
+        opts.sync         = cfg.system.logSync;
+        opts.syncInterval = std::chrono::milliseconds(std::max(cfg.system.logSyncMs, 1));
+        logger_.open(cfg.system.logDirectory, prefix, getRunInfoString(cfg), opts);
+    }
 
-    if (cfg.system.logEnabled)
-        logger_.open(cfg.system.logDirectory, "tracker", getRunInfoString(cfg));
+    if (cfg.system.checkpoint.enabled) {
+        std::string name = sensorId == 0 ? "tracker.ckpt"
+                                         : "tracker_s" + std::to_string(sensorId) + ".ckpt";
+        checkpoint_ = std::make_unique<TrackCheckpoint>(cfg.system.checkpoint.directory, name);
+        if (checkpoint_->isOpen())
+            restoreCheckpoint();
+        else
+            checkpoint_.reset();
+    }
 
-    LOG_INFO("TrackManager", "Initialized. Cluster: %s, Association: %s",
+    LOG_INFO("TrackManager", "Sensor %u initialized. Cluster: %s, Association: %s, %d worker thread(s)",
+             sensorId_,
              clusterEngine_->activeMethod().c_str(),
-             associationEngine_->activeMethod().c_str());
+             associationEngine_->activeMethod().c_str(),
+             workers_->numThreads());
+}
+
+void TrackManager::reconfigure(const TrackerConfig& cfg) {
+    reconfigureClustering(cfg);
+    reconfigureTracking(cfg);
+}
+
+void TrackManager::reconfigureClustering(const TrackerConfig& cfg) {
+    const ClutterMapConfig clutterMap = config_.preprocessing.clutterMap;
+    config_.preprocessing            = cfg.preprocessing;
+    config_.preprocessing.clutterMap = clutterMap;
+    config_.clustering               = cfg.clustering;
+
+    preprocessor_->reconfigure(config_.preprocessing);
+    clusterEngine_->reconfigure(config_.clustering);
+}
+
+void TrackManager::reconfigureTracking(const TrackerConfig& cfg) {
+    const IMMPrecision precision = config_.prediction.imm.precision;
+    if (cfg.prediction.imm.precision != precision)
+        LOG_WARN("TrackManager", "Sensor %u: prediction.imm.precision needs a restart; keeping %s",
+                 sensorId_, precision == IMMPrecision::Float ? "float" : "double");
+    config_.prediction                = cfg.prediction;
+    config_.prediction.imm.precision  = precision;
+    config_.association               = cfg.association;
+    config_.trackManagement           = cfg.trackManagement;
+
+    // immBatch_ refers to *immFilter_, so the filter is replaced in place;
+    // tracks keep their IMM state and mode probabilities.
+    *immFilter_ = IMMFilter(config_.prediction);
+    associationEngine_->reconfigure(config_.association);
+    trackInitiator_->reconfigure(config_.trackManagement.initiation,
+                                 config_.trackManagement.initialCovariance,
+                                 config_.prediction);
+
+    LOG_INFO("TrackManager", "Sensor %u reconfigured, %zu live tracks kept",
+             sensorId_, tracks_.size());
 }
 
 void TrackManager::processDwell(const SPDetectionMessage& msg) {
+    CUAS_PROFILE_ZONE("processDwell");
     Timestamp ts = msg.timestamp > 0 ? msg.timestamp : nowMicros();
-    dwellCount_ = msg.dwellCount;
 
+    if (!config_.clustering.trackAided) {
+        clusterDwell(msg, ts, clusters_);
+        if (debugTables_ & DEBUG_TABLE_CLUSTERS) toClusterTable(clusters_, lastClusters_);
+        else                                     lastClusters_.clear();
+
+        trackDwell(clusters_, ts, msg.dwellCount);
+        return;
+    }
+
+    // Track-aided: predict first, so clustering can use the confirmed
+    // tracks' gates.  Waking lazy tracks waits for the clusters and counts
+    // as association time; the predictions are logged before it, so a
+    // woken track logs its extrapolation.
+    preprocess(msg, ts);
+    const double dt = beginDwell(ts, msg.dwellCount);
+    {
+        StageTimer t(timings_, PipelineStage::Predict);
+        predict(dt);
+        logPredicted();
+    }
+    {
+        StageTimer t(timings_, PipelineStage::Cluster);
+        aiding_.resize(tracks_.size());
+        for (size_t i = 0; i < tracks_.size(); ++i)
+            aiding_[i] = tracks_.status(i) == TrackStatusVal::Confirmed;
+        clusterEngine_->processAided(filtered_, innovations_, aiding_, associationEngine_->gate(),
+                                     clusters_, aided_, aidedTrack_);
+    }
+    logger_.logClustered(ts, clusters_, aided_);
+    LOG_DEBUG("TrackManager", "After clustering: %zu clusters, %zu track-aided",
+              clusters_.size(), aided_.size());
+    if (debugTables_ & DEBUG_TABLE_CLUSTERS) {
+        toClusterTable(clusters_, lastClusters_);
+        const size_t n = lastClusters_.size();
+        lastClusters_.resize(n + aided_.size());
+        for (size_t k = 0; k < aided_.size(); ++k) toClusterData(aided_[k], lastClusters_[n + k]);
+    } else {
+        lastClusters_.clear();
+    }
+
+    {
+        StageTimer t(timings_, PipelineStage::Associate);
+        wakeLazy(clusters_);
+        claimAided();
+        associate(clusters_, ts);
+    }
+    { StageTimer t(timings_, PipelineStage::Maintain); updateLifecycle(); }
+    endDwell(ts);
+}
+
+std::vector<Cluster> TrackManager::clusterDwell(const SPDetectionMessage& msg,
+                                                Timestamp ts) {
+    std::vector<Cluster> clusters;
+    clusterDwell(msg, ts, clusters);
+    return clusters;
+}
+
+void TrackManager::clusterDwell(const SPDetectionMessage& msg, Timestamp ts,
+                                std::vector<Cluster>& clusters) {
+    CUAS_PROFILE_ZONE("clusterDwell");
+    preprocess(msg, ts);
+
+    {
+        StageTimer timer(timings_, PipelineStage::Cluster);
+        clusterEngine_->process(filtered_, clusters);
+    }
+    logger_.logClustered(ts, clusters);
+    LOG_DEBUG("TrackManager", "After clustering: %zu clusters", clusters.size());
+}
+
+void TrackManager::preprocess(const SPDetectionMessage& msg, Timestamp ts) {
     LOG_DEBUG("TrackManager", "=== Dwell %u: %u detections ===",
-              dwellCount_, msg.numDetections);
+              msg.dwellCount, msg.numDetections);
 
     logger_.logRawDetections(ts, msg);
 
-    auto filtered = preprocessor_->process(msg.detections);
-    logger_.logPreprocessed(ts, filtered);
-    LOG_DEBUG("TrackManager", "After preprocessing: %zu detections", filtered.size());
+    {
+        StageTimer timer(timings_, PipelineStage::Preprocess);
+        preprocessor_->process(DetectionView(msg.detections), filtered_);
+        if (sectors_)    gateToSector(filtered_);
+        if (clutterMap_) clutterMap_->filter(filtered_);
+        if (budget_)     budget_->apply(filtered_);
+    }
+    logger_.logPreprocessed(ts, filtered_);
+    LOG_DEBUG("TrackManager", "After preprocessing: %zu detections", filtered_.size());
+}
 
-    auto clusters = clusterEngine_->process(filtered);
-    logger_.logClustered(ts, clusters);
+std::vector<CounterUAS::ClusterData> TrackManager::toClusterTable(
+    const std::vector<Cluster>& clusters) {
+    std::vector<CounterUAS::ClusterData> table;
+    toClusterTable(clusters, table);
+    return table;
+}
+
+void TrackManager::toClusterTable(const std::vector<Cluster>& clusters,
+                                  std::vector<CounterUAS::ClusterData>& table) {
+    table.resize(clusters.size());
+    for (size_t i = 0; i < clusters.size(); ++i) toClusterData(clusters[i], table[i]);
+}
 
-    // Convert internal Cluster → IDL ClusterData for DDS forwarding.
-    lastClusters_.clear();
-    lastClusters_.reserve(clusters.size());
-    for (const auto& c : clusters) {
-        CounterUAS::ClusterData cd;
-        cd.clusterId(c.clusterId);
-        cd.numDetections(c.numDetections);
-        cd.range(c.range);   cd.azimuth(c.azimuth);   cd.elevation(c.elevation);
-        cd.strength(c.strength); cd.snr(c.snr);        cd.rcs(c.rcs);
-        cd.microDoppler(c.microDoppler);
-        cd.x(c.cartesian.x); cd.y(c.cartesian.y);     cd.z(c.cartesian.z);
-        lastClusters_.push_back(cd);
+void TrackManager::trackDwell(const std::vector<Cluster>& clusters, Timestamp ts,
+                              uint32_t dwellCount) {
+    CUAS_PROFILE_ZONE("trackDwell");
+    const double dt = beginDwell(ts, dwellCount);
+
+    // Predict/associate/delete also emit binary log records, so their
+    // timings include the BinaryLog time spent inside them.
+    {
+        StageTimer t(timings_, PipelineStage::Predict);
+        predict(dt);
+        wakeLazy(clusters);
+        logPredicted();
+    }
+    { StageTimer t(timings_, PipelineStage::Associate); associate(clusters, ts); }
+    { StageTimer t(timings_, PipelineStage::Maintain);  updateLifecycle(); }
+    endDwell(ts);
+}
+
+double TrackManager::beginDwell(Timestamp ts, uint32_t dwellCount) {
+    dwellCount_ = dwellCount;
+    dwellTime_  = ts;
+    aidedMatched_.clear();
+
+    // A restored table is only worth resuming if the radar picked up where
+    // the checkpoint left off.
+    if (resumed_) {
+        resumed_ = false;
+        const Timestamp maxAge =
+            static_cast<Timestamp>(std::max(config_.system.checkpoint.maxAgeMs, 0)) * 1000;
+        if (ts < lastDwellTime_ || ts - lastDwellTime_ > maxAge) discardRestored();
     }
-    LOG_DEBUG("TrackManager", "After clustering: %zu clusters", clusters.size());
 
     double dt = 0.0;
     if (lastDwellTime_ > 0) {
@@ -67,265 +310,727 @@ void TrackManager::processDwell(const SPDetectionMessage& msg) {
         dt = config_.system.cyclePeriodMs * 1e-3;
     }
     if (dt <= 0.0 || dt > 10.0) dt = config_.system.cyclePeriodMs * 1e-3;
+    return dt;
+}
 
-    predict(dt);
-    associate(clusters);
-    maintainTracks();
-    deleteTracks();
-    classifyTracks();
-
+void TrackManager::endDwell(Timestamp ts) {
     lastDwellTime_ = ts;
 
+    // Handovers from a node ahead of this one, now that this one caught up.
+    if (!earlyHandovers_.empty()) {
+        size_t kept = 0;
+        for (size_t i = 0; i < earlyHandovers_.size(); ++i) {
+            if (earlyHandovers_[i].stateTime <= ts) acceptHandover(earlyHandovers_[i]);
+            else earlyHandovers_[kept++] = earlyHandovers_[i];
+        }
+        earlyHandovers_.resize(kept);
+    }
+
+    if (checkpoint_ && ++sinceCheckpoint_ >=
+                           static_cast<uint32_t>(std::max(config_.system.checkpoint.periodDwells, 1))) {
+        StageTimer t(timings_, PipelineStage::Checkpoint);
+        saveCheckpoint();
+        sinceCheckpoint_ = 0;
+    }
+
     LOG_DEBUG("TrackManager", "Active tracks: %u, Confirmed: %u",
               numActiveTracks(), numConfirmedTracks());
 }
 
 void TrackManager::predict(double dt) {
-    lastPredicted_.clear();
+    if (config_.trackManagement.lazyPrediction.enabled) parkLazy();
 
-    for (auto& track : tracks_) {
-        if (track->status() == TrackStatusVal::Deleted) continue;
+    // One batched IMM step for every track in the batch (fanned out across
+    // the pool by slot block), then each track picks up its merged estimate
+    // and its gating statistics under its own R: all the associators see of
+    // the tracks, so a near track's gate is not widened by a far one's
+    // cross-range error.  A lazy track owes the step and is extrapolated
+    // instead, its gate at the extrapolation for wakeLazy().
+    immFilter_->prepare(dt);
+    immBatch_->predict(dt, *workers_);
+    const MeasurementNoiseConfig& noise = config_.association.measurementNoise;
+    const double maxAccel = config_.trackManagement.lazyPrediction.maxAccel;
+    trackNoise_.resize(tracks_.size());
+    innovations_.resize(tracks_.size());
+    workers_->parallelFor(tracks_.size(), TRACK_CHUNK, [&](size_t begin, size_t end) {
+        StateVector    x;
+        SymStateMatrix P;
+        std::array<double, IMM_NUM_MODELS> mu;
+        for (size_t i = begin; i < end; ++i) {
+            Track& track = tracks_[i];
+            const bool lazy = track.slot() == Track::NO_SLOT;
+            if (lazy) {
+                LazyTrack& l = lazy_[tracks_.handle(i)];
+                l.steps.push_back(dt);
+                l.elapsed += dt;
+                extrapolateCV(l.imm.mergedState, l.imm.mergedCovariance, l.elapsed, maxAccel, x, P);
+                track.setEstimate(x, P, l.imm.modeProbabilities);
+            } else {
+                immBatch_->merged(track.slot(), x, P, mu);
+                track.setEstimate(x, P, mu);
+            }
+            track.incrementAge();
+            const SphericalPos sph = track.sphericalPosition();
+            trackNoise_[i] = measurementNoiseAt(noise, sph.range, sph.azimuth, sph.elevation);
+            innovations_[i] = immFilter_->innovationStats(x, P, trackNoise_[i]);
+        }
+    });
+}
 
-        immFilter_->predict(dt, track->immState());
-        track->incrementAge();
+void TrackManager::logPredicted() {
+    // Serial, to keep tracks_ order.
+    lastPredicted_.clear();
+    const bool table = (debugTables_ & DEBUG_TABLE_PREDICTED) != 0;
+    for (size_t i = 0; i < tracks_.size(); ++i) {
+        const Track& track = tracks_[i];
 
         Timestamp now = nowMicros();
-        logger_.logPredicted(now, track->id(), track->state());
+        logger_.logPredicted(now, track.id(), track.state());
+
+        if (!table) continue;
 
         // Convert predicted state → IDL PredictedEntry for DDS forwarding.
         CounterUAS::PredictedEntry pe;
-        pe.trackId(track->id());
-        pe.trackStatus(track->status());
-        const auto& s = track->state();
+        pe.trackId(track.id());
+        pe.trackStatus(tracks_.status(i));
+        const auto& s = track.state();
         pe.x(s[0]); pe.vx(s[1]); pe.ax(s[2]);
         pe.y(s[3]); pe.vy(s[4]); pe.ay(s[5]);
         pe.z(s[6]); pe.vz(s[7]); pe.az(s[8]);
-        auto sph = track->sphericalPosition();
+        auto sph = track.sphericalPosition();
         pe.range(sph.range); pe.azimuth(sph.azimuth); pe.elevation(sph.elevation);
-        const auto& P = track->covariance();
-        pe.covX(P[0][0]); pe.covY(P[3][3]); pe.covZ(P[6][6]);
-        const auto& probs = track->immState().modeProbabilities;
+        const auto& P = track.covariance();
+        pe.covX(P(0, 0)); pe.covY(P(3, 3)); pe.covZ(P(6, 6));
+        const auto& probs = track.modeProbabilities();
         pe.modelProb0(probs[0]); pe.modelProb1(probs[1]); pe.modelProb2(probs[2]);
         pe.modelProb3(probs[3]); pe.modelProb4(probs[4]);
         lastPredicted_.push_back(pe);
 
         LOG_TRACE("TrackManager", "Predicted track %u: x=%.1f y=%.1f z=%.1f",
-                  track->id(), s[0], s[3], s[6]);
+                  track.id(), s[0], s[3], s[6]);
+    }
+}
+
+void TrackManager::parkLazy() {
+    // A tentative or coasting track that keeps missing leaves the batch
+    // with its IMM state as it stands, before this dwell's predict.
+    const uint32_t afterMisses =
+        static_cast<uint32_t>(config_.trackManagement.lazyPrediction.afterMisses);
+    bool parked = false;
+    for (size_t i = 0; i < tracks_.size(); ++i) {
+        Track& track = tracks_[i];
+        if (track.slot() == Track::NO_SLOT ||
+            tracks_.status(i) == TrackStatusVal::Confirmed ||
+            tracks_.consecutiveMisses(i) < afterMisses)
+            continue;
+        const TrackStore::Handle h = tracks_.handle(i);
+        if (h >= lazy_.size()) lazy_.resize(h + 1);
+        LazyTrack& lazy = lazy_[h];
+        immBatch_->load(track.slot(), lazy.imm);
+        lazy.steps.clear();
+        lazy.elapsed = 0.0;
+        immBatch_->release(track.slot());
+        track.setSlot(Track::NO_SLOT);
+        parked = true;
+    }
+    if (!parked) return;
+
+    // Pack the remaining slots into [0, numLive()) so the Blocks the parked
+    // tracks emptied are skipped.
+    const size_t live = immBatch_->numLive();
+    for (size_t i = 0; i < tracks_.size(); ++i) {
+        Track& track = tracks_[i];
+        if (track.slot() != Track::NO_SLOT && track.slot() >= live)
+            track.setSlot(immBatch_->relocate(track.slot()));
     }
 }
 
-void TrackManager::associate(const std::vector<Cluster>& clusters) {
-    std::vector<Track*> activeTracks;
-    std::vector<int>    activeIndices;
-    for (int i = 0; i < static_cast<int>(tracks_.size()); ++i) {
-        if (tracks_[i]->status() != TrackStatusVal::Deleted) {
-            activeTracks.push_back(tracks_[i].get());
-            activeIndices.push_back(i);
+void TrackManager::wakeLazy(const std::vector<Cluster>& clusters) {
+    CUAS_PROFILE_ZONE("wakeLazy");
+    lazyPos_.clear();
+    for (size_t i = 0; i < tracks_.size(); ++i)
+        if (tracks_[i].slot() == Track::NO_SLOT) lazyPos_.push_back(i);
+    if (lazyPos_.empty()) return;
+
+    // A cluster outside a lazy track's extrapolated gate (its innovations_
+    // entry) is taken to be outside the gate of its full prediction.  A
+    // track left lazy gated no cluster, so it goes to the associators
+    // invalid.
+    woken_.clear();
+    if (!config_.trackManagement.lazyPrediction.enabled) {
+        woken_ = lazyPos_;
+    } else {
+        const AssociationConfig& assoc = config_.association;
+        const double gate = assoc.method == AssociationMethod::JPDA
+                                ? std::max(assoc.gatingThreshold, assoc.jpda.gateSize)
+                                : assoc.gatingThreshold;
+        lazyIndex_.build(innovations_, clusters, gate);
+        for (size_t i : lazyPos_) {
+            InnovationStats& inn = innovations_[i];
+            lazyIndex_.candidates(inn, near_);
+            bool gated = false;
+            for (int c : near_) {
+                const MeasVector z = {clusters[c].cartesian.x, clusters[c].cartesian.y,
+                                      clusters[c].cartesian.z};
+                if (mat::mahalanobisDistance(mat::measSub(z, inn.zPred), inn.Sinv) <= gate) {
+                    gated = true;
+                    break;
+                }
+            }
+            if (gated) woken_.push_back(i);
+            else       inn = InnovationStats{};
         }
+        if (woken_.empty()) return;
     }
 
-    std::vector<Track> trackRefs;
-    trackRefs.reserve(activeTracks.size());
-    for (auto* t : activeTracks)
-        trackRefs.push_back(*t);
+    // Catch up in catchUp_, longest debt first: a track owing n predicts
+    // joins n steps from the end, and every step takes the dt of the dwell
+    // it stands for, so each track goes through the same batched steps, in
+    // the same order, as it would have in immBatch_.
+    std::sort(woken_.begin(), woken_.end(), [&](size_t a, size_t b) {
+        const size_t na = lazy_[tracks_.handle(a)].steps.size();
+        const size_t nb = lazy_[tracks_.handle(b)].steps.size();
+        return na != nb ? na > nb : a < b;
+    });
+    wokenSlots_.resize(woken_.size());
+    size_t joined = 0;
+    for (size_t owed = lazy_[tracks_.handle(woken_[0])].steps.size(); owed > 0; --owed) {
+        for (; joined < woken_.size(); ++joined) {
+            const LazyTrack& l = lazy_[tracks_.handle(woken_[joined])];
+            if (l.steps.size() < owed) break;
+            wokenSlots_[joined] = catchUp_->allocate(l.imm.mergedState, l.imm.mergedCovariance,
+                                                     l.imm.modeProbabilities);
+            catchUp_->store(wokenSlots_[joined], l.imm);
+        }
+        const LazyTrack& first = lazy_[tracks_.handle(woken_[0])];
+        catchUp_->predict(first.steps[first.steps.size() - owed], *workers_);
+    }
 
-    // Adaptive measurement noise: range σ = 10 m, angle σ = 0.005 rad.
-    {
-        static constexpr double SIGMA_RANGE = 10.0;
-        static constexpr double SIGMA_ANGLE = 0.005;
-        double maxRange = 5000.0;
-        for (const auto& t : trackRefs)
-            maxRange = std::max(maxRange, t.sphericalPosition().range);
-        double sigCross = SIGMA_ANGLE * maxRange;
-        measurementNoise_ = {};
-        measurementNoise_[0][0] = SIGMA_RANGE * SIGMA_RANGE;
-        measurementNoise_[1][1] = sigCross * sigCross;
-        measurementNoise_[2][2] = sigCross * sigCross;
+    const MeasurementNoiseConfig& noise = config_.association.measurementNoise;
+    for (size_t k = 0; k < woken_.size(); ++k) {
+        const size_t i = woken_[k];
+        Track& track = tracks_[i];
+        LazyTrack& l = lazy_[tracks_.handle(i)];
+        catchUp_->load(wokenSlots_[k], l.imm);
+        catchUp_->release(wokenSlots_[k]);
+        track.setSlot(immBatch_->allocate(l.imm.mergedState, l.imm.mergedCovariance,
+                                          l.imm.modeProbabilities));
+        immBatch_->store(track.slot(), l.imm);
+        track.setEstimate(l.imm.mergedState, l.imm.mergedCovariance, l.imm.modeProbabilities);
+        const SphericalPos sph = track.sphericalPosition();
+        trackNoise_[i]  = measurementNoiseAt(noise, sph.range, sph.azimuth, sph.elevation);
+        innovations_[i] = immFilter_->innovationStats(track.state(), track.covariance(),
+                                                      trackNoise_[i]);
+    }
+}
+
+void TrackManager::claimAided() {
+    CUAS_PROFILE_ZONE("claimAided");
+    // An aided cluster is settled with its track here only if the two would
+    // be a component of their own in the association: no other track gates
+    // the cluster and no other cluster lies in the track's gate.  The
+    // associator then decides the pair exactly as it would there, and a
+    // matched track sits out the association, gating nothing.  Any other
+    // aided cluster rejoins the blind ones, and its track stays in.
+    aidedMatched_.clear();
+    const size_t nAided = aided_.size();
+    if (nAided == 0) return;
+    const double gate = associationEngine_->gate();
+    auto d2At = [](const Cluster& c, const InnovationStats& inn) {
+        const MeasVector z = {c.cartesian.x, c.cartesian.y, c.cartesian.z};
+        return mat::mahalanobisDistance(mat::measSub(z, inn.zPred), inn.Sinv);
+    };
+
+    // Every track's gate against the aided clusters, sorted by x.  A track
+    // gating an aided cluster not its own contests that cluster, and its
+    // own as well.
+    contested_.assign(nAided, 0);
+    aidedOf_.assign(tracks_.size(), -1);
+    for (size_t k = 0; k < nAided; ++k) aidedOf_[aidedTrack_[k]] = static_cast<int>(k);
+    aidedByX_.resize(nAided);
+    std::iota(aidedByX_.begin(), aidedByX_.end(), 0);
+    std::sort(aidedByX_.begin(), aidedByX_.end(), [&](int a, int b) {
+        return aided_[a].cartesian.x < aided_[b].cartesian.x;
+    });
+    for (size_t i = 0; i < tracks_.size(); ++i) {
+        const InnovationStats& inn = innovations_[i];
+        if (!inn.valid) continue;
+        const double half = std::sqrt(gate * inn.sDiag[0]) * (1.0 + 1e-9) + 1e-9;
+        auto it = std::lower_bound(aidedByX_.begin(), aidedByX_.end(), inn.zPred[0] - half,
+                                   [&](int k, double x) { return aided_[k].cartesian.x < x; });
+        for (; it != aidedByX_.end() && aided_[*it].cartesian.x <= inn.zPred[0] + half; ++it) {
+            const int k = *it;
+            if (k == aidedOf_[i] || d2At(aided_[k], inn) > gate) continue;
+            contested_[k] = 1;
+            if (aidedOf_[i] >= 0) contested_[aidedOf_[i]] = 1;
+        }
+    }
+    // And the owners' gates against the blind clusters.
+    lazyIndex_.build(innovations_, clusters_, gate);
+    for (size_t k = 0; k < nAided; ++k) {
+        if (contested_[k]) continue;
+        const InnovationStats& inn = innovations_[aidedTrack_[k]];
+        lazyIndex_.candidates(inn, near_);
+        for (int c : near_) {
+            if (d2At(clusters_[c], inn) <= gate) {
+                contested_[k] = 1;
+                break;
+            }
+        }
+    }
+
+    for (size_t k = 0; k < nAided; ++k) {
+        const int t = aidedTrack_[k];
+        InnovationStats& inn = innovations_[t];
+        double distance = 0.0;
+        if (!contested_[k] &&
+            associationEngine_->associateSingle(inn, d2At(aided_[k], inn), distance)) {
+            aidedMatched_.push_back({t, static_cast<int>(k), distance});
+            inn.valid = false;
+        } else {
+            clusters_.emplace_back();
+            std::swap(clusters_.back(), aided_[k]);
+        }
     }
+}
+
+void TrackManager::associate(const std::vector<Cluster>& clusters, Timestamp ts) {
+    // Every track in the store is live, so the associators' track indices
+    // are store positions.
+    const size_t numTracks = tracks_.size();
+
+    trackIds_.resize(numTracks);
+    for (size_t i = 0; i < numTracks; ++i) trackIds_[i] = tracks_[i].id();
+    associationEngine_->setDwellContext(trackIds_, trackNoise_);
+
+    AssociationOutput& assocResult = assoc_;
+    associationEngine_->process(innovations_, clusters, assocResult, workers_.get());
 
-    auto assocResult = associationEngine_->process(trackRefs, clusters,
-                                                    *immFilter_, measurementNoise_);
+    // Tracks claimAided() settled went in gating nothing; they are no misses.
+    // Their matches index aided_, not `clusters`.
+    if (!aidedMatched_.empty()) {
+        claimed_.assign(numTracks, 0);
+        for (const auto& match : aidedMatched_) claimed_[match.trackIndex] = 1;
+        auto& unmatched = assocResult.unmatchedTracks;
+        unmatched.erase(std::remove_if(unmatched.begin(), unmatched.end(),
+                                       [&](int t) { return claimed_[t] != 0; }),
+                        unmatched.end());
+    }
 
     // Convert association results → IDL AssocEntry for DDS forwarding.
     lastAssoc_.clear();
-    for (const auto& match : assocResult.matched) {
-        CounterUAS::AssocEntry ae;
-        ae.trackId(activeTracks[match.trackIndex]->id());
-        ae.clusterId(clusters[match.clusterIndex].clusterId);
-        ae.distance(match.distance);
-        ae.matched(true);
-        lastAssoc_.push_back(ae);
+    if (debugTables_ & DEBUG_TABLE_ASSOC) {
+        auto addMatch = [&](const AssociationResult& match, const Cluster& cluster) {
+            CounterUAS::AssocEntry ae;
+            ae.trackId(tracks_[match.trackIndex].id());
+            ae.clusterId(cluster.clusterId);
+            ae.distance(match.distance);
+            ae.matched(true);
+            lastAssoc_.push_back(ae);
+        };
+        for (const auto& match : assocResult.matched) addMatch(match, clusters[match.clusterIndex]);
+        for (const auto& match : aidedMatched_)      addMatch(match, aided_[match.clusterIndex]);
+        for (int unmIdx : assocResult.unmatchedTracks) {
+            CounterUAS::AssocEntry ae;
+            ae.trackId(tracks_[unmIdx].id());
+            ae.clusterId(0xFFFFFFFFu);
+            ae.distance(-1.0);
+            ae.matched(false);
+            lastAssoc_.push_back(ae);
+        }
+        for (int cIdx : assocResult.unmatchedClusters) {
+            CounterUAS::AssocEntry ae;
+            ae.trackId(0xFFFFFFFFu);
+            ae.clusterId(clusters[cIdx].clusterId);
+            ae.distance(-1.0);
+            ae.matched(false);
+            lastAssoc_.push_back(ae);
+        }
     }
-    for (int unmIdx : assocResult.unmatchedTracks) {
-        CounterUAS::AssocEntry ae;
-        ae.trackId(activeTracks[unmIdx]->id());
-        ae.clusterId(0xFFFFFFFFu);
-        ae.distance(-1.0);
-        ae.matched(false);
-        lastAssoc_.push_back(ae);
-    }
-    for (int cIdx : assocResult.unmatchedClusters) {
-        CounterUAS::AssocEntry ae;
-        ae.trackId(0xFFFFFFFFu);
-        ae.clusterId(clusters[cIdx].clusterId);
-        ae.distance(-1.0);
-        ae.matched(false);
-        lastAssoc_.push_back(ae);
-    }
-
-    // Update matched tracks.
-    for (const auto& match : assocResult.matched) {
-        int origIdx = activeIndices[match.trackIndex];
-        const auto& cluster = clusters[match.clusterIndex];
+
+    // Update matched tracks.  Each match owns a distinct track, so the IMM
+    // updates run in parallel; logging follows in match order.  The update
+    // keeps the gate's R: converted at the prediction, it is independent of
+    // the measurement's own error, where R taken at the noisy measurement
+    // would bias the gain.
+    auto update = [&](const AssociationResult& match, const Cluster& cluster) {
         MeasVector z = {cluster.cartesian.x, cluster.cartesian.y, cluster.cartesian.z};
 
-        immFilter_->update(tracks_[origIdx]->immState(), z, measurementNoise_);
-        tracks_[origIdx]->recordHit();
+        Track& track = tracks_[match.trackIndex];
+        IMMState state;
+        immBatch_->load(track.slot(), state);
+        immFilter_->update(state, z, trackNoise_[match.trackIndex]);
+        immBatch_->store(track.slot(), state);
+        track.setEstimate(state.mergedState, state.mergedCovariance,
+                          state.modeProbabilities);
+        tracks_.recordHit(match.trackIndex);
+    };
+    workers_->parallelFor(assocResult.matched.size(), TRACK_CHUNK, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& match = assocResult.matched[i];
+            update(match, clusters[match.clusterIndex]);
+        }
+    });
+    workers_->parallelFor(aidedMatched_.size(), TRACK_CHUNK, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& match = aidedMatched_[i];
+            update(match, aided_[match.clusterIndex]);
+        }
+    });
+
+    auto logMatch = [&](const AssociationResult& match, const Cluster& cluster) {
+        const Track& track = tracks_[match.trackIndex];
 
-        logger_.logAssociated(nowMicros(), tracks_[origIdx]->id(),
-                              cluster.clusterId, match.distance);
-        logger_.logTrackUpdated(nowMicros(), tracks_[origIdx]->id(),
-                                tracks_[origIdx]->state(), tracks_[origIdx]->status());
+        logger_.logAssociated(nowMicros(), track.id(), cluster.clusterId, match.distance);
+        logger_.logTrackUpdated(nowMicros(), track.id(), track.state(),
+                                tracks_.status(match.trackIndex));
 
         LOG_TRACE("TrackManager", "Track %u updated with cluster %u (d=%.2f)",
-                  tracks_[origIdx]->id(), cluster.clusterId, match.distance);
-    }
+                  track.id(), cluster.clusterId, match.distance);
+    };
+    for (const auto& match : assocResult.matched) logMatch(match, clusters[match.clusterIndex]);
+    for (const auto& match : aidedMatched_)      logMatch(match, aided_[match.clusterIndex]);
 
     for (int unmIdx : assocResult.unmatchedTracks) {
-        int origIdx = activeIndices[unmIdx];
-        tracks_[origIdx]->recordMiss();
-        LOG_TRACE("TrackManager", "Track %u missed", tracks_[origIdx]->id());
-    }
-
-    // Initiate new tracks from unmatched clusters.
-    std::vector<Cluster> unmatchedClusters;
-    for (int cIdx : assocResult.unmatchedClusters)
-        unmatchedClusters.push_back(clusters[cIdx]);
-
-    if (!unmatchedClusters.empty()) {
-        Timestamp ts = nowMicros();
-        auto newTracks = trackInitiator_->processCandidates(
-            unmatchedClusters, ts, dwellCount_);
-        for (auto& nt : newTracks) {
-            logger_.logTrackInitiated(ts, nt->id(), nt->state());
-            tracks_.push_back(std::move(nt));
+        tracks_.recordMiss(unmIdx);
+        LOG_TRACE("TrackManager", "Track %u missed", tracks_[unmIdx].id());
+    }
+
+    // Initiate new tracks from unmatched clusters, within maxTracks.  At
+    // capacity a new track may still displace a tentative track whose
+    // quality has decayed below a fresh track's, weakest first.
+    if (!assocResult.unmatchedClusters.empty()) {
+        size_t room = SIZE_MAX;
+        evictable_.clear();
+        if (config_.system.maxTracks > 0) {
+            const size_t cap = static_cast<size_t>(config_.system.maxTracks);
+            room = numTracks < cap ? cap - numTracks : 0;
+            for (size_t i = 0; i < numTracks; ++i)
+                if (tracks_.status(i) == TrackStatusVal::Tentative &&
+                    tracks_.quality(i) < Track::INITIAL_QUALITY)
+                    evictable_.push_back(tracks_.handle(i));
+            std::sort(evictable_.begin(), evictable_.end(),
+                      [&](TrackStore::Handle a, TrackStore::Handle b) {
+                          const size_t pa = tracks_.position(a), pb = tracks_.position(b);
+                          const double qa = tracks_.quality(pa), qb = tracks_.quality(pb);
+                          return qa < qb || (qa == qb && tracks_[pa].id() < tracks_[pb].id());
+                      });
+        }
+
+        trackInitiator_->processCandidates(
+            clusters, assocResult.unmatchedClusters, ts, dwellCount_, newTracks_,
+            room == SIZE_MAX ? SIZE_MAX : room + evictable_.size());
+        for (size_t k = 0; room != SIZE_MAX && k + room < newTracks_.size(); ++k)
+            removeTrack(tracks_.position(evictable_[k]), "capacity");
+        for (Track& nt : newTracks_) {
+            nt.setSlot(immBatch_->allocate(nt.state(), nt.covariance(),
+                                           nt.modeProbabilities()));
+            logger_.logTrackInitiated(ts, nt.id(), nt.state());
+            tracks_.add(nt);
         }
         trackInitiator_->purgeStaleCandidates(dwellCount_);
     }
 }
 
-void TrackManager::maintainTracks() {
+void TrackManager::updateLifecycle() {
+    // One pass per track: quality and status, deletion, classification,
+    // then the track table entry, with the spherical position computed once.
+    // Each step reads only its own track, so fusing them changes nothing.
     const auto& maint = config_.trackManagement.maintenance;
+    const auto& del   = config_.trackManagement.deletion;
+    const uint32_t confirmHits = static_cast<uint32_t>(maint.confirmHits);
 
-    for (auto& track : tracks_) {
-        if (track->status() == TrackStatusVal::Deleted) continue;
+    // Swap-remove: the last track moves into the hole and is visited next,
+    // so trackUpdates_ ends up in store order.
+    trackUpdates_.resize(tracks_.size());
+    handovers_.clear();
+    for (size_t i = 0; i < tracks_.size();) {
+        const uint32_t misses = tracks_.consecutiveMisses(i);
 
-        double q = track->quality();
-        if (track->consecutiveMisses() == 0)
+        double& q = tracks_.quality(i);
+        if (misses == 0)
             q = std::min(1.0, q + maint.qualityBoost);
         else
             q *= maint.qualityDecayRate;
-        track->setQuality(q);
 
-        if (track->status() == TrackStatusVal::Tentative) {
-            if (track->hitCount() >= static_cast<uint32_t>(maint.confirmHits)) {
-                track->setStatus(TrackStatusVal::Confirmed);
+        TrackStatus& status = tracks_.status(i);
+        if (status == TrackStatusVal::Tentative) {
+            if (tracks_.hitCount(i) >= confirmHits) {
+                status = TrackStatusVal::Confirmed;
+                ++numConfirmed_;
                 LOG_INFO("TrackManager", "Track %u confirmed (hits=%u)",
-                         track->id(), track->hitCount());
+                         tracks_[i].id(), tracks_.hitCount(i));
             }
-        } else if (track->status() == TrackStatusVal::Confirmed) {
-            if (track->consecutiveMisses() > 0) {
-                track->setStatus(TrackStatusVal::Coasting);
+        } else if (status == TrackStatusVal::Confirmed) {
+            if (misses > 0) {
+                status = TrackStatusVal::Coasting;
+                --numConfirmed_;
                 LOG_DEBUG("TrackManager", "Track %u coasting (misses=%u)",
-                          track->id(), track->consecutiveMisses());
+                          tracks_[i].id(), misses);
+            }
+        } else if (status == TrackStatusVal::Coasting) {
+            if (misses == 0) {
+                status = TrackStatusVal::Confirmed;
+                ++numConfirmed_;
             }
-        } else if (track->status() == TrackStatusVal::Coasting) {
-            if (track->consecutiveMisses() == 0)
-                track->setStatus(TrackStatusVal::Confirmed);
         }
+
+        Track& track = tracks_[i];
+        const SphericalPos sph = track.sphericalPosition();
+
+        const char* reason = nullptr;
+        if (static_cast<int>(misses) >= del.maxCoastingDwells)
+            reason = "max_coasting";
+        else if (q < del.minQuality)
+            reason = "low_quality";
+        else if (sph.range > del.maxRange)
+            reason = "out_of_range";
+        if (reason) {
+            removeTrack(i, reason);
+            continue;
+        }
+
+        // Well inside another node's sector: a firm track goes there whole,
+        // a tentative one is left for that node to initiate itself.
+        if (sectors_) {
+            const uint32_t to = handoverTarget(sph);
+            if (to != SectorMap::NO_NODE) {
+                if (status != TrackStatusVal::Tentative) {
+                    handovers_.emplace_back();
+                    handovers_.back().toNode = to;
+                    exportTrack(i, handovers_.back().track);
+                }
+                removeTrack(i, status != TrackStatusVal::Tentative ? "handed_over"
+                                                                   : "out_of_sector");
+                continue;
+            }
+        }
+
+        track.setClassification(classify(track));
+        tracks_.toUpdateMessage(i, sph, trackUpdates_[i]);
+        ++i;
     }
+    trackUpdates_.resize(tracks_.size());
 }
 
-void TrackManager::deleteTracks() {
-    const auto& del = config_.trackManagement.deletion;
+void TrackManager::removeTrack(size_t pos, const char* reason) {
+    const uint32_t id = tracks_[pos].id();
+    if (tracks_.status(pos) == TrackStatusVal::Confirmed) --numConfirmed_;
+    if (tracks_[pos].slot() != Track::NO_SLOT) immBatch_->release(tracks_[pos].slot());
+    tracks_.remove(pos);
+    logger_.logTrackDeleted(nowMicros(), id);
+    LOG_INFO("TrackManager", "Track %u deleted (%s)", id, reason);
+}
 
-    for (auto& track : tracks_) {
-        if (track->status() == TrackStatusVal::Deleted) continue;
+void TrackManager::gateToSector(std::vector<Detection>& dets) const {
+    const uint32_t node  = config_.distributed.nodeId;
+    const double   limit = config_.distributed.overlapM;
+    dets.erase(std::remove_if(dets.begin(), dets.end(),
+                              [&](const Detection& d) {
+                                  return sectors_->outside(node, d.range, d.azimuth) > limit;
+                              }),
+               dets.end());
+}
 
-        bool shouldDelete = false;
-        std::string reason;
+uint32_t TrackManager::handoverTarget(const SphericalPos& sph) const {
+    const uint32_t node = config_.distributed.nodeId;
+    if (sectors_->outside(node, sph.range, sph.azimuth) <= config_.distributed.handoverM)
+        return SectorMap::NO_NODE;
+    const uint32_t owner = sectors_->owner(sph.range, sph.azimuth);
+    return owner == node ? SectorMap::NO_NODE : owner;
+}
 
-        if (static_cast<int>(track->consecutiveMisses()) >= del.maxCoastingDwells) {
-            shouldDelete = true;  reason = "max_coasting";
-        } else if (track->quality() < del.minQuality) {
-            shouldDelete = true;  reason = "low_quality";
-        } else {
-            if (track->sphericalPosition().range > del.maxRange) {
-                shouldDelete = true;  reason = "out_of_range";
-            }
-        }
+bool TrackManager::acceptHandover(const CheckpointTrack& c) {
+    // The sender's dwells are not this node's: bring the state to
+    // lastDwellTime_, so the next dwell's dt carries it on from there.
+    if (c.stateTime == 0 || lastDwellTime_ == 0 || c.stateTime == lastDwellTime_)
+        return adoptHandover(c);
+
+    const Timestamp maxLag =
+        static_cast<Timestamp>(std::max(config_.trackManagement.deletion.maxCoastingDwells, 1)) *
+        static_cast<Timestamp>(std::max(config_.system.cyclePeriodMs, 1)) * 1000;
+    const bool      late = c.stateTime < lastDwellTime_;
+    const Timestamp lag  = late ? lastDwellTime_ - c.stateTime : c.stateTime - lastDwellTime_;
+    if (lag > maxLag) {
+        LOG_WARN("TrackManager", "Handover of track %u dropped: state %.2f s %s this node",
+                 c.id, lag * 1e-6, late ? "behind" : "ahead of");
+        return false;
+    }
+    if (!late) {
+        earlyHandovers_.push_back(c);
+        return true;
+    }
+
+    CheckpointTrack aligned = c;
+    immFilter_->predict(lag * 1e-6, aligned.imm);
+    aligned.state      = aligned.imm.mergedState;
+    aligned.covariance = aligned.imm.mergedCovariance;
+    aligned.modeProbs  = aligned.imm.modeProbabilities;
+    aligned.stateTime  = lastDwellTime_;
+    return adoptHandover(aligned);
+}
+
+bool TrackManager::adoptHandover(const CheckpointTrack& c) {
+    const double gate2 = config_.distributed.dedupGateM * config_.distributed.dedupGateM;
 
-        if (shouldDelete) {
-            track->setStatus(TrackStatusVal::Deleted);
-            logger_.logTrackDeleted(nowMicros(), track->id());
-            LOG_INFO("TrackManager", "Track %u deleted (%s)",
-                     track->id(), reason.c_str());
+    // The nearest local track on the same target, if any.
+    size_t dup   = SIZE_MAX;
+    double best2 = gate2;
+    for (size_t i = 0; i < tracks_.size(); ++i) {
+        const StateVector& x = tracks_[i].state();
+        const double dx = x[0] - c.state[0], dy = x[3] - c.state[3], dz = x[6] - c.state[6];
+        const double d2 = dx * dx + dy * dy + dz * dz;
+        if (d2 < best2) { best2 = d2; dup = i; }
+    }
+    if (dup != SIZE_MAX) {
+        if (tracks_.hitCount(dup) >= c.hitCount) {
+            LOG_INFO("TrackManager", "Handover of track %u dropped: duplicate of track %u",
+                     c.id, tracks_[dup].id());
+            return false;
         }
+        removeTrack(dup, "duplicate");
+    }
+
+    if (config_.system.maxTracks > 0 &&
+        tracks_.size() >= static_cast<size_t>(config_.system.maxTracks)) {
+        LOG_WARN("TrackManager", "Handover of track %u dropped: maxTracks reached", c.id);
+        return false;
     }
 
-    tracks_.erase(
-        std::remove_if(tracks_.begin(), tracks_.end(),
-                       [](const std::unique_ptr<Track>& t) {
-                           return t->status() == TrackStatusVal::Deleted;
-                       }),
-        tracks_.end());
+    importTrack(c);
+    logger_.logTrackInitiated(nowMicros(), c.id, c.state);
+    LOG_INFO("TrackManager", "Track %u taken over (hits=%u)", c.id, c.hitCount);
+    return true;
 }
 
-void TrackManager::classifyTracks() {
-    for (auto& track : tracks_) {
-        if (track->status() == TrackStatusVal::Deleted) continue;
+void TrackManager::saveCheckpoint() {
+    CheckpointImage& img = ckptImage_;
+    img.sensorId      = sensorId_;
+    img.dwellCount    = dwellCount_;
+    img.lastDwellTime = lastDwellTime_;
+    img.nextTrackId   = trackInitiator_->nextId();
+    img.nextSerial    = trackInitiator_->nextSerial();
+    img.ringSize      = static_cast<uint32_t>(trackInitiator_->ringSize());
 
-        auto vel = track->velocity();
-        double speed = std::sqrt(vel.x*vel.x + vel.y*vel.y + vel.z*vel.z);
+    img.tracks.resize(tracks_.size());
+    for (size_t i = 0; i < tracks_.size(); ++i) exportTrack(i, img.tracks[i]);
+    img.candidates = trackInitiator_->candidates();
+    img.history    = trackInitiator_->history();
 
-        const auto& probs = track->immState().modeProbabilities;
-        double cvProb  = probs[0];
-        double caProb  = probs[1] + probs[2];
-        double ctrProb = probs[3] + probs[4];
+    if (!checkpoint_->save(img))
+        LOG_WARN("TrackManager", "Checkpoint of dwell %u failed", dwellCount_);
+}
 
-        if (speed < 2.0)
-            track->setClassification(TrackClassVal::Clutter);
-        else if (ctrProb > 0.4 && speed > 5.0 && speed < 30.0)
-            track->setClassification(TrackClassVal::DroneRotary);
-        else if (cvProb > 0.3 && speed > 15.0 && speed < 80.0)
-            track->setClassification(TrackClassVal::DroneFixedWing);
-        else if (speed > 5.0 && speed < 25.0 && caProb > 0.3)
-            track->setClassification(TrackClassVal::Bird);
-        else
-            track->setClassification(TrackClassVal::Unknown);
+void TrackManager::restoreCheckpoint() {
+    CheckpointImage& img = ckptImage_;
+    if (!checkpoint_->load(img)) return;
+    if (img.sensorId != sensorId_) {
+        LOG_WARN("TrackManager", "%s belongs to sensor %u; ignored",
+                 checkpoint_->path().c_str(), img.sensorId);
+        return;
     }
+
+    for (const CheckpointTrack& c : img.tracks) importTrack(c);
+
+    // Candidate histories are laid out by ring size; under a different
+    // initiation config only the track ID sequence carries over.
+    if (img.ringSize == trackInitiator_->ringSize())
+        trackInitiator_->restore(img.candidates, img.history, img.nextTrackId, img.nextSerial);
+    else
+        trackInitiator_->setFirstTrackId(img.nextTrackId);
+
+    lastDwellTime_ = img.lastDwellTime;
+    dwellCount_    = img.dwellCount;
+    resumed_       = true;
+
+    LOG_INFO("TrackManager", "Sensor %u resumed %zu tracks (%u confirmed) from dwell %u of %s",
+             sensorId_, tracks_.size(), numConfirmed_, dwellCount_,
+             checkpoint_->path().c_str());
 }
 
-std::vector<CounterUAS::TrackUpdateMessage> TrackManager::getTrackUpdates() const {
-    std::vector<CounterUAS::TrackUpdateMessage> updates;
-    updates.reserve(tracks_.size());
-    for (const auto& track : tracks_)
-        updates.push_back(track->toUpdateMessage());
-    return updates;
+void TrackManager::exportTrack(size_t pos, CheckpointTrack& c) const {
+    const Track& t = tracks_[pos];
+    c.id                = t.id();
+    c.status            = static_cast<uint32_t>(tracks_.status(pos));
+    c.classification    = static_cast<uint32_t>(t.classification());
+    c.hitCount          = tracks_.hitCount(pos);
+    c.consecutiveMisses = tracks_.consecutiveMisses(pos);
+    c.missCount         = t.missCount();
+    c.age               = t.age();
+    c.quality           = tracks_.quality(pos);
+    c.initiationTime    = t.initiationTime();
+    c.lastUpdateTime    = t.lastUpdateTime();
+    c.stateTime         = dwellTime_;
+    if (t.slot() != Track::NO_SLOT) {
+        c.state      = t.state();
+        c.covariance = t.covariance();
+        c.modeProbs  = t.modeProbabilities();
+        immBatch_->load(t.slot(), c.imm);
+        return;
+    }
+    // A lazy track goes out fully predicted, not as its extrapolation.
+    const LazyTrack& lazy = lazy_[tracks_.handle(pos)];
+    c.imm = lazy.imm;
+    for (double step : lazy.steps) immFilter_->predict(step, c.imm);
+    c.state      = c.imm.mergedState;
+    c.covariance = c.imm.mergedCovariance;
+    c.modeProbs  = c.imm.modeProbabilities;
+}
+
+void TrackManager::importTrack(const CheckpointTrack& c) {
+    Track t(c.id, c.state, c.covariance, config_.prediction, c.initiationTime);
+    t.setEstimate(c.state, c.covariance, c.modeProbs);
+    t.setClassification(static_cast<TrackClassification>(c.classification));
+    t.restoreCounters(c.missCount, c.age, c.lastUpdateTime);
+    t.setSlot(immBatch_->allocate(c.state, c.covariance, c.modeProbs));
+    immBatch_->store(t.slot(), c.imm);
+
+    tracks_.add(t);
+    const size_t pos = tracks_.size() - 1;
+    tracks_.status(pos)            = static_cast<TrackStatus>(c.status);
+    tracks_.hitCount(pos)          = c.hitCount;
+    tracks_.consecutiveMisses(pos) = c.consecutiveMisses;
+    tracks_.quality(pos)           = c.quality;
+    if (tracks_.status(pos) == TrackStatusVal::Confirmed) ++numConfirmed_;
+}
+
+void TrackManager::discardRestored() {
+    LOG_INFO("TrackManager", "Checkpoint is stale; discarding %zu restored tracks",
+             tracks_.size());
+    for (size_t i = 0; i < tracks_.size(); ++i) immBatch_->release(tracks_[i].slot());
+    tracks_.clear();
+    numConfirmed_ = 0;
+    // Keep handing out fresh IDs so none is reused downstream.
+    trackInitiator_->restore({}, {}, trackInitiator_->nextId(), trackInitiator_->nextSerial());
+    lastDwellTime_ = 0;
+}
+
+TrackClassification TrackManager::classify(const Track& track) {
+    auto vel = track.velocity();
+    double speed = std::sqrt(vel.x*vel.x + vel.y*vel.y + vel.z*vel.z);
+
+    const auto& probs = track.modeProbabilities();
+    double cvProb  = probs[0];
+    double caProb  = probs[1] + probs[2];
+    double ctrProb = probs[3] + probs[4];
+
+    if (speed < 2.0)
+        return TrackClassVal::Clutter;
+    if (ctrProb > 0.4 && speed > 5.0 && speed < 30.0)
+        return TrackClassVal::DroneRotary;
+    if (cvProb > 0.3 && speed > 15.0 && speed < 80.0)
+        return TrackClassVal::DroneFixedWing;
+    if (speed > 5.0 && speed < 25.0 && caProb > 0.3)
+        return TrackClassVal::Bird;
+    return TrackClassVal::Unknown;
 }
 
-uint32_t TrackManager::numActiveTracks() const {
-    uint32_t count = 0;
-    for (const auto& t : tracks_)
-        if (t->status() != TrackStatusVal::Deleted) ++count;
-    return count;
+uint64_t TrackManager::droppedDetections() const {
+    return budget_ ? budget_->totalDropped() : 0;
 }
 
-uint32_t TrackManager::numConfirmedTracks() const {
-    uint32_t count = 0;
-    for (const auto& t : tracks_)
-        if (t->status() == TrackStatusVal::Confirmed) ++count;
-    return count;
+uint64_t TrackManager::deferredInitiations() const {
+    return trackInitiator_->totalDeferred();
 }
 
 } // namespace cuas
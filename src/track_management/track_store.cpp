@@ -0,0 +1,138 @@
+#include "track_management/track_store.h"
+#include <utility>
+
+namespace cuas {
+
+void TrackStore::reserve(size_t n) {
+    records_.reserve(n);
+    status_.reserve(n);
+    misses_.reserve(n);
+    quality_.reserve(n);
+    hits_.reserve(n);
+    handleOf_.reserve(n);
+    posOf_.reserve(n);
+    freeHandles_.reserve(n);
+    while (ids_.size() < 2 * n) growIds();
+}
+
+TrackStore::Handle TrackStore::add(const Track& t) {
+    Handle h;
+    if (!freeHandles_.empty()) {
+        h = freeHandles_.back();
+        freeHandles_.pop_back();
+    } else {
+        h = static_cast<Handle>(posOf_.size());
+        posOf_.push_back(0);
+    }
+    posOf_[h] = static_cast<uint32_t>(records_.size());
+
+    records_.push_back(t);
+    status_.push_back(TrackStatusVal::Tentative);
+    misses_.push_back(0);
+    quality_.push_back(Track::INITIAL_QUALITY);
+    hits_.push_back(1);
+    handleOf_.push_back(h);
+
+    insertId(t.id(), h);
+    return h;
+}
+
+void TrackStore::remove(size_t pos) {
+    eraseId(records_[pos].id());
+    freeHandles_.push_back(handleOf_[pos]);
+
+    const size_t last = records_.size() - 1;
+    if (pos != last) {
+        records_[pos]  = std::move(records_[last]);
+        status_[pos]   = status_[last];
+        misses_[pos]   = misses_[last];
+        quality_[pos]  = quality_[last];
+        hits_[pos]     = hits_[last];
+        handleOf_[pos] = handleOf_[last];
+        posOf_[handleOf_[pos]] = static_cast<uint32_t>(pos);
+    }
+    records_.pop_back();
+    status_.pop_back();
+    misses_.pop_back();
+    quality_.pop_back();
+    hits_.pop_back();
+    handleOf_.pop_back();
+}
+
+void TrackStore::clear() {
+    while (!empty()) remove(size() - 1);
+}
+
+void TrackStore::recordHit(size_t pos) {
+    ++hits_[pos];
+    misses_[pos] = 0;
+    records_[pos].markUpdated();
+}
+
+void TrackStore::recordMiss(size_t pos) {
+    ++misses_[pos];
+    records_[pos].recordMiss();
+}
+
+void TrackStore::toUpdateMessage(size_t pos, const SphericalPos& sph,
+                                 CounterUAS::TrackUpdateMessage& msg) const {
+    records_[pos].toUpdateMessage(sph, status_[pos], quality_[pos], hits_[pos], msg);
+}
+
+// ---------------------------------------------------------------------------
+// ID table
+// ---------------------------------------------------------------------------
+
+size_t TrackStore::home(uint32_t id) const {
+    // Fibonacci hashing: the top idBits_ bits of id * 2^64 / phi.
+    return static_cast<size_t>((id * 0x9E3779B97F4A7C15ull) >> (64 - idBits_));
+}
+
+long TrackStore::find(uint32_t id) const {
+    if (ids_.empty() || id == 0) return -1;
+    const size_t mask = ids_.size() - 1;
+    for (size_t i = home(id);; i = (i + 1) & mask) {
+        if (ids_[i].id == id) return static_cast<long>(posOf_[ids_[i].handle]);
+        if (ids_[i].id == 0)  return -1;
+    }
+}
+
+void TrackStore::insertId(uint32_t id, Handle h) {
+    if (2 * (size() + 1) > ids_.size()) growIds();
+    const size_t mask = ids_.size() - 1;
+    size_t i = home(id);
+    while (ids_[i].id != 0) i = (i + 1) & mask;
+    ids_[i] = {id, h};
+}
+
+void TrackStore::eraseId(uint32_t id) {
+    const size_t mask = ids_.size() - 1;
+    size_t i = home(id);
+    while (ids_[i].id != id) i = (i + 1) & mask;
+
+    // Pull later entries of the probe run back over the hole, unless their
+    // home lies cyclically in (hole, entry].
+    for (size_t j = (i + 1) & mask; ids_[j].id != 0; j = (j + 1) & mask) {
+        const size_t k = home(ids_[j].id);
+        const bool stays = i <= j ? (i < k && k <= j) : (i < k || k <= j);
+        if (stays) continue;
+        ids_[i] = ids_[j];
+        i = j;
+    }
+    ids_[i] = {0, 0};
+}
+
+void TrackStore::growIds() {
+    std::vector<IdEntry> old = std::move(ids_);
+    idBits_ = old.empty() ? 6 : idBits_ + 1;
+    ids_.assign(size_t(1) << idBits_, IdEntry{0, 0});
+    const size_t mask = ids_.size() - 1;
+    for (const IdEntry& e : old) {
+        if (e.id == 0) continue;
+        size_t i = home(e.id);
+        while (ids_[i].id != 0) i = (i + 1) & mask;
+        ids_[i] = e;
+    }
+}
+
+} // namespace cuas
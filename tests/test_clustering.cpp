@@ -0,0 +1,391 @@
+/*
+ * test_clustering.cpp
+ *
+ * Checks the connected-components clusterer against a brute-force
+ * component search and against DBSCAN with minPoints = 1, which must
+ * produce the same clusters.
+ *
+ * Tests
+ *   1. ComponentClusterer and DBSCAN (minPoints = 1) both give the
+ *      brute-force components of the gate graph, and identical clusters
+ *   2. The partition does not depend on the order of the detections
+ *   3. 5000 clutter detections: DBSCAN vs connected-components times are
+ *      printed
+ *   4. ClutterMap drops a stationary return once learned, passes a moving
+ *      target, and lets the stationary cell through again after it decays
+ *   5. SectorClusterer matches the serial clusterer of every method, on a
+ *      dense dwell and on one with azimuth gaps between bands of clutter
+ *   6. DetectionBudget keeps the highest-SNR detections in dwell order
+ */
+
+#include "clustering/component_clusterer.h"
+#include "clustering/dbscan_clusterer.h"
+#include "clustering/sector_clusterer.h"
+#include "preprocessing/clutter_map.h"
+#include "preprocessing/detection_budget.h"
+
+#include <iostream>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+using namespace cuas;
+
+// ---------------------------------------------------------------------------
+// Lightweight test framework
+// ---------------------------------------------------------------------------
+static int g_pass = 0;
+static int g_fail = 0;
+
+#define CHECK(expr, label)                                              \
+    do {                                                                \
+        if (expr) {                                                     \
+            std::cout << "  PASS  " << (label) << "\n";                \
+            ++g_pass;                                                   \
+        } else {                                                        \
+            std::cout << "  FAIL  " << (label) << "\n";                \
+            ++g_fail;                                                   \
+        }                                                               \
+    } while (0)
+
+static std::mt19937_64 g_rng(20240611);
+
+static double uniform(double lo, double hi) {
+    return std::uniform_real_distribution<double>(lo, hi)(g_rng);
+}
+
+static const ConnectedComponentsConfig kGates = {5.0, 0.006, 0.006};
+
+static DBScanConfig dbscanConfig() {
+    DBScanConfig d;
+    d.epsilonRange     = kGates.rangeGateSize;
+    d.epsilonAzimuth   = kGates.azimuthGateSize;
+    d.epsilonElevation = kGates.elevationGateSize;
+    d.minPoints        = 1;
+    return d;
+}
+
+// Clutter over a small volume plus a few tight targets, so both isolated
+// points and long chains occur.
+static std::vector<Detection> makeDwell(int n) {
+    std::vector<Detection> dets;
+    for (int i = 0; i < n; ++i) {
+        Detection d;
+        if (i % 10 == 0) {
+            d.range     = 1000.0 + 50.0 * (i % 7) + uniform(-2.0, 2.0);
+            d.azimuth   = 0.05 * (i % 5) + uniform(-0.002, 0.002);
+            d.elevation = 0.02 + uniform(-0.002, 0.002);
+        } else {
+            d.range     = uniform(900.0, 900.0 + 0.4 * n);
+            d.azimuth   = uniform(-0.1, 0.3);
+            d.elevation = uniform(0.0, 0.06);
+        }
+        d.strength = uniform(-90.0, -40.0);
+        d.snr      = uniform(10.0, 40.0);
+        dets.push_back(d);
+    }
+    return dets;
+}
+
+// Component of every detection by breadth-first search over all pairs.
+static std::vector<int> bruteComponents(const std::vector<Detection>& dets) {
+    const int n = static_cast<int>(dets.size());
+    auto linked = [&](const Detection& a, const Detection& b) {
+        double dr = (a.range - b.range) / kGates.rangeGateSize;
+        double da = (a.azimuth - b.azimuth) / kGates.azimuthGateSize;
+        double de = (a.elevation - b.elevation) / kGates.elevationGateSize;
+        return dr * dr + da * da + de * de <= 1.0;
+    };
+    std::vector<int> comp(n, -1);
+    int next = 0;
+    for (int s = 0; s < n; ++s) {
+        if (comp[s] >= 0) continue;
+        std::vector<int> queue = {s};
+        comp[s] = next;
+        for (size_t q = 0; q < queue.size(); ++q)
+            for (int j = 0; j < n; ++j)
+                if (comp[j] < 0 && linked(dets[queue[q]], dets[j])) {
+                    comp[j] = next;
+                    queue.push_back(j);
+                }
+        ++next;
+    }
+    return comp;
+}
+
+// Clusters as sets of detections, keyed by the detections themselves so
+// that partitions of permuted inputs compare equal.
+static std::set<std::set<std::pair<double, double>>> partition(
+        const std::vector<Detection>& dets, const std::vector<Cluster>& clusters) {
+    std::set<std::set<std::pair<double, double>>> p;
+    for (const auto& c : clusters) {
+        std::set<std::pair<double, double>> members;
+        for (uint32_t i : c.detectionIndices)
+            members.insert({dets[i].range, dets[i].azimuth});
+        p.insert(members);
+    }
+    return p;
+}
+
+static bool sameClusters(const std::vector<Cluster>& a, const std::vector<Cluster>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t k = 0; k < a.size(); ++k)
+        if (a[k].detectionIndices != b[k].detectionIndices ||
+            a[k].range != b[k].range || a[k].azimuth != b[k].azimuth ||
+            a[k].elevation != b[k].elevation || a[k].strength != b[k].strength)
+            return false;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Test 1: brute force and DBSCAN agreement
+// ---------------------------------------------------------------------------
+static void testAgainstBruteForce()
+{
+    std::cout << "\n[Test 1] Connected components vs brute force and DBSCAN\n";
+    ComponentClusterer components(kGates);
+    DBScanClusterer    dbscan(dbscanConfig());
+
+    bool matchBrute = true, matchDbscan = true;
+    std::vector<Cluster> a, b;
+    for (int trial = 0; trial < 50; ++trial) {
+        std::vector<Detection> dets = makeDwell(1 + trial * 8);
+        components.cluster(dets, a);
+        dbscan.cluster(dets, b);
+
+        std::vector<int> comp = bruteComponents(dets);
+        int numComp = *std::max_element(comp.begin(), comp.end()) + 1;
+        bool ok = static_cast<int>(a.size()) == numComp;
+        for (size_t k = 0; ok && k < a.size(); ++k)
+            for (uint32_t i : a[k].detectionIndices)
+                if (comp[i] != static_cast<int>(k)) { ok = false; break; }
+        matchBrute  = matchBrute && ok;
+        matchDbscan = matchDbscan && sameClusters(a, b);
+    }
+    CHECK(matchBrute, "clusters are the gate graph's components, lowest index first");
+    CHECK(matchDbscan, "clusters equal DBSCAN with minPoints = 1");
+
+    std::vector<Detection> none;
+    components.cluster(none, a);
+    CHECK(a.empty(), "no detections, no clusters");
+}
+
+// ---------------------------------------------------------------------------
+// Test 2: order independence
+// ---------------------------------------------------------------------------
+static void testOrderIndependence()
+{
+    std::cout << "\n[Test 2] Order independence\n";
+    ComponentClusterer components(kGates);
+
+    bool same = true;
+    std::vector<Cluster> a, b;
+    for (int trial = 0; trial < 20; ++trial) {
+        std::vector<Detection> dets = makeDwell(200);
+        std::vector<Detection> shuffled = dets;
+        std::shuffle(shuffled.begin(), shuffled.end(), g_rng);
+        components.cluster(dets, a);
+        components.cluster(shuffled, b);
+        same = same && partition(dets, a) == partition(shuffled, b);
+    }
+    CHECK(same, "shuffled detections give the same partition");
+}
+
+// ---------------------------------------------------------------------------
+// Test 3: dense dwell timing
+// ---------------------------------------------------------------------------
+static void testDenseTiming()
+{
+    std::cout << "\n[Test 3] 5000-detection dwell\n";
+    ComponentClusterer components(kGates);
+    DBScanClusterer    dbscan(dbscanConfig());
+    std::vector<Detection> dets = makeDwell(5000);
+
+    using Clock = std::chrono::steady_clock;
+    std::vector<Cluster> a, b;
+    auto t0 = Clock::now();
+    components.cluster(dets, a);
+    auto t1 = Clock::now();
+    dbscan.cluster(dets, b);
+    auto t2 = Clock::now();
+
+    CHECK(sameClusters(a, b), "same clusters as DBSCAN on a dense dwell");
+    std::cout << "  " << a.size() << " clusters; components "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, DBSCAN "
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms\n";
+}
+
+// ---------------------------------------------------------------------------
+// Test 4: clutter map learns and forgets a stationary return
+// ---------------------------------------------------------------------------
+static void testClutterMap()
+{
+    std::cout << "\n[Test 4] Clutter map suppression\n";
+
+    PreprocessConfig pre;
+    pre.clutterMap.enabled = true;
+    ClutterMap map(pre);
+
+    Detection tower;
+    tower.range = 2000.0; tower.azimuth = 0.1; tower.elevation = 0.03;
+
+    // alpha 0.05, threshold 0.5: the 15th consecutive hit is the first
+    // judged on a learned density >= 0.5.
+    int towerKept = 0, targetKept = 0, firstDropped = -1;
+    const int dwells = 40;
+    for (int k = 0; k < dwells; ++k) {
+        Detection target = tower;
+        target.range = 3000.0 + 20.0 * k;
+        std::vector<Detection> dets = {tower, target};
+        map.filter(dets);
+        for (const auto& d : dets) {
+            if (d.range == tower.range) ++towerKept;
+            else ++targetKept;
+        }
+        if (firstDropped < 0 && (dets.empty() || dets[0].range != tower.range))
+            firstDropped = k + 1;
+    }
+    CHECK(firstDropped == 15, "stationary return dropped from its 15th dwell");
+    CHECK(towerKept == 14, "stationary return kept only while learning");
+    CHECK(targetKept == dwells, "moving target never dropped");
+    CHECK(map.totalSuppressed() == uint64_t(dwells - 14), "suppression count");
+
+    for (int k = 0; k < 30; ++k) {
+        std::vector<Detection> none;
+        map.filter(none);
+    }
+    std::vector<Detection> dets = {tower};
+    map.filter(dets);
+    CHECK(dets.size() == 1, "stationary cell passes again after going quiet");
+
+    Detection outside = tower;
+    outside.elevation = 0.5;    // above maxElevation: never mapped
+    for (int k = 0; k < dwells; ++k) {
+        std::vector<Detection> high = {outside};
+        map.filter(high);
+        if (high.empty()) { outside.range = -1.0; break; }
+    }
+    CHECK(outside.range == tower.range, "returns above maxElevation never dropped");
+}
+
+// ---------------------------------------------------------------------------
+// Test 5: sector-parallel clustering equals serial
+// ---------------------------------------------------------------------------
+static ClusterConfig methodConfig(ClusterMethod method, int minPoints) {
+    ClusterConfig c;
+    c.method = method;
+    c.dbscan = dbscanConfig();
+    c.dbscan.minPoints = minPoints;
+    c.rangeBased    = {kGates.rangeGateSize, kGates.azimuthGateSize, kGates.elevationGateSize};
+    c.rangeStrength = {kGates.rangeGateSize, kGates.azimuthGateSize, kGates.elevationGateSize, 6.0};
+    c.connectedComponents = kGates;
+    return c;
+}
+
+// 30 bands of clutter 0.01 rad wide, 0.02 rad apart.
+static std::vector<Detection> makeBandedDwell(int n) {
+    std::vector<Detection> dets = makeDwell(n);
+    for (auto& d : dets) {
+        int band = static_cast<int>(uniform(0.0, 30.0));
+        d.azimuth = -0.4 + 0.03 * band + uniform(0.0, 0.01);
+    }
+    return dets;
+}
+
+static void testSectors()
+{
+    std::cout << "\n[Test 5] Sector-parallel clustering\n";
+
+    struct Case { ClusterMethod method; int minPoints; const char* label; };
+    const Case cases[] = {
+        {ClusterMethod::DBSCAN,              1, "DBSCAN minPoints=1"},
+        {ClusterMethod::DBSCAN,              3, "DBSCAN minPoints=3"},
+        {ClusterMethod::ConnectedComponents, 1, "ConnectedComponents"},
+        {ClusterMethod::RangeBased,          1, "RangeBased"},
+        {ClusterMethod::RangeStrengthBased,  1, "RangeStrength"},
+    };
+    const std::vector<Detection> dense  = makeDwell(4000);
+    const std::vector<Detection> banded = makeBandedDwell(4000);
+
+    for (const Case& c : cases) {
+        ClusterConfig cfg = methodConfig(c.method, c.minPoints);
+        std::unique_ptr<IClusterer> serial = makeClusterer(cfg);
+        cfg.sectors = 4;
+        SectorClusterer sectored(cfg);
+
+        bool same = true;
+        std::vector<Cluster> a, b;
+        for (const auto* dets : {&dense, &banded}) {
+            for (int dwell = 0; dwell < 2; ++dwell) {   // second pass reuses scratch
+                serial->cluster(*dets, a);
+                sectored.cluster(*dets, b);
+                same = same && sameClusters(a, b);
+            }
+        }
+        CHECK(same, std::string(c.label) + ": same clusters as serial");
+    }
+
+    ClusterConfig cfg = methodConfig(ClusterMethod::DBSCAN, 1);
+    cfg.sectors = 4;
+    ClusterEngine serial(methodConfig(ClusterMethod::DBSCAN, 1)), sectored(cfg);
+    std::vector<Cluster> a = serial.process(dense), b = sectored.process(dense);
+    bool sameIds = a.size() == b.size();
+    for (size_t k = 0; sameIds && k < a.size(); ++k) sameIds = a[k].clusterId == b[k].clusterId;
+    CHECK(sameIds, "ClusterEngine hands out the same clusterIds");
+}
+
+// ---------------------------------------------------------------------------
+// Test 6: detection budget
+// ---------------------------------------------------------------------------
+static void testBudget()
+{
+    std::cout << "\n[Test 6] Detection budget\n";
+
+    std::vector<Detection> dets = makeDwell(1000);
+    dets[17].snr = std::nan("");
+    std::vector<Detection> expected = dets;
+    std::vector<double> snrs;
+    for (const auto& d : dets) if (!std::isnan(d.snr)) snrs.push_back(d.snr);
+    std::sort(snrs.rbegin(), snrs.rend());
+    const double cut = snrs[99];
+    expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                  [&](const Detection& d) { return !(d.snr >= cut); }),
+                   expected.end());
+
+    DetectionBudget budget(100);
+    budget.apply(dets);
+    bool same = dets.size() == expected.size();
+    for (size_t i = 0; same && i < dets.size(); ++i)
+        same = dets[i].range == expected[i].range && dets[i].snr == expected[i].snr;
+    CHECK(same, "top 100 by SNR kept, in dwell order");
+    CHECK(budget.totalDropped() == 900, "dropped count");
+
+    budget.apply(dets);
+    CHECK(dets.size() == 100 && budget.totalDropped() == 900, "dwell within budget untouched");
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  Counter-UAS Clustering Tests\n";
+    std::cout << "====================================================\n";
+
+    testAgainstBruteForce();
+    testOrderIndependence();
+    testDenseTiming();
+    testClutterMap();
+    testSectors();
+    testBudget();
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  Results: " << g_pass << " passed, "
+              << g_fail << " failed\n";
+    std::cout << "====================================================\n";
+
+    return g_fail == 0 ? 0 : 1;
+}
@@ -0,0 +1,700 @@
+/*
+ * test_gnn_assignment.cpp
+ *
+ * Checks the sparse Jonker-Volgenant solver used by the GNN associator
+ * against exhaustive search and compares it with the greedy solver on
+ * synthetic dwells; also covers the association pre-gate, component
+ * decomposition, exact JPDA and the MHT associator.
+ *
+ * Tests
+ *   1. SparseAssignmentSolver total cost equals brute force on small
+ *      random gated problems
+ *   2. Degenerate inputs: no rows, no candidates, one contested column
+ *   3. GNNAssociator JV vs greedy at 50 / 200 / 1000 tracks x clusters:
+ *      JV never costs more; per-dwell times are printed
+ *   4. ClusterIndex pre-gate returns every gated cluster, in index order;
+ *      all-pairs vs indexed gating times are printed
+ *   5. AssociationEngine component decomposition gives the whole-dwell
+ *      result for every method; whole vs decomposed times are printed
+ *   6. Exact JPDA betas equal brute-force joint-event sums; over budget the
+ *      per-track approximation is used
+ *   7. Murty k-best costs equal the k cheapest of all enumerated assignments
+ *   8. MHTAssociator: a fresh tree reports the GNN-JV result, one hypothesis
+ *      stays GNN-JV, and crossing dwells respect the node and leaf budgets
+ */
+
+#include "association/assignment.h"
+#include "association/gnn_associator.h"
+#include "association/jpda_associator.h"
+#include "association/murty.h"
+#include "association/mht_associator.h"
+#include "association/cluster_index.h"
+#include "association/association_engine.h"
+#include "common/worker_pool.h"
+#include "common/matrix_ops.h"
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+
+using namespace cuas;
+
+// ---------------------------------------------------------------------------
+// Lightweight test framework
+// ---------------------------------------------------------------------------
+static int g_pass = 0;
+static int g_fail = 0;
+
+#define CHECK(expr, label)                                              \
+    do {                                                                \
+        if (expr) {                                                     \
+            std::cout << "  PASS  " << (label) << "\n";                \
+            ++g_pass;                                                   \
+        } else {                                                        \
+            std::cout << "  FAIL  " << (label) << "\n";                \
+            ++g_fail;                                                   \
+        }                                                               \
+    } while (0)
+
+static std::mt19937_64 g_rng(20240611);
+
+static double uniform(double lo, double hi) {
+    return std::uniform_real_distribution<double>(lo, hi)(g_rng);
+}
+
+// sum of assigned costs + missCost per unassigned row; -1 if infeasible
+// (a column used twice or a pair that is not stored).
+static double objective(const SparseCostMatrix& C, double missCost,
+                        const std::vector<int>& rowToCol) {
+    std::vector<char> used(C.numCols, 0);
+    double total = 0.0;
+    for (int r = 0; r < C.numRows(); ++r) {
+        int c = rowToCol[r];
+        if (c < 0) { total += missCost; continue; }
+        if (used[c]) return -1.0;
+        used[c] = 1;
+        bool found = false;
+        for (int e = C.rowStart[r]; e < C.rowStart[r + 1]; ++e)
+            if (C.col[e] == c) { total += C.cost[e]; found = true; }
+        if (!found) return -1.0;
+    }
+    return total;
+}
+
+static double bruteForce(const SparseCostMatrix& C, double missCost) {
+    std::vector<char> used(C.numCols, 0);
+    std::function<double(int)> best = [&](int r) -> double {
+        if (r == C.numRows()) return 0.0;
+        double b = missCost + best(r + 1);
+        for (int e = C.rowStart[r]; e < C.rowStart[r + 1]; ++e) {
+            int c = C.col[e];
+            if (used[c]) continue;
+            used[c] = 1;
+            b = std::min(b, C.cost[e] + best(r + 1));
+            used[c] = 0;
+        }
+        return b;
+    };
+    return best(0);
+}
+
+// ---------------------------------------------------------------------------
+// Test 1: optimality on small problems
+// ---------------------------------------------------------------------------
+static void testOptimality() {
+    std::cout << "\n[Test 1] Sparse JV vs exhaustive search\n";
+
+    SparseAssignmentSolver solver;
+    SparseCostMatrix C;
+    std::vector<int> rowToCol;
+    bool feasible = true, optimal = true;
+    for (int t = 0; t < 500; ++t) {
+        int rows = static_cast<int>(uniform(0, 7));
+        int cols = static_cast<int>(uniform(1, 7));
+        double missCost = uniform(5, 20);
+        C.reset(cols);
+        for (int r = 0; r < rows; ++r) {
+            for (int c = 0; c < cols; ++c)
+                if (uniform(0, 1) < 0.5) C.add(c, uniform(0, missCost));
+            C.endRow();
+        }
+        solver.solve(C, missCost, rowToCol);
+        double got = objective(C, missCost, rowToCol);
+        feasible = feasible && got >= 0.0;
+        optimal  = optimal && std::abs(got - bruteForce(C, missCost)) < 1e-9;
+    }
+    CHECK(feasible, "assignments use stored pairs and each column at most once");
+    CHECK(optimal, "total cost equals exhaustive search on 500 random problems");
+}
+
+// ---------------------------------------------------------------------------
+// Test 2: degenerate inputs
+// ---------------------------------------------------------------------------
+static void testDegenerate() {
+    std::cout << "\n[Test 2] Degenerate inputs\n";
+
+    SparseAssignmentSolver solver;
+    SparseCostMatrix C;
+    std::vector<int> rowToCol{7};
+
+    C.reset(3);
+    solver.solve(C, 10.0, rowToCol);
+    CHECK(rowToCol.empty(), "no rows gives an empty assignment");
+
+    C.reset(3);
+    C.endRow();
+    C.endRow();
+    solver.solve(C, 10.0, rowToCol);
+    CHECK(rowToCol == std::vector<int>({-1, -1}), "rows without candidates stay unassigned");
+
+    // Three rows want column 0; row 1 has the cheapest claim, row 2 a fallback.
+    C.reset(2);
+    C.add(0, 4.0);              C.endRow();
+    C.add(0, 1.0);              C.endRow();
+    C.add(0, 2.0); C.add(1, 3.0); C.endRow();
+    solver.solve(C, 10.0, rowToCol);
+    CHECK(rowToCol == std::vector<int>({-1, 0, 1}), "contested column goes to the optimal row");
+}
+
+// ---------------------------------------------------------------------------
+// Test 3: GNNAssociator, JV vs greedy
+// ---------------------------------------------------------------------------
+// n targets 30 m apart with 10 m measurement sigma, so gates overlap; 90%
+// detected, plus 10% uniform clutter.
+static void makeScene(int n, std::vector<InnovationStats>& tracks, std::vector<Cluster>& clusters) {
+    tracks.clear();
+    clusters.clear();
+    std::normal_distribution<double> noise(0.0, 10.0);
+    const int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(n))));
+    InnovationStats inn;
+    inn.valid = true;
+    for (int m = 0; m < MEAS_DIM; ++m) {
+        inn.Sinv[m][m] = 1.0 / 100.0;
+        inn.sDiag[m]   = 100.0;
+    }
+
+    for (int t = 0; t < n; ++t) {
+        StateVector x{};
+        x[0] = 2000.0 + 30.0 * (t % side);
+        x[3] = 1000.0 + 30.0 * (t / side);
+        x[6] = 100.0;
+        inn.zPred = {x[0], x[3], x[6]};
+        tracks.push_back(inn);
+
+        if (uniform(0, 1) < 0.9) {
+            Cluster c;
+            c.cartesian = {x[0] + noise(g_rng), x[3] + noise(g_rng), x[6] + noise(g_rng)};
+            clusters.push_back(c);
+        }
+    }
+    for (int k = 0; k < n / 10; ++k) {
+        Cluster c;
+        c.cartesian = {2000.0 + uniform(0, 30.0 * side), 1000.0 + uniform(0, 30.0 * side),
+                       100.0 + uniform(-20, 20)};
+        clusters.push_back(c);
+    }
+    std::shuffle(clusters.begin(), clusters.end(), g_rng);
+}
+
+static double totalCost(const AssociationOutput& out, double missCost) {
+    double total = missCost * out.unmatchedTracks.size();
+    for (const auto& m : out.matched) total += m.distance;
+    return total;
+}
+
+static void testAgainstGreedy() {
+    std::cout << "\n[Test 3] GNNAssociator JV vs greedy\n";
+
+    GNNConfig jvCfg, greedyCfg;
+    jvCfg.costThreshold = greedyCfg.costThreshold = 22.0;
+    jvCfg.solver     = GNNSolver::JonkerVolgenant;
+    greedyCfg.solver = GNNSolver::Greedy;
+    GNNAssociator jv(jvCfg, 16.0), greedy(greedyCfg, 16.0);
+
+    bool neverWorse = true;
+    for (int n : {50, 200, 1000}) {
+        const int reps = n >= 1000 ? 5 : 20;
+        double jvCost = 0, greedyCost = 0, jvUs = 0, greedyUs = 0;
+        for (int r = 0; r < reps; ++r) {
+            std::vector<InnovationStats> tracks;
+            std::vector<Cluster> clusters;
+            makeScene(n, tracks, clusters);
+
+            auto t0 = std::chrono::steady_clock::now();
+            AssociationOutput a = jv.associate(tracks, clusters);
+            auto t1 = std::chrono::steady_clock::now();
+            AssociationOutput b = greedy.associate(tracks, clusters);
+            auto t2 = std::chrono::steady_clock::now();
+
+            double cj = totalCost(a, jvCfg.costThreshold);
+            double cg = totalCost(b, greedyCfg.costThreshold);
+            neverWorse = neverWorse && cj <= cg + 1e-9;
+            jvCost += cj;
+            greedyCost += cg;
+            jvUs     += std::chrono::duration<double, std::micro>(t1 - t0).count();
+            greedyUs += std::chrono::duration<double, std::micro>(t2 - t1).count();
+        }
+        std::cout << "  n=" << std::setw(4) << n << std::fixed << std::setprecision(1)
+                  << "  JV " << std::setw(9) << jvUs / reps << " us, cost " << jvCost / reps
+                  << "  |  greedy " << std::setw(9) << greedyUs / reps << " us, cost "
+                  << greedyCost / reps << "\n";
+    }
+    CHECK(neverWorse, "JV total cost never exceeds greedy");
+}
+
+// ---------------------------------------------------------------------------
+// Test 4: spatial pre-gate
+// ---------------------------------------------------------------------------
+// Tracks with correlated, differently sized innovation covariances scattered
+// over a 20 km x 20 km x 2 km volume, clusters uniform over the same volume.
+static void makeSparseScene(int nTracks, int nClusters, std::vector<InnovationStats>& tracks,
+                            std::vector<Cluster>& clusters) {
+    tracks.clear();
+    clusters.clear();
+    for (int t = 0; t < nTracks; ++t) {
+        StateVector x{};
+        x[0] = uniform(0, 20000);
+        x[3] = uniform(0, 20000);
+        x[6] = uniform(0, 2000);
+
+        // S = A A^T + s^2 I with a random A: positive definite, off-diagonal.
+        MeasMatrix A{}, S{};
+        double scale = uniform(5, 60);
+        for (int i = 0; i < MEAS_DIM; ++i)
+            for (int j = 0; j < MEAS_DIM; ++j) A[i][j] = scale * uniform(-1, 1);
+        for (int i = 0; i < MEAS_DIM; ++i)
+            for (int j = 0; j < MEAS_DIM; ++j) {
+                for (int k = 0; k < MEAS_DIM; ++k) S[i][j] += A[i][k] * A[j][k];
+                if (i == j) S[i][j] += scale * scale;
+            }
+        InnovationStats inn;
+        inn.valid = true;
+        inn.zPred = {x[0], x[3], x[6]};
+        for (int m = 0; m < MEAS_DIM; ++m) inn.sDiag[m] = S[m][m];
+        mat::invertSPD3(S, inn.Sinv, inn.logDetS);
+        tracks.push_back(inn);
+    }
+    for (int c = 0; c < nClusters; ++c) {
+        Cluster cl;
+        cl.cartesian = {uniform(0, 20000), uniform(0, 20000), uniform(0, 2000)};
+        clusters.push_back(cl);
+    }
+    // Put a few clusters on the gate boundary region of the first tracks.
+    for (int t = 0; t < std::min(nTracks, 50); ++t) {
+        const InnovationStats& inn = tracks[t];
+        Cluster cl;
+        cl.cartesian = {inn.zPred[0] + 0.99 * std::sqrt(16.0 * inn.sDiag[0]), inn.zPred[1],
+                        inn.zPred[2]};
+        clusters.push_back(cl);
+    }
+}
+
+static void gatedAllPairs(const InnovationStats& inn, const std::vector<Cluster>& clusters,
+                          double gate, std::vector<int>& out) {
+    out.clear();
+    for (size_t c = 0; c < clusters.size(); ++c) {
+        MeasVector z = {clusters[c].cartesian.x, clusters[c].cartesian.y,
+                        clusters[c].cartesian.z};
+        if (mat::mahalanobisDistance(mat::measSub(z, inn.zPred), inn.Sinv) <= gate)
+            out.push_back(static_cast<int>(c));
+    }
+}
+
+static void gatedIndexed(const InnovationStats& inn, const std::vector<Cluster>& clusters,
+                         const ClusterIndex& index, double gate,
+                         std::vector<int>& near, std::vector<int>& out) {
+    out.clear();
+    index.candidates(inn, near);
+    for (int c : near) {
+        MeasVector z = {clusters[c].cartesian.x, clusters[c].cartesian.y,
+                        clusters[c].cartesian.z};
+        if (mat::mahalanobisDistance(mat::measSub(z, inn.zPred), inn.Sinv) <= gate)
+            out.push_back(c);
+    }
+}
+
+static void testClusterIndex() {
+    std::cout << "\n[Test 4] ClusterIndex pre-gate\n";
+
+    const double gate = 16.0;
+    ClusterIndex index;
+    std::vector<int> ref, got, near;
+
+    bool same = true;
+    size_t gatedPairs = 0;
+    for (int rep = 0; rep < 20; ++rep) {
+        std::vector<InnovationStats> tracks;
+        std::vector<Cluster> clusters;
+        makeSparseScene(100, 800, tracks, clusters);
+        index.build(tracks, clusters, gate);
+        for (const auto& t : tracks) {
+            gatedAllPairs(t, clusters, gate, ref);
+            gatedIndexed(t, clusters, index, gate, near, got);
+            same = same && got == ref;
+            gatedPairs += ref.size();
+        }
+    }
+    CHECK(same && gatedPairs > 0, "indexed gating equals all-pairs gating on 20 random dwells");
+
+    // Below MIN_INDEXED_CLUSTERS every cluster is a candidate.
+    {
+        std::vector<InnovationStats> tracks;
+        std::vector<Cluster> clusters;
+        makeSparseScene(5, 10, tracks, clusters);
+        index.build(tracks, clusters, gate);
+        index.candidates(tracks[0], near);
+        CHECK(near.size() == clusters.size(), "small dwells fall back to all clusters");
+    }
+
+    std::vector<InnovationStats> tracks;
+    std::vector<Cluster> clusters;
+    makeSparseScene(300, 2000, tracks, clusters);
+    const int reps = 20;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r)
+        for (const auto& t : tracks) gatedAllPairs(t, clusters, gate, ref);
+    auto t1 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r) {
+        index.build(tracks, clusters, gate);
+        for (const auto& t : tracks) gatedIndexed(t, clusters, index, gate, near, got);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << "  300 tracks x 2000 clusters" << std::fixed << std::setprecision(1)
+              << "  all-pairs " << std::chrono::duration<double, std::micro>(t1 - t0).count() / reps
+              << " us  |  indexed "
+              << std::chrono::duration<double, std::micro>(t2 - t1).count() / reps << " us\n";
+}
+
+// ---------------------------------------------------------------------------
+// Test 5: component decomposition
+// ---------------------------------------------------------------------------
+static void canonical(AssociationOutput& out) {
+    std::sort(out.matched.begin(), out.matched.end(),
+              [](const AssociationResult& a, const AssociationResult& b) {
+                  return a.trackIndex < b.trackIndex;
+              });
+    std::sort(out.unmatchedTracks.begin(), out.unmatchedTracks.end());
+    std::sort(out.unmatchedClusters.begin(), out.unmatchedClusters.end());
+}
+
+static bool sameOutput(AssociationOutput a, AssociationOutput b) {
+    canonical(a);
+    canonical(b);
+    if (a.matched.size() != b.matched.size()) return false;
+    for (size_t i = 0; i < a.matched.size(); ++i)
+        if (a.matched[i].trackIndex != b.matched[i].trackIndex ||
+            a.matched[i].clusterIndex != b.matched[i].clusterIndex ||
+            std::abs(a.matched[i].distance - b.matched[i].distance) > 1e-12)
+            return false;
+    return a.unmatchedTracks == b.unmatchedTracks &&
+           a.unmatchedClusters == b.unmatchedClusters;
+}
+
+static void testDecomposition() {
+    std::cout << "\n[Test 5] AssociationEngine component decomposition\n";
+
+    WorkerPool pool(4);
+    struct Method { AssociationMethod method; const char* name; GNNSolver solver; };
+    const Method methods[] = {
+        {AssociationMethod::Mahalanobis, "Mahalanobis", GNNSolver::JonkerVolgenant},
+        {AssociationMethod::GNN,         "GNN jv",      GNNSolver::JonkerVolgenant},
+        {AssociationMethod::GNN,         "GNN greedy",  GNNSolver::Greedy},
+        {AssociationMethod::JPDA,        "JPDA",        GNNSolver::JonkerVolgenant},
+    };
+
+    for (const auto& m : methods) {
+        AssociationConfig cfg;
+        cfg.method          = m.method;
+        cfg.gatingThreshold = 16.0;
+        cfg.mahalanobis.distanceThreshold = 12.0;
+        cfg.gnn.costThreshold = 14.0;
+        cfg.gnn.solver      = m.solver;
+        cfg.jpda.gateSize   = 16.0;
+        cfg.jpda.clutterDensity = 1e-9;
+        AssociationConfig wholeCfg = cfg;
+        wholeCfg.decompose = false;
+        AssociationEngine split(cfg), whole(wholeCfg);
+
+        bool same = true;
+        double splitUs = 0, wholeUs = 0;
+        for (int rep = 0; rep < 10; ++rep) {
+            std::vector<InnovationStats> tracks;
+            std::vector<Cluster> clusters;
+            if (rep % 2) makeScene(400, tracks, clusters);
+            else         makeSparseScene(300, 2000, tracks, clusters);
+
+            auto t0 = std::chrono::steady_clock::now();
+            AssociationOutput a = whole.process(tracks, clusters);
+            auto t1 = std::chrono::steady_clock::now();
+            AssociationOutput b = split.process(tracks, clusters, &pool);
+            auto t2 = std::chrono::steady_clock::now();
+            same = same && sameOutput(a, b);
+            wholeUs += std::chrono::duration<double, std::micro>(t1 - t0).count();
+            splitUs += std::chrono::duration<double, std::micro>(t2 - t1).count();
+        }
+        std::cout << "  " << std::left << std::setw(12) << m.name << std::right
+                  << std::fixed << std::setprecision(1)
+                  << " whole " << std::setw(8) << wholeUs / 10 << " us  |  decomposed "
+                  << std::setw(8) << splitUs / 10 << " us\n";
+        CHECK(same, std::string(m.name) + ": decomposed output equals whole-dwell output");
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Test 6: exact JPDA
+// ---------------------------------------------------------------------------
+// n tracks in a 40 m line with 30 m sigma, n clusters among them: every
+// track gates most clusters.
+static void makeCrossing(int n, std::vector<InnovationStats>& tracks, std::vector<Cluster>& clusters) {
+    tracks.clear();
+    clusters.clear();
+    for (int t = 0; t < n; ++t) {
+        StateVector x{};
+        x[0] = 5000.0 + 40.0 * t / n;
+        x[3] = 1000.0;
+        x[6] = 100.0;
+        InnovationStats inn;
+        inn.valid = true;
+        inn.zPred = {x[0], x[3], x[6]};
+        for (int m = 0; m < MEAS_DIM; ++m) {
+            inn.Sinv[m][m] = 1.0 / 900.0;
+            inn.sDiag[m]   = 900.0;
+        }
+        inn.logDetS = 3.0 * std::log(900.0);
+        tracks.push_back(inn);
+
+        Cluster c;
+        c.cartesian = {x[0] + uniform(-30, 30), x[3] + uniform(-30, 30), x[6] + uniform(-30, 30)};
+        clusters.push_back(c);
+    }
+}
+
+static void testExactJPDA() {
+    std::cout << "\n[Test 6] Exact JPDA\n";
+
+    JPDAConfig cfg;
+    cfg.gateSize = 16.0;
+    cfg.clutterDensity = 1e-8;
+    cfg.detectionProbability = 0.9;
+    JPDAAssociator jpda(cfg, 16.0);
+
+    // Brute force: every assignment of {miss, cluster} per track.
+    bool exact = true;
+    for (int rep = 0; rep < 20; ++rep) {
+        std::vector<InnovationStats> tracks;
+        std::vector<Cluster> clusters;
+        makeCrossing(4, tracks, clusters);
+
+        const int n = static_cast<int>(tracks.size()), m = static_cast<int>(clusters.size());
+        std::vector<std::vector<double>> g(n, std::vector<double>(m + 1, 0.0));
+        for (int t = 0; t < n; ++t) {
+            const InnovationStats& inn = tracks[t];
+            g[t][m] = (1.0 - cfg.detectionProbability) * cfg.clutterDensity;
+            for (int c = 0; c < m; ++c) {
+                MeasVector z = {clusters[c].cartesian.x, clusters[c].cartesian.y,
+                                clusters[c].cartesian.z};
+                double d = mat::mahalanobisDistance(mat::measSub(z, inn.zPred), inn.Sinv);
+                if (d <= cfg.gateSize)
+                    g[t][c] = cfg.detectionProbability *
+                              std::exp(-0.5 * (d + inn.logDetS + MEAS_DIM * std::log(2.0 * 3.14159265)));
+            }
+        }
+        std::vector<std::vector<double>> beta(n, std::vector<double>(m + 1, 0.0));
+        double total = 0.0;
+        std::vector<int> a(n, 0);
+        std::function<void(int, double)> walk = [&](int t, double p) {
+            if (t == n) {
+                total += p;
+                for (int k = 0; k < n; ++k) beta[k][a[k]] += p;
+                return;
+            }
+            for (int c = 0; c <= m; ++c) {
+                if (g[t][c] == 0.0) continue;
+                bool taken = false;
+                for (int k = 0; k < t && c < m; ++k) taken = taken || a[k] == c;
+                if (taken) continue;
+                a[t] = c;
+                walk(t + 1, p * g[t][c]);
+            }
+        };
+        walk(0, 1.0);
+
+        auto w = jpda.computeWeights(tracks, clusters);
+        for (int t = 0; t < n; ++t) {
+            exact = exact && std::abs(w[t].betaZero - beta[t][m] / total) < 1e-9;
+            for (const auto& [c, b] : w[t].clusterWeights)
+                exact = exact && std::abs(b - beta[t][c] / total) < 1e-9;
+        }
+    }
+    CHECK(exact, "betas equal brute-force joint-event marginals on 20 crossing scenes");
+
+    // Budget of one event: every shared component falls back per track.
+    JPDAConfig tight = cfg;
+    tight.maxHypotheses = 1;
+    JPDAAssociator approx(tight, 16.0);
+    std::vector<InnovationStats> tracks;
+    std::vector<Cluster> clusters;
+    makeCrossing(4, tracks, clusters);
+    auto w = approx.computeWeights(tracks, clusters);
+    bool perTrack = true;
+    for (const auto& tw : w) {
+        double sum = tw.betaZero;
+        for (const auto& cw : tw.clusterWeights) sum += cw.second;
+        // Alone, a track's betas sum to one; no joint mass is shared.
+        perTrack = perTrack && std::abs(sum - 1.0) < 1e-9 && tw.clusterWeights.size() > 1;
+    }
+    CHECK(perTrack, "over budget, per-track weights are used");
+
+    for (int n : {6, 8}) {
+        makeCrossing(n, tracks, clusters);
+        JPDAConfig big = cfg;
+        big.maxHypotheses = 1e9;
+        JPDAAssociator full(big, 16.0);
+        auto t0 = std::chrono::steady_clock::now();
+        full.computeWeights(tracks, clusters);
+        auto t1 = std::chrono::steady_clock::now();
+        std::cout << "  " << n << " x " << n << " component: "
+                  << std::chrono::duration<double, std::micro>(t1 - t0).count() << " us\n";
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Test 7: Murty k-best
+// ---------------------------------------------------------------------------
+// Costs of every feasible assignment, ascending.
+static std::vector<double> allCosts(const SparseCostMatrix& C, double missCost) {
+    std::vector<double> costs;
+    std::vector<char> used(C.numCols, 0);
+    std::function<void(int, double)> walk = [&](int r, double acc) {
+        if (r == C.numRows()) { costs.push_back(acc); return; }
+        walk(r + 1, acc + missCost);
+        for (int e = C.rowStart[r]; e < C.rowStart[r + 1]; ++e) {
+            int c = C.col[e];
+            if (used[c]) continue;
+            used[c] = 1;
+            walk(r + 1, acc + C.cost[e]);
+            used[c] = 0;
+        }
+    };
+    walk(0, 0.0);
+    std::sort(costs.begin(), costs.end());
+    return costs;
+}
+
+static void testMurty() {
+    std::cout << "\n[Test 7] Murty k-best assignment\n";
+
+    KBestAssignmentSolver murty;
+    SparseCostMatrix C;
+    std::vector<RankedAssignment> ranked;
+    bool consistent = true, exact = true, counted = true;
+    for (int t = 0; t < 300; ++t) {
+        int rows = static_cast<int>(uniform(0, 6));
+        int cols = static_cast<int>(uniform(1, 6));
+        double missCost = uniform(5, 20);
+        int k = static_cast<int>(uniform(1, 12));
+        C.reset(cols);
+        for (int r = 0; r < rows; ++r) {
+            for (int c = 0; c < cols; ++c)
+                if (uniform(0, 1) < 0.5) C.add(c, uniform(0, missCost));
+            C.endRow();
+        }
+        murty.solve(C, missCost, k, ranked);
+        std::vector<double> all = allCosts(C, missCost);
+        counted = counted && ranked.size() == std::min<size_t>(k, all.size());
+        for (size_t i = 0; i < ranked.size() && i < all.size(); ++i) {
+            consistent = consistent &&
+                std::abs(objective(C, missCost, ranked[i].rowToCol) - ranked[i].cost) < 1e-9;
+            exact = exact && std::abs(ranked[i].cost - all[i]) < 1e-9;
+        }
+    }
+    CHECK(counted, "returns min(k, feasible assignments) solutions");
+    CHECK(consistent, "each solution is feasible and its cost matches its assignment");
+    CHECK(exact, "costs equal the k cheapest enumerated assignments on 300 problems");
+}
+
+// ---------------------------------------------------------------------------
+// Test 8: MHT associator
+// ---------------------------------------------------------------------------
+static void testMHT() {
+    std::cout << "\n[Test 8] MHTAssociator\n";
+
+    MHTConfig cfg;
+    cfg.missCost = 16.0;
+    GNNConfig gnnCfg;
+    gnnCfg.costThreshold = cfg.missCost;
+    GNNAssociator gnn(gnnCfg, 16.0);
+
+    MeasMatrix R{};
+    for (int m = 0; m < MEAS_DIM; ++m) R[m][m] = 100.0;
+
+    std::vector<InnovationStats> tracks;
+    std::vector<Cluster> clusters;
+    bool fresh = true;
+    for (int trial = 0; trial < 20; ++trial) {
+        makeCrossing(static_cast<int>(uniform(2, 12)), tracks, clusters);
+        MHTAssociator mht(cfg, 16.0);
+        std::vector<uint32_t> ids(tracks.size());
+        for (size_t i = 0; i < ids.size(); ++i) ids[i] = static_cast<uint32_t>(i + 1);
+        mht.setDwellContext(ids, std::vector<MeasMatrix>(ids.size(), R));
+        fresh = fresh && sameOutput(mht.associate(tracks, clusters), gnn.associate(tracks, clusters));
+    }
+    CHECK(fresh, "first dwell equals GNN-JV with costThreshold = missCost");
+
+    // Crossing dwells under one set of ids.
+    MHTConfig single = cfg;
+    single.maxHypotheses = 1;
+    MHTAssociator one(single, 16.0);
+    MHTAssociator mht(cfg, 16.0);
+    std::vector<uint32_t> ids(8);
+    for (size_t i = 0; i < ids.size(); ++i) ids[i] = static_cast<uint32_t>(100 + 3 * i);
+    const std::vector<MeasMatrix> noise(ids.size(), R);
+    one.setDwellContext(ids, noise);
+    mht.setDwellContext(ids, noise);
+    bool collapsed = true, bounded = true;
+    size_t maxLeaves = 0;
+    for (int dwell = 0; dwell < 40; ++dwell) {
+        makeCrossing(8, tracks, clusters);
+        collapsed = collapsed && sameOutput(one.associate(tracks, clusters),
+                                            gnn.associate(tracks, clusters));
+        mht.associate(tracks, clusters);
+        bounded = bounded && mht.numLeaves() >= 1 &&
+                  mht.numLeaves() <= static_cast<size_t>(cfg.maxHypotheses) &&
+                  mht.liveNodes() <= static_cast<size_t>(cfg.nodeBudget);
+        maxLeaves = std::max(maxLeaves, mht.numLeaves());
+    }
+    CHECK(collapsed, "maxHypotheses = 1 equals GNN-JV on every dwell");
+    CHECK(bounded, "leaves and live nodes stay within maxHypotheses and nodeBudget");
+    CHECK(maxLeaves > 1, "ambiguous crossing dwells keep alternative hypotheses");
+    std::cout << "  peak leaves " << maxLeaves << ", live nodes " << mht.liveNodes() << "\n";
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  Counter-UAS Association Tests\n";
+    std::cout << "====================================================\n";
+
+    testOptimality();
+    testDegenerate();
+    testAgainstGreedy();
+    testClusterIndex();
+    testDecomposition();
+    testExactJPDA();
+    testMurty();
+    testMHT();
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  Results: " << g_pass << " passed, "
+              << g_fail << " failed\n";
+    std::cout << "====================================================\n";
+
+    return g_fail == 0 ? 0 : 1;
+}
@@ -0,0 +1,374 @@
+/*
+ * test_imm_batch.cpp
+ *
+ * Checks the batched IMM predict (IMMBatch) against the per-track
+ * IMMFilter::predict() it replaces.  Tracks of straight, accelerating,
+ * turning and manoeuvring targets are filtered side by side: the batch
+ * copy is predicted with IMMBatch::predict() and updated through
+ * load() / IMMFilter::update() / store(), the reference copy with
+ * IMMFilter::predict() / update() on its own IMMState.  The track count
+ * leaves the last Block part-filled, some dwells miss some tracks, and
+ * tracks are released and the survivors relocate()d down part-way.
+ *
+ * Tests
+ *   1. Double precision: every model state, covariance and mode probability
+ *      and the merged estimate match the per-track path bit for bit after
+ *      every predict and every update
+ *   2. Float precision (IMMBatchOf<float>): merged positions and velocities
+ *      stay within tolerance of the double per-track path
+ *   3. Model pruning (pruneFloor > 0): models freeze below the floor and
+ *      keep their stored state while frozen, are reactivated both by their
+ *      Markov prior (reactivatePrior) and by a failed innovation gate
+ *      (reactivateGate, re-seeded at the merged estimate), and the batch
+ *      stays bit-identical to the per-track path while Blocks are partly
+ *      frozen
+ *
+ * Usage: test_imm_batch <source dir>
+ */
+
+#include "prediction/imm_batch.h"
+#include "prediction/imm_filter.h"
+#include "common/config.h"
+#include "common/logger.h"
+#include "common/worker_pool.h"
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace cuas;
+
+// ---------------------------------------------------------------------------
+// Lightweight test framework
+// ---------------------------------------------------------------------------
+static int g_pass = 0;
+static int g_fail = 0;
+
+#define CHECK(expr, label)                                              \
+    do {                                                                \
+        if (expr) {                                                     \
+            std::cout << "  PASS  " << (label) << "\n";                \
+            ++g_pass;                                                   \
+        } else {                                                        \
+            std::cout << "  FAIL  " << (label) << "\n";                \
+            ++g_fail;                                                   \
+        }                                                               \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+static constexpr int    DWELLS       = 150;
+static constexpr int    NUM_TRACKS   = 29;    // 3 full double Blocks + 5 lanes
+static constexpr int    RELEASE_AT   = 60;    // dwell at which every 4th track is released
+static constexpr int    MANOEUVRE    = 70;    // dwell at which straight targets turn hard
+static constexpr double MEAS_SIGMA   = 5.0;   // m, per axis
+static constexpr int    DOUBLE_LANES = 8;     // tracks per double Block (64 bytes)
+
+// Truth: positions at indices 0, 3, 6 and velocities at 1, 4, 7 (axis
+// blocks of [pos, vel, acc]).  Targets turn in the horizontal plane.
+struct Target {
+    double x, y, z, vx, vy, vz;
+    double turnRate;       // rad/s
+    double accel;          // m/s^2 along the velocity
+    double manoeuvreRate;  // turn rate from dwell MANOEUVRE on
+};
+
+static std::vector<Target> makeTargets() {
+    std::mt19937 rng(1301);
+    std::uniform_real_distribution<double> pos(-4000.0, 4000.0), heading(0.0, 6.283185307179586);
+    std::vector<Target> targets;
+    for (int i = 0; i < NUM_TRACKS; ++i) {
+        Target t{};
+        const double h = heading(rng), speed = 15.0 + i;
+        t.x = pos(rng); t.y = pos(rng); t.z = 100.0 + 10.0 * i;
+        t.vx = speed * std::cos(h); t.vy = speed * std::sin(h); t.vz = (i % 3 - 1) * 0.5;
+        switch (i % 4) {
+        case 0:  break;                                      // straight
+        case 1:  t.accel = 2.0; break;                       // accelerating
+        case 2:  t.turnRate = 0.05 + 0.02 * (i % 5); break;  // turning
+        default: t.manoeuvreRate = 0.6; break;               // straight, then a hard turn
+        }
+        targets.push_back(t);
+    }
+    return targets;
+}
+
+static void advance(Target& t, int dwell, double dt) {
+    const double w = dwell >= MANOEUVRE && t.manoeuvreRate != 0.0 ? t.manoeuvreRate : t.turnRate;
+    const double c = std::cos(w * dt), s = std::sin(w * dt);
+    const double vx = c * t.vx - s * t.vy, vy = s * t.vx + c * t.vy;
+    const double speed = std::hypot(vx, vy), gain = (speed + t.accel * dt) / speed;
+    t.vx = vx * gain; t.vy = vy * gain;
+    t.x += t.vx * dt; t.y += t.vy * dt; t.z += t.vz * dt;
+}
+
+static IMMState initialState(const Target& t, const PredictionConfig& cfg) {
+    StateVector x0 = stateZero();
+    x0[0] = t.x; x0[1] = t.vx; x0[3] = t.y; x0[4] = t.vy; x0[6] = t.z; x0[7] = t.vz;
+    SymStateMatrix P0;
+    for (int a = 0; a < NUM_AXES; ++a) {
+        P0(3 * a, 3 * a)         = MEAS_SIGMA * MEAS_SIGMA;
+        P0(3 * a + 1, 3 * a + 1) = 100.0;
+        P0(3 * a + 2, 3 * a + 2) = 25.0;
+    }
+    IMMState s;
+    s.modelStates.fill(x0);
+    s.modelCovariances.fill(P0);
+    s.modeProbabilities = cfg.imm.initialModeProbabilities;
+    s.mergedState      = x0;
+    s.mergedCovariance = P0;
+    return s;
+}
+
+static bool sameState(const IMMState& a, const IMMState& b) {
+    return a.modelStates == b.modelStates && a.modelCovariances == b.modelCovariances &&
+           a.modeProbabilities == b.modeProbabilities && a.mergedState == b.mergedState &&
+           a.mergedCovariance == b.mergedCovariance;
+}
+
+// One filtered track: its slot in the batch and its per-track reference.
+struct Lane {
+    int      target = 0;
+    uint32_t slot   = 0;
+    IMMState ref;
+};
+
+// What a run observed, for the checks.  `diverged` counts track-steps whose
+// batch state differs from the reference (double) or whose merged estimate
+// is off by more than the tolerance (float).
+struct RunStats {
+    int    compared = 0, diverged = 0;
+    double maxPosErr = 0.0, maxVelErr = 0.0;
+    int    freezes = 0, frozenKept = 0, frozenMoved = 0;
+    int    priorReactivations = 0, gateReactivations = 0, gateReseeded = 0;
+    int    partlyFrozenBlocks = 0;
+};
+
+// Runs the tracks through the batch and the per-track filter, one dwell
+// every `dt` seconds.  Float runs compare merged estimates against `posTol`
+// / `velTol`; double runs compare everything exactly.
+static RunStats run(const PredictionConfig& cfg, double dt, double posTol = 0.0, double velTol = 0.0) {
+    IMMFilter filter(cfg);
+    auto       batch = IMMBatch::create(filter);
+    WorkerPool workers(2);
+    const bool exact   = batch->precision() == IMMPrecision::Double;
+    const bool pruning = cfg.imm.pruneFloor > 0.0;
+
+    std::vector<Target> targets = makeTargets();
+    std::vector<Lane>   lanes;
+    for (int i = 0; i < NUM_TRACKS; ++i) {
+        Lane ln;
+        ln.target = i;
+        ln.ref    = initialState(targets[i], cfg);
+        ln.slot   = batch->allocate(ln.ref.mergedState, ln.ref.mergedCovariance,
+                                    ln.ref.modeProbabilities);
+        lanes.push_back(ln);
+    }
+
+    std::mt19937 rng(77);
+    std::normal_distribution<double>       noise(0.0, MEAS_SIGMA);
+    std::uniform_real_distribution<double> uni(0.0, 1.0);
+    MeasMatrix R{};
+    for (int k = 0; k < MEAS_DIM; ++k) R[k][k] = MEAS_SIGMA * MEAS_SIGMA;
+
+    RunStats st;
+    auto compare = [&](const Lane& ln) {
+        IMMState b;
+        batch->load(ln.slot, b);
+        ++st.compared;
+        if (exact) {
+            if (!sameState(b, ln.ref)) ++st.diverged;
+            return;
+        }
+        double pos = 0.0, vel = 0.0;
+        for (int a = 0; a < NUM_AXES; ++a) {
+            pos = std::max(pos, std::fabs(b.mergedState[3 * a] - ln.ref.mergedState[3 * a]));
+            vel = std::max(vel, std::fabs(b.mergedState[3 * a + 1] - ln.ref.mergedState[3 * a + 1]));
+        }
+        st.maxPosErr = std::max(st.maxPosErr, pos);
+        st.maxVelErr = std::max(st.maxVelErr, vel);
+        if (pos > posTol || vel > velTol) ++st.diverged;
+    };
+
+    for (int n = 0; n < DWELLS; ++n) {
+        if (n == RELEASE_AT) {
+            std::vector<Lane> kept;
+            for (size_t i = 0; i < lanes.size(); ++i) {
+                if (i % 4 == 1) batch->release(lanes[i].slot);
+                else            kept.push_back(lanes[i]);
+            }
+            lanes = kept;
+            for (Lane& ln : lanes) ln.slot = batch->relocate(ln.slot);
+        }
+        for (Target& t : targets) advance(t, n, dt);
+
+        // Predict: the batch for every slot, the reference track by track.
+        std::vector<IMMState> before(lanes.size());
+        if (pruning) {
+            for (size_t i = 0; i < lanes.size(); ++i) batch->load(lanes[i].slot, before[i]);
+            std::vector<uint32_t> frozenLanes(IMM_NUM_MODELS * (NUM_TRACKS / DOUBLE_LANES + 1), 0),
+                                  liveLanes(NUM_TRACKS / DOUBLE_LANES + 1, 0);
+            for (size_t i = 0; i < lanes.size(); ++i) {
+                const uint32_t blk = lanes[i].slot / DOUBLE_LANES, bit = 1u << (lanes[i].slot % DOUBLE_LANES);
+                const uint32_t active = filter.activeModels(lanes[i].ref.modeProbabilities);
+                liveLanes[blk] |= bit;
+                for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+                    if (!(active & (1u << m))) frozenLanes[blk * IMM_NUM_MODELS + m] |= bit;
+                    else if (lanes[i].ref.modeProbabilities[m] == 0.0) ++st.priorReactivations;
+                }
+            }
+            for (size_t b = 0; b < liveLanes.size(); ++b)
+                for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+                    const uint32_t f = frozenLanes[b * IMM_NUM_MODELS + m];
+                    if (f && f != liveLanes[b]) { ++st.partlyFrozenBlocks; break; }
+                }
+        }
+        filter.prepare(dt);
+        batch->predict(dt, workers);
+        for (Lane& ln : lanes) filter.predict(dt, ln.ref);
+        for (size_t i = 0; i < lanes.size(); ++i) {
+            compare(lanes[i]);
+            if (!pruning) continue;
+            IMMState after;
+            batch->load(lanes[i].slot, after);
+            const uint32_t active = filter.activeModels(before[i].modeProbabilities);
+            for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+                if (active & (1u << m)) continue;
+                const bool kept = after.modelStates[m] == before[i].modelStates[m] &&
+                                  after.modelCovariances[m] == before[i].modelCovariances[m];
+                ++(kept ? st.frozenKept : st.frozenMoved);
+            }
+        }
+
+        // Update: about one track in ten misses each dwell.
+        for (Lane& ln : lanes) {
+            if (uni(rng) < 0.1) continue;
+            const Target& t = targets[ln.target];
+            const MeasVector z = {t.x + noise(rng), t.y + noise(rng), t.z + noise(rng)};
+
+            const std::array<double, IMM_NUM_MODELS> mu = ln.ref.modeProbabilities;
+            const uint32_t active = filter.activeModels(mu);
+            IMMState b;
+            batch->load(ln.slot, b);
+            filter.update(b, z, R);
+            batch->store(ln.slot, b);
+            filter.update(ln.ref, z, R);
+            compare(ln);
+
+            if (!pruning) continue;
+            const auto& muNew = ln.ref.modeProbabilities;
+            for (int m = 0; m < IMM_NUM_MODELS; ++m) {
+                if (mu[m] > 0.0 && muNew[m] == 0.0) ++st.freezes;
+                if (!(active & (1u << m)) && muNew[m] > 0.0) {
+                    ++st.gateReactivations;
+                    if (ln.ref.modelStates[m] == ln.ref.mergedState) ++st.gateReseeded;
+                }
+            }
+        }
+    }
+    return st;
+}
+
+// ---------------------------------------------------------------------------
+// 1. Double precision
+// ---------------------------------------------------------------------------
+static void testDouble(const PredictionConfig& base) {
+    std::cout << "\n--- IMMBatch (double) vs IMMFilter::predict ---\n";
+    PredictionConfig cfg = base;
+    cfg.imm.precision  = IMMPrecision::Double;
+    cfg.imm.pruneFloor = 0.0;
+    const RunStats st = run(cfg, 0.1);
+    std::cout << "  " << st.compared << " track states compared\n";
+    CHECK(st.compared > 0 && st.diverged == 0, "batch and per-track states bit-identical");
+}
+
+// ---------------------------------------------------------------------------
+// 2. Float precision
+// ---------------------------------------------------------------------------
+static void testFloat(const PredictionConfig& base) {
+    std::cout << "\n--- IMMBatch (float) vs IMMFilter::predict ---\n";
+    static constexpr double POS_TOL = 0.05;   // m
+    static constexpr double VEL_TOL = 0.05;   // m/s
+    PredictionConfig cfg = base;
+    cfg.imm.precision  = IMMPrecision::Float;
+    cfg.imm.pruneFloor = 0.0;
+    const RunStats st = run(cfg, 0.1, POS_TOL, VEL_TOL);
+    std::cout << "  " << st.compared << " track states compared, max error "
+              << st.maxPosErr << " m, " << st.maxVelErr << " m/s\n";
+    CHECK(IMMBatch::create(IMMFilter(cfg))->precision() == IMMPrecision::Float,
+          "precision = float creates the float store");
+    CHECK(st.compared > 0 && st.diverged == 0, "merged position within 5 cm, velocity within 5 cm/s");
+    CHECK(st.maxPosErr > 0.0, "float path differs from double (it is not the double store)");
+}
+
+// ---------------------------------------------------------------------------
+// 3. Model pruning
+// ---------------------------------------------------------------------------
+static void testPruning(const PredictionConfig& base) {
+    std::cout << "\n--- IMM model pruning ---\n";
+    PredictionConfig cfg = base;
+    cfg.imm.precision       = IMMPrecision::Double;
+    cfg.imm.pruneFloor      = 0.05;
+    cfg.imm.reactivatePrior = 0.05;
+    // At 1 Hz the models' predictions separate enough for mode
+    // probabilities to fall under the floor; at 10 Hz mixing keeps them up.
+    const RunStats st = run(cfg, 1.0);
+    std::cout << "  " << st.freezes << " freezes, " << st.priorReactivations << " prior / "
+              << st.gateReactivations << " gate reactivations, " << st.partlyFrozenBlocks
+              << " partly frozen Block-dwells\n";
+
+    CHECK(st.freezes > 0, "models freeze below the floor");
+    CHECK(st.frozenKept > 0 && st.frozenMoved == 0, "frozen models keep their state through predict");
+    CHECK(st.priorReactivations > 0, "frozen models reactivated by their Markov prior");
+    CHECK(st.gateReactivations > 0 && st.gateReseeded == st.gateReactivations,
+          "frozen models reactivated by the innovation gate, at the merged estimate");
+    CHECK(st.partlyFrozenBlocks > 0, "Blocks partly frozen");
+    CHECK(st.compared > 0 && st.diverged == 0, "batch and per-track states bit-identical");
+
+    // activeModels() directly: a frozen model is active again once its
+    // prior sum_i T_im mu_i reaches reactivatePrior.
+    IMMFilter filter(cfg);
+    const auto& T = filter.transitionMatrix();
+    std::array<double, IMM_NUM_MODELS> mu = {1.0, 0.0, 0.0, 0.0, 0.0};
+    uint32_t expected = 1;
+    for (int m = 1; m < IMM_NUM_MODELS; ++m)
+        if (T[0][m] >= cfg.imm.reactivatePrior) expected |= 1u << m;
+    CHECK(filter.activeModels(mu) == expected, "activeModels: zero-probability models below the prior frozen");
+    cfg.imm.pruneFloor = 0.0;
+    CHECK(IMMFilter(cfg).activeModels(mu) == (1u << IMM_NUM_MODELS) - 1,
+          "activeModels: every model active without pruning");
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <source dir>\n";
+        return 1;
+    }
+    const std::string root = argv[1];
+
+    std::cout << "====================================================\n";
+    std::cout << "  Counter-UAS IMM Batch Tests\n";
+    std::cout << "====================================================\n";
+
+    ConsoleLogger::instance().setLevel(ConsoleLogger::ERROR);
+    const PredictionConfig base = loadConfig(root + "/config/tracker_config.json").prediction;
+
+    testDouble(base);
+    testFloat(base);
+    testPruning(base);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  Results: " << g_pass << " passed, "
+              << g_fail << " failed\n";
+    std::cout << "====================================================\n";
+
+    return g_fail == 0 ? 0 : 1;
+}
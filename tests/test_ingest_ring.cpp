@@ -0,0 +1,270 @@
+/*
+ * test_ingest_ring.cpp
+ *
+ * Checks IngestRing, the lock-free ring between the ingest threads and a
+ * pipeline lane: ordering, every overload policy at capacity with the
+ * counts IngestStats reports, and concurrent producers.
+ *
+ * Tests
+ *   1. FIFO order across many wraparounds; capacity rounds up to a power
+ *      of two
+ *   2. DropNewest at capacity: the incoming items are refused and counted
+ *   3. DropOldest at capacity: the oldest items make room and are counted
+ *   4. CoalesceLatest: only the newest item waits
+ *   5. Block at capacity: push() waits for the consumer; close() releases
+ *      it, and wakes a consumer waiting on an empty ring
+ *   6. Multi-producer / single-consumer stress under Block and DropOldest:
+ *      nothing lost or duplicated, each producer's items in order, and the
+ *      stats add up
+ */
+
+#include "pipeline/ingest_ring.h"
+
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace cuas;
+
+// ---------------------------------------------------------------------------
+// Lightweight test framework
+// ---------------------------------------------------------------------------
+static int g_pass = 0;
+static int g_fail = 0;
+
+#define CHECK(expr, label)                                              \
+    do {                                                                \
+        if (expr) {                                                     \
+            std::cout << "  PASS  " << (label) << "\n";                \
+            ++g_pass;                                                   \
+        } else {                                                        \
+            std::cout << "  FAIL  " << (label) << "\n";                \
+            ++g_fail;                                                   \
+        }                                                               \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+using Ring = IngestRing<uint64_t>;
+static constexpr std::chrono::milliseconds NO_WAIT{0};
+
+static bool pushValue(Ring& ring, uint64_t v) { return ring.push(v); }
+
+// Pops everything queued, oldest first.
+static std::vector<uint64_t> drain(Ring& ring) {
+    std::vector<uint64_t> out;
+    uint64_t v = 0;
+    while (ring.waitPop(v, NO_WAIT)) out.push_back(v);
+    return out;
+}
+
+static std::vector<uint64_t> range(uint64_t first, uint64_t last) {
+    std::vector<uint64_t> v;
+    for (uint64_t i = first; i < last; ++i) v.push_back(i);
+    return v;
+}
+
+// ---------------------------------------------------------------------------
+// 1. FIFO and wraparound
+// ---------------------------------------------------------------------------
+static void testFifo() {
+    std::cout << "\n--- FIFO order and wraparound ---\n";
+    CHECK(Ring(5, OverloadPolicy::Block).stats().capacity == 8, "capacity 5 rounds up to 8");
+    CHECK(Ring(8, OverloadPolicy::Block).stats().capacity == 8, "capacity 8 stays 8");
+
+    Ring ring(4, OverloadPolicy::DropNewest);
+    bool ordered = true, accepted = true;
+    uint64_t next = 0, expect = 0;
+    for (int round = 0; round < 100; ++round) {
+        const int n = 1 + round % 4;     // 1..4 per round, so the head walks every slot
+        for (int i = 0; i < n; ++i) accepted &= pushValue(ring, next++);
+        ordered &= ring.size() == static_cast<size_t>(n);
+        for (uint64_t v : drain(ring)) ordered &= v == expect++;
+    }
+    CHECK(accepted && ordered && expect == next, "250 items through 4 slots in order");
+
+    const IngestStats s = ring.stats();
+    CHECK(s.pushed == next && s.dropped == 0 && s.coalesced == 0 && s.depth == 0,
+          "stats: all pushed, none dropped, empty");
+    CHECK(s.highWater == 4, "stats: high water 4");
+}
+
+// ---------------------------------------------------------------------------
+// 2-4. Drop policies
+// ---------------------------------------------------------------------------
+static void testDropNewest() {
+    std::cout << "\n--- DropNewest ---\n";
+    Ring ring(8, OverloadPolicy::DropNewest);
+    for (uint64_t v = 0; v < 8; ++v) pushValue(ring, v);
+    uint64_t item = 100;
+    const bool refused = !ring.push(item);
+    CHECK(refused && item == 100, "push at capacity refused, item untouched");
+    pushValue(ring, 101);
+    pushValue(ring, 102);
+
+    const IngestStats s = ring.stats();
+    CHECK(s.pushed == 8 && s.dropped == 3 && s.coalesced == 0, "stats: 8 pushed, 3 dropped");
+    CHECK(s.depth == 8 && s.highWater == 8, "stats: depth and high water 8");
+    CHECK(drain(ring) == range(0, 8), "the first 8 items queued");
+}
+
+static void testDropOldest() {
+    std::cout << "\n--- DropOldest ---\n";
+    Ring ring(8, OverloadPolicy::DropOldest);
+    bool accepted = true;
+    for (uint64_t v = 0; v < 11; ++v) accepted &= pushValue(ring, v);
+    CHECK(accepted, "every push accepted");
+
+    const IngestStats s = ring.stats();
+    CHECK(s.pushed == 11 && s.dropped == 3 && s.coalesced == 0, "stats: 11 pushed, 3 dropped");
+    CHECK(s.depth == 8 && s.highWater == 8, "stats: depth and high water 8");
+    CHECK(drain(ring) == range(3, 11), "the newest 8 items queued, oldest first");
+}
+
+static void testCoalesceLatest() {
+    std::cout << "\n--- CoalesceLatest ---\n";
+    Ring ring(8, OverloadPolicy::CoalesceLatest);
+    for (uint64_t v = 0; v < 5; ++v) pushValue(ring, v);
+
+    const IngestStats s = ring.stats();
+    CHECK(s.pushed == 5 && s.coalesced == 4 && s.dropped == 0, "stats: 5 pushed, 4 coalesced");
+    CHECK(s.depth == 1 && s.highWater == 1, "stats: depth and high water 1");
+    CHECK(drain(ring) == std::vector<uint64_t>{4}, "only the newest item queued");
+}
+
+// ---------------------------------------------------------------------------
+// 5. Block and close()
+// ---------------------------------------------------------------------------
+static void testBlock() {
+    std::cout << "\n--- Block ---\n";
+    Ring ring(4, OverloadPolicy::Block);
+    for (uint64_t v = 0; v < 4; ++v) pushValue(ring, v);
+
+    std::atomic<bool> done{false};
+    bool result = false;
+    std::thread producer([&] {
+        result = pushValue(ring, 4);
+        done = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK(!done.load(), "push at capacity waits");
+
+    uint64_t v = 0;
+    const bool popped = ring.waitPop(v, NO_WAIT);
+    producer.join();
+    CHECK(popped && v == 0 && result, "a pop lets the waiting push in");
+    CHECK(drain(ring) == range(1, 5), "queue holds 1..4 in order");
+
+    IngestStats s = ring.stats();
+    CHECK(s.pushed == 5 && s.dropped == 0 && s.highWater == 4, "stats: 5 pushed, none dropped, high water 4");
+
+    for (uint64_t k = 0; k < 4; ++k) pushValue(ring, k);
+    done = false;
+    std::thread blocked([&] {
+        result = pushValue(ring, 99);
+        done = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ring.close();
+    blocked.join();
+    CHECK(done.load() && !result, "close() releases a waiting push, which fails");
+    CHECK(ring.stats().pushed == 9, "stats: the released push is not counted");
+
+    Ring empty(4, OverloadPolicy::Block);
+    bool got = true;
+    const auto start = std::chrono::steady_clock::now();
+    std::thread consumer([&] { uint64_t x; got = empty.waitPop(x, std::chrono::seconds(10)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    empty.close();
+    consumer.join();
+    const double waited = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    CHECK(!got && waited < 5.0, "close() wakes a consumer waiting on an empty ring");
+
+    uint64_t x;
+    CHECK(!empty.waitPop(x, std::chrono::milliseconds(10)), "waitPop on an empty ring times out");
+}
+
+// ---------------------------------------------------------------------------
+// 6. Multi-producer / single-consumer stress
+// ---------------------------------------------------------------------------
+// Producer p pushes (p << 32 | i) for i in [0, PER_PRODUCER).
+static void stress(OverloadPolicy policy, const std::string& name) {
+    constexpr int      PRODUCERS    = 4;
+    constexpr uint64_t PER_PRODUCER = 200000;
+    Ring ring(64, policy);
+
+    std::atomic<int> running{PRODUCERS};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p] {
+            for (uint64_t i = 0; i < PER_PRODUCER; ++i) pushValue(ring, (uint64_t(p) << 32) | i);
+            --running;
+        });
+    }
+
+    std::vector<int64_t> last(PRODUCERS, -1);
+    uint64_t received = 0;
+    bool inOrder = true, valid = true;
+    uint64_t v = 0;
+    for (;;) {
+        if (!ring.waitPop(v, std::chrono::milliseconds(1))) {
+            if (running.load() == 0 && ring.empty()) break;
+            continue;
+        }
+        const uint64_t p = v >> 32;
+        const int64_t  i = static_cast<int64_t>(v & 0xffffffffu);
+        if (p >= PRODUCERS || i >= static_cast<int64_t>(PER_PRODUCER)) { valid = false; continue; }
+        inOrder &= i > last[p];
+        last[p] = i;
+        ++received;
+    }
+    for (auto& t : producers) t.join();
+    received += drain(ring).size();
+
+    const IngestStats s     = ring.stats();
+    const uint64_t    total = PRODUCERS * PER_PRODUCER;
+    std::cout << "  " << name << ": " << received << " of " << total << " received, "
+              << s.dropped << " dropped, high water " << s.highWater << "\n";
+    CHECK(valid && inOrder, name + ": each producer's items in order, none corrupt");
+    CHECK(s.pushed == received + s.dropped, name + ": received + dropped == pushed");
+    CHECK(s.highWater <= s.capacity && s.depth == 0, name + ": high water within capacity, drained");
+    if (policy == OverloadPolicy::Block)
+        CHECK(received == total && s.dropped == 0, name + ": nothing lost");
+    else
+        CHECK(s.pushed == total, name + ": every push accepted");
+}
+
+static void testStress() {
+    std::cout << "\n--- Multi-producer stress ---\n";
+    stress(OverloadPolicy::Block, "Block");
+    stress(OverloadPolicy::DropOldest, "DropOldest");
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  Counter-UAS Ingest Ring Tests\n";
+    std::cout << "====================================================\n";
+
+    testFifo();
+    testDropNewest();
+    testDropOldest();
+    testCoalesceLatest();
+    testBlock();
+    testStress();
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  Results: " << g_pass << " passed, "
+              << g_fail << " failed\n";
+    std::cout << "====================================================\n";
+
+    return g_fail == 0 ? 0 : 1;
+}
@@ -23,10 +23,24 @@
  *   4. Resync recovery after a bad-EOM record
  *   5. Zero-payload record (EOM directly after header)
  *   6. BinaryLogger write path (uses the actual logger API)
+ *   7. Concurrent producers on a small ring: every record written intact
+ *      and in per-thread order, every other one counted as dropped
+ *   8. v2 LZ4 block container: LogReader returns what a v1 log holds, the
+ *      block index seeks by dwell, and a damaged block is skipped alone
+ *   9. .idx sidecar: a dwell range read through it matches a full scan
+ *  10. Record-aligned chunks: split() and setByteRange() read a v1 and a
+ *      v2 log back in order, with the dwell known at each chunk's start
+ *  11. Arrow IPC export: file magic, 8-byte aligned message framing, a
+ *      record batch every batchRows rows, and the footer's trailer
+ *  12. Log segments: a size-split log reads back as the unsplit one, each
+ *      segment standalone; LogFile counts the bytes a full disk refuses
  */
 
 #include "common/types.h"
 #include "common/logger.h"
+#include "common/log_reader.h"
+#include "common/arrow_ipc.h"
+#include "common/log_file.h"
 
 #include <iostream>
 #include <fstream>
@@ -35,6 +49,8 @@
 #include <cstring>
 #include <filesystem>
 #include <cstdlib>
+#include <chrono>
+#include <thread>
 
 // ---------------------------------------------------------------------------
 // Lightweight test framework
@@ -381,6 +397,27 @@ static void testResyncRecovery(const std::string& path)
         std::memcpy(&tid, payload2.data(), 4);
         CHECK(tid == GOOD_TRACK_ID, "Resync: recovered record trackId == 42");
     }
+
+    // The mapped reader over the same file, with stray SOM-prefix bytes
+    // appended before one more good record.
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        const uint8_t junk[] = {0xBE, 0xBA, 0x00, 0xBE, 0xBE, 0xBA, 0xFE};
+        out.write(reinterpret_cast<const char*>(junk), sizeof(junk));
+        writeRecord(out, static_cast<uint32_t>(cuas::LogRecordType::TrackDeleted),
+                    GOOD_TS + 1, &GOOD_TRACK_ID, sizeof(GOOD_TRACK_ID));
+    }
+    cuas::LogReader reader;
+    CHECK(reader.open(path), "Resync: LogReader maps the file");
+    cuas::LogPayload view;
+    uint32_t good = 0;
+    while (reader.next(hdr2, view)) {
+        uint32_t tid = 0;
+        if (view.size() == 4u) std::memcpy(&tid, view.data(), 4);
+        if (tid == GOOD_TRACK_ID) ++good;
+    }
+    CHECK(good == 2 && reader.corrupted() == 2,
+          "Resync: LogReader skips the bad record and the junk, keeps both good records");
 }
 
 // ---------------------------------------------------------------------------
@@ -469,6 +506,451 @@ static void testBinaryLoggerAPI(const std::string& tmpDir)
     CHECK(eomOkCount  == 7, "All 7 records have a valid EOM sentinel");
 }
 
+// ---------------------------------------------------------------------------
+// Test 7 — concurrent producers, ring overflow accounting
+// ---------------------------------------------------------------------------
+static void testConcurrentProducers(const std::string& tmpDir)
+{
+    std::cout << "\n[Test 7] Concurrent producers on a 64 KB ring\n";
+
+    constexpr uint32_t THREADS = 4;
+    constexpr uint32_t PER_THREAD = 20000;
+
+    std::filesystem::create_directories(tmpDir);
+    cuas::BinaryLogger logger;
+    logger.setCombinedTextEnabled(false);
+    cuas::LogOptions opts;
+    opts.ringBytes = 64u << 10;
+    bool opened = logger.open(tmpDir, "ring", "", opts);
+    CHECK(opened, "BinaryLogger::open() with a 64 KB ring succeeds");
+    const std::string logPath = logger.getLogPath();
+
+    // Track ID = thread * PER_THREAD + sequence, so order is checkable.
+    std::vector<std::thread> producers;
+    for (uint32_t t = 0; t < THREADS; ++t) {
+        producers.emplace_back([&logger, t] {
+            cuas::StateVector sv{};
+            for (uint32_t i = 0; i < PER_THREAD; ++i) {
+                // Paced so the writer keeps up part of the time and the
+                // ring wraps many times.
+                if (i % 64 == 0) std::this_thread::sleep_for(std::chrono::microseconds(100));
+                sv[0] = static_cast<double>(i);
+                logger.logTrackUpdated(i, t * PER_THREAD + i, sv,
+                                       cuas::TrackStatusVal::Confirmed);
+            }
+        });
+    }
+    for (auto& th : producers) th.join();
+    logger.close();
+
+    std::ifstream in(logPath, std::ios::binary);
+    uint64_t recordCount = 0, eomOk = 0, contentOk = 0;
+    bool ordered = true;
+    std::vector<int64_t> last(THREADS, -1);
+    cuas::LogRecordHeader hdr{};
+    while (cuas::BinaryLogger::readHeader(in, hdr)) {
+        ++recordCount;
+        std::vector<uint8_t> payload;
+        if (!cuas::BinaryLogger::readPayload(in, hdr.payloadSize, payload)) continue;
+        ++eomOk;
+        uint32_t id = 0;
+        double x = -1.0;
+        std::memcpy(&id, payload.data(), 4);
+        std::memcpy(&x, payload.data() + 8, 8);
+        const uint32_t t = id / PER_THREAD, i = id % PER_THREAD;
+        if (t < THREADS && x == static_cast<double>(i) && hdr.timestamp == i) ++contentOk;
+        if (t < THREADS) {
+            if (static_cast<int64_t>(i) <= last[t]) ordered = false;
+            last[t] = i;
+        }
+    }
+
+    const uint64_t total = uint64_t(THREADS) * PER_THREAD;
+    std::cout << "  (" << recordCount << " written, " << logger.droppedRecords()
+              << " dropped)\n";
+    CHECK(recordCount + logger.droppedRecords() == total,
+          "Written + dropped records equals records logged");
+    CHECK(eomOk == recordCount,     "Every written record has a valid EOM sentinel");
+    CHECK(contentOk == recordCount, "Every written record carries its producer's payload");
+    CHECK(ordered,                  "Each producer's records appear in the order logged");
+}
+
+// ---------------------------------------------------------------------------
+// Test 8 — v2 block container
+// ---------------------------------------------------------------------------
+static void logDwells(cuas::BinaryLogger& logger, uint32_t dwells)
+{
+    cuas::SPDetectionMessage dmsg{};
+    cuas::StateVector sv{};
+    for (uint32_t k = 1; k <= dwells; ++k) {
+        const cuas::Timestamp ts = 1'000'000ULL * k;
+        dmsg.messageId     = k;
+        dmsg.dwellCount    = k;
+        dmsg.timestamp     = ts;
+        dmsg.numDetections = 8u;
+        dmsg.detections.resize(8);
+        for (uint32_t i = 0; i < 8; ++i) {
+            dmsg.detections[i].range = 500.0 + 10.0 * i + 0.25 * k;
+            dmsg.detections[i].snr   = 12.0 + i;
+        }
+        logger.logRawDetections(ts, dmsg);
+        sv[0] = 500.0 + k;
+        logger.logTrackUpdated(ts + 10u, k % 5u, sv, cuas::TrackStatusVal::Confirmed);
+    }
+}
+
+static std::vector<std::vector<uint8_t>> readAll(cuas::LogReader& reader)
+{
+    std::vector<std::vector<uint8_t>> records;
+    cuas::LogRecordHeader hdr{};
+    cuas::LogPayload payload;
+    while (reader.next(hdr, payload)) {
+        std::vector<uint8_t> r(reinterpret_cast<const uint8_t*>(&hdr),
+                               reinterpret_cast<const uint8_t*>(&hdr) + sizeof(hdr));
+        r.insert(r.end(), payload.begin(), payload.end());
+        records.push_back(std::move(r));
+    }
+    return records;
+}
+
+static void testBlockContainer(const std::string& tmpDir)
+{
+    std::cout << "\n[Test 8] v2 LZ4 block container\n";
+
+    constexpr uint32_t DWELLS = 2000;
+    std::filesystem::create_directories(tmpDir);
+
+    cuas::BinaryLogger v1, v2;
+    v1.setCombinedTextEnabled(false);
+    v2.setCombinedTextEnabled(false);
+    CHECK(v1.open(tmpDir, "v1", "Clusterer=DBSCAN"), "v1 log opens");
+    cuas::LogOptions opts;
+    opts.combinedText = cuas::CombinedTextMode::Offline;
+    opts.blockBytes   = 16u << 10;
+    CHECK(v2.open(tmpDir, "v2", "Clusterer=DBSCAN", opts), "v2 log with 16 KB blocks opens");
+    logDwells(v1, DWELLS);
+    logDwells(v2, DWELLS);
+    v1.close();
+    v2.close();
+    const std::string v1Path = v1.getLogPath(), v2Path = v2.getLogPath();
+
+    cuas::LogReader r1, r2;
+    CHECK(r1.open(v1Path) && r2.open(v2Path), "LogReader opens both logs");
+    const auto recs1 = readAll(r1);
+    const auto recs2 = readAll(r2);
+    CHECK(r1.version() == 1 && r2.version() == 2, "LogReader reports v1 and v2");
+    CHECK(recs1.size() == 1 + 2 * DWELLS, "v1 log holds every record");
+    CHECK(recs1 == recs2, "v2 log reads back record-for-record identical to v1");
+    CHECK(r2.corrupted() == 0, "No damaged blocks in a clean v2 log");
+    CHECK(std::filesystem::file_size(v2Path) * 2 < std::filesystem::file_size(v1Path),
+          "v2 log is less than half the size of v1");
+
+    const auto& index = r2.index();
+    bool indexOk = index.size() > 1 && index.front().firstDwell == 1 &&
+                   index.back().lastDwell == DWELLS;
+    for (size_t i = 1; i < index.size(); ++i)
+        indexOk = indexOk && index[i].offset > index[i - 1].offset &&
+                  index[i].firstDwell >= index[i - 1].lastDwell;
+    CHECK(indexOk, "Block index covers every dwell in file order");
+
+    // Seek: the first raw detection read must be at or before the target dwell.
+    cuas::LogReader seek;
+    seek.open(v2Path);
+    const uint32_t target = DWELLS / 2;
+    CHECK(seek.seekDwell(target), "seekDwell() finds a block for the middle dwell");
+    cuas::LogRecordHeader hdr{};
+    cuas::LogPayload payload;
+    uint32_t firstDwell = 0;
+    bool reached = false;
+    while (seek.next(hdr, payload)) {
+        if (hdr.recordType != static_cast<uint32_t>(cuas::LogRecordType::RawDetection)) continue;
+        uint32_t dwell = 0;
+        std::memcpy(&dwell, payload.data() + 4, 4);
+        if (firstDwell == 0) firstDwell = dwell;
+        if (dwell == target) reached = true;
+    }
+    CHECK(firstDwell > 1 && firstDwell <= target && reached,
+          "Reading after seekDwell() starts past dwell 1 and reaches the target");
+    CHECK(!seek.seekDwell(DWELLS + 1), "seekDwell() past the last dwell fails");
+
+    // Damage one byte inside the second block's packed records.
+    {
+        std::fstream f(v2Path, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(static_cast<std::streamoff>(index[1].offset + sizeof(cuas::LogRecordHeader) +
+                                            sizeof(cuas::LogBlockHeader) + 100));
+        f.put('\x5a');
+    }
+    cuas::LogReader damaged;
+    damaged.open(v2Path);
+    const auto recsD = readAll(damaged);
+    CHECK(damaged.corrupted() == 1, "The damaged block is detected");
+    CHECK(recsD.size() == recs2.size() - index[1].records,
+          "Only the damaged block's records are lost");
+}
+
+// ---------------------------------------------------------------------------
+// Test 9 — .idx sidecar and dwell ranges
+// ---------------------------------------------------------------------------
+static void testSidecarRange(const std::string& tmpDir)
+{
+    std::cout << "\n[Test 9] .idx sidecar and dwell ranges\n";
+
+    constexpr uint32_t DWELLS = 2000, FROM = 1234, TO = 1300;
+    std::filesystem::create_directories(tmpDir);
+
+    cuas::BinaryLogger logger;
+    logger.setCombinedTextEnabled(false);
+    cuas::LogOptions opts;
+    opts.indexEvery = 100;
+    CHECK(logger.open(tmpDir, "idx", "Clusterer=DBSCAN", opts), "v1 log with a sidecar opens");
+    logDwells(logger, DWELLS);
+    logger.close();
+    const std::string binPath = logger.getLogPath();
+    const std::string idxPath = binPath.substr(0, binPath.rfind(".bin")) + ".idx";
+
+    CHECK(std::filesystem::file_size(idxPath) ==
+          (2 * DWELLS / 100) * sizeof(cuas::LogSidecarEntry),
+          "Sidecar holds an entry per 100 records");
+
+    // Reference: the range cut out of a full scan.
+    cuas::LogReader full;
+    full.open(binPath);
+    std::vector<std::vector<uint8_t>> expected;
+    uint32_t dwell = 0;
+    for (auto& r : readAll(full)) {
+        cuas::LogRecordHeader hdr;
+        std::memcpy(&hdr, r.data(), sizeof(hdr));
+        if (hdr.recordType == static_cast<uint32_t>(cuas::LogRecordType::RawDetection))
+            std::memcpy(&dwell, r.data() + sizeof(hdr) + 4, 4);
+        if (dwell >= FROM && dwell <= TO) expected.push_back(std::move(r));
+    }
+
+    cuas::LogReader ranged;
+    ranged.open(binPath);
+    CHECK(ranged.sidecar().size() == 2 * DWELLS / 100, "LogReader loads the sidecar");
+    ranged.setRange(FROM, TO);
+    const auto got = readAll(ranged);
+    CHECK(!expected.empty() && got == expected,
+          "Dwell range read through the sidecar matches a full scan");
+
+    // A sidecar entry past the end of the .bin (records lost in a crash) is ignored.
+    std::filesystem::resize_file(binPath, std::filesystem::file_size(binPath) / 2);
+    cuas::LogReader cut;
+    cut.open(binPath);
+    CHECK(!cut.sidecar().empty() && cut.sidecar().size() < 2 * DWELLS / 100 &&
+          cut.sidecar().back().offset < std::filesystem::file_size(binPath),
+          "Sidecar entries beyond a truncated .bin are dropped");
+}
+
+// ---------------------------------------------------------------------------
+// Test 10 — record-aligned chunks for parallel reading
+// ---------------------------------------------------------------------------
+static void testChunkedRead(const std::string& tmpDir)
+{
+    std::cout << "\n[Test 10] Record-aligned chunks\n";
+
+    constexpr uint32_t DWELLS = 2000;
+    std::filesystem::create_directories(tmpDir);
+
+    for (const uint32_t blockBytes : {0u, 16u << 10}) {
+        const std::string tag = blockBytes ? "v2" : "v1";
+        cuas::BinaryLogger logger;
+        logger.setCombinedTextEnabled(false);
+        cuas::LogOptions opts;
+        opts.blockBytes = blockBytes;
+        logger.open(tmpDir, "chunk" + tag, "Clusterer=DBSCAN", opts);
+        logDwells(logger, DWELLS);
+        logger.close();
+        const std::string path = logger.getLogPath();
+
+        // Each record tagged with the dwell the reader reports for it.
+        auto read = [](cuas::LogReader& reader, std::vector<std::vector<uint8_t>>& out) {
+            cuas::LogRecordHeader hdr{};
+            cuas::LogPayload payload;
+            while (reader.next(hdr, payload)) {
+                const uint32_t dwell = reader.dwell();
+                std::vector<uint8_t> r(reinterpret_cast<const uint8_t*>(&dwell),
+                                       reinterpret_cast<const uint8_t*>(&dwell) + 4);
+                r.insert(r.end(), reinterpret_cast<const uint8_t*>(&hdr),
+                         reinterpret_cast<const uint8_t*>(&hdr) + sizeof(hdr));
+                r.insert(r.end(), payload.begin(), payload.end());
+                out.push_back(std::move(r));
+            }
+        };
+
+        cuas::LogReader full;
+        full.open(path);
+        std::vector<std::vector<uint8_t>> expected, got;
+        read(full, expected);
+
+        const auto bounds = full.split(7);
+        bool ascending = bounds.size() > 2 && bounds.front() == 0 &&
+                         bounds.back() == std::filesystem::file_size(path);
+        for (size_t k = 1; k < bounds.size(); ++k)
+            ascending = ascending && bounds[k] > bounds[k - 1];
+        CHECK(ascending, tag + ": split() returns ascending offsets spanning the file");
+
+        for (size_t k = 0; k + 1 < bounds.size(); ++k) {
+            cuas::LogReader chunk;
+            chunk.open(path);
+            chunk.setByteRange(bounds[k], bounds[k + 1]);
+            read(chunk, got);
+        }
+        CHECK(got == expected,
+              tag + ": chunks read back in order match a full read, dwell included");
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Test 11 — Arrow IPC file framing
+// ---------------------------------------------------------------------------
+static void testArrowFile(const std::string& tmpDir)
+{
+    std::cout << "\n[Test 11] Arrow IPC file framing\n";
+
+    std::filesystem::create_directories(tmpDir);
+    const std::string path = tmpDir + "/tracks.arrow";
+
+    constexpr uint32_t ROWS = 10, BATCH = 4;
+    cuas::ArrowFileWriter writer;
+    CHECK(writer.open(path, {{"timestamp", cuas::ArrowType::UInt64, {}},
+                             {"track_id", cuas::ArrowType::UInt32, {}},
+                             {"status", cuas::ArrowType::Dictionary, {"tentative", "confirmed"}},
+                             {"range", cuas::ArrowType::Float64, {}}}, BATCH),
+          "ArrowFileWriter opens");
+    for (uint32_t i = 0; i < ROWS; ++i)
+        writer.append({uint64_t{1000} * i, i, i % 3u, 100.0 + i});
+    CHECK(writer.rows() == ROWS && writer.close(), "Rows appended and footer written");
+
+    std::ifstream in(path, std::ios::binary);
+    const std::vector<char> file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    CHECK(file.size() > 16 && std::memcmp(file.data(), "ARROW1\0\0", 8) == 0 &&
+          std::memcmp(file.data() + file.size() - 6, "ARROW1", 6) == 0,
+          "File starts and ends with the Arrow magic");
+
+    // Walk the encapsulated messages: continuation marker, metadata length,
+    // metadata, body (whose length is the Message's last field).
+    size_t pos = 8, messages = 0;
+    bool aligned = true, first = true;
+    int64_t firstBodyAt = -1;
+    for (;;) {
+        uint32_t marker = 0;
+        int32_t  metaLen = 0;
+        std::memcpy(&marker,  file.data() + pos, 4);
+        std::memcpy(&metaLen, file.data() + pos + 4, 4);
+        if (marker != 0xFFFFFFFFu || metaLen == 0) break;
+        aligned = aligned && pos % 8 == 0 && (8 + metaLen) % 8 == 0;
+        // Message table: root offset, then bodyLength is the one int64 field.
+        const char* meta = file.data() + pos + 8;
+        uint32_t root;
+        int32_t  toVtable;
+        std::memcpy(&root, meta, 4);
+        std::memcpy(&toVtable, meta + root, 4);
+        uint16_t bodyField = 0;
+        std::memcpy(&bodyField, meta + root - toVtable + 4 + 2 * 3, 2);
+        int64_t bodyLen = 0;
+        if (bodyField) std::memcpy(&bodyLen, meta + root + bodyField, 8);
+        // The first batch after schema and dictionary starts with the timestamps.
+        if (messages == 2 && first) {
+            firstBodyAt = static_cast<int64_t>(pos + 8 + static_cast<size_t>(metaLen));
+            first = false;
+        }
+        pos += 8 + static_cast<size_t>(metaLen) + static_cast<size_t>(bodyLen);
+        ++messages;
+    }
+    CHECK(aligned, "Every message starts 8-byte aligned with padded metadata");
+    CHECK(messages == 2 + (ROWS + BATCH - 1) / BATCH,
+          "Schema, one dictionary and a record batch per 4 rows");
+
+    int32_t footerLen = 0;
+    std::memcpy(&footerLen, file.data() + file.size() - 10, 4);
+    CHECK(pos + 8 + static_cast<size_t>(footerLen) + 10 == file.size(),
+          "End-of-stream marker and footer close the file");
+
+    // Timestamps are the first column's values, after its empty validity buffer.
+    uint64_t ts[BATCH] = {};
+    if (firstBodyAt > 0) std::memcpy(ts, file.data() + firstBodyAt, sizeof(ts));
+    CHECK(ts[0] == 0 && ts[1] == 1000 && ts[3] == 3000, "First batch holds the first rows' values");
+}
+
+// ---------------------------------------------------------------------------
+// Test 12 — log segments, preallocation and failed writes
+// ---------------------------------------------------------------------------
+static void testSegments(const std::string& tmpDir)
+{
+    std::cout << "\n[Test 12] Log segments and failed writes\n";
+
+    constexpr uint32_t DWELLS = 2000;
+    std::filesystem::create_directories(tmpDir);
+
+    for (const uint32_t blockBytes : {0u, 16u << 10}) {
+        const std::string tag = blockBytes ? "v2" : "v1";
+        cuas::BinaryLogger whole, split;
+        whole.setCombinedTextEnabled(false);
+        split.setCombinedTextEnabled(false);
+        cuas::LogOptions opts;
+        opts.combinedText = cuas::CombinedTextMode::Offline;
+        opts.blockBytes   = blockBytes;
+        whole.open(tmpDir, "whole" + tag, "Clusterer=DBSCAN", opts);
+        opts.segmentBytes     = 64u << 10;
+        opts.preallocateBytes = 1u << 20;
+        opts.sync             = cuas::LogSyncMode::Periodic;
+        opts.syncInterval     = std::chrono::milliseconds(1);
+        split.open(tmpDir, "split" + tag, "Clusterer=DBSCAN", opts);
+        const std::string first = split.getLogPath();
+        logDwells(whole, DWELLS);
+        logDwells(split, DWELLS);
+        whole.close();
+        split.close();
+
+        cuas::LogReader r;
+        r.open(whole.getLogPath());
+        const auto expected = readAll(r);
+
+        const uint32_t n = split.segments();
+        CHECK(n > 2, tag + ": 64 KB segments split the log");
+        const std::string stem = first.substr(0, first.rfind(".bin"));
+        std::vector<std::vector<uint8_t>> got;
+        bool framed = true, trimmed = true;
+        for (uint32_t k = 0; k < n; ++k) {
+            char suffix[16] = "";
+            if (k > 0) std::snprintf(suffix, sizeof(suffix), "_%03u", k);
+            const std::string path = stem + suffix + ".bin";
+            trimmed = trimmed && std::filesystem::file_size(path) < (1u << 20);
+            cuas::LogReader seg;
+            auto recs = seg.open(path) ? readAll(seg) : std::vector<std::vector<uint8_t>>{};
+            cuas::LogRecordHeader h0{}, h1{};
+            if (recs.size() > 1) {
+                std::memcpy(&h0, recs[0].data(), sizeof(h0));
+                std::memcpy(&h1, recs[1].data(), sizeof(h1));
+            }
+            framed = framed &&
+                     h0.recordType == static_cast<uint32_t>(cuas::LogRecordType::RunInfo) &&
+                     h1.recordType == static_cast<uint32_t>(cuas::LogRecordType::RawDetection);
+            got.insert(got.end(), recs.begin() + (k > 0 && !recs.empty() ? 1 : 0), recs.end());
+        }
+        CHECK(split.getLogPath() != first, tag + ": getLogPath() follows the latest segment");
+        CHECK(framed, tag + ": every segment starts with RunInfo, then a raw detection record");
+        CHECK(trimmed, tag + ": the preallocated space is trimmed at close");
+        CHECK(got == expected, tag + ": segments read back in order match an unsplit log");
+    }
+
+#ifdef __linux__
+    // Every write to /dev/full fails with ENOSPC.
+    if (std::filesystem::exists("/dev/full")) {
+        cuas::LogFile full;
+        CHECK(full.open("/dev/full"), "LogFile opens /dev/full");
+        std::vector<uint8_t> data(3u << 20, 0x5a);
+        const bool ok = full.write(data.data(), data.size()) && full.flush();
+        CHECK(!ok && full.lostBytes() == data.size(),
+              "A full disk fails the writes and counts every byte lost");
+        CHECK(full.size() == data.size() && full.write(data.data(), 16),
+              "The file keeps its position and still accepts writes");
+        full.close();
+    }
+#endif
+}
+
 // ---------------------------------------------------------------------------
 // main
 // ---------------------------------------------------------------------------
@@ -487,6 +969,12 @@ int main()
     testResyncRecovery(tmpFile);
     testZeroPayload(tmpFile);
     testBinaryLoggerAPI(tmpDir);
+    testConcurrentProducers(tmpDir);
+    testBlockContainer(tmpDir);
+    testSidecarRange(tmpDir);
+    testChunkedRead(tmpDir);
+    testArrowFile(tmpDir);
+    testSegments(tmpDir);
 
     std::cout << "\n====================================================\n";
     std::cout << "  Results: " << g_pass << " passed, "
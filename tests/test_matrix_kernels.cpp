@@ -0,0 +1,461 @@
+/*
+ * test_matrix_kernels.cpp
+ *
+ * Checks the Kalman/IMM matrix kernels in matrix_ops against reference
+ * copies of the original scalar implementations (including the abs > 1e-15
+ * skip the old multiply() had).  Inputs are random dense and SPD matrices
+ * with a fixed seed; results must agree to 1e-12 relative to the largest
+ * element of the reference.
+ *
+ * Tests
+ *   1. multiply / multiplyMV / outerProduct / krkt vs original loops
+ *   2. Axis-block propagation vs dense F P F^T + Q
+ *   3. PositionMeasurement predict / hpht / pht / Joseph update vs dense H
+ *   4. accumulateMoment vs outerProduct + addMat + scaleMat mixing
+ *   5. invertSPD3 vs Gauss-Jordan inverse and det3x3
+ *   6. SymStateMatrix packing
+ *   7. UD factorisation and Bierman update vs gain + Joseph form
+ *   8. sphericalNoise vs J diag(sigma^2) J^T with a numerical Jacobian
+ *
+ * Kernels that return a packed covariance are compared after unpacking.
+ */
+
+#include "common/types.h"
+#include "common/matrix_ops.h"
+
+#include <iostream>
+#include <random>
+#include <cmath>
+#include <algorithm>
+
+using namespace cuas;
+
+// ---------------------------------------------------------------------------
+// Lightweight test framework
+// ---------------------------------------------------------------------------
+static int g_pass = 0;
+static int g_fail = 0;
+
+#define CHECK(expr, label)                                              \
+    do {                                                                \
+        if (expr) {                                                     \
+            std::cout << "  PASS  " << (label) << "\n";                \
+            ++g_pass;                                                   \
+        } else {                                                        \
+            std::cout << "  FAIL  " << (label) << "\n";                \
+            ++g_fail;                                                   \
+        }                                                               \
+    } while (0)
+
+static constexpr double TOL = 1e-12;
+static constexpr int    TRIALS = 200;
+
+// ---------------------------------------------------------------------------
+// Reference implementations (matrix_ops.h before the per-ISA kernels)
+// ---------------------------------------------------------------------------
+namespace ref {
+
+StateMatrix multiply(const StateMatrix& A, const StateMatrix& B) {
+    StateMatrix R = matZero();
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int k = 0; k < STATE_DIM; ++k) {
+            if (std::abs(A[i][k]) < 1e-15) continue;
+            for (int j = 0; j < STATE_DIM; ++j)
+                R[i][j] += A[i][k] * B[k][j];
+        }
+    return R;
+}
+
+StateVector multiplyMV(const StateMatrix& A, const StateVector& v) {
+    StateVector r;
+    r.fill(0.0);
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = 0; j < STATE_DIM; ++j)
+            r[i] += A[i][j] * v[j];
+    return r;
+}
+
+StateMatrix outerProduct(const StateVector& a, const StateVector& b) {
+    StateMatrix R;
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = 0; j < STATE_DIM; ++j)
+            R[i][j] = a[i] * b[j];
+    return R;
+}
+
+StateMatrix krkt(const StateMeasMatrix& K, const MeasMatrix& R) {
+    StateMeasMatrix KR{};
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = 0; j < MEAS_DIM; ++j)
+            for (int k = 0; k < MEAS_DIM; ++k)
+                KR[i][j] += K[i][k] * R[k][j];
+    StateMatrix result = matZero();
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = 0; j < STATE_DIM; ++j)
+            for (int k = 0; k < MEAS_DIM; ++k)
+                result[i][j] += KR[i][k] * K[j][k];
+    return result;
+}
+
+StateMatrix joseph(const StateMatrix& P, const StateMeasMatrix& K,
+                   const MeasStateMatrix& H, const MeasMatrix& R) {
+    StateMatrix IKH = mat::subMat(matIdentity(), mat::kh(K, H));
+    StateMatrix A = multiply(multiply(IKH, P), mat::transpose(IKH));
+    return mat::addMat(A, krkt(K, R));
+}
+
+} // namespace ref
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+static std::mt19937_64 g_rng(20240611);
+
+static double rnd() {
+    static std::uniform_real_distribution<double> d(-1.0, 1.0);
+    return d(g_rng);
+}
+
+static StateMatrix randomDense() {
+    StateMatrix M;
+    for (auto& row : M) for (auto& v : row) v = rnd() * 100.0;
+    return M;
+}
+
+// Covariance-like: B B^T scaled so that position/velocity/accel terms span
+// several orders of magnitude, as in a real track.
+static StateMatrix randomSpd() {
+    StateMatrix B = randomDense();
+    StateMatrix P = ref::multiply(B, mat::transpose(B));
+    for (int i = 0; i < STATE_DIM; ++i) P[i][i] += 1.0;
+    return P;
+}
+
+// F = diag(F_x, F_y, F_z) with the CV/CA upper-triangular shape.
+static StateMatrix randomAxisBlockF() {
+    StateMatrix F = matZero();
+    double dt = 0.05 + 0.5 * std::abs(rnd());
+    for (int b = 0; b < STATE_DIM; b += AXIS_DIM) {
+        F[b][b] = F[b + 1][b + 1] = F[b + 2][b + 2] = 1.0;
+        F[b][b + 1] = F[b + 1][b + 2] = dt;
+        F[b][b + 2] = 0.5 * dt * dt;
+    }
+    return F;
+}
+
+static StateMeasMatrix randomK() {
+    StateMeasMatrix K;
+    for (auto& row : K) for (auto& v : row) v = rnd();
+    return K;
+}
+
+static MeasMatrix randomR() {
+    MeasMatrix R{};
+    for (int i = 0; i < MEAS_DIM; ++i) R[i][i] = 1.0 + 50.0 * std::abs(rnd());
+    return R;
+}
+
+static MeasStateMatrix positionH() {
+    MeasStateMatrix H{};
+    H[0][0] = H[1][3] = H[2][6] = 1.0;
+    return H;
+}
+
+template<typename M>
+static double maxAbs(const M& a) {
+    double m = 0.0;
+    for (const auto& row : a) for (double v : row) m = std::max(m, std::abs(v));
+    return m;
+}
+
+// Max element difference relative to the largest reference element.
+template<typename M>
+static double relErr(const M& got, const M& want) {
+    double d = 0.0;
+    for (size_t i = 0; i < got.size(); ++i)
+        for (size_t j = 0; j < got[i].size(); ++j)
+            d = std::max(d, std::abs(got[i][j] - want[i][j]));
+    double scale = maxAbs(want);
+    return scale > 0.0 ? d / scale : d;
+}
+
+static double relErrVec(const StateVector& got, const StateVector& want) {
+    double d = 0.0, scale = 0.0;
+    for (int i = 0; i < STATE_DIM; ++i) {
+        d = std::max(d, std::abs(got[i] - want[i]));
+        scale = std::max(scale, std::abs(want[i]));
+    }
+    return scale > 0.0 ? d / scale : d;
+}
+
+// ---------------------------------------------------------------------------
+// Test 1: dense kernels
+// ---------------------------------------------------------------------------
+static void testDenseKernels() {
+    std::cout << "\n[Test 1] Dense kernels (" << mat::kernelIsa() << ")\n";
+
+    double eMul = 0, eMV = 0, eOuter = 0, eKrkt = 0;
+    bool outerExact = true;
+    for (int t = 0; t < TRIALS; ++t) {
+        StateMatrix A = randomDense(), B = randomSpd();
+        StateVector v, w;
+        for (int i = 0; i < STATE_DIM; ++i) { v[i] = rnd() * 1e3; w[i] = rnd(); }
+        StateMeasMatrix K = randomK();
+        MeasMatrix R = randomR();
+
+        eMul  = std::max(eMul, relErr(mat::multiply(A, B), ref::multiply(A, B)));
+        eMV   = std::max(eMV, relErrVec(mat::multiplyMV(A, v), ref::multiplyMV(A, v)));
+        eKrkt = std::max(eKrkt, relErr(symToMatrix(mat::krkt(K, R)), ref::krkt(K, R)));
+        StateMatrix o = mat::outerProduct(v, w);
+        eOuter = std::max(eOuter, relErr(o, ref::outerProduct(v, w)));
+        outerExact = outerExact && o == ref::outerProduct(v, w);
+    }
+    CHECK(eMul < TOL, "multiply matches reference");
+    CHECK(eMV < TOL, "multiplyMV matches reference");
+    CHECK(eOuter < TOL && outerExact, "outerProduct matches reference exactly");
+    CHECK(eKrkt < TOL, "krkt matches reference");
+
+    // Sparse F (CV-style zeros) exercises the old skip branch.
+    StateMatrix F = randomAxisBlockF(), P = randomSpd();
+    CHECK(relErr(mat::multiply(F, P), ref::multiply(F, P)) < TOL,
+          "multiply matches reference on sparse F");
+}
+
+// ---------------------------------------------------------------------------
+// Test 2: axis-block propagation
+// ---------------------------------------------------------------------------
+static void testAxisBlockPropagation() {
+    std::cout << "\n[Test 2] Axis-block propagation\n";
+
+    double eP = 0, eX = 0;
+    for (int t = 0; t < TRIALS; ++t) {
+        StateMatrix F = randomAxisBlockF(), P = randomSpd(), Q = randomSpd();
+        StateVector x;
+        for (auto& v : x) v = rnd() * 1e4;
+
+        SymStateMatrix Ps = symFromMatrix(P);
+
+        StateMatrix want = mat::addMat(
+            ref::multiply(ref::multiply(F, P), mat::transpose(F)), Q);
+        eP = std::max(eP, relErr(symToMatrix(mat::propagateAxisBlocks(F, Ps, Q)), want));
+        eP = std::max(eP, relErr(symToMatrix(mat::propagateDense(F, Ps, Q)), want));
+        eX = std::max(eX, relErrVec(mat::multiplyMVAxisBlocks(F, x),
+                                    ref::multiplyMV(F, x)));
+    }
+    CHECK(eP < TOL, "propagateAxisBlocks / propagateDense match F P F^T + Q");
+    CHECK(eX < TOL, "multiplyMVAxisBlocks matches F x");
+}
+
+// ---------------------------------------------------------------------------
+// Test 3: position-measurement kernels
+// ---------------------------------------------------------------------------
+static void testPositionKernels() {
+    std::cout << "\n[Test 3] Position-measurement kernels\n";
+    using PM = mat::PositionMeasurement;
+
+    const MeasStateMatrix H = positionH();
+    bool pickExact = PM::matrix() == H;
+    double eJoseph = 0;
+    for (int t = 0; t < TRIALS; ++t) {
+        StateMatrix P = randomSpd();
+        SymStateMatrix Ps = symFromMatrix(P);
+        StateMeasMatrix K = randomK();
+        MeasMatrix R = randomR();
+        StateVector x;
+        for (auto& v : x) v = rnd() * 1e4;
+
+        pickExact = pickExact && PM::predict(x) == mat::measFromState(H, x);
+        pickExact = pickExact && PM::hpht(Ps) == mat::hpht(H, P);
+        pickExact = pickExact && PM::pht(Ps) == mat::pht(P, H);
+        eJoseph = std::max(eJoseph, relErr(symToMatrix(PM::josephUpdate(Ps, K, R)),
+                                           ref::joseph(P, K, H, R)));
+    }
+    CHECK(pickExact, "predict / hpht / pht equal dense H forms");
+    CHECK(eJoseph < TOL, "josephUpdatePosition matches dense Joseph form");
+}
+
+// ---------------------------------------------------------------------------
+// Test 4: IMM moment accumulation
+// ---------------------------------------------------------------------------
+static void testAccumulateMoment() {
+    std::cout << "\n[Test 4] IMM moment accumulation\n";
+
+    bool exact = true;
+    for (int t = 0; t < TRIALS; ++t) {
+        SymStateMatrix accNew;
+        StateMatrix accOld = matZero();
+        for (int j = 0; j < 3; ++j) {
+            StateMatrix P = randomSpd();
+            StateVector d;
+            for (auto& v : d) v = rnd() * 10.0;
+            double w = std::abs(rnd());
+
+            mat::accumulateMoment(accNew, w, symFromMatrix(P), d);
+            accOld = mat::addMat(accOld, mat::scaleMat(
+                mat::addMat(P, ref::outerProduct(d, d)), w));
+        }
+        exact = exact && accNew == symFromMatrix(accOld);
+    }
+    CHECK(exact, "accumulateMoment equals outerProduct/addMat/scaleMat mixing");
+}
+
+// ---------------------------------------------------------------------------
+// Test 5: SPD 3x3 inverse
+// ---------------------------------------------------------------------------
+static void testInvertSPD3() {
+    std::cout << "\n[Test 5] invertSPD3\n";
+
+    double eInv = 0, eLogDet = 0;
+    bool allOk = true;
+    for (int t = 0; t < TRIALS; ++t) {
+        // Innovation-covariance-like: H P H^T + R.
+        MeasMatrix S = mat::measAddMat(mat::hpht(positionH(), randomSpd()), randomR());
+        MeasMatrix Sinv, want;
+        double logDet = 0;
+        allOk = allOk && mat::invertSPD3(S, Sinv, logDet) && mat::invertMeas(S, want);
+        eInv = std::max(eInv, relErr(Sinv, want));
+        eLogDet = std::max(eLogDet, std::abs(logDet - std::log(mat::det3x3(S))));
+    }
+    CHECK(allOk, "invertSPD3 accepts SPD innovation covariances");
+    CHECK(eInv < 1e-10, "invertSPD3 inverse matches Gauss-Jordan");
+    CHECK(eLogDet < 1e-10, "invertSPD3 log-determinant matches log(det3x3)");
+
+    MeasMatrix indefinite{};
+    indefinite[0][0] = 1.0;  indefinite[1][1] = -1.0;  indefinite[2][2] = 1.0;
+    MeasMatrix Sinv;
+    double logDet;
+    CHECK(!mat::invertSPD3(indefinite, Sinv, logDet), "invertSPD3 rejects indefinite S");
+}
+
+// ---------------------------------------------------------------------------
+// Test 6: packed symmetric storage
+// ---------------------------------------------------------------------------
+static void testSymPacking() {
+    std::cout << "\n[Test 6] SymStateMatrix packing\n";
+
+    std::array<int, SYM_DIM> hits{};
+    bool mirrored = true;
+    for (int i = 0; i < STATE_DIM; ++i)
+        for (int j = 0; j < STATE_DIM; ++j) {
+            mirrored = mirrored && symIndex(i, j) == symIndex(j, i);
+            if (i <= j) ++hits[symIndex(i, j)];
+        }
+    CHECK(mirrored && std::all_of(hits.begin(), hits.end(), [](int h) { return h == 1; }),
+          "symIndex maps each upper-triangle element to a distinct slot");
+
+    bool roundTrip = true;
+    for (int t = 0; t < TRIALS; ++t) {
+        StateMatrix P = randomSpd();
+        roundTrip = roundTrip && symToMatrix(symFromMatrix(P)) == P;
+    }
+    CHECK(roundTrip, "symFromMatrix / symToMatrix round-trip a symmetric matrix");
+}
+
+// ---------------------------------------------------------------------------
+// Test 7: UD factorisation / Bierman update
+// ---------------------------------------------------------------------------
+static void testBiermanUpdate() {
+    std::cout << "\n[Test 7] UD factorisation and Bierman update\n";
+    using PM = mat::PositionMeasurement;
+
+    double eCompose = 0, eP = 0, eX = 0;
+    bool allOk = true;
+    for (int t = 0; t < TRIALS; ++t) {
+        SymStateMatrix P = symFromMatrix(randomSpd());
+        mat::UDFactors f;
+        allOk = allOk && mat::udFactor(P, f);
+        eCompose = std::max(eCompose, relErr(symToMatrix(mat::udCompose(f)), symToMatrix(P)));
+
+        // Correlated R, as from a spherical-to-Cartesian conversion.
+        MeasMatrix R = randomR();
+        double c = 0.5 * rnd();
+        R[0][1] = R[1][0] = c * std::sqrt(R[0][0] * R[1][1]);
+        StateVector x;
+        for (auto& v : x) v = rnd() * 1e4;
+        MeasVector z;
+        for (int m = 0; m < MEAS_DIM; ++m) z[m] = x[PM::index[m]] + rnd() * 10.0;
+
+        MeasMatrix Sinv;
+        double logDet;
+        allOk = allOk && mat::invertSPD3(mat::measAddMat(PM::hpht(P), R), Sinv, logDet);
+        StateMeasMatrix K = mat::kalmanGain(PM::pht(P), Sinv);
+        StateVector xWant = mat::add(x, mat::kalmanCorrection(K, mat::measSub(z, PM::predict(x))));
+        StateMatrix PWant = symToMatrix(PM::josephUpdate(P, K, R));
+
+        allOk = allOk && PM::biermanUpdate(x, P, z, R);
+        eP = std::max(eP, relErr(symToMatrix(P), PWant));
+        eX = std::max(eX, relErrVec(x, xWant));
+    }
+    CHECK(allOk, "udFactor / biermanUpdate accept SPD P and R");
+    CHECK(eCompose < 1e-10, "udCompose(udFactor(P)) reproduces P");
+    CHECK(eP < 1e-10 && eX < 1e-10, "biermanUpdate matches Kalman gain + Joseph form");
+
+    SymStateMatrix indefinite = symFromMatrix(matIdentity());
+    indefinite(4, 4) = -1.0;
+    StateVector x{};
+    MeasVector z{};
+    CHECK(!PM::biermanUpdate(x, indefinite, z, randomR()) && indefinite(4, 4) == -1.0,
+          "biermanUpdate rejects indefinite P and leaves it untouched");
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+// ---------------------------------------------------------------------------
+// Test 8: converted-measurement noise
+// ---------------------------------------------------------------------------
+static void testSphericalNoise() {
+    std::cout << "\n[Test 8] sphericalNoise\n";
+
+    std::uniform_real_distribution<double> range(50.0, 30000.0), az(-3.0, 3.0), el(-0.2, 1.4);
+    double err = 0;
+    for (int t = 0; t < TRIALS; ++t) {
+        const double s[3] = {range(g_rng), az(g_rng), el(g_rng)};
+        const double sigma[3] = {10.0, 0.005, 0.003};
+
+        // Central-difference Jacobian of sphericalToCartesian.
+        double J[3][3];
+        for (int k = 0; k < 3; ++k) {
+            const double h = k == 0 ? 1e-3 : 1e-7;
+            double lo[3] = {s[0], s[1], s[2]}, hi[3] = {s[0], s[1], s[2]};
+            lo[k] -= h;  hi[k] += h;
+            const CartesianPos a = sphericalToCartesian(lo[0], lo[1], lo[2]);
+            const CartesianPos b = sphericalToCartesian(hi[0], hi[1], hi[2]);
+            J[0][k] = (b.x - a.x) / (2 * h);
+            J[1][k] = (b.y - a.y) / (2 * h);
+            J[2][k] = (b.z - a.z) / (2 * h);
+        }
+        MeasMatrix want{};
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                for (int k = 0; k < 3; ++k)
+                    want[i][j] += J[i][k] * sigma[k] * sigma[k] * J[j][k];
+
+        const MeasMatrix R = mat::sphericalNoise(s[0], s[1], s[2], sigma[0], sigma[1], sigma[2]);
+        err = std::max(err, relErr(R, want));
+    }
+    CHECK(err < 1e-6, "sphericalNoise matches J diag(sigma^2) J^T");
+}
+
+int main()
+{
+    std::cout << "====================================================\n";
+    std::cout << "  Counter-UAS Matrix Kernel Tests\n";
+    std::cout << "====================================================\n";
+
+    testDenseKernels();
+    testAxisBlockPropagation();
+    testPositionKernels();
+    testAccumulateMoment();
+    testInvertSPD3();
+    testSymPacking();
+    testBiermanUpdate();
+    testSphericalNoise();
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  Results: " << g_pass << " passed, "
+              << g_fail << " failed\n";
+    std::cout << "====================================================\n";
+
+    return g_fail == 0 ? 0 : 1;
+}
@@ -0,0 +1,353 @@
+/*
+ * test_scenario_regression.cpp
+ *
+ * Scenario regression suite: seeded dsp_injector scenarios
+ * (tests/scenarios/<name>.scenario) are generated in-process with their ground
+ * truth and replayed through a TrackManager as fast as possible, the way
+ * log_replay does, once per clustering x association method.  Every run is
+ * scored and checked against tests/scenario_baselines.txt, so a change
+ * that makes tracks worse or the tracker slower fails CTest.
+ *
+ * Metrics (per scenario and method pair)
+ *   ospa        mean per-dwell OSPA, c = 100 m, p = 1 (m)
+ *   gospa       mean per-dwell GOSPA, c = 100 m, p = 1, alpha = 2 (m)
+ *   continuity  fraction of consecutive matched dwells of a truth target
+ *               that kept the same track ID (1 = no ID switches)
+ *   falseTracks confirmed/coasting tracks matched to no target, per dwell
+ *   dwellsPerSec, p99Ms  processDwell throughput and p99 dwell time, best
+ *               of THROUGHPUT_RUNS replays (the scores are deterministic)
+ * Reported tracks are the confirmed and coasting ones; truth and tracks are
+ * matched per dwell by an optimal assignment of position error under c.
+ *
+ * Gates: ospa/gospa may rise 5% + 0.5 m, continuity may drop 0.02,
+ * falseTracks may rise 10% + 0.05.  Throughput is machine-dependent: with
+ * --throughput-tolerance T (default 0.5) dwells/s may fall to (1 - T) x
+ * and p99 may rise to 1 / (1 - T) x the baseline + 0.25 ms; T = 0 skips
+ * the check.
+ *
+ * Usage: test_scenario_regression <source dir> [--update] [--throughput-tolerance T]
+ *   --update  rewrites the baselines with this run's figures
+ */
+
+#include "dsp_simulator.h"
+#include "association/assignment.h"
+#include "common/config.h"
+#include "common/latency_histogram.h"
+#include "track_management/track_manager.h"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace cuas;
+
+// ---------------------------------------------------------------------------
+// Lightweight test framework
+// ---------------------------------------------------------------------------
+static int g_pass = 0;
+static int g_fail = 0;
+
+#define CHECK(expr, label)                                              \
+    do {                                                                \
+        if (expr) {                                                     \
+            std::cout << "  PASS  " << (label) << "\n";                \
+            ++g_pass;                                                   \
+        } else {                                                        \
+            std::cout << "  FAIL  " << (label) << "\n";                \
+            ++g_fail;                                                   \
+        }                                                               \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+// Scenarios and methods
+// ---------------------------------------------------------------------------
+static const char* const kScenarios[] = { "sparse", "crossing", "clutter", "swarm" };
+
+static const std::pair<const char*, ClusterMethod> kClusterMethods[] = {
+    { "dbscan",               ClusterMethod::DBSCAN },
+    { "range_based",          ClusterMethod::RangeBased },
+    { "range_strength",       ClusterMethod::RangeStrengthBased },
+    { "connected_components", ClusterMethod::ConnectedComponents },
+};
+static const std::pair<const char*, AssociationMethod> kAssociationMethods[] = {
+    { "mahalanobis", AssociationMethod::Mahalanobis },
+    { "gnn",         AssociationMethod::GNN },
+    { "jpda",        AssociationMethod::JPDA },
+    { "mht",         AssociationMethod::MHT },
+};
+
+static constexpr double OSPA_CUTOFF_M   = 100.0;
+static constexpr double NOISE_FLOOR_DBM = -90.0;
+static constexpr Timestamp EPOCH_US     = 1700000000000000ull;
+static constexpr int    THROUGHPUT_RUNS = 3;
+
+struct Dwell {
+    SPDetectionMessage msg;
+    std::vector<CartesianPos> truth;     // targets in the field of view
+    std::vector<uint32_t>     truthId;   // DSPSimulator target index
+};
+
+struct Metrics {
+    double ospa = 0.0, gospa = 0.0, continuity = 1.0, falseTracks = 0.0;
+    double dwellsPerSec = 0.0, p99Ms = 0.0;
+};
+
+// Runs the scenario's DSPSimulator and keeps every dwell with its truth.
+static std::vector<Dwell> generate(const Scenario& sc) {
+    DSPSimulator sim(sc, NOISE_FLOOR_DBM, 1);
+    const double   dt    = sc.rateHz > 0.0 ? 1.0 / sc.rateHz : 0.1;
+    const uint64_t total = static_cast<uint64_t>(std::llround(sc.durationSec / dt));
+
+    std::vector<Dwell> dwells(total);
+    for (uint64_t n = 0; n < total; ++n) {
+        Dwell& d = dwells[n];
+        sim.generateDwell(dt, d.msg.detections);
+        d.msg.messageId     = MSG_ID_SP_DETECTION;
+        d.msg.dwellCount    = static_cast<uint32_t>(n);
+        d.msg.timestamp     = EPOCH_US + static_cast<Timestamp>(std::llround(n * dt * 1e6));
+        d.msg.numDetections = static_cast<uint32_t>(d.msg.detections.size());
+        d.msg.sensorId      = sc.sensorId;
+        const auto& targets = sim.targets();
+        for (size_t i = 0; i < targets.size(); ++i) {
+            if (!targets[i].active) continue;
+            d.truth.push_back({ targets[i].x, targets[i].y, targets[i].z });
+            d.truthId.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return dwells;
+}
+
+// Replays the dwells through a fresh TrackManager and scores the tracks.
+static Metrics replay(const TrackerConfig& cfg, const std::vector<Dwell>& dwells) {
+    StageTimings timings;
+    TrackManager tm(cfg, &timings, 0);
+
+    SparseCostMatrix       C;
+    SparseAssignmentSolver solver;
+    std::vector<int>       rowToCol;
+    std::vector<CartesianPos> trackPos;
+    std::vector<uint32_t>     trackIds;
+    std::map<uint32_t, uint32_t> lastTrackOf;     // truth -> track last matched
+    uint64_t kept = 0, transitions = 0, falseTracks = 0;
+    double   ospaSum = 0.0, gospaSum = 0.0, runSec = 0.0;
+    const double c = OSPA_CUTOFF_M;
+
+    for (const Dwell& d : dwells) {
+        const auto start = std::chrono::steady_clock::now();
+        {
+            StageTimer timer(&timings, PipelineStage::Dwell);
+            tm.processDwell(d.msg);
+        }
+        runSec += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const TrackStore& tracks = tm.tracks();
+        trackPos.clear();
+        trackIds.clear();
+        for (size_t i = 0; i < tracks.size(); ++i) {
+            const TrackStatus s = tracks.status(i);
+            if (s != TrackStatus::TRACK_CONFIRMED && s != TrackStatus::TRACK_COASTING) continue;
+            const StateVector& x = tracks[i].state();
+            trackPos.push_back({ x[0], x[3], x[6] });
+            trackIds.push_back(tracks[i].id());
+        }
+
+        // Truth rows, track columns, pairs under the cutoff; a pair is
+        // worth c (one miss and one false track at c/2 each).
+        C.reset(static_cast<int>(trackPos.size()));
+        for (const CartesianPos& t : d.truth) {
+            for (size_t j = 0; j < trackPos.size(); ++j) {
+                const double dx = t.x - trackPos[j].x, dy = t.y - trackPos[j].y,
+                             dz = t.z - trackPos[j].z;
+                const double dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+                if (dist < c) C.add(static_cast<int>(j), dist);
+            }
+            C.endRow();
+        }
+        solver.solve(C, c, rowToCol);
+
+        double matchedDist = 0.0;
+        size_t matched = 0;
+        for (size_t r = 0; r < d.truth.size(); ++r) {
+            const int j = rowToCol[r];
+            if (j < 0) continue;
+            for (int k = C.rowStart[r]; k < C.rowStart[r + 1]; ++k)
+                if (C.col[k] == j) matchedDist += C.cost[k];
+            ++matched;
+            auto it = lastTrackOf.find(d.truthId[r]);
+            if (it != lastTrackOf.end()) {
+                ++transitions;
+                if (it->second == trackIds[j]) ++kept;
+            }
+            lastTrackOf[d.truthId[r]] = trackIds[j];
+        }
+
+        const size_t nT = d.truth.size(), nX = trackPos.size();
+        const size_t n  = std::max(nT, nX);
+        if (n > 0) ospaSum += (matchedDist + c * (n - matched)) / n;
+        gospaSum    += matchedDist + c / 2.0 * ((nT - matched) + (nX - matched));
+        falseTracks += nX - matched;
+    }
+    tm.logger().close();
+
+    Metrics m;
+    const double N = static_cast<double>(dwells.size());
+    m.ospa         = ospaSum / N;
+    m.gospa        = gospaSum / N;
+    m.continuity   = transitions > 0 ? static_cast<double>(kept) / transitions : 1.0;
+    m.falseTracks  = falseTracks / N;
+    m.dwellsPerSec = N / std::max(runSec, 1e-9);
+    m.p99Ms        = timings[PipelineStage::Dwell].summary().p99Us / 1000.0;
+    return m;
+}
+
+// ---------------------------------------------------------------------------
+// Baselines: "scenario cluster association ospa gospa continuity
+// falseTracks dwellsPerSec p99Ms" per line, '#' comments.
+// ---------------------------------------------------------------------------
+static std::string keyOf(const std::string& scenario, const char* cluster, const char* assoc) {
+    return scenario + " " + cluster + " " + assoc;
+}
+
+static std::map<std::string, Metrics> loadBaselines(const std::string& path) {
+    std::map<std::string, Metrics> out;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream ls(line);
+        std::string scenario, cluster, assoc;
+        Metrics m;
+        if (!(ls >> scenario) || scenario[0] == '#') continue;
+        if (ls >> cluster >> assoc >> m.ospa >> m.gospa >> m.continuity >> m.falseTracks
+               >> m.dwellsPerSec >> m.p99Ms)
+            out[scenario + " " + cluster + " " + assoc] = m;
+    }
+    return out;
+}
+
+static bool saveBaselines(const std::string& path, const std::map<std::string, Metrics>& all) {
+    std::ofstream out(path);
+    if (!out.is_open()) return false;
+    out << "# Scenario regression baselines (test_scenario_regression --update).\n"
+        << "# scenario cluster association ospa_m gospa_m continuity false_tracks_per_dwell"
+           " dwells_per_s p99_ms\n";
+    out << std::fixed;
+    for (const auto& kv : all) {
+        const Metrics& m = kv.second;
+        out << kv.first << std::setprecision(3)
+            << " " << m.ospa << " " << m.gospa << " " << m.continuity << " " << m.falseTracks
+            << std::setprecision(1) << " " << m.dwellsPerSec
+            << std::setprecision(3) << " " << m.p99Ms << "\n";
+    }
+    return out.good();
+}
+
+static void checkAgainst(const std::string& key, const Metrics& m, const Metrics& b,
+                         double throughputTol) {
+    CHECK(m.ospa <= b.ospa * 1.05 + 0.5,
+          key + ": OSPA " + std::to_string(m.ospa) + " vs " + std::to_string(b.ospa));
+    CHECK(m.gospa <= b.gospa * 1.05 + 0.5,
+          key + ": GOSPA " + std::to_string(m.gospa) + " vs " + std::to_string(b.gospa));
+    CHECK(m.continuity >= b.continuity - 0.02,
+          key + ": continuity " + std::to_string(m.continuity) + " vs " + std::to_string(b.continuity));
+    CHECK(m.falseTracks <= b.falseTracks * 1.10 + 0.05,
+          key + ": false tracks/dwell " + std::to_string(m.falseTracks) + " vs " +
+          std::to_string(b.falseTracks));
+    if (throughputTol <= 0.0) return;
+    const double keep = 1.0 - std::min(throughputTol, 0.99);
+    CHECK(m.dwellsPerSec >= b.dwellsPerSec * keep,
+          key + ": dwells/s " + std::to_string(m.dwellsPerSec) + " vs " + std::to_string(b.dwellsPerSec));
+    CHECK(m.p99Ms <= b.p99Ms / keep + 0.25,
+          key + ": p99 ms " + std::to_string(m.p99Ms) + " vs " + std::to_string(b.p99Ms));
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <source dir> [--update] [--throughput-tolerance T]\n";
+        return 1;
+    }
+    const std::string root = argv[1];
+    bool   update        = false;
+    double throughputTol = 0.5;
+    for (int i = 2; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--update") update = true;
+        else if (arg == "--throughput-tolerance" && i + 1 < argc) throughputTol = std::stod(argv[++i]);
+    }
+    const std::string baselinePath = root + "/tests/scenario_baselines.txt";
+
+    std::cout << "====================================================\n";
+    std::cout << "  Counter-UAS Scenario Regression\n";
+    std::cout << "====================================================\n";
+
+    ConsoleLogger::instance().setLevel(ConsoleLogger::ERROR);
+    TrackerConfig base = loadConfig(root + "/config/tracker_config.json");
+    base.system.logEnabled         = false;
+    base.system.checkpoint.enabled = false;
+
+    const std::map<std::string, Metrics> baselines = loadBaselines(baselinePath);
+    std::map<std::string, Metrics> results;
+
+    for (const char* name : kScenarios) {
+        Scenario sc;
+        const std::string path = root + "/tests/scenarios/" + name + ".scenario";
+        if (!loadScenario(path, sc)) {
+            CHECK(false, std::string("load ") + path);
+            continue;
+        }
+        const std::vector<Dwell> dwells = generate(sc);
+        std::cout << "\n--- " << name << ": " << dwells.size() << " dwells, seed " << sc.seed << "\n";
+        std::cout << "  cluster              assoc         OSPA   GOSPA  contin  false/dw   dwells/s   p99 ms\n";
+
+        for (const auto& cm : kClusterMethods) {
+            for (const auto& am : kAssociationMethods) {
+                TrackerConfig cfg = base;
+                cfg.clustering.method  = cm.second;
+                cfg.association.method = am.second;
+                Metrics m = replay(cfg, dwells);
+                for (int run = 1; run < THROUGHPUT_RUNS; ++run) {
+                    const Metrics again = replay(cfg, dwells);
+                    m.dwellsPerSec = std::max(m.dwellsPerSec, again.dwellsPerSec);
+                    m.p99Ms        = std::min(m.p99Ms, again.p99Ms);
+                }
+                const std::string key = keyOf(name, cm.first, am.first);
+                results[key] = m;
+
+                std::cout << "  " << std::left << std::setw(20) << cm.first << " "
+                          << std::setw(12) << am.first << std::right << std::fixed
+                          << std::setprecision(2) << std::setw(7) << m.ospa
+                          << std::setw(8) << m.gospa << std::setw(8) << m.continuity
+                          << std::setw(10) << m.falseTracks
+                          << std::setprecision(0) << std::setw(11) << m.dwellsPerSec
+                          << std::setprecision(3) << std::setw(9) << m.p99Ms << "\n";
+
+                if (update) continue;
+                auto it = baselines.find(key);
+                if (it == baselines.end()) CHECK(false, key + ": no baseline (run with --update)");
+                else                       checkAgainst(key, m, it->second, throughputTol);
+            }
+        }
+    }
+
+    if (update) {
+        CHECK(saveBaselines(baselinePath, results), "baselines written to " + baselinePath);
+    }
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  Results: " << g_pass << " passed, "
+              << g_fail << " failed\n";
+    std::cout << "====================================================\n";
+
+    return g_fail == 0 ? 0 : 1;
+}
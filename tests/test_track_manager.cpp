@@ -0,0 +1,581 @@
+/*
+ * test_track_manager.cpp
+ *
+ * Checks TrackManager as a whole on simulated dwells: warm restart from a
+ * checkpoint, track handover between nodes, lazy prediction and
+ * track-aided clustering.
+ *
+ * Tests
+ *   1. Checkpoint round trip: a fresh TrackManager restored from the
+ *      checkpoint of dwell N has the saved tracks (IDs, states,
+ *      covariances, counters) and track ID counter, and its later dwells
+ *      match an uninterrupted run's
+ *   2. Distributed handover: two nodes splitting the azimuth; targets
+ *      crossing the boundary move to the other node under the same ID with
+ *      the handed-over state, and no track ID lives on both nodes
+ *   3. Late and early handovers: a handover delivered two dwells late, or
+ *      sent by a node a dwell ahead of or behind the receiver, continues
+ *      with its state predicted to the receiver's dwell
+ *   4. Lazy prediction: a coasting track leaves the IMM batch and reports
+ *      the CV extrapolation over the elapsed time; a detection inside that
+ *      gate wakes it, and after the catch-up predicts its estimate is the
+ *      eagerly predicted track's
+ *   5. Track-aided clustering: on crossing targets in light and dense
+ *      clutter, with DBSCAN and RangeBased, a clustering.trackAided manager
+ *      keeps the blind manager's track IDs, states and counters every dwell
+ *
+ * Usage: test_track_manager <source dir>
+ */
+
+#include "track_management/track_manager.h"
+#include "track_management/track_checkpoint.h"
+#include "common/logger.h"
+#include "prediction/imm_filter.h"
+#include "dsp_simulator.h"
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace cuas;
+
+// ---------------------------------------------------------------------------
+// Lightweight test framework
+// ---------------------------------------------------------------------------
+static int g_pass = 0;
+static int g_fail = 0;
+
+#define CHECK(expr, label)                                              \
+    do {                                                                \
+        if (expr) {                                                     \
+            std::cout << "  PASS  " << (label) << "\n";                \
+            ++g_pass;                                                   \
+        } else {                                                        \
+            std::cout << "  FAIL  " << (label) << "\n";                \
+            ++g_fail;                                                   \
+        }                                                               \
+    } while (0)
+
+// ---------------------------------------------------------------------------
+// Helpers
+// ---------------------------------------------------------------------------
+static constexpr double    NOISE_FLOOR_DBM = -90.0;
+static constexpr Timestamp EPOCH_US        = 1700000000000000ull;
+
+// Crossing targets in clutter, light by default, 10 Hz.
+static std::vector<SPDetectionMessage> generate(double durationSec, double clutterDensity = 0.001) {
+    Scenario sc;
+    sc.targets        = 8;
+    sc.crossingPairs  = 3;
+    sc.clutterDensity = clutterDensity;
+    sc.durationSec    = durationSec;
+    sc.seed           = 5201;
+    DSPSimulator sim(sc, NOISE_FLOOR_DBM, 1);
+    const double dt = 1.0 / sc.rateHz;
+
+    std::vector<SPDetectionMessage> dwells(static_cast<size_t>(std::llround(durationSec / dt)));
+    for (size_t n = 0; n < dwells.size(); ++n) {
+        SPDetectionMessage& msg = dwells[n];
+        sim.generateDwell(dt, msg.detections);
+        msg.messageId     = MSG_ID_SP_DETECTION;
+        msg.dwellCount    = static_cast<uint32_t>(n);
+        msg.timestamp     = EPOCH_US + static_cast<Timestamp>(std::llround(n * dt * 1e6));
+        msg.numDetections = static_cast<uint32_t>(msg.detections.size());
+    }
+    return dwells;
+}
+
+// Everything a track carries from dwell to dwell, in ID order.
+struct TrackRow {
+    uint32_t       id = 0;
+    TrackStatus    status{};
+    uint32_t       hits = 0, misses = 0;
+    double         quality = 0.0;
+    StateVector    x{};
+    SymStateMatrix P;
+
+    bool operator==(const TrackRow& o) const {
+        return id == o.id && status == o.status && hits == o.hits && misses == o.misses &&
+               quality == o.quality && x == o.x && P == o.P;
+    }
+};
+
+static std::vector<TrackRow> snapshot(const TrackManager& tm) {
+    const TrackStore& store = tm.tracks();
+    std::vector<TrackRow> rows(store.size());
+    for (size_t i = 0; i < store.size(); ++i) {
+        rows[i].id      = store[i].id();
+        rows[i].status  = store.status(i);
+        rows[i].hits    = store.hitCount(i);
+        rows[i].misses  = store.consecutiveMisses(i);
+        rows[i].quality = store.quality(i);
+        rows[i].x       = store[i].state();
+        rows[i].P       = store[i].covariance();
+    }
+    std::sort(rows.begin(), rows.end(),
+              [](const TrackRow& a, const TrackRow& b) { return a.id < b.id; });
+    return rows;
+}
+
+// ---------------------------------------------------------------------------
+// 1. Checkpoint round trip
+// ---------------------------------------------------------------------------
+static void testCheckpoint(const TrackerConfig& base,
+                           const std::vector<SPDetectionMessage>& dwells, const std::string& tmpDir) {
+    std::cout << "\n--- Checkpoint round trip ---\n";
+    constexpr size_t SAVED = 150;    // dwells run before the checkpoint
+
+    // The uninterrupted run.
+    std::vector<std::vector<TrackRow>> reference;
+    {
+        auto tm = std::make_unique<TrackManager>(base);
+        for (const auto& msg : dwells) {
+            tm->processDwell(msg);
+            reference.push_back(snapshot(*tm));
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::remove_all(tmpDir, ec);
+    TrackerConfig cfg = base;
+    cfg.system.checkpoint.enabled      = true;
+    cfg.system.checkpoint.directory    = tmpDir;
+    cfg.system.checkpoint.periodDwells = static_cast<int>(SAVED);   // one save, after dwell SAVED
+    {
+        auto tm = std::make_unique<TrackManager>(cfg);
+        CHECK(tm->numActiveTracks() == 0, "no checkpoint yet: starts empty");
+        for (size_t n = 0; n < SAVED; ++n) tm->processDwell(dwells[n]);
+    }
+
+    CheckpointImage img;
+    CHECK(TrackCheckpoint(tmpDir, "tracker.ckpt").load(img) &&
+          img.dwellCount == dwells[SAVED - 1].dwellCount,
+          "checkpoint of dwell " + std::to_string(SAVED) + " written");
+
+    auto restored = std::make_unique<TrackManager>(cfg);
+    const std::vector<TrackRow>& saved = reference[SAVED - 1];
+    std::cout << "  restored " << restored->numActiveTracks() << " tracks ("
+              << restored->numConfirmedTracks() << " confirmed), next ID " << img.nextTrackId << "\n";
+    CHECK(!saved.empty() && snapshot(*restored) == saved,
+          "restored IDs, states, covariances and counters match");
+    CHECK(restored->lastDwellCount() == img.dwellCount, "dwell count restored");
+
+    int mismatched = 0;
+    uint32_t firstNewId = 0;
+    for (size_t n = SAVED; n < dwells.size(); ++n) {
+        restored->processDwell(dwells[n]);
+        const std::vector<TrackRow> rows = snapshot(*restored);
+        if (rows != reference[n]) ++mismatched;
+        for (const TrackRow& r : rows) {
+            const bool isNew = std::none_of(saved.begin(), saved.end(),
+                                            [&](const TrackRow& t) { return t.id == r.id; });
+            if (isNew && (firstNewId == 0 || r.id < firstNewId)) firstNewId = r.id;
+        }
+    }
+    CHECK(firstNewId == img.nextTrackId, "first track initiated after the restore takes the saved next ID");
+    CHECK(mismatched == 0, "later dwells match the uninterrupted run (" +
+                           std::to_string(dwells.size() - SAVED) + " dwells)");
+    std::filesystem::remove_all(tmpDir, ec);
+}
+
+// ---------------------------------------------------------------------------
+// 2. Distributed handover
+// ---------------------------------------------------------------------------
+// Tracks of `tm` within `gate` m of `p`.
+static int tracksNear(const TrackManager& tm, const CartesianPos& p, double gate) {
+    int n = 0;
+    for (size_t i = 0; i < tm.tracks().size(); ++i) {
+        const StateVector& x = tm.tracks()[i].state();
+        const double dx = x[0] - p.x, dy = x[3] - p.y, dz = x[6] - p.z;
+        if (dx * dx + dy * dy + dz * dz < gate * gate) ++n;
+    }
+    return n;
+}
+
+// Node 0 owns azimuth < 0, node 1 azimuth > 0.
+static void makeNodes(const TrackerConfig& base, std::unique_ptr<TrackManager> (&nodes)[2]) {
+    TrackerConfig cfg = base;
+    cfg.distributed.enabled = true;
+    cfg.distributed.sectors.clear();
+    cfg.distributed.sectors.push_back({0, -180.0, 0.0, 0.0, 30000.0});
+    cfg.distributed.sectors.push_back({1, 0.0, 180.0, 0.0, 30000.0});
+    for (uint32_t n = 0; n < 2; ++n) {
+        cfg.distributed.nodeId = n;
+        nodes[n] = std::make_unique<TrackManager>(cfg);
+    }
+}
+
+// Two targets at constant range sweeping across the boundary in opposite
+// directions, seen by both radars; 90% detection, no clutter, 10 Hz.
+struct Crossing {
+    struct Target { double range, az, azRate, el; };
+    Target targets[2] = {{3000.0, -0.25, 0.02, 0.05}, {5000.0, 0.25, -0.012, 0.08}};
+    std::mt19937_64 rng{11};
+    std::uniform_real_distribution<> unit{0.0, 1.0};
+
+    SPDetectionMessage dwell(uint32_t d) {
+        const double dt = 0.1;
+        SPDetectionMessage msg;
+        msg.messageId  = MSG_ID_SP_DETECTION;
+        msg.dwellCount = d;
+        msg.timestamp  = EPOCH_US + static_cast<Timestamp>(d) * 100000;
+        for (Target& t : targets) {
+            t.az += t.azRate * dt;
+            if (unit(rng) > 0.9) continue;
+            Detection det;
+            det.range     = t.range + (unit(rng) - 0.5) * 6.0;
+            det.azimuth   = t.az + (unit(rng) - 0.5) * 0.004;
+            det.elevation = t.el;
+            det.strength  = -60.0;
+            det.noise     = -90.0;
+            det.snr       = 30.0;
+            det.rcs       = 1.0;
+            msg.detections.push_back(det);
+        }
+        msg.numDetections = static_cast<uint32_t>(msg.detections.size());
+        return msg;
+    }
+
+    // Each target has one track, on the node owning its azimuth and under
+    // one of `handedIds`, and none on the other node.
+    bool endsOnOwners(const std::unique_ptr<TrackManager> (&nodes)[2],
+                      const std::set<uint32_t>& handedIds) const {
+        bool kept = true;
+        for (const Target& t : targets) {
+            const TrackManager& owner = *nodes[t.az < 0.0 ? 0 : 1];
+            const CartesianPos  p     = sphericalToCartesian(t.range, t.az, t.el);
+            int onTarget = 0;
+            for (size_t i = 0; i < owner.tracks().size(); ++i) {
+                const StateVector& x = owner.tracks()[i].state();
+                const double dx = x[0] - p.x, dy = x[3] - p.y, dz = x[6] - p.z;
+                if (dx * dx + dy * dy + dz * dz < 50.0 * 50.0) {
+                    ++onTarget;
+                    kept &= handedIds.count(owner.tracks()[i].id()) == 1;
+                }
+            }
+            kept &= onTarget == 1 && tracksNear(*nodes[t.az < 0.0 ? 1 : 0], p, 50.0) == 0;
+        }
+        return kept;
+    }
+};
+
+static void testHandover(const TrackerConfig& base) {
+    std::cout << "\n--- Distributed handover ---\n";
+    std::unique_ptr<TrackManager> nodes[2];
+    makeNodes(base, nodes);
+    Crossing sc;
+
+    int handovers = 0, accepted = 0, sharedIds = 0;
+    bool addressed = true, moved = true, single = true;
+    std::set<uint32_t> handedIds;
+    for (uint32_t d = 0; d < 300; ++d) {
+        const SPDetectionMessage msg = sc.dwell(d);
+        for (auto& node : nodes) node->processDwell(msg);
+
+        // Between dwells each node takes the other's handovers.
+        for (uint32_t from = 0; from < 2; ++from) {
+            const uint32_t to = 1 - from;
+            for (const TrackManager::Handover& h : nodes[from]->handovers()) {
+                ++handovers;
+                addressed &= h.toNode == to;
+                moved     &= nodes[from]->tracks().find(h.track.id) < 0;
+                moved     &= h.track.stateTime == msg.timestamp;
+                if (!nodes[to]->acceptHandover(h.track)) continue;
+                ++accepted;
+                handedIds.insert(h.track.id);
+                const long pos = nodes[to]->tracks().find(h.track.id);
+                moved &= pos >= 0 &&
+                         nodes[to]->tracks()[pos].state() == h.track.state &&
+                         nodes[to]->tracks()[pos].covariance() == h.track.covariance;
+                const CartesianPos p{h.track.state[0], h.track.state[3], h.track.state[6]};
+                single &= tracksNear(*nodes[to], p, base.distributed.dedupGateM) == 1 &&
+                          tracksNear(*nodes[from], p, base.distributed.dedupGateM) == 0;
+            }
+        }
+        for (size_t i = 0; i < nodes[0]->tracks().size(); ++i)
+            if (nodes[1]->tracks().find(nodes[0]->tracks()[i].id()) >= 0) ++sharedIds;
+    }
+
+    std::cout << "  " << handovers << " handovers, " << accepted << " accepted\n";
+    CHECK(handovers >= 2 && accepted == handovers, "each crossing target handed over and accepted");
+    CHECK(addressed, "handovers addressed to the owning node");
+    CHECK(moved, "a handed-over track leaves its node and continues under its ID and state");
+    CHECK(single, "after a handover the target has one track, on the receiving node");
+    CHECK(sharedIds == 0, "no track ID on both nodes");
+    CHECK(sc.endsOnOwners(nodes, handedIds), "each target ends on its owner's track with the handed-over ID");
+}
+
+// ---------------------------------------------------------------------------
+// 3. Late and early handovers
+// ---------------------------------------------------------------------------
+// The handover scene with node 1 running `behind` dwells after node 0 and
+// each handover delivered `delay` dwells after it was sent.
+static void runSkewedHandover(const TrackerConfig& base, uint32_t behind, uint32_t delay,
+                              const std::string& name) {
+    constexpr uint32_t DWELLS = 300;
+    std::unique_ptr<TrackManager> nodes[2];
+    makeNodes(base, nodes);
+    const IMMFilter filter(base.prediction);
+    Crossing sc;
+
+    struct InFlight {
+        uint32_t        due = 0, to = 0;
+        CheckpointTrack track;
+    };
+    std::vector<SPDetectionMessage> dwells;
+    std::vector<InFlight> inFlight, waiting;   // sent; accepted ahead of the receiver
+    Timestamp last[2] = {0, 0};
+    int handovers = 0, accepted = 0, late = 0, early = 0;
+    bool aligned = true, held = true;
+    std::set<uint32_t> handedIds;
+    for (uint32_t step = 0; step < DWELLS + behind; ++step) {
+        if (step < DWELLS) dwells.push_back(sc.dwell(step));
+        for (uint32_t n = 0; n < 2; ++n) {
+            const uint32_t lag = n == 1 ? behind : 0;
+            if (step < lag || step - lag >= DWELLS) continue;
+            const SPDetectionMessage& msg = dwells[step - lag];
+            nodes[n]->processDwell(msg);
+            last[n] = msg.timestamp;
+            for (const TrackManager::Handover& h : nodes[n]->handovers())
+                inFlight.push_back({step + delay, h.toNode, h.track});
+
+            // Those accepted ahead join once the node reaches their dwell,
+            // with the state as sent.
+            for (auto it = waiting.begin(); it != waiting.end();) {
+                if (it->to != n || it->track.stateTime > last[n]) { ++it; continue; }
+                const long pos = nodes[n]->tracks().find(it->track.id);
+                aligned &= pos >= 0 && nodes[n]->tracks()[pos].state() == it->track.state &&
+                           nodes[n]->tracks()[pos].covariance() == it->track.covariance;
+                it = waiting.erase(it);
+            }
+        }
+
+        for (auto it = inFlight.begin(); it != inFlight.end();) {
+            if (it->due != step) { ++it; continue; }
+            const InFlight h = *it;
+            it = inFlight.erase(it);
+            ++handovers;
+            TrackManager& to = *nodes[h.to];
+            if (!to.acceptHandover(h.track)) continue;
+            ++accepted;
+            handedIds.insert(h.track.id);
+            if (h.track.stateTime > last[h.to]) {
+                ++early;
+                held &= to.tracks().find(h.track.id) < 0;
+                waiting.push_back(h);
+                continue;
+            }
+            // A late state goes on predicted to the receiver's dwell.
+            if (h.track.stateTime < last[h.to]) ++late;
+            IMMState expected = h.track.imm;
+            filter.predict((last[h.to] - h.track.stateTime) * 1e-6, expected);
+            const long pos = to.tracks().find(h.track.id);
+            aligned &= pos >= 0 && to.tracks()[pos].state() == expected.mergedState &&
+                       to.tracks()[pos].covariance() == expected.mergedCovariance;
+        }
+    }
+
+    std::cout << "  " << name << ": " << handovers << " handovers, " << accepted << " accepted ("
+              << late << " late, " << early << " early)\n";
+    CHECK(handovers >= 2 && accepted == handovers, name + ": every handover accepted");
+    if (behind > 0)
+        CHECK(late > 0 && early > 0 && held && waiting.empty(),
+              name + ": a handover from the node ahead waits for the receiver's dwell");
+    else
+        CHECK(late == handovers, name + ": every handover arrives behind the receiver");
+    CHECK(aligned, name + ": the handed-over state is predicted to the receiver's dwell");
+    CHECK(sc.endsOnOwners(nodes, handedIds), name + ": each target ends on its owner's handed-over track");
+}
+
+static void testSkewedHandover(const TrackerConfig& base) {
+    std::cout << "\n--- Late and early handovers ---\n";
+    runSkewedHandover(base, 0, 2, "delivered 2 dwells late");
+    runSkewedHandover(base, 1, 0, "node 1 a dwell behind");
+}
+
+// ---------------------------------------------------------------------------
+// 4. Lazy prediction
+// ---------------------------------------------------------------------------
+static double maxAbsDiff(const StateVector& a, const StateVector& b) {
+    double d = 0.0;
+    for (size_t k = 0; k < a.size(); ++k) d = std::max(d, std::abs(a[k] - b[k]));
+    return d;
+}
+
+static double maxRelDiff(const SymStateMatrix& a, const SymStateMatrix& b) {
+    double d = 0.0;
+    for (size_t k = 0; k < a.v.size(); ++k)
+        d = std::max(d, std::abs(a.v[k] - b.v[k]) / std::max(1.0, std::abs(b.v[k])));
+    return d;
+}
+
+static void testLazyPrediction(const TrackerConfig& base) {
+    std::cout << "\n--- Lazy prediction ---\n";
+    TrackerConfig cfg = base;
+    cfg.trackManagement.lazyPrediction.enabled     = false;
+    auto eager = std::make_unique<TrackManager>(cfg);
+    cfg.trackManagement.lazyPrediction.enabled     = true;
+    cfg.trackManagement.lazyPrediction.afterMisses = 1;
+    auto lazy  = std::make_unique<TrackManager>(cfg);
+
+    // One target at constant velocity, detected for 15 dwells, missed for
+    // the next 6, then detected again.
+    constexpr uint32_t FIRST_MISS = 15, RETURN = 21, DWELLS = 40;
+    const double dt = 0.1;
+    std::mt19937_64 rng(13);
+    std::uniform_real_distribution<> unit(-0.5, 0.5);
+
+    bool extrapolated = true, woke = false, sameId = true;
+    uint32_t parkedDwells = 0;
+    double stateDiff = 0.0, covDiff = 0.0;
+    StateVector atPark{};
+    for (uint32_t d = 0; d < DWELLS; ++d) {
+        const double t = d * dt;
+        const SphericalPos sph = cartesianToSpherical(2000.0 - 20.0 * t, 1000.0 + 15.0 * t, 150.0);
+        SPDetectionMessage msg;
+        msg.messageId  = MSG_ID_SP_DETECTION;
+        msg.dwellCount = d;
+        msg.timestamp  = EPOCH_US + static_cast<Timestamp>(d) * 100000;
+        if (d < FIRST_MISS || d >= RETURN) {
+            Detection det;
+            det.range     = sph.range + unit(rng) * 4.0;
+            det.azimuth   = sph.azimuth + unit(rng) * 0.002;
+            det.elevation = sph.elevation;
+            det.strength  = -60.0;
+            det.noise     = -90.0;
+            det.snr       = 30.0;
+            det.rcs       = 1.0;
+            msg.detections.push_back(det);
+        }
+        msg.numDetections = static_cast<uint32_t>(msg.detections.size());
+        eager->processDwell(msg);
+        lazy->processDwell(msg);
+
+        if (eager->tracks().empty() && lazy->tracks().empty() && d < FIRST_MISS) continue;   // initiating
+        if (eager->tracks().size() != 1 || lazy->tracks().size() != 1) {
+            sameId = false;
+            continue;
+        }
+        const Track& e = eager->tracks()[0];
+        const Track& l = lazy->tracks()[0];
+        sameId &= e.id() == l.id() && eager->tracks().hitCount(0) == lazy->tracks().hitCount(0);
+
+        if (d == FIRST_MISS) atPark = l.state();   // the first miss parks it next dwell
+        if (d > FIRST_MISS && d < RETURN) {
+            // Parked since the start of dwell FIRST_MISS + 1: position
+            // advanced at the parked velocity over the elapsed time.
+            if (l.slot() == Track::NO_SLOT && lazy->tracks().status(0) == TrackStatusVal::Coasting)
+                ++parkedDwells;
+            const double elapsed = (d - FIRST_MISS) * dt;
+            for (int k = 0; k < STATE_DIM; k += 3)
+                extrapolated &= std::abs(l.state()[k] - (atPark[k] + elapsed * atPark[k + 1])) < 1e-6;
+        }
+        if (d == RETURN)
+            woke = l.slot() != Track::NO_SLOT && lazy->tracks().consecutiveMisses(0) == 0;
+        if (d >= RETURN) {
+            stateDiff = std::max(stateDiff, maxAbsDiff(l.state(), e.state()));
+            covDiff   = std::max(covDiff, maxRelDiff(l.covariance(), e.covariance()));
+        }
+    }
+
+    std::cout << "  after waking: max state difference " << stateDiff
+              << ", max relative covariance difference " << covDiff << "\n";
+    CHECK(sameId, "one track, same ID and hits, on both managers every dwell");
+    CHECK(parkedDwells == RETURN - FIRST_MISS - 1, "coasting track parked outside the IMM batch while missed");
+    CHECK(extrapolated, "parked track reports the CV extrapolation over the elapsed time");
+    CHECK(woke, "a detection inside its extrapolated gate wakes it and it associates");
+    CHECK(stateDiff < 1e-6 && covDiff < 1e-9, "after the catch-up the estimate matches eager prediction");
+}
+
+// ---------------------------------------------------------------------------
+// 5. Track-aided clustering
+// ---------------------------------------------------------------------------
+static bool sameClusters(const std::vector<CounterUAS::ClusterData>& a,
+                         const std::vector<CounterUAS::ClusterData>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (a[i].numDetections() != b[i].numDetections() || a[i].x() != b[i].x() ||
+            a[i].y() != b[i].y() || a[i].z() != b[i].z())
+            return false;
+    return true;
+}
+
+static void runTrackAided(const TrackerConfig& base, const std::vector<SPDetectionMessage>& dwells,
+                          const std::string& name) {
+    TrackerConfig cfg = base;
+    cfg.pipeline.pipelined    = false;
+    cfg.clustering.trackAided = true;
+    auto blind = std::make_unique<TrackManager>(base);
+    auto aided = std::make_unique<TrackManager>(cfg);
+
+    int mismatched = 0, aidedDwells = 0;
+    size_t confirmed = 0;
+    for (const auto& msg : dwells) {
+        blind->processDwell(msg);
+        aided->processDwell(msg);
+        if (snapshot(*blind) != snapshot(*aided)) ++mismatched;
+        // The aided manager lists its track-aided clusters after the others.
+        if (!sameClusters(blind->lastClusters(), aided->lastClusters())) ++aidedDwells;
+        confirmed = std::max<size_t>(confirmed, aided->numConfirmedTracks());
+    }
+
+    std::cout << "  " << name << ": up to " << confirmed << " confirmed tracks, aided clusters on "
+              << aidedDwells << " of " << dwells.size() << " dwells\n";
+    CHECK(confirmed >= 6 && aidedDwells > static_cast<int>(dwells.size()) / 2,
+          name + ": confirmed tracks aid the clustering on most dwells");
+    CHECK(mismatched == 0, name + ": track IDs, states and counters match the blind manager every dwell");
+}
+
+static void testTrackAided(const TrackerConfig& base, const std::vector<SPDetectionMessage>& dwells) {
+    std::cout << "\n--- Track-aided clustering ---\n";
+    runTrackAided(base, dwells, "light clutter");
+    const std::vector<SPDetectionMessage> dense = generate(30.0, 0.01);
+    runTrackAided(base, dense, "dense clutter");
+    TrackerConfig greedy = base;
+    greedy.clustering.method = ClusterMethod::RangeBased;
+    runTrackAided(greedy, dense, "dense clutter, RangeBased");
+}
+
+// ---------------------------------------------------------------------------
+// main
+// ---------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <source dir>\n";
+        return 1;
+    }
+    const std::string root = argv[1];
+
+    std::cout << "====================================================\n";
+    std::cout << "  Counter-UAS Track Manager Tests\n";
+    std::cout << "====================================================\n";
+
+    ConsoleLogger::instance().setLevel(ConsoleLogger::ERROR);
+    TrackerConfig base = loadConfig(root + "/config/tracker_config.json");
+    base.system.logEnabled         = false;
+    base.system.checkpoint.enabled = false;
+    base.clustering.method         = ClusterMethod::DBSCAN;
+    base.clustering.sectors        = 1;
+
+    const std::vector<SPDetectionMessage> dwells = generate(30.0);
+
+    testCheckpoint(base, dwells, "/tmp/cuas_test_track_manager");
+    testHandover(base);
+    testSkewedHandover(base);
+    testLazyPrediction(base);
+    testTrackAided(base, dwells);
+
+    std::cout << "\n====================================================\n";
+    std::cout << "  Results: " << g_pass << " passed, "
+              << g_fail << " failed\n";
+    std::cout << "====================================================\n";
+
+    return g_fail == 0 ? 0 : 1;
+}